@@ -1,25 +1,80 @@
 #include "ensim_api.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <float.h>
 #include <math.h>
+#include <stdatomic.h>
 
-// incluye los headers reales del core ensim4
+// incluye los headers reales del core ensim4, en el mismo orden que main.c
+// (los headers del core son static: esta unidad es la única que los compila)
+#include "threads.h"
 #include "std.h"
-#include "sampler_s.h"
+#include "simd.h"
+#include "profile_s.h"
+#include "perf_counter_s.h"
+#include "normalized_s.h"
+#include "fft_s.h"
+#include "convo_filter_s.h"
+#include "highpass_filter_s.h"
+#include "lowpass_filter_s.h"
+#include "cp_table.h"
+#include "gamma.h"
+#include "isentropic.h"
+#include "gas_s.h"
+#include "chamber_s.h"
+#include "gas_mail_s.h"
+#include "nozzle_flow_s.h"
+#include "crankshaft_s.h"
+#include "sparkplug_s.h"
+#include "flywheel_s.h"
+#include "starter_s.h"
+#include "limiter_s.h"
+#include "dyno_s.h"
+#include "valve_s.h"
 #include "synth_s.h"
+#include "block_controller_s.h"
+#include "waveguide_tube_s.h"
+#include "waveguide_s.h"
+#include "wave_s.h"
+#include "wave_pool_s.h"
+#include "source_s.h"
+#include "afilter_s.h"
+#include "iplenum_s.h"
+#include "injector_s.h"
+#include "throttle_s.h"
+#include "irunner_s.h"
+#include "piston_s.h"
+#include "erunner_s.h"
+#include "eplenum_s.h"
+#include "exhaust_s.h"
+#include "sink_s.h"
+#include "node_s.h"
+#include "batch_flow_s.h"
+#include "sampler_s.h"
 #include "engine_s.h"
-#include "gamma.h"
-
-// ---- IMPORTANTE ----
-// Esto asume que engine_s soporta:
-//   struct node_s* node; size_t size;
-// y que reset_engine/run_engine ya existen (como en main.c). :contentReference[oaicite:1]{index=1}
-
-typedef struct {
+#include "engine_blueprints.h"
+#include "cJSON.h"
+#include "hotreload_engine.h"
+#include "engine_params.h"
+#include "engine_graph.c"
+
+constexpr size_t g_ensim_cache_line_bytes = 64;
+constexpr unsigned g_ensim_throttle_control = 1u << 0;
+constexpr unsigned g_ensim_starter_control = 1u << 1;
+constexpr unsigned g_ensim_ignite_control = 1u << 2;
+constexpr unsigned g_ensim_block_control = 1u << 3;
+constexpr unsigned g_ensim_all_controls = g_ensim_throttle_control | g_ensim_starter_control | g_ensim_ignite_control | g_ensim_block_control;
+
+// Todo el estado de un motor vive en su contexto (ver engine_s.h), así que
+// cada contexto se puede tickear desde su propio hilo en paralelo con otros.
+struct ensim_context_t {
     struct sampler_s sampler;
     sampler_synth_t  sampler_synth;
     struct synth_s   synth;
     struct engine_s  engine;
+    hr_state_t       hr;       // nodos e impulso de motores cargados de JSON
 
     double monitor_refresh_hz;
     float  sample_rate_hz;
@@ -28,79 +83,214 @@ typedef struct {
     struct node_s* heap_nodes;
     size_t heap_nodes_count;
 
-    float throttle;
-    int starter_on;
-    int can_ignite;
-} ensim_context_t;
+    // frames del último bloque que el host todavía no leyó (al final de synth.value)
+    size_t carry_frames;
+
+    // bloque: fijo, o elegido por el controlador entre el mínimo y block_max_size
+    // según el costo medido (block_max_size = 0 lo deja fijo en block_size)
+    atomic_size_t block_size;
+    atomic_size_t block_max_size;
+    struct block_controller_s block_controller;
+    bool is_block_adaptive;
+    atomic_size_t frames_per_tick;     // el bloque en uso, publicado por quien simula
+
+    // controles: los escribe el host desde cualquier hilo y los aplica el que
+    // simula al principio del próximo bloque (el limiter también mueve can_ignite,
+    // así que sólo se aplica lo que cambió)
+    _Atomic float throttle;
+    atomic_int starter_on;
+    atomic_int can_ignite;
+    atomic_uint pending_controls;
+    _Atomic float rpm;
+
+    // stream: ring SPSC que llena el hilo productor y vacía ensim_pull_f32.
+    // Sobre el objetivo queda lugar para un bloque del tamaño máximo, así el
+    // productor siempre tiene dónde escribir aunque el bloque cambie.
+    float* ring;
+    size_t ring_size;
+    size_t ring_target;                // frames simulados por adelantado
+    atomic_size_t ring_write;
+    char ring_pad[g_ensim_cache_line_bytes];
+    atomic_size_t ring_read;
+    atomic_size_t underruns;
+    atomic_bool is_streaming;
+    thrd_t producer;
+    mtx_t sim_mutex;                   // lo toma quien simula o cambia el motor
+};
+
+static double get_ensim_ticks_ms() {
+    return SDL_GetTicksNS() * 1e-6;
+}
 
 static void free_graph(ensim_context_t* ctx) {
+    // los jobs de waves de este contexto pueden seguir corriendo en el pool
+    wait_for_engine_waves(&ctx->engine);
     if (ctx->heap_nodes) {
         free(ctx->heap_nodes);
         ctx->heap_nodes = NULL;
         ctx->heap_nodes_count = 0;
     }
+    free(ctx->engine.edge);
+    free_batch_flow(&ctx->engine.batch_flow);
+    free_wave_table(&ctx->engine.waves);
+    free(ctx->engine.wave_job);
+    ctx->engine.wave_job = NULL;
     ctx->engine.node = NULL;
     ctx->engine.size = 0;
+    ctx->engine.edge = NULL;
+    ctx->engine.edges = 0;
 }
 
-// ---- Builder mínimo de grafo dinámico ----
-// V1: genera un motor “genérico” con N cilindros usando los mismos tipos de nodos
-// que ensim4 ya tiene (iplenum/injector/piston/erunner/eplenum/...)
-// En tu repo esos structs existen porque main.c los incluye. :contentReference[oaicite:2]{index=2}
-//
-// Si tu node_s es una unión "as.*", este builder se completa siguiendo TU node_s real.
-// Acá te dejo la estructura del flujo y el contrato: una función que “aloca y llena”.
-
-static int build_generic_engine_graph(ensim_context_t* ctx, const ensim_engine_params_t* p) {
-    // Conteo simple: por cilindro ~ 6 nodos (depende tu grafo real)
-    // Ajustalo cuando mapees tus tipos reales.
-    size_t per_cyl = 6;
-    size_t base_nodes = 4; // crank/sink/etc según tu grafo
-    size_t total = base_nodes + (size_t)p->cylinders * per_cyl;
+// ---- Builder de grafo ----
+// Traduce los parámetros de la API a los de engine_params.h; el grafo lo arma
+// build_dynamic_engine_nodes (engine_graph.c) con la misma topología para
+// cualquier cantidad de cilindros.
 
-    struct node_s* nodes = (struct node_s*)calloc(total, sizeof(struct node_s));
-    if (!nodes) return -1;
+static bool is_ensim_params_valid(const ensim_engine_params_t* p) {
+    return p->cylinders >= 1 && p->cylinders <= ENSIM4_MAX_CYLINDERS
+        && p->bore_m > 0.0f && p->stroke_m > 0.0f
+        && p->rod_length_m > 0.5f * p->stroke_m;
+}
 
-    // TODO: acá va el llenado real de nodes[i].as.<tipo> y nodes[i].next[]
-    // El punto crítico: NO usar designated initializers tipo ".as.piston = {...}" en C++.
-    // Esto es C puro. En MSYS/clang C23 funciona.
+static void fill_graph_params(const ensim_engine_params_t* p, ensim4_engine_params_t* g) {
+    memset(g, 0, sizeof(*g));
+    g->cylinders = p->cylinders;
+    g->layout = (ensim4_engine_layout_e)p->layout;
+    g->bank_angle_deg = p->bank_angle_deg;
+    g->radial_spacing = p->radial_spacing;
+
+    g->mech.bore_m = p->bore_m;
+    g->mech.stroke_m = p->stroke_m;
+    g->mech.rod_length_m = p->rod_length_m;
+    g->mech.compression_ratio = p->compression_ratio;
+    g->mech.piston_mass_kg = p->piston_mass_kg;
+    g->mech.rod_mass_kg = p->conrod_mass_kg;
+    g->mech.crank_mass_kg = p->crank_mass_kg;
+    g->mech.crank_radius_m = p->crank_radius_m;
+    g->mech.flywheel_mass_kg = p->flywheel_mass_kg;
+    g->mech.flywheel_radius_m = p->flywheel_radius_m;
+    g->mech.static_friction_n_m_s_per_r = p->piston_static_friction;
+    g->mech.dynamic_friction_n_m_s_per_r = p->piston_dynamic_friction;
+
+    g->flow.afr_target = p->afr;
+    g->flow.fuel_energy_j_per_kg = p->fuel_lhv_j_per_kg;
+    g->flow.manifold_volume_m3 = p->intake_plenum_volume_m3;
+    g->flow.runner_volume_m3 = p->intake_runner_volume_m3;
+    g->flow.runner_nozzle_max_area_m2 = p->intake_runner_max_area_m2;
+    g->flow.exhaust_volume_m3 = p->exhaust_plenum_volume_m3;
+
+    // grados desde el PMS de combustión, igual que engine_params.h
+    g->valves.intake_open_deg = p->intake_open_deg;
+    g->valves.intake_close_deg = p->intake_close_deg;
+    g->valves.exhaust_open_deg = p->exhaust_open_deg;
+    g->valves.exhaust_close_deg = p->exhaust_close_deg;
+    g->valves.intake_ramp_deg = p->valve_ramp_deg;
+    g->valves.exhaust_ramp_deg = p->valve_ramp_deg;
+
+    g->ignition.redline_rpm = p->redline_rpm;
+    g->ignition.spark_advance_deg_by_rpm.count = 1;
+    g->ignition.spark_advance_deg_by_rpm.value[0] = p->ignition_advance_deg;
+
+    // firing_order[k] es el cilindro que enciende k-ésimo
+    g->firing.mode = ENSIM4_FIRE_AUTO;
+    if (p->firing_mode == ENSIM_FIRING_CUSTOM && p->firing_order) {
+        g->firing.mode = ENSIM4_FIRE_MANUAL_DEGREES;
+        for (uint32_t k = 0; k < p->cylinders; k++) {
+            uint8_t cylinder = p->firing_order[k] < p->cylinders ? p->firing_order[k] : (uint8_t)k;
+            g->firing.firing_deg[cylinder] = 720.0f / p->cylinders * k;
+        }
+    }
+    g->audio.sample_rate_hz = (uint32_t)p->sample_rate_hz;
+    g->audio.master_gain = p->master_volume;
+}
 
-    // Por ahora dejamos el grafo como “placeholder válido” solo si tu engine_s tolera size=0.
-    // PERO: para sonar, tenés que mapear tu node_s real.
-    // (esto es el único lugar donde hay trabajo mecánico, pero es directo)
+// dc filter y convolución arrancan de cero con cada motor nuevo; el volumen es del host
+static void reset_ensim_synth(ensim_context_t* ctx) {
+    // reset_synth libera los planes FFT y espera los trabajos de la cola antes de limpiar
+    reset_synth(&ctx->synth);
+    ctx->carry_frames = 0;
+}
 
-    ctx->heap_nodes = nodes;
-    ctx->heap_nodes_count = total;
+static void apply_ensim_controls(ensim_context_t* ctx, unsigned controls) {
+    if (controls & g_ensim_throttle_control) ctx->engine.throttle_open_ratio = atomic_load(&ctx->throttle);
+    if (controls & g_ensim_starter_control) ctx->engine.starter.is_on = atomic_load(&ctx->starter_on) != 0;
+    if (controls & g_ensim_ignite_control) ctx->engine.can_ignite = atomic_load(&ctx->can_ignite) != 0;
+    if (controls & g_ensim_block_control) {
+        size_t block_size = atomic_load(&ctx->block_size);
+        size_t block_max_size = atomic_load(&ctx->block_max_size);
+        ctx->is_block_adaptive = block_max_size > 0;
+        if (ctx->is_block_adaptive) {
+            reset_block_controller(&ctx->block_controller, block_size, block_max_size);
+            block_size = ctx->block_controller.block_size;
+        }
+        // sin memoria para el bloque nuevo se sigue con el de antes
+        if (!resize_engine_block(&ctx->engine, block_size) && ctx->is_block_adaptive) {
+            reset_block_controller(&ctx->block_controller, ctx->engine.block_size, block_max_size);
+        }
+    }
+}
 
-    ctx->engine.node = nodes;
-    ctx->engine.size = total;
+// reset_engine apaga el starter y cierra el acelerador: los toggles van después
+static void apply_ensim_toggles(ensim_context_t* ctx) {
+    atomic_store(&ctx->pending_controls, 0);
+    apply_ensim_controls(ctx, g_ensim_all_controls);
+}
 
-    return 0;
+static void post_ensim_control(ensim_context_t* ctx, unsigned control) {
+    atomic_fetch_or_explicit(&ctx->pending_controls, control, memory_order_release);
 }
 
 ensim_context_t* ensim_create(double monitor_refresh_hz) {
-    precompute_cp(); // como en main.c :contentReference[oaicite:3]{index=3}
+    precompute_isentropic(ENSIM4_ISENTROPIC_MAX_ERROR); // no-op si ya están armadas
 
-    ensim_context_t* ctx = (ensim_context_t*)calloc(1, sizeof(ensim_context_t));
+    // el motor tiene miembros alineados a línea de caché y calloc solo garantiza 16 bytes
+    ensim_context_t* ctx = (ensim_context_t*)aligned_alloc(alignof(ensim_context_t), sizeof(ensim_context_t));
     if (!ctx) return NULL;
+    memset(ctx, 0, sizeof(*ctx));
     ctx->monitor_refresh_hz = monitor_refresh_hz;
     ctx->sample_rate_hz = 48000.0f;
+    // todo el estado de simulación es del contexto: el volumen de salida también
+    ctx->synth.volume = 1.0;
+    // el bloque por defecto sigue al monitor del host, no al del build
+    double block_size = monitor_refresh_hz > 0.0 ? ctx->sample_rate_hz / monitor_refresh_hz : g_synth_buffer_size;
+    atomic_store(&ctx->block_size, (size_t)block_size);
+    atomic_store(&ctx->frames_per_tick, (size_t)block_size);
+    if (mtx_init(&ctx->sim_mutex) != thrd_success) {
+        free(ctx);
+        return NULL;
+    }
     return ctx;
 }
 
 void ensim_destroy(ensim_context_t* ctx) {
     if (!ctx) return;
+    ensim_stream_stop(ctx);
     free_graph(ctx);
+    free_synth(&ctx->synth);
+    mtx_destroy(&ctx->sim_mutex);
     free(ctx);
 }
 
 int ensim_engine_build(ensim_context_t* ctx, const ensim_engine_params_t* p) {
-    if (!ctx || !p) return -1;
+    if (!ctx || !p || !is_ensim_params_valid(p)) return -1;
+
+    // el grafo se arma antes de soltar el motor actual: si falla, sigue sonando el viejo
+    ensim4_engine_params_t graph;
+    fill_graph_params(p, &graph);
+    size_t size = 0;
+    struct node_s* nodes = build_dynamic_engine_nodes(&graph, &size);
+    if (!nodes) return -2;
 
+    mtx_lock(&ctx->sim_mutex);
     free_graph(ctx);
+    memset(&ctx->engine, 0, sizeof(ctx->engine));
+    ctx->heap_nodes = nodes;
+    ctx->heap_nodes_count = size;
+    ctx->engine.node = nodes;
+    ctx->engine.size = size;
 
     // set mecánica base
-    memset(&ctx->engine, 0, sizeof(ctx->engine));
+    ctx->engine.name = "ensim_api";
     ctx->engine.volume = p->master_volume;
     ctx->engine.radial_spacing = p->radial_spacing;
 
@@ -110,7 +300,7 @@ int ensim_engine_build(ensim_context_t* ctx, const ensim_engine_params_t* p) {
     ctx->engine.flywheel.radius_m = p->flywheel_radius_m;
 
     // limiter/starter (convert rpm -> rad/s)
-    const double rpm_to_rad = (2.0 * M_PI) / 60.0;
+    const double rpm_to_rad = (2.0 * g_std_pi_r) / 60.0;
     ctx->engine.limiter.cutoff_angular_velocity_r_per_s  = (double)p->redline_rpm * rpm_to_rad;
     ctx->engine.limiter.relaxed_angular_velocity_r_per_s = (double)p->limiter_relax_rpm * rpm_to_rad;
 
@@ -118,78 +308,269 @@ int ensim_engine_build(ensim_context_t* ctx, const ensim_engine_params_t* p) {
     ctx->engine.starter.no_load_angular_velocity_r_per_s = (double)p->starter_no_load_rpm * rpm_to_rad;
     ctx->engine.starter.radius_m = p->starter_radius_m;
 
-    // build graph
-    if (build_generic_engine_graph(ctx, p) != 0) {
-        free_graph(ctx);
+    // mismo impulso y presets de acelerador que un motor cargado sin impulse_preset
+    ctx->engine.impulse = g_convo_filter_impulse;
+    ctx->engine.impulse_size = g_convo_filter_impulse_size;
+    ctx->engine.no_throttle = 0.000;
+    ctx->engine.low_throttle = 0.001;
+    ctx->engine.mid_throttle = 0.050;
+    ctx->engine.high_throttle = 1.000;
+
+    reset_engine(&ctx->engine);
+    reset_ensim_synth(ctx);
+    apply_ensim_toggles(ctx);
+    mtx_unlock(&ctx->sim_mutex);
+    return 0;
+}
+
+int ensim_engine_load(ensim_context_t* ctx, const char* json_path) {
+    if (!ctx || !json_path) return -1;
+
+    mtx_lock(&ctx->sim_mutex);
+    free_graph(ctx);
+    memset(&ctx->engine, 0, sizeof(ctx->engine));
+
+    // los nodos quedan en ctx->hr, que vive tanto como el contexto
+    if (!hr_init(&ctx->hr, json_path, &ctx->engine)) {
+        mtx_unlock(&ctx->sim_mutex);
         return -2;
     }
 
-    // apply runtime toggles
-    ctx->engine.throttle_open_ratio = ctx->throttle;
-    ctx->engine.starter.is_on = ctx->starter_on ? true : false;
-    ctx->engine.can_ignite = ctx->can_ignite ? true : false;
-
     reset_engine(&ctx->engine);
+    reset_ensim_synth(ctx);
+    apply_ensim_toggles(ctx);
+    mtx_unlock(&ctx->sim_mutex);
     return 0;
 }
 
 void ensim_engine_reset(ensim_context_t* ctx) {
     if (!ctx) return;
-    reset_engine(&ctx->engine);
+    mtx_lock(&ctx->sim_mutex);
+    if (ctx->engine.node) {
+        wait_for_engine_waves(&ctx->engine);
+        reset_engine(&ctx->engine);
+        reset_ensim_synth(ctx);
+        apply_ensim_toggles(ctx);
+    }
+    mtx_unlock(&ctx->sim_mutex);
 }
 
 void ensim_set_throttle(ensim_context_t* ctx, float t) {
     if (!ctx) return;
     if (t < 0) t = 0;
     if (t > 1) t = 1;
-    ctx->throttle = t;
-    ctx->engine.throttle_open_ratio = t;
+    atomic_store(&ctx->throttle, t);
+    post_ensim_control(ctx, g_ensim_throttle_control);
 }
 
 void ensim_set_starter(ensim_context_t* ctx, int on) {
     if (!ctx) return;
-    ctx->starter_on = on ? 1 : 0;
-    ctx->engine.starter.is_on = on ? true : false;
+    atomic_store(&ctx->starter_on, on ? 1 : 0);
+    post_ensim_control(ctx, g_ensim_starter_control);
 }
 
 void ensim_set_can_ignite(ensim_context_t* ctx, int on) {
     if (!ctx) return;
-    ctx->can_ignite = on ? 1 : 0;
-    ctx->engine.can_ignite = on ? true : false;
+    atomic_store(&ctx->can_ignite, on ? 1 : 0);
+    post_ensim_control(ctx, g_ensim_ignite_control);
+}
+
+void ensim_set_block_size(ensim_context_t* ctx, size_t frames) {
+    if (!ctx || frames == 0) return;
+    atomic_store(&ctx->block_size, frames);
+    atomic_store(&ctx->block_max_size, 0);
+    post_ensim_control(ctx, g_ensim_block_control);
+}
+
+void ensim_set_adaptive_block_size(ensim_context_t* ctx, size_t max_frames) {
+    if (!ctx) return;
+    atomic_store(&ctx->block_max_size, max_frames);
+    post_ensim_control(ctx, g_ensim_block_control);
 }
 
+// se puede leer desde cualquier hilo; con el bloque adaptivo cambia sobre la marcha
 size_t ensim_get_frames_per_tick(ensim_context_t* ctx) {
-    // V1: equivalente a lo que usa tu synth buffer size:
-    // g_synth_buffer_size = sample_rate / monitor_refresh
-    // Como en tu repo lo hacen con constexpr en headers, lo emulamos:
-    if (!ctx || ctx->monitor_refresh_hz <= 0.0) return 1024;
-    double frames = (double)ctx->sample_rate_hz / ctx->monitor_refresh_hz;
-    if (frames < 64) frames = 64;
-    return (size_t)(frames + 0.5);
+    return ctx ? atomic_load_explicit(&ctx->frames_per_tick, memory_order_relaxed) : g_synth_buffer_size;
+}
+
+// Aplica los controles pendientes y devuelve el tamaño del bloque que sigue.
+static size_t begin_ensim_block(ensim_context_t* ctx) {
+    unsigned controls = atomic_exchange_explicit(&ctx->pending_controls, 0, memory_order_acquire);
+    apply_ensim_controls(ctx, controls);
+    atomic_store_explicit(&ctx->frames_per_tick, ctx->engine.block_size, memory_order_relaxed);
+    return ctx->engine.block_size;
+}
+
+// Un bloque del engine escrito directo en out, o en synth.value si out es NULL.
+static void run_ensim_block(ensim_context_t* ctx, float* out) {
+    redirect_synth(&ctx->synth, out);
+    struct engine_time_s engine_time = { .get_ticks_ms = get_ensim_ticks_ms };
+    double t0 = get_ensim_ticks_ms();
+    run_engine(&ctx->engine, &engine_time, &ctx->sampler, &ctx->synth, 0, ctx->sampler_synth);
+    if (ctx->is_block_adaptive) {
+        size_t block_size = update_block_controller(&ctx->block_controller, get_ensim_ticks_ms() - t0);
+        if (block_size != ctx->engine.block_size && !resize_engine_block(&ctx->engine, block_size)) {
+            reset_block_controller(&ctx->block_controller, ctx->engine.block_size, ctx->block_controller.max_block_size);
+        }
+    }
+    double w = ctx->engine.crankshaft.angular_velocity_r_per_s;
+    atomic_store_explicit(&ctx->rpm, (float)(w * 60.0 / (2.0 * g_std_pi_r)), memory_order_relaxed);
 }
 
+// El engine simula de a bloques enteros. Los bloques que entran completos en
+// out se escriben ahí mismo; sólo el último bloque partido pasa por synth.value,
+// y lo que sobra se entrega al principio del próximo tick.
 int ensim_tick_audio_f32(ensim_context_t* ctx, float* out_frames, size_t frames) {
     if (!ctx || !out_frames || frames == 0) return -1;
+    if (!ctx->engine.node) return -2;
+
+    size_t done = ctx->carry_frames < frames ? ctx->carry_frames : frames;
+    if (done > 0) memcpy(out_frames, ctx->synth.value + ctx->synth.size - ctx->carry_frames, done * sizeof(*out_frames));
+    ctx->carry_frames -= done;
+
+    while (done < frames && !ctx->engine.panic_message) {
+        size_t block_size = begin_ensim_block(ctx);
+        size_t rest = frames - done;
+        if (rest >= block_size) {
+            run_ensim_block(ctx, out_frames + done);
+            done += block_size;
+            continue;
+        }
+        run_ensim_block(ctx, NULL);
+        memcpy(out_frames + done, ctx->synth.value, rest * sizeof(*out_frames));
+        ctx->carry_frames = block_size - rest;
+        done = frames;
+    }
+
+    // un motor en pánico ya no se simula: silencio hasta el próximo build/load/reset
+    if (ctx->engine.panic_message) {
+        memset(out_frames + done, 0, (frames - done) * sizeof(*out_frames));
+        ctx->carry_frames = 0;
+        return -3;
+    }
+    return 0;
+}
+
+const char* ensim_get_panic_message(ensim_context_t* ctx) {
+    return ctx ? ctx->engine.panic_message : NULL;
+}
 
-    clear_synth(&ctx->synth);
+void ensim_set_wave_workers(size_t workers) {
+    limit_wave_pool(workers);
+}
 
-    struct engine_time_s engine_time = {0};
-    // tu engine_time usa get_ticks_ms en main.c para perf/ui. Para offline no hace falta.
+// se publica al final de cada bloque: se puede leer desde la UI con el stream corriendo
+float ensim_get_rpm(ensim_context_t* ctx) {
+    if (!ctx) return 0.0f;
+    return atomic_load_explicit(&ctx->rpm, memory_order_relaxed);
+}
 
-    run_engine(&ctx->engine, &engine_time, &ctx->sampler, &ctx->synth,
-               frames, ctx->sampler_synth);
+// ---- Stream (pull) ----
+// El productor mantiene ring_target frames simulados por adelantado; el host los
+// saca con ensim_pull_f32 desde su callback de audio, que nunca bloquea ni aloca.
+// Los índices del ring sólo crecen: write - read es lo que hay para leer.
 
-    // Convertir el buffer interno a float mono.
-    // Tu synth_s guarda float value[g_synth_buffer_size] (según errores que mostraste).
-    // Copiamos “lo que haya” al out_frames.
-    for (size_t i = 0; i < frames; i++) out_frames[i] = ctx->synth.value[i];
+static size_t get_ensim_ring_frames(ensim_context_t* ctx) {
+    size_t write = atomic_load_explicit(&ctx->ring_write, memory_order_acquire);
+    size_t read = atomic_load_explicit(&ctx->ring_read, memory_order_acquire);
+    return write - read;
+}
 
+// Devuelve false si no hay lugar o el motor no puede simular.
+static bool produce_ensim_block(ensim_context_t* ctx) {
+    if (get_ensim_ring_frames(ctx) >= ctx->ring_target) return false;
+    mtx_lock(&ctx->sim_mutex);
+    bool can_run = ctx->engine.node && !ctx->engine.panic_message;
+    if (can_run) {
+        size_t block_size = begin_ensim_block(ctx);
+        size_t write = atomic_load_explicit(&ctx->ring_write, memory_order_relaxed);
+        size_t start = write % ctx->ring_size;
+        if (start + block_size <= ctx->ring_size) {
+            run_ensim_block(ctx, ctx->ring + start);
+        } else {
+            // el bloque da la vuelta al ring: se simula aparte y se copia en dos partes
+            size_t first = ctx->ring_size - start;
+            run_ensim_block(ctx, NULL);
+            memcpy(ctx->ring + start, ctx->synth.value, first * sizeof(*ctx->ring));
+            memcpy(ctx->ring, ctx->synth.value + first, (block_size - first) * sizeof(*ctx->ring));
+        }
+        atomic_store_explicit(&ctx->ring_write, write + block_size, memory_order_release);
+    }
+    mtx_unlock(&ctx->sim_mutex);
+    return can_run;
+}
+
+static int run_ensim_producer(void* argument) {
+    ensim_context_t* ctx = (ensim_context_t*)argument;
+    // con el ring lleno duerme un cuarto del objetivo antes de volver a mirar
+    unsigned sleep_ms = (unsigned)(250.0 * ctx->ring_target / g_std_audio_sample_rate_hz);
+    while (atomic_load(&ctx->is_streaming)) {
+        if (!produce_ensim_block(ctx)) {
+            thrd_sleep_ms(sleep_ms > 0 ? sleep_ms : 1);
+        }
+    }
+    PERF_CLOSE();
     return 0;
 }
 
-float ensim_get_rpm(ensim_context_t* ctx) {
-    if (!ctx) return 0.0f;
-    // engine.crankshaft.angular_velocity_r_per_s existe en tu repo (por errores previos)
-    double w = ctx->engine.crankshaft.angular_velocity_r_per_s;
-    return (float)(w * 60.0 / (2.0 * M_PI));
+int ensim_stream_start(ensim_context_t* ctx, size_t latency_frames) {
+    if (!ctx) return -1;
+    if (atomic_load(&ctx->is_streaming)) return 0;
+    size_t ring_target = latency_frames > 0 ? latency_frames : 1;
+    // un bloque máximo más que el objetivo: el productor nunca espera al host para escribir
+    size_t ring_size = ring_target + g_synth_max_block_size;
+    float* ring = (float*)calloc(ring_size, sizeof(*ring));
+    if (!ring) return -2;
+    free(ctx->ring);
+    ctx->ring = ring;
+    ctx->ring_size = ring_size;
+    ctx->ring_target = ring_target;
+    atomic_store(&ctx->ring_write, 0);
+    atomic_store(&ctx->ring_read, 0);
+    atomic_store(&ctx->underruns, 0);
+    // el primer pull ya encuentra el objetivo lleno
+    while (produce_ensim_block(ctx)) {}
+    atomic_store(&ctx->is_streaming, true);
+    if (thrd_create(&ctx->producer, run_ensim_producer, ctx) != thrd_success) {
+        atomic_store(&ctx->is_streaming, false);
+        return -3;
+    }
+    return 0;
+}
+
+void ensim_stream_stop(ensim_context_t* ctx) {
+    if (!ctx) return;
+    if (atomic_exchange(&ctx->is_streaming, false)) {
+        thrd_join(ctx->producer, NULL);
+    }
+    free(ctx->ring);
+    ctx->ring = NULL;
+    ctx->ring_size = 0;
+    ctx->ring_target = 0;
+    atomic_store(&ctx->ring_write, 0);
+    atomic_store(&ctx->ring_read, 0);
+}
+
+size_t ensim_pull_f32(ensim_context_t* ctx, float* out_frames, size_t frames) {
+    if (!ctx || !out_frames) return 0;
+    size_t size = 0;
+    if (atomic_load_explicit(&ctx->is_streaming, memory_order_acquire)) {
+        size_t read = atomic_load_explicit(&ctx->ring_read, memory_order_relaxed);
+        size_t write = atomic_load_explicit(&ctx->ring_write, memory_order_acquire);
+        size = write - read < frames ? write - read : frames;
+        size_t start = read % ctx->ring_size;
+        size_t first = ctx->ring_size - start < size ? ctx->ring_size - start : size;
+        memcpy(out_frames, ctx->ring + start, first * sizeof(*out_frames));
+        memcpy(out_frames + first, ctx->ring, (size - first) * sizeof(*out_frames));
+        atomic_store_explicit(&ctx->ring_read, read + size, memory_order_release);
+    }
+    if (size < frames) {
+        memset(out_frames + size, 0, (frames - size) * sizeof(*out_frames));
+        atomic_fetch_add_explicit(&ctx->underruns, 1, memory_order_relaxed);
+    }
+    return size;
+}
+
+size_t ensim_stream_get_underruns(ensim_context_t* ctx) {
+    return ctx ? atomic_load_explicit(&ctx->underruns, memory_order_relaxed) : 0;
 }
@@ -88,19 +88,44 @@ extern "C" {
 
     // engine
     int  ensim_engine_build(ensim_context_t* ctx, const ensim_engine_params_t* p);
+    int  ensim_engine_load(ensim_context_t* ctx, const char* json_path); // mismo JSON que configs/
     void ensim_engine_reset(ensim_context_t* ctx);
 
-    // realtime controls
+    // realtime controls (desde cualquier hilo; se aplican al principio del próximo bloque)
     void ensim_set_throttle(ensim_context_t* ctx, float throttle_0_1);
     void ensim_set_starter(ensim_context_t* ctx, int on);
     void ensim_set_can_ignite(ensim_context_t* ctx, int on);
 
-    // step: genera audio en buffer (mono float)
-    size_t ensim_get_frames_per_tick(ensim_context_t* ctx); // tamaño recomendado
+    // bloque de simulación (32 a 8192 frames; por defecto sample_rate / monitor_refresh_hz).
+    // Bloques chicos bajan la latencia y pagan más veces el costo fijo de cada bloque.
+    // El adaptivo arranca en el bloque actual y busca el más chico que el host
+    // simula holgado en tiempo real, sin pasar de max_frames (0 lo apaga).
+    void ensim_set_block_size(ensim_context_t* ctx, size_t frames);
+    void ensim_set_adaptive_block_size(ensim_context_t* ctx, size_t max_frames);
+
+    // step: genera frames de audio mono float directo en out_frames, cualquier cantidad.
+    // Con múltiplos del bloque nativo no hay ninguna copia intermedia.
+    // Devuelve -2 sin motor, -3 si el motor entró en pánico (rellena con silencio).
+    size_t ensim_get_frames_per_tick(ensim_context_t* ctx); // bloque en uso del engine
     int ensim_tick_audio_f32(ensim_context_t* ctx, float* out_frames, size_t frames);
 
+    // stream (pull): un hilo productor simula por adelantado hasta latency_frames
+    // (al menos un bloque) y ensim_pull_f32 saca audio de un ring lock-free sin
+    // bloquear nunca, así se puede llamar desde el callback de audio del host.
+    // Con el stream corriendo no se usa ensim_tick_audio_f32; build/load/reset sí.
+    // Parar el callback de audio antes de ensim_stream_stop / ensim_destroy.
+    int    ensim_stream_start(ensim_context_t* ctx, size_t latency_frames);
+    void   ensim_stream_stop(ensim_context_t* ctx);
+    size_t ensim_pull_f32(ensim_context_t* ctx, float* out_frames, size_t frames); // frames con audio; el resto es silencio
+    size_t ensim_stream_get_underruns(ensim_context_t* ctx);
+
     // telemetry
     float ensim_get_rpm(ensim_context_t* ctx);
+    const char* ensim_get_panic_message(ensim_context_t* ctx); // NULL si el motor está sano
+
+    // proceso: workers del pool de waves compartido por todos los contextos.
+    // Llamar antes del primer tick; con muchos motores en paralelo conviene 0.
+    void ensim_set_wave_workers(size_t workers);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,180 @@
+// Benchmark del scheduler: cuántos motores entran en el presupuesto de tiempo
+// real a 48 kHz según la cantidad de workers.
+//
+// Para 1, 2, 4... workers (hasta los cores) agrega motores de a uno, alternando
+// los configs dados, hasta que el p95 del tiempo por bloque pasa el presupuesto
+// del bloque (frames / 48000 s). Por defecto el pool de waves queda sin workers:
+// con muchos motores el paralelismo sale del scheduler, no de cada motor.
+//
+//   make ensim4-sched-bench
+//   ./ensim4-sched-bench [-b bloques] [-w max_workers] [--wave-workers n] [config.json]...
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL3/SDL.h>
+
+#include "ensim_api.h"
+#include "ensim_scheduler.h"
+
+constexpr size_t g_bench_max_engines = 64;
+constexpr size_t g_bench_max_configs = 16;
+constexpr size_t g_bench_warmup_blocks = 30;
+constexpr double g_bench_sample_rate_hz = 48000.0;
+constexpr double g_bench_monitor_refresh_hz = 60.0;
+constexpr double g_bench_percentile = 0.95;
+
+typedef struct {
+    const char* config[g_bench_max_configs];
+    size_t configs;
+    size_t blocks;
+    size_t max_workers;
+    size_t wave_workers;
+    ensim_context_t* engine[g_bench_max_engines];
+    float* bus;
+    double* block_ms;
+    size_t frames;
+} bench_t;
+
+static double get_bench_ticks_ms() {
+    return SDL_GetTicksNS() * 1e-6;
+}
+
+static int compare_bench_ms(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Motor arrancado y a fondo: el caso caro y el que más varía entre bloques.
+static ensim_context_t* create_bench_engine(const char* config) {
+    ensim_context_t* ctx = ensim_create(g_bench_monitor_refresh_hz);
+    if (!ctx) return NULL;
+    ensim_set_starter(ctx, 1);
+    ensim_set_can_ignite(ctx, 1);
+    ensim_set_throttle(ctx, 1.0f);
+    if (ensim_engine_load(ctx, config) != 0) {
+        fprintf(stderr, "error: no se pudo cargar '%s'\n", config);
+        ensim_destroy(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+// p95 del tiempo por bloque con los motores que ya tiene el scheduler.
+static double measure_bench_p95_ms(bench_t* bench, ensim_scheduler_t* sched) {
+    for (size_t i = 0; i < g_bench_warmup_blocks; i++) {
+        ensim_scheduler_tick_f32(sched, bench->bus, bench->frames);
+    }
+    for (size_t i = 0; i < bench->blocks; i++) {
+        double t0 = get_bench_ticks_ms();
+        ensim_scheduler_tick_f32(sched, bench->bus, bench->frames);
+        bench->block_ms[i] = get_bench_ticks_ms() - t0;
+    }
+    qsort(bench->block_ms, bench->blocks, sizeof(*bench->block_ms), compare_bench_ms);
+    size_t index = (size_t)(g_bench_percentile * (bench->blocks - 1));
+    return bench->block_ms[index];
+}
+
+// Devuelve cuántos motores entran en el presupuesto con estos workers.
+static size_t run_bench_workers(bench_t* bench, size_t workers, double budget_ms) {
+    ensim_scheduler_t* sched = ensim_scheduler_create(workers);
+    if (!sched) return 0;
+    size_t fits = 0;
+    for (size_t i = 0; i < g_bench_max_engines; i++) {
+        if (!bench->engine[i]) {
+            bench->engine[i] = create_bench_engine(bench->config[i % bench->configs]);
+            if (!bench->engine[i]) break;
+        }
+        ensim_scheduler_add(sched, bench->engine[i], 1.0f, 1.0f + (float)i);
+        double p95_ms = measure_bench_p95_ms(bench, sched);
+        printf("  workers %2zu  engines %2zu  p95 %7.3f ms  (%5.1f%% del presupuesto)\n",
+               ensim_scheduler_get_workers(sched), i + 1, p95_ms, 100.0 * p95_ms / budget_ms);
+        fflush(stdout);
+        if (p95_ms > budget_ms) break;
+        fits = i + 1;
+    }
+    ensim_scheduler_destroy(sched);
+    return fits;
+}
+
+static void print_bench_usage(const char* name) {
+    fprintf(stderr, "usage: %s [-b blocks] [-w max_workers] [--wave-workers n] [config.json]...\n", name);
+}
+
+int main(int argc, char* argv[]) {
+    static bench_t bench;
+    bench.blocks = 200;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (arg[0] != '-') {
+            if (bench.configs == g_bench_max_configs) {
+                print_bench_usage(argv[0]);
+                return 1;
+            }
+            bench.config[bench.configs++] = arg;
+            continue;
+        }
+        if (!value) {
+            print_bench_usage(argv[0]);
+            return 1;
+        }
+        if (strcmp(arg, "-b") == 0) bench.blocks = strtoul(value, NULL, 10);
+        else if (strcmp(arg, "-w") == 0) bench.max_workers = strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--wave-workers") == 0) bench.wave_workers = strtoul(value, NULL, 10);
+        else {
+            print_bench_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    if (bench.configs == 0) {
+        bench.config[bench.configs++] = "configs/engine_current.json";
+        bench.config[bench.configs++] = "configs/fiat_uno_aspirado.json";
+    }
+    if (bench.blocks == 0) {
+        print_bench_usage(argv[0]);
+        return 1;
+    }
+    ensim_set_wave_workers(bench.wave_workers);
+
+    size_t cores = SDL_GetNumLogicalCPUCores();
+    cores = cores > 0 ? cores : 1;
+    size_t max_workers = bench.max_workers > 0 ? bench.max_workers : cores;
+
+    ensim_context_t* probe = ensim_create(g_bench_monitor_refresh_hz);
+    if (!probe) return 1;
+    bench.frames = ensim_get_frames_per_tick(probe);
+    ensim_destroy(probe);
+    bench.bus = (float*)malloc(bench.frames * sizeof(*bench.bus));
+    bench.block_ms = (double*)malloc(bench.blocks * sizeof(*bench.block_ms));
+    if (!bench.bus || !bench.block_ms) return 1;
+
+    double budget_ms = 1e3 * bench.frames / g_bench_sample_rate_hz;
+    printf("sched-bench: %zu frames por bloque, presupuesto %.3f ms, %zu cores, %zu wave workers\n",
+           bench.frames, budget_ms, cores, bench.wave_workers);
+
+    size_t fits[32] = {};
+    size_t worker_counts[32] = {};
+    size_t runs = 0;
+    for (size_t workers = 1; runs < 32; workers *= 2) {
+        workers = workers < max_workers ? workers : max_workers;
+        worker_counts[runs] = workers;
+        fits[runs++] = run_bench_workers(&bench, workers, budget_ms);
+        if (workers == max_workers) break;
+    }
+
+    printf("\nworkers  motores en tiempo real\n");
+    for (size_t i = 0; i < runs; i++) {
+        printf("%7zu  %zu\n", worker_counts[i], fits[i]);
+    }
+
+    for (size_t i = 0; i < g_bench_max_engines; i++) {
+        ensim_destroy(bench.engine[i]);
+    }
+    free(bench.bus);
+    free(bench.block_ms);
+    return 0;
+}
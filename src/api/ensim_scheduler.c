@@ -0,0 +1,312 @@
+#include "ensim_scheduler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "threads.h"
+
+// Límites
+constexpr size_t g_sched_max_instances = 64;
+constexpr size_t g_sched_max_workers = 64;
+constexpr size_t g_sched_spins = 1 << 14;
+constexpr size_t g_sched_cache_line_bytes = 64;
+constexpr double g_sched_cost_smoothing = 0.125;   // peso del último bloque en el costo
+constexpr double g_sched_reference_distance_m = 1.0;
+
+typedef struct {
+    ensim_context_t* ctx;
+    float gain;
+    float distance_m;
+    double cost_ms;
+    float* buffer;
+    bool is_active;
+} sched_instance_t;
+
+// Cola de un worker: el dueño y los ladrones reclaman con el mismo cursor, así
+// que robar es tomar la próxima instancia que el dueño todavía no empezó.
+// drained es la última generación que el worker terminó de vaciar: mientras
+// no alcance a la actual el worker puede seguir tocando las colas.
+typedef struct {
+    alignas(g_sched_cache_line_bytes) atomic_size_t next;
+    size_t size;
+    double load_ms;
+    size_t task[g_sched_max_instances];
+    alignas(g_sched_cache_line_bytes) atomic_size_t drained;
+} sched_queue_t;
+
+struct ensim_scheduler_t {
+    sched_instance_t instance[g_sched_max_instances];
+    sched_queue_t queue[g_sched_max_workers];
+    size_t workers;
+    size_t frames;
+    size_t capacity;                  // frames de cada buffer de instancia
+    thrd_t thread[g_sched_max_workers];
+    size_t threads;
+    alignas(g_sched_cache_line_bytes) atomic_size_t generation;
+    alignas(g_sched_cache_line_bytes) atomic_size_t done;
+    atomic_size_t parked;
+    atomic_bool is_running;
+    size_t tasks;
+    mtx_t mutex;
+    cnd_t wake;
+};
+
+typedef struct {
+    ensim_scheduler_t* sched;
+    size_t index;
+} sched_worker_arg_t;
+
+static double get_sched_ticks_ms() {
+    return SDL_GetTicksNS() * 1e-6;
+}
+
+static bool is_sched_id_valid(ensim_scheduler_t* sched, int id) {
+    return sched && id >= 0 && (size_t)id < g_sched_max_instances && sched->instance[id].is_active;
+}
+
+static float calc_sched_attenuation(float distance_m) {
+    return distance_m > g_sched_reference_distance_m ? g_sched_reference_distance_m / distance_m : 1.0f;
+}
+
+static void run_sched_task(ensim_scheduler_t* sched, size_t id) {
+    sched_instance_t* in = &sched->instance[id];
+    double t0 = get_sched_ticks_ms();
+    // sin engine (-2) o con argumentos malos (-1) no se escribe nada: silencio,
+    // no lo que haya quedado en el buffer; en pánico (-3) ya se completa con silencio
+    int result = ensim_tick_audio_f32(in->ctx, in->buffer, sched->frames);
+    if (result == -1 || result == -2) memset(in->buffer, 0, sched->frames * sizeof(*in->buffer));
+    double cost_ms = get_sched_ticks_ms() - t0;
+    in->cost_ms += g_sched_cost_smoothing * (cost_ms - in->cost_ms);
+    atomic_fetch_add_explicit(&sched->done, 1, memory_order_release);
+}
+
+static bool claim_sched_task(sched_queue_t* queue, size_t* id) {
+    size_t next = atomic_fetch_add_explicit(&queue->next, 1, memory_order_acquire);
+    if (next >= queue->size) return false;
+    *id = queue->task[next];
+    return true;
+}
+
+// Primero la cola propia; después se roba recorriendo las demás desde la siguiente,
+// así los ladrones no se amontonan todos sobre la misma cola.
+static void drain_sched_queues(ensim_scheduler_t* sched, size_t index) {
+    for (size_t i = 0; i < sched->workers; i++) {
+        sched_queue_t* queue = &sched->queue[(index + i) % sched->workers];
+        size_t id;
+        while (claim_sched_task(queue, &id)) {
+            run_sched_task(sched, id);
+        }
+    }
+}
+
+static void park_sched_worker(ensim_scheduler_t* sched, size_t generation) {
+    for (size_t i = 0; i < g_sched_spins; i++) {
+        if (atomic_load(&sched->generation) != generation || !atomic_load(&sched->is_running)) return;
+        thrd_relax();
+    }
+    mtx_lock(&sched->mutex);
+    atomic_fetch_add(&sched->parked, 1);
+    while (atomic_load(&sched->generation) == generation && atomic_load(&sched->is_running)) {
+        cnd_wait(&sched->wake, &sched->mutex);
+    }
+    atomic_fetch_sub(&sched->parked, 1);
+    mtx_unlock(&sched->mutex);
+}
+
+static int run_sched_worker(void* argument) {
+    sched_worker_arg_t* arg = (sched_worker_arg_t*)argument;
+    ensim_scheduler_t* sched = arg->sched;
+    size_t index = arg->index;
+    free(arg);
+    thrd_pin_current(index);
+    size_t generation = 0;
+    while (atomic_load(&sched->is_running)) {
+        park_sched_worker(sched, generation);
+        generation = atomic_load_explicit(&sched->generation, memory_order_acquire);
+        drain_sched_queues(sched, index);
+        atomic_store_explicit(&sched->queue[index].drained, generation, memory_order_release);
+    }
+    return 0;
+}
+
+// Antes de rearmar las colas: un worker que despertó tarde puede estar todavía
+// reclamando de la generación anterior, y si se le resetea el cursor en la mano
+// pierde tareas o corre una dos veces. La generación no avanza hasta que todos
+// la vaciaron, así que ningún worker se saltea una.
+static void wait_for_sched_workers(ensim_scheduler_t* sched) {
+    size_t generation = atomic_load_explicit(&sched->generation, memory_order_relaxed);
+    for (size_t w = 1; w < sched->workers; w++) {
+        atomic_size_t* drained = &sched->queue[w].drained;
+        for (size_t i = 0; atomic_load_explicit(drained, memory_order_acquire) != generation; i++) {
+            if (i < g_sched_spins) thrd_relax();
+            else thrd_yield();
+        }
+    }
+}
+
+// Reparto por costo (LPT): de la instancia más cara a la más barata, cada una a
+// la cola con menos carga. El robo corrige lo que el costo medido no anticipa.
+static void plan_sched_queues(ensim_scheduler_t* sched) {
+    size_t order[g_sched_max_instances];
+    size_t size = 0;
+    for (size_t i = 0; i < g_sched_max_instances; i++) {
+        if (sched->instance[i].is_active) order[size++] = i;
+    }
+    for (size_t i = 1; i < size; i++) {
+        size_t id = order[i];
+        size_t j = i;
+        for (; j > 0 && sched->instance[order[j - 1]].cost_ms < sched->instance[id].cost_ms; j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = id;
+    }
+    for (size_t w = 0; w < sched->workers; w++) {
+        sched->queue[w].size = 0;
+        sched->queue[w].load_ms = 0.0;
+        atomic_store_explicit(&sched->queue[w].next, 0, memory_order_relaxed);
+    }
+    for (size_t i = 0; i < size; i++) {
+        sched_queue_t* lightest = &sched->queue[0];
+        for (size_t w = 1; w < sched->workers; w++) {
+            if (sched->queue[w].load_ms < lightest->load_ms) lightest = &sched->queue[w];
+        }
+        lightest->task[lightest->size++] = order[i];
+        lightest->load_ms += sched->instance[order[i]].cost_ms;
+    }
+    sched->tasks = size;
+}
+
+static bool reserve_sched_buffers(ensim_scheduler_t* sched, size_t frames) {
+    if (frames <= sched->capacity) return true;
+    for (size_t i = 0; i < g_sched_max_instances; i++) {
+        sched_instance_t* in = &sched->instance[i];
+        if (!in->is_active) continue;
+        float* buffer = (float*)realloc(in->buffer, frames * sizeof(*buffer));
+        if (!buffer) return false;
+        in->buffer = buffer;
+    }
+    sched->capacity = frames;
+    return true;
+}
+
+ensim_scheduler_t* ensim_scheduler_create(size_t workers) {
+    ensim_scheduler_t* sched = (ensim_scheduler_t*)calloc(1, sizeof(ensim_scheduler_t));
+    if (!sched) return NULL;
+    int cores = SDL_GetNumLogicalCPUCores();
+    workers = workers > 0 ? workers : (size_t)(cores > 0 ? cores : 1);
+    sched->workers = workers < g_sched_max_workers ? workers : g_sched_max_workers;
+    atomic_store(&sched->is_running, true);
+    if (mtx_init(&sched->mutex) != thrd_success || cnd_init(&sched->wake) != thrd_success) {
+        free(sched);
+        return NULL;
+    }
+    // el hilo que llama a tick es el worker 0
+    for (size_t i = 1; i < sched->workers; i++) {
+        sched_worker_arg_t* arg = (sched_worker_arg_t*)malloc(sizeof(*arg));
+        if (!arg) break;
+        *arg = (sched_worker_arg_t){ .sched = sched, .index = i };
+        if (thrd_create(&sched->thread[sched->threads], run_sched_worker, arg) != thrd_success) {
+            free(arg);
+            break;
+        }
+        sched->threads++;
+    }
+    sched->workers = sched->threads + 1;
+    return sched;
+}
+
+void ensim_scheduler_destroy(ensim_scheduler_t* sched) {
+    if (!sched) return;
+    mtx_lock(&sched->mutex);
+    atomic_store(&sched->is_running, false);
+    cnd_broadcast(&sched->wake);
+    mtx_unlock(&sched->mutex);
+    for (size_t i = 0; i < sched->threads; i++) {
+        thrd_join(sched->thread[i], NULL);
+    }
+    mtx_destroy(&sched->mutex);
+    cnd_destroy(&sched->wake);
+    for (size_t i = 0; i < g_sched_max_instances; i++) {
+        free(sched->instance[i].buffer);
+    }
+    free(sched);
+}
+
+int ensim_scheduler_add(ensim_scheduler_t* sched, ensim_context_t* ctx, float gain, float distance_m) {
+    if (!sched || !ctx) return -1;
+    for (size_t i = 0; i < g_sched_max_instances; i++) {
+        sched_instance_t* in = &sched->instance[i];
+        if (in->is_active) continue;
+        float* buffer = sched->capacity > 0 ? (float*)malloc(sched->capacity * sizeof(*buffer)) : NULL;
+        if (sched->capacity > 0 && !buffer) return -1;
+        free(in->buffer);
+        *in = (sched_instance_t){
+            .ctx = ctx,
+            .gain = gain,
+            .distance_m = distance_m,
+            .buffer = buffer,
+            .is_active = true,
+        };
+        return (int)i;
+    }
+    return -1;
+}
+
+void ensim_scheduler_remove(ensim_scheduler_t* sched, int id) {
+    if (!is_sched_id_valid(sched, id)) return;
+    sched_instance_t* in = &sched->instance[id];
+    free(in->buffer);
+    *in = (sched_instance_t){};
+}
+
+void ensim_scheduler_set_gain(ensim_scheduler_t* sched, int id, float gain) {
+    if (!is_sched_id_valid(sched, id)) return;
+    sched->instance[id].gain = gain;
+}
+
+void ensim_scheduler_set_distance(ensim_scheduler_t* sched, int id, float distance_m) {
+    if (!is_sched_id_valid(sched, id)) return;
+    sched->instance[id].distance_m = distance_m;
+}
+
+int ensim_scheduler_tick_f32(ensim_scheduler_t* sched, float* out_bus, size_t frames) {
+    if (!sched || !out_bus || frames == 0) return -1;
+    wait_for_sched_workers(sched);
+    if (!reserve_sched_buffers(sched, frames)) return -2;
+    sched->frames = frames;
+    atomic_store_explicit(&sched->done, 0, memory_order_relaxed);
+    plan_sched_queues(sched);
+
+    // despertar a los workers: cambiar de generación publica las colas nuevas
+    atomic_fetch_add_explicit(&sched->generation, 1, memory_order_release);
+    if (atomic_load(&sched->parked) > 0) {
+        mtx_lock(&sched->mutex);
+        cnd_broadcast(&sched->wake);
+        mtx_unlock(&sched->mutex);
+    }
+    drain_sched_queues(sched, 0);
+    for (size_t i = 0; atomic_load_explicit(&sched->done, memory_order_acquire) != sched->tasks; i++) {
+        if (i < g_sched_spins) thrd_relax();
+        else thrd_yield();
+    }
+
+    // mezcla en orden de instancia
+    memset(out_bus, 0, frames * sizeof(*out_bus));
+    for (size_t i = 0; i < g_sched_max_instances; i++) {
+        sched_instance_t* in = &sched->instance[i];
+        if (!in->is_active) continue;
+        float gain = in->gain * calc_sched_attenuation(in->distance_m);
+        for (size_t j = 0; j < frames; j++) {
+            out_bus[j] += gain * in->buffer[j];
+        }
+    }
+    return 0;
+}
+
+size_t ensim_scheduler_get_workers(ensim_scheduler_t* sched) {
+    return sched ? sched->workers : 0;
+}
+
+double ensim_scheduler_get_cost_ms(ensim_scheduler_t* sched, int id) {
+    return is_sched_id_valid(sched, id) ? sched->instance[id].cost_ms : 0.0;
+}
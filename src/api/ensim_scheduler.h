@@ -0,0 +1,44 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "ensim_api.h"
+
+    // Scheduler de varias instancias de motor sobre un pool con work-stealing.
+    //
+    // Cada tick simula un bloque de todas las instancias en paralelo y las mezcla
+    // en un solo bus mono con ganancia por instancia y atenuación por distancia
+    // (1/d, sin atenuar dentro de 1 m). Las instancias se reparten por costo medido
+    // (un V8 con CFD cuesta mucho más que una moto de 1 cilindro) y los hilos que
+    // terminan antes roban instancias de las colas de los demás.
+    //
+    // La mezcla se hace siempre en orden de instancia, así el bus sale idéntico
+    // sin importar qué hilo simuló cada motor.
+    //
+    // Los contextos siguen siendo del que llama: el scheduler no los crea ni los
+    // destruye, y no hay que tocarlos desde otro hilo durante un tick.
+
+    typedef struct ensim_scheduler_t ensim_scheduler_t;
+
+    // lifecycle (workers incluye al hilo que llama a tick; 0 = uno por core)
+    ensim_scheduler_t* ensim_scheduler_create(size_t workers);
+    void ensim_scheduler_destroy(ensim_scheduler_t* sched);
+
+    // instancias: devuelve un id >= 0, o -1 si no hay lugar
+    int  ensim_scheduler_add(ensim_scheduler_t* sched, ensim_context_t* ctx, float gain, float distance_m);
+    void ensim_scheduler_remove(ensim_scheduler_t* sched, int id);
+    void ensim_scheduler_set_gain(ensim_scheduler_t* sched, int id, float gain);
+    void ensim_scheduler_set_distance(ensim_scheduler_t* sched, int id, float distance_m);
+
+    // step: simula un bloque de frames en todas las instancias y escribe la mezcla
+    int ensim_scheduler_tick_f32(ensim_scheduler_t* sched, float* out_bus, size_t frames);
+
+    // telemetry
+    size_t ensim_scheduler_get_workers(ensim_scheduler_t* sched);
+    double ensim_scheduler_get_cost_ms(ensim_scheduler_t* sched, int id); // promedio móvil por bloque
+
+#ifdef __cplusplus
+}
+#endif
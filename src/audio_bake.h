@@ -1,17 +1,365 @@
-#pragma once
-#include <stdint.h>
-#include "engine_s.h"
-
-typedef struct {
-  int sample_rate;
-  int channels;      // 1 o 2
-  float seconds;
-} bake_desc_t;
-
-int bake_wav(engine_s* e,
-             const bake_desc_t* d,
-             const char* out_path,
-             float throttle_start,
-             float throttle_end,
-             float rpm_start,
-             float rpm_end);
\ No newline at end of file
+/*
+ * Headless offline rendering.
+ *
+ * Runs run_engine one block after another as fast as the host allows, with no
+ * window or audio device pacing it, and streams the synth output to a wav file
+ * one chunk at a time, so memory stays fixed however long the render is. Throttle
+ * and crankshaft speed follow an automation of linearly interpolated keys. A key
+ * with negative rpm leaves the crankshaft free; any other rpm puts it on the dyno.
+ *
+ * Every render starts with an unrecorded preroll that brings the engine from rest
+ * to the first key. A free running preroll spends its first half on the starter.
+ *
+ * The file is written next to its destination with a .part suffix and renamed over
+ * it only once complete, so a failed or interrupted render never leaves a partial
+ * file under the final name.
+ */
+
+constexpr size_t g_bake_max_keys = 256;
+constexpr size_t g_bake_chunk_frames = 1 << 15;
+constexpr size_t g_bake_max_channels = 2;
+constexpr double g_bake_default_preroll_s = 2.0;
+constexpr size_t g_bake_wav_header_bytes = 44;
+constexpr size_t g_bake_max_path_size = 4096;
+constexpr char g_bake_part_suffix[] = ".part";
+
+struct bake_key_s
+{
+    double time_s;
+    double throttle;
+    double rpm; // negative leaves the crankshaft free
+};
+
+struct bake_automation_s
+{
+    struct bake_key_s key[g_bake_max_keys];
+    size_t size;
+};
+
+/* Only the engine's own sample rate can be baked, dt is a compile time constant.
+ * Bits picks 16 bit pcm or 32 bit float samples.
+ */
+
+struct bake_desc_s
+{
+    size_t sample_rate_hz;
+    size_t channels;
+    size_t bits;
+    double seconds;
+    double preroll_s;
+};
+
+struct bake_stats_s
+{
+    size_t frames;
+    double elapsed_s;
+    double realtime_factor;
+};
+
+struct wav_writer_s
+{
+    FILE* file;
+    size_t channels;
+    size_t bits;
+    size_t frames;
+    size_t chunk_frames;
+    uint8_t chunk[g_bake_chunk_frames * g_bake_max_channels * sizeof(float)];
+};
+
+static struct sampler_s g_bake_sampler = {};
+static sampler_synth_t g_bake_sampler_synth = {};
+static struct synth_s g_bake_synth = {};
+static struct wav_writer_s g_bake_wav_writer = {};
+
+static double
+get_bake_ticks_ms()
+{
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec * 1e3 + time.tv_nsec * 1e-6;
+}
+
+static void
+put_wav_u16(uint8_t* bytes, uint16_t value)
+{
+    bytes[0] = value;
+    bytes[1] = value >> 8;
+}
+
+static void
+put_wav_u32(uint8_t* bytes, uint32_t value)
+{
+    put_wav_u16(&bytes[0], value);
+    put_wav_u16(&bytes[2], value >> 16);
+}
+
+static size_t
+calc_wav_frame_bytes(struct wav_writer_s* self)
+{
+    return self->channels * self->bits / 8;
+}
+
+static bool
+write_wav_header(struct wav_writer_s* self)
+{
+    uint8_t header[g_bake_wav_header_bytes] = {};
+    size_t data_bytes = self->frames * calc_wav_frame_bytes(self);
+    memcpy(&header[0], "RIFF", 4);
+    put_wav_u32(&header[4], g_bake_wav_header_bytes - 8 + data_bytes);
+    memcpy(&header[8], "WAVEfmt ", 8);
+    put_wav_u32(&header[16], 16);
+    put_wav_u16(&header[20], self->bits == 32 ? 3 : 1);
+    put_wav_u16(&header[22], self->channels);
+    put_wav_u32(&header[24], g_std_audio_sample_rate_hz);
+    put_wav_u32(&header[28], g_std_audio_sample_rate_hz * calc_wav_frame_bytes(self));
+    put_wav_u16(&header[32], calc_wav_frame_bytes(self));
+    put_wav_u16(&header[34], self->bits);
+    memcpy(&header[36], "data", 4);
+    put_wav_u32(&header[40], data_bytes);
+    return fseek(self->file, 0, SEEK_SET) == 0 && fwrite(header, sizeof(header), 1, self->file) == 1;
+}
+
+/* The header is written twice: with no data up front, so the file is valid while
+ * it grows, and with the final sizes once the last chunk is out.
+ */
+
+static bool
+open_wav_writer(struct wav_writer_s* self, const char* path, size_t channels, size_t bits)
+{
+    self->file = fopen(path, "wb");
+    self->channels = channels;
+    self->bits = bits;
+    self->frames = 0;
+    self->chunk_frames = 0;
+    return self->file && write_wav_header(self);
+}
+
+static bool
+flush_wav_writer(struct wav_writer_s* self)
+{
+    size_t size = self->chunk_frames * calc_wav_frame_bytes(self);
+    self->chunk_frames = 0;
+    return size == 0 || fwrite(self->chunk, size, 1, self->file) == 1;
+}
+
+static bool
+push_wav_writer(struct wav_writer_s* self, const float value[], size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        if(self->chunk_frames == g_bake_chunk_frames && flush_wav_writer(self) == false)
+        {
+            return false;
+        }
+        uint8_t* frame = &self->chunk[self->chunk_frames * calc_wav_frame_bytes(self)];
+        for(size_t channel = 0; channel < self->channels; channel++)
+        {
+            if(self->bits == 32)
+            {
+                memcpy(&frame[channel * sizeof(float)], &value[i], sizeof(float));
+            }
+            else
+            {
+                put_wav_u16(&frame[channel * sizeof(int16_t)], (int16_t) lrint(clamp(value[i], -1.0, 1.0) * INT16_MAX));
+            }
+        }
+        self->chunk_frames++;
+        self->frames++;
+    }
+    return true;
+}
+
+static bool
+close_wav_writer(struct wav_writer_s* self)
+{
+    if(self->file == nullptr)
+    {
+        return false;
+    }
+    bool is_success = flush_wav_writer(self) && write_wav_header(self);
+    is_success = fclose(self->file) == 0 && is_success;
+    self->file = nullptr;
+    return is_success;
+}
+
+static bool
+push_bake_key(struct bake_automation_s* self, struct bake_key_s key)
+{
+    if(self->size == g_bake_max_keys || (self->size > 0 && key.time_s < self->key[self->size - 1].time_s))
+    {
+        return false;
+    }
+    self->key[self->size++] = key;
+    return true;
+}
+
+/* Clamped to the first and last keys outside of them.
+ */
+
+static struct bake_key_s
+sample_bake_automation(const struct bake_automation_s* self, double time_s)
+{
+    if(self->size == 0)
+    {
+        return (struct bake_key_s) { .time_s = time_s, .rpm = -1.0 };
+    }
+    size_t i = 0;
+    while(i + 1 < self->size && self->key[i + 1].time_s <= time_s)
+    {
+        i++;
+    }
+    struct bake_key_s a = self->key[i];
+    if(i + 1 == self->size || time_s <= a.time_s)
+    {
+        return a;
+    }
+    struct bake_key_s b = self->key[i + 1];
+    double ratio = (time_s - a.time_s) / (b.time_s - a.time_s);
+    return (struct bake_key_s) {
+        .time_s = time_s,
+        .throttle = a.throttle + ratio * (b.throttle - a.throttle),
+        .rpm = a.rpm < 0.0 || b.rpm < 0.0 ? a.rpm : a.rpm + ratio * (b.rpm - a.rpm),
+    };
+}
+
+static void
+apply_bake_key(struct engine_s* engine, struct bake_key_s key, bool use_starter)
+{
+    engine->throttle_open_ratio = clamp(key.throttle, 0.0, 1.0);
+    engine->dyno.is_on = key.rpm >= 0.0;
+    engine->dyno.target_angular_velocity_r_per_s = key.rpm * 2.0 * g_std_pi_r / 60.0;
+    engine->starter.is_on = use_starter && engine->dyno.is_on == false;
+}
+
+static const char*
+check_bake_desc(const struct bake_desc_s* desc)
+{
+    if(desc->sample_rate_hz != g_std_audio_sample_rate_hz)
+    {
+        return "sample rate must match the engine's";
+    }
+    if(desc->channels < 1 || desc->channels > g_bake_max_channels)
+    {
+        return "channels must be 1 or 2";
+    }
+    if(desc->bits != 16 && desc->bits != 32)
+    {
+        return "bits must be 16 or 32";
+    }
+    if(desc->seconds <= 0.0 || desc->preroll_s < 0.0)
+    {
+        return "seconds must be positive and preroll not negative";
+    }
+    if(desc->seconds * g_std_audio_sample_rate_hz * desc->channels * desc->bits / 8 > UINT32_MAX - g_bake_wav_header_bytes)
+    {
+        return "render does not fit a wav file";
+    }
+    return nullptr;
+}
+
+static bool
+fail_bake(const char* path, const char* message)
+{
+    fprintf(stderr, "error: bake '%s': %s\n", path, message);
+    return false;
+}
+
+static bool
+abort_bake(struct wav_writer_s* writer, const char* part_path, const char* path, const char* message)
+{
+    close_wav_writer(writer);
+    SDL_RemovePath(part_path);
+    return fail_bake(path, message);
+}
+
+static bool
+bake_engine(
+    struct engine_s* engine,
+    const struct bake_desc_s* desc,
+    const struct bake_automation_s* automation,
+    const char* out_path,
+    struct bake_stats_s* stats)
+{
+    const char* error = check_bake_desc(desc);
+    if(error)
+    {
+        return fail_bake(out_path, error);
+    }
+    char part_path[g_bake_max_path_size];
+    if((size_t) snprintf(part_path, sizeof(part_path), "%s%s", out_path, g_bake_part_suffix) >= sizeof(part_path))
+    {
+        return fail_bake(out_path, "path too long");
+    }
+    struct wav_writer_s* writer = &g_bake_wav_writer;
+    if(open_wav_writer(writer, part_path, desc->channels, desc->bits) == false)
+    {
+        return abort_bake(writer, part_path, out_path, "cannot open for writing");
+    }
+    size_t block_size = engine->block_size;
+    size_t preroll_blocks = ceil(desc->preroll_s * g_std_audio_sample_rate_hz / block_size);
+    size_t frames = round(desc->seconds * g_std_audio_sample_rate_hz);
+    size_t blocks = preroll_blocks + (frames + block_size - 1) / block_size;
+    struct engine_time_s engine_time = { .get_ticks_ms = get_bake_ticks_ms };
+    g_bake_synth.volume = engine->volume;
+    double t0 = get_bake_ticks_ms();
+    engine->can_ignite = true;
+    for(size_t block = 0; block < blocks; block++)
+    {
+        double time_s = ((double) block - preroll_blocks) * block_size * g_std_dt_s;
+        apply_bake_key(engine, sample_bake_automation(automation, time_s), 2 * block < preroll_blocks);
+        clear_synth(&g_bake_synth);
+        run_engine(engine, &engine_time, &g_bake_sampler, &g_bake_synth, 0, g_bake_sampler_synth);
+        if(engine->panic_message)
+        {
+            wait_for_engine_waves(engine);
+            return abort_bake(writer, part_path, out_path, engine->panic_message);
+        }
+        if(block >= preroll_blocks)
+        {
+            size_t size = min(g_bake_synth.index, frames - writer->frames);
+            if(push_wav_writer(writer, g_bake_synth.value, size) == false)
+            {
+                wait_for_engine_waves(engine);
+                return abort_bake(writer, part_path, out_path, "write failed");
+            }
+        }
+    }
+    wait_for_engine_waves(engine);
+    *stats = (struct bake_stats_s) {
+        .frames = writer->frames,
+        .elapsed_s = (get_bake_ticks_ms() - t0) * 1e-3,
+    };
+    stats->realtime_factor = stats->frames * g_std_dt_s / stats->elapsed_s;
+    if(close_wav_writer(writer) == false)
+    {
+        SDL_RemovePath(part_path);
+        return fail_bake(out_path, "write failed");
+    }
+    if(SDL_RenamePath(part_path, out_path) == false)
+    {
+        SDL_RemovePath(part_path);
+        return fail_bake(out_path, "cannot move the finished render into place");
+    }
+    return true;
+}
+
+/* A single linear ramp over the whole render.
+ */
+
+static bool
+bake_wav(
+    struct engine_s* engine,
+    const struct bake_desc_s* desc,
+    const char* out_path,
+    double throttle_start,
+    double throttle_end,
+    double rpm_start,
+    double rpm_end,
+    struct bake_stats_s* stats)
+{
+    static struct bake_automation_s automation = {};
+    automation.size = 0;
+    push_bake_key(&automation, (struct bake_key_s) { .time_s = 0.0, .throttle = throttle_start, .rpm = rpm_start });
+    push_bake_key(&automation, (struct bake_key_s) { .time_s = desc->seconds, .throttle = throttle_end, .rpm = rpm_end });
+    return bake_engine(engine, desc, &automation, out_path, stats);
+}
@@ -0,0 +1,404 @@
+/*
+ * Batch render farm.
+ *
+ * Renders every engine config found in the given directories (or files) against
+ * every automation script, one ensim4-bake process per job and as many processes
+ * at a time as there are cores. Processes rather than threads, since ensim4-bake
+ * keeps the engine it renders, its hot reload state and automation (bake_main.c)
+ * and its sampler, synth and wav writer (audio_bake.h) in process globals. Spare
+ * cores are split between the jobs' wave pools.
+ *
+ * Outputs are named <config dir>_<config>[__<automation>].wav under the output
+ * directory. ensim4-bake only moves a render to that name once it is complete, so
+ * an output either is a finished render or does not exist. Each job reports its
+ * wall clock real time factor, seconds rendered over seconds taken including the
+ * preroll and process startup.
+ *
+ *   make ensim4-farm
+ *   ./ensim4-farm -o renders -s 12 -a sweep.json configs configs/otras_referencias -- --pcm16
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include <SDL3/SDL.h>
+
+#include "std.h"
+
+constexpr size_t g_farm_max_jobs = 4096;
+constexpr size_t g_farm_max_configs = 1024;
+constexpr size_t g_farm_max_automations = 64;
+constexpr size_t g_farm_max_bake_args = 64;
+constexpr size_t g_farm_max_path_size = 1024;
+constexpr Uint32 g_farm_poll_ms = 10;
+
+struct farm_job_s
+{
+    const char* config_path;
+    const char* automation_path;
+    char out_path[g_farm_max_path_size];
+    SDL_Process* process;
+    double start_ms;
+    double elapsed_s;
+    int exit_code;
+};
+
+struct farm_s
+{
+    const char* bake_path;
+    const char* out_dir;
+    const char* seconds;
+    const char* bake_arg[g_farm_max_bake_args];
+    size_t bake_args;
+    char* config[g_farm_max_configs];
+    size_t configs;
+    const char* automation[g_farm_max_automations];
+    size_t automations;
+    struct farm_job_s job[g_farm_max_jobs];
+    size_t jobs;
+    size_t parallel_jobs;
+    size_t wave_workers;
+}
+static g_farm = {};
+
+static double
+get_farm_ticks_ms()
+{
+    return SDL_GetTicksNS() * 1e-6;
+}
+
+static void
+print_farm_usage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [-j jobs] [-o out_dir] [-s seconds] [-a automation.json]...\n"
+        "       [--bake path/to/ensim4-bake] <config dir or .json>... [-- bake args]\n",
+        name);
+}
+
+static int
+compare_farm_paths(const void* a, const void* b)
+{
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+static bool
+push_farm_config(struct farm_s* self, const char* path)
+{
+    if(self->configs == g_farm_max_configs)
+    {
+        fprintf(stderr, "error: more than %zu configs\n", g_farm_max_configs);
+        return false;
+    }
+    self->config[self->configs++] = SDL_strdup(path);
+    return true;
+}
+
+/* Directories contribute their own *.json files, sorted so job order and output
+ * names do not depend on the file system.
+ */
+
+static bool
+gather_farm_configs(struct farm_s* self, const char* path)
+{
+    SDL_PathInfo info;
+    if(SDL_GetPathInfo(path, &info) == false)
+    {
+        fprintf(stderr, "error: no such config or directory '%s'\n", path);
+        return false;
+    }
+    if(info.type != SDL_PATHTYPE_DIRECTORY)
+    {
+        return push_farm_config(self, path);
+    }
+    int count = 0;
+    char** names = SDL_GlobDirectory(path, "*.json", 0, &count);
+    if(names == nullptr)
+    {
+        fprintf(stderr, "error: cannot list '%s'\n", path);
+        return false;
+    }
+    qsort(names, count, sizeof(*names), compare_farm_paths);
+    bool is_success = true;
+    for(int i = 0; is_success && i < count; i++)
+    {
+        char full_path[g_farm_max_path_size];
+        snprintf(full_path, sizeof(full_path), "%s/%s", path, names[i]);
+        is_success = push_farm_config(self, full_path);
+    }
+    SDL_free(names);
+    return is_success;
+}
+
+/* The stem of the last path component, or of the one before it when parent is set.
+ */
+
+static void
+copy_farm_stem(char* out, size_t size, const char* path, bool parent)
+{
+    const char* end = path + strlen(path);
+    while(end > path && (end[-1] == '/' || end[-1] == '\\'))
+    {
+        end--;
+    }
+    const char* begin = end;
+    while(begin > path && begin[-1] != '/' && begin[-1] != '\\')
+    {
+        begin--;
+    }
+    if(parent)
+    {
+        end = begin;
+        while(end > path && (end[-1] == '/' || end[-1] == '\\'))
+        {
+            end--;
+        }
+        begin = end;
+        while(begin > path && begin[-1] != '/' && begin[-1] != '\\')
+        {
+            begin--;
+        }
+    }
+    else
+    {
+        for(const char* dot = end; dot > begin; dot--)
+        {
+            if(*dot == '.')
+            {
+                end = dot;
+                break;
+            }
+        }
+    }
+    int length = end - begin;
+    snprintf(out, size, "%.*s", length, length > 0 ? begin : ".");
+}
+
+static bool
+plan_farm_jobs(struct farm_s* self)
+{
+    size_t automations = self->automations > 0 ? self->automations : 1;
+    if(self->configs * automations > g_farm_max_jobs)
+    {
+        fprintf(stderr, "error: more than %zu jobs\n", g_farm_max_jobs);
+        return false;
+    }
+    for(size_t i = 0; i < self->configs; i++)
+    {
+        for(size_t j = 0; j < automations; j++)
+        {
+            struct farm_job_s* job = &self->job[self->jobs++];
+            job->config_path = self->config[i];
+            job->automation_path = self->automations > 0 ? self->automation[j] : nullptr;
+            char dir[256];
+            char stem[256];
+            char automation[256] = "";
+            copy_farm_stem(dir, sizeof(dir), job->config_path, true);
+            copy_farm_stem(stem, sizeof(stem), job->config_path, false);
+            if(job->automation_path)
+            {
+                char automation_stem[240];
+                copy_farm_stem(automation_stem, sizeof(automation_stem), job->automation_path, false);
+                snprintf(automation, sizeof(automation), "__%s", automation_stem);
+            }
+            snprintf(job->out_path, sizeof(job->out_path), "%s/%s_%s%s.wav", self->out_dir, dir, stem, automation);
+        }
+    }
+    return true;
+}
+
+static bool
+launch_farm_job(struct farm_s* self, struct farm_job_s* job)
+{
+    char wave_workers[32];
+    snprintf(wave_workers, sizeof(wave_workers), "%zu", self->wave_workers);
+    const char* args[g_farm_max_bake_args + 16] = {};
+    size_t size = 0;
+    args[size++] = self->bake_path;
+    args[size++] = "-c";
+    args[size++] = job->config_path;
+    args[size++] = "-o";
+    args[size++] = job->out_path;
+    args[size++] = "-s";
+    args[size++] = self->seconds;
+    args[size++] = "--wave-workers";
+    args[size++] = wave_workers;
+    if(job->automation_path)
+    {
+        args[size++] = "-a";
+        args[size++] = job->automation_path;
+    }
+    for(size_t i = 0; i < self->bake_args; i++)
+    {
+        args[size++] = self->bake_arg[i];
+    }
+    job->start_ms = get_farm_ticks_ms();
+    job->process = SDL_CreateProcess(args, false);
+    if(job->process == nullptr)
+    {
+        fprintf(stderr, "error: cannot start '%s': %s\n", self->bake_path, SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+static void
+report_farm_job(struct farm_s* self, struct farm_job_s* job, size_t done)
+{
+    double seconds = atof(self->seconds);
+    if(job->exit_code == 0)
+    {
+        printf("[%zu/%zu] ok     %6.1f s %6.2fx realtime  %s\n", done, self->jobs, job->elapsed_s, seconds / job->elapsed_s, job->out_path);
+    }
+    else
+    {
+        printf("[%zu/%zu] FAILED %6.1f s exit %d  %s\n", done, self->jobs, job->elapsed_s, job->exit_code, job->config_path);
+    }
+    fflush(stdout);
+}
+
+/* Returns the number of failed jobs.
+ */
+
+static size_t
+run_farm(struct farm_s* self)
+{
+    struct farm_job_s* running[g_farm_max_jobs];
+    size_t runs = 0;
+    size_t next = 0;
+    size_t done = 0;
+    size_t failed = 0;
+    while(done < self->jobs)
+    {
+        while(runs < self->parallel_jobs && next < self->jobs)
+        {
+            struct farm_job_s* job = &self->job[next++];
+            if(launch_farm_job(self, job))
+            {
+                running[runs++] = job;
+                continue;
+            }
+            job->exit_code = -1;
+            failed++;
+            report_farm_job(self, job, ++done);
+        }
+        bool has_finished = false;
+        for(size_t i = 0; i < runs; i++)
+        {
+            struct farm_job_s* job = running[i];
+            if(SDL_WaitProcess(job->process, false, &job->exit_code) == false)
+            {
+                continue;
+            }
+            job->elapsed_s = (get_farm_ticks_ms() - job->start_ms) * 1e-3;
+            SDL_DestroyProcess(job->process);
+            job->process = nullptr;
+            failed += job->exit_code != 0;
+            report_farm_job(self, job, ++done);
+            running[i--] = running[--runs];
+            has_finished = true;
+        }
+        if(has_finished == false)
+        {
+            SDL_Delay(g_farm_poll_ms);
+        }
+    }
+    return failed;
+}
+
+int
+main(int argc, char* argv[])
+{
+    struct farm_s* farm = &g_farm;
+    farm->bake_path = "./ensim4-bake";
+    farm->out_dir = "renders";
+    farm->seconds = "10";
+    for(int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if(strcmp(arg, "--") == 0)
+        {
+            for(i++; i < argc && farm->bake_args < g_farm_max_bake_args; i++)
+            {
+                farm->bake_arg[farm->bake_args++] = argv[i];
+            }
+            break;
+        }
+        if(arg[0] != '-')
+        {
+            if(gather_farm_configs(farm, arg) == false)
+            {
+                return 1;
+            }
+            continue;
+        }
+        if(value == nullptr)
+        {
+            print_farm_usage(argv[0]);
+            return 1;
+        }
+        if(strcmp(arg, "-j") == 0)
+        {
+            farm->parallel_jobs = strtoul(value, nullptr, 10);
+        }
+        else if(strcmp(arg, "-o") == 0)
+        {
+            farm->out_dir = value;
+        }
+        else if(strcmp(arg, "-s") == 0 && atof(value) > 0.0)
+        {
+            farm->seconds = value;
+        }
+        else if(strcmp(arg, "-a") == 0)
+        {
+            if(farm->automations == g_farm_max_automations)
+            {
+                fprintf(stderr, "error: more than %zu automations\n", g_farm_max_automations);
+                return 1;
+            }
+            farm->automation[farm->automations++] = value;
+        }
+        else if(strcmp(arg, "--bake") == 0)
+        {
+            farm->bake_path = value;
+        }
+        else
+        {
+            print_farm_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    if(farm->configs == 0)
+    {
+        print_farm_usage(argv[0]);
+        return 1;
+    }
+    size_t cores = max(SDL_GetNumLogicalCPUCores(), 1);
+    farm->parallel_jobs = farm->parallel_jobs > 0 ? farm->parallel_jobs : cores;
+    farm->wave_workers = cores > farm->parallel_jobs ? cores / farm->parallel_jobs - 1 : 0;
+    if(plan_farm_jobs(farm) == false)
+    {
+        return 1;
+    }
+    if(SDL_CreateDirectory(farm->out_dir) == false)
+    {
+        fprintf(stderr, "error: cannot create '%s': %s\n", farm->out_dir, SDL_GetError());
+        return 1;
+    }
+    printf("farm: %zu jobs, %zu at a time, %zu wave workers each\n", farm->jobs, farm->parallel_jobs, farm->wave_workers);
+    double t0 = get_farm_ticks_ms();
+    size_t failed = run_farm(farm);
+    double elapsed_s = (get_farm_ticks_ms() - t0) * 1e-3;
+    size_t rendered = farm->jobs - failed;
+    printf("farm: %zu rendered, %zu failed in %.1f s, %.2fx realtime overall\n", rendered, failed, elapsed_s, rendered * atof(farm->seconds) / elapsed_s);
+    for(size_t i = 0; i < farm->configs; i++)
+    {
+        SDL_free(farm->config[i]);
+    }
+    return failed > 0;
+}
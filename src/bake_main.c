@@ -0,0 +1,349 @@
+/*
+ * Headless offline renderer.
+ *
+ * Loads an engine json, drives it through a throttle and rpm automation with no
+ * window or audio device, and streams the result to a wav file faster than real
+ * time. The automation is either a ramp from the command line or a json file:
+ *
+ *   { "keys": [ { "time_s": 0, "throttle": 0.1, "rpm": 1000 },
+ *               { "time_s": 8, "throttle": 1.0, "rpm": 7000 },
+ *               { "time_s": 9, "throttle": 0.0, "rpm": -1 } ] }
+ *
+ * where rpm -1 lets the crankshaft run free.
+ *
+ *   make ensim4-bake && ./ensim4-bake -c configs/engine_current.json -s 10 -t 0.2:1 -r 1500:7000 -o rev.wav
+ *
+ * Built with -DENSIM4_PROFILE, --trace writes a Chrome trace of every block.
+ * Built with -DENSIM4_PERF_COUNTERS on Linux, the hardware counters of every
+ * phase over the whole render are printed after it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+#include <stdatomic.h>
+
+#include "threads.h"
+#include "std.h"
+#include "simd.h"
+#include "profile_s.h"
+#include "perf_counter_s.h"
+#include "normalized_s.h"
+#include "fft_s.h"
+#include "convo_filter_s.h"
+#include "highpass_filter_s.h"
+#include "lowpass_filter_s.h"
+#include "cp_table.h"
+#include "gamma.h"
+#include "isentropic.h"
+#include "gas_s.h"
+#include "chamber_s.h"
+#include "gas_mail_s.h"
+#include "nozzle_flow_s.h"
+#include "visualize.h"
+#include "crankshaft_s.h"
+#include "sparkplug_s.h"
+#include "flywheel_s.h"
+#include "starter_s.h"
+#include "limiter_s.h"
+#include "dyno_s.h"
+#include "valve_s.h"
+#include "synth_s.h"
+#include "waveguide_tube_s.h"
+#include "waveguide_s.h"
+#include "wave_s.h"
+#include "wave_pool_s.h"
+#include "source_s.h"
+#include "afilter_s.h"
+#include "iplenum_s.h"
+#include "injector_s.h"
+#include "throttle_s.h"
+#include "irunner_s.h"
+#include "piston_s.h"
+#include "erunner_s.h"
+#include "eplenum_s.h"
+#include "exhaust_s.h"
+#include "sink_s.h"
+#include "node_s.h"
+#include "batch_flow_s.h"
+#include "sampler_s.h"
+#include "engine_s.h"
+#include "engine_blueprints.h"
+
+#ifdef ENGINE_2_CYL
+#include "engine_2_cyl.h"
+#elif defined(ENGINE_3_CYL)
+#include "engine_3_cyl.h"
+#elif defined(ENGINE_8_CYL)
+#include "engine_8_cyl.h"
+#endif
+
+#include "cJSON.h"
+#include "audio_bake.h"
+
+struct engine_s g_engine = {
+    .name = g_engine_name,
+    .node = g_engine_node,
+    .size = len(g_engine_node),
+    .crankshaft = {
+        .mass_kg = g_engine_crankshaft_mass_kg,
+        .radius_m = g_engine_crankshaft_radius_m,
+    },
+    .flywheel = {
+        .mass_kg = g_engine_flywheel_mass_kg,
+        .radius_m = g_engine_flywheel_radius_m,
+    },
+    .limiter = {
+        .cutoff_angular_velocity_r_per_s = g_engine_limiter_cutoff_r_per_s,
+        .relaxed_angular_velocity_r_per_s = g_engine_limiter_relaxed_r_per_s,
+    },
+    .starter = {
+        .rated_torque_n_m = e_engine_starter_rated_torque_n_m,
+        .no_load_angular_velocity_r_per_s = g_engine_starter_no_load_r_per_s,
+        .radius_m = g_engine_starter_radius_m,
+    },
+    .volume = g_engine_sound_volume,
+    .no_throttle = g_engine_no_throttle,
+    .low_throttle = g_engine_low_throttle,
+    .mid_throttle = g_engine_mid_throttle,
+    .high_throttle = g_engine_high_throttle,
+    .radial_spacing = g_engine_radial_spacing,
+};
+
+#include "hotreload_engine.h"
+
+static hr_state_t g_hr_state = {};
+
+static struct bake_automation_s g_bake_automation = {};
+
+static void
+print_bake_usage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [-c engine.json] [-o out.wav] [-s seconds] [-p preroll_s]\n"
+        "       [-t throttle[:end]] [-r rpm[:end]] [-a automation.json]\n"
+        "       [--channels 1|2] [--pcm16] [--no-cfd] [--wave-workers n]\n"
+        "       [--trace trace.json]\n",
+        name);
+}
+
+/* "a" or "a:b"; a lone value holds for the whole render.
+ */
+
+static bool
+parse_bake_ramp(const char* text, double* start, double* end)
+{
+    char* rest = nullptr;
+    *start = strtod(text, &rest);
+    if(rest == text)
+    {
+        return false;
+    }
+    *end = *start;
+    if(*rest == ':')
+    {
+        const char* tail = rest + 1;
+        *end = strtod(tail, &rest);
+        if(rest == tail)
+        {
+            return false;
+        }
+    }
+    return *rest == '\0';
+}
+
+static char*
+read_bake_file(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if(file == nullptr)
+    {
+        return nullptr;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* text = size >= 0 ? malloc(size + 1) : nullptr;
+    if(text && fread(text, 1, size, file) != (size_t) size)
+    {
+        free(text);
+        text = nullptr;
+    }
+    if(text)
+    {
+        text[size] = '\0';
+    }
+    fclose(file);
+    return text;
+}
+
+static bool
+load_bake_automation(struct bake_automation_s* self, const char* path)
+{
+    char* text = read_bake_file(path);
+    if(text == nullptr)
+    {
+        fprintf(stderr, "error: cannot read automation '%s'\n", path);
+        return false;
+    }
+    cJSON* root = cJSON_Parse(text);
+    free(text);
+    cJSON* keys = cJSON_IsArray(root) ? root : cJSON_GetObjectItem(root, "keys");
+    bool is_success = cJSON_IsArray(keys) && cJSON_GetArraySize(keys) > 0;
+    self->size = 0;
+    for(int i = 0; is_success && i < cJSON_GetArraySize(keys); i++)
+    {
+        cJSON* item = cJSON_GetArrayItem(keys, i);
+        cJSON* time_s = cJSON_GetObjectItem(item, "time_s");
+        cJSON* throttle = cJSON_GetObjectItem(item, "throttle");
+        cJSON* rpm = cJSON_GetObjectItem(item, "rpm");
+        is_success = cJSON_IsNumber(time_s) && push_bake_key(self, (struct bake_key_s) {
+            .time_s = time_s->valuedouble,
+            .throttle = cJSON_IsNumber(throttle) ? throttle->valuedouble : 0.0,
+            .rpm = cJSON_IsNumber(rpm) ? rpm->valuedouble : -1.0,
+        });
+    }
+    cJSON_Delete(root);
+    if(is_success == false)
+    {
+        fprintf(stderr, "error: automation '%s' needs a keys array of at most %zu keys with increasing time_s\n", path, g_bake_max_keys);
+    }
+    return is_success;
+}
+
+int
+main(int argc, char* argv[])
+{
+    const char* config_path = "configs/engine_current.json";
+    const char* out_path = "bake.wav";
+    const char* automation_path = nullptr;
+    const char* trace_path = nullptr;
+    struct bake_desc_s desc = {
+        .sample_rate_hz = g_std_audio_sample_rate_hz,
+        .channels = 1,
+        .bits = 32,
+        .seconds = 10.0,
+        .preroll_s = g_bake_default_preroll_s,
+    };
+    double throttle_start = 1.0;
+    double throttle_end = 1.0;
+    double rpm_start = -1.0;
+    double rpm_end = -1.0;
+    bool use_cfd = true;
+    for(int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool is_valid = true;
+        if(strcmp(arg, "--pcm16") == 0)
+        {
+            desc.bits = 16;
+            continue;
+        }
+        if(strcmp(arg, "--no-cfd") == 0)
+        {
+            use_cfd = false;
+            continue;
+        }
+        if(value == nullptr)
+        {
+            is_valid = false;
+        }
+        else if(strcmp(arg, "-c") == 0)
+        {
+            config_path = value;
+        }
+        else if(strcmp(arg, "-o") == 0)
+        {
+            out_path = value;
+        }
+        else if(strcmp(arg, "-a") == 0)
+        {
+            automation_path = value;
+        }
+        else if(strcmp(arg, "--trace") == 0)
+        {
+            trace_path = value;
+        }
+        else if(strcmp(arg, "-s") == 0)
+        {
+            desc.seconds = atof(value);
+        }
+        else if(strcmp(arg, "-p") == 0)
+        {
+            desc.preroll_s = atof(value);
+        }
+        else if(strcmp(arg, "--channels") == 0)
+        {
+            desc.channels = strtoul(value, nullptr, 10);
+        }
+        else if(strcmp(arg, "--wave-workers") == 0)
+        {
+            limit_wave_pool(strtoul(value, nullptr, 10));
+        }
+        else if(strcmp(arg, "-t") == 0)
+        {
+            is_valid = parse_bake_ramp(value, &throttle_start, &throttle_end);
+        }
+        else if(strcmp(arg, "-r") == 0)
+        {
+            is_valid = parse_bake_ramp(value, &rpm_start, &rpm_end);
+        }
+        else
+        {
+            is_valid = false;
+        }
+        if(is_valid == false)
+        {
+            print_bake_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    precompute_isentropic(ENSIM4_ISENTROPIC_MAX_ERROR);
+    reset_engine(&g_engine);
+    if(hr_init(&g_hr_state, config_path, &g_engine) == false)
+    {
+        fprintf(stderr, "error: cannot load engine '%s'\n", config_path);
+        return 1;
+    }
+    reset_engine(&g_engine);
+    enable_engine_cfd(&g_engine, use_cfd);
+    if(trace_path)
+    {
+#ifdef ENSIM4_PROFILE
+        if(open_profile_trace(trace_path, g_node_name_string, len(g_node_name_string)) == false)
+        {
+            fprintf(stderr, "error: cannot write trace '%s'\n", trace_path);
+            return 1;
+        }
+#else
+        fprintf(stderr, "warning: built without ENSIM4_PROFILE, no trace written\n");
+#endif
+    }
+    struct bake_stats_s stats = {};
+    bool is_success = automation_path
+        ? load_bake_automation(&g_bake_automation, automation_path) && bake_engine(&g_engine, &desc, &g_bake_automation, out_path, &stats)
+        : bake_wav(&g_engine, &desc, out_path, throttle_start, throttle_end, rpm_start, rpm_end, &stats);
+    stop_wave_pool();
+    stop_convo_worker();
+    PERF_CLOSE();
+#ifdef ENSIM4_PROFILE
+    close_profile_trace();
+#endif
+    if(is_success == false)
+    {
+        return 1;
+    }
+    double rpm = g_engine.crankshaft.angular_velocity_r_per_s * 60.0 / (2.0 * g_std_pi_r);
+    printf("%s: %.2f s of '%s' in %.2f s, %.1fx realtime, ending at %.0f rpm\n", out_path, stats.frames * g_std_dt_s, g_engine.name, stats.elapsed_s, stats.realtime_factor, rpm);
+#ifdef ENSIM4_PERF_EVENTS
+    struct perf_frame_s perf_frame = take_perf_frame();
+    print_perf_frame(stdout, &perf_frame);
+#endif
+    return 0;
+}
@@ -0,0 +1,435 @@
+/* Two phase nozzle flow over dependency waves.
+ *
+ * The sequential solver mails gas the moment an edge is evaluated, so each edge
+ * sees the state left by the edges before it. The batched solver keeps that
+ * order where it matters and drops it where it does not: edges are scheduled
+ * into waves at plan time, an edge going one wave past the last wave that
+ * touched either of its chambers. No two edges of a wave share a chamber, and
+ * edges that do share one keep their authored order across waves.
+ *
+ * Each wave then runs in two phases. Every edge's nozzle flow is evaluated
+ * from the wave's frozen chamber state by a vector kernel, 4 (AVX2) or 8
+ * (AVX-512) edges per register, and only then are the mails applied. Within a
+ * wave a chamber receives at most one mail, so the reduction is the mail
+ * itself, and the result is the sequential one whatever order the wave's
+ * edges are evaluated in, up to the rounding of the vector kernel.
+ */
+
+#define FLOW_MODES    \
+    X(sequential)     \
+    X(batched)
+
+enum flow_mode_e
+{
+#define X(name) g_flow_mode_##name,
+    FLOW_MODES
+#undef X
+    g_flow_mode_e_size
+};
+
+constexpr char g_flow_mode_string[][16] = {
+#define X(name) #name,
+    FLOW_MODES
+#undef X
+};
+
+#undef FLOW_MODES
+
+/* Largest relative difference allowed between the audio of the two modes.
+ */
+
+constexpr double g_batch_flow_max_error = 1e-6;
+
+/* Inputs are gathered from the upstream chamber of each edge (the one with the
+ * higher total pressure), outputs are the flow field of flow() before the sign
+ * of the direction is applied.
+ */
+
+#define BATCH_FLOW_LANE_FIELDS          \
+    X(area_m2)                          \
+    X(gamma)                            \
+    X(specific_gas_constant_j_per_kg_k) \
+    X(total_temperature_k)              \
+    X(total_pressure_pa)                \
+    X(other_static_pressure_pa)         \
+    X(mach)                             \
+    X(velocity_m_per_s)                 \
+    X(mass_flow_rate_kg_per_s)          \
+    X(speed_of_sound_m_per_s)           \
+    X(static_density_kg_per_m3)         \
+    X(static_pressure_pa)
+
+struct batch_flow_lane_s
+{
+#define X(field) double* field;
+    BATCH_FLOW_LANE_FIELDS
+#undef X
+};
+
+struct batch_flow_s
+{
+    size_t chambers;
+    size_t edges;
+    size_t waves;
+    size_t* chamber_wave;
+    size_t* edge_wave;
+    size_t* wave_start;
+    size_t* wave_edge;
+    size_t* edge_channel;
+    bool* is_reversed;
+    double* block;
+    struct batch_flow_lane_s lane;
+    enum simd_level_e simd_level;
+};
+
+static void
+free_batch_flow(struct batch_flow_s* self)
+{
+    free(self->chamber_wave);
+    free(self->edge_wave);
+    free(self->wave_start);
+    free(self->wave_edge);
+    free(self->edge_channel);
+    free(self->is_reversed);
+    free(self->block);
+    *self = (struct batch_flow_s) {};
+}
+
+/* A wave is never wider than the edge count, so the lanes are sized to it.
+ */
+
+static bool
+plan_batch_flow(struct batch_flow_s* self, size_t chambers, size_t edges)
+{
+    free_batch_flow(self);
+    size_t lane_fields = 0;
+#define X(field) lane_fields++;
+    BATCH_FLOW_LANE_FIELDS
+#undef X
+    self->chamber_wave = calloc(chambers + 1, sizeof(*self->chamber_wave));
+    self->edge_wave = calloc(edges + 1, sizeof(*self->edge_wave));
+    self->wave_start = calloc(edges + 2, sizeof(*self->wave_start));
+    self->wave_edge = calloc(edges + 1, sizeof(*self->wave_edge));
+    self->edge_channel = calloc(edges + 1, sizeof(*self->edge_channel));
+    self->is_reversed = calloc(edges + 1, sizeof(*self->is_reversed));
+    self->block = calloc(lane_fields * (edges + 1), sizeof(*self->block));
+    if(self->chamber_wave == nullptr
+    || self->edge_wave == nullptr
+    || self->wave_start == nullptr
+    || self->wave_edge == nullptr
+    || self->edge_channel == nullptr
+    || self->is_reversed == nullptr
+    || self->block == nullptr)
+    {
+        free_batch_flow(self);
+        return false;
+    }
+    self->chambers = chambers;
+    self->edges = edges;
+    self->simd_level = detect_simd_level();
+    double* field = self->block;
+#define X(name) self->lane.name = field; field += edges + 1;
+    BATCH_FLOW_LANE_FIELDS
+#undef X
+    return true;
+}
+
+#undef BATCH_FLOW_LANE_FIELDS
+
+/* Edges must be scheduled in the order the sequential solver steps them.
+ */
+
+static void
+schedule_batch_flow_edge(struct batch_flow_s* self, size_t edge, size_t x, size_t y)
+{
+    size_t wave = max(self->chamber_wave[x], self->chamber_wave[y]);
+    self->edge_wave[edge] = wave;
+    self->chamber_wave[x] = wave + 1;
+    self->chamber_wave[y] = wave + 1;
+    self->waves = max(self->waves, wave + 1);
+}
+
+/* Groups the edges by wave, each wave keeping the authored order.
+ */
+
+static void
+order_batch_flow_waves(struct batch_flow_s* self)
+{
+    size_t size = 0;
+    for(size_t wave = 0; wave < self->waves; wave++)
+    {
+        self->wave_start[wave] = size;
+        for(size_t i = 0; i < self->edges; i++)
+        {
+            if(self->edge_wave[i] == wave)
+            {
+                self->wave_edge[size++] = i;
+            }
+        }
+    }
+    self->wave_start[self->waves] = size;
+}
+
+/* Reads the edge the way flow() does, before any mail of the wave lands.
+ */
+
+static void
+load_batch_flow_lane(struct batch_flow_s* self, size_t lane, struct chamber_s* x, struct chamber_s* y)
+{
+    struct batch_flow_lane_s* l = &self->lane;
+    bool is_reversed = calc_total_pressure_pa(x) < calc_total_pressure_pa(y);
+    struct chamber_s* from = is_reversed ? y : x;
+    struct chamber_s* to = is_reversed ? x : y;
+    self->is_reversed[lane] = is_reversed;
+    l->area_m2[lane] = calc_nozzle_flow_area_m2(x);
+    l->gamma[lane] = calc_chamber_gamma(from);
+    l->specific_gas_constant_j_per_kg_k[lane] = calc_chamber_specific_gas_constant_j_per_kg_k(from);
+    l->total_temperature_k[lane] = calc_total_temperature_k(from);
+    l->total_pressure_pa[lane] = calc_total_pressure_pa(from);
+    l->other_static_pressure_pa[lane] = calc_static_pressure_pa(to);
+}
+
+/* The calc_nozzle_* expressions of chamber_s.h, one edge per lane.
+ */
+
+static void
+flow_batch_lanes_scalar(struct batch_flow_s* self, size_t begin, size_t end)
+{
+    struct batch_flow_lane_s* l = &self->lane;
+    for(size_t i = begin; i < end; i++)
+    {
+        double A = l->area_m2[i];
+        double y = l->gamma[i];
+        double Rs = l->specific_gas_constant_j_per_kg_k[i];
+        double Tt = l->total_temperature_k[i];
+        double Pt = l->total_pressure_pa[i];
+        double M = clamp(lookup_isentropic_mach(y, Pt / l->other_static_pressure_pa[i]), 0.0, 1.0);
+        double u = M * sqrt(y * Rs * Tt / (1.0 + (y - 1.0) / 2.0 * (M * M)));
+        double mdot = A * Pt / sqrt(Tt) * sqrt(y / Rs) * M * lookup_isentropic_mass_flow_factor(y, M);
+        l->mach[i] = M;
+        l->velocity_m_per_s[i] = u;
+        l->mass_flow_rate_kg_per_s[i] = mdot;
+        l->speed_of_sound_m_per_s[i] = u / M;
+        l->static_density_kg_per_m3[i] = mdot / (A * u);
+        l->static_pressure_pa[i] = Pt / lookup_isentropic_total_pressure_ratio(y, M);
+    }
+}
+
+#ifdef ENSIM4_SIMD_X86
+
+/* lookup_isentropic_grid for four gammas already known to be on the grid.
+ */
+
+SIMD_TARGET_AVX2 static __m256d
+lookup_batch_flow_grid_avx2(const double* grid, const struct isentropic_axis_s* axis, __m256d gamma, __m256d x)
+{
+    const struct isentropic_axis_s* g_axis = &g_isentropic.gamma;
+    __m256d gi = _mm256_mul_pd(_mm256_sub_pd(gamma, _mm256_set1_pd(g_axis->lower)), _mm256_set1_pd(g_axis->scale));
+    __m256d xc = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(axis->lower)), _mm256_set1_pd(axis->upper));
+    __m256d xi = _mm256_mul_pd(_mm256_sub_pd(xc, _mm256_set1_pd(axis->lower)), _mm256_set1_pd(axis->scale));
+    __m128i g = _mm_min_epi32(_mm256_cvttpd_epi32(gi), _mm_set1_epi32(g_axis->size - 2));
+    __m128i i = _mm_min_epi32(_mm256_cvttpd_epi32(xi), _mm_set1_epi32(axis->size - 2));
+    __m256d fg = _mm256_sub_pd(gi, _mm256_cvtepi32_pd(g));
+    __m256d fx = _mm256_sub_pd(xi, _mm256_cvtepi32_pd(i));
+    __m128i row = _mm_add_epi32(_mm_mullo_epi32(g, _mm_set1_epi32(axis->size)), i);
+    __m256d a0 = _mm256_i32gather_pd(grid, row, 8);
+    __m256d a1 = _mm256_i32gather_pd(grid + 1, row, 8);
+    __m256d b0 = _mm256_i32gather_pd(grid + axis->size, row, 8);
+    __m256d b1 = _mm256_i32gather_pd(grid + axis->size + 1, row, 8);
+    __m256d v0 = _mm256_add_pd(a0, _mm256_mul_pd(fx, _mm256_sub_pd(a1, a0)));
+    __m256d v1 = _mm256_add_pd(b0, _mm256_mul_pd(fx, _mm256_sub_pd(b1, b0)));
+    return _mm256_add_pd(v0, _mm256_mul_pd(fg, _mm256_sub_pd(v1, v0)));
+}
+
+/* Groups with a gamma off the grid, fuel vapour mostly, take the scalar path.
+ */
+
+SIMD_TARGET_AVX2 static void
+flow_batch_lanes_avx2(struct batch_flow_s* self, size_t begin, size_t end)
+{
+    struct batch_flow_lane_s* l = &self->lane;
+    __m256d zero = _mm256_setzero_pd();
+    __m256d one = _mm256_set1_pd(1.0);
+    __m256d two = _mm256_set1_pd(2.0);
+    __m256d lower = _mm256_set1_pd(g_isentropic.gamma.lower);
+    __m256d upper = _mm256_set1_pd(g_isentropic.gamma.upper);
+    size_t i = begin;
+    for(; i + 4 <= end; i += 4)
+    {
+        __m256d y = _mm256_loadu_pd(&l->gamma[i]);
+        __m256d is_tabled = _mm256_and_pd(_mm256_cmp_pd(y, lower, _CMP_GE_OQ), _mm256_cmp_pd(y, upper, _CMP_LE_OQ));
+        if(_mm256_movemask_pd(is_tabled) != 0xF)
+        {
+            flow_batch_lanes_scalar(self, i, i + 4);
+            continue;
+        }
+        __m256d A = _mm256_loadu_pd(&l->area_m2[i]);
+        __m256d Rs = _mm256_loadu_pd(&l->specific_gas_constant_j_per_kg_k[i]);
+        __m256d Tt = _mm256_loadu_pd(&l->total_temperature_k[i]);
+        __m256d Pt = _mm256_loadu_pd(&l->total_pressure_pa[i]);
+        __m256d r = _mm256_div_pd(Pt, _mm256_loadu_pd(&l->other_static_pressure_pa[i]));
+        __m256d s = _mm256_sqrt_pd(_mm256_max_pd(_mm256_sub_pd(r, one), zero));
+        __m256d M = lookup_batch_flow_grid_avx2(g_isentropic_mach, &g_isentropic.pressure_root, y, s);
+        M = _mm256_min_pd(_mm256_max_pd(M, zero), one);
+        __m256d q = _mm256_add_pd(one, _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(y, one), two), _mm256_mul_pd(M, M)));
+        __m256d u = _mm256_mul_pd(M, _mm256_sqrt_pd(_mm256_div_pd(_mm256_mul_pd(_mm256_mul_pd(y, Rs), Tt), q)));
+        __m256d f = lookup_batch_flow_grid_avx2(g_isentropic_mass_flow_factor, &g_isentropic.mach, y, M);
+        __m256d mdot = _mm256_div_pd(_mm256_mul_pd(A, Pt), _mm256_sqrt_pd(Tt));
+        mdot = _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(mdot, _mm256_sqrt_pd(_mm256_div_pd(y, Rs))), M), f);
+        __m256d p = lookup_batch_flow_grid_avx2(g_isentropic_total_pressure_ratio, &g_isentropic.mach, y, M);
+        _mm256_storeu_pd(&l->mach[i], M);
+        _mm256_storeu_pd(&l->velocity_m_per_s[i], u);
+        _mm256_storeu_pd(&l->mass_flow_rate_kg_per_s[i], mdot);
+        _mm256_storeu_pd(&l->speed_of_sound_m_per_s[i], _mm256_div_pd(u, M));
+        _mm256_storeu_pd(&l->static_density_kg_per_m3[i], _mm256_div_pd(mdot, _mm256_mul_pd(A, u)));
+        _mm256_storeu_pd(&l->static_pressure_pa[i], _mm256_div_pd(Pt, p));
+    }
+    flow_batch_lanes_scalar(self, i, end);
+}
+
+SIMD_TARGET_AVX512 static __m512d
+lookup_batch_flow_grid_avx512(const double* grid, const struct isentropic_axis_s* axis, __m512d gamma, __m512d x)
+{
+    const struct isentropic_axis_s* g_axis = &g_isentropic.gamma;
+    __m512d gi = _mm512_mul_pd(_mm512_sub_pd(gamma, _mm512_set1_pd(g_axis->lower)), _mm512_set1_pd(g_axis->scale));
+    __m512d xc = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(axis->lower)), _mm512_set1_pd(axis->upper));
+    __m512d xi = _mm512_mul_pd(_mm512_sub_pd(xc, _mm512_set1_pd(axis->lower)), _mm512_set1_pd(axis->scale));
+    __m256i g = _mm256_min_epi32(_mm512_cvttpd_epi32(gi), _mm256_set1_epi32(g_axis->size - 2));
+    __m256i i = _mm256_min_epi32(_mm512_cvttpd_epi32(xi), _mm256_set1_epi32(axis->size - 2));
+    __m512d fg = _mm512_sub_pd(gi, _mm512_cvtepi32_pd(g));
+    __m512d fx = _mm512_sub_pd(xi, _mm512_cvtepi32_pd(i));
+    __m256i row = _mm256_add_epi32(_mm256_mullo_epi32(g, _mm256_set1_epi32(axis->size)), i);
+    __m512d a0 = _mm512_i32gather_pd(row, grid, 8);
+    __m512d a1 = _mm512_i32gather_pd(row, grid + 1, 8);
+    __m512d b0 = _mm512_i32gather_pd(row, grid + axis->size, 8);
+    __m512d b1 = _mm512_i32gather_pd(row, grid + axis->size + 1, 8);
+    __m512d v0 = _mm512_add_pd(a0, _mm512_mul_pd(fx, _mm512_sub_pd(a1, a0)));
+    __m512d v1 = _mm512_add_pd(b0, _mm512_mul_pd(fx, _mm512_sub_pd(b1, b0)));
+    return _mm512_add_pd(v0, _mm512_mul_pd(fg, _mm512_sub_pd(v1, v0)));
+}
+
+/* Most waves are narrower than eight edges, so the rest goes through the AVX2 kernel.
+ */
+
+SIMD_TARGET_AVX512 static void
+flow_batch_lanes_avx512(struct batch_flow_s* self, size_t begin, size_t end)
+{
+    struct batch_flow_lane_s* l = &self->lane;
+    __m512d zero = _mm512_setzero_pd();
+    __m512d one = _mm512_set1_pd(1.0);
+    __m512d two = _mm512_set1_pd(2.0);
+    __m512d lower = _mm512_set1_pd(g_isentropic.gamma.lower);
+    __m512d upper = _mm512_set1_pd(g_isentropic.gamma.upper);
+    size_t i = begin;
+    for(; i + 8 <= end; i += 8)
+    {
+        __m512d y = _mm512_loadu_pd(&l->gamma[i]);
+        __mmask8 is_tabled = _mm512_cmp_pd_mask(y, lower, _CMP_GE_OQ) & _mm512_cmp_pd_mask(y, upper, _CMP_LE_OQ);
+        if(is_tabled != 0xFF)
+        {
+            flow_batch_lanes_scalar(self, i, i + 8);
+            continue;
+        }
+        __m512d A = _mm512_loadu_pd(&l->area_m2[i]);
+        __m512d Rs = _mm512_loadu_pd(&l->specific_gas_constant_j_per_kg_k[i]);
+        __m512d Tt = _mm512_loadu_pd(&l->total_temperature_k[i]);
+        __m512d Pt = _mm512_loadu_pd(&l->total_pressure_pa[i]);
+        __m512d r = _mm512_div_pd(Pt, _mm512_loadu_pd(&l->other_static_pressure_pa[i]));
+        __m512d s = _mm512_sqrt_pd(_mm512_max_pd(_mm512_sub_pd(r, one), zero));
+        __m512d M = lookup_batch_flow_grid_avx512(g_isentropic_mach, &g_isentropic.pressure_root, y, s);
+        M = _mm512_min_pd(_mm512_max_pd(M, zero), one);
+        __m512d q = _mm512_add_pd(one, _mm512_mul_pd(_mm512_div_pd(_mm512_sub_pd(y, one), two), _mm512_mul_pd(M, M)));
+        __m512d u = _mm512_mul_pd(M, _mm512_sqrt_pd(_mm512_div_pd(_mm512_mul_pd(_mm512_mul_pd(y, Rs), Tt), q)));
+        __m512d f = lookup_batch_flow_grid_avx512(g_isentropic_mass_flow_factor, &g_isentropic.mach, y, M);
+        __m512d mdot = _mm512_div_pd(_mm512_mul_pd(A, Pt), _mm512_sqrt_pd(Tt));
+        mdot = _mm512_mul_pd(_mm512_mul_pd(_mm512_mul_pd(mdot, _mm512_sqrt_pd(_mm512_div_pd(y, Rs))), M), f);
+        __m512d p = lookup_batch_flow_grid_avx512(g_isentropic_total_pressure_ratio, &g_isentropic.mach, y, M);
+        _mm512_storeu_pd(&l->mach[i], M);
+        _mm512_storeu_pd(&l->velocity_m_per_s[i], u);
+        _mm512_storeu_pd(&l->mass_flow_rate_kg_per_s[i], mdot);
+        _mm512_storeu_pd(&l->speed_of_sound_m_per_s[i], _mm512_div_pd(u, M));
+        _mm512_storeu_pd(&l->static_density_kg_per_m3[i], _mm512_div_pd(mdot, _mm512_mul_pd(A, u)));
+        _mm512_storeu_pd(&l->static_pressure_pa[i], _mm512_div_pd(Pt, p));
+    }
+    flow_batch_lanes_avx2(self, i, end);
+}
+
+#endif
+
+/* The vector kernels read the grids directly, so they wait for the table to be published.
+ */
+
+static void
+flow_batch_lanes(struct batch_flow_s* self, size_t size)
+{
+    enum simd_level_e simd_level = atomic_load_explicit(&g_isentropic.mode, memory_order_acquire) == g_isentropic_mode_table
+        ? self->simd_level
+        : g_simd_level_scalar;
+    switch(simd_level)
+    {
+#ifdef ENSIM4_SIMD_X86
+    case g_simd_level_avx512:
+        flow_batch_lanes_avx512(self, 0, size);
+        break;
+    case g_simd_level_avx2:
+        flow_batch_lanes_avx2(self, 0, size);
+        break;
+#endif
+    default:
+        flow_batch_lanes_scalar(self, 0, size);
+        break;
+    }
+}
+
+/* What flow() returns for the edge loaded into the lane, mail included.
+ */
+
+static struct nozzle_flow_s
+get_batch_nozzle_flow(struct batch_flow_s* self, size_t lane, struct chamber_s* x, struct chamber_s* y)
+{
+    struct batch_flow_lane_s* l = &self->lane;
+    double A = l->area_m2[lane];
+    if(A > 0.0)
+    {
+        double direction = 1.0;
+        if(self->is_reversed[lane])
+        {
+            swap(x, y);
+            direction = -1.0;
+        }
+        double M = l->mach[lane];
+        if(M > 0.0)
+        {
+            double mass_flowed_kg = l->mass_flow_rate_kg_per_s[lane] * g_std_dt_s;
+            return (struct nozzle_flow_s) {
+                .area_m2 = A,
+                .flow_field.mach = direction * M,
+                .flow_field.velocity_m_per_s = direction * l->velocity_m_per_s[lane],
+                .flow_field.mass_flow_rate_kg_per_s = direction * l->mass_flow_rate_kg_per_s[lane],
+                .flow_field.speed_of_sound_m_per_s = l->speed_of_sound_m_per_s[lane],
+                .flow_field.static_density_kg_per_m3 = l->static_density_kg_per_m3[lane],
+                .flow_field.static_pressure_pa = l->static_pressure_pa[lane],
+                .gas_mail = {
+                    .gas = {
+                        .mol_ratio_c8h18 = x->gas.mol_ratio_c8h18,
+                        .mol_ratio_o2 = x->gas.mol_ratio_o2,
+                        .mol_ratio_n2 = x->gas.mol_ratio_n2,
+                        .mol_ratio_ar = x->gas.mol_ratio_ar,
+                        .mol_ratio_co2 = x->gas.mol_ratio_co2,
+                        .mol_ratio_h2o = x->gas.mol_ratio_h2o,
+                        .static_temperature_k = x->gas.static_temperature_k,
+                        .mass_kg = mass_flowed_kg,
+                        .momentum_kg_m_per_s = mass_flowed_kg * l->velocity_m_per_s[lane],
+                    },
+                    .x = x,
+                    .y = y,
+                },
+                .is_success = true,
+            };
+        }
+    }
+    return (struct nozzle_flow_s) {
+        .flow_field.static_density_kg_per_m3 = calc_bulk_static_density_kg_per_m3(x),
+        .flow_field.static_pressure_pa = calc_static_pressure_pa(x),
+    };
+}
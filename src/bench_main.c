@@ -0,0 +1,1218 @@
+/*
+ * Headless benchmark suite.
+ *
+ * Times the hot kernels one by one, then whole engines block by block, and
+ * writes every figure to a json report so two builds can be compared:
+ *
+ *   make ensim4-bench && ./ensim4-bench -o before.json
+ *
+ * The compiled graph, chosen with ENGINE= at build time, runs first and its
+ * running state feeds the kernels, so they see the gases of a live engine.
+ * Every json engine named on the command line follows, a directory standing
+ * for the json files in it; configs/ when none is given. Kernels report the
+ * nanoseconds of one call, or of one audio sample for the wave solver, the
+ * convolution and the synth; engines report the nanoseconds of one audio
+ * sample and how many times faster than real time they ran. Each figure comes
+ * with the mean, variance, and spread over its repetitions or blocks.
+ *
+ * --sweep instead runs generated engines, the compiled engine's cylinder on
+ * build_dynamic_engine_nodes graphs, over a grid of cylinder counts, exhaust
+ * pipe counts, cfd off and on, and core counts, the cores being the engine
+ * thread plus its wave workers. Every point reports its real time factor;
+ * tools/plot_bench_sweep.py draws the scaling curves from the report.
+ *
+ *   ./ensim4-bench --sweep --cylinders 1:16 --pipes 1:4 --cores 1:8 -o sweep.json
+ *
+ * The isentropic tables are built to --isentropic-error, 0 keeping the exact
+ * formulas, and the report records their grid and validated error next to
+ * the timings of both. The block convolution engines are checked against the
+ * direct form over the default impulse, and the batched flow against the
+ * sequential flow over the compiled engine's warmup, audio, rpm and kernel;
+ * the run fails if either strays.
+ *
+ * Built with -DENSIM4_PERF_COUNTERS on Linux, every engine also reports the
+ * hardware counters of its phases.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+#include <stdatomic.h>
+
+#include "threads.h"
+#include "std.h"
+#include "simd.h"
+#include "profile_s.h"
+#include "perf_counter_s.h"
+#include "normalized_s.h"
+#include "fft_s.h"
+#include "convo_filter_s.h"
+#include "highpass_filter_s.h"
+#include "lowpass_filter_s.h"
+#include "cp_table.h"
+#include "gamma.h"
+#include "isentropic.h"
+#include "gas_s.h"
+#include "chamber_s.h"
+#include "gas_mail_s.h"
+#include "nozzle_flow_s.h"
+#include "visualize.h"
+#include "crankshaft_s.h"
+#include "sparkplug_s.h"
+#include "flywheel_s.h"
+#include "starter_s.h"
+#include "limiter_s.h"
+#include "dyno_s.h"
+#include "valve_s.h"
+#include "synth_s.h"
+#include "waveguide_tube_s.h"
+#include "waveguide_s.h"
+#include "wave_s.h"
+#include "wave_pool_s.h"
+#include "source_s.h"
+#include "afilter_s.h"
+#include "iplenum_s.h"
+#include "injector_s.h"
+#include "throttle_s.h"
+#include "irunner_s.h"
+#include "piston_s.h"
+#include "erunner_s.h"
+#include "eplenum_s.h"
+#include "exhaust_s.h"
+#include "sink_s.h"
+#include "node_s.h"
+#include "batch_flow_s.h"
+#include "sampler_s.h"
+#include "engine_s.h"
+#include "engine_blueprints.h"
+
+#ifdef ENGINE_2_CYL
+#include "engine_2_cyl.h"
+#elif defined(ENGINE_3_CYL)
+#include "engine_3_cyl.h"
+#elif defined(ENGINE_8_CYL)
+#include "engine_8_cyl.h"
+#endif
+
+#include "cJSON.h"
+
+struct engine_s g_engine = {
+    .name = g_engine_name,
+    .node = g_engine_node,
+    .size = len(g_engine_node),
+    .crankshaft = {
+        .mass_kg = g_engine_crankshaft_mass_kg,
+        .radius_m = g_engine_crankshaft_radius_m,
+    },
+    .flywheel = {
+        .mass_kg = g_engine_flywheel_mass_kg,
+        .radius_m = g_engine_flywheel_radius_m,
+    },
+    .limiter = {
+        .cutoff_angular_velocity_r_per_s = g_engine_limiter_cutoff_r_per_s,
+        .relaxed_angular_velocity_r_per_s = g_engine_limiter_relaxed_r_per_s,
+    },
+    .starter = {
+        .rated_torque_n_m = e_engine_starter_rated_torque_n_m,
+        .no_load_angular_velocity_r_per_s = g_engine_starter_no_load_r_per_s,
+        .radius_m = g_engine_starter_radius_m,
+    },
+    .volume = g_engine_sound_volume,
+    .no_throttle = g_engine_no_throttle,
+    .low_throttle = g_engine_low_throttle,
+    .mid_throttle = g_engine_mid_throttle,
+    .high_throttle = g_engine_high_throttle,
+    .radial_spacing = g_engine_radial_spacing,
+};
+
+#include "hotreload_engine.h"
+#include "engine_params.h"
+#include "engine_graph.c"
+
+constexpr size_t g_bench_default_repetitions = 15;
+constexpr size_t g_bench_max_repetitions = 1024;
+constexpr size_t g_bench_default_blocks = 600;
+constexpr size_t g_bench_max_blocks = 1 << 16;
+constexpr double g_bench_warmup_s = 2.0;
+constexpr size_t g_bench_sweep_blocks = 60;
+constexpr double g_bench_sweep_warmup_s = 0.5;
+constexpr size_t g_bench_sweep_max_pipes = 4;
+constexpr double g_bench_min_repetition_ns = 1e6;
+constexpr size_t g_bench_max_ops = 1 << 24;
+constexpr size_t g_bench_max_path_size = 4096;
+constexpr double g_bench_pipe_length_m = 1.2;
+constexpr double g_bench_mic_position_ratio = 0.9;
+constexpr double g_bench_cutoff_frequency_hz = 1000.0;
+constexpr char g_bench_default_configs[] = "configs";
+
+/* A steady outflow into the pipe, so every solver sample costs the same.
+ */
+
+constexpr struct wave_prim_s g_bench_wave_signal = {
+    .r = 1.01 * g_gas_ambient_static_density_kg_per_m3,
+    .u = 20.0,
+    .p = 1.02 * g_gas_ambient_static_pressure_pa,
+};
+
+/* Name and what one operation is.
+ */
+
+#define BENCH_KERNELS           \
+    X(flow, call)               \
+    X(mix_in_gas, call)         \
+    X(calc_mixed_gamma, call)   \
+    X(isentropic_exact, call)   \
+    X(isentropic_table, call)   \
+    X(step_solver_wave, sample) \
+    X(filter_convo, sample)     \
+    X(push_synth, sample)       \
+    X(sample_channel, call)
+
+enum bench_kernel_e
+{
+#define X(name, unit) g_bench_kernel_##name,
+    BENCH_KERNELS
+#undef X
+    g_bench_kernel_e_size
+};
+
+constexpr char g_bench_kernel_string[][32] = {
+#define X(name, unit) #name,
+    BENCH_KERNELS
+#undef X
+};
+
+constexpr char g_bench_kernel_unit_string[][16] = {
+#define X(name, unit) #unit,
+    BENCH_KERNELS
+#undef X
+};
+
+#undef BENCH_KERNELS
+
+struct bench_range_s
+{
+    size_t first;
+    size_t last;
+};
+
+/* Zero blocks picks the default of the mode. The ranges and banks only apply
+ * to a sweep.
+ */
+
+struct bench_desc_s
+{
+    size_t repetitions;
+    size_t blocks;
+    double warmup_s;
+    double isentropic_max_error;
+    bool use_cfd;
+    bool is_sweep;
+    struct bench_range_s cylinders;
+    struct bench_range_s pipes;
+    struct bench_range_s cores;
+    size_t banks;
+};
+
+struct bench_stats_s
+{
+    double mean;
+    double variance;
+    double min;
+    double max;
+    size_t size;
+};
+
+struct bench_engine_s
+{
+    const char* name;
+    const char* source;
+    size_t blocks;
+    size_t block_size;
+    struct bench_stats_s ns_per_sample;
+    double realtime_factor;
+    double rpm;
+    const char* panic_message;
+    struct perf_frame_s perf_frame;
+};
+
+static hr_state_t g_hr_state = {};
+static struct sampler_s g_bench_sampler = {};
+static sampler_synth_t g_bench_sampler_synth = {};
+static struct synth_s g_bench_synth = {};
+static struct convo_filter_s g_bench_convo_filter = {};
+static struct wave_solver_s g_bench_wave_solver = {};
+static double g_bench_value[g_bench_max_blocks];
+static volatile double g_bench_sink;
+static struct node_s* g_bench_sweep_node = nullptr;
+
+static double
+get_bench_ticks_ms()
+{
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec * 1e3 + time.tv_nsec * 1e-6;
+}
+
+static double
+calc_bench_ns(uint64_t ticks)
+{
+    return 1e6 * calc_profile_ms(ticks);
+}
+
+/* Variance is the sample variance, over size - 1.
+ */
+
+static struct bench_stats_s
+calc_bench_stats(const double value[], size_t size)
+{
+    struct bench_stats_s stats = { .min = DBL_MAX, .max = -DBL_MAX, .size = size };
+    for(size_t i = 0; i < size; i++)
+    {
+        stats.mean += value[i];
+        stats.min = min(stats.min, value[i]);
+        stats.max = max(stats.max, value[i]);
+    }
+    stats.mean /= size;
+    for(size_t i = 0; i < size; i++)
+    {
+        double delta = value[i] - stats.mean;
+        stats.variance += delta * delta;
+    }
+    stats.variance = size > 1 ? stats.variance / (size - 1) : 0.0;
+    return stats;
+}
+
+/* A pipe of its own, set up as batch_wave would for the steady signal.
+ */
+
+static bool
+plan_bench_wave_solver(struct wave_solver_s* self)
+{
+    self->pipe_length_m = g_bench_pipe_length_m;
+    self->mic_position_ratio = g_bench_mic_position_ratio;
+    self->simd_level = detect_simd_level();
+    if(plan_solver_wave(self, calc_wave_cell_count(g_bench_pipe_length_m)) == false)
+    {
+        return false;
+    }
+    struct wave_prim_s signal = g_bench_wave_signal;
+    double u_filter_alpha = calc_lowpass_alpha(g_bench_cutoff_frequency_hz, g_std_dt_s);
+    self->substeps = calc_solver_wave_substeps(self, &signal, 1);
+    self->gradient_s_per_m = g_std_dt_s / self->substeps / (g_bench_pipe_length_m / self->cells);
+    self->u_filter_alpha = 1.0 - pow(1.0 - u_filter_alpha, (double) g_wave_reference_substeps / self->substeps);
+    return true;
+}
+
+/* The first edge out of a piston, which samples every channel.
+ */
+
+static struct edge_s*
+get_bench_piston_edge(struct engine_s* engine)
+{
+    for(size_t i = 0; i < engine->edges; i++)
+    {
+        if(engine->edge[i].x->type == g_is_piston)
+        {
+            return &engine->edge[i];
+        }
+    }
+    return &engine->edge[0];
+}
+
+/* Uncached, as the chambers are after taking their mail, so every call pays
+ * for its own pressures.
+ */
+
+static double
+bench_flow(struct engine_s* engine, size_t ops)
+{
+    double sum = 0.0;
+    for(size_t i = 0, j = 0; i < ops; i++)
+    {
+        struct edge_s* edge = &engine->edge[j];
+        invalidate_chamber_cache(&edge->x->as.chamber);
+        invalidate_chamber_cache(&edge->y->as.chamber);
+        struct nozzle_flow_s nozzle_flow = flow(&edge->x->as.chamber, &edge->y->as.chamber);
+        sum += nozzle_flow.flow_field.mass_flow_rate_kg_per_s;
+        j = j + 1 < engine->edges ? j + 1 : 0;
+    }
+    return sum;
+}
+
+/* A trickle of upstream gas into a copy of the downstream chamber, small
+ * enough that the copy barely moves however many calls it takes.
+ */
+
+static double
+bench_mix_in_gas(struct engine_s* engine, size_t ops)
+{
+    struct edge_s* edge = get_bench_piston_edge(engine);
+    struct chamber_s chamber = edge->y->as.chamber;
+    struct gas_s mail = edge->x->as.chamber.gas;
+    mail.mass_kg = 1e-12 * chamber.gas.mass_kg;
+    mail.momentum_kg_m_per_s = 0.0;
+    for(size_t i = 0; i < ops; i++)
+    {
+        mix_in_gas(&chamber, &mail, edge->y_momentum_damping_ratio);
+    }
+    return chamber.gas.static_temperature_k;
+}
+
+static double
+bench_calc_mixed_gamma(struct engine_s* engine, size_t ops)
+{
+    double sum = 0.0;
+    for(size_t i = 0, j = 0; i < ops; i++)
+    {
+        sum += calc_mixed_gamma(&engine->edge[j].x->as.chamber.gas);
+        j = j + 1 < engine->edges ? j + 1 : 0;
+    }
+    return sum;
+}
+
+/* The three relations of one nozzle evaluation, at the gammas of the engine's
+ * chambers over a sweep of mach numbers and pressure ratios. Off grid gammas
+ * fall back to the exact formulas in the table kernel, as they do in flow().
+ */
+
+static double
+bench_isentropic(struct engine_s* engine, size_t ops, bool is_table)
+{
+    double sum = 0.0;
+    for(size_t i = 0, j = 0; i < ops; i++)
+    {
+        double y = calc_chamber_gamma(&engine->edge[j].x->as.chamber);
+        double M = (i % 64) / 64.0;
+        double r = 1.0 + 0.9 * M;
+        sum += is_table
+            ? lookup_isentropic_total_pressure_ratio(y, M) + lookup_isentropic_mass_flow_factor(y, M) + lookup_isentropic_mach(y, r)
+            : calc_isentropic_total_pressure_ratio(y, M) + calc_isentropic_mass_flow_factor(y, M) + calc_isentropic_mach(y, r);
+        j = j + 1 < engine->edges ? j + 1 : 0;
+    }
+    return sum;
+}
+
+static double
+bench_step_solver_wave(struct wave_solver_s* solver, size_t ops)
+{
+    double sum = 0.0;
+    for(size_t i = 0; i < ops; i++)
+    {
+        step_solver_wave(solver, g_bench_wave_signal);
+        sum += sample_solver_wave(solver);
+    }
+    return sum;
+}
+
+/* Direct form over the engine's own impulse, the compiled one when it has none.
+ */
+
+static double
+bench_filter_convo(struct convo_filter_s* filter, struct engine_s* engine, size_t ops)
+{
+    const double* impulse = engine->impulse ? engine->impulse : g_convo_filter_impulse;
+    size_t impulse_size = engine->impulse ? engine->impulse_size : g_convo_filter_impulse_size;
+    size_t size = min(impulse_size, g_convo_filter_max_size);
+    double sum = 0.0;
+    for(size_t i = 0; i < ops; i++)
+    {
+        sum += filter_convo(filter, impulse, size, i % 2 ? 1.0 : -1.0);
+    }
+    return sum;
+}
+
+static double
+bench_push_synth(struct synth_s* synth, struct engine_s* engine, size_t ops)
+{
+    double sum = 0.0;
+    for(size_t i = 0; i < ops; i++)
+    {
+        if(synth->index == synth->size)
+        {
+            synth->index = 0;
+        }
+        double value = g_gas_ambient_static_pressure_pa * (i % 2 ? 1.1 : 0.9);
+        sum += push_synth(synth, &engine->crankshaft, value, engine->volume);
+    }
+    return sum;
+}
+
+static double
+bench_sample_channel(struct sampler_s* sampler, struct engine_s* engine, size_t ops)
+{
+    struct edge_s* edge = get_bench_piston_edge(engine);
+    struct nozzle_flow_s nozzle_flow = flow(&edge->x->as.chamber, &edge->y->as.chamber);
+    for(size_t i = 0; i < ops; i++)
+    {
+        sample_channel(sampler, edge->x, &nozzle_flow, &engine->crankshaft);
+        reset_sampler_channel(sampler);
+    }
+    return sampler->channel[0][g_sample_gamma][sampler->index];
+}
+
+static double
+run_bench_kernel(enum bench_kernel_e kernel, struct engine_s* engine, size_t ops)
+{
+    switch(kernel)
+    {
+    case g_bench_kernel_flow:
+        return bench_flow(engine, ops);
+    case g_bench_kernel_mix_in_gas:
+        return bench_mix_in_gas(engine, ops);
+    case g_bench_kernel_calc_mixed_gamma:
+        return bench_calc_mixed_gamma(engine, ops);
+    case g_bench_kernel_isentropic_exact:
+        return bench_isentropic(engine, ops, false);
+    case g_bench_kernel_isentropic_table:
+        return bench_isentropic(engine, ops, true);
+    case g_bench_kernel_step_solver_wave:
+        return bench_step_solver_wave(&g_bench_wave_solver, ops);
+    case g_bench_kernel_filter_convo:
+        return bench_filter_convo(&g_bench_convo_filter, engine, ops);
+    case g_bench_kernel_push_synth:
+        return bench_push_synth(&g_bench_synth, engine, ops);
+    case g_bench_kernel_sample_channel:
+        return bench_sample_channel(&g_bench_sampler, engine, ops);
+    case g_bench_kernel_e_size:
+        break;
+    }
+    return 0.0;
+}
+
+static double
+time_bench_kernel_ns(enum bench_kernel_e kernel, struct engine_s* engine, size_t ops)
+{
+    uint64_t t0 = read_profile_ticks();
+    g_bench_sink += run_bench_kernel(kernel, engine, ops);
+    return calc_bench_ns(read_profile_ticks() - t0);
+}
+
+/* Doubles the operations until one repetition is long enough to time well,
+ * then times every repetition at that count.
+ */
+
+static struct bench_stats_s
+time_bench_kernel(enum bench_kernel_e kernel, struct engine_s* engine, size_t repetitions, size_t* ops)
+{
+    *ops = 1;
+    while(time_bench_kernel_ns(kernel, engine, *ops) < g_bench_min_repetition_ns && *ops < g_bench_max_ops)
+    {
+        *ops *= 2;
+    }
+    for(size_t i = 0; i < repetitions; i++)
+    {
+        g_bench_value[i] = time_bench_kernel_ns(kernel, engine, *ops) / *ops;
+    }
+    return calc_bench_stats(g_bench_value, repetitions);
+}
+
+/* Every engine starts from rest, whatever the one before it left on the
+ * crankshaft.
+ */
+
+static void
+reset_bench_engine(struct engine_s* engine, struct bench_desc_s* desc)
+{
+    engine->crankshaft.theta_r = 0.0;
+    engine->crankshaft.angular_velocity_r_per_s = 0.0;
+    reset_engine(engine);
+    enable_engine_cfd(engine, desc->use_cfd);
+}
+
+static void
+run_bench_block(struct engine_s* engine, struct engine_time_s* engine_time)
+{
+    clear_synth(&g_bench_synth);
+    run_engine(engine, engine_time, &g_bench_sampler, &g_bench_synth, 0, g_bench_sampler_synth);
+}
+
+/* The starter runs through the first half of the warmup, as in a bake preroll,
+ * then every block is timed at full throttle.
+ */
+
+static struct bench_engine_s
+run_bench_engine(struct engine_s* engine, const char* source, struct bench_desc_s* desc)
+{
+    struct engine_time_s engine_time = { .get_ticks_ms = get_bench_ticks_ms };
+    size_t warmup_blocks = ceil(desc->warmup_s * g_std_audio_sample_rate_hz / engine->block_size);
+    g_bench_synth.volume = engine->volume;
+    engine->can_ignite = true;
+    engine->throttle_open_ratio = 1.0;
+    for(size_t block = 0; block < warmup_blocks; block++)
+    {
+        engine->starter.is_on = 2 * block < warmup_blocks;
+        run_bench_block(engine, &engine_time);
+    }
+    engine->starter.is_on = false;
+    take_perf_frame();
+    uint64_t ticks = 0;
+    for(size_t block = 0; block < desc->blocks; block++)
+    {
+        uint64_t t0 = read_profile_ticks();
+        run_bench_block(engine, &engine_time);
+        uint64_t t1 = read_profile_ticks();
+        ticks += t1 - t0;
+        g_bench_value[block] = calc_bench_ns(t1 - t0) / engine->block_size;
+    }
+    return (struct bench_engine_s) {
+        .name = engine->name,
+        .source = source,
+        .blocks = desc->blocks,
+        .block_size = engine->block_size,
+        .ns_per_sample = calc_bench_stats(g_bench_value, desc->blocks),
+        .realtime_factor = desc->blocks * engine->block_size * g_std_dt_s / (1e-3 * calc_profile_ms(ticks)),
+        .rpm = engine->crankshaft.angular_velocity_r_per_s * 60.0 / (2.0 * g_std_pi_r),
+        .panic_message = engine->panic_message,
+        .perf_frame = take_perf_frame(),
+    };
+}
+
+static cJSON*
+create_bench_stats_json(struct bench_stats_s* self)
+{
+    cJSON* item = cJSON_CreateObject();
+    cJSON_AddNumberToObject(item, "mean", self->mean);
+    cJSON_AddNumberToObject(item, "variance", self->variance);
+    cJSON_AddNumberToObject(item, "stddev", sqrt(self->variance));
+    cJSON_AddNumberToObject(item, "min", self->min);
+    cJSON_AddNumberToObject(item, "max", self->max);
+    cJSON_AddNumberToObject(item, "size", self->size);
+    return item;
+}
+
+#ifdef ENSIM4_PERF_EVENTS
+
+static cJSON*
+create_bench_perf_json(struct perf_frame_s* self)
+{
+    cJSON* item = cJSON_CreateObject();
+    for(size_t phase = 0; phase < g_perf_phase_e_size; phase++)
+    {
+        struct perf_count_s* count = &self->phase[phase];
+        cJSON* counters = cJSON_AddObjectToObject(item, g_perf_phase_string[phase]);
+        for(size_t i = 0; i < g_perf_counter_e_size; i++)
+        {
+            cJSON_AddNumberToObject(counters, g_perf_counter_string[i], count->value[i]);
+        }
+        cJSON_AddNumberToObject(counters, "ipc", calc_perf_ipc(count));
+    }
+    return item;
+}
+
+#endif
+
+static void
+push_bench_kernel(cJSON* kernels, enum bench_kernel_e kernel, size_t ops, struct bench_stats_s* stats)
+{
+    cJSON* item = cJSON_CreateObject();
+    cJSON_AddStringToObject(item, "name", g_bench_kernel_string[kernel]);
+    cJSON_AddStringToObject(item, "unit", g_bench_kernel_unit_string[kernel]);
+    cJSON_AddNumberToObject(item, "ops_per_repetition", ops);
+    cJSON_AddItemToObject(item, "ns_per_op", create_bench_stats_json(stats));
+    cJSON_AddItemToArray(kernels, item);
+    printf("kernel %-18s %10.2f ns/%s +- %.2f\n", g_bench_kernel_string[kernel], stats->mean, g_bench_kernel_unit_string[kernel], sqrt(stats->variance));
+}
+
+static cJSON*
+create_bench_engine_json(struct bench_engine_s* self)
+{
+    cJSON* item = cJSON_CreateObject();
+    cJSON_AddStringToObject(item, "name", self->name);
+    cJSON_AddStringToObject(item, "source", self->source);
+    cJSON_AddNumberToObject(item, "blocks", self->blocks);
+    cJSON_AddNumberToObject(item, "block_size", self->block_size);
+    cJSON_AddItemToObject(item, "ns_per_sample", create_bench_stats_json(&self->ns_per_sample));
+    cJSON_AddNumberToObject(item, "realtime_factor", self->realtime_factor);
+    cJSON_AddNumberToObject(item, "rpm", self->rpm);
+    if(self->panic_message)
+    {
+        cJSON_AddStringToObject(item, "panic", self->panic_message);
+    }
+#ifdef ENSIM4_PERF_EVENTS
+    cJSON_AddItemToObject(item, "counters", create_bench_perf_json(&self->perf_frame));
+#endif
+    return item;
+}
+
+static void
+push_bench_engine(cJSON* engines, struct bench_engine_s* self)
+{
+    cJSON_AddItemToArray(engines, create_bench_engine_json(self));
+    printf("engine '%s' (%s): %.1f ns/sample +- %.1f, %.1fx realtime, %.0f rpm%s%s\n",
+        self->name, self->source, self->ns_per_sample.mean, sqrt(self->ns_per_sample.variance), self->realtime_factor, self->rpm,
+        self->panic_message ? ", panic: " : "", self->panic_message ? self->panic_message : "");
+}
+
+/* False if a block convolution engine strays from the direct form.
+ */
+
+static bool
+push_bench_convolution(cJSON* build)
+{
+    bool is_valid = true;
+    cJSON* item = cJSON_AddObjectToObject(build, "convolution");
+    cJSON_AddNumberToObject(item, "block_size", g_synth_buffer_size);
+    cJSON_AddNumberToObject(item, "partition_size", g_convo_filter_partition_size);
+    cJSON_AddNumberToObject(item, "max_error", g_convo_filter_max_error);
+    cJSON* error = cJSON_AddObjectToObject(item, "error");
+    for(size_t mode = 0; mode < g_convo_filter_mode_e_size; mode++)
+    {
+        if(mode == g_convo_filter_mode_direct)
+        {
+            continue;
+        }
+        double value = validate_convo_filter(mode, g_convo_filter_impulse, g_convo_filter_impulse_size, g_synth_buffer_size);
+        cJSON_AddNumberToObject(error, g_convo_filter_mode_string[mode], value);
+        if(value < 0.0 || value > g_convo_filter_max_error)
+        {
+            fprintf(stderr, "error: %s convolution strays from the direct form by %g\n", g_convo_filter_mode_string[mode], value);
+            is_valid = false;
+        }
+    }
+    return is_valid;
+}
+
+/* Largest difference between the batched kernel and flow() over every edge of
+ * the engine as it stands, relative to flow()'s own field. Nothing is mailed,
+ * so both read the same chambers.
+ */
+
+static double
+calc_bench_flow_lane_error(struct engine_s* engine)
+{
+    struct batch_flow_s* batch_flow = &engine->batch_flow;
+    enum simd_level_e simd_level = batch_flow->simd_level;
+    batch_flow->simd_level = detect_simd_level();
+    double error = 0.0;
+    for(size_t wave = 0; wave < batch_flow->waves; wave++)
+    {
+        size_t begin = batch_flow->wave_start[wave];
+        size_t end = batch_flow->wave_start[wave + 1];
+        for(size_t i = begin; i < end; i++)
+        {
+            struct edge_s* edge = &engine->edge[batch_flow->wave_edge[i]];
+            load_batch_flow_lane(batch_flow, i - begin, &edge->x->as.chamber, &edge->y->as.chamber);
+        }
+        flow_batch_lanes(batch_flow, end - begin);
+        for(size_t i = begin; i < end; i++)
+        {
+            struct edge_s* edge = &engine->edge[batch_flow->wave_edge[i]];
+            struct nozzle_flow_s sequential = flow(&edge->x->as.chamber, &edge->y->as.chamber);
+            struct nozzle_flow_s batched = get_batch_nozzle_flow(batch_flow, i - begin, &edge->x->as.chamber, &edge->y->as.chamber);
+            double a[] = {
+                sequential.flow_field.mach,
+                sequential.flow_field.velocity_m_per_s,
+                sequential.flow_field.mass_flow_rate_kg_per_s,
+                sequential.flow_field.speed_of_sound_m_per_s,
+                sequential.flow_field.static_density_kg_per_m3,
+                sequential.flow_field.static_pressure_pa,
+            };
+            double b[] = {
+                batched.flow_field.mach,
+                batched.flow_field.velocity_m_per_s,
+                batched.flow_field.mass_flow_rate_kg_per_s,
+                batched.flow_field.speed_of_sound_m_per_s,
+                batched.flow_field.static_density_kg_per_m3,
+                batched.flow_field.static_pressure_pa,
+            };
+            for(size_t j = 0; j < len(a); j++)
+            {
+                double diff = fabs(b[j] - a[j]);
+                error = max(error, a[j] != 0.0 ? diff / fabs(a[j]) : diff);
+            }
+        }
+    }
+    batch_flow->simd_level = simd_level;
+    return error;
+}
+
+/* Runs the compiled engine from the given nodes through a warmup, starter
+ * first, and keeps its audio. Everything a run leaves behind, the nozzle open
+ * ratios, the limiter, and the synth filters, starts over. Batched runs step
+ * scalar lanes. A sequential run also measures the batched kernel, at the
+ * level the machine has, against flow() after every block.
+ */
+
+static size_t
+record_bench_flow_mode(enum flow_mode_e flow_mode, struct bench_desc_s* desc, const struct node_s* node, float* out, size_t size, double* lane_error)
+{
+    struct engine_time_s engine_time = { .get_ticks_ms = get_bench_ticks_ms };
+    wait_for_engine_waves(&g_engine);
+    memcpy(g_engine.node, node, g_engine.size * sizeof(*g_engine.node));
+    g_engine.limiter.is_limiting = false;
+    reset_bench_engine(&g_engine, desc);
+    reset_synth(&g_bench_synth);
+    g_engine.flow_mode = flow_mode;
+    g_engine.batch_flow.simd_level = g_simd_level_scalar;
+    g_engine.can_ignite = true;
+    g_engine.throttle_open_ratio = 1.0;
+    g_bench_synth.volume = g_engine.volume;
+    size_t blocks = ceil(desc->warmup_s * g_std_audio_sample_rate_hz / g_engine.block_size);
+    size_t samples = 0;
+    for(size_t block = 0; block < blocks; block++)
+    {
+        g_engine.starter.is_on = 2 * block < blocks;
+        run_bench_block(&g_engine, &engine_time);
+        for(size_t i = 0; i < g_bench_synth.index && samples < size; i++)
+        {
+            out[samples++] = g_bench_synth.value[i];
+        }
+        if(flow_mode == g_flow_mode_sequential)
+        {
+            *lane_error = max(*lane_error, calc_bench_flow_lane_error(&g_engine));
+        }
+    }
+    return samples;
+}
+
+/* False if either half of the batched mode strays. The schedule: a batched
+ * run on scalar lanes must play the sequential run's audio and reach its rpm,
+ * both to g_batch_flow_max_error. The vector kernel: it must match flow() on
+ * the sequential run's chambers to the same bound. The kernel is held apart
+ * because it rounds unlike the scalar code under -ffast-math, and a free
+ * running engine would grow that last bit into drift of its own.
+ */
+
+static bool
+push_bench_flow_modes(cJSON* build, struct bench_desc_s* desc)
+{
+    size_t size = ceil(desc->warmup_s * g_std_audio_sample_rate_hz) + g_synth_buffer_max_size;
+    float* sequential = calloc(size, sizeof(*sequential));
+    float* batched = calloc(size, sizeof(*batched));
+    struct node_s* node = malloc(g_engine.size * sizeof(*node));
+    if(sequential == nullptr || batched == nullptr || node == nullptr)
+    {
+        free(sequential);
+        free(batched);
+        free(node);
+        fprintf(stderr, "error: out of memory\n");
+        return false;
+    }
+    memcpy(node, g_engine.node, g_engine.size * sizeof(*node));
+    double error = 0.0;
+    size_t samples = record_bench_flow_mode(g_flow_mode_sequential, desc, node, sequential, size, &error);
+    double sequential_rpm = g_engine.crankshaft.angular_velocity_r_per_s * 60.0 / (2.0 * g_std_pi_r);
+    size_t batched_samples = record_bench_flow_mode(g_flow_mode_batched, desc, node, batched, size, &error);
+    double batched_rpm = g_engine.crankshaft.angular_velocity_r_per_s * 60.0 / (2.0 * g_std_pi_r);
+    double peak = 0.0;
+    double audio_error = 0.0;
+    for(size_t i = 0; i < samples && i < batched_samples; i++)
+    {
+        peak = max(peak, fabs(sequential[i]));
+        audio_error = max(audio_error, fabs(batched[i] - sequential[i]));
+    }
+    audio_error = peak > 0.0 ? audio_error / peak : audio_error;
+    double rpm_error = fabs(batched_rpm - sequential_rpm) / max(fabs(sequential_rpm), 1.0);
+    bool is_valid = samples == batched_samples
+        && error <= g_batch_flow_max_error
+        && audio_error <= g_batch_flow_max_error
+        && rpm_error <= g_batch_flow_max_error;
+    cJSON* item = cJSON_AddObjectToObject(build, "flow_modes");
+    cJSON_AddNumberToObject(item, "samples", samples);
+    cJSON_AddNumberToObject(item, "max_error", g_batch_flow_max_error);
+    cJSON_AddNumberToObject(item, "error", error);
+    cJSON_AddNumberToObject(item, "audio_error", audio_error);
+    cJSON_AddNumberToObject(item, "sequential_rpm", sequential_rpm);
+    cJSON_AddNumberToObject(item, "batched_rpm", batched_rpm);
+    cJSON_AddNumberToObject(item, "rpm_error", rpm_error);
+    if(is_valid == false)
+    {
+        fprintf(stderr, "error: batched flow strays from sequential flow by %g in the kernel, %g in the audio, %g in rpm\n", error, audio_error, rpm_error);
+    }
+    memcpy(g_engine.node, node, g_engine.size * sizeof(*node));
+    free(sequential);
+    free(batched);
+    free(node);
+    return is_valid;
+}
+
+static bool
+push_bench_build(cJSON* report, struct bench_desc_s* desc)
+{
+    cJSON* item = cJSON_AddObjectToObject(report, "build");
+    cJSON_AddStringToObject(item, "compiler", __VERSION__);
+    cJSON_AddStringToObject(item, "compiled_engine", g_engine_name);
+    cJSON_AddStringToObject(item, "simd", g_simd_level_string[detect_simd_level()]);
+    cJSON_AddNumberToObject(item, "sample_rate_hz", g_std_audio_sample_rate_hz);
+    cJSON_AddNumberToObject(item, "repetitions", desc->repetitions);
+    cJSON_AddNumberToObject(item, "blocks", desc->blocks);
+    cJSON_AddNumberToObject(item, "warmup_s", desc->warmup_s);
+    cJSON_AddNumberToObject(item, "logical_cores", SDL_GetNumLogicalCPUCores());
+    cJSON_AddBoolToObject(item, "cfd", desc->use_cfd);
+    cJSON_AddNumberToObject(item, "cp_table_max_error", calc_cp_table_max_error());
+    cJSON* isentropic = cJSON_AddObjectToObject(item, "isentropic");
+    cJSON_AddStringToObject(isentropic, "mode", g_isentropic_mode_string[g_isentropic.mode]);
+    cJSON_AddNumberToObject(isentropic, "max_error", desc->isentropic_max_error);
+    if(g_isentropic.mode == g_isentropic_mode_table)
+    {
+        cJSON_AddNumberToObject(isentropic, "gamma_size", g_isentropic.gamma.size);
+        cJSON_AddNumberToObject(isentropic, "mach_size", g_isentropic.mach.size);
+        cJSON_AddNumberToObject(isentropic, "pressure_root_size", g_isentropic.pressure_root.size);
+        cJSON* error = cJSON_AddObjectToObject(isentropic, "error");
+        cJSON_AddNumberToObject(error, "total_pressure_ratio", g_isentropic.error.total_pressure_ratio);
+        cJSON_AddNumberToObject(error, "mass_flow_factor", g_isentropic.error.mass_flow_factor);
+        cJSON_AddNumberToObject(error, "mach", g_isentropic.error.mach);
+    }
+    bool is_valid = push_bench_convolution(item);
+    return push_bench_flow_modes(item, desc) && is_valid;
+}
+
+/* The compiled engine's cylinder and running gear on a generated graph, so
+ * points only differ in topology. Each point starts from fresh nodes.
+ */
+
+static bool
+build_bench_sweep_engine(struct engine_s* engine, size_t cylinders, size_t banks, size_t pipes)
+{
+    ensim4_engine_params_t params = {
+        .cylinders = cylinders,
+        .banks = banks,
+        .mech = {
+            .bore_m = g_engine_piston_diameter_m,
+            .stroke_m = 2.0 * g_engine_piston_crank_throw_length_m,
+            .rod_length_m = g_engine_piston_connecting_rod_length_m,
+            .rod_mass_kg = g_engine_piston_connecting_rod_mass_kg,
+            .static_friction_n_m_s_per_r = g_engine_piston_static_friction_n_m_s_per_r,
+            .dynamic_friction_n_m_s_per_r = g_engine_piston_dynamic_friction_n_m_s_per_r,
+        },
+        .flow = {
+            .exhaust_pipes = pipes,
+        },
+    };
+    size_t size = 0;
+    struct node_s* node = build_dynamic_engine_nodes(&params, &size);
+    if(node == nullptr)
+    {
+        return false;
+    }
+    wait_for_engine_waves(engine);
+    free(g_bench_sweep_node);
+    g_bench_sweep_node = node;
+    engine->name = "synthetic";
+    engine->node = node;
+    engine->size = size;
+    engine->impulse = g_convo_filter_impulse;
+    engine->impulse_size = g_convo_filter_impulse_size;
+    return true;
+}
+
+static void
+push_bench_sweep_point(cJSON* sweep, struct bench_engine_s* self, struct engine_s* engine, size_t cores, size_t banks, size_t pipes)
+{
+    size_t cylinders = count_nodes(engine->node, engine->size, g_is_piston);
+    cJSON* item = create_bench_engine_json(self);
+    cJSON_AddNumberToObject(item, "cores", cores);
+    cJSON_AddNumberToObject(item, "cylinders", cylinders);
+    cJSON_AddNumberToObject(item, "banks", banks);
+    cJSON_AddNumberToObject(item, "pipes", pipes);
+    cJSON_AddBoolToObject(item, "cfd", engine->use_cfd);
+    cJSON_AddNumberToObject(item, "nodes", engine->size);
+    cJSON_AddNumberToObject(item, "edges", engine->edges);
+    cJSON_AddItemToArray(sweep, item);
+    printf("sweep %2zu cores %2zu cylinders %2zu pipes cfd %-3s: %8.1f ns/sample, %6.2fx realtime, %5.0f rpm%s\n",
+        cores, cylinders, pipes, engine->use_cfd ? "on" : "off", self->ns_per_sample.mean, self->realtime_factor, self->rpm,
+        self->panic_message ? ", panic" : "");
+}
+
+/* Cores are the engine thread plus the wave workers, so the pool restarts for
+ * each count. Only the pipes run in parallel; one pipe runs the same on any
+ * number of cores.
+ */
+
+static bool
+run_bench_sweep(cJSON* sweep, struct bench_desc_s* desc)
+{
+    bool is_success = true;
+    for(size_t cores = desc->cores.first; cores <= desc->cores.last; cores++)
+    {
+        stop_wave_pool();
+        limit_wave_pool(cores - 1);
+        for(size_t cylinders = desc->cylinders.first; cylinders <= desc->cylinders.last; cylinders++)
+        {
+            size_t banks = desc->banks < cylinders ? desc->banks : cylinders;
+            for(size_t pipes = desc->pipes.first; pipes <= desc->pipes.last && pipes <= cylinders; pipes++)
+            {
+                for(size_t cfd = 0; cfd < 2; cfd++)
+                {
+                    struct bench_desc_s point = *desc;
+                    point.use_cfd = cfd;
+                    if(build_bench_sweep_engine(&g_engine, cylinders, banks, pipes) == false)
+                    {
+                        fprintf(stderr, "error: cannot build %zu cylinders on %zu banks and %zu pipes\n", cylinders, banks, pipes);
+                        is_success = false;
+                        continue;
+                    }
+                    reset_bench_engine(&g_engine, &point);
+                    struct bench_engine_s bench = run_bench_engine(&g_engine, "sweep", &point);
+                    push_bench_sweep_point(sweep, &bench, &g_engine, cores, banks, pipes);
+                }
+            }
+        }
+    }
+    return is_success;
+}
+
+static bool
+run_bench_config(cJSON* engines, const char* path, struct bench_desc_s* desc)
+{
+    wait_for_engine_waves(&g_engine);
+    if(hr_init(&g_hr_state, path, &g_engine) == false)
+    {
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "source", path);
+        cJSON_AddStringToObject(item, "error", "cannot load");
+        cJSON_AddItemToArray(engines, item);
+        fprintf(stderr, "error: cannot load engine '%s'\n", path);
+        return false;
+    }
+    reset_bench_engine(&g_engine, desc);
+    struct bench_engine_s bench = run_bench_engine(&g_engine, path, desc);
+    push_bench_engine(engines, &bench);
+    return true;
+}
+
+static int
+compare_bench_paths(const void* a, const void* b)
+{
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+/* A directory stands for the json files in it, in name order. An engine that
+ * fails to load is reported as such and the rest still run.
+ */
+
+static bool
+run_bench_configs(cJSON* engines, const char* path, struct bench_desc_s* desc)
+{
+    SDL_PathInfo info;
+    if(SDL_GetPathInfo(path, &info) == false)
+    {
+        fprintf(stderr, "error: no such config or directory '%s'\n", path);
+        return false;
+    }
+    if(info.type != SDL_PATHTYPE_DIRECTORY)
+    {
+        return run_bench_config(engines, path, desc);
+    }
+    int count = 0;
+    char** names = SDL_GlobDirectory(path, "*.json", 0, &count);
+    if(names == nullptr)
+    {
+        fprintf(stderr, "error: cannot list '%s'\n", path);
+        return false;
+    }
+    qsort(names, count, sizeof(*names), compare_bench_paths);
+    bool is_success = true;
+    for(int i = 0; i < count; i++)
+    {
+        char full_path[g_bench_max_path_size];
+        snprintf(full_path, sizeof(full_path), "%s/%s", path, names[i]);
+        is_success = run_bench_config(engines, full_path, desc) && is_success;
+    }
+    SDL_free(names);
+    return is_success;
+}
+
+static bool
+write_bench_report(cJSON* report, const char* path)
+{
+    char* text = cJSON_Print(report);
+    FILE* file = text ? fopen(path, "w") : nullptr;
+    bool is_success = file && fputs(text, file) >= 0 && fputc('\n', file) != EOF;
+    if(file && fclose(file) != 0)
+    {
+        is_success = false;
+    }
+    cJSON_free(text);
+    if(is_success == false)
+    {
+        fprintf(stderr, "error: cannot write report '%s'\n", path);
+    }
+    return is_success;
+}
+
+static void
+print_bench_usage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [-o report.json] [-r repetitions] [-b blocks] [--no-cfd]\n"
+        "       [--wave-workers n] [--isentropic-error e] [engine.json | directory]...\n"
+        "       %s --sweep [-o report.json] [-b blocks] [--cylinders a[:b]]\n"
+        "       [--pipes a[:b]] [--cores a[:b]] [--banks n]\n",
+        name, name);
+}
+
+/* "a" or "a:b", from 1 up to max.
+ */
+
+static bool
+parse_bench_range(const char* text, struct bench_range_s* range, size_t max)
+{
+    char* rest = nullptr;
+    range->first = strtoul(text, &rest, 10);
+    range->last = range->first;
+    if(*rest == ':')
+    {
+        const char* tail = rest + 1;
+        range->last = strtoul(tail, &rest, 10);
+        if(rest == tail)
+        {
+            return false;
+        }
+    }
+    return rest != text && *rest == '\0' && range->first >= 1 && range->first <= range->last && range->last <= max;
+}
+
+int
+main(int argc, char* argv[])
+{
+    const char* out_path = "bench.json";
+    const char** config_paths = calloc(argc, sizeof(*config_paths));
+    size_t configs = 0;
+    size_t logical_cores = SDL_GetNumLogicalCPUCores();
+    struct bench_desc_s desc = {
+        .repetitions = g_bench_default_repetitions,
+        .isentropic_max_error = ENSIM4_ISENTROPIC_MAX_ERROR,
+        .use_cfd = true,
+        .cylinders = { 1, ENSIM4_MAX_CYLINDERS },
+        .pipes = { 1, g_bench_sweep_max_pipes },
+        .cores = { 1, logical_cores > 0 ? logical_cores : 1 },
+        .banks = 1,
+    };
+    if(config_paths == nullptr || plan_bench_wave_solver(&g_bench_wave_solver) == false)
+    {
+        fprintf(stderr, "error: out of memory\n");
+        return 1;
+    }
+    for(int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool is_valid = true;
+        if(arg[0] != '-')
+        {
+            config_paths[configs++] = arg;
+            continue;
+        }
+        if(strcmp(arg, "--no-cfd") == 0)
+        {
+            desc.use_cfd = false;
+            continue;
+        }
+        if(strcmp(arg, "--sweep") == 0)
+        {
+            desc.is_sweep = true;
+            continue;
+        }
+        if(value == nullptr)
+        {
+            is_valid = false;
+        }
+        else if(strcmp(arg, "-o") == 0)
+        {
+            out_path = value;
+        }
+        else if(strcmp(arg, "-r") == 0)
+        {
+            desc.repetitions = strtoul(value, nullptr, 10);
+            is_valid = desc.repetitions > 0 && desc.repetitions <= g_bench_max_repetitions;
+        }
+        else if(strcmp(arg, "-b") == 0)
+        {
+            desc.blocks = strtoul(value, nullptr, 10);
+            is_valid = desc.blocks > 0 && desc.blocks <= g_bench_max_blocks;
+        }
+        else if(strcmp(arg, "--wave-workers") == 0)
+        {
+            limit_wave_pool(strtoul(value, nullptr, 10));
+        }
+        else if(strcmp(arg, "--isentropic-error") == 0)
+        {
+            desc.isentropic_max_error = strtod(value, nullptr);
+            is_valid = desc.isentropic_max_error >= 0.0;
+        }
+        else if(strcmp(arg, "--cylinders") == 0)
+        {
+            is_valid = parse_bench_range(value, &desc.cylinders, ENSIM4_MAX_CYLINDERS);
+        }
+        else if(strcmp(arg, "--pipes") == 0)
+        {
+            is_valid = parse_bench_range(value, &desc.pipes, ENSIM4_MAX_CYLINDERS);
+        }
+        else if(strcmp(arg, "--cores") == 0)
+        {
+            is_valid = parse_bench_range(value, &desc.cores, g_wave_pool_max_workers + 1);
+        }
+        else if(strcmp(arg, "--banks") == 0)
+        {
+            desc.banks = strtoul(value, nullptr, 10);
+            is_valid = desc.banks >= 1 && desc.banks <= ENSIM4_MAX_CYLINDERS;
+        }
+        else
+        {
+            is_valid = false;
+        }
+        if(is_valid == false)
+        {
+            print_bench_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    if(configs == 0)
+    {
+        config_paths[configs++] = g_bench_default_configs;
+    }
+    if(desc.blocks == 0)
+    {
+        desc.blocks = desc.is_sweep ? g_bench_sweep_blocks : g_bench_default_blocks;
+    }
+    desc.warmup_s = desc.is_sweep ? g_bench_sweep_warmup_s : g_bench_warmup_s;
+    if(precompute_isentropic(desc.isentropic_max_error) == false && desc.isentropic_max_error > 0.0)
+    {
+        fprintf(stderr, "warning: isentropic tables cannot reach %g, using the exact formulas\n", desc.isentropic_max_error);
+    }
+    cJSON* report = cJSON_CreateObject();
+    bool is_valid = push_bench_build(report, &desc);
+    if(desc.is_sweep)
+    {
+        bool is_success = run_bench_sweep(cJSON_AddArrayToObject(report, "sweep"), &desc) && is_valid;
+        stop_wave_pool();
+        stop_convo_worker();
+        PERF_CLOSE();
+        is_success = write_bench_report(report, out_path) && is_success;
+        cJSON_Delete(report);
+        free(config_paths);
+        free(g_bench_sweep_node);
+        return is_success ? 0 : 1;
+    }
+    reset_bench_engine(&g_engine, &desc);
+    cJSON* kernels = cJSON_AddArrayToObject(report, "kernels");
+    cJSON* engines = cJSON_AddArrayToObject(report, "engines");
+    struct bench_engine_s bench = run_bench_engine(&g_engine, "compiled", &desc);
+    push_bench_engine(engines, &bench);
+    for(size_t kernel = 0; kernel < g_bench_kernel_e_size; kernel++)
+    {
+        size_t ops = 0;
+        struct bench_stats_s stats = time_bench_kernel(kernel, &g_engine, desc.repetitions, &ops);
+        push_bench_kernel(kernels, kernel, ops, &stats);
+    }
+    bool is_success = is_valid;
+    for(size_t i = 0; i < configs; i++)
+    {
+        is_success = run_bench_configs(engines, config_paths[i], &desc) && is_success;
+    }
+    stop_wave_pool();
+    stop_convo_worker();
+    PERF_CLOSE();
+    is_success = write_bench_report(report, out_path) && is_success;
+    cJSON_Delete(report);
+    free(config_paths);
+    return is_success ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+constexpr double g_block_controller_cost_smoothing = 0.125;
+constexpr double g_block_controller_grow_load = 0.7;
+constexpr double g_block_controller_shrink_load = 0.5;
+constexpr size_t g_block_controller_settle_blocks = 16;
+
+/* Picks the smallest block the host can afford. Load is the smoothed cost of
+ * simulating a block over the real time it plays for. Past the grow load the
+ * block doubles; it halves while the load predicted at half the size stays
+ * under the shrink load. The prediction splits the cost into a fixed part per
+ * block and a part per sample from the last two sizes measured. Until there are
+ * two it takes the whole cost as fixed, which can only overestimate, and so
+ * probes the first halving against the grow load instead. Each size settles
+ * for a few blocks before it is judged, the first of them dropped for paying
+ * the resize.
+ */
+
+struct block_controller_s
+{
+    double cost_ms;
+    double last_cost_ms;
+    size_t block_size;
+    size_t last_block_size;
+    size_t max_block_size;
+    size_t blocks;
+};
+
+static void
+reset_block_controller(struct block_controller_s* self, size_t block_size, size_t max_block_size)
+{
+    *self = (struct block_controller_s) {};
+    self->max_block_size = clamp(max_block_size, g_synth_min_block_size, g_synth_max_block_size);
+    self->block_size = clamp(block_size, g_synth_min_block_size, self->max_block_size);
+}
+
+static double
+calc_block_controller_budget_ms(size_t block_size)
+{
+    return 1e3 * block_size * g_std_dt_s;
+}
+
+static double
+predict_block_controller_load(struct block_controller_s* self, size_t block_size)
+{
+    double sample_cost_ms = 0.0;
+    if(self->last_block_size > 0)
+    {
+        sample_cost_ms = (self->cost_ms - self->last_cost_ms) / ((double) self->block_size - self->last_block_size);
+        sample_cost_ms = clamp(sample_cost_ms, 0.0, self->cost_ms / self->block_size);
+    }
+    double fixed_cost_ms = self->cost_ms - sample_cost_ms * self->block_size;
+    return (fixed_cost_ms + sample_cost_ms * block_size) / calc_block_controller_budget_ms(block_size);
+}
+
+static void
+step_block_controller(struct block_controller_s* self, size_t block_size)
+{
+    block_size = clamp(block_size, g_synth_min_block_size, self->max_block_size);
+    if(block_size != self->block_size)
+    {
+        self->last_block_size = self->block_size;
+        self->last_cost_ms = self->cost_ms;
+        self->block_size = block_size;
+        self->blocks = 0;
+    }
+}
+
+static size_t
+update_block_controller(struct block_controller_s* self, double cost_ms)
+{
+    self->blocks++;
+    if(self->blocks == 1)
+    {
+        return self->block_size;
+    }
+    self->cost_ms = self->blocks == 2
+        ? cost_ms
+        : self->cost_ms + g_block_controller_cost_smoothing * (cost_ms - self->cost_ms);
+    if(self->blocks < g_block_controller_settle_blocks)
+    {
+        return self->block_size;
+    }
+    if(self->cost_ms > g_block_controller_grow_load * calc_block_controller_budget_ms(self->block_size))
+    {
+        step_block_controller(self, 2 * self->block_size);
+        return self->block_size;
+    }
+    double shrink_load = self->last_block_size > 0 ? g_block_controller_shrink_load : g_block_controller_grow_load;
+    if(predict_block_controller_load(self, self->block_size / 2) < shrink_load)
+    {
+        step_block_controller(self, self->block_size / 2);
+    }
+    return self->block_size;
+}
@@ -1,8 +1,30 @@
 constexpr double g_chamber_c8h18_heat_of_combustion_j_per_mol = 5.47e6;
 
+/* Derived gas properties, refreshed at most once after each change to the chamber gas or volume.
+ * Mutators mark the cache stale; the first reader after a mail, compression, or combustion pays
+ * for the molar mass, cp table lookup, gamma, and the total pressure ratio, and every
+ * later reader in the same step (both sides of each nozzle, the sampler, the piston torques)
+ * reads the stored values. Zero initialized chambers start stale.
+ */
+
+struct chamber_cache_s
+{
+    double molar_mass_kg_per_mol;
+    double specific_gas_constant_j_per_kg_k;
+    double cp_j_per_mol_k;
+    double gamma;
+    double bulk_speed_of_sound_m_per_s;
+    double bulk_mach;
+    double static_pressure_pa;
+    double total_pressure_pa;
+    double total_temperature_k;
+    bool is_valid;
+};
+
 struct chamber_s
 {
     struct gas_s gas;
+    struct chamber_cache_s cache;
     double volume_m3;
     double nozzle_max_flow_area_m2;
     double nozzle_open_ratio;
@@ -11,6 +33,57 @@ struct chamber_s
     bool should_panic;
 };
 
+static void
+invalidate_chamber_cache(struct chamber_s* self)
+{
+    self->cache.is_valid = false;
+}
+
+/* Same expressions as the gas_s bulk functions, so cached and uncached results match bit for bit.
+ */
+
+static struct chamber_cache_s*
+update_chamber_cache(struct chamber_s* self)
+{
+    struct chamber_cache_s* cache = &self->cache;
+    if(cache->is_valid == false)
+    {
+        double R = g_gamma_universal_gas_constant_j_per_mol_k;
+        double M = calc_mixed_molar_mass_kg_per_mol(&self->gas);
+        double Rs = R / M;
+        double cp = calc_mixed_cp_j_per_mol_k(&self->gas);
+        double y = lookup_gamma(cp);
+        double Ts = self->gas.static_temperature_k;
+        double a = sqrt(y * Rs * Ts);
+        double u = calc_bulk_flow_velocity_m_per_s(&self->gas);
+        double Mb = u / a;
+        double Ps = self->gas.mass_kg * Rs * Ts / self->volume_m3;
+        cache->molar_mass_kg_per_mol = M;
+        cache->specific_gas_constant_j_per_kg_k = Rs;
+        cache->cp_j_per_mol_k = cp;
+        cache->gamma = y;
+        cache->bulk_speed_of_sound_m_per_s = a;
+        cache->bulk_mach = Mb;
+        cache->static_pressure_pa = Ps;
+        cache->total_pressure_pa = Ps * lookup_isentropic_total_pressure_ratio(y, Mb);
+        cache->total_temperature_k = Ts * (1.0 + (y - 1.0) / 2.0 * pow(Mb, 2.0));
+        cache->is_valid = true;
+    }
+    return cache;
+}
+
+static double
+calc_chamber_gamma(struct chamber_s* self)
+{
+    return update_chamber_cache(self)->gamma;
+}
+
+static double
+calc_chamber_specific_gas_constant_j_per_kg_k(struct chamber_s* self)
+{
+    return update_chamber_cache(self)->specific_gas_constant_j_per_kg_k;
+}
+
 /*
  *      m * R * Ts
  * Ps = ----------
@@ -20,11 +93,7 @@ struct chamber_s
 static double
 calc_static_pressure_pa(struct chamber_s* self)
 {
-    double m = self->gas.mass_kg;
-    double Rs = calc_specific_gas_constant_j_per_kg_k(&self->gas);
-    double Ts = self->gas.static_temperature_k;
-    double V = self->volume_m3;
-    return m * Rs * Ts / V;
+    return update_chamber_cache(self)->static_pressure_pa;
 }
 
 static double
@@ -59,10 +128,7 @@ calc_mass_at_kg(struct chamber_s* self, double static_pressure_pa)
 static double
 calc_total_pressure_pa(struct chamber_s* self)
 {
-    double y = calc_mixed_gamma(&self->gas);
-    double Ps = calc_static_pressure_pa(self);
-    double M = calc_bulk_mach(&self->gas);
-    return Ps * pow(1.0 + (y - 1.0) / 2.0 * pow(M, 2.0), y / (y - 1.0));
+    return update_chamber_cache(self)->total_pressure_pa;
 }
 
 /*
@@ -74,10 +140,7 @@ calc_total_pressure_pa(struct chamber_s* self)
 static double
 calc_total_temperature_k(struct chamber_s* self)
 {
-    double y = calc_mixed_gamma(&self->gas);
-    double Ts = self->gas.static_temperature_k;
-    double M = calc_bulk_mach(&self->gas);
-    return Ts * (1.0 + (y - 1.0) / 2.0 * pow(M, 2.0));
+    return update_chamber_cache(self)->total_temperature_k;
 }
 
 static double
@@ -99,9 +162,9 @@ static double
 calc_nozzle_mach(struct chamber_s* self, struct chamber_s* other)
 {
     double Pt = calc_total_pressure_pa(self);
-    double y = calc_mixed_gamma(&self->gas);
+    double y = calc_chamber_gamma(self);
     double Ps = calc_static_pressure_pa(other);
-    double M = sqrt((2.0 / (y - 1.0)) * (pow(Pt / Ps, (y - 1.0) / y) - 1.0));
+    double M = lookup_isentropic_mach(y, Pt / Ps);
 
     /* Assumes straight nozzle or convergent nozzle,
      * preventing supersonic mach numbers.
@@ -124,13 +187,13 @@ calc_nozzle_mach(struct chamber_s* self, struct chamber_s* other)
 static double
 calc_nozzle_mass_flow_rate_kg_per_s(struct chamber_s* self, double nozzle_flow_area_m2, double nozzle_mach)
 {
-    double y = calc_mixed_gamma(&self->gas);
+    double y = calc_chamber_gamma(self);
     double M = nozzle_mach;
-    double Rs = calc_specific_gas_constant_j_per_kg_k(&self->gas);
+    double Rs = calc_chamber_specific_gas_constant_j_per_kg_k(self);
     double Tt = calc_total_temperature_k(self);
     double Pt = calc_total_pressure_pa(self);
     double A = nozzle_flow_area_m2;
-    return A * Pt / sqrt(Tt) * sqrt(y / Rs) * M / pow(1.0 + (y - 1.0) / 2.0 * pow(M, 2.0), (y + 1.0) / (2.0 * (y - 1.0)));
+    return A * Pt / sqrt(Tt) * sqrt(y / Rs) * M * lookup_isentropic_mass_flow_factor(y, M);
 }
 
 /*               ______________
@@ -145,9 +208,9 @@ calc_nozzle_mass_flow_rate_kg_per_s(struct chamber_s* self, double nozzle_flow_a
 static double
 calc_nozzle_flow_velocity_m_per_s(struct chamber_s* self, double nozzle_mach)
 {
-    double y = calc_mixed_gamma(&self->gas);
+    double y = calc_chamber_gamma(self);
     double M = nozzle_mach;
-    double Rs = calc_specific_gas_constant_j_per_kg_k(&self->gas);
+    double Rs = calc_chamber_specific_gas_constant_j_per_kg_k(self);
     double Tt = calc_total_temperature_k(self);
     return M * sqrt(y * Rs * Tt / (1.0 + (y - 1.0) / 2.0 * pow(M, 2.0)));
 }
@@ -165,7 +228,7 @@ calc_nozzle_speed_of_sound_m_per_s(struct chamber_s* self, double nozzle_mach, d
     double M = nozzle_mach;
     if(M == 0.0)
     {
-        return calc_bulk_speed_of_sound_m_per_s(&self->gas);
+        return update_chamber_cache(self)->bulk_speed_of_sound_m_per_s;
     }
     else
     {
@@ -205,10 +268,10 @@ calc_nozzle_static_density_kg_per_m3(
 static double
 calc_nozzle_static_pressure_pa(struct chamber_s* self, double nozzle_mach)
 {
-    double y = calc_mixed_gamma(&self->gas);
+    double y = calc_chamber_gamma(self);
     double Pt = calc_total_pressure_pa(self);
     double M = nozzle_mach;
-    return Pt * pow(1.0 + 0.5 * (y - 1.0) * pow(M, 2.0), -y / (y - 1.0));
+    return Pt / lookup_isentropic_total_pressure_ratio(y, M);
 }
 
 /*                   y - 1
@@ -226,24 +289,33 @@ calc_new_adiabatic_static_temperature_from_volume_delta_k(struct chamber_s* self
     return self->gas.static_temperature_k * pow(V1 / V2, y - 1.0);
 }
 
+/* Fraction of the momentum left after one step. Fixed per chamber, so the
+ * engine computes it once per edge when it compiles them.
+ */
+
+static double
+calc_momentum_damping_ratio(struct chamber_s* self)
+{
+    return exp(-g_std_dt_s / self->gas_momentum_damping_time_constant_s);
+}
+
 static void
-add_momentum(struct chamber_s* self, double momentum_kg_m_per_s)
+add_momentum(struct chamber_s* self, double momentum_kg_m_per_s, double momentum_damping_ratio)
 {
     self->gas.momentum_kg_m_per_s += momentum_kg_m_per_s;
-    double momentum_damping_coeffecient = exp(-g_std_dt_s / self->gas_momentum_damping_time_constant_s);
-    self->gas.momentum_kg_m_per_s *= momentum_damping_coeffecient;
+    self->gas.momentum_kg_m_per_s *= momentum_damping_ratio;
+    invalidate_chamber_cache(self);
 }
 
 static void
-remove_gas(struct chamber_s* self, struct gas_s* mail)
+remove_gas(struct chamber_s* self, struct gas_s* mail, double momentum_damping_ratio)
 {
     self->gas.mass_kg -= mail->mass_kg;
     if(self->gas.mass_kg < 0.0)
     {
         self->should_panic = true;
-        g_panic_message = "negative chamber mass detected";
     }
-    add_momentum(self, -mail->momentum_kg_m_per_s);
+    add_momentum(self, -mail->momentum_kg_m_per_s, momentum_damping_ratio);
 }
 
 static void
@@ -251,6 +323,7 @@ normalize_chamber(struct chamber_s* self)
 {
     self->gas = g_gas_ambient_air;
     self->gas.mass_kg = calc_mass_at_kg(self, g_gas_ambient_static_pressure_pa);
+    invalidate_chamber_cache(self);
 }
 
 /* Fuel chambers are treated as a gas, atomized into fine droplets.
@@ -265,6 +338,7 @@ normalize_injection_chamber(struct chamber_s* self)
     self->gas.mass_kg = calc_mass_at_kg(self, g_gas_ambient_static_pressure_pa);
     self->gas.mass_kg *= 2.0;
     self->gas.static_temperature_k += 30.0;
+    invalidate_chamber_cache(self);
 }
 
 static double
@@ -305,10 +379,11 @@ combust_c8h18(struct chamber_s* self, double fraction)
     self->gas.mol_ratio_h2o /= mol_ratio;
     double energy_j_per_mol = mol_ratio_c8h18 * g_chamber_c8h18_heat_of_combustion_j_per_mol;
     self->gas.static_temperature_k += energy_j_per_mol / calc_mixed_cv_j_per_mol_k(&self->gas);
+    invalidate_chamber_cache(self);
 }
 
 static void
-mix_in_gas(struct chamber_s* self, struct gas_s* mail)
+mix_in_gas(struct chamber_s* self, struct gas_s* mail, double momentum_damping_ratio)
 {
     double self_moles = calc_moles(&self->gas);
     double mail_moles = calc_moles(mail);
@@ -322,5 +397,5 @@ mix_in_gas(struct chamber_s* self, struct gas_s* mail)
     self->gas.mol_ratio_h2o = calc_mix(self->gas.mol_ratio_h2o, self_moles, mail->mol_ratio_h2o, mail_moles);
     self->gas.static_temperature_k = calc_mix(self->gas.static_temperature_k, self_total_cv_j_per_k, mail->static_temperature_k, mail_total_cv_j_per_k);
     self->gas.mass_kg += mail->mass_kg;
-    add_momentum(self, mail->momentum_kg_m_per_s);
+    add_momentum(self, mail->momentum_kg_m_per_s, momentum_damping_ratio);
 }
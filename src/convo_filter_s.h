@@ -4,24 +4,141 @@ constexpr double g_convo_filter_impulse[] = {
 
 constexpr size_t g_convo_filter_impulse_size = len(g_convo_filter_impulse);
 
-extern const double* g_active_impulse;
-extern size_t        g_active_impulse_size;
-
 // Tamao mximo del buffer circular (soporta impulsos hasta ~341 ms @ 48kHz)
 constexpr size_t g_convo_filter_max_size = 16384;
 
+#define CONVO_FILTER_MODES \
+    X(direct)              \
+    X(uniform)             \
+    X(non_uniform)
+
+enum convo_filter_mode_e
+{
+#define X(mode) g_convo_filter_mode_##mode,
+    CONVO_FILTER_MODES
+#undef X
+    g_convo_filter_mode_e_size
+};
+
+constexpr char g_convo_filter_mode_string[][16] = {
+#define X(mode) #mode,
+    CONVO_FILTER_MODES
+#undef X
+};
+
+#undef CONVO_FILTER_MODES
+
+/* Uniformly partitioned overlap-save convolution.
+ *
+ * The impulse is split into K partitions of B taps (B = partition size).
+ * Each block, the last 2B input samples are transformed once and pushed into
+ * a frequency domain delay line (FDL) of K spectra:
+ *
+ *          K-1
+ * Y(n) =   sum  X(n - k) * H(k)
+ *          k=0
+ *
+ * The last B samples of IFFT(Y) are the linear convolution of the block.
+ */
+
+struct convo_uniform_s
+{
+    const double* impulse;
+    size_t impulse_size;
+    size_t partition_size;
+    size_t partitions;
+    size_t index;
+    struct fft_s forward;
+    struct fft_s inverse;
+    struct fft_complex_s* impulse_spectra;
+    struct fft_complex_s* input_spectra;
+    struct fft_complex_s* accumulator;
+    struct fft_complex_s* time;
+    double* input;
+};
+
+/* Non-uniformly partitioned convolution (Gardner).
+ *
+ * The head of the impulse runs through a short uniform convolver of B
+ * sized partitions on the audio thread. The tail is cut into segments of
+ * doubling size L = 2B, 4B, 8B, ... each starting at offset 2L:
+ *
+ * |B|B|B|B|  2B |  2B |    4B   |    4B   |        8B       | ...
+ * |  head  |  tail 0   |     tail 1        |     tail 2
+ *
+ * A tail segment convolves L input samples at once, and as it starts 2L
+ * into the impulse its output is not needed until L samples after its
+ * input is complete. Each tail job runs on the tail's worker over those L
+ * samples of slack, so long impulses add no latency and the expensive
+ * large transforms happen off the audio path.
+ *
+ * Tail jobs of every filter in the process run on one shared worker, started
+ * with the first job and parked between jobs, so a job costs a signal rather
+ * than a thread however many synths there are. Tails post together whenever
+ * their fills line up, so the worker takes the posted tail with the smallest
+ * L first, that being the one due soonest, and a short tail never queues
+ * behind a long tail's transform.
+ */
+
+constexpr size_t g_convo_filter_head_partitions = 4;
+constexpr size_t g_convo_filter_max_tails = 16;
+
+struct convo_tail_s
+{
+    struct convo_uniform_s uniform;
+    size_t partition_size;
+    size_t fill;
+    size_t read;
+    double* input;
+    double* job;
+    double* output;
+    struct convo_tail_s* next_posted;
+    bool is_posted;
+};
+
+struct convo_non_uniform_s
+{
+    const double* impulse;
+    size_t impulse_size;
+    size_t block_size;
+    size_t tails;
+    double* block;
+    struct convo_uniform_s head;
+    struct convo_tail_s tail[g_convo_filter_max_tails];
+};
+
+/* The partitioned engines run at a fixed B whatever the synth block size, so
+ * a block size change never replans them or drops their history. The first B
+ * taps run in direct form sample by sample, and the rest of the impulse, which
+ * starts B samples in, runs through the engine over the last full partition of
+ * input: its output is not due until the B samples after that partition, so
+ * buffering it adds no latency.
+ *
+ * A plan that failed is remembered with what it was planned for, so the audio
+ * path does not retry it every block; error says why until something changes.
+ */
+
+constexpr size_t g_convo_filter_partition_size = 256;
+
 struct convo_filter_s
 {
     double buffer[g_convo_filter_max_size];
     size_t index;
+    double partition[g_convo_filter_partition_size];
+    double rest[g_convo_filter_partition_size];
+    size_t partition_index;
+    enum convo_filter_mode_e mode;
+    struct convo_uniform_s uniform;
+    struct convo_non_uniform_s non_uniform;
+    const double* failed_impulse;
+    size_t failed_impulse_size;
+    const char* error;
 };
 
 static double
-filter_convo(struct convo_filter_s* self, double sample)
+filter_convo(struct convo_filter_s* self, const double impulse[], size_t y, double sample)
 {
-    // Usa g_active_impulse y g_active_impulse_size (intercambiables en runtime)
-    const double* impulse = g_active_impulse;
-    size_t y = g_active_impulse_size;
+    // El impulso lo elige el motor (intercambiable en runtime)
     if (y == 0 || y > g_convo_filter_max_size) {
         return sample;  // seguridad: si no hay impulso, pasar directo
     }
@@ -40,3 +157,540 @@ filter_convo(struct convo_filter_s* self, double sample)
     self->index = (self->index - 1 + y) % y;
     return result;
 }
+
+static void
+free_convo_uniform(struct convo_uniform_s* self)
+{
+    free_fft(&self->forward);
+    free_fft(&self->inverse);
+    free(self->impulse_spectra);
+    free(self->input_spectra);
+    free(self->accumulator);
+    free(self->time);
+    free(self->input);
+    *self = (struct convo_uniform_s) {};
+}
+
+static bool
+is_convo_uniform_planned(struct convo_uniform_s* self, const double* impulse, size_t impulse_size, size_t partition_size)
+{
+    return self->impulse == impulse
+        && self->impulse_size == impulse_size
+        && self->partition_size == partition_size;
+}
+
+static bool
+plan_convo_uniform(struct convo_uniform_s* self, const double* impulse, size_t impulse_size, size_t partition_size)
+{
+    free_convo_uniform(self);
+    size_t b = partition_size;
+    size_t n = 2 * b;
+    size_t k = (impulse_size + b - 1) / b;
+    self->impulse = impulse;
+    self->impulse_size = impulse_size;
+    self->partition_size = b;
+    self->partitions = k;
+    self->impulse_spectra = calloc(k * n, sizeof(*self->impulse_spectra));
+    self->input_spectra = calloc(k * n, sizeof(*self->input_spectra));
+    self->accumulator = calloc(n, sizeof(*self->accumulator));
+    self->time = calloc(n, sizeof(*self->time));
+    self->input = calloc(n, sizeof(*self->input));
+    if(self->impulse_spectra == nullptr
+    || self->input_spectra == nullptr
+    || self->accumulator == nullptr
+    || self->time == nullptr
+    || self->input == nullptr
+    || plan_fft(&self->forward, n, false) == false
+    || plan_fft(&self->inverse, n, true) == false)
+    {
+        free_convo_uniform(self);
+        return false;
+    }
+    for(size_t j = 0; j < k; j++)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            size_t tap = j * b + i;
+            bool is_in_partition = i < b && tap < impulse_size;
+            self->time[i] = (struct fft_complex_s) { .re = is_in_partition ? impulse[tap] : 0.0 };
+        }
+        run_fft(&self->forward, self->time, &self->impulse_spectra[j * n]);
+    }
+    return true;
+}
+
+static void
+filter_convo_uniform(struct convo_uniform_s* self, double samples[])
+{
+    size_t b = self->partition_size;
+    size_t n = 2 * b;
+    size_t k = self->partitions;
+    for(size_t i = 0; i < b; i++)
+    {
+        self->input[i] = self->input[i + b];
+        self->input[i + b] = samples[i];
+    }
+    for(size_t i = 0; i < n; i++)
+    {
+        self->time[i] = (struct fft_complex_s) { .re = self->input[i] };
+    }
+    run_fft(&self->forward, self->time, &self->input_spectra[self->index * n]);
+    clear_fft_complex(self->accumulator, n);
+    for(size_t j = 0; j < k; j++)
+    {
+        size_t slot = (self->index + k - j) % k;
+        struct fft_complex_s* x = &self->input_spectra[slot * n];
+        struct fft_complex_s* h = &self->impulse_spectra[j * n];
+        for(size_t i = 0; i < n; i++)
+        {
+            self->accumulator[i].re += x[i].re * h[i].re - x[i].im * h[i].im;
+            self->accumulator[i].im += x[i].re * h[i].im + x[i].im * h[i].re;
+        }
+    }
+    run_fft(&self->inverse, self->accumulator, self->time);
+    for(size_t i = 0; i < b; i++)
+    {
+        samples[i] = self->time[i + b].re / n;
+    }
+    self->index = (self->index + 1) % k;
+}
+
+struct convo_worker_s
+{
+    thrd_t thread;
+    mtx_t mutex;
+    cnd_t wake;
+    cnd_t done;
+    struct convo_tail_s* posted;
+    atomic_bool is_starting;
+    atomic_bool is_started;
+    bool has_thread;
+    bool is_running;
+}
+static g_convo_worker = {};
+
+static struct convo_tail_s*
+take_convo_worker_job()
+{
+    struct convo_tail_s** soonest = &g_convo_worker.posted;
+    for(struct convo_tail_s** tail = soonest; *tail; tail = &(*tail)->next_posted)
+    {
+        if((*tail)->partition_size < (*soonest)->partition_size)
+        {
+            soonest = tail;
+        }
+    }
+    struct convo_tail_s* job = *soonest;
+    *soonest = job->next_posted;
+    job->next_posted = nullptr;
+    return job;
+}
+
+/* Jobs posted before a stop still run, so the worker only leaves idle.
+ */
+
+static int
+run_convo_worker(void* argument)
+{
+    (void) argument;
+    mtx_lock(&g_convo_worker.mutex);
+    for(;;)
+    {
+        while(g_convo_worker.posted == nullptr && g_convo_worker.is_running)
+        {
+            cnd_wait(&g_convo_worker.wake, &g_convo_worker.mutex);
+        }
+        if(g_convo_worker.posted == nullptr)
+        {
+            break;
+        }
+        struct convo_tail_s* tail = take_convo_worker_job();
+        mtx_unlock(&g_convo_worker.mutex);
+        filter_convo_uniform(&tail->uniform, tail->job);
+        mtx_lock(&g_convo_worker.mutex);
+        tail->is_posted = false;
+        cnd_broadcast(&g_convo_worker.done);
+    }
+    mtx_unlock(&g_convo_worker.mutex);
+    return 0;
+}
+
+/* Safe to race from several synth threads, the losers wait for the winner.
+ * Without a worker, jobs run on the posting thread.
+ */
+
+static void
+start_convo_worker()
+{
+    if(atomic_load_explicit(&g_convo_worker.is_started, memory_order_acquire))
+    {
+        return;
+    }
+    if(atomic_exchange(&g_convo_worker.is_starting, true))
+    {
+        while(atomic_load_explicit(&g_convo_worker.is_started, memory_order_acquire) == false)
+        {
+            thrd_yield();
+        }
+        return;
+    }
+    g_convo_worker.is_running = true;
+    g_convo_worker.has_thread = mtx_init(&g_convo_worker.mutex) == thrd_success
+        && cnd_init(&g_convo_worker.wake) == thrd_success
+        && cnd_init(&g_convo_worker.done) == thrd_success
+        && thrd_create(&g_convo_worker.thread, run_convo_worker, nullptr) == thrd_success;
+    atomic_store_explicit(&g_convo_worker.is_started, true, memory_order_release);
+}
+
+/* Only once every synth has stopped posting.
+ */
+
+static void
+stop_convo_worker()
+{
+    if(atomic_load(&g_convo_worker.is_started) == false)
+    {
+        return;
+    }
+    if(g_convo_worker.has_thread)
+    {
+        mtx_lock(&g_convo_worker.mutex);
+        g_convo_worker.is_running = false;
+        cnd_signal(&g_convo_worker.wake);
+        mtx_unlock(&g_convo_worker.mutex);
+        thrd_join(g_convo_worker.thread, nullptr);
+    }
+    mtx_destroy(&g_convo_worker.mutex);
+    cnd_destroy(&g_convo_worker.wake);
+    cnd_destroy(&g_convo_worker.done);
+    g_convo_worker.has_thread = false;
+    atomic_store(&g_convo_worker.is_started, false);
+    atomic_store(&g_convo_worker.is_starting, false);
+}
+
+/* A tail that was never posted may be waited on before any worker started.
+ */
+
+static void
+wait_for_convo_tail(struct convo_tail_s* self)
+{
+    if(atomic_load_explicit(&g_convo_worker.is_started, memory_order_acquire) && g_convo_worker.has_thread)
+    {
+        mtx_lock(&g_convo_worker.mutex);
+        while(self->is_posted)
+        {
+            cnd_wait(&g_convo_worker.done, &g_convo_worker.mutex);
+        }
+        mtx_unlock(&g_convo_worker.mutex);
+    }
+}
+
+static void
+post_convo_tail(struct convo_tail_s* self)
+{
+    start_convo_worker();
+    if(g_convo_worker.has_thread == false)
+    {
+        filter_convo_uniform(&self->uniform, self->job);
+        return;
+    }
+    mtx_lock(&g_convo_worker.mutex);
+    self->is_posted = true;
+    self->next_posted = g_convo_worker.posted;
+    g_convo_worker.posted = self;
+    cnd_signal(&g_convo_worker.wake);
+    mtx_unlock(&g_convo_worker.mutex);
+}
+
+static void
+free_convo_non_uniform(struct convo_non_uniform_s* self)
+{
+    for(size_t i = 0; i < self->tails; i++)
+    {
+        struct convo_tail_s* tail = &self->tail[i];
+        wait_for_convo_tail(tail);
+        free_convo_uniform(&tail->uniform);
+        free(tail->input);
+        free(tail->job);
+        free(tail->output);
+    }
+    free_convo_uniform(&self->head);
+    free(self->block);
+    *self = (struct convo_non_uniform_s) {};
+}
+
+static bool
+is_convo_non_uniform_planned(struct convo_non_uniform_s* self, const double* impulse, size_t impulse_size, size_t block_size)
+{
+    return self->impulse == impulse
+        && self->impulse_size == impulse_size
+        && self->block_size == block_size;
+}
+
+static bool
+plan_convo_tail(struct convo_tail_s* self, const double* impulse, size_t impulse_size, size_t partition_size)
+{
+    self->partition_size = partition_size;
+    self->read = partition_size;
+    self->input = calloc(partition_size, sizeof(*self->input));
+    self->job = calloc(partition_size, sizeof(*self->job));
+    self->output = calloc(partition_size, sizeof(*self->output));
+    if(self->input == nullptr
+    || self->job == nullptr
+    || self->output == nullptr
+    || plan_convo_uniform(&self->uniform, impulse, impulse_size, partition_size) == false)
+    {
+        return false;
+    }
+    return true;
+}
+
+static bool
+plan_convo_non_uniform(struct convo_non_uniform_s* self, const double* impulse, size_t impulse_size, size_t block_size)
+{
+    free_convo_non_uniform(self);
+    self->impulse = impulse;
+    self->impulse_size = impulse_size;
+    self->block_size = block_size;
+    self->block = calloc(block_size, sizeof(*self->block));
+    size_t head_size = min(impulse_size, g_convo_filter_head_partitions * block_size);
+    if(self->block == nullptr || plan_convo_uniform(&self->head, impulse, head_size, block_size) == false)
+    {
+        free_convo_non_uniform(self);
+        return false;
+    }
+    for(size_t l = 2 * block_size; 2 * l < impulse_size; l *= 2)
+    {
+        if(self->tails == g_convo_filter_max_tails)
+        {
+            free_convo_non_uniform(self);
+            return false;
+        }
+        size_t offset = 2 * l;
+        size_t size = min(2 * l, impulse_size - offset);
+        if(plan_convo_tail(&self->tail[self->tails++], impulse + offset, size, l) == false)
+        {
+            free_convo_non_uniform(self);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Once a tail collects L samples its previous job is due: that result is
+ * swapped in to be read over the next L samples and the new input goes
+ * out as the next job.
+ */
+
+static void
+filter_convo_non_uniform(struct convo_non_uniform_s* self, double samples[])
+{
+    size_t b = self->block_size;
+    memcpy(self->block, samples, b * sizeof(*samples));
+    filter_convo_uniform(&self->head, samples);
+    for(size_t i = 0; i < self->tails; i++)
+    {
+        struct convo_tail_s* tail = &self->tail[i];
+        if(tail->read < tail->partition_size)
+        {
+            for(size_t j = 0; j < b; j++)
+            {
+                samples[j] += tail->output[tail->read + j];
+            }
+            tail->read += b;
+        }
+        memcpy(&tail->input[tail->fill], self->block, b * sizeof(*self->block));
+        tail->fill += b;
+        if(tail->fill == tail->partition_size)
+        {
+            wait_for_convo_tail(tail);
+            swap(tail->job, tail->output);
+            swap(tail->input, tail->job);
+            tail->read = 0;
+            tail->fill = 0;
+            post_convo_tail(tail);
+        }
+    }
+}
+
+static bool
+has_convo_filter_failed(struct convo_filter_s* self, const double* impulse, size_t impulse_size)
+{
+    return self->error != nullptr
+        && self->failed_impulse == impulse
+        && self->failed_impulse_size == impulse_size;
+}
+
+static void
+fail_convo_filter(struct convo_filter_s* self, const double* impulse, size_t impulse_size, const char* error)
+{
+    self->failed_impulse = impulse;
+    self->failed_impulse_size = impulse_size;
+    self->error = error;
+    fprintf(stderr, "error: %s for %lu taps, using the direct form\n", error, impulse_size);
+}
+
+/* Plans the engine for the taps past the first partition.
+ */
+
+static bool
+plan_convo_filter_rest(struct convo_filter_s* self, enum convo_filter_mode_e mode, const double impulse[], size_t impulse_size)
+{
+    size_t b = g_convo_filter_partition_size;
+    if(mode == g_convo_filter_mode_uniform)
+    {
+        struct convo_uniform_s* uniform = &self->uniform;
+        if(is_convo_uniform_planned(uniform, impulse + b, impulse_size - b, b)
+        || plan_convo_uniform(uniform, impulse + b, impulse_size - b, b))
+        {
+            return true;
+        }
+        fail_convo_filter(self, impulse, impulse_size, "uniform convolution planning failed");
+        return false;
+    }
+    struct convo_non_uniform_s* non_uniform = &self->non_uniform;
+    if(is_convo_non_uniform_planned(non_uniform, impulse + b, impulse_size - b, b)
+    || plan_convo_non_uniform(non_uniform, impulse + b, impulse_size - b, b))
+    {
+        return true;
+    }
+    fail_convo_filter(self, impulse, impulse_size, "non-uniform convolution planning failed");
+    return false;
+}
+
+/* Filters a synth block of any size in place with the selected engine. Falls
+ * back to the direct form if the partitions cannot be planned, and says why.
+ */
+
+static const char*
+filter_convo_block(
+    struct convo_filter_s* self,
+    enum convo_filter_mode_e mode,
+    const double impulse[],
+    size_t impulse_size,
+    double samples[],
+    size_t size)
+{
+    if(impulse_size == 0 || impulse_size > g_convo_filter_max_size)
+    {
+        return nullptr;
+    }
+    if(mode != self->mode)
+    {
+        /* Engines do not share history, so start the new one from silence
+         * instead of replaying a stale tail.
+         */
+        free_convo_uniform(&self->uniform);
+        free_convo_non_uniform(&self->non_uniform);
+        clear(self->buffer);
+        self->index = 0;
+        clear(self->partition);
+        clear(self->rest);
+        self->partition_index = 0;
+        self->mode = mode;
+        self->error = nullptr;
+    }
+    size_t b = g_convo_filter_partition_size;
+    if(mode != g_convo_filter_mode_direct
+    && impulse_size > b
+    && has_convo_filter_failed(self, impulse, impulse_size) == false)
+    {
+        self->error = nullptr;
+        if(plan_convo_filter_rest(self, mode, impulse, impulse_size))
+        {
+            /* The direct form history may be left over from a longer impulse.
+             */
+            self->index %= b;
+            for(size_t i = 0; i < size; i++)
+            {
+                double rest = self->rest[self->partition_index];
+                self->partition[self->partition_index++] = samples[i];
+                samples[i] = filter_convo(self, impulse, b, samples[i]) + rest;
+                if(self->partition_index == b)
+                {
+                    memcpy(self->rest, self->partition, sizeof(self->rest));
+                    if(mode == g_convo_filter_mode_uniform)
+                    {
+                        filter_convo_uniform(&self->uniform, self->rest);
+                    }
+                    else
+                    {
+                        filter_convo_non_uniform(&self->non_uniform, self->rest);
+                    }
+                    self->partition_index = 0;
+                }
+            }
+            return nullptr;
+        }
+    }
+    self->index %= impulse_size;
+    for(size_t i = 0; i < size; i++)
+    {
+        samples[i] = filter_convo(self, impulse, impulse_size, samples[i]);
+    }
+    return self->error;
+}
+
+/* Validation harness: a block engine against the direct form over the same
+ * impulse and input. The input is a unit impulse, which plays the impulse
+ * back tap for tap, then noise once it has died out. Blocks alternate between
+ * block_size and a little over half of it, as the block controller resizes
+ * them, and neither lines up with the partitions. Reports the largest
+ * error relative to the peak of the direct output, or -1 if the engine could
+ * not be planned. Both run in double, so anything past float resolution is a
+ * partitioning bug rather than rounding.
+ */
+
+constexpr double g_convo_filter_max_error = 1e-6;
+
+static double
+validate_convo_filter(enum convo_filter_mode_e mode, const double impulse[], size_t impulse_size, size_t block_size)
+{
+    struct convo_filter_s* direct = calloc(1, sizeof(*direct));
+    struct convo_filter_s* filter = calloc(1, sizeof(*filter));
+    double* expected = calloc(block_size, sizeof(*expected));
+    double* samples = calloc(block_size, sizeof(*samples));
+    double error = -1.0;
+    if(direct && filter && expected && samples)
+    {
+        size_t samples_size = 3 * impulse_size;
+        uint64_t seed = 1;
+        double peak = 0.0;
+        double max_error = 0.0;
+        bool is_planned = true;
+        size_t size = 0;
+        for(size_t b = 0, start = 0; start < samples_size && is_planned; b++, start += size)
+        {
+            size = b % 2 == 0 ? block_size : block_size / 2 + 1;
+            for(size_t i = 0; i < size; i++)
+            {
+                size_t t = start + i;
+                seed = seed * 6364136223846793005u + 1442695040888963407u;
+                double noise = (seed >> 11) * 0x1p-52 - 1.0;
+                samples[i] = t == 0 ? 1.0 : t < impulse_size ? 0.0 : noise;
+            }
+            memcpy(expected, samples, size * sizeof(*samples));
+            filter_convo_block(direct, g_convo_filter_mode_direct, impulse, impulse_size, expected, size);
+            is_planned = filter_convo_block(filter, mode, impulse, impulse_size, samples, size) == nullptr;
+            for(size_t i = 0; i < size; i++)
+            {
+                peak = max(peak, fabs(expected[i]));
+                max_error = max(max_error, fabs(samples[i] - expected[i]));
+            }
+        }
+        if(is_planned)
+        {
+            error = peak > 0.0 ? max_error / peak : max_error;
+        }
+    }
+    if(filter)
+    {
+        free_convo_uniform(&filter->uniform);
+        free_convo_non_uniform(&filter->non_uniform);
+    }
+    free(direct);
+    free(filter);
+    free(expected);
+    free(samples);
+    return error;
+}
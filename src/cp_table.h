@@ -0,0 +1,6037 @@
+/* Generated by tools/gen_cp_table.py from the NASA Glenn coefficients in gamma.h; do not edit.
+ *
+ * cp in J/(mol K) for every whole kelvin from 0 K to 6000 K, taken at the middle of
+ * the kelvin, with the species interleaved in gas_s mol ratio order and padded to a
+ * 64 byte cache line. Truncating the temperature to a row stays within 2.0e-03 of the
+ * polynomials, which are flat outside 200 K to 6000 K.
+ */
+
+#define CP_SPECIES \
+    X(n2)          \
+    X(o2)          \
+    X(ar)          \
+    X(c8h18)       \
+    X(co2)         \
+    X(h2o)
+
+enum cp_species_e
+{
+#define X(name) g_cp_species_##name,
+    CP_SPECIES
+#undef X
+    g_cp_species_e_size
+};
+
+#undef CP_SPECIES
+
+constexpr size_t g_cp_table_size = 6001;
+constexpr size_t g_cp_table_lanes = 8;
+
+struct cp_table_row_s
+{
+    alignas(64) double cp_j_per_mol_k[g_cp_table_lanes];
+};
+
+constexpr struct cp_table_row_s g_cp_table[g_cp_table_size] = {
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 0 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 1 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 2 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 3 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 4 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 5 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 6 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 7 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 8 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 9 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 10 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 11 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 12 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 13 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 14 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 15 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 16 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 17 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 18 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 19 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 20 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 21 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 22 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 23 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 24 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 25 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 26 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 27 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 28 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 29 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 30 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 31 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 32 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 33 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 34 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 35 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 36 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 37 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 38 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 39 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 40 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 41 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 42 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 43 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 44 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 45 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 46 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 47 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 48 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 49 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 50 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 51 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 52 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 53 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 54 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 55 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 56 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 57 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 58 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 59 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 60 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 61 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 62 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 63 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 64 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 65 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 66 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 67 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 68 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 69 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 70 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 71 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 72 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 73 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 74 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 75 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 76 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 77 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 78 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 79 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 80 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 81 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 82 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 83 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 84 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 85 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 86 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 87 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 88 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 89 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 90 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 91 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 92 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 93 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 94 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 95 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 96 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 97 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 98 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 99 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 100 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 101 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 102 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 103 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 104 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 105 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 106 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 107 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 108 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 109 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 110 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 111 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 112 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 113 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 114 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 115 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 116 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 117 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 118 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 119 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 120 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 121 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 122 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 123 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 124 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 125 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 126 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 127 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 128 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 129 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 130 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 131 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 132 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 133 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 134 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 135 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 136 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 137 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 138 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 139 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 140 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 141 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 142 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 143 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 144 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 145 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 146 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 147 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 148 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 149 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 150 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 151 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 152 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 153 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 154 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 155 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 156 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 157 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 158 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 159 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 160 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 161 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 162 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 163 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 164 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 165 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 166 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 167 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 168 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 169 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 170 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 171 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 172 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 173 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 174 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 175 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 176 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 177 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 178 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 179 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 180 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 181 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 182 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 183 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 184 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 185 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 186 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 187 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 188 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 189 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 190 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 191 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 192 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 193 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 194 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 195 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 196 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 197 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 198 K */
+    {{ 29.1072699987, 29.1257914653, 20.7861495, 130.577514809, 32.3610195801, 33.349293996 }}, /* 199 K */
+    {{ 29.1070813226, 29.1268502025, 20.7861495, 130.87723772, 32.3844811601, 33.3506024344 }}, /* 200 K */
+    {{ 29.1067326632, 29.1289047488, 20.7861495, 131.476496363, 32.4315706725, 33.3531382842 }}, /* 201 K */
+    {{ 29.1064204771, 29.1308803364, 20.7861495, 132.075512996, 32.4788729001, 33.3555715854 }}, /* 202 K */
+    {{ 29.1061427118, 29.1327827089, 20.7861495, 132.674296138, 32.5263772517, 33.3579087107 }}, /* 203 K */
+    {{ 29.1058974111, 29.1346173985, 20.7861495, 133.272853694, 32.5740734848, 33.3601557985 }}, /* 204 K */
+    {{ 29.105682712, 29.1363897331, 20.7861495, 133.871192984, 32.6219516929, 33.3623187614 }}, /* 205 K */
+    {{ 29.1054968401, 29.1381048444, 20.7861495, 134.469320768, 32.6700022948, 33.3644032943 }}, /* 206 K */
+    {{ 29.1053381066, 29.139767674, 20.7861495, 135.067243269, 32.7182160232, 33.366414882 }}, /* 207 K */
+    {{ 29.1052049047, 29.1413829805, 20.7861495, 135.664966198, 32.7665839143, 33.3683588071 }}, /* 208 K */
+    {{ 29.1050957063, 29.1429553462, 20.7861495, 136.262494776, 32.8150972973, 33.3702401568 }}, /* 209 K */
+    {{ 29.105009059, 29.1444891826, 20.7861495, 136.859833755, 32.8637477845, 33.37206383 }}, /* 210 K */
+    {{ 29.1049435829, 29.1459887371, 20.7861495, 137.45698744, 32.9125272623, 33.373834544 }}, /* 211 K */
+    {{ 29.1048979677, 29.1474580983, 20.7861495, 138.053959706, 32.9614278815, 33.3755568411 }}, /* 212 K */
+    {{ 29.1048709701, 29.1489012017, 20.7861495, 138.650754019, 33.0104420487, 33.3772350944 }}, /* 213 K */
+    {{ 29.1048614107, 29.150321835, 20.7861495, 139.247373456, 33.0595624181, 33.3788735141 }}, /* 214 K */
+    {{ 29.104868172, 29.1517236432, 20.7861495, 139.843820719, 33.1087818827, 33.3804761529 }}, /* 215 K */
+    {{ 29.1048901955, 29.1531101337, 20.7861495, 140.440098151, 33.1580935668, 33.3820469121 }}, /* 216 K */
+    {{ 29.1049264796, 29.1544846808, 20.7861495, 141.036207758, 33.2074908186, 33.3835895461 }}, /* 217 K */
+    {{ 29.1049760771, 29.1558505305, 20.7861495, 141.632151216, 33.2569672021, 33.3851076683 }}, /* 218 K */
+    {{ 29.1050380929, 29.1572108049, 20.7861495, 142.227929894, 33.3065164909, 33.3866047555 }}, /* 219 K */
+    {{ 29.1051116823, 29.1585685062, 20.7861495, 142.823544862, 33.3561326609, 33.3880841528 }}, /* 220 K */
+    {{ 29.1051960488, 29.1599265213, 20.7861495, 143.418996908, 33.4058098837, 33.3895490786 }}, /* 221 K */
+    {{ 29.105290442, 29.1612876252, 20.7861495, 144.014286549, 33.4555425204, 33.3910026281 }}, /* 222 K */
+    {{ 29.1053941559, 29.1626544852, 20.7861495, 144.609414044, 33.5053251153, 33.3924477785 }}, /* 223 K */
+    {{ 29.1055065269, 29.1640296646, 20.7861495, 145.204379409, 33.5551523904, 33.3938873924 }}, /* 224 K */
+    {{ 29.1056269325, 29.1654156259, 20.7861495, 145.799182422, 33.6050192389, 33.3953242223 }}, /* 225 K */
+    {{ 29.1057547891, 29.1668147346, 20.7861495, 146.393822642, 33.6549207206, 33.3967609138 }}, /* 226 K */
+    {{ 29.1058895508, 29.1682292621, 20.7861495, 146.988299411, 33.7048520559, 33.3982000101 }}, /* 227 K */
+    {{ 29.1060307076, 29.1696613893, 20.7861495, 147.582611872, 33.754808621, 33.3996439545 }}, /* 228 K */
+    {{ 29.1061777842, 29.1711132095, 20.7861495, 148.176758974, 33.8047859429, 33.4010950947 }}, /* 229 K */
+    {{ 29.1063303384, 29.1725867312, 20.7861495, 148.770739484, 33.8547796944, 33.4025556857 }}, /* 230 K */
+    {{ 29.1064879598, 29.1740838812, 20.7861495, 149.364551993, 33.9047856897, 33.4040278929 }}, /* 231 K */
+    {{ 29.1066502682, 29.1756065072, 20.7861495, 149.958194928, 33.9547998799, 33.4055137956 }}, /* 232 K */
+    {{ 29.1068169128, 29.1771563804, 20.7861495, 150.551666556, 34.0048183485, 33.4070153893 }}, /* 233 K */
+    {{ 29.1069875709, 29.1787351986, 20.7861495, 151.144964998, 34.0548373076, 33.4085345891 }}, /* 234 K */
+    {{ 29.1071619463, 29.1803445877, 20.7861495, 151.73808823, 34.1048530933, 33.4100732321 }}, /* 235 K */
+    {{ 29.1073397687, 29.181986105, 20.7861495, 152.331034097, 34.1548621624, 33.4116330804 }}, /* 236 K */
+    {{ 29.1075207924, 29.1836612412, 20.7861495, 152.923800313, 34.2048610882, 33.4132158234 }}, /* 237 K */
+    {{ 29.107704795, 29.1853714223, 20.7861495, 153.516384473, 34.2548465572, 33.4148230802 }}, /* 238 K */
+    {{ 29.1078915771, 29.1871180124, 20.7861495, 154.108784057, 34.3048153651, 33.4164564022 }}, /* 239 K */
+    {{ 29.1080809604, 29.1889023151, 20.7861495, 154.700996439, 34.3547644139, 33.4181172756 }}, /* 240 K */
+    {{ 29.1082727877, 29.1907255762, 20.7861495, 155.293018888, 34.4046907085, 33.4198071229 }}, /* 241 K */
+    {{ 29.1084669212, 29.1925889849, 20.7861495, 155.884848578, 34.4545913532, 33.4215273058 }}, /* 242 K */
+    {{ 29.1086632424, 29.1944936763, 20.7861495, 156.476482593, 34.5044635488, 33.423279127 }}, /* 243 K */
+    {{ 29.1088616506, 29.1964407329, 20.7861495, 157.067917929, 34.5543045901, 33.425063832 }}, /* 244 K */
+    {{ 29.1090620625, 29.1984311864, 20.7861495, 157.659151504, 34.604111862, 33.4268826113 }}, /* 245 K */
+    {{ 29.1092644114, 29.2004660194, 20.7861495, 158.250180158, 34.6538828376, 33.4287366023 }}, /* 246 K */
+    {{ 29.1094686463, 29.2025461672, 20.7861495, 158.841000662, 34.7036150754, 33.4306268909 }}, /* 247 K */
+    {{ 29.1096747312, 29.204672519, 20.7861495, 159.431609719, 34.753306216, 33.4325545133 }}, /* 248 K */
+    {{ 29.1098826448, 29.2068459197, 20.7861495, 160.02200397, 34.8029539804, 33.4345204578 }}, /* 249 K */
+    {{ 29.1100923793, 29.2090671715, 20.7861495, 160.612179998, 34.8525561673, 33.4365256662 }}, /* 250 K */
+    {{ 29.11030394, 29.2113370349, 20.7861495, 161.202134332, 34.9021106503, 33.4385710359 }}, /* 251 K */
+    {{ 29.110517345, 29.2136562305, 20.7861495, 161.791863449, 34.9516153763, 33.4406574205 }}, /* 252 K */
+    {{ 29.110732624, 29.2160254401, 20.7861495, 162.381363782, 35.0010683628, 33.4427856323 }}, /* 253 K */
+    {{ 29.1109498183, 29.2184453081, 20.7861495, 162.970631717, 35.0504676959, 33.4449564431 }}, /* 254 K */
+    {{ 29.1111689799, 29.2209164427, 20.7861495, 163.559663604, 35.0998115283, 33.4471705854 }}, /* 255 K */
+    {{ 29.111390171, 29.223439417, 20.7861495, 164.148455753, 35.1490980773, 33.4494287545 }}, /* 256 K */
+    {{ 29.1116134639, 29.2260147705, 20.7861495, 164.737004441, 35.1983256225, 33.4517316091 }}, /* 257 K */
+    {{ 29.1118389399, 29.2286430097, 20.7861495, 165.325305916, 35.2474925043, 33.4540797727 }}, /* 258 K */
+    {{ 29.1120666894, 29.2313246098, 20.7861495, 165.913356395, 35.2965971221, 33.4564738349 }}, /* 259 K */
+    {{ 29.1122968111, 29.2340600152, 20.7861495, 166.501152073, 35.3456379323, 33.4589143526 }}, /* 260 K */
+    {{ 29.1125294117, 29.2368496409, 20.7861495, 167.08868912, 35.3946134465, 33.461401851 }}, /* 261 K */
+    {{ 29.1127646053, 29.2396938733, 20.7861495, 167.675963686, 35.4435222302, 33.4639368246 }}, /* 262 K */
+    {{ 29.1130025134, 29.2425930713, 20.7861495, 168.262971905, 35.492362901, 33.4665197385 }}, /* 263 K */
+    {{ 29.1132432641, 29.2455475672, 20.7861495, 168.849709894, 35.5411341269, 33.4691510292 }}, /* 264 K */
+    {{ 29.1134869921, 29.2485576671, 20.7861495, 169.436173756, 35.589834625, 33.4718311058 }}, /* 265 K */
+    {{ 29.113733838, 29.2516236529, 20.7861495, 170.022359585, 35.63846316, 33.4745603508 }}, /* 266 K */
+    {{ 29.113983948, 29.2547457817, 20.7861495, 170.608263463, 35.6870185426, 33.4773391207 }}, /* 267 K */
+    {{ 29.114237474, 29.257924288, 20.7861495, 171.193881469, 35.7354996285, 33.4801677477 }}, /* 268 K */
+    {{ 29.1144945728, 29.2611593834, 20.7861495, 171.779209671, 35.7839053165, 33.4830465396 }}, /* 269 K */
+    {{ 29.1147554058, 29.2644512579, 20.7861495, 172.364244138, 35.8322345478, 33.4859757816 }}, /* 270 K */
+    {{ 29.1150201392, 29.2678000807, 20.7861495, 172.948980934, 35.8804863045, 33.4889557362 }}, /* 271 K */
+    {{ 29.1152889431, 29.2712060005, 20.7861495, 173.533416125, 35.928659608, 33.4919866446 }}, /* 272 K */
+    {{ 29.1155619917, 29.2746691466, 20.7861495, 174.117545776, 35.9767535187, 33.4950687271 }}, /* 273 K */
+    {{ 29.1158394627, 29.2781896293, 20.7861495, 174.701365956, 36.0247671338, 33.4982021841 }}, /* 274 K */
+    {{ 29.1161215374, 29.2817675407, 20.7861495, 175.284872737, 36.0726995872, 33.5013871966 }}, /* 275 K */
+    {{ 29.1164084, 29.2854029554, 20.7861495, 175.868062198, 36.1205500477, 33.5046239269 }}, /* 276 K */
+    {{ 29.1167002379, 29.2890959306, 20.7861495, 176.450930423, 36.1683177182, 33.5079125195 }}, /* 277 K */
+    {{ 29.1169972411, 29.2928465076, 20.7861495, 177.033473505, 36.2160018347, 33.5112531012 }}, /* 278 K */
+    {{ 29.117299602, 29.2966547113, 20.7861495, 177.615687546, 36.2636016656, 33.5146457825 }}, /* 279 K */
+    {{ 29.1176075155, 29.3005205517, 20.7861495, 178.197568657, 36.3111165101, 33.5180906574 }}, /* 280 K */
+    {{ 29.1179211784, 29.3044440237, 20.7861495, 178.779112961, 36.3585456977, 33.5215878046 }}, /* 281 K */
+    {{ 29.1182407894, 29.3084251082, 20.7861495, 179.360316595, 36.4058885875, 33.5251372876 }}, /* 282 K */
+    {{ 29.1185665491, 29.3124637722, 20.7861495, 179.941175706, 36.4531445667, 33.5287391556 }}, /* 283 K */
+    {{ 29.1188986595, 29.3165599695, 20.7861495, 180.521686458, 36.5003130505, 33.5323934437 }}, /* 284 K */
+    {{ 29.1192373241, 29.3207136409, 20.7861495, 181.101845029, 36.5473934807, 33.5361001738 }}, /* 285 K */
+    {{ 29.1195827473, 29.324924715, 20.7861495, 181.681647612, 36.594385325, 33.5398593547 }}, /* 286 K */
+    {{ 29.119935135, 29.3291931085, 20.7861495, 182.261090417, 36.6412880766, 33.5436709827 }}, /* 287 K */
+    {{ 29.1202946936, 29.3335187265, 20.7861495, 182.840169674, 36.6881012531, 33.5475350424 }}, /* 288 K */
+    {{ 29.1206616306, 29.3379014632, 20.7861495, 183.418881628, 36.7348243958, 33.5514515065 }}, /* 289 K */
+    {{ 29.1210361539, 29.3423412019, 20.7861495, 183.997222545, 36.7814570692, 33.5554203367 }}, /* 290 K */
+    {{ 29.121418472, 29.3468378158, 20.7861495, 184.575188708, 36.82799886, 33.5594414842 }}, /* 291 K */
+    {{ 29.1218087937, 29.3513911681, 20.7861495, 185.152776422, 36.8744493767, 33.5635148896 }}, /* 292 K */
+    {{ 29.1222073281, 29.3560011124, 20.7861495, 185.729982014, 36.9208082489, 33.5676404837 }}, /* 293 K */
+    {{ 29.1226142844, 29.3606674932, 20.7861495, 186.306801829, 36.9670751266, 33.571818188 }}, /* 294 K */
+    {{ 29.123029872, 29.3653901462, 20.7861495, 186.883232236, 37.0132496796, 33.5760479145 }}, /* 295 K */
+    {{ 29.1234542998, 29.3701688984, 20.7861495, 187.459269626, 37.059331597, 33.5803295666 }}, /* 296 K */
+    {{ 29.1238877769, 29.3750035687, 20.7861495, 188.034910413, 37.1053205866, 33.5846630393 }}, /* 297 K */
+    {{ 29.1243305119, 29.3798939681, 20.7861495, 188.610151032, 37.1512163741, 33.5890482192 }}, /* 298 K */
+    {{ 29.1247827132, 29.3848399001, 20.7861495, 189.184987945, 37.1970187031, 33.5934849854 }}, /* 299 K */
+    {{ 29.1252445885, 29.3898411607, 20.7861495, 189.759417636, 37.2427273339, 33.5979732094 }}, /* 300 K */
+    {{ 29.1257163451, 29.3948975391, 20.7861495, 190.333436613, 37.2883420435, 33.6025127554 }}, /* 301 K */
+    {{ 29.1261981896, 29.4000088176, 20.7861495, 190.907041409, 37.333862625, 33.607103481 }}, /* 302 K */
+    {{ 29.1266903278, 29.4051747721, 20.7861495, 191.480228584, 37.3792888869, 33.6117452369 }}, /* 303 K */
+    {{ 29.1271929649, 29.4103951723, 20.7861495, 192.052994721, 37.4246206528, 33.6164378675 }}, /* 304 K */
+    {{ 29.1277063051, 29.4156697819, 20.7861495, 192.625336428, 37.4698577612, 33.6211812114 }}, /* 305 K */
+    {{ 29.1282305518, 29.4209983589, 20.7861495, 193.197250342, 37.5150000643, 33.6259751011 }}, /* 306 K */
+    {{ 29.128765907, 29.4263806558, 20.7861495, 193.768733124, 37.5600474285, 33.6308193636 }}, /* 307 K */
+    {{ 29.1293125722, 29.4318164199, 20.7861495, 194.339781461, 37.6049997333, 33.6357138207 }}, /* 308 K */
+    {{ 29.1298707473, 29.4373053932, 20.7861495, 194.910392067, 37.6498568712, 33.640658289 }}, /* 309 K */
+    {{ 29.1304406314, 29.4428473133, 20.7861495, 195.480561683, 37.6946187474, 33.6456525803 }}, /* 310 K */
+    {{ 29.131022422, 29.4484419127, 20.7861495, 196.050287077, 37.7392852789, 33.6506965018 }}, /* 311 K */
+    {{ 29.1316163156, 29.45408892, 20.7861495, 196.619565045, 37.7838563948, 33.6557898561 }}, /* 312 K */
+    {{ 29.1322225071, 29.4597880591, 20.7861495, 197.188392407, 37.8283320356, 33.6609324417 }}, /* 313 K */
+    {{ 29.1328411904, 29.4655390502, 20.7861495, 197.756766013, 37.8727121526, 33.6661240531 }}, /* 314 K */
+    {{ 29.1334725575, 29.4713416094, 20.7861495, 198.324682741, 37.9169967083, 33.6713644809 }}, /* 315 K */
+    {{ 29.1341167994, 29.4771954492, 20.7861495, 198.892139494, 37.9611856752, 33.6766535121 }}, /* 316 K */
+    {{ 29.1347741051, 29.4831002788, 20.7861495, 199.459133206, 38.005279036, 33.6819909303 }}, /* 317 K */
+    {{ 29.1354446626, 29.4890558037, 20.7861495, 200.025660834, 38.0492767834, 33.6873765156 }}, /* 318 K */
+    {{ 29.1361286577, 29.4950617264, 20.7861495, 200.591719368, 38.0931789191, 33.6928100452 }}, /* 319 K */
+    {{ 29.1368262752, 29.5011177465, 20.7861495, 201.157305822, 38.1369854545, 33.6982912932 }}, /* 320 K */
+    {{ 29.1375376977, 29.5072235606, 20.7861495, 201.72241724, 38.1806964094, 33.703820031 }}, /* 321 K */
+    {{ 29.1382631065, 29.5133788625, 20.7861495, 202.287050693, 38.2243118126, 33.7093960272 }}, /* 322 K */
+    {{ 29.1390026811, 29.5195833434, 20.7861495, 202.851203281, 38.267831701, 33.7150190481 }}, /* 323 K */
+    {{ 29.1397565992, 29.5258366923, 20.7861495, 203.41487213, 38.3112561197, 33.7206888575 }}, /* 324 K */
+    {{ 29.1405250367, 29.5321385957, 20.7861495, 203.978054397, 38.3545851214, 33.7264052171 }}, /* 325 K */
+    {{ 29.1413081679, 29.5384887379, 20.7861495, 204.540747263, 38.3978187666, 33.7321678864 }}, /* 326 K */
+    {{ 29.142106165, 29.5448868012, 20.7861495, 205.102947941, 38.440957123, 33.7379766229 }}, /* 327 K */
+    {{ 29.1429191986, 29.551332466, 20.7861495, 205.66465367, 38.4840002654, 33.7438311824 }}, /* 328 K */
+    {{ 29.1437474375, 29.5578254108, 20.7861495, 206.225861717, 38.5269482755, 33.7497313191 }}, /* 329 K */
+    {{ 29.1445910485, 29.5643653123, 20.7861495, 206.786569376, 38.5698012416, 33.7556767853 }}, /* 330 K */
+    {{ 29.1454501964, 29.5709518459, 20.7861495, 207.346773972, 38.6125592584, 33.7616673321 }}, /* 331 K */
+    {{ 29.1463250445, 29.5775846852, 20.7861495, 207.906472854, 38.6552224268, 33.767702709 }}, /* 332 K */
+    {{ 29.1472157537, 29.5842635026, 20.7861495, 208.465663401, 38.6977908538, 33.7737826645 }}, /* 333 K */
+    {{ 29.1481224833, 29.5909879691, 20.7861495, 209.02434302, 38.740264652, 33.7799069458 }}, /* 334 K */
+    {{ 29.1490453905, 29.5977577547, 20.7861495, 209.582509144, 38.7826439399, 33.7860752989 }}, /* 335 K */
+    {{ 29.1499846308, 29.604572528, 20.7861495, 210.140159235, 38.8249288411, 33.7922874692 }}, /* 336 K */
+    {{ 29.1509403574, 29.6114319569, 20.7861495, 210.697290783, 38.8671194847, 33.7985432009 }}, /* 337 K */
+    {{ 29.1519127218, 29.6183357081, 20.7861495, 211.253901304, 38.9092160046, 33.8048422376 }}, /* 338 K */
+    {{ 29.1529018734, 29.6252834478, 20.7861495, 211.809988341, 38.95121854, 33.8111843221 }}, /* 339 K */
+    {{ 29.1539079596, 29.6322748412, 20.7861495, 212.365549467, 38.9931272343, 33.8175691967 }}, /* 340 K */
+    {{ 29.1549311259, 29.6393095528, 20.7861495, 212.920582279, 39.0349422359, 33.8239966031 }}, /* 341 K */
+    {{ 29.1559715157, 29.6463872467, 20.7861495, 213.475084403, 39.0766636972, 33.8304662826 }}, /* 342 K */
+    {{ 29.1570292705, 29.6535075864, 20.7861495, 214.029053491, 39.1182917753, 33.8369779761 }}, /* 343 K */
+    {{ 29.1581045298, 29.6606702349, 20.7861495, 214.582487224, 39.1598266311, 33.8435314242 }}, /* 344 K */
+    {{ 29.1591974309, 29.6678748549, 20.7861495, 215.135383307, 39.2012684293, 33.8501263671 }}, /* 345 K */
+    {{ 29.1603081095, 29.6751211088, 20.7861495, 215.687739473, 39.2426173388, 33.8567625453 }}, /* 346 K */
+    {{ 29.1614366988, 29.6824086586, 20.7861495, 216.239553482, 39.2838735319, 33.8634396987 }}, /* 347 K */
+    {{ 29.1625833303, 29.6897371664, 20.7861495, 216.79082312, 39.3250371844, 33.8701575675 }}, /* 348 K */
+    {{ 29.1637481335, 29.6971062939, 20.7861495, 217.341546198, 39.3661084757, 33.8769158918 }}, /* 349 K */
+    {{ 29.1649312357, 29.7045157029, 20.7861495, 217.891720556, 39.4070875884, 33.8837144117 }}, /* 350 K */
+    {{ 29.1661327624, 29.7119650553, 20.7861495, 218.441344058, 39.4479747081, 33.8905528676 }}, /* 351 K */
+    {{ 29.1673528369, 29.7194540128, 20.7861495, 218.990414595, 39.4887700237, 33.897431 }}, /* 352 K */
+    {{ 29.1685915806, 29.7269822374, 20.7861495, 219.538930083, 39.5294737267, 33.9043485499 }}, /* 353 K */
+    {{ 29.169849113, 29.7345493912, 20.7861495, 220.086888464, 39.5700860117, 33.9113052581 }}, /* 354 K */
+    {{ 29.1711255514, 29.7421551365, 20.7861495, 220.634287706, 39.6106070757, 33.9183008663 }}, /* 355 K */
+    {{ 29.1724210111, 29.7497991359, 20.7861495, 221.181125802, 39.6510371186, 33.9253351162 }}, /* 356 K */
+    {{ 29.1737356057, 29.7574810523, 20.7861495, 221.727400771, 39.6913763425, 33.9324077502 }}, /* 357 K */
+    {{ 29.1750694464, 29.765200549, 20.7861495, 222.273110656, 39.7316249521, 33.939518511 }}, /* 358 K */
+    {{ 29.1764226428, 29.7729572896, 20.7861495, 222.818253526, 39.7717831542, 33.946667142 }}, /* 359 K */
+    {{ 29.1777953023, 29.7807509382, 20.7861495, 223.362827474, 39.8118511579, 33.9538533871 }}, /* 360 K */
+    {{ 29.1791875304, 29.7885811593, 20.7861495, 223.906830619, 39.8518291742, 33.9610769908 }}, /* 361 K */
+    {{ 29.1805994306, 29.7964476181, 20.7861495, 224.450261104, 39.8917174165, 33.9683376982 }}, /* 362 K */
+    {{ 29.1820311045, 29.8043499802, 20.7861495, 224.993117096, 39.9315160996, 33.9756352553 }}, /* 363 K */
+    {{ 29.1834826517, 29.8122879119, 20.7861495, 225.535396787, 39.9712254405, 33.9829694085 }}, /* 364 K */
+    {{ 29.1849541699, 29.8202610799, 20.7861495, 226.077098393, 40.0108456579, 33.9903399052 }}, /* 365 K */
+    {{ 29.1864457547, 29.828269152, 20.7861495, 226.618220153, 40.0503769719, 33.9977464935 }}, /* 366 K */
+    {{ 29.1879575001, 29.8363117962, 20.7861495, 227.158760332, 40.0898196046, 34.0051889224 }}, /* 367 K */
+    {{ 29.1894894978, 29.8443886817, 20.7861495, 227.698717216, 40.1291737791, 34.0126669416 }}, /* 368 K */
+    {{ 29.191041838, 29.8524994781, 20.7861495, 228.238089118, 40.1684397204, 34.0201803018 }}, /* 369 K */
+    {{ 29.1926146085, 29.8606438559, 20.7861495, 228.776874371, 40.2076176547, 34.0277287545 }}, /* 370 K */
+    {{ 29.1942078957, 29.8688214866, 20.7861495, 229.315071333, 40.2467078093, 34.0353120524 }}, /* 371 K */
+    {{ 29.1958217838, 29.8770320422, 20.7861495, 229.852678385, 40.2857104129, 34.0429299487 }}, /* 372 K */
+    {{ 29.1974563552, 29.885275196, 20.7861495, 230.389693932, 40.3246256955, 34.0505821979 }}, /* 373 K */
+    {{ 29.1991116904, 29.8935506218, 20.7861495, 230.926116399, 40.3634538878, 34.0582685556 }}, /* 374 K */
+    {{ 29.2007878683, 29.9018579945, 20.7861495, 231.461944236, 40.402195222, 34.065988778 }}, /* 375 K */
+    {{ 29.2024849655, 29.91019699, 20.7861495, 231.997175916, 40.4408499308, 34.0737426228 }}, /* 376 K */
+    {{ 29.2042030572, 29.9185672852, 20.7861495, 232.531809931, 40.4794182481, 34.0815298486 }}, /* 377 K */
+    {{ 29.2059422165, 29.9269685577, 20.7861495, 233.0658448, 40.5179004087, 34.0893502148 }}, /* 378 K */
+    {{ 29.2077025147, 29.9354004865, 20.7861495, 233.59927906, 40.5562966479, 34.0972034825 }}, /* 379 K */
+    {{ 29.2094840215, 29.9438627514, 20.7861495, 234.132111272, 40.594607202, 34.1050894133 }}, /* 380 K */
+    {{ 29.2112868045, 29.9523550332, 20.7861495, 234.664340017, 40.6328323079, 34.1130077704 }}, /* 381 K */
+    {{ 29.2131109299, 29.9608770141, 20.7861495, 235.195963901, 40.6709722032, 34.1209583178 }}, /* 382 K */
+    {{ 29.2149564617, 29.9694283769, 20.7861495, 235.726981547, 40.709027126, 34.1289408211 }}, /* 383 K */
+    {{ 29.2168234625, 29.978008806, 20.7861495, 236.257391604, 40.746997315, 34.1369550466 }}, /* 384 K */
+    {{ 29.2187119929, 29.9866179866, 20.7861495, 236.787192737, 40.7848830093, 34.1450007621 }}, /* 385 K */
+    {{ 29.220622112, 29.9952556052, 20.7861495, 237.316383637, 40.8226844485, 34.1530777366 }}, /* 386 K */
+    {{ 29.2225538768, 30.0039213493, 20.7861495, 237.844963012, 40.8604018728, 34.1611857402 }}, /* 387 K */
+    {{ 29.224507343, 30.0126149078, 20.7861495, 238.372929593, 40.8980355223, 34.1693245442 }}, /* 388 K */
+    {{ 29.2264825644, 30.0213359705, 20.7861495, 238.90028213, 40.935585638, 34.1774939214 }}, /* 389 K */
+    {{ 29.2284795931, 30.0300842286, 20.7861495, 239.427019395, 40.9730524607, 34.1856936455 }}, /* 390 K */
+    {{ 29.2304984794, 30.0388593744, 20.7861495, 239.95314018, 41.0104362316, 34.1939234919 }}, /* 391 K */
+    {{ 29.2325392723, 30.0476611015, 20.7861495, 240.478643295, 41.0477371922, 34.2021832368 }}, /* 392 K */
+    {{ 29.2346020188, 30.0564891048, 20.7861495, 241.003527572, 41.084955584, 34.210472658 }}, /* 393 K */
+    {{ 29.2366867643, 30.0653430802, 20.7861495, 241.527791862, 41.1220916488, 34.2187915344 }}, /* 394 K */
+    {{ 29.2387935528, 30.074222725, 20.7861495, 242.051435037, 41.1591456284, 34.2271396465 }}, /* 395 K */
+    {{ 29.2409224263, 30.0831277379, 20.7861495, 242.574455986, 41.1961177647, 34.2355167757 }}, /* 396 K */
+    {{ 29.2430734256, 30.0920578185, 20.7861495, 243.096853619, 41.2330082995, 34.243922705 }}, /* 397 K */
+    {{ 29.2452465896, 30.1010126681, 20.7861495, 243.618626865, 41.2698174747, 34.2523572186 }}, /* 398 K */
+    {{ 29.2474419558, 30.1099919891, 20.7861495, 244.139774673, 41.3065455323, 34.260820102 }}, /* 399 K */
+    {{ 29.24965956, 30.118995485, 20.7861495, 244.660296008, 41.3431927139, 34.2693111421 }}, /* 400 K */
+    {{ 29.2518994365, 30.128022861, 20.7861495, 245.180189857, 41.3797592613, 34.2778301271 }}, /* 401 K */
+    {{ 29.254161618, 30.1370738234, 20.7861495, 245.699455224, 41.416245416, 34.2863768466 }}, /* 402 K */
+    {{ 29.2564461358, 30.1461480797, 20.7861495, 246.218091131, 41.4526514196, 34.2949510914 }}, /* 403 K */
+    {{ 29.2587530195, 30.155245339, 20.7861495, 246.73609662, 41.4889775131, 34.3035526537 }}, /* 404 K */
+    {{ 29.2610822973, 30.1643653114, 20.7861495, 247.253470749, 41.5252239378, 34.312181327 }}, /* 405 K */
+    {{ 29.2634339958, 30.1735077088, 20.7861495, 247.770212597, 41.5613909344, 34.3208369064 }}, /* 406 K */
+    {{ 29.2658081404, 30.1826722439, 20.7861495, 248.286321258, 41.5974787435, 34.329519188 }}, /* 407 K */
+    {{ 29.2682047546, 30.1918586311, 20.7861495, 248.801795845, 41.6334876054, 34.3382279694 }}, /* 408 K */
+    {{ 29.2706238607, 30.2010665861, 20.7861495, 249.316635489, 41.6694177601, 34.3469630496 }}, /* 409 K */
+    {{ 29.2730654796, 30.2102958259, 20.7861495, 249.830839337, 41.7052694474, 34.355724229 }}, /* 410 K */
+    {{ 29.2755296305, 30.2195460689, 20.7861495, 250.344406556, 41.7410429064, 34.3645113091 }}, /* 411 K */
+    {{ 29.2780163315, 30.2288170348, 20.7861495, 250.857336328, 41.7767383764, 34.3733240929 }}, /* 412 K */
+    {{ 29.2805255991, 30.2381084446, 20.7861495, 251.369627852, 41.8123560958, 34.382162385 }}, /* 413 K */
+    {{ 29.2830574483, 30.247420021, 20.7861495, 251.881280346, 41.8478963029, 34.3910259909 }}, /* 414 K */
+    {{ 29.285611893, 30.2567514877, 20.7861495, 252.392293042, 41.8833592355, 34.3999147177 }}, /* 415 K */
+    {{ 29.2881889454, 30.2661025699, 20.7861495, 252.90266519, 41.918745131, 34.408828374 }}, /* 416 K */
+    {{ 29.2907886166, 30.2754729942, 20.7861495, 253.412396058, 41.9540542262, 34.4177667695 }}, /* 417 K */
+    {{ 29.2934109163, 30.2848624886, 20.7861495, 253.921484928, 41.9892867577, 34.4267297152 }}, /* 418 K */
+    {{ 29.2960558526, 30.2942707824, 20.7861495, 254.4299311, 42.0244429615, 34.4357170238 }}, /* 419 K */
+    {{ 29.2987234327, 30.3036976064, 20.7861495, 254.937733888, 42.0595230729, 34.444728509 }}, /* 420 K */
+    {{ 29.3014136622, 30.3131426927, 20.7861495, 255.444892625, 42.094527327, 34.453763986 }}, /* 421 K */
+    {{ 29.3041265453, 30.3226057747, 20.7861495, 255.951406658, 42.1294559581, 34.4628232713 }}, /* 422 K */
+    {{ 29.3068620853, 30.3320865873, 20.7861495, 256.457275349, 42.1643092002, 34.4719061829 }}, /* 423 K */
+    {{ 29.3096202839, 30.3415848668, 20.7861495, 256.962498077, 42.1990872866, 34.4810125399 }}, /* 424 K */
+    {{ 29.3124011415, 30.3511003508, 20.7861495, 257.467074237, 42.23379045, 34.4901421628 }}, /* 425 K */
+    {{ 29.3152046575, 30.3606327783, 20.7861495, 257.971003238, 42.2684189227, 34.4992948736 }}, /* 426 K */
+    {{ 29.3180308299, 30.3701818898, 20.7861495, 258.474284505, 42.3029729362, 34.5084704954 }}, /* 427 K */
+    {{ 29.3208796554, 30.3797474269, 20.7861495, 258.976917477, 42.3374527214, 34.5176688528 }}, /* 428 K */
+    {{ 29.3237511297, 30.389329133, 20.7861495, 259.478901609, 42.3718585088, 34.5268897716 }}, /* 429 K */
+    {{ 29.3266452471, 30.3989267524, 20.7861495, 259.980236371, 42.4061905281, 34.536133079 }}, /* 430 K */
+    {{ 29.3295620007, 30.4085400312, 20.7861495, 260.480921248, 42.4404490084, 34.5453986036 }}, /* 431 K */
+    {{ 29.3325013825, 30.4181687167, 20.7861495, 260.980955739, 42.4746341782, 34.554686175 }}, /* 432 K */
+    {{ 29.3354633833, 30.4278125575, 20.7861495, 261.480339357, 42.5087462651, 34.5639956245 }}, /* 433 K */
+    {{ 29.3384479928, 30.4374713037, 20.7861495, 261.979071629, 42.5427854964, 34.5733267844 }}, /* 434 K */
+    {{ 29.3414551995, 30.4471447067, 20.7861495, 262.477152099, 42.5767520985, 34.5826794886 }}, /* 435 K */
+    {{ 29.3444849906, 30.4568325194, 20.7861495, 262.974580323, 42.6106462971, 34.5920535719 }}, /* 436 K */
+    {{ 29.3475373524, 30.4665344959, 20.7861495, 263.471355871, 42.6444683174, 34.6014488707 }}, /* 437 K */
+    {{ 29.35061227, 30.4762503918, 20.7861495, 263.967478326, 42.6782183837, 34.6108652226 }}, /* 438 K */
+    {{ 29.3537097274, 30.485979964, 20.7861495, 264.462947289, 42.7118967197, 34.6203024664 }}, /* 439 K */
+    {{ 29.3568297075, 30.4957229708, 20.7861495, 264.957762369, 42.7455035483, 34.6297604424 }}, /* 440 K */
+    {{ 29.3599721921, 30.5054791718, 20.7861495, 265.451923193, 42.7790390917, 34.6392389919 }}, /* 441 K */
+    {{ 29.363137162, 30.515248328, 20.7861495, 265.945429399, 42.8125035714, 34.6487379577 }}, /* 442 K */
+    {{ 29.3663245967, 30.5250302019, 20.7861495, 266.438280639, 42.8458972083, 34.6582571837 }}, /* 443 K */
+    {{ 29.3695344751, 30.5348245571, 20.7861495, 266.930476579, 42.8792202223, 34.667796515 }}, /* 444 K */
+    {{ 29.3727667745, 30.5446311587, 20.7861495, 267.422016897, 42.9124728327, 34.6773557982 }}, /* 445 K */
+    {{ 29.3760214717, 30.5544497731, 20.7861495, 267.912901284, 42.945655258, 34.686934881 }}, /* 446 K */
+    {{ 29.3792985421, 30.5642801681, 20.7861495, 268.403129445, 42.9787677161, 34.6965336123 }}, /* 447 K */
+    {{ 29.3825979603, 30.5741221129, 20.7861495, 268.892701097, 43.0118104238, 34.7061518423 }}, /* 448 K */
+    {{ 29.3859196997, 30.5839753778, 20.7861495, 269.38161597, 43.0447835975, 34.7157894223 }}, /* 449 K */
+    {{ 29.3892637331, 30.5938397347, 20.7861495, 269.869873806, 43.0776874526, 34.7254462051 }}, /* 450 K */
+    {{ 29.3926300319, 30.6037149567, 20.7861495, 270.35747436, 43.1105222038, 34.7351220445 }}, /* 451 K */
+    {{ 29.3960185667, 30.6136008183, 20.7861495, 270.844417399, 43.143288065, 34.7448167954 }}, /* 452 K */
+    {{ 29.3994293073, 30.6234970952, 20.7861495, 271.330702703, 43.1759852494, 34.7545303143 }}, /* 453 K */
+    {{ 29.4028622222, 30.6334035646, 20.7861495, 271.816330063, 43.2086139693, 34.7642624585 }}, /* 454 K */
+    {{ 29.4063172794, 30.6433200049, 20.7861495, 272.301299283, 43.2411744363, 34.7740130867 }}, /* 455 K */
+    {{ 29.4097944455, 30.6532461959, 20.7861495, 272.785610179, 43.2736668611, 34.7837820587 }}, /* 456 K */
+    {{ 29.4132936867, 30.6631819185, 20.7861495, 273.269262578, 43.3060914536, 34.7935692356 }}, /* 457 K */
+    {{ 29.4168149678, 30.6731269553, 20.7861495, 273.752256319, 43.3384484232, 34.8033744796 }}, /* 458 K */
+    {{ 29.4203582532, 30.6830810898, 20.7861495, 274.234591254, 43.370737978, 34.8131976539 }}, /* 459 K */
+    {{ 29.4239235059, 30.6930441071, 20.7861495, 274.716267244, 43.4029603258, 34.8230386232 }}, /* 460 K */
+    {{ 29.4275106884, 30.7030157934, 20.7861495, 275.197284163, 43.4351156733, 34.8328972531 }}, /* 461 K */
+    {{ 29.4311197622, 30.7129959363, 20.7861495, 275.677641897, 43.4672042263, 34.8427734105 }}, /* 462 K */
+    {{ 29.4347506879, 30.7229843247, 20.7861495, 276.157340342, 43.4992261901, 34.8526669632 }}, /* 463 K */
+    {{ 29.4384034255, 30.7329807487, 20.7861495, 276.636379406, 43.5311817691, 34.8625777805 }}, /* 464 K */
+    {{ 29.4420779338, 30.7429849998, 20.7861495, 277.114759008, 43.5630711666, 34.8725057325 }}, /* 465 K */
+    {{ 29.4457741711, 30.7529968706, 20.7861495, 277.592479076, 43.5948945855, 34.8824506907 }}, /* 466 K */
+    {{ 29.4494920946, 30.7630161551, 20.7861495, 278.069539553, 43.6266522276, 34.8924125274 }}, /* 467 K */
+    {{ 29.4532316609, 30.7730426486, 20.7861495, 278.545940388, 43.6583442941, 34.9023911163 }}, /* 468 K */
+    {{ 29.4569928258, 30.7830761476, 20.7861495, 279.021681545, 43.6899709851, 34.9123863321 }}, /* 469 K */
+    {{ 29.4607755442, 30.7931164499, 20.7861495, 279.496762995, 43.7215325002, 34.9223980505 }}, /* 470 K */
+    {{ 29.4645797703, 30.8031633545, 20.7861495, 279.971184723, 43.753029038, 34.9324261485 }}, /* 471 K */
+    {{ 29.4684054574, 30.8132166617, 20.7861495, 280.444946721, 43.7844607962, 34.9424705039 }}, /* 472 K */
+    {{ 29.4722525583, 30.823276173, 20.7861495, 280.918048993, 43.8158279719, 34.9525309958 }}, /* 473 K */
+    {{ 29.4761210248, 30.8333416912, 20.7861495, 281.390491554, 43.8471307613, 34.9626075044 }}, /* 474 K */
+    {{ 29.480010808, 30.8434130203, 20.7861495, 281.862274427, 43.8783693597, 34.9726999107 }}, /* 475 K */
+    {{ 29.4839218585, 30.8534899655, 20.7861495, 282.333397648, 43.9095439616, 34.9828080971 }}, /* 476 K */
+    {{ 29.4878541258, 30.8635723334, 20.7861495, 282.803861261, 43.9406547609, 34.9929319468 }}, /* 477 K */
+    {{ 29.491807559, 30.8736599316, 20.7861495, 283.273665319, 43.9717019504, 35.0030713441 }}, /* 478 K */
+    {{ 29.4957821064, 30.883752569, 20.7861495, 283.742809887, 44.0026857221, 35.0132261744 }}, /* 479 K */
+    {{ 29.4997777155, 30.8938500558, 20.7861495, 284.211295039, 44.0336062674, 35.023396324 }}, /* 480 K */
+    {{ 29.5037943332, 30.9039522033, 20.7861495, 284.679120858, 44.0644637767, 35.0335816804 }}, /* 481 K */
+    {{ 29.5078319057, 30.9140588241, 20.7861495, 285.146287438, 44.0952584397, 35.043782132 }}, /* 482 K */
+    {{ 29.5118903785, 30.9241697319, 20.7861495, 285.612794879, 44.1259904451, 35.0539975682 }}, /* 483 K */
+    {{ 29.5159696967, 30.9342847417, 20.7861495, 286.078643296, 44.1566599811, 35.0642278795 }}, /* 484 K */
+    {{ 29.5200698042, 30.9444036696, 20.7861495, 286.543832808, 44.1872672347, 35.0744729574 }}, /* 485 K */
+    {{ 29.5241906448, 30.954526333, 20.7861495, 287.008363547, 44.2178123924, 35.0847326942 }}, /* 486 K */
+    {{ 29.5283321613, 30.9646525503, 20.7861495, 287.472235651, 44.2482956398, 35.0950069833 }}, /* 487 K */
+    {{ 29.5324942962, 30.9747821413, 20.7861495, 287.935449269, 44.2787171616, 35.1052957192 }}, /* 488 K */
+    {{ 29.5366769909, 30.9849149269, 20.7861495, 288.39800456, 44.3090771418, 35.1155987971 }}, /* 489 K */
+    {{ 29.5408801867, 30.995050729, 20.7861495, 288.85990169, 44.3393757635, 35.1259161135 }}, /* 490 K */
+    {{ 29.545103824, 31.0051893708, 20.7861495, 289.321140833, 44.3696132092, 35.1362475657 }}, /* 491 K */
+    {{ 29.5493478426, 31.0153306768, 20.7861495, 289.781722175, 44.3997896602, 35.1465930517 }}, /* 492 K */
+    {{ 29.5536121818, 31.0254744724, 20.7861495, 290.241645908, 44.4299052974, 35.1569524708 }}, /* 493 K */
+    {{ 29.5578967804, 31.0356205844, 20.7861495, 290.700912234, 44.4599603007, 35.1673257232 }}, /* 494 K */
+    {{ 29.5622015765, 31.0457688405, 20.7861495, 291.159521363, 44.4899548493, 35.1777127098 }}, /* 495 K */
+    {{ 29.5665265075, 31.0559190696, 20.7861495, 291.617473514, 44.5198891214, 35.1881133326 }}, /* 496 K */
+    {{ 29.5708715106, 31.0660711019, 20.7861495, 292.074768912, 44.5497632947, 35.1985274944 }}, /* 497 K */
+    {{ 29.5752365221, 31.0762247686, 20.7861495, 292.531407795, 44.5795775459, 35.2089550992 }}, /* 498 K */
+    {{ 29.5796214779, 31.086379902, 20.7861495, 292.987390404, 44.609332051, 35.2193960515 }}, /* 499 K */
+    {{ 29.5840263135, 31.0965363356, 20.7861495, 293.442716992, 44.6390269851, 35.229850257 }}, /* 500 K */
+    {{ 29.5884509637, 31.106693904, 20.7861495, 293.897387819, 44.6686625226, 35.2403176222 }}, /* 501 K */
+    {{ 29.5928953628, 31.1168524428, 20.7861495, 294.351403152, 44.6982388371, 35.2507980543 }}, /* 502 K */
+    {{ 29.5973594446, 31.127011789, 20.7861495, 294.804763268, 44.7277561015, 35.2612914617 }}, /* 503 K */
+    {{ 29.6018431424, 31.1371717803, 20.7861495, 295.257468449, 44.7572144878, 35.2717977534 }}, /* 504 K */
+    {{ 29.606346389, 31.1473322559, 20.7861495, 295.709518988, 44.7866141671, 35.2823168395 }}, /* 505 K */
+    {{ 29.6108691168, 31.1574930558, 20.7861495, 296.160915184, 44.8159553102, 35.2928486308 }}, /* 506 K */
+    {{ 29.6154112575, 31.1676540211, 20.7861495, 296.611657344, 44.8452380865, 35.303393039 }}, /* 507 K */
+    {{ 29.6199727425, 31.1778149943, 20.7861495, 297.061745782, 44.8744626651, 35.3139499765 }}, /* 508 K */
+    {{ 29.6245535028, 31.1879758186, 20.7861495, 297.511180821, 44.9036292141, 35.3245193569 }}, /* 509 K */
+    {{ 29.6291534686, 31.1981363384, 20.7861495, 297.959962791, 44.932737901, 35.3351010943 }}, /* 510 K */
+    {{ 29.6337725701, 31.2082963994, 20.7861495, 298.408092028, 44.9617888924, 35.3456951036 }}, /* 511 K */
+    {{ 29.6384107367, 31.2184558479, 20.7861495, 298.855568877, 44.9907823541, 35.3563013009 }}, /* 512 K */
+    {{ 29.6430678974, 31.2286145318, 20.7861495, 299.30239369, 45.0197184512, 35.3669196027 }}, /* 513 K */
+    {{ 29.6477439809, 31.2387722995, 20.7861495, 299.748566825, 45.0485973482, 35.3775499266 }}, /* 514 K */
+    {{ 29.6524389155, 31.248929001, 20.7861495, 300.19408865, 45.0774192087, 35.3881921907 }}, /* 515 K */
+    {{ 29.6571526289, 31.2590844869, 20.7861495, 300.638959537, 45.1061841954, 35.3988463143 }}, /* 516 K */
+    {{ 29.6618850485, 31.2692386092, 20.7861495, 301.083179868, 45.1348924705, 35.4095122171 }}, /* 517 K */
+    {{ 29.6666361013, 31.2793912206, 20.7861495, 301.526750028, 45.1635441954, 35.4201898197 }}, /* 518 K */
+    {{ 29.6714057138, 31.2895421751, 20.7861495, 301.969670413, 45.1921395306, 35.4308790438 }}, /* 519 K */
+    {{ 29.6761938122, 31.2996913276, 20.7861495, 302.411941424, 45.2206786361, 35.4415798113 }}, /* 520 K */
+    {{ 29.6810003222, 31.309838534, 20.7861495, 302.853563468, 45.249161671, 35.4522920453 }}, /* 521 K */
+    {{ 29.6858251693, 31.3199836514, 20.7861495, 303.294536961, 45.2775887937, 35.4630156695 }}, /* 522 K */
+    {{ 29.6906682785, 31.3301265377, 20.7861495, 303.734862324, 45.3059601619, 35.4737506083 }}, /* 523 K */
+    {{ 29.6955295744, 31.340267052, 20.7861495, 304.174539985, 45.3342759324, 35.484496787 }}, /* 524 K */
+    {{ 29.7004089814, 31.3504050541, 20.7861495, 304.613570379, 45.3625362617, 35.4952541316 }}, /* 525 K */
+    {{ 29.7053064233, 31.3605404053, 20.7861495, 305.051953947, 45.390741305, 35.5060225687 }}, /* 526 K */
+    {{ 29.7102218237, 31.3706729673, 20.7861495, 305.489691136, 45.4188912173, 35.5168020258 }}, /* 527 K */
+    {{ 29.7151551059, 31.3808026034, 20.7861495, 305.9267824, 45.4469861525, 35.5275924309 }}, /* 528 K */
+    {{ 29.7201061928, 31.3909291774, 20.7861495, 306.3632282, 45.4750262641, 35.538393713 }}, /* 529 K */
+    {{ 29.7250750069, 31.4010525543, 20.7861495, 306.799029003, 45.5030117046, 35.5492058016 }}, /* 530 K */
+    {{ 29.7300614704, 31.4111726001, 20.7861495, 307.234185282, 45.530942626, 35.5600286271 }}, /* 531 K */
+    {{ 29.7350655052, 31.4212891817, 20.7861495, 307.668697515, 45.5588191795, 35.5708621203 }}, /* 532 K */
+    {{ 29.7400870331, 31.431402167, 20.7861495, 308.102566187, 45.5866415156, 35.581706213 }}, /* 533 K */
+    {{ 29.7451259752, 31.441511425, 20.7861495, 308.535791791, 45.6144097842, 35.5925608375 }}, /* 534 K */
+    {{ 29.7501822525, 31.4516168253, 20.7861495, 308.968374823, 45.6421241343, 35.6034259269 }}, /* 535 K */
+    {{ 29.7552557857, 31.4617182389, 20.7861495, 309.400315787, 45.6697847143, 35.6143014148 }}, /* 536 K */
+    {{ 29.7603464952, 31.4718155375, 20.7861495, 309.831615192, 45.6973916722, 35.6251872357 }}, /* 537 K */
+    {{ 29.7654543011, 31.4819085937, 20.7861495, 310.262273553, 45.7249451548, 35.6360833246 }}, /* 538 K */
+    {{ 29.7705791232, 31.4919972812, 20.7861495, 310.69229139, 45.7524453085, 35.6469896172 }}, /* 539 K */
+    {{ 29.7757208812, 31.5020814747, 20.7861495, 311.121669231, 45.7798922791, 35.65790605 }}, /* 540 K */
+    {{ 29.7808794942, 31.5121610495, 20.7861495, 311.550407608, 45.8072862115, 35.6688325599 }}, /* 541 K */
+    {{ 29.7860548812, 31.5222358822, 20.7861495, 311.978507058, 45.8346272501, 35.6797690845 }}, /* 542 K */
+    {{ 29.7912469611, 31.5323058502, 20.7861495, 312.405968126, 45.8619155386, 35.6907155623 }}, /* 543 K */
+    {{ 29.7964556524, 31.5423708318, 20.7861495, 312.832791361, 45.8891512199, 35.701671932 }}, /* 544 K */
+    {{ 29.8016808732, 31.5524307062, 20.7861495, 313.258977317, 45.9163344364, 35.7126381333 }}, /* 545 K */
+    {{ 29.8069225416, 31.5624853535, 20.7861495, 313.684526555, 45.9434653297, 35.7236141064 }}, /* 546 K */
+    {{ 29.8121805754, 31.5725346548, 20.7861495, 314.109439639, 45.9705440409, 35.734599792 }}, /* 547 K */
+    {{ 29.8174548921, 31.5825784921, 20.7861495, 314.533717142, 45.9975707103, 35.7455951316 }}, /* 548 K */
+    {{ 29.8227454091, 31.5926167483, 20.7861495, 314.957359639, 46.0245454776, 35.7566000671 }}, /* 549 K */
+    {{ 29.8280520433, 31.6026493071, 20.7861495, 315.380367711, 46.0514684819, 35.7676145412 }}, /* 550 K */
+    {{ 29.8333747118, 31.6126760531, 20.7861495, 315.802741946, 46.0783398615, 35.778638497 }}, /* 551 K */
+    {{ 29.838713331, 31.6226968721, 20.7861495, 316.224482936, 46.1051597543, 35.7896718785 }}, /* 552 K */
+    {{ 29.8440678177, 31.6327116503, 20.7861495, 316.645591277, 46.1319282973, 35.8007146299 }}, /* 553 K */
+    {{ 29.8494380878, 31.6427202752, 20.7861495, 317.066067572, 46.1586456271, 35.8117666962 }}, /* 554 K */
+    {{ 29.8548240576, 31.652722635, 20.7861495, 317.485912427, 46.1853118794, 35.8228280229 }}, /* 555 K */
+    {{ 29.8602256429, 31.6627186187, 20.7861495, 317.905126456, 46.2119271896, 35.8338985562 }}, /* 556 K */
+    {{ 29.8656427593, 31.6727081163, 20.7861495, 318.323710275, 46.2384916921, 35.8449782427 }}, /* 557 K */
+    {{ 29.8710753224, 31.6826910187, 20.7861495, 318.741664506, 46.265005521, 35.8560670297 }}, /* 558 K */
+    {{ 29.8765232474, 31.6926672175, 20.7861495, 319.158989777, 46.2914688097, 35.8671648649 }}, /* 559 K */
+    {{ 29.8819864496, 31.7026366054, 20.7861495, 319.575686718, 46.3178816907, 35.8782716966 }}, /* 560 K */
+    {{ 29.8874648439, 31.7125990756, 20.7861495, 319.991755967, 46.3442442964, 35.8893874738 }}, /* 561 K */
+    {{ 29.8929583451, 31.7225545226, 20.7861495, 320.407198164, 46.370556758, 35.9005121458 }}, /* 562 K */
+    {{ 29.8984668678, 31.7325028414, 20.7861495, 320.822013957, 46.3968192067, 35.9116456626 }}, /* 563 K */
+    {{ 29.9039903266, 31.742443928, 20.7861495, 321.236203994, 46.4230317725, 35.9227879746 }}, /* 564 K */
+    {{ 29.9095286359, 31.7523776791, 20.7861495, 321.649768933, 46.4491945853, 35.9339390329 }}, /* 565 K */
+    {{ 29.9150817097, 31.7623039925, 20.7861495, 322.062709431, 46.4753077741, 35.945098789 }}, /* 566 K */
+    {{ 29.9206494622, 31.7722227667, 20.7861495, 322.475026154, 46.5013714674, 35.9562671949 }}, /* 567 K */
+    {{ 29.9262318074, 31.7821339008, 20.7861495, 322.886719771, 46.5273857931, 35.9674442031 }}, /* 568 K */
+    {{ 29.931828659, 31.7920372952, 20.7861495, 323.297790954, 46.5533508785, 35.9786297668 }}, /* 569 K */
+    {{ 29.9374399306, 31.8019328506, 20.7861495, 323.708240382, 46.5792668502, 35.9898238394 }}, /* 570 K */
+    {{ 29.9430655359, 31.811820469, 20.7861495, 324.118068736, 46.6051338346, 36.001026375 }}, /* 571 K */
+    {{ 29.9487053882, 31.821700053, 20.7861495, 324.527276703, 46.630951957, 36.0122373281 }}, /* 572 K */
+    {{ 29.954359401, 31.8315715058, 20.7861495, 324.935864974, 46.6567213425, 36.0234566538 }}, /* 573 K */
+    {{ 29.9600274873, 31.8414347318, 20.7861495, 325.343834242, 46.6824421155, 36.0346843076 }}, /* 574 K */
+    {{ 29.9657095603, 31.851289636, 20.7861495, 325.751185208, 46.7081143998, 36.0459202454 }}, /* 575 K */
+    {{ 29.971405533, 31.8611361242, 20.7861495, 326.157918575, 46.7337383187, 36.0571644238 }}, /* 576 K */
+    {{ 29.9771153183, 31.8709741031, 20.7861495, 326.56403505, 46.7593139948, 36.0684167995 }}, /* 577 K */
+    {{ 29.982838829, 31.88080348, 20.7861495, 326.969535345, 46.7848415504, 36.0796773301 }}, /* 578 K */
+    {{ 29.9885759778, 31.8906241632, 20.7861495, 327.374420175, 46.8103211068, 36.0909459733 }}, /* 579 K */
+    {{ 29.9943266774, 31.9004360617, 20.7861495, 327.77869026, 46.8357527853, 36.1022226876 }}, /* 580 K */
+    {{ 30.0000908402, 31.9102390853, 20.7861495, 328.182346323, 46.8611367063, 36.1135074315 }}, /* 581 K */
+    {{ 30.0058683789, 31.9200331445, 20.7861495, 328.585389093, 46.8864729895, 36.1248001643 }}, /* 582 K */
+    {{ 30.0116592058, 31.9298181507, 20.7861495, 328.9878193, 46.9117617546, 36.1361008457 }}, /* 583 K */
+    {{ 30.0174632331, 31.9395940161, 20.7861495, 329.38963768, 46.9370031201, 36.1474094358 }}, /* 584 K */
+    {{ 30.0232803733, 31.9493606534, 20.7861495, 329.790844972, 46.9621972045, 36.158725895 }}, /* 585 K */
+    {{ 30.0291105385, 31.9591179765, 20.7861495, 330.19144192, 46.9873441255, 36.1700501843 }}, /* 586 K */
+    {{ 30.0349536409, 31.9688658996, 20.7861495, 330.591429269, 47.0124440002, 36.1813822651 }}, /* 587 K */
+    {{ 30.0408095925, 31.978604338, 20.7861495, 330.990807771, 47.0374969454, 36.1927220991 }}, /* 588 K */
+    {{ 30.0466783054, 31.9883332077, 20.7861495, 331.38957818, 47.0625030772, 36.2040696485 }}, /* 589 K */
+    {{ 30.0525596917, 31.9980524253, 20.7861495, 331.787741253, 47.0874625112, 36.215424876 }}, /* 590 K */
+    {{ 30.0584536632, 32.0077619083, 20.7861495, 332.185297753, 47.1123753625, 36.2267877446 }}, /* 591 K */
+    {{ 30.064360132, 32.0174615749, 20.7861495, 332.582248444, 47.1372417457, 36.2381582177 }}, /* 592 K */
+    {{ 30.0702790098, 32.0271513441, 20.7861495, 332.978594096, 47.1620617748, 36.2495362591 }}, /* 593 K */
+    {{ 30.0762102086, 32.0368311354, 20.7861495, 333.37433548, 47.1868355634, 36.2609218331 }}, /* 594 K */
+    {{ 30.0821536402, 32.0465008695, 20.7861495, 333.769473372, 47.2115632244, 36.2723149043 }}, /* 595 K */
+    {{ 30.0881092163, 32.0561604673, 20.7861495, 334.164008552, 47.2362448705, 36.2837154376 }}, /* 596 K */
+    {{ 30.0940768489, 32.0658098508, 20.7861495, 334.557941802, 47.2608806137, 36.2951233985 }}, /* 597 K */
+    {{ 30.1000564496, 32.0754489427, 20.7861495, 334.951273909, 47.2854705654, 36.3065387527 }}, /* 598 K */
+    {{ 30.1060479302, 32.0850776663, 20.7861495, 335.344005661, 47.3100148366, 36.3179614664 }}, /* 599 K */
+    {{ 30.1120512024, 32.0946959457, 20.7861495, 335.736137853, 47.3345135379, 36.329391506 }}, /* 600 K */
+    {{ 30.1180661781, 32.1043037056, 20.7861495, 336.12767128, 47.3589667792, 36.3408288385 }}, /* 601 K */
+    {{ 30.1240927688, 32.1139008715, 20.7861495, 336.518606741, 47.3833746702, 36.3522734311 }}, /* 602 K */
+    {{ 30.1301308865, 32.1234873698, 20.7861495, 336.90894504, 47.4077373198, 36.3637252514 }}, /* 603 K */
+    {{ 30.1361804428, 32.1330631273, 20.7861495, 337.298686981, 47.4320548366, 36.3751842673 }}, /* 604 K */
+    {{ 30.1422413494, 32.1426280716, 20.7861495, 337.687833376, 47.4563273287, 36.3866504472 }}, /* 605 K */
+    {{ 30.1483135182, 32.1521821312, 20.7861495, 338.076385035, 47.4805549036, 36.3981237597 }}, /* 606 K */
+    {{ 30.1543968609, 32.1617252351, 20.7861495, 338.464342774, 47.5047376684, 36.4096041739 }}, /* 607 K */
+    {{ 30.1604912893, 32.171257313, 20.7861495, 338.851707412, 47.5288757298, 36.4210916591 }}, /* 608 K */
+    {{ 30.1665967152, 32.1807782953, 20.7861495, 339.238479771, 47.5529691939, 36.4325861849 }}, /* 609 K */
+    {{ 30.1727130505, 32.1902881133, 20.7861495, 339.624660675, 47.5770181665, 36.4440877214 }}, /* 610 K */
+    {{ 30.178840207, 32.1997866987, 20.7861495, 340.010250952, 47.6010227527, 36.455596239 }}, /* 611 K */
+    {{ 30.1849780966, 32.2092739841, 20.7861495, 340.395251432, 47.6249830573, 36.4671117083 }}, /* 612 K */
+    {{ 30.1911266313, 32.2187499027, 20.7861495, 340.779662951, 47.6488991846, 36.4786341003 }}, /* 613 K */
+    {{ 30.197285723, 32.2282143883, 20.7861495, 341.163486343, 47.6727712384, 36.4901633864 }}, /* 614 K */
+    {{ 30.2034552836, 32.2376673755, 20.7861495, 341.546722448, 47.6965993222, 36.5016995381 }}, /* 615 K */
+    {{ 30.2096352254, 32.2471087996, 20.7861495, 341.92937211, 47.7203835388, 36.5132425275 }}, /* 616 K */
+    {{ 30.2158254603, 32.2565385964, 20.7861495, 342.311436173, 47.7441239907, 36.5247923267 }}, /* 617 K */
+    {{ 30.2220259005, 32.2659567026, 20.7861495, 342.692915486, 47.7678207799, 36.5363489084 }}, /* 618 K */
+    {{ 30.2282364582, 32.2753630555, 20.7861495, 343.073810899, 47.7914740081, 36.5479122453 }}, /* 619 K */
+    {{ 30.2344570457, 32.2847575928, 20.7861495, 343.454123266, 47.8150837763, 36.5594823108 }}, /* 620 K */
+    {{ 30.2406875752, 32.2941402533, 20.7861495, 343.833853444, 47.8386501853, 36.5710590782 }}, /* 621 K */
+    {{ 30.2469279592, 32.3035109762, 20.7861495, 344.213002291, 47.8621733353, 36.5826425212 }}, /* 622 K */
+    {{ 30.25317811, 32.3128697013, 20.7861495, 344.59157067, 47.8856533261, 36.594232614 }}, /* 623 K */
+    {{ 30.2594379401, 32.3222163692, 20.7861495, 344.969559445, 47.9090902572, 36.6058293308 }}, /* 624 K */
+    {{ 30.2657073622, 32.3315509211, 20.7861495, 345.346969483, 47.9324842275, 36.6174326462 }}, /* 625 K */
+    {{ 30.2719862888, 32.340873299, 20.7861495, 345.723801655, 47.9558353355, 36.6290425352 }}, /* 626 K */
+    {{ 30.2782746328, 32.3501834452, 20.7861495, 346.100056831, 47.9791436793, 36.6406589729 }}, /* 627 K */
+    {{ 30.2845723067, 32.3594813029, 20.7861495, 346.475735889, 48.0024093567, 36.6522819347 }}, /* 628 K */
+    {{ 30.2908792237, 32.3687668159, 20.7861495, 346.850839704, 48.0256324649, 36.6639113962 }}, /* 629 K */
+    {{ 30.2971952965, 32.3780399287, 20.7861495, 347.225369158, 48.0488131007, 36.6755473336 }}, /* 630 K */
+    {{ 30.3035204383, 32.3873005862, 20.7861495, 347.599325132, 48.0719513606, 36.687189723 }}, /* 631 K */
+    {{ 30.3098545622, 32.3965487343, 20.7861495, 347.972708511, 48.0950473406, 36.6988385408 }}, /* 632 K */
+    {{ 30.3161975814, 32.4057843192, 20.7861495, 348.345520184, 48.1181011363, 36.7104937639 }}, /* 633 K */
+    {{ 30.3225494092, 32.4150072879, 20.7861495, 348.717761039, 48.1411128429, 36.7221553692 }}, /* 634 K */
+    {{ 30.3289099591, 32.424217588, 20.7861495, 349.08943197, 48.1640825553, 36.733823334 }}, /* 635 K */
+    {{ 30.3352791445, 32.4334151677, 20.7861495, 349.46053387, 48.1870103677, 36.7454976357 }}, /* 636 K */
+    {{ 30.3416568792, 32.4425999758, 20.7861495, 349.831067637, 48.2098963743, 36.7571782521 }}, /* 637 K */
+    {{ 30.3480430767, 32.4517719617, 20.7861495, 350.201034171, 48.2327406686, 36.7688651611 }}, /* 638 K */
+    {{ 30.354437651, 32.4609310756, 20.7861495, 350.570434372, 48.2555433437, 36.7805583411 }}, /* 639 K */
+    {{ 30.360840516, 32.4700772681, 20.7861495, 350.939269145, 48.2783044926, 36.7922577703 }}, /* 640 K */
+    {{ 30.3672515857, 32.4792104905, 20.7861495, 351.307539395, 48.3010242077, 36.8039634275 }}, /* 641 K */
+    {{ 30.3736707743, 32.4883306947, 20.7861495, 351.675246033, 48.3237025809, 36.8156752916 }}, /* 642 K */
+    {{ 30.3800979961, 32.4974378332, 20.7861495, 352.042389967, 48.3463397039, 36.8273933418 }}, /* 643 K */
+    {{ 30.3865331656, 32.5065318592, 20.7861495, 352.408972111, 48.368935668, 36.8391175573 }}, /* 644 K */
+    {{ 30.3929761971, 32.5156127263, 20.7861495, 352.774993379, 48.391490564, 36.8508479177 }}, /* 645 K */
+    {{ 30.3994270055, 32.5246803889, 20.7861495, 353.14045469, 48.4140044825, 36.8625844029 }}, /* 646 K */
+    {{ 30.4058855055, 32.5337348018, 20.7861495, 353.505356962, 48.4364775136, 36.8743269927 }}, /* 647 K */
+    {{ 30.412351612, 32.5427759207, 20.7861495, 353.869701117, 48.458909747, 36.8860756676 }}, /* 648 K */
+    {{ 30.41882524, 32.5518037015, 20.7861495, 354.233488078, 48.4813012722, 36.8978304077 }}, /* 649 K */
+    {{ 30.4253063047, 32.5608181011, 20.7861495, 354.596718771, 48.503652178, 36.9095911939 }}, /* 650 K */
+    {{ 30.4317947216, 32.5698190766, 20.7861495, 354.959394123, 48.5259625532, 36.9213580069 }}, /* 651 K */
+    {{ 30.4382904059, 32.578806586, 20.7861495, 355.321515064, 48.548232486, 36.9331308277 }}, /* 652 K */
+    {{ 30.4447932733, 32.5877805877, 20.7861495, 355.683082526, 48.5704620643, 36.9449096375 }}, /* 653 K */
+    {{ 30.4513032396, 32.5967410407, 20.7861495, 356.044097442, 48.5926513758, 36.9566944178 }}, /* 654 K */
+    {{ 30.4578202207, 32.6056879047, 20.7861495, 356.404560748, 48.6148005075, 36.9684851502 }}, /* 655 K */
+    {{ 30.4643441325, 32.6146211398, 20.7861495, 356.764473381, 48.6369095463, 36.9802818165 }}, /* 656 K */
+    {{ 30.4708748914, 32.6235407069, 20.7861495, 357.123836281, 48.6589785788, 36.9920843986 }}, /* 657 K */
+    {{ 30.4774124135, 32.6324465672, 20.7861495, 357.482650389, 48.681007691, 37.0038928787 }}, /* 658 K */
+    {{ 30.4839566155, 32.6413386828, 20.7861495, 357.840916649, 48.7029969687, 37.0157072392 }}, /* 659 K */
+    {{ 30.4905074141, 32.650217016, 20.7861495, 358.198636005, 48.7249464973, 37.0275274625 }}, /* 660 K */
+    {{ 30.4970647259, 32.6590815299, 20.7861495, 358.555809404, 48.746856362, 37.0393535315 }}, /* 661 K */
+    {{ 30.503628468, 32.6679321882, 20.7861495, 358.912437796, 48.7687266474, 37.0511854289 }}, /* 662 K */
+    {{ 30.5101985576, 32.6767689549, 20.7861495, 359.268522131, 48.790557438, 37.0630231378 }}, /* 663 K */
+    {{ 30.5167749119, 32.685591795, 20.7861495, 359.62406336, 48.8123488179, 37.0748666414 }}, /* 664 K */
+    {{ 30.5233574485, 32.6944006736, 20.7861495, 359.979062439, 48.8341008707, 37.086715923 }}, /* 665 K */
+    {{ 30.529946085, 32.7031955567, 20.7861495, 360.333520323, 48.8558136799, 37.0985709663 }}, /* 666 K */
+    {{ 30.5365407392, 32.7119764106, 20.7861495, 360.68743797, 48.8774873284, 37.1104317548 }}, /* 667 K */
+    {{ 30.5431413291, 32.7207432023, 20.7861495, 361.040816339, 48.8991218991, 37.1222982725 }}, /* 668 K */
+    {{ 30.5497477729, 32.7294958993, 20.7861495, 361.393656391, 48.9207174744, 37.1341705034 }}, /* 669 K */
+    {{ 30.556359989, 32.7382344697, 20.7861495, 361.745959089, 48.9422741363, 37.1460484315 }}, /* 670 K */
+    {{ 30.5629778959, 32.7469588821, 20.7861495, 362.097725398, 48.9637919665, 37.1579320413 }}, /* 671 K */
+    {{ 30.5696014123, 32.7556691056, 20.7861495, 362.448956282, 48.9852710464, 37.1698213172 }}, /* 672 K */
+    {{ 30.5762304571, 32.76436511, 20.7861495, 362.79965271, 49.0067114573, 37.1817162437 }}, /* 673 K */
+    {{ 30.5828649494, 32.7730468655, 20.7861495, 363.149815651, 49.0281132798, 37.1936168056 }}, /* 674 K */
+    {{ 30.5895048086, 32.7817143428, 20.7861495, 363.499446077, 49.0494765945, 37.2055229878 }}, /* 675 K */
+    {{ 30.596149954, 32.7903675134, 20.7861495, 363.848544958, 49.0708014814, 37.2174347754 }}, /* 676 K */
+    {{ 30.6028003054, 32.799006349, 20.7861495, 364.19711327, 49.0920880205, 37.2293521534 }}, /* 677 K */
+    {{ 30.6094557825, 32.807630822, 20.7861495, 364.545151987, 49.1133362912, 37.2412751071 }}, /* 678 K */
+    {{ 30.6161163056, 32.8162409053, 20.7861495, 364.892662088, 49.1345463728, 37.2532036221 }}, /* 679 K */
+    {{ 30.6227817947, 32.8248365725, 20.7861495, 365.239644549, 49.1557183442, 37.2651376837 }}, /* 680 K */
+    {{ 30.6294521705, 32.8334177974, 20.7861495, 365.586100352, 49.176852284, 37.2770772777 }}, /* 681 K */
+    {{ 30.6361273535, 32.8419845546, 20.7861495, 365.932030477, 49.1979482705, 37.28902239 }}, /* 682 K */
+    {{ 30.6428072646, 32.8505368191, 20.7861495, 366.277435908, 49.2190063817, 37.3009730063 }}, /* 683 K */
+    {{ 30.649491825, 32.8590745664, 20.7861495, 366.622317629, 49.2400266953, 37.3129291128 }}, /* 684 K */
+    {{ 30.6561809558, 32.8675977726, 20.7861495, 366.966676626, 49.2610092888, 37.3248906955 }}, /* 685 K */
+    {{ 30.6628745785, 32.8761064143, 20.7861495, 367.310513886, 49.2819542391, 37.3368577408 }}, /* 686 K */
+    {{ 30.6695726149, 32.8846004686, 20.7861495, 367.653830397, 49.3028616233, 37.3488302351 }}, /* 687 K */
+    {{ 30.6762749869, 32.8930799131, 20.7861495, 367.99662715, 49.3237315177, 37.3608081648 }}, /* 688 K */
+    {{ 30.6829816167, 32.901544726, 20.7861495, 368.338905136, 49.3445639986, 37.3727915165 }}, /* 689 K */
+    {{ 30.6896924265, 32.9099948859, 20.7861495, 368.680665347, 49.365359142, 37.3847802769 }}, /* 690 K */
+    {{ 30.6964073389, 32.9184303719, 20.7861495, 369.021908778, 49.3861170236, 37.3967744329 }}, /* 691 K */
+    {{ 30.7031262768, 32.9268511637, 20.7861495, 369.362636423, 49.4068377186, 37.4087739713 }}, /* 692 K */
+    {{ 30.7098491631, 32.9352572414, 20.7861495, 369.70284928, 49.4275213023, 37.4207788792 }}, /* 693 K */
+    {{ 30.7165759211, 32.9436485858, 20.7861495, 370.042548345, 49.4481678494, 37.4327891436 }}, /* 694 K */
+    {{ 30.7233064743, 32.9520251781, 20.7861495, 370.38173462, 49.4687774344, 37.4448047518 }}, /* 695 K */
+    {{ 30.7300407462, 32.9603869998, 20.7861495, 370.720409103, 49.4893501317, 37.4568256911 }}, /* 696 K */
+    {{ 30.736778661, 32.9687340332, 20.7861495, 371.058572796, 49.5098860152, 37.4688519488 }}, /* 697 K */
+    {{ 30.7435201426, 32.977066261, 20.7861495, 371.396226702, 49.5303851586, 37.4808835124 }}, /* 698 K */
+    {{ 30.7502651156, 32.9853836662, 20.7861495, 371.733371826, 49.5508476354, 37.4929203694 }}, /* 699 K */
+    {{ 30.7570135044, 32.9936862327, 20.7861495, 372.070009172, 49.5712735186, 37.5049625076 }}, /* 700 K */
+    {{ 30.763765234, 33.0019739445, 20.7861495, 372.406139748, 49.5916628813, 37.5170099147 }}, /* 701 K */
+    {{ 30.7705202295, 33.0102467863, 20.7861495, 372.741764559, 49.6120157961, 37.5290625784 }}, /* 702 K */
+    {{ 30.7772784162, 33.0185047432, 20.7861495, 373.076884617, 49.6323323353, 37.5411204866 }}, /* 703 K */
+    {{ 30.7840397196, 33.0267478009, 20.7861495, 373.411500929, 49.652612571, 37.5531836273 }}, /* 704 K */
+    {{ 30.7908040656, 33.0349759455, 20.7861495, 373.745614507, 49.6728565751, 37.5652519886 }}, /* 705 K */
+    {{ 30.7975713803, 33.0431891636, 20.7861495, 374.079226364, 49.6930644192, 37.5773255586 }}, /* 706 K */
+    {{ 30.8043415899, 33.0513874422, 20.7861495, 374.412337512, 49.7132361745, 37.5894043254 }}, /* 707 K */
+    {{ 30.811114621, 33.059570769, 20.7861495, 374.744948966, 49.7333719122, 37.6014882773 }}, /* 708 K */
+    {{ 30.8178904004, 33.0677391319, 20.7861495, 375.077061741, 49.753471703, 37.6135774025 }}, /* 709 K */
+    {{ 30.8246688552, 33.0758925195, 20.7861495, 375.408676854, 49.7735356176, 37.6256716896 }}, /* 710 K */
+    {{ 30.8314499126, 33.0840309209, 20.7861495, 375.739795322, 49.7935637262, 37.637771127 }}, /* 711 K */
+    {{ 30.8382335002, 33.0921543254, 20.7861495, 376.070418163, 49.8135560988, 37.649875703 }}, /* 712 K */
+    {{ 30.8450195458, 33.1002627231, 20.7861495, 376.400546397, 49.8335128054, 37.6619854064 }}, /* 713 K */
+    {{ 30.8518079776, 33.1083561043, 20.7861495, 376.730181045, 49.8534339154, 37.6741002258 }}, /* 714 K */
+    {{ 30.8585987237, 33.11643446, 20.7861495, 377.059323128, 49.8733194983, 37.6862201498 }}, /* 715 K */
+    {{ 30.8653917129, 33.1244977815, 20.7861495, 377.387973668, 49.8931696229, 37.6983451671 }}, /* 716 K */
+    {{ 30.8721868739, 33.1325460607, 20.7861495, 377.716133689, 49.9129843583, 37.7104752666 }}, /* 717 K */
+    {{ 30.8789841359, 33.1405792899, 20.7861495, 378.043804215, 49.9327637729, 37.7226104371 }}, /* 718 K */
+    {{ 30.8857834282, 33.1485974618, 20.7861495, 378.370986272, 49.9525079352, 37.7347506674 }}, /* 719 K */
+    {{ 30.8925846805, 33.1566005696, 20.7861495, 378.697680886, 49.9722169131, 37.7468959466 }}, /* 720 K */
+    {{ 30.8993878227, 33.1645886071, 20.7861495, 379.023889084, 49.9918907748, 37.7590462635 }}, /* 721 K */
+    {{ 30.9061927849, 33.1725615685, 20.7861495, 379.349611893, 50.0115295876, 37.7712016073 }}, /* 722 K */
+    {{ 30.9129994975, 33.1805194482, 20.7861495, 379.674850344, 50.0311334192, 37.7833619669 }}, /* 723 K */
+    {{ 30.9198078914, 33.1884622415, 20.7861495, 379.999605465, 50.0507023366, 37.7955273315 }}, /* 724 K */
+    {{ 30.9266178975, 33.1963899438, 20.7861495, 380.323878288, 50.0702364068, 37.8076976902 }}, /* 725 K */
+    {{ 30.933429447, 33.2043025511, 20.7861495, 380.647669844, 50.0897356965, 37.8198730322 }}, /* 726 K */
+    {{ 30.9402424715, 33.2122000599, 20.7861495, 380.970981165, 50.1092002723, 37.8320533467 }}, /* 727 K */
+    {{ 30.9470569028, 33.220082467, 20.7861495, 381.293813285, 50.1286302004, 37.844238623 }}, /* 728 K */
+    {{ 30.953872673, 33.2279497699, 20.7861495, 381.616167237, 50.1480255468, 37.8564288502 }}, /* 729 K */
+    {{ 30.9606897144, 33.2358019662, 20.7861495, 381.938044057, 50.1673863774, 37.8686240178 }}, /* 730 K */
+    {{ 30.9675079596, 33.2436390543, 20.7861495, 382.25944478, 50.1867127577, 37.8808241151 }}, /* 731 K */
+    {{ 30.9743273417, 33.2514610328, 20.7861495, 382.580370443, 50.2060047532, 37.8930291313 }}, /* 732 K */
+    {{ 30.9811477938, 33.2592679009, 20.7861495, 382.900822082, 50.225262429, 37.905239056 }}, /* 733 K */
+    {{ 30.9879692495, 33.2670596581, 20.7861495, 383.220800735, 50.2444858501, 37.9174538785 }}, /* 734 K */
+    {{ 30.9947916424, 33.2748363045, 20.7861495, 383.540307442, 50.2636750812, 37.9296735882 }}, /* 735 K */
+    {{ 31.0016149067, 33.2825978405, 20.7861495, 383.859343241, 50.2828301868, 37.9418981746 }}, /* 736 K */
+    {{ 31.0084389768, 33.2903442671, 20.7861495, 384.177909174, 50.3019512312, 37.9541276271 }}, /* 737 K */
+    {{ 31.0152637872, 33.2980755856, 20.7861495, 384.49600628, 50.3210382786, 37.9663619352 }}, /* 738 K */
+    {{ 31.0220892729, 33.3057917977, 20.7861495, 384.813635601, 50.3400913927, 37.9786010885 }}, /* 739 K */
+    {{ 31.0289153691, 33.3134929058, 20.7861495, 385.13079818, 50.3591106374, 37.9908450764 }}, /* 740 K */
+    {{ 31.0357420114, 33.3211789124, 20.7861495, 385.447495059, 50.378096076, 38.0030938885 }}, /* 741 K */
+    {{ 31.0425691356, 33.3288498207, 20.7861495, 385.763727282, 50.3970477719, 38.0153475142 }}, /* 742 K */
+    {{ 31.0493966777, 33.3365056342, 20.7861495, 386.079495893, 50.4159657881, 38.0276059431 }}, /* 743 K */
+    {{ 31.0562245743, 33.3441463567, 20.7861495, 386.394801938, 50.4348501874, 38.0398691649 }}, /* 744 K */
+    {{ 31.0630527619, 33.3517719929, 20.7861495, 386.709646462, 50.4537010326, 38.0521371689 }}, /* 745 K */
+    {{ 31.0698811776, 33.3593825473, 20.7861495, 387.02403051, 50.472518386, 38.0644099448 }}, /* 746 K */
+    {{ 31.0767097587, 33.3669780254, 20.7861495, 387.337955131, 50.4913023099, 38.0766874822 }}, /* 747 K */
+    {{ 31.0835384428, 33.3745584327, 20.7861495, 387.65142137, 50.5100528665, 38.0889697705 }}, /* 748 K */
+    {{ 31.0903671679, 33.3821237754, 20.7861495, 387.964430277, 50.5287701175, 38.1012567995 }}, /* 749 K */
+    {{ 31.097195872, 33.38967406, 20.7861495, 388.2769829, 50.5474541247, 38.1135485585 }}, /* 750 K */
+    {{ 31.1040244939, 33.3972092934, 20.7861495, 388.589080288, 50.5661049495, 38.1258450372 }}, /* 751 K */
+    {{ 31.1108529721, 33.404729483, 20.7861495, 388.900723491, 50.5847226532, 38.1381462251 }}, /* 752 K */
+    {{ 31.117681246, 33.4122346366, 20.7861495, 389.211913559, 50.6033072969, 38.1504521118 }}, /* 753 K */
+    {{ 31.124509255, 33.4197247625, 20.7861495, 389.522651543, 50.6218589415, 38.1627626867 }}, /* 754 K */
+    {{ 31.1313369387, 33.4271998691, 20.7861495, 389.832938494, 50.6403776478, 38.1750779395 }}, /* 755 K */
+    {{ 31.1381642373, 33.4346599657, 20.7861495, 390.142775465, 50.6588634762, 38.1873978596 }}, /* 756 K */
+    {{ 31.1449910911, 33.4421050616, 20.7861495, 390.452163508, 50.6773164871, 38.1997224366 }}, /* 757 K */
+    {{ 31.1518174408, 33.4495351667, 20.7861495, 390.761103675, 50.6957367407, 38.2120516599 }}, /* 758 K */
+    {{ 31.1586432274, 33.4569502913, 20.7861495, 391.069597021, 50.7141242969, 38.224385519 }}, /* 759 K */
+    {{ 31.1654683923, 33.4643504462, 20.7861495, 391.377644599, 50.7324792156, 38.2367240034 }}, /* 760 K */
+    {{ 31.172292877, 33.4717356424, 20.7861495, 391.685247464, 50.7508015563, 38.2490671025 }}, /* 761 K */
+    {{ 31.1791166235, 33.4791058915, 20.7861495, 391.992406671, 50.7690913786, 38.2614148057 }}, /* 762 K */
+    {{ 31.185939574, 33.4864612054, 20.7861495, 392.299123274, 50.7873487415, 38.2737671025 }}, /* 763 K */
+    {{ 31.1927616713, 33.4938015965, 20.7861495, 392.605398331, 50.8055737043, 38.2861239822 }}, /* 764 K */
+    {{ 31.1995828581, 33.5011270774, 20.7861495, 392.911232896, 50.8237663259, 38.2984854341 }}, /* 765 K */
+    {{ 31.2064030776, 33.5084376615, 20.7861495, 393.216628028, 50.8419266649, 38.3108514477 }}, /* 766 K */
+    {{ 31.2132222735, 33.5157333622, 20.7861495, 393.521584782, 50.86005478, 38.3232220121 }}, /* 767 K */
+    {{ 31.2200403897, 33.5230141935, 20.7861495, 393.826104217, 50.8781507294, 38.3355971168 }}, /* 768 K */
+    {{ 31.2268573702, 33.5302801698, 20.7861495, 394.130187391, 50.8962145715, 38.3479767509 }}, /* 769 K */
+    {{ 31.2336731596, 33.5375313059, 20.7861495, 394.433835361, 50.9142463642, 38.3603609037 }}, /* 770 K */
+    {{ 31.2404877029, 33.544767617, 20.7861495, 394.737049188, 50.9322461655, 38.3727495644 }}, /* 771 K */
+    {{ 31.2473009451, 33.5519891185, 20.7861495, 395.039829929, 50.950214033, 38.3851427221 }}, /* 772 K */
+    {{ 31.2541128317, 33.5591958266, 20.7861495, 395.342178645, 50.9681500243, 38.397540366 }}, /* 773 K */
+    {{ 31.2609233087, 33.5663877575, 20.7861495, 395.644096395, 50.9860541967, 38.4099424851 }}, /* 774 K */
+    {{ 31.2677323222, 33.5735649281, 20.7861495, 395.94558424, 51.0039266075, 38.4223490685 }}, /* 775 K */
+    {{ 31.2745398186, 33.5807273556, 20.7861495, 396.24664324, 51.0217673137, 38.4347601052 }}, /* 776 K */
+    {{ 31.2813457448, 33.5878750574, 20.7861495, 396.547274456, 51.0395763722, 38.4471755843 }}, /* 777 K */
+    {{ 31.2881500479, 33.5950080515, 20.7861495, 396.847478949, 51.0573538398, 38.4595954946 }}, /* 778 K */
+    {{ 31.2949526755, 33.6021263564, 20.7861495, 397.147257782, 51.0750997729, 38.472019825 }}, /* 779 K */
+    {{ 31.3017535755, 33.6092299907, 20.7861495, 397.446612015, 51.092814228, 38.4844485645 }}, /* 780 K */
+    {{ 31.3085526958, 33.6163189735, 20.7861495, 397.745542712, 51.1104972614, 38.4968817018 }}, /* 781 K */
+    {{ 31.3153499852, 33.6233933245, 20.7861495, 398.044050935, 51.128148929, 38.5093192256 }}, /* 782 K */
+    {{ 31.3221453924, 33.6304530635, 20.7861495, 398.342137746, 51.145769287, 38.5217611248 }}, /* 783 K */
+    {{ 31.3289388665, 33.6374982108, 20.7861495, 398.639804209, 51.163358391, 38.534207388 }}, /* 784 K */
+    {{ 31.3357303572, 33.6445287871, 20.7861495, 398.937051387, 51.1809162966, 38.5466580039 }}, /* 785 K */
+    {{ 31.3425198143, 33.6515448134, 20.7861495, 399.233880343, 51.1984430595, 38.5591129609 }}, /* 786 K */
+    {{ 31.349307188, 33.6585463113, 20.7861495, 399.530292143, 51.2159387347, 38.5715722477 }}, /* 787 K */
+    {{ 31.3560924289, 33.6655333026, 20.7861495, 399.826287849, 51.2334033777, 38.5840358527 }}, /* 788 K */
+    {{ 31.3628754878, 33.6725058095, 20.7861495, 400.121868526, 51.2508370433, 38.5965037644 }}, /* 789 K */
+    {{ 31.369656316, 33.6794638546, 20.7861495, 400.41703524, 51.2682397865, 38.6089759711 }}, /* 790 K */
+    {{ 31.376434865, 33.6864074609, 20.7861495, 400.711789054, 51.2856116619, 38.6214524611 }}, /* 791 K */
+    {{ 31.3832110869, 33.6933366518, 20.7861495, 401.006131034, 51.3029527242, 38.6339332227 }}, /* 792 K */
+    {{ 31.3899849338, 33.7002514511, 20.7861495, 401.300062245, 51.3202630278, 38.6464182441 }}, /* 793 K */
+    {{ 31.3967563585, 33.7071518828, 20.7861495, 401.593583753, 51.3375426271, 38.6589075135 }}, /* 794 K */
+    {{ 31.4035253138, 33.7140379715, 20.7861495, 401.886696624, 51.3547915761, 38.6714010189 }}, /* 795 K */
+    {{ 31.4102917531, 33.720909742, 20.7861495, 402.179401922, 51.3720099288, 38.6838987484 }}, /* 796 K */
+    {{ 31.4170556301, 33.7277672197, 20.7861495, 402.471700716, 51.3891977392, 38.6964006899 }}, /* 797 K */
+    {{ 31.4238168989, 33.7346104301, 20.7861495, 402.76359407, 51.406355061, 38.7089068313 }}, /* 798 K */
+    {{ 31.4305755137, 33.7414393993, 20.7861495, 403.055083051, 51.4234819477, 38.7214171605 }}, /* 799 K */
+    {{ 31.4373314293, 33.7482541536, 20.7861495, 403.346168727, 51.4405784528, 38.7339316653 }}, /* 800 K */
+    {{ 31.4440846008, 33.7550547199, 20.7861495, 403.636852163, 51.4576446297, 38.7464503332 }}, /* 801 K */
+    {{ 31.4508349837, 33.7618411252, 20.7861495, 403.927134426, 51.4746805314, 38.7589731521 }}, /* 802 K */
+    {{ 31.4575825337, 33.7686133971, 20.7861495, 404.217016584, 51.4916862112, 38.7715001095 }}, /* 803 K */
+    {{ 31.464327207, 33.7753715634, 20.7861495, 404.506499704, 51.5086617218, 38.7840311927 }}, /* 804 K */
+    {{ 31.4710689602, 33.7821156523, 20.7861495, 404.795584853, 51.525607116, 38.7965663894 }}, /* 805 K */
+    {{ 31.47780775, 33.7888456925, 20.7861495, 405.084273099, 51.5425224465, 38.8091056869 }}, /* 806 K */
+    {{ 31.4845435337, 33.7955617129, 20.7861495, 405.372565509, 51.5594077659, 38.8216490723 }}, /* 807 K */
+    {{ 31.4912762689, 33.8022637429, 20.7861495, 405.660463151, 51.5762631264, 38.8341965331 }}, /* 808 K */
+    {{ 31.4980059135, 33.8089518121, 20.7861495, 405.947967093, 51.5930885804, 38.8467480562 }}, /* 809 K */
+    {{ 31.5047324259, 33.8156259508, 20.7861495, 406.235078402, 51.6098841799, 38.8593036288 }}, /* 810 K */
+    {{ 31.5114557647, 33.8222861892, 20.7861495, 406.521798146, 51.6266499771, 38.8718632378 }}, /* 811 K */
+    {{ 31.5181758889, 33.8289325582, 20.7861495, 406.808127394, 51.6433860237, 38.8844268702 }}, /* 812 K */
+    {{ 31.524892758, 33.835565089, 20.7861495, 407.094067214, 51.6600923714, 38.8969945128 }}, /* 813 K */
+    {{ 31.5316063317, 33.842183813, 20.7861495, 407.379618673, 51.676769072, 38.9095661524 }}, /* 814 K */
+    {{ 31.5383165701, 33.8487887622, 20.7861495, 407.664782841, 51.693416177, 38.9221417756 }}, /* 815 K */
+    {{ 31.5450234338, 33.8553799688, 20.7861495, 407.949560785, 51.7100337376, 38.934721369 }}, /* 816 K */
+    {{ 31.5517268835, 33.8619574654, 20.7861495, 408.233953573, 51.7266218051, 38.9473049191 }}, /* 817 K */
+    {{ 31.5584268806, 33.868521285, 20.7861495, 408.517962275, 51.7431804308, 38.9598924124 }}, /* 818 K */
+    {{ 31.5651233865, 33.8750714609, 20.7861495, 408.801587958, 51.7597096655, 38.9724838352 }}, /* 819 K */
+    {{ 31.5718163633, 33.8816080267, 20.7861495, 409.084831691, 51.7762095603, 38.9850791737 }}, /* 820 K */
+    {{ 31.5785057734, 33.8881310166, 20.7861495, 409.367694543, 51.7926801658, 38.9976784142 }}, /* 821 K */
+    {{ 31.5851915793, 33.8946404648, 20.7861495, 409.650177582, 51.8091215327, 39.0102815426 }}, /* 822 K */
+    {{ 31.5918737442, 33.9011364062, 20.7861495, 409.932281876, 51.8255337116, 39.0228885451 }}, /* 823 K */
+    {{ 31.5985522315, 33.9076188758, 20.7861495, 410.214008494, 51.8419167529, 39.0354994075 }}, /* 824 K */
+    {{ 31.605227005, 33.9140879091, 20.7861495, 410.495358504, 51.8582707068, 39.0481141157 }}, /* 825 K */
+    {{ 31.611898029, 33.9205435419, 20.7861495, 410.776332976, 51.8745956237, 39.0607326553 }}, /* 826 K */
+    {{ 31.6185652679, 33.9269858103, 20.7861495, 411.056932977, 51.8908915536, 39.073355012 }}, /* 827 K */
+    {{ 31.6252286868, 33.9334147509, 20.7861495, 411.337159576, 51.9071585464, 39.0859811713 }}, /* 828 K */
+    {{ 31.6318882509, 33.9398304004, 20.7861495, 411.617013842, 51.9233966519, 39.0986111188 }}, /* 829 K */
+    {{ 31.6385439259, 33.9462327962, 20.7861495, 411.896496842, 51.9396059201, 39.1112448396 }}, /* 830 K */
+    {{ 31.645195678, 33.9526219757, 20.7861495, 412.175609645, 51.9557864004, 39.1238823192 }}, /* 831 K */
+    {{ 31.6518434734, 33.9589979769, 20.7861495, 412.454353321, 51.9719381425, 39.1365235427 }}, /* 832 K */
+    {{ 31.6584872791, 33.965360838, 20.7861495, 412.732728935, 51.9880611957, 39.1491684951 }}, /* 833 K */
+    {{ 31.6651270623, 33.9717105976, 20.7861495, 413.010737558, 52.0041556093, 39.1618171614 }}, /* 834 K */
+    {{ 31.6717627905, 33.9780472947, 20.7861495, 413.288380258, 52.0202214326, 39.1744695264 }}, /* 835 K */
+    {{ 31.6783944317, 33.9843709684, 20.7861495, 413.565658101, 52.0362587147, 39.187125575 }}, /* 836 K */
+    {{ 31.6850219542, 33.9906816586, 20.7861495, 413.842572157, 52.0522675045, 39.1997852919 }}, /* 837 K */
+    {{ 31.6916453268, 33.9969794051, 20.7861495, 414.119123493, 52.0682478509, 39.2124486615 }}, /* 838 K */
+    {{ 31.6982645185, 34.0032642482, 20.7861495, 414.395313178, 52.0841998028, 39.2251156684 }}, /* 839 K */
+    {{ 31.7048794989, 34.0095362287, 20.7861495, 414.671142279, 52.1001234087, 39.2377862969 }}, /* 840 K */
+    {{ 31.7114902377, 34.0157953875, 20.7861495, 414.946611863, 52.1160187174, 39.2504605312 }}, /* 841 K */
+    {{ 31.7180967053, 34.0220417659, 20.7861495, 415.221722998, 52.1318857772, 39.2631383556 }}, /* 842 K */
+    {{ 31.7246988723, 34.0282754057, 20.7861495, 415.496476753, 52.1477246366, 39.2758197541 }}, /* 843 K */
+    {{ 31.7312967097, 34.0344963488, 20.7861495, 415.770874194, 52.1635353438, 39.2885047106 }}, /* 844 K */
+    {{ 31.7378901889, 34.0407046377, 20.7861495, 416.044916388, 52.179317947, 39.301193209 }}, /* 845 K */
+    {{ 31.7444792817, 34.046900315, 20.7861495, 416.318604402, 52.1950724944, 39.3138852329 }}, /* 846 K */
+    {{ 31.7510639602, 34.0530834238, 20.7861495, 416.591939305, 52.2107990338, 39.3265807661 }}, /* 847 K */
+    {{ 31.7576441971, 34.0592540074, 20.7861495, 416.864922161, 52.2264976131, 39.339279792 }}, /* 848 K */
+    {{ 31.7642199654, 34.0654121095, 20.7861495, 417.13755404, 52.2421682803, 39.351982294 }}, /* 849 K */
+    {{ 31.7707912382, 34.0715577743, 20.7861495, 417.409836006, 52.2578110829, 39.3646882554 }}, /* 850 K */
+    {{ 31.7773579894, 34.077691046, 20.7861495, 417.681769126, 52.2734260685, 39.3773976593 }}, /* 851 K */
+    {{ 31.7839201931, 34.0838119694, 20.7861495, 417.953354467, 52.2890132847, 39.390110489 }}, /* 852 K */
+    {{ 31.7904778239, 34.0899205896, 20.7861495, 418.224593095, 52.304572779, 39.4028267272 }}, /* 853 K */
+    {{ 31.7970308565, 34.0960169519, 20.7861495, 418.495486076, 52.3201045985, 39.4155463568 }}, /* 854 K */
+    {{ 31.8035792663, 34.102101102, 20.7861495, 418.766034475, 52.3356087906, 39.4282693606 }}, /* 855 K */
+    {{ 31.810123029, 34.108173086, 20.7861495, 419.036239359, 52.3510854024, 39.4409957212 }}, /* 856 K */
+    {{ 31.8166621207, 34.1142329503, 20.7861495, 419.306101793, 52.3665344809, 39.453725421 }}, /* 857 K */
+    {{ 31.8231965179, 34.1202807416, 20.7861495, 419.575622842, 52.3819560731, 39.4664584424 }}, /* 858 K */
+    {{ 31.8297261973, 34.1263165069, 20.7861495, 419.844803571, 52.3973502259, 39.4791947677 }}, /* 859 K */
+    {{ 31.8362511363, 34.1323402935, 20.7861495, 420.113645045, 52.4127169861, 39.4919343789 }}, /* 860 K */
+    {{ 31.8427713126, 34.1383521493, 20.7861495, 420.382148329, 52.4280564003, 39.5046772582 }}, /* 861 K */
+    {{ 31.8492867041, 34.1443521221, 20.7861495, 420.650314488, 52.4433685152, 39.5174233874 }}, /* 862 K */
+    {{ 31.8557972893, 34.1503402604, 20.7861495, 420.918144585, 52.4586533774, 39.5301727483 }}, /* 863 K */
+    {{ 31.8623030471, 34.1563166128, 20.7861495, 421.185639685, 52.4739110331, 39.5429253225 }}, /* 864 K */
+    {{ 31.8688039568, 34.1622812284, 20.7861495, 421.452800852, 52.4891415289, 39.5556810916 }}, /* 865 K */
+    {{ 31.8752999978, 34.1682341564, 20.7861495, 421.71962915, 52.5043449109, 39.5684400369 }}, /* 866 K */
+    {{ 31.8817911504, 34.1741754466, 20.7861495, 421.986125641, 52.5195212254, 39.5812021398 }}, /* 867 K */
+    {{ 31.8882773949, 34.1801051489, 20.7861495, 422.252291389, 52.5346705185, 39.5939673813 }}, /* 868 K */
+    {{ 31.8947587122, 34.1860233136, 20.7861495, 422.518127458, 52.5497928362, 39.6067357426 }}, /* 869 K */
+    {{ 31.9012350835, 34.1919299913, 20.7861495, 422.783634909, 52.5648882244, 39.6195072046 }}, /* 870 K */
+    {{ 31.9077064904, 34.1978252331, 20.7861495, 423.048814806, 52.579956729, 39.6322817479 }}, /* 871 K */
+    {{ 31.914172915, 34.2037090901, 20.7861495, 423.31366821, 52.5949983958, 39.6450593533 }}, /* 872 K */
+    {{ 31.9206343397, 34.209581614, 20.7861495, 423.578196184, 52.6100132705, 39.6578400013 }}, /* 873 K */
+    {{ 31.9270907473, 34.2154428566, 20.7861495, 423.842399789, 52.6250013987, 39.6706236723 }}, /* 874 K */
+    {{ 31.9335421212, 34.2212928703, 20.7861495, 424.106280088, 52.639962826, 39.6834103465 }}, /* 875 K */
+    {{ 31.9399884449, 34.2271317076, 20.7861495, 424.36983814, 52.6548975978, 39.6962000041 }}, /* 876 K */
+    {{ 31.9464297025, 34.2329594213, 20.7861495, 424.633075007, 52.6698057596, 39.7089926251 }}, /* 877 K */
+    {{ 31.9528658785, 34.2387760647, 20.7861495, 424.89599175, 52.6846873566, 39.7217881893 }}, /* 878 K */
+    {{ 31.9592969577, 34.2445816912, 20.7861495, 425.15858943, 52.6995424341, 39.7345866765 }}, /* 879 K */
+    {{ 31.9657229254, 34.2503763548, 20.7861495, 425.420869105, 52.7143710372, 39.7473880663 }}, /* 880 K */
+    {{ 31.9721437673, 34.2561601095, 20.7861495, 425.682831837, 52.7291732111, 39.7601923381 }}, /* 881 K */
+    {{ 31.9785594693, 34.2619330098, 20.7861495, 425.944478684, 52.7439490008, 39.7729994714 }}, /* 882 K */
+    {{ 31.9849700181, 34.2676951105, 20.7861495, 426.205810706, 52.7586984512, 39.7858094452 }}, /* 883 K */
+    {{ 31.9913754005, 34.2734464667, 20.7861495, 426.466828962, 52.7734216072, 39.7986222387 }}, /* 884 K */
+    {{ 31.9977756039, 34.2791871338, 20.7861495, 426.727534511, 52.7881185136, 39.8114378309 }}, /* 885 K */
+    {{ 32.0041706158, 34.2849171675, 20.7861495, 426.98792841, 52.8027892152, 39.8242562004 }}, /* 886 K */
+    {{ 32.0105604244, 34.2906366239, 20.7861495, 427.248011718, 52.8174337565, 39.8370773259 }}, /* 887 K */
+    {{ 32.0169450183, 34.2963455594, 20.7861495, 427.507785493, 52.8320521823, 39.8499011861 }}, /* 888 K */
+    {{ 32.0233243864, 34.3020440306, 20.7861495, 427.767250792, 52.8466445369, 39.8627277592 }}, /* 889 K */
+    {{ 32.029698518, 34.3077320944, 20.7861495, 428.026408672, 52.861210865, 39.8755570234 }}, /* 890 K */
+    {{ 32.0360674029, 34.3134098082, 20.7861495, 428.285260189, 52.8757512107, 39.888388957 }}, /* 891 K */
+    {{ 32.0424310312, 34.3190772296, 20.7861495, 428.543806401, 52.8902656186, 39.9012235378 }}, /* 892 K */
+    {{ 32.0487893936, 34.3247344165, 20.7861495, 428.802048363, 52.9047541328, 39.9140607436 }}, /* 893 K */
+    {{ 32.055142481, 34.3303814271, 20.7861495, 429.059987131, 52.9192167975, 39.9269005522 }}, /* 894 K */
+    {{ 32.0614902848, 34.33601832, 20.7861495, 429.31762376, 52.9336536568, 39.9397429411 }}, /* 895 K */
+    {{ 32.0678327968, 34.3416451539, 20.7861495, 429.574959306, 52.9480647548, 39.9525878876 }}, /* 896 K */
+    {{ 32.0741700093, 34.3472619882, 20.7861495, 429.831994823, 52.9624501355, 39.9654353691 }}, /* 897 K */
+    {{ 32.0805019149, 34.3528688821, 20.7861495, 430.088731365, 52.9768098429, 39.9782853625 }}, /* 898 K */
+    {{ 32.0868285066, 34.3584658956, 20.7861495, 430.345169986, 52.9911439206, 39.991137845 }}, /* 899 K */
+    {{ 32.093149778, 34.3640530886, 20.7861495, 430.601311741, 53.0054524127, 40.0039927932 }}, /* 900 K */
+    {{ 32.0994657228, 34.3696305216, 20.7861495, 430.857157682, 53.0197353628, 40.0168501838 }}, /* 901 K */
+    {{ 32.1057763355, 34.3751982552, 20.7861495, 431.112708862, 53.0339928145, 40.0297099934 }}, /* 902 K */
+    {{ 32.1120816107, 34.3807563505, 20.7861495, 431.367966333, 53.0482248116, 40.0425721984 }}, /* 903 K */
+    {{ 32.1183815435, 34.3863048688, 20.7861495, 431.622931148, 53.0624313975, 40.0554367749 }}, /* 904 K */
+    {{ 32.1246761295, 34.3918438716, 20.7861495, 431.877604359, 53.0766126158, 40.068303699 }}, /* 905 K */
+    {{ 32.1309653647, 34.3973734209, 20.7861495, 432.131987016, 53.0907685098, 40.0811729468 }}, /* 906 K */
+    {{ 32.1372492455, 34.4028935788, 20.7861495, 432.386080172, 53.104899123, 40.0940444938 }}, /* 907 K */
+    {{ 32.1435277686, 34.408404408, 20.7861495, 432.639884875, 53.1190044987, 40.1069183158 }}, /* 908 K */
+    {{ 32.1498009313, 34.4139059713, 20.7861495, 432.893402177, 53.1330846802, 40.1197943883 }}, /* 909 K */
+    {{ 32.1560687312, 34.4193983317, 20.7861495, 433.146633128, 53.1471397106, 40.1326726865 }}, /* 910 K */
+    {{ 32.1623311664, 34.4248815527, 20.7861495, 433.399578776, 53.161169633, 40.1455531857 }}, /* 911 K */
+    {{ 32.1685882353, 34.430355698, 20.7861495, 433.652240171, 53.1751744907, 40.1584358608 }}, /* 912 K */
+    {{ 32.1748399368, 34.4358208317, 20.7861495, 433.904618361, 53.1891543265, 40.1713206867 }}, /* 913 K */
+    {{ 32.1810862704, 34.4412770181, 20.7861495, 434.156714394, 53.2031091836, 40.1842076382 }}, /* 914 K */
+    {{ 32.1873272356, 34.4467243219, 20.7861495, 434.408529318, 53.2170391048, 40.1970966898 }}, /* 915 K */
+    {{ 32.1935628327, 34.4521628079, 20.7861495, 434.660064181, 53.2309441329, 40.209987816 }}, /* 916 K */
+    {{ 32.1997930623, 34.4575925415, 20.7861495, 434.911320028, 53.2448243109, 40.2228809908 }}, /* 917 K */
+    {{ 32.2060179253, 34.463013588, 20.7861495, 435.162297908, 53.2586796814, 40.2357761885 }}, /* 918 K */
+    {{ 32.2122374232, 34.4684260135, 20.7861495, 435.412998865, 53.2725102871, 40.2486733831 }}, /* 919 K */
+    {{ 32.2184515579, 34.473829884, 20.7861495, 435.663423945, 53.2863161708, 40.2615725481 }}, /* 920 K */
+    {{ 32.2246603315, 34.4792252659, 20.7861495, 435.913574194, 53.3000973751, 40.2744736574 }}, /* 921 K */
+    {{ 32.2308637469, 34.484612226, 20.7861495, 436.163450656, 53.3138539424, 40.2873766844 }}, /* 922 K */
+    {{ 32.2370618071, 34.4899908312, 20.7861495, 436.413054375, 53.3275859153, 40.3002816023 }}, /* 923 K */
+    {{ 32.2432545156, 34.495361149, 20.7861495, 436.662386395, 53.3412933363, 40.3131883844 }}, /* 924 K */
+    {{ 32.2494418766, 34.5007232469, 20.7861495, 436.91144776, 53.3549762477, 40.3260970035 }}, /* 925 K */
+    {{ 32.2556238942, 34.5060771928, 20.7861495, 437.160239512, 53.3686346919, 40.3390074326 }}, /* 926 K */
+    {{ 32.2618005735, 34.511423055, 20.7861495, 437.408762694, 53.3822687112, 40.3519196444 }}, /* 927 K */
+    {{ 32.2679719195, 34.516760902, 20.7861495, 437.657018348, 53.3958783479, 40.3648336112 }}, /* 928 K */
+    {{ 32.2741379381, 34.5220908024, 20.7861495, 437.905007516, 53.4094636442, 40.3777493056 }}, /* 929 K */
+    {{ 32.2802986352, 34.5274128256, 20.7861495, 438.152731238, 53.4230246422, 40.3906666996 }}, /* 930 K */
+    {{ 32.2864540175, 34.5327270407, 20.7861495, 438.400190554, 53.4365613841, 40.4035857653 }}, /* 931 K */
+    {{ 32.2926040918, 34.5380335176, 20.7861495, 438.647386506, 53.4500739118, 40.4165064745 }}, /* 932 K */
+    {{ 32.2987488656, 34.5433323262, 20.7861495, 438.894320133, 53.4635622676, 40.429428799 }}, /* 933 K */
+    {{ 32.3048883467, 34.5486235367, 20.7861495, 439.140992474, 53.4770264932, 40.4423527103 }}, /* 934 K */
+    {{ 32.3110225433, 34.5539072197, 20.7861495, 439.387404567, 53.4904666308, 40.4552781797 }}, /* 935 K */
+    {{ 32.3171514641, 34.559183446, 20.7861495, 439.633557451, 53.503882722, 40.4682051784 }}, /* 936 K */
+    {{ 32.3232751181, 34.5644522868, 20.7861495, 439.879452163, 53.5172748089, 40.4811336776 }}, /* 937 K */
+    {{ 32.329393515, 34.5697138136, 20.7861495, 440.125089742, 53.5306429331, 40.4940636481 }}, /* 938 K */
+    {{ 32.3355066647, 34.574968098, 20.7861495, 440.370471222, 53.5439871365, 40.5069950605 }}, /* 939 K */
+    {{ 32.3416145776, 34.580215212, 20.7861495, 440.615597641, 53.5573074608, 40.5199278854 }}, /* 940 K */
+    {{ 32.3477172644, 34.585455228, 20.7861495, 440.860470035, 53.5706039476, 40.5328620933 }}, /* 941 K */
+    {{ 32.3538147364, 34.5906882185, 20.7861495, 441.105089437, 53.5838766386, 40.5457976542 }}, /* 942 K */
+    {{ 32.3599070054, 34.5959142565, 20.7861495, 441.349456885, 53.5971255754, 40.5587345383 }}, /* 943 K */
+    {{ 32.3659940835, 34.6011334151, 20.7861495, 441.59357341, 53.6103507995, 40.5716727154 }}, /* 944 K */
+    {{ 32.3720759831, 34.6063457677, 20.7861495, 441.837440048, 53.6235523523, 40.5846121552 }}, /* 945 K */
+    {{ 32.3781527173, 34.6115513881, 20.7861495, 442.08105783, 53.6367302755, 40.5975528272 }}, /* 946 K */
+    {{ 32.3842242994, 34.6167503503, 20.7861495, 442.324427791, 53.6498846104, 40.6104947009 }}, /* 947 K */
+    {{ 32.3902907434, 34.6219427286, 20.7861495, 442.567550962, 53.6630153984, 40.6234377454 }}, /* 948 K */
+    {{ 32.3963520635, 34.6271285977, 20.7861495, 442.810428374, 53.6761226809, 40.6363819296 }}, /* 949 K */
+    {{ 32.4024082744, 34.6323080325, 20.7861495, 443.053061059, 53.6892064992, 40.6493272226 }}, /* 950 K */
+    {{ 32.4084593913, 34.6374811081, 20.7861495, 443.295450047, 53.7022668945, 40.6622735929 }}, /* 951 K */
+    {{ 32.4145054297, 34.6426478999, 20.7861495, 443.537596368, 53.7153039081, 40.675221009 }}, /* 952 K */
+    {{ 32.4205464057, 34.6478084838, 20.7861495, 443.779501052, 53.7283175811, 40.6881694393 }}, /* 953 K */
+    {{ 32.4265823357, 34.6529629357, 20.7861495, 444.021165128, 53.7413079549, 40.701118852 }}, /* 954 K */
+    {{ 32.4326132365, 34.6581113321, 20.7861495, 444.262589623, 53.7542750704, 40.714069215 }}, /* 955 K */
+    {{ 32.4386391257, 34.6632537494, 20.7861495, 444.503775567, 53.7672189688, 40.7270204961 }}, /* 956 K */
+    {{ 32.4446600207, 34.6683902646, 20.7861495, 444.744723986, 53.7801396912, 40.739972663 }}, /* 957 K */
+    {{ 32.45067594, 34.6735209548, 20.7861495, 444.985435906, 53.7930372785, 40.7529256832 }}, /* 958 K */
+    {{ 32.4566869021, 34.6786458976, 20.7861495, 445.225912355, 53.8059117717, 40.7658795238 }}, /* 959 K */
+    {{ 32.4626929261, 34.6837651705, 20.7861495, 445.466154357, 53.8187632119, 40.7788341522 }}, /* 960 K */
+    {{ 32.4686940314, 34.6888788518, 20.7861495, 445.706162938, 53.8315916399, 40.7917895351 }}, /* 961 K */
+    {{ 32.4746902381, 34.6939870195, 20.7861495, 445.945939123, 53.8443970966, 40.8047456393 }}, /* 962 K */
+    {{ 32.4806815665, 34.6990897525, 20.7861495, 446.185483935, 53.8571796229, 40.8177024315 }}, /* 963 K */
+    {{ 32.4866680374, 34.7041871294, 20.7861495, 446.424798397, 53.8699392595, 40.830659878 }}, /* 964 K */
+    {{ 32.4926496722, 34.7092792294, 20.7861495, 446.663883534, 53.8826760474, 40.8436179451 }}, /* 965 K */
+    {{ 32.4986264924, 34.7143661321, 20.7861495, 446.902740366, 53.8953900271, 40.8565765987 }}, /* 966 K */
+    {{ 32.5045985202, 34.719447917, 20.7861495, 447.141369915, 53.9080812396, 40.8695358049 }}, /* 967 K */
+    {{ 32.5105657783, 34.7245246641, 20.7861495, 447.379773204, 53.9207497254, 40.8824955292 }}, /* 968 K */
+    {{ 32.5165282895, 34.7295964538, 20.7861495, 447.617951251, 53.9333955252, 40.8954557372 }}, /* 969 K */
+    {{ 32.5224860775, 34.7346633666, 20.7861495, 447.855905078, 53.9460186797, 40.9084163942 }}, /* 970 K */
+    {{ 32.528439166, 34.7397254833, 20.7861495, 448.093635703, 53.9586192295, 40.9213774654 }}, /* 971 K */
+    {{ 32.5343875794, 34.744782885, 20.7861495, 448.331144145, 53.9711972152, 40.9343389158 }}, /* 972 K */
+    {{ 32.5403313426, 34.749835653, 20.7861495, 448.568431423, 53.9837526772, 40.9473007101 }}, /* 973 K */
+    {{ 32.5462704806, 34.7548838691, 20.7861495, 448.805498554, 53.9962856561, 40.9602628129 }}, /* 974 K */
+    {{ 32.5522050192, 34.7599276152, 20.7861495, 449.042346555, 54.0087961925, 40.9732251887 }}, /* 975 K */
+    {{ 32.5581349845, 34.7649669735, 20.7861495, 449.278976443, 54.0212843267, 40.9861878018 }}, /* 976 K */
+    {{ 32.564060403, 34.7700020265, 20.7861495, 449.515389233, 54.0337500993, 40.9991506161 }}, /* 977 K */
+    {{ 32.5699813018, 34.7750328569, 20.7861495, 449.751585941, 54.0461935505, 41.0121135956 }}, /* 978 K */
+    {{ 32.5758977081, 34.7800595479, 20.7861495, 449.987567581, 54.0586147209, 41.0250767039 }}, /* 979 K */
+    {{ 32.58180965, 34.7850821826, 20.7861495, 450.223335167, 54.0710136508, 41.0380399047 }}, /* 980 K */
+    {{ 32.5877171558, 34.7901008448, 20.7861495, 450.458889713, 54.0833903804, 41.0510031611 }}, /* 981 K */
+    {{ 32.5936202541, 34.7951156183, 20.7861495, 450.694232232, 54.0957449501, 41.0639664365 }}, /* 982 K */
+    {{ 32.5995189742, 34.8001265873, 20.7861495, 450.929363735, 54.1080774002, 41.0769296936 }}, /* 983 K */
+    {{ 32.6054133457, 34.8051338361, 20.7861495, 451.164285234, 54.1203877709, 41.0898928954 }}, /* 984 K */
+    {{ 32.6113033988, 34.8101374495, 20.7861495, 451.398997741, 54.1326761025, 41.1028560043 }}, /* 985 K */
+    {{ 32.617189164, 34.8151375124, 20.7861495, 451.633502265, 54.1449424352, 41.1158189828 }}, /* 986 K */
+    {{ 32.6230706723, 34.8201341101, 20.7861495, 451.867799816, 54.1571868091, 41.1287817932 }}, /* 987 K */
+    {{ 32.628947955, 34.8251273282, 20.7861495, 452.101891404, 54.1694092644, 41.1417443974 }}, /* 988 K */
+    {{ 32.6348210441, 34.8301172523, 20.7861495, 452.335778037, 54.1816098413, 41.1547067573 }}, /* 989 K */
+    {{ 32.6406899718, 34.8351039686, 20.7861495, 452.569460722, 54.1937885798, 41.1676688345 }}, /* 990 K */
+    {{ 32.646554771, 34.8400875634, 20.7861495, 452.802940467, 54.2059455201, 41.1806305906 }}, /* 991 K */
+    {{ 32.6524154749, 34.8450681234, 20.7861495, 453.036218278, 54.2180807022, 41.1935919867 }}, /* 992 K */
+    {{ 32.6582721171, 34.8500457353, 20.7861495, 453.269295162, 54.2301941662, 41.2065529841 }}, /* 993 K */
+    {{ 32.6641247316, 34.8550204865, 20.7861495, 453.502172124, 54.2422859521, 41.2195135435 }}, /* 994 K */
+    {{ 32.6699733532, 34.8599924642, 20.7861495, 453.734850168, 54.2543560998, 41.2324736258 }}, /* 995 K */
+    {{ 32.6758180167, 34.8649617562, 20.7861495, 453.967330299, 54.2664046495, 41.2454331915 }}, /* 996 K */
+    {{ 32.6816587576, 34.8699284505, 20.7861495, 454.199613519, 54.278431641, 41.2583922008 }}, /* 997 K */
+    {{ 32.6874956119, 34.8748926353, 20.7861495, 454.431700832, 54.2904371143, 41.2713506139 }}, /* 998 K */
+    {{ 32.6933286158, 34.8798543992, 20.7861495, 454.663593239, 54.3024211093, 41.2843083909 }}, /* 999 K */
+    {{ 32.699131295, 34.8849083402, 20.7861494947, 454.886247929, 54.3145040823, 41.2971518471 }}, /* 1000 K */
+    {{ 32.704901653, 34.8900446781, 20.7861494855, 455.099695383, 54.326683872, 41.3098846987 }}, /* 1001 K */
+    {{ 32.7106657118, 34.8951656687, 20.7861494764, 455.312989688, 54.3388399355, 41.3226217906 }}, /* 1002 K */
+    {{ 32.7164234654, 34.9002714018, 20.7861494674, 455.526130508, 54.3509723383, 41.3353630415 }}, /* 1003 K */
+    {{ 32.7221749077, 34.9053619668, 20.7861494585, 455.739117511, 54.3630811454, 41.3481083707 }}, /* 1004 K */
+    {{ 32.7279200331, 34.9104374524, 20.7861494498, 455.951950368, 54.3751664215, 41.3608576978 }}, /* 1005 K */
+    {{ 32.733658836, 34.9154979468, 20.7861494412, 456.164628757, 54.3872282314, 41.3736109433 }}, /* 1006 K */
+    {{ 32.7393913107, 34.9205435377, 20.7861494327, 456.377152356, 54.3992666393, 41.3863680278 }}, /* 1007 K */
+    {{ 32.7451174521, 34.9255743122, 20.7861494243, 456.58952085, 54.4112817095, 41.3991288727 }}, /* 1008 K */
+    {{ 32.7508372547, 34.9305903569, 20.786149416, 456.801733927, 54.4232735057, 41.4118933999 }}, /* 1009 K */
+    {{ 32.7565507136, 34.9355917579, 20.7861494079, 457.013791278, 54.4352420918, 41.4246615318 }}, /* 1010 K */
+    {{ 32.7622578237, 34.9405786007, 20.7861493999, 457.2256926, 54.447187531, 41.4374331912 }}, /* 1011 K */
+    {{ 32.7679585801, 34.9455509701, 20.786149392, 457.437437591, 54.4591098867, 41.4502083015 }}, /* 1012 K */
+    {{ 32.7736529783, 34.9505089508, 20.7861493842, 457.649025956, 54.4710092218, 41.4629867867 }}, /* 1013 K */
+    {{ 32.7793410135, 34.9554526267, 20.7861493765, 457.860457401, 54.4828855991, 41.4757685712 }}, /* 1014 K */
+    {{ 32.7850226812, 34.960382081, 20.7861493689, 458.071731637, 54.4947390811, 41.4885535799 }}, /* 1015 K */
+    {{ 32.7906979772, 34.9652973969, 20.7861493614, 458.282848379, 54.5065697302, 41.5013417382 }}, /* 1016 K */
+    {{ 32.7963668971, 34.9701986566, 20.7861493541, 458.493807345, 54.5183776083, 41.5141329721 }}, /* 1017 K */
+    {{ 32.8020294369, 34.9750859421, 20.7861493468, 458.704608256, 54.5301627775, 41.5269272079 }}, /* 1018 K */
+    {{ 32.8076855926, 34.9799593347, 20.7861493397, 458.915250839, 54.5419252993, 41.5397243725 }}, /* 1019 K */
+    {{ 32.8133353603, 34.9848189153, 20.7861493327, 459.125734823, 54.5536652351, 41.5525243934 }}, /* 1020 K */
+    {{ 32.8189787362, 34.9896647643, 20.7861493257, 459.33605994, 54.5653826461, 41.5653271983 }}, /* 1021 K */
+    {{ 32.8246157166, 34.9944969615, 20.7861493189, 459.546225926, 54.5770775934, 41.5781327156 }}, /* 1022 K */
+    {{ 32.8302462981, 34.9993155865, 20.7861493122, 459.756232522, 54.5887501378, 41.5909408742 }}, /* 1023 K */
+    {{ 32.8358704773, 35.0041207181, 20.7861493056, 459.96607947, 54.6004003396, 41.6037516032 }}, /* 1024 K */
+    {{ 32.8414882507, 35.0089124346, 20.7861492991, 460.175766517, 54.6120282594, 41.6165648325 }}, /* 1025 K */
+    {{ 32.8470996153, 35.0136908142, 20.7861492927, 460.385293413, 54.6236339572, 41.6293804923 }}, /* 1026 K */
+    {{ 32.852704568, 35.0184559341, 20.7861492864, 460.594659912, 54.6352174929, 41.6421985133 }}, /* 1027 K */
+    {{ 32.8583031057, 35.0232078715, 20.7861492802, 460.80386577, 54.6467789262, 41.6550188266 }}, /* 1028 K */
+    {{ 32.8638952256, 35.0279467028, 20.7861492741, 461.012910747, 54.6583183166, 41.6678413637 }}, /* 1029 K */
+    {{ 32.8694809249, 35.0326725041, 20.7861492681, 461.221794608, 54.6698357234, 41.6806660569 }}, /* 1030 K */
+    {{ 32.875060201, 35.037385351, 20.7861492621, 461.430517118, 54.6813312056, 41.6934928384 }}, /* 1031 K */
+    {{ 32.8806330514, 35.0420853186, 20.7861492563, 461.639078049, 54.6928048221, 41.7063216414 }}, /* 1032 K */
+    {{ 32.8861994736, 35.0467724815, 20.7861492506, 461.847477172, 54.7042566316, 41.7191523991 }}, /* 1033 K */
+    {{ 32.8917594652, 35.0514469141, 20.786149245, 462.055714265, 54.7156866924, 41.7319850455 }}, /* 1034 K */
+    {{ 32.8973130241, 35.0561086899, 20.7861492395, 462.263789107, 54.7270950628, 41.7448195148 }}, /* 1035 K */
+    {{ 32.902860148, 35.0607578824, 20.786149234, 462.471701481, 54.7384818009, 41.7576557416 }}, /* 1036 K */
+    {{ 32.908400835, 35.0653945644, 20.7861492287, 462.679451172, 54.7498469644, 41.7704936612 }}, /* 1037 K */
+    {{ 32.9139350831, 35.0700188083, 20.7861492234, 462.887037971, 54.761190611, 41.7833332091 }}, /* 1038 K */
+    {{ 32.9194628905, 35.0746306861, 20.7861492182, 463.094461668, 54.7725127981, 41.7961743213 }}, /* 1039 K */
+    {{ 32.9249842554, 35.0792302693, 20.7861492132, 463.301722059, 54.7838135829, 41.8090169342 }}, /* 1040 K */
+    {{ 32.9304991762, 35.083817629, 20.7861492082, 463.508818943, 54.7950930224, 41.8218609847 }}, /* 1041 K */
+    {{ 32.9360076513, 35.0883928359, 20.7861492033, 463.715752119, 54.8063511734, 41.8347064099 }}, /* 1042 K */
+    {{ 32.9415096794, 35.0929559603, 20.7861491985, 463.922521393, 54.8175880926, 41.8475531476 }}, /* 1043 K */
+    {{ 32.947005259, 35.0975070718, 20.7861491937, 464.129126572, 54.8288038364, 41.8604011359 }}, /* 1044 K */
+    {{ 32.9524943889, 35.10204624, 20.7861491891, 464.335567464, 54.8399984609, 41.8732503133 }}, /* 1045 K */
+    {{ 32.9579770678, 35.1065735337, 20.7861491845, 464.541843885, 54.8511720222, 41.8861006186 }}, /* 1046 K */
+    {{ 32.9634532948, 35.1110890216, 20.7861491801, 464.747955648, 54.8623245762, 41.8989519911 }}, /* 1047 K */
+    {{ 32.9689230689, 35.1155927717, 20.7861491757, 464.953902572, 54.8734561784, 41.9118043707 }}, /* 1048 K */
+    {{ 32.9743863891, 35.1200848517, 20.7861491714, 465.15968448, 54.8845668843, 41.9246576973 }}, /* 1049 K */
+    {{ 32.9798432546, 35.1245653291, 20.7861491672, 465.365301195, 54.8956567492, 41.9375119115 }}, /* 1050 K */
+    {{ 32.9852936646, 35.1290342706, 20.786149163, 465.570752545, 54.9067258281, 41.9503669541 }}, /* 1051 K */
+    {{ 32.9907376187, 35.1334917428, 20.786149159, 465.776038359, 54.9177741758, 41.9632227665 }}, /* 1052 K */
+    {{ 32.9961751162, 35.1379378118, 20.786149155, 465.98115847, 54.928801847, 41.9760792903 }}, /* 1053 K */
+    {{ 33.0016061566, 35.1423725432, 20.7861491511, 466.186112712, 54.9398088963, 41.9889364677 }}, /* 1054 K */
+    {{ 33.0070307396, 35.1467960024, 20.7861491472, 466.390900925, 54.9507953778, 42.0017942409 }}, /* 1055 K */
+    {{ 33.0124488649, 35.1512082542, 20.7861491435, 466.595522948, 54.9617613458, 42.0146525529 }}, /* 1056 K */
+    {{ 33.0178605323, 35.1556093632, 20.7861491398, 466.799978625, 54.972706854, 42.0275113469 }}, /* 1057 K */
+    {{ 33.0232657416, 35.1599993934, 20.7861491362, 467.004267802, 54.9836319563, 42.0403705665 }}, /* 1058 K */
+    {{ 33.0286644927, 35.1643784087, 20.7861491327, 467.208390327, 54.9945367062, 42.0532301555 }}, /* 1059 K */
+    {{ 33.0340567858, 35.1687464723, 20.7861491292, 467.412346051, 55.0054211571, 42.0660900584 }}, /* 1060 K */
+    {{ 33.039442621, 35.1731036472, 20.7861491259, 467.616134829, 55.016285362, 42.0789502197 }}, /* 1061 K */
+    {{ 33.0448219984, 35.177449996, 20.7861491226, 467.819756515, 55.0271293741, 42.0918105847 }}, /* 1062 K */
+    {{ 33.0501949182, 35.181785581, 20.7861491193, 468.02321097, 55.0379532461, 42.1046710986 }}, /* 1063 K */
+    {{ 33.055561381, 35.1861104639, 20.7861491162, 468.226498053, 55.0487570306, 42.1175317073 }}, /* 1064 K */
+    {{ 33.060921387, 35.1904247062, 20.7861491131, 468.42961763, 55.0595407801, 42.1303923569 }}, /* 1065 K */
+    {{ 33.0662749368, 35.194728369, 20.7861491101, 468.632569566, 55.0703045468, 42.1432529939 }}, /* 1066 K */
+    {{ 33.0716220309, 35.1990215131, 20.7861491071, 468.835353729, 55.0810483829, 42.1561135653 }}, /* 1067 K */
+    {{ 33.0769626701, 35.2033041988, 20.7861491043, 469.037969991, 55.0917723403, 42.168974018 }}, /* 1068 K */
+    {{ 33.0822968549, 35.207576486, 20.7861491015, 469.240418225, 55.1024764706, 42.1818342998 }}, /* 1069 K */
+    {{ 33.0876245864, 35.2118384345, 20.7861490987, 469.442698307, 55.1131608254, 42.1946943586 }}, /* 1070 K */
+    {{ 33.0929458652, 35.2160901035, 20.786149096, 469.644810115, 55.1238254561, 42.2075541425 }}, /* 1071 K */
+    {{ 33.0982606924, 35.220331552, 20.7861490934, 469.846753529, 55.1344704139, 42.2204136001 }}, /* 1072 K */
+    {{ 33.103569069, 35.2245628385, 20.7861490909, 470.048528433, 55.1450957498, 42.2332726805 }}, /* 1073 K */
+    {{ 33.108870996, 35.2287840212, 20.7861490884, 470.250134712, 55.1557015147, 42.2461313328 }}, /* 1074 K */
+    {{ 33.1141664746, 35.232995158, 20.786149086, 470.451572252, 55.1662877593, 42.2589895067 }}, /* 1075 K */
+    {{ 33.1194555061, 35.2371963065, 20.7861490837, 470.652840944, 55.176854534, 42.2718471521 }}, /* 1076 K */
+    {{ 33.1247380917, 35.2413875238, 20.7861490814, 470.85394068, 55.1874018891, 42.2847042192 }}, /* 1077 K */
+    {{ 33.1300142328, 35.2455688667, 20.7861490792, 471.054871354, 55.1979298749, 42.2975606587 }}, /* 1078 K */
+    {{ 33.1352839309, 35.2497403918, 20.786149077, 471.255632861, 55.2084385413, 42.3104164215 }}, /* 1079 K */
+    {{ 33.1405471874, 35.2539021553, 20.7861490749, 471.456225101, 55.2189279382, 42.3232714589 }}, /* 1080 K */
+    {{ 33.1458040038, 35.2580542129, 20.7861490729, 471.656647975, 55.2293981151, 42.3361257224 }}, /* 1081 K */
+    {{ 33.1510543819, 35.2621966201, 20.7861490709, 471.856901385, 55.2398491216, 42.3489791639 }}, /* 1082 K */
+    {{ 33.1562983233, 35.2663294322, 20.786149069, 472.056985236, 55.250281007, 42.3618317356 }}, /* 1083 K */
+    {{ 33.1615358298, 35.2704527039, 20.7861490671, 472.256899436, 55.2606938205, 42.3746833901 }}, /* 1084 K */
+    {{ 33.1667669031, 35.2745664898, 20.7861490653, 472.456643893, 55.2710876109, 42.3875340802 }}, /* 1085 K */
+    {{ 33.1719915452, 35.278670844, 20.7861490636, 472.65621852, 55.2814624272, 42.400383759 }}, /* 1086 K */
+    {{ 33.177209758, 35.2827658204, 20.7861490619, 472.855623229, 55.291818318, 42.4132323801 }}, /* 1087 K */
+    {{ 33.1824215436, 35.2868514725, 20.7861490603, 473.054857936, 55.3021553317, 42.4260798973 }}, /* 1088 K */
+    {{ 33.1876269039, 35.2909278537, 20.7861490587, 473.253922558, 55.3124735167, 42.4389262645 }}, /* 1089 K */
+    {{ 33.1928258411, 35.2949950166, 20.7861490572, 473.452817015, 55.3227729212, 42.4517714362 }}, /* 1090 K */
+    {{ 33.1980183575, 35.2990530141, 20.7861490557, 473.651541229, 55.3330535931, 42.4646153671 }}, /* 1091 K */
+    {{ 33.2032044552, 35.3031018983, 20.7861490543, 473.850095123, 55.3433155803, 42.4774580122 }}, /* 1092 K */
+    {{ 33.2083841365, 35.3071417211, 20.7861490529, 474.048478622, 55.3535589304, 42.4902993267 }}, /* 1093 K */
+    {{ 33.2135574039, 35.3111725344, 20.7861490516, 474.246691653, 55.363783691, 42.5031392663 }}, /* 1094 K */
+    {{ 33.2187242597, 35.3151943893, 20.7861490504, 474.444734147, 55.3739899095, 42.5159777869 }}, /* 1095 K */
+    {{ 33.2238847064, 35.319207337, 20.7861490492, 474.642606034, 55.3841776329, 42.5288148446 }}, /* 1096 K */
+    {{ 33.2290387466, 35.3232114282, 20.7861490481, 474.840307248, 55.3943469084, 42.5416503959 }}, /* 1097 K */
+    {{ 33.2341863828, 35.3272067134, 20.786149047, 475.037837724, 55.4044977829, 42.5544843975 }}, /* 1098 K */
+    {{ 33.2393276177, 35.3311932426, 20.7861490459, 475.235197398, 55.414630303, 42.5673168066 }}, /* 1099 K */
+    {{ 33.2444624539, 35.3351710658, 20.7861490449, 475.432386209, 55.4247445153, 42.5801475803 }}, /* 1100 K */
+    {{ 33.2495908943, 35.3391402325, 20.786149044, 475.629404098, 55.4348404663, 42.5929766765 }}, /* 1101 K */
+    {{ 33.2547129416, 35.3431007919, 20.7861490431, 475.826251008, 55.4449182021, 42.6058040529 }}, /* 1102 K */
+    {{ 33.2598285988, 35.3470527931, 20.7861490423, 476.022926882, 55.454977769, 42.6186296677 }}, /* 1103 K */
+    {{ 33.2649378686, 35.3509962846, 20.7861490415, 476.219431667, 55.4650192128, 42.6314534793 }}, /* 1104 K */
+    {{ 33.2700407541, 35.354931315, 20.7861490407, 476.41576531, 55.4750425794, 42.6442754467 }}, /* 1105 K */
+    {{ 33.2751372583, 35.3588579322, 20.78614904, 476.611927762, 55.4850479143, 42.6570955286 }}, /* 1106 K */
+    {{ 33.2802273843, 35.3627761841, 20.7861490394, 476.807918973, 55.4950352631, 42.6699136844 }}, /* 1107 K */
+    {{ 33.2853111352, 35.3666861183, 20.7861490388, 477.003738897, 55.5050046712, 42.6827298738 }}, /* 1108 K */
+    {{ 33.290388514, 35.370587782, 20.7861490382, 477.199387488, 55.5149561836, 42.6955440564 }}, /* 1109 K */
+    {{ 33.2954595242, 35.3744812222, 20.7861490377, 477.394864703, 55.5248898455, 42.7083561923 }}, /* 1110 K */
+    {{ 33.3005241688, 35.3783664856, 20.7861490372, 477.5901705, 55.5348057018, 42.721166242 }}, /* 1111 K */
+    {{ 33.3055824513, 35.3822436185, 20.7861490368, 477.785304839, 55.5447037971, 42.7339741661 }}, /* 1112 K */
+    {{ 33.3106343749, 35.3861126673, 20.7861490364, 477.980267681, 55.5545841761, 42.7467799254 }}, /* 1113 K */
+    {{ 33.3156799432, 35.3899736777, 20.7861490361, 478.175058991, 55.5644468833, 42.7595834811 }}, /* 1114 K */
+    {{ 33.3207191595, 35.3938266954, 20.7861490358, 478.369678732, 55.5742919629, 42.7723847946 }}, /* 1115 K */
+    {{ 33.3257520274, 35.3976717656, 20.7861490355, 478.564126871, 55.584119459, 42.7851838275 }}, /* 1116 K */
+    {{ 33.3307785504, 35.4015089336, 20.7861490353, 478.758403376, 55.5939294158, 42.7979805418 }}, /* 1117 K */
+    {{ 33.335798732, 35.405338244, 20.7861490352, 478.952508217, 55.603721877, 42.8107748997 }}, /* 1118 K */
+    {{ 33.340812576, 35.4091597415, 20.786149035, 479.146441365, 55.6134968864, 42.8235668635 }}, /* 1119 K */
+    {{ 33.345820086, 35.4129734703, 20.7861490349, 479.340202793, 55.6232544875, 42.836356396 }}, /* 1120 K */
+    {{ 33.3508212657, 35.4167794745, 20.7861490349, 479.533792475, 55.6329947238, 42.8491434601 }}, /* 1121 K */
+    {{ 33.355816119, 35.4205777977, 20.7861490349, 479.727210387, 55.6427176386, 42.861928019 }}, /* 1122 K */
+    {{ 33.3608046495, 35.4243684836, 20.7861490349, 479.920456507, 55.652423275, 42.874710036 }}, /* 1123 K */
+    {{ 33.3657868612, 35.4281515754, 20.786149035, 480.113530814, 55.6621116761, 42.8874894749 }}, /* 1124 K */
+    {{ 33.370762758, 35.431927116, 20.7861490351, 480.306433287, 55.6717828846, 42.9002662995 }}, /* 1125 K */
+    {{ 33.3757323438, 35.4356951483, 20.7861490352, 480.49916391, 55.6814369433, 42.9130404741 }}, /* 1126 K */
+    {{ 33.3806956226, 35.4394557147, 20.7861490354, 480.691722665, 55.6910738949, 42.925811963 }}, /* 1127 K */
+    {{ 33.3856525984, 35.4432088575, 20.7861490356, 480.884109538, 55.7006937817, 42.9385807308 }}, /* 1128 K */
+    {{ 33.3906032752, 35.4469546186, 20.7861490359, 481.076324514, 55.710296646, 42.9513467424 }}, /* 1129 K */
+    {{ 33.3955476572, 35.4506930399, 20.7861490362, 481.268367582, 55.7198825301, 42.964109963 }}, /* 1130 K */
+    {{ 33.4004857485, 35.4544241629, 20.7861490365, 481.460238731, 55.729451476, 42.9768703578 }}, /* 1131 K */
+    {{ 33.4054175533, 35.4581480287, 20.7861490369, 481.651937951, 55.7390035255, 42.9896278925 }}, /* 1132 K */
+    {{ 33.4103430758, 35.4618646785, 20.7861490373, 481.843465235, 55.7485387204, 43.0023825328 }}, /* 1133 K */
+    {{ 33.4152623203, 35.4655741531, 20.7861490377, 482.034820576, 55.7580571023, 43.0151342448 }}, /* 1134 K */
+    {{ 33.420175291, 35.4692764929, 20.7861490382, 482.226003969, 55.7675587128, 43.0278829947 }}, /* 1135 K */
+    {{ 33.4250819923, 35.4729717383, 20.7861490387, 482.41701541, 55.7770435931, 43.0406287491 }}, /* 1136 K */
+    {{ 33.4299824285, 35.4766599293, 20.7861490392, 482.607854897, 55.7865117845, 43.0533714746 }}, /* 1137 K */
+    {{ 33.4348766042, 35.4803411059, 20.7861490398, 482.798522428, 55.7959633281, 43.0661111382 }}, /* 1138 K */
+    {{ 33.4397645236, 35.4840153076, 20.7861490404, 482.989018005, 55.8053982649, 43.0788477071 }}, /* 1139 K */
+    {{ 33.4446461913, 35.4876825738, 20.786149041, 483.179341627, 55.8148166355, 43.0915811487 }}, /* 1140 K */
+    {{ 33.4495216118, 35.4913429437, 20.7861490417, 483.369493299, 55.8242184809, 43.1043114304 }}, /* 1141 K */
+    {{ 33.4543907896, 35.4949964561, 20.7861490424, 483.559473025, 55.8336038414, 43.1170385203 }}, /* 1142 K */
+    {{ 33.4592537294, 35.4986431498, 20.7861490431, 483.74928081, 55.8429727575, 43.1297623863 }}, /* 1143 K */
+    {{ 33.4641104357, 35.5022830632, 20.7861490439, 483.938916661, 55.8523252696, 43.1424829966 }}, /* 1144 K */
+    {{ 33.4689609132, 35.5059162346, 20.7861490447, 484.128380585, 55.8616614177, 43.1552003198 }}, /* 1145 K */
+    {{ 33.4738051665, 35.509542702, 20.7861490455, 484.317672593, 55.8709812419, 43.1679143246 }}, /* 1146 K */
+    {{ 33.4786432005, 35.5131625032, 20.7861490464, 484.506792695, 55.8802847822, 43.1806249798 }}, /* 1147 K */
+    {{ 33.4834750198, 35.5167756758, 20.7861490473, 484.695740902, 55.8895720782, 43.1933322545 }}, /* 1148 K */
+    {{ 33.4883006292, 35.5203822571, 20.7861490482, 484.884517227, 55.8988431697, 43.2060361181 }}, /* 1149 K */
+    {{ 33.4931200336, 35.5239822844, 20.7861490491, 485.073121686, 55.9080980962, 43.2187365401 }}, /* 1150 K */
+    {{ 33.4979332378, 35.5275757944, 20.7861490501, 485.261554293, 55.917336897, 43.2314334902 }}, /* 1151 K */
+    {{ 33.5027402467, 35.531162824, 20.7861490511, 485.449815065, 55.9265596114, 43.2441269384 }}, /* 1152 K */
+    {{ 33.5075410651, 35.5347434096, 20.7861490521, 485.637904019, 55.9357662787, 43.2568168548 }}, /* 1153 K */
+    {{ 33.512335698, 35.5383175876, 20.7861490531, 485.825821175, 55.9449569377, 43.2695032097 }}, /* 1154 K */
+    {{ 33.5171241505, 35.5418853939, 20.7861490542, 486.013566553, 55.9541316274, 43.2821859737 }}, /* 1155 K */
+    {{ 33.5219064274, 35.5454468646, 20.7861490553, 486.201140174, 55.9632903866, 43.2948651176 }}, /* 1156 K */
+    {{ 33.5266825339, 35.5490020351, 20.7861490564, 486.388542061, 55.9724332539, 43.3075406123 }}, /* 1157 K */
+    {{ 33.5314524749, 35.5525509411, 20.7861490576, 486.575772238, 55.9815602678, 43.3202124289 }}, /* 1158 K */
+    {{ 33.5362162556, 35.5560936177, 20.7861490588, 486.762830728, 55.9906714668, 43.3328805387 }}, /* 1159 K */
+    {{ 33.5409738811, 35.5596301, 20.78614906, 486.949717558, 55.999766889, 43.3455449134 }}, /* 1160 K */
+    {{ 33.5457253566, 35.5631604228, 20.7861490612, 487.136432755, 56.0088465727, 43.3582055247 }}, /* 1161 K */
+    {{ 33.5504706871, 35.5666846208, 20.7861490625, 487.322976347, 56.0179105559, 43.3708623444 }}, /* 1162 K */
+    {{ 33.5552098779, 35.5702027284, 20.7861490638, 487.509348362, 56.0269588765, 43.3835153447 }}, /* 1163 K */
+    {{ 33.5599429343, 35.5737147798, 20.7861490651, 487.695548832, 56.0359915723, 43.3961644979 }}, /* 1164 K */
+    {{ 33.5646698615, 35.5772208092, 20.7861490664, 487.881577788, 56.045008681, 43.4088097765 }}, /* 1165 K */
+    {{ 33.5693906647, 35.5807208502, 20.7861490678, 488.067435261, 56.0540102401, 43.4214511532 }}, /* 1166 K */
+    {{ 33.5741053494, 35.5842149367, 20.7861490691, 488.253121285, 56.062996287, 43.4340886008 }}, /* 1167 K */
+    {{ 33.5788139207, 35.5877031019, 20.7861490705, 488.438635895, 56.0719668591, 43.4467220925 }}, /* 1168 K */
+    {{ 33.5835163841, 35.5911853793, 20.7861490719, 488.623979126, 56.0809219936, 43.4593516013 }}, /* 1169 K */
+    {{ 33.588212745, 35.5946618018, 20.7861490734, 488.809151015, 56.0898617275, 43.4719771009 }}, /* 1170 K */
+    {{ 33.5929030088, 35.5981324024, 20.7861490749, 488.994151598, 56.0987860979, 43.4845985647 }}, /* 1171 K */
+    {{ 33.5975871808, 35.6015972137, 20.7861490763, 489.178980916, 56.1076951415, 43.4972159666 }}, /* 1172 K */
+    {{ 33.6022652667, 35.6050562683, 20.7861490778, 489.363639006, 56.1165888951, 43.5098292806 }}, /* 1173 K */
+    {{ 33.6069372717, 35.6085095984, 20.7861490794, 489.54812591, 56.1254673953, 43.5224384808 }}, /* 1174 K */
+    {{ 33.6116032016, 35.6119572361, 20.7861490809, 489.732441669, 56.1343306786, 43.5350435414 }}, /* 1175 K */
+    {{ 33.6162630617, 35.6153992135, 20.7861490825, 489.916586326, 56.1431787813, 43.5476444371 }}, /* 1176 K */
+    {{ 33.6209168577, 35.6188355622, 20.7861490841, 490.100559923, 56.1520117399, 43.5602411426 }}, /* 1177 K */
+    {{ 33.6255645952, 35.6222663139, 20.7861490857, 490.284362505, 56.1608295903, 43.5728336325 }}, /* 1178 K */
+    {{ 33.6302062796, 35.6256914999, 20.7861490873, 490.467994119, 56.1696323687, 43.5854218821 }}, /* 1179 K */
+    {{ 33.6348419167, 35.6291111514, 20.786149089, 490.651454808, 56.1784201109, 43.5980058665 }}, /* 1180 K */
+    {{ 33.6394715122, 35.6325252995, 20.7861490906, 490.834744622, 56.1871928529, 43.610585561 }}, /* 1181 K */
+    {{ 33.6440950715, 35.635933975, 20.7861490923, 491.017863608, 56.1959506303, 43.6231609413 }}, /* 1182 K */
+    {{ 33.6487126006, 35.6393372086, 20.786149094, 491.200811815, 56.2046934786, 43.635731983 }}, /* 1183 K */
+    {{ 33.653324105, 35.6427350307, 20.7861490958, 491.383589293, 56.2134214335, 43.648298662 }}, /* 1184 K */
+    {{ 33.6579295905, 35.6461274718, 20.7861490975, 491.566196092, 56.2221345301, 43.6608609543 }}, /* 1185 K */
+    {{ 33.6625290629, 35.649514562, 20.7861490993, 491.748632265, 56.2308328039, 43.6734188363 }}, /* 1186 K */
+    {{ 33.6671225279, 35.6528963312, 20.786149101, 491.930897864, 56.2395162899, 43.6859722842 }}, /* 1187 K */
+    {{ 33.6717099913, 35.6562728092, 20.7861491028, 492.112992942, 56.2481850233, 43.6985212746 }}, /* 1188 K */
+    {{ 33.676291459, 35.6596440256, 20.7861491046, 492.294917554, 56.2568390388, 43.7110657842 }}, /* 1189 K */
+    {{ 33.6808669368, 35.66301001, 20.7861491065, 492.476671755, 56.2654783714, 43.7236057899 }}, /* 1190 K */
+    {{ 33.6854364304, 35.6663707916, 20.7861491083, 492.658255601, 56.2741030558, 43.7361412688 }}, /* 1191 K */
+    {{ 33.6899999459, 35.6697263996, 20.7861491102, 492.839669148, 56.2827131265, 43.7486721979 }}, /* 1192 K */
+    {{ 33.6945574891, 35.6730768628, 20.786149112, 493.020912455, 56.2913086181, 43.7611985547 }}, /* 1193 K */
+    {{ 33.6991090659, 35.6764222101, 20.7861491139, 493.20198558, 56.2998895649, 43.7737203167 }}, /* 1194 K */
+    {{ 33.7036546822, 35.6797624701, 20.7861491158, 493.382888582, 56.3084560013, 43.7862374616 }}, /* 1195 K */
+    {{ 33.708194344, 35.6830976712, 20.7861491178, 493.563621521, 56.3170079614, 43.7987499671 }}, /* 1196 K */
+    {{ 33.7127280572, 35.6864278418, 20.7861491197, 493.744184459, 56.3255454793, 43.8112578113 }}, /* 1197 K */
+    {{ 33.7172558279, 35.68975301, 20.7861491217, 493.924577457, 56.334068589, 43.8237609723 }}, /* 1198 K */
+    {{ 33.721777662, 35.6930732038, 20.7861491236, 494.104800578, 56.3425773243, 43.8362594283 }}, /* 1199 K */
+    {{ 33.7262935656, 35.6963884509, 20.7861491256, 494.284853885, 56.351071719, 43.8487531579 }}, /* 1200 K */
+    {{ 33.7308035447, 35.699698779, 20.7861491276, 494.464737441, 56.3595518067, 43.8612421396 }}, /* 1201 K */
+    {{ 33.7353076053, 35.7030042157, 20.7861491296, 494.644451313, 56.3680176209, 43.8737263522 }}, /* 1202 K */
+    {{ 33.7398057535, 35.7063047882, 20.7861491316, 494.823995565, 56.3764691953, 43.8862057745 }}, /* 1203 K */
+    {{ 33.7442979954, 35.7096005238, 20.7861491336, 495.003370264, 56.384906563, 43.8986803857 }}, /* 1204 K */
+    {{ 33.7487843371, 35.7128914494, 20.7861491357, 495.182575478, 56.3933297573, 43.9111501648 }}, /* 1205 K */
+    {{ 33.7532647847, 35.716177592, 20.7861491378, 495.361611273, 56.4017388113, 43.9236150913 }}, /* 1206 K */
+    {{ 33.7577393444, 35.7194589781, 20.7861491398, 495.540477719, 56.4101337582, 43.9360751446 }}, /* 1207 K */
+    {{ 33.7622080223, 35.7227356345, 20.7861491419, 495.719174885, 56.4185146308, 43.9485303044 }}, /* 1208 K */
+    {{ 33.7666708246, 35.7260075875, 20.786149144, 495.897702841, 56.4268814619, 43.9609805504 }}, /* 1209 K */
+    {{ 33.7711277574, 35.7292748634, 20.7861491461, 496.076061657, 56.4352342843, 43.9734258625 }}, /* 1210 K */
+    {{ 33.7755788269, 35.7325374883, 20.7861491482, 496.254251406, 56.4435731307, 43.9858662209 }}, /* 1211 K */
+    {{ 33.7800240394, 35.7357954881, 20.7861491504, 496.43227216, 56.4518980335, 43.9983016057 }}, /* 1212 K */
+    {{ 33.7844634011, 35.7390488887, 20.7861491525, 496.61012399, 56.4602090252, 44.0107319973 }}, /* 1213 K */
+    {{ 33.7888969182, 35.7422977157, 20.7861491547, 496.787806972, 56.4685061382, 44.0231573761 }}, /* 1214 K */
+    {{ 33.793324597, 35.7455419946, 20.7861491568, 496.965321178, 56.4767894046, 44.0355777228 }}, /* 1215 K */
+    {{ 33.7977464437, 35.7487817509, 20.786149159, 497.142666685, 56.4850588566, 44.0479930181 }}, /* 1216 K */
+    {{ 33.8021624646, 35.7520170097, 20.7861491612, 497.319843568, 56.4933145263, 44.060403243 }}, /* 1217 K */
+    {{ 33.806572666, 35.7552477961, 20.7861491634, 497.496851902, 56.5015564455, 44.0728083785 }}, /* 1218 K */
+    {{ 33.8109770542, 35.758474135, 20.7861491656, 497.673691765, 56.5097846462, 44.0852084057 }}, /* 1219 K */
+    {{ 33.8153756356, 35.7616960514, 20.7861491678, 497.850363235, 56.5179991601, 44.097603306 }}, /* 1220 K */
+    {{ 33.8197684164, 35.7649135697, 20.78614917, 498.026866389, 56.5262000188, 44.1099930609 }}, /* 1221 K */
+    {{ 33.8241554031, 35.7681267146, 20.7861491723, 498.203201307, 56.5343872538, 44.1223776518 }}, /* 1222 K */
+    {{ 33.8285366019, 35.7713355103, 20.7861491745, 498.379368068, 56.5425608968, 44.1347570606 }}, /* 1223 K */
+    {{ 33.8329120192, 35.7745399813, 20.7861491768, 498.555366752, 56.5507209789, 44.147131269 }}, /* 1224 K */
+    {{ 33.8372816615, 35.7777401514, 20.786149179, 498.73119744, 56.5588675315, 44.159500259 }}, /* 1225 K */
+    {{ 33.841645535, 35.7809360448, 20.7861491813, 498.906860213, 56.5670005858, 44.1718640128 }}, /* 1226 K */
+    {{ 33.8460036463, 35.7841276851, 20.7861491836, 499.082355154, 56.5751201728, 44.1842225125 }}, /* 1227 K */
+    {{ 33.8503560018, 35.7873150962, 20.7861491859, 499.257682344, 56.5832263235, 44.1965757406 }}, /* 1228 K */
+    {{ 33.8547026078, 35.7904983016, 20.7861491882, 499.432841867, 56.5913190688, 44.2089236795 }}, /* 1229 K */
+    {{ 33.8590434707, 35.7936773246, 20.7861491905, 499.607833807, 56.5993984395, 44.2212663118 }}, /* 1230 K */
+    {{ 33.8633785972, 35.7968521886, 20.7861491928, 499.782658248, 56.6074644664, 44.2336036203 }}, /* 1231 K */
+    {{ 33.8677079935, 35.8000229167, 20.7861491951, 499.957315275, 56.61551718, 44.2459355879 }}, /* 1232 K */
+    {{ 33.8720316663, 35.803189532, 20.7861491974, 500.131804974, 56.6235566108, 44.2582621976 }}, /* 1233 K */
+    {{ 33.8763496219, 35.8063520572, 20.7861491997, 500.30612743, 56.6315827894, 44.2705834325 }}, /* 1234 K */
+    {{ 33.8806618668, 35.8095105153, 20.7861492021, 500.48028273, 56.6395957459, 44.2828992757 }}, /* 1235 K */
+    {{ 33.8849684076, 35.8126649288, 20.7861492044, 500.654270962, 56.6475955107, 44.2952097108 }}, /* 1236 K */
+    {{ 33.8892692508, 35.8158153202, 20.7861492068, 500.828092213, 56.6555821139, 44.3075147212 }}, /* 1237 K */
+    {{ 33.8935644029, 35.818961712, 20.7861492091, 501.001746572, 56.6635555857, 44.3198142905 }}, /* 1238 K */
+    {{ 33.8978538704, 35.8221041262, 20.7861492115, 501.175234127, 56.6715159559, 44.3321084024 }}, /* 1239 K */
+    {{ 33.9021376598, 35.8252425851, 20.7861492139, 501.348554968, 56.6794632544, 44.3443970408 }}, /* 1240 K */
+    {{ 33.9064157778, 35.8283771107, 20.7861492163, 501.521709184, 56.6873975111, 44.3566801896 }}, /* 1241 K */
+    {{ 33.9106882308, 35.8315077248, 20.7861492186, 501.694696867, 56.6953187556, 44.368957833 }}, /* 1242 K */
+    {{ 33.9149550255, 35.8346344492, 20.786149221, 501.867518107, 56.7032270176, 44.3812299551 }}, /* 1243 K */
+    {{ 33.9192161684, 35.8377573054, 20.7861492234, 502.040172996, 56.7111223266, 44.3934965404 }}, /* 1244 K */
+    {{ 33.923471666, 35.8408763151, 20.7861492258, 502.212661625, 56.7190047121, 44.4057575731 }}, /* 1245 K */
+    {{ 33.9277215251, 35.8439914995, 20.7861492282, 502.384984087, 56.7268742033, 44.4180130379 }}, /* 1246 K */
+    {{ 33.9319657522, 35.8471028799, 20.7861492306, 502.557140476, 56.7347308296, 44.4302629195 }}, /* 1247 K */
+    {{ 33.9362043538, 35.8502104774, 20.7861492331, 502.729130884, 56.7425746201, 44.4425072026 }}, /* 1248 K */
+    {{ 33.9404373367, 35.8533143132, 20.7861492355, 502.900955406, 56.750405604, 44.4547458722 }}, /* 1249 K */
+    {{ 33.9446647075, 35.8564144079, 20.7861492379, 503.072614137, 56.7582238102, 44.4669789132 }}, /* 1250 K */
+    {{ 33.9488864727, 35.8595107825, 20.7861492403, 503.24410717, 56.7660292677, 44.4792063107 }}, /* 1251 K */
+    {{ 33.953102639, 35.8626034576, 20.7861492428, 503.415434603, 56.7738220052, 44.4914280501 }}, /* 1252 K */
+    {{ 33.957313213, 35.8656924538, 20.7861492452, 503.58659653, 56.7816020516, 44.5036441167 }}, /* 1253 K */
+    {{ 33.9615182015, 35.8687777913, 20.7861492476, 503.757593048, 56.7893694355, 44.5158544958 }}, /* 1254 K */
+    {{ 33.9657176111, 35.8718594907, 20.7861492501, 503.928424254, 56.7971241855, 44.5280591732 }}, /* 1255 K */
+    {{ 33.9699114484, 35.8749375719, 20.7861492525, 504.099090245, 56.80486633, 44.5402581344 }}, /* 1256 K */
+    {{ 33.9740997202, 35.8780120552, 20.786149255, 504.269591119, 56.8125958975, 44.5524513653 }}, /* 1257 K */
+    {{ 33.978282433, 35.8810829605, 20.7861492574, 504.439926975, 56.8203129164, 44.5646388517 }}, /* 1258 K */
+    {{ 33.9824595936, 35.8841503077, 20.7861492599, 504.610097911, 56.8280174147, 44.5768205797 }}, /* 1259 K */
+    {{ 33.9866312087, 35.8872141164, 20.7861492623, 504.780104025, 56.8357094208, 44.5889965353 }}, /* 1260 K */
+    {{ 33.990797285, 35.8902744063, 20.7861492648, 504.949945419, 56.8433889626, 44.6011667047 }}, /* 1261 K */
+    {{ 33.9949578292, 35.893331197, 20.7861492673, 505.119622191, 56.8510560682, 44.6133310744 }}, /* 1262 K */
+    {{ 33.999112848, 35.8963845078, 20.7861492697, 505.289134442, 56.8587107655, 44.6254896306 }}, /* 1263 K */
+    {{ 34.0032623481, 35.8994343579, 20.7861492722, 505.458482273, 56.8663530823, 44.63764236 }}, /* 1264 K */
+    {{ 34.0074063362, 35.9024807667, 20.7861492747, 505.627665786, 56.8739830463, 44.6497892492 }}, /* 1265 K */
+    {{ 34.0115448191, 35.9055237532, 20.7861492772, 505.796685081, 56.8816006853, 44.6619302848 }}, /* 1266 K */
+    {{ 34.0156778035, 35.9085633363, 20.7861492796, 505.965540261, 56.8892060267, 44.6740654537 }}, /* 1267 K */
+    {{ 34.0198052962, 35.9115995349, 20.7861492821, 506.134231429, 56.8967990982, 44.6861947429 }}, /* 1268 K */
+    {{ 34.0239273038, 35.9146323678, 20.7861492846, 506.302758687, 56.904379927, 44.6983181395 }}, /* 1269 K */
+    {{ 34.0280438332, 35.9176618536, 20.7861492871, 506.471122139, 56.9119485407, 44.7104356304 }}, /* 1270 K */
+    {{ 34.0321548911, 35.9206880108, 20.7861492896, 506.639321889, 56.9195049663, 44.722547203 }}, /* 1271 K */
+    {{ 34.0362604842, 35.9237108579, 20.7861492921, 506.80735804, 56.9270492311, 44.7346528446 }}, /* 1272 K */
+    {{ 34.0403606193, 35.9267304133, 20.7861492945, 506.975230697, 56.9345813622, 44.7467525427 }}, /* 1273 K */
+    {{ 34.0444553032, 35.929746695, 20.786149297, 507.142939965, 56.9421013867, 44.7588462847 }}, /* 1274 K */
+    {{ 34.0485445427, 35.9327597214, 20.7861492995, 507.310485949, 56.9496093314, 44.7709340584 }}, /* 1275 K */
+    {{ 34.0526283445, 35.9357695103, 20.786149302, 507.477868755, 56.9571052233, 44.7830158513 }}, /* 1276 K */
+    {{ 34.0567067154, 35.9387760797, 20.7861493045, 507.645088488, 56.964589089, 44.7950916515 }}, /* 1277 K */
+    {{ 34.0607796622, 35.9417794475, 20.786149307, 507.812145256, 56.9720609554, 44.8071614467 }}, /* 1278 K */
+    {{ 34.0648471916, 35.9447796313, 20.7861493095, 507.979039164, 56.979520849, 44.8192252249 }}, /* 1279 K */
+    {{ 34.0689093105, 35.9477766488, 20.786149312, 508.145770321, 56.9869687965, 44.8312829744 }}, /* 1280 K */
+    {{ 34.0729660257, 35.9507705174, 20.7861493145, 508.312338832, 56.9944048242, 44.8433346833 }}, /* 1281 K */
+    {{ 34.077017344, 35.9537612547, 20.786149317, 508.478744807, 57.0018289586, 44.8553803398 }}, /* 1282 K */
+    {{ 34.0810632721, 35.9567488779, 20.7861493195, 508.644988352, 57.009241226, 44.8674199325 }}, /* 1283 K */
+    {{ 34.0851038169, 35.9597334042, 20.786149322, 508.811069578, 57.0166416526, 44.8794534497 }}, /* 1284 K */
+    {{ 34.0891389852, 35.9627148508, 20.7861493244, 508.976988592, 57.0240302647, 44.89148088 }}, /* 1285 K */
+    {{ 34.0931687837, 35.9656932346, 20.7861493269, 509.142745503, 57.0314070882, 44.9035022121 }}, /* 1286 K */
+    {{ 34.0971932193, 35.9686685727, 20.7861493294, 509.308340422, 57.0387721493, 44.9155174348 }}, /* 1287 K */
+    {{ 34.1012122989, 35.9716408819, 20.7861493319, 509.473773457, 57.0461254739, 44.9275265369 }}, /* 1288 K */
+    {{ 34.1052260292, 35.9746101788, 20.7861493344, 509.63904472, 57.0534670878, 44.9395295073 }}, /* 1289 K */
+    {{ 34.1092344171, 35.9775764802, 20.7861493369, 509.80415432, 57.0607970168, 44.951526335 }}, /* 1290 K */
+    {{ 34.1132374693, 35.9805398026, 20.7861493394, 509.969102368, 57.0681152867, 44.9635170092 }}, /* 1291 K */
+    {{ 34.1172351928, 35.9835001624, 20.7861493419, 510.133888976, 57.0754219231, 44.9755015191 }}, /* 1292 K */
+    {{ 34.1212275942, 35.9864575761, 20.7861493444, 510.298514254, 57.0827169515, 44.987479854 }}, /* 1293 K */
+    {{ 34.1252146806, 35.9894120598, 20.7861493469, 510.462978315, 57.0900003975, 44.9994520031 }}, /* 1294 K */
+    {{ 34.1291964586, 35.9923636298, 20.7861493493, 510.62728127, 57.0972722865, 45.0114179561 }}, /* 1295 K */
+    {{ 34.1331729352, 35.9953123022, 20.7861493518, 510.791423232, 57.1045326438, 45.0233777024 }}, /* 1296 K */
+    {{ 34.1371441172, 35.9982580929, 20.7861493543, 510.955404313, 57.1117814948, 45.0353312317 }}, /* 1297 K */
+    {{ 34.1411100113, 36.0012010179, 20.7861493568, 511.119224627, 57.1190188645, 45.0472785336 }}, /* 1298 K */
+    {{ 34.1450706246, 36.0041410929, 20.7861493593, 511.282884286, 57.1262447782, 45.0592195981 }}, /* 1299 K */
+    {{ 34.1490259637, 36.0070783338, 20.7861493618, 511.446383404, 57.133459261, 45.0711544149 }}, /* 1300 K */
+    {{ 34.1529760355, 36.0100127561, 20.7861493642, 511.609722094, 57.1406623377, 45.0830829741 }}, /* 1301 K */
+    {{ 34.1569208469, 36.0129443754, 20.7861493667, 511.772900472, 57.1478540333, 45.0950052656 }}, /* 1302 K */
+    {{ 34.1608604047, 36.0158732071, 20.7861493692, 511.93591865, 57.1550343727, 45.1069212797 }}, /* 1303 K */
+    {{ 34.1647947158, 36.0187992667, 20.7861493716, 512.098776744, 57.1622033807, 45.1188310066 }}, /* 1304 K */
+    {{ 34.168723787, 36.0217225694, 20.7861493741, 512.261474869, 57.1693610818, 45.1307344365 }}, /* 1305 K */
+    {{ 34.1726476252, 36.0246431304, 20.7861493766, 512.424013139, 57.1765075009, 45.1426315599 }}, /* 1306 K */
+    {{ 34.1765662372, 36.0275609648, 20.786149379, 512.58639167, 57.1836426624, 45.1545223671 }}, /* 1307 K */
+    {{ 34.1804796298, 36.0304760877, 20.7861493815, 512.748610578, 57.1907665908, 45.1664068488 }}, /* 1308 K */
+    {{ 34.18438781, 36.033388514, 20.786149384, 512.910669979, 57.1978793106, 45.1782849955 }}, /* 1309 K */
+    {{ 34.1882907845, 36.0362982586, 20.7861493864, 513.072569989, 57.2049808461, 45.1901567981 }}, /* 1310 K */
+    {{ 34.1921885603, 36.0392053362, 20.7861493889, 513.234310723, 57.2120712216, 45.2020222471 }}, /* 1311 K */
+    {{ 34.1960811441, 36.0421097615, 20.7861493913, 513.3958923, 57.2191504613, 45.2138813335 }}, /* 1312 K */
+    {{ 34.1999685428, 36.0450115492, 20.7861493938, 513.557314835, 57.2262185894, 45.2257340483 }}, /* 1313 K */
+    {{ 34.2038507633, 36.0479107138, 20.7861493962, 513.718578447, 57.2332756299, 45.2375803824 }}, /* 1314 K */
+    {{ 34.2077278124, 36.0508072696, 20.7861493987, 513.879683252, 57.2403216068, 45.249420327 }}, /* 1315 K */
+    {{ 34.211599697, 36.0537012312, 20.7861494011, 514.040629368, 57.2473565442, 45.2612538731 }}, /* 1316 K */
+    {{ 34.2154664239, 36.0565926127, 20.7861494035, 514.201416913, 57.2543804658, 45.2730810121 }}, /* 1317 K */
+    {{ 34.219328, 36.0594814284, 20.786149406, 514.362046004, 57.2613933954, 45.2849017353 }}, /* 1318 K */
+    {{ 34.2231844321, 36.0623676924, 20.7861494084, 514.522516762, 57.2683953569, 45.296716034 }}, /* 1319 K */
+    {{ 34.2270357271, 36.0652514186, 20.7861494108, 514.682829303, 57.2753863739, 45.3085238997 }}, /* 1320 K */
+    {{ 34.2308818918, 36.0681326212, 20.7861494132, 514.842983747, 57.2823664699, 45.320325324 }}, /* 1321 K */
+    {{ 34.2347229331, 36.071011314, 20.7861494157, 515.002980213, 57.2893356686, 45.3321202985 }}, /* 1322 K */
+    {{ 34.2385588579, 36.0738875107, 20.7861494181, 515.162818819, 57.2962939933, 45.3439088148 }}, /* 1323 K */
+    {{ 34.2423896729, 36.0767612251, 20.7861494205, 515.322499686, 57.3032414676, 45.3556908648 }}, /* 1324 K */
+    {{ 34.2462153851, 36.0796324709, 20.7861494229, 515.482022934, 57.3101781147, 45.3674664403 }}, /* 1325 K */
+    {{ 34.2500360012, 36.0825012615, 20.7861494253, 515.641388681, 57.3171039579, 45.3792355331 }}, /* 1326 K */
+    {{ 34.2538515282, 36.0853676106, 20.7861494277, 515.800597048, 57.3240190205, 45.3909981353 }}, /* 1327 K */
+    {{ 34.2576619728, 36.0882315315, 20.7861494301, 515.959648155, 57.3309233255, 45.4027542389 }}, /* 1328 K */
+    {{ 34.261467342, 36.0910930376, 20.7861494325, 516.118542123, 57.3378168961, 45.414503836 }}, /* 1329 K */
+    {{ 34.2652676425, 36.0939521422, 20.7861494349, 516.277279073, 57.3446997552, 45.4262469189 }}, /* 1330 K */
+    {{ 34.2690628812, 36.0968088583, 20.7861494372, 516.435859124, 57.3515719258, 45.4379834797 }}, /* 1331 K */
+    {{ 34.272853065, 36.0996631993, 20.7861494396, 516.5942824, 57.3584334309, 45.4497135108 }}, /* 1332 K */
+    {{ 34.2766382007, 36.102515178, 20.786149442, 516.752549019, 57.3652842931, 45.4614370047 }}, /* 1333 K */
+    {{ 34.2804182951, 36.1053648074, 20.7861494444, 516.910659105, 57.3721245353, 45.4731539538 }}, /* 1334 K */
+    {{ 34.284193355, 36.1082121006, 20.7861494467, 517.068612779, 57.3789541802, 45.4848643505 }}, /* 1335 K */
+    {{ 34.2879633874, 36.1110570702, 20.7861494491, 517.226410162, 57.3857732504, 45.4965681877 }}, /* 1336 K */
+    {{ 34.291728399, 36.113899729, 20.7861494514, 517.384051376, 57.3925817685, 45.5082654578 }}, /* 1337 K */
+    {{ 34.2954883966, 36.1167400897, 20.7861494538, 517.541536544, 57.3993797569, 45.5199561536 }}, /* 1338 K */
+    {{ 34.2992433872, 36.119578165, 20.7861494561, 517.698865788, 57.4061672382, 45.5316402681 }}, /* 1339 K */
+    {{ 34.3029933774, 36.1224139673, 20.7861494585, 517.856039231, 57.4129442346, 45.5433177939 }}, /* 1340 K */
+    {{ 34.3067383743, 36.1252475091, 20.7861494608, 518.013056995, 57.4197107686, 45.5549887242 }}, /* 1341 K */
+    {{ 34.3104783845, 36.1280788028, 20.7861494631, 518.169919203, 57.4264668622, 45.5666530518 }}, /* 1342 K */
+    {{ 34.3142134149, 36.1309078608, 20.7861494655, 518.326625978, 57.4332125379, 45.5783107699 }}, /* 1343 K */
+    {{ 34.3179434723, 36.1337346952, 20.7861494678, 518.483177444, 57.4399478176, 45.5899618715 }}, /* 1344 K */
+    {{ 34.3216685635, 36.1365593183, 20.7861494701, 518.639573723, 57.4466727235, 45.60160635 }}, /* 1345 K */
+    {{ 34.3253886955, 36.1393817422, 20.7861494724, 518.795814939, 57.4533872776, 45.6132441985 }}, /* 1346 K */
+    {{ 34.3291038748, 36.142201979, 20.7861494747, 518.951901216, 57.4600915017, 45.6248754104 }}, /* 1347 K */
+    {{ 34.3328141085, 36.1450200405, 20.786149477, 519.107832678, 57.4667854179, 45.6364999791 }}, /* 1348 K */
+    {{ 34.3365194033, 36.1478359387, 20.7861494793, 519.263609448, 57.4734690478, 45.6481178981 }}, /* 1349 K */
+    {{ 34.3402197659, 36.1506496856, 20.7861494816, 519.419231651, 57.4801424134, 45.6597291608 }}, /* 1350 K */
+    {{ 34.3439152033, 36.1534612927, 20.7861494839, 519.574699411, 57.4868055362, 45.6713337609 }}, /* 1351 K */
+    {{ 34.3476057222, 36.1562707719, 20.7861494861, 519.730012853, 57.493458438, 45.6829316919 }}, /* 1352 K */
+    {{ 34.3512913294, 36.1590781348, 20.7861494884, 519.8851721, 57.5001011403, 45.6945229477 }}, /* 1353 K */
+    {{ 34.3549720316, 36.161883393, 20.7861494907, 520.040177278, 57.5067336646, 45.7061075219 }}, /* 1354 K */
+    {{ 34.3586478358, 36.1646865579, 20.7861494929, 520.195028512, 57.5133560325, 45.7176854084 }}, /* 1355 K */
+    {{ 34.3623187487, 36.1674876411, 20.7861494952, 520.349725927, 57.5199682652, 45.7292566011 }}, /* 1356 K */
+    {{ 34.365984777, 36.1702866538, 20.7861494974, 520.504269647, 57.5265703843, 45.7408210939 }}, /* 1357 K */
+    {{ 34.3696459276, 36.1730836075, 20.7861494997, 520.658659798, 57.5331624108, 45.7523788809 }}, /* 1358 K */
+    {{ 34.3733022073, 36.1758785134, 20.7861495019, 520.812896505, 57.5397443662, 45.7639299561 }}, /* 1359 K */
+    {{ 34.3769536227, 36.1786713827, 20.7861495041, 520.966979894, 57.5463162715, 45.7754743136 }}, /* 1360 K */
+    {{ 34.3806001808, 36.1814622264, 20.7861495064, 521.12091009, 57.552878148, 45.7870119477 }}, /* 1361 K */
+    {{ 34.3842418882, 36.1842510557, 20.7861495086, 521.27468722, 57.5594300165, 45.7985428525 }}, /* 1362 K */
+    {{ 34.3878787517, 36.1870378815, 20.7861495108, 521.428311408, 57.5659718982, 45.8100670224 }}, /* 1363 K */
+    {{ 34.3915107782, 36.1898227149, 20.786149513, 521.581782782, 57.5725038139, 45.8215844518 }}, /* 1364 K */
+    {{ 34.3951379743, 36.1926055666, 20.7861495152, 521.735101467, 57.5790257846, 45.833095135 }}, /* 1365 K */
+    {{ 34.3987603469, 36.1953864474, 20.7861495174, 521.888267589, 57.5855378311, 45.8445990665 }}, /* 1366 K */
+    {{ 34.4023779026, 36.1981653683, 20.7861495196, 522.041281275, 57.5920399741, 45.8560962409 }}, /* 1367 K */
+    {{ 34.4059906483, 36.2009423397, 20.7861495218, 522.194142651, 57.5985322344, 45.8675866528 }}, /* 1368 K */
+    {{ 34.4095985907, 36.2037173724, 20.7861495239, 522.346851844, 57.6050146326, 45.8790702968 }}, /* 1369 K */
+    {{ 34.4132017364, 36.2064904769, 20.7861495261, 522.499408981, 57.6114871893, 45.8905471676 }}, /* 1370 K */
+    {{ 34.4168000924, 36.2092616638, 20.7861495283, 522.651814188, 57.6179499251, 45.9020172599 }}, /* 1371 K */
+    {{ 34.4203936653, 36.2120309434, 20.7861495304, 522.804067591, 57.6244028605, 45.9134805687 }}, /* 1372 K */
+    {{ 34.4239824618, 36.2147983262, 20.7861495326, 522.956169319, 57.6308460158, 45.9249370887 }}, /* 1373 K */
+    {{ 34.4275664886, 36.2175638226, 20.7861495347, 523.108119499, 57.6372794115, 45.9363868148 }}, /* 1374 K */
+    {{ 34.4311457526, 36.2203274427, 20.7861495368, 523.259918256, 57.6437030678, 45.9478297422 }}, /* 1375 K */
+    {{ 34.4347202604, 36.2230891968, 20.786149539, 523.41156572, 57.6501170052, 45.9592658657 }}, /* 1376 K */
+    {{ 34.4382900187, 36.2258490951, 20.7861495411, 523.563062016, 57.6565212437, 45.9706951804 }}, /* 1377 K */
+    {{ 34.4418550343, 36.2286071476, 20.7861495432, 523.714407273, 57.6629158035, 45.9821176816 }}, /* 1378 K */
+    {{ 34.4454153139, 36.2313633644, 20.7861495453, 523.865601618, 57.6693007047, 45.9935333644 }}, /* 1379 K */
+    {{ 34.4489708641, 36.2341177555, 20.7861495474, 524.016645179, 57.6756759674, 46.004942224 }}, /* 1380 K */
+    {{ 34.4525216917, 36.2368703308, 20.7861495495, 524.167538084, 57.6820416115, 46.0163442558 }}, /* 1381 K */
+    {{ 34.4560678034, 36.2396211002, 20.7861495516, 524.31828046, 57.688397657, 46.027739455 }}, /* 1382 K */
+    {{ 34.4596092058, 36.2423700735, 20.7861495537, 524.468872435, 57.6947441238, 46.0391278172 }}, /* 1383 K */
+    {{ 34.4631459057, 36.2451172604, 20.7861495557, 524.619314137, 57.7010810318, 46.0505093377 }}, /* 1384 K */
+    {{ 34.4666779097, 36.2478626707, 20.7861495578, 524.769605695, 57.7074084006, 46.061884012 }}, /* 1385 K */
+    {{ 34.4702052246, 36.2506063141, 20.7861495599, 524.919747237, 57.71372625, 46.0732518357 }}, /* 1386 K */
+    {{ 34.4737278569, 36.2533482, 20.7861495619, 525.06973889, 57.7200345997, 46.0846128045 }}, /* 1387 K */
+    {{ 34.4772458134, 36.256088338, 20.7861495639, 525.219580784, 57.7263334693, 46.0959669139 }}, /* 1388 K */
+    {{ 34.4807591008, 36.2588267377, 20.786149566, 525.369273046, 57.7326228784, 46.1073141597 }}, /* 1389 K */
+    {{ 34.4842677256, 36.2615634085, 20.786149568, 525.518815804, 57.7389028464, 46.1186545376 }}, /* 1390 K */
+    {{ 34.4877716946, 36.2642983597, 20.78614957, 525.668209189, 57.7451733929, 46.1299880435 }}, /* 1391 K */
+    {{ 34.4912710145, 36.2670316006, 20.786149572, 525.817453327, 57.7514345373, 46.1413146731 }}, /* 1392 K */
+    {{ 34.4947656917, 36.2697631406, 20.786149574, 525.966548349, 57.7576862988, 46.1526344225 }}, /* 1393 K */
+    {{ 34.4982557331, 36.2724929888, 20.786149576, 526.115494382, 57.7639286969, 46.1639472875 }}, /* 1394 K */
+    {{ 34.5017411452, 36.2752211545, 20.786149578, 526.264291555, 57.7701617507, 46.1752532641 }}, /* 1395 K */
+    {{ 34.5052219348, 36.2779476467, 20.78614958, 526.412939997, 57.7763854794, 46.1865523485 }}, /* 1396 K */
+    {{ 34.5086981083, 36.2806724744, 20.786149582, 526.561439838, 57.7825999023, 46.1978445366 }}, /* 1397 K */
+    {{ 34.5121696724, 36.2833956468, 20.786149584, 526.709791205, 57.7888050384, 46.2091298247 }}, /* 1398 K */
+    {{ 34.5156366338, 36.2861171727, 20.7861495859, 526.857994229, 57.7950009067, 46.2204082089 }}, /* 1399 K */
+    {{ 34.5190989991, 36.2888370611, 20.7861495879, 527.006049038, 57.8011875262, 46.2316796855 }}, /* 1400 K */
+    {{ 34.5225567749, 36.2915553208, 20.7861495898, 527.153955761, 57.807364916, 46.2429442507 }}, /* 1401 K */
+    {{ 34.5260099677, 36.2942719607, 20.7861495918, 527.301714529, 57.8135330948, 46.2542019009 }}, /* 1402 K */
+    {{ 34.5294585842, 36.2969869894, 20.7861495937, 527.449325469, 57.8196920816, 46.2654526325 }}, /* 1403 K */
+    {{ 34.532902631, 36.2997004157, 20.7861495956, 527.596788711, 57.8258418951, 46.2766964419 }}, /* 1404 K */
+    {{ 34.5363421147, 36.3024122482, 20.7861495975, 527.744104385, 57.831982554, 46.2879333256 }}, /* 1405 K */
+    {{ 34.5397770419, 36.3051224956, 20.7861495994, 527.89127262, 57.8381140772, 46.2991632801 }}, /* 1406 K */
+    {{ 34.543207419, 36.3078311664, 20.7861496013, 528.038293545, 57.8442364831, 46.3103863018 }}, /* 1407 K */
+    {{ 34.5466332528, 36.3105382691, 20.7861496032, 528.18516729, 57.8503497904, 46.3216023876 }}, /* 1408 K */
+    {{ 34.5500545498, 36.3132438122, 20.7861496051, 528.331893985, 57.8564540176, 46.3328115339 }}, /* 1409 K */
+    {{ 34.5534713165, 36.3159478041, 20.786149607, 528.478473759, 57.8625491833, 46.3440137376 }}, /* 1410 K */
+    {{ 34.5568835595, 36.3186502531, 20.7861496089, 528.624906742, 57.8686353059, 46.3552089953 }}, /* 1411 K */
+    {{ 34.5602912854, 36.3213511676, 20.7861496107, 528.771193063, 57.8747124038, 46.3663973038 }}, /* 1412 K */
+    {{ 34.5636945006, 36.3240505558, 20.7861496126, 528.917332852, 57.8807804953, 46.3775786599 }}, /* 1413 K */
+    {{ 34.5670932118, 36.3267484259, 20.7861496144, 529.063326239, 57.8868395987, 46.3887530606 }}, /* 1414 K */
+    {{ 34.5704874255, 36.3294447862, 20.7861496163, 529.209173354, 57.8928897323, 46.3999205027 }}, /* 1415 K */
+    {{ 34.5738771482, 36.3321396447, 20.7861496181, 529.354874326, 57.8989309143, 46.4110809832 }}, /* 1416 K */
+    {{ 34.5772623865, 36.3348330096, 20.7861496199, 529.500429286, 57.9049631629, 46.422234499 }}, /* 1417 K */
+    {{ 34.5806431468, 36.3375248888, 20.7861496217, 529.645838362, 57.9109864961, 46.4333810474 }}, /* 1418 K */
+    {{ 34.5840194357, 36.3402152904, 20.7861496235, 529.791101686, 57.917000932, 46.4445206252 }}, /* 1419 K */
+    {{ 34.5873912596, 36.3429042222, 20.7861496253, 529.936219387, 57.9230064886, 46.4556532297 }}, /* 1420 K */
+    {{ 34.5907586252, 36.3455916922, 20.7861496271, 530.081191595, 57.9290031839, 46.4667788579 }}, /* 1421 K */
+    {{ 34.5941215388, 36.3482777083, 20.7861496289, 530.22601844, 57.9349910359, 46.4778975072 }}, /* 1422 K */
+    {{ 34.5974800071, 36.3509622782, 20.7861496307, 530.370700052, 57.9409700623, 46.4890091748 }}, /* 1423 K */
+    {{ 34.6008340364, 36.3536454097, 20.7861496324, 530.515236562, 57.946940281, 46.5001138579 }}, /* 1424 K */
+    {{ 34.6041836332, 36.3563271106, 20.7861496342, 530.659628098, 57.9529017098, 46.511211554 }}, /* 1425 K */
+    {{ 34.607528804, 36.3590073884, 20.7861496359, 530.803874791, 57.9588543664, 46.5223022602 }}, /* 1426 K */
+    {{ 34.6108695554, 36.3616862508, 20.7861496377, 530.947976772, 57.9647982685, 46.5333859742 }}, /* 1427 K */
+    {{ 34.6142058937, 36.3643637055, 20.7861496394, 531.091934171, 57.9707334337, 46.5444626933 }}, /* 1428 K */
+    {{ 34.6175378254, 36.3670397599, 20.7861496411, 531.235747117, 57.9766598796, 46.555532415 }}, /* 1429 K */
+    {{ 34.620865357, 36.3697144215, 20.7861496428, 531.379415741, 57.9825776238, 46.5665951369 }}, /* 1430 K */
+    {{ 34.6241884948, 36.3723876978, 20.7861496445, 531.522940172, 57.9884866838, 46.5776508566 }}, /* 1431 K */
+    {{ 34.6275072454, 36.3750595962, 20.7861496462, 531.666320542, 57.994387077, 46.5886995715 }}, /* 1432 K */
+    {{ 34.6308216152, 36.3777301241, 20.7861496479, 531.80955698, 58.0002788208, 46.5997412795 }}, /* 1433 K */
+    {{ 34.6341316107, 36.3803992888, 20.7861496496, 531.952649617, 58.0061619326, 46.6107759781 }}, /* 1434 K */
+    {{ 34.6374372381, 36.3830670975, 20.7861496513, 532.095598583, 58.0120364297, 46.6218036652 }}, /* 1435 K */
+    {{ 34.640738504, 36.3857335576, 20.786149653, 532.238404007, 58.0179023294, 46.6328243384 }}, /* 1436 K */
+    {{ 34.6440354147, 36.3883986762, 20.7861496546, 532.381066021, 58.0237596489, 46.6438379956 }}, /* 1437 K */
+    {{ 34.6473279767, 36.3910624605, 20.7861496563, 532.523584755, 58.0296084053, 46.6548446347 }}, /* 1438 K */
+    {{ 34.6506161964, 36.3937249175, 20.7861496579, 532.665960338, 58.0354486159, 46.6658442534 }}, /* 1439 K */
+    {{ 34.6539000801, 36.3963860545, 20.7861496595, 532.808192901, 58.0412802977, 46.6768368498 }}, /* 1440 K */
+    {{ 34.6571796342, 36.3990458783, 20.7861496612, 532.950282574, 58.0471034678, 46.6878224217 }}, /* 1441 K */
+    {{ 34.6604548652, 36.4017043961, 20.7861496628, 533.092229488, 58.0529181431, 46.6988009672 }}, /* 1442 K */
+    {{ 34.6637257793, 36.4043616147, 20.7861496644, 533.234033773, 58.0587243407, 46.7097724843 }}, /* 1443 K */
+    {{ 34.6669923829, 36.407017541, 20.786149666, 533.375695559, 58.0645220774, 46.720736971 }}, /* 1444 K */
+    {{ 34.6702546825, 36.409672182, 20.7861496676, 533.517214976, 58.0703113701, 46.7316944255 }}, /* 1445 K */
+    {{ 34.6735126844, 36.4123255445, 20.7861496691, 533.658592155, 58.0760922356, 46.7426448459 }}, /* 1446 K */
+    {{ 34.6767663948, 36.4149776353, 20.7861496707, 533.799827225, 58.0818646908, 46.7535882303 }}, /* 1447 K */
+    {{ 34.6800158202, 36.417628461, 20.7861496723, 533.940920318, 58.0876287524, 46.7645245771 }}, /* 1448 K */
+    {{ 34.6832609669, 36.4202780286, 20.7861496738, 534.081871564, 58.093384437, 46.7754538843 }}, /* 1449 K */
+    {{ 34.6865018412, 36.4229263445, 20.7861496754, 534.222681091, 58.0991317613, 46.7863761504 }}, /* 1450 K */
+    {{ 34.6897384495, 36.4255734155, 20.7861496769, 534.363349032, 58.104870742, 46.7972913735 }}, /* 1451 K */
+    {{ 34.692970798, 36.4282192481, 20.7861496785, 534.503875516, 58.1106013955, 46.8081995522 }}, /* 1452 K */
+    {{ 34.696198893, 36.430863849, 20.78614968, 534.644260673, 58.1163237385, 46.8191006846 }}, /* 1453 K */
+    {{ 34.6994227409, 36.4335072246, 20.7861496815, 534.784504634, 58.1220377874, 46.8299947694 }}, /* 1454 K */
+    {{ 34.702642348, 36.4361493815, 20.786149683, 534.924607529, 58.1277435587, 46.8408818048 }}, /* 1455 K */
+    {{ 34.7058577205, 36.438790326, 20.7861496845, 535.064569487, 58.1334410687, 46.8517617895 }}, /* 1456 K */
+    {{ 34.7090688648, 36.4414300646, 20.786149686, 535.20439064, 58.1391303338, 46.8626347219 }}, /* 1457 K */
+    {{ 34.7122757871, 36.4440686036, 20.7861496875, 535.344071117, 58.1448113704, 46.8735006006 }}, /* 1458 K */
+    {{ 34.7154784936, 36.4467059495, 20.7861496889, 535.483611048, 58.1504841946, 46.8843594241 }}, /* 1459 K */
+    {{ 34.7186769907, 36.4493421084, 20.7861496904, 535.623010565, 58.1561488228, 46.8952111912 }}, /* 1460 K */
+    {{ 34.7218712846, 36.4519770867, 20.7861496918, 535.762269795, 58.161805271, 46.9060559004 }}, /* 1461 K */
+    {{ 34.7250613815, 36.4546108906, 20.7861496933, 535.901388871, 58.1674535556, 46.9168935504 }}, /* 1462 K */
+    {{ 34.7282472877, 36.4572435262, 20.7861496947, 536.040367922, 58.1730936925, 46.92772414 }}, /* 1463 K */
+    {{ 34.7314290095, 36.4598749998, 20.7861496961, 536.179207077, 58.1787256978, 46.9385476679 }}, /* 1464 K */
+    {{ 34.734606553, 36.4625053174, 20.7861496976, 536.317906468, 58.1843495876, 46.9493641329 }}, /* 1465 K */
+    {{ 34.7377799245, 36.4651344852, 20.786149699, 536.456466223, 58.1899653779, 46.9601735338 }}, /* 1466 K */
+    {{ 34.7409491302, 36.4677625091, 20.7861497004, 536.594886474, 58.1955730845, 46.9709758694 }}, /* 1467 K */
+    {{ 34.7441141763, 36.4703893952, 20.7861497018, 536.73316735, 58.2011727234, 46.9817711388 }}, /* 1468 K */
+    {{ 34.747275069, 36.4730151495, 20.7861497031, 536.871308981, 58.2067643105, 46.9925593406 }}, /* 1469 K */
+    {{ 34.7504318146, 36.4756397779, 20.7861497045, 537.009311497, 58.2123478615, 47.003340474 }}, /* 1470 K */
+    {{ 34.7535844191, 36.4782632863, 20.7861497059, 537.147175027, 58.2179233923, 47.0141145379 }}, /* 1471 K */
+    {{ 34.7567328888, 36.4808856806, 20.7861497072, 537.284899702, 58.2234909186, 47.0248815313 }}, /* 1472 K */
+    {{ 34.7598772299, 36.4835069666, 20.7861497086, 537.422485652, 58.229050456, 47.0356414532 }}, /* 1473 K */
+    {{ 34.7630174485, 36.4861271501, 20.7861497099, 537.559933007, 58.2346020204, 47.0463943027 }}, /* 1474 K */
+    {{ 34.7661535508, 36.4887462369, 20.7861497113, 537.697241895, 58.2401456271, 47.0571400788 }}, /* 1475 K */
+    {{ 34.7692855429, 36.4913642328, 20.7861497126, 537.834412448, 58.245681292, 47.0678787809 }}, /* 1476 K */
+    {{ 34.7724134311, 36.4939811433, 20.7861497139, 537.971444794, 58.2512090304, 47.0786104079 }}, /* 1477 K */
+    {{ 34.7755372214, 36.4965969743, 20.7861497152, 538.108339064, 58.2567288579, 47.0893349591 }}, /* 1478 K */
+    {{ 34.7786569199, 36.4992117314, 20.7861497165, 538.245095387, 58.26224079, 47.1000524337 }}, /* 1479 K */
+    {{ 34.7817725329, 36.50182542, 20.7861497178, 538.381713892, 58.2677448421, 47.1107628309 }}, /* 1480 K */
+    {{ 34.7848840664, 36.5044380459, 20.7861497191, 538.51819471, 58.2732410295, 47.1214661501 }}, /* 1481 K */
+    {{ 34.7879915265, 36.5070496145, 20.7861497204, 538.65453797, 58.2787293677, 47.1321623905 }}, /* 1482 K */
+    {{ 34.7910949194, 36.5096601314, 20.7861497216, 538.790743801, 58.2842098718, 47.1428515515 }}, /* 1483 K */
+    {{ 34.7941942511, 36.512269602, 20.7861497229, 538.926812334, 58.2896825573, 47.1535336325 }}, /* 1484 K */
+    {{ 34.7972895278, 36.5148780318, 20.7861497241, 539.062743697, 58.2951474393, 47.1642086328 }}, /* 1485 K */
+    {{ 34.8003807554, 36.5174854261, 20.7861497254, 539.198538019, 58.3006045329, 47.1748765518 }}, /* 1486 K */
+    {{ 34.8034679402, 36.5200917904, 20.7861497266, 539.334195431, 58.3060538535, 47.1855373891 }}, /* 1487 K */
+    {{ 34.8065510882, 36.52269713, 20.7861497278, 539.469716062, 58.311495416, 47.1961911442 }}, /* 1488 K */
+    {{ 34.8096302054, 36.5253014502, 20.786149729, 539.605100041, 58.3169292355, 47.2068378164 }}, /* 1489 K */
+    {{ 34.812705298, 36.5279047563, 20.7861497302, 539.740347496, 58.3223553272, 47.2174774054 }}, /* 1490 K */
+    {{ 34.8157763719, 36.5305070535, 20.7861497314, 539.875458559, 58.3277737059, 47.2281099107 }}, /* 1491 K */
+    {{ 34.8188434331, 36.5331083471, 20.7861497326, 540.010433357, 58.3331843867, 47.2387353319 }}, /* 1492 K */
+    {{ 34.8219064879, 36.5357086422, 20.7861497338, 540.145272019, 58.3385873845, 47.2493536687 }}, /* 1493 K */
+    {{ 34.8249655421, 36.538307944, 20.7861497349, 540.279974676, 58.3439827142, 47.2599649206 }}, /* 1494 K */
+    {{ 34.8280206018, 36.5409062577, 20.7861497361, 540.414541456, 58.3493703905, 47.2705690875 }}, /* 1495 K */
+    {{ 34.8310716729, 36.5435035883, 20.7861497372, 540.548972488, 58.3547504284, 47.2811661689 }}, /* 1496 K */
+    {{ 34.8341187617, 36.5460999409, 20.7861497384, 540.6832679, 58.3601228426, 47.2917561646 }}, /* 1497 K */
+    {{ 34.8371618739, 36.5486953205, 20.7861497395, 540.817427823, 58.3654876479, 47.3023390743 }}, /* 1498 K */
+    {{ 34.8402010156, 36.5512897321, 20.7861497406, 540.951452384, 58.3708448589, 47.3129148979 }}, /* 1499 K */
+    {{ 34.8432361929, 36.5538831808, 20.7861497418, 541.085341713, 58.3761944903, 47.3234836352 }}, /* 1500 K */
+    {{ 34.8462674116, 36.5564756715, 20.7861497429, 541.219095938, 58.3815365568, 47.334045286 }}, /* 1501 K */
+    {{ 34.8492946778, 36.559067209, 20.786149744, 541.352715189, 58.3868710729, 47.3445998501 }}, /* 1502 K */
+    {{ 34.8523179974, 36.5616577983, 20.7861497451, 541.486199593, 58.3921980532, 47.3551473275 }}, /* 1503 K */
+    {{ 34.8553373764, 36.5642474442, 20.7861497461, 541.61954928, 58.3975175123, 47.365687718 }}, /* 1504 K */
+    {{ 34.8583528207, 36.5668361516, 20.7861497472, 541.752764378, 58.4028294645, 47.3762210217 }}, /* 1505 K */
+    {{ 34.8613643364, 36.5694239252, 20.7861497483, 541.885845016, 58.4081339244, 47.3867472384 }}, /* 1506 K */
+    {{ 34.8643719292, 36.5720107699, 20.7861497493, 542.018791321, 58.4134309063, 47.3972663681 }}, /* 1507 K */
+    {{ 34.8673756051, 36.5745966904, 20.7861497504, 542.151603424, 58.4187204247, 47.407778411 }}, /* 1508 K */
+    {{ 34.8703753702, 36.5771816913, 20.7861497514, 542.284281451, 58.4240024939, 47.418283367 }}, /* 1509 K */
+    {{ 34.8733712302, 36.5797657775, 20.7861497524, 542.416825531, 58.4292771281, 47.4287812362 }}, /* 1510 K */
+    {{ 34.8763631911, 36.5823489535, 20.7861497535, 542.549235793, 58.4345443417, 47.4392720186 }}, /* 1511 K */
+    {{ 34.8793512589, 36.584931224, 20.7861497545, 542.681512364, 58.4398041489, 47.4497557145 }}, /* 1512 K */
+    {{ 34.8823354393, 36.5875125936, 20.7861497555, 542.813655374, 58.4450565639, 47.4602323239 }}, /* 1513 K */
+    {{ 34.8853157383, 36.5900930668, 20.7861497565, 542.945664949, 58.4503016008, 47.470701847 }}, /* 1514 K */
+    {{ 34.8882921617, 36.5926726483, 20.7861497575, 543.077541219, 58.4555392738, 47.4811642841 }}, /* 1515 K */
+    {{ 34.8912647155, 36.5952513425, 20.7861497584, 543.20928431, 58.460769597, 47.4916196352 }}, /* 1516 K */
+    {{ 34.8942334054, 36.5978291539, 20.7861497594, 543.340894352, 58.4659925844, 47.5020679008 }}, /* 1517 K */
+    {{ 34.8971982375, 36.6004060871, 20.7861497604, 543.472371471, 58.47120825, 47.5125090809 }}, /* 1518 K */
+    {{ 34.9001592174, 36.6029821464, 20.7861497613, 543.603715796, 58.4764166079, 47.5229431759 }}, /* 1519 K */
+    {{ 34.903116351, 36.6055573362, 20.7861497623, 543.734927455, 58.481617672, 47.5333701862 }}, /* 1520 K */
+    {{ 34.9060696443, 36.608131661, 20.7861497632, 543.866006575, 58.4868114562, 47.543790112 }}, /* 1521 K */
+    {{ 34.9090191029, 36.6107051251, 20.7861497641, 543.996953283, 58.4919979744, 47.5542029538 }}, /* 1522 K */
+    {{ 34.9119647328, 36.6132777329, 20.7861497651, 544.127767708, 58.4971772405, 47.5646087118 }}, /* 1523 K */
+    {{ 34.9149065398, 36.6158494886, 20.786149766, 544.258449977, 58.5023492683, 47.5750073865 }}, /* 1524 K */
+    {{ 34.9178445296, 36.6184203966, 20.7861497669, 544.389000217, 58.5075140715, 47.5853989784 }}, /* 1525 K */
+    {{ 34.920778708, 36.6209904611, 20.7861497678, 544.519418556, 58.5126716639, 47.5957834878 }}, /* 1526 K */
+    {{ 34.9237090809, 36.6235596863, 20.7861497687, 544.64970512, 58.5178220592, 47.6061609152 }}, /* 1527 K */
+    {{ 34.926635654, 36.6261280765, 20.7861497695, 544.779860039, 58.5229652712, 47.6165312612 }}, /* 1528 K */
+    {{ 34.9295584331, 36.6286956358, 20.7861497704, 544.909883437, 58.5281013134, 47.6268945263 }}, /* 1529 K */
+    {{ 34.932477424, 36.6312623683, 20.7861497713, 545.039775444, 58.5332301995, 47.637250711 }}, /* 1530 K */
+    {{ 34.9353926324, 36.6338282783, 20.7861497721, 545.169536185, 58.538351943, 47.6475998158 }}, /* 1531 K */
+    {{ 34.9383040641, 36.6363933698, 20.786149773, 545.299165788, 58.5434665576, 47.6579418414 }}, /* 1532 K */
+    {{ 34.9412117249, 36.6389576469, 20.7861497738, 545.42866438, 58.5485740566, 47.6682767883 }}, /* 1533 K */
+    {{ 34.9441156204, 36.6415211136, 20.7861497746, 545.558032087, 58.5536744537, 47.6786046572 }}, /* 1534 K */
+    {{ 34.9470157565, 36.6440837741, 20.7861497754, 545.687269036, 58.5587677622, 47.6889254487 }}, /* 1535 K */
+    {{ 34.9499121388, 36.6466456322, 20.7861497762, 545.816375355, 58.5638539956, 47.6992391635 }}, /* 1536 K */
+    {{ 34.952804773, 36.649206692, 20.786149777, 545.94535117, 58.5689331673, 47.7095458023 }}, /* 1537 K */
+    {{ 34.955693665, 36.6517669575, 20.7861497778, 546.074196607, 58.5740052905, 47.7198453658 }}, /* 1538 K */
+    {{ 34.9585788202, 36.6543264325, 20.7861497786, 546.202911792, 58.5790703787, 47.7301378547 }}, /* 1539 K */
+    {{ 34.9614602446, 36.656885121, 20.7861497794, 546.331496854, 58.5841284451, 47.7404232699 }}, /* 1540 K */
+    {{ 34.9643379437, 36.6594430269, 20.7861497802, 546.459951917, 58.589179503, 47.750701612 }}, /* 1541 K */
+    {{ 34.9672119233, 36.662000154, 20.7861497809, 546.588277108, 58.5942235655, 47.7609728818 }}, /* 1542 K */
+    {{ 34.9700821889, 36.6645565062, 20.7861497817, 546.716472553, 58.5992606459, 47.7712370803 }}, /* 1543 K */
+    {{ 34.9729487464, 36.6671120873, 20.7861497824, 546.844538379, 58.6042907574, 47.7814942082 }}, /* 1544 K */
+    {{ 34.9758116012, 36.6696669011, 20.7861497832, 546.972474712, 58.6093139131, 47.7917442663 }}, /* 1545 K */
+    {{ 34.9786707592, 36.6722209513, 20.7861497839, 547.100281678, 58.614330126, 47.8019872557 }}, /* 1546 K */
+    {{ 34.9815262259, 36.6747742417, 20.7861497846, 547.227959402, 58.6193394092, 47.812223177 }}, /* 1547 K */
+    {{ 34.9843780069, 36.677326776, 20.7861497853, 547.35550801, 58.6243417757, 47.8224520314 }}, /* 1548 K */
+    {{ 34.987226108, 36.679878558, 20.786149786, 547.48292763, 58.6293372387, 47.8326738197 }}, /* 1549 K */
+    {{ 34.9900705346, 36.6824295912, 20.7861497867, 547.610218385, 58.6343258109, 47.8428885429 }}, /* 1550 K */
+    {{ 34.9929112925, 36.6849798795, 20.7861497874, 547.737380402, 58.6393075054, 47.8530962019 }}, /* 1551 K */
+    {{ 34.9957483873, 36.6875294263, 20.7861497881, 547.864413806, 58.6442823351, 47.8632967978 }}, /* 1552 K */
+    {{ 34.9985818245, 36.6900782353, 20.7861497887, 547.991318724, 58.6492503128, 47.8734903316 }}, /* 1553 K */
+    {{ 35.0014116097, 36.6926263101, 20.7861497894, 548.118095279, 58.6542114514, 47.8836768043 }}, /* 1554 K */
+    {{ 35.0042377485, 36.6951736542, 20.78614979, 548.244743599, 58.6591657636, 47.8938562169 }}, /* 1555 K */
+    {{ 35.0070602465, 36.6977202713, 20.7861497907, 548.371263807, 58.6641132624, 47.9040285707 }}, /* 1556 K */
+    {{ 35.0098791093, 36.7002661648, 20.7861497913, 548.49765603, 58.6690539603, 47.9141938665 }}, /* 1557 K */
+    {{ 35.0126943424, 36.7028113382, 20.786149792, 548.623920392, 58.6739878703, 47.9243521056 }}, /* 1558 K */
+    {{ 35.0155059514, 36.705355795, 20.7861497926, 548.750057019, 58.6789150048, 47.9345032892 }}, /* 1559 K */
+    {{ 35.0183139418, 36.7078995386, 20.7861497932, 548.876066035, 58.6838353766, 47.9446474182 }}, /* 1560 K */
+    {{ 35.0211183191, 36.7104425726, 20.7861497938, 549.001947565, 58.6887489984, 47.954784494 }}, /* 1561 K */
+    {{ 35.023919089, 36.7129849003, 20.7861497944, 549.127701735, 58.6936558827, 47.9649145177 }}, /* 1562 K */
+    {{ 35.0267162569, 36.715526525, 20.786149795, 549.253328669, 58.698556042, 47.9750374905 }}, /* 1563 K */
+    {{ 35.0295098283, 36.7180674503, 20.7861497956, 549.378828491, 58.703449489, 47.9851534136 }}, /* 1564 K */
+    {{ 35.0322998087, 36.7206076793, 20.7861497961, 549.504201326, 58.7083362361, 47.9952622883 }}, /* 1565 K */
+    {{ 35.0350862037, 36.7231472156, 20.7861497967, 549.629447299, 58.7132162959, 48.0053641159 }}, /* 1566 K */
+    {{ 35.0378690188, 36.7256860622, 20.7861497972, 549.754566535, 58.7180896806, 48.0154588976 }}, /* 1567 K */
+    {{ 35.0406482594, 36.7282242227, 20.7861497978, 549.879559156, 58.7229564029, 48.0255466347 }}, /* 1568 K */
+    {{ 35.043423931, 36.7307617002, 20.7861497983, 550.004425289, 58.727816475, 48.0356273286 }}, /* 1569 K */
+    {{ 35.0461960391, 36.7332984979, 20.7861497989, 550.129165056, 58.7326699094, 48.0457009805 }}, /* 1570 K */
+    {{ 35.0489645891, 36.7358346192, 20.7861497994, 550.253778583, 58.7375167183, 48.0557675919 }}, /* 1571 K */
+    {{ 35.0517295866, 36.7383700671, 20.7861497999, 550.378265992, 58.742356914, 48.065827164 }}, /* 1572 K */
+    {{ 35.0544910369, 36.7409048449, 20.7861498004, 550.502627409, 58.7471905089, 48.0758796983 }}, /* 1573 K */
+    {{ 35.0572489455, 36.7434389559, 20.7861498009, 550.626862956, 58.7520175151, 48.0859251962 }}, /* 1574 K */
+    {{ 35.0600033178, 36.745972403, 20.7861498014, 550.750972759, 58.7568379449, 48.0959636592 }}, /* 1575 K */
+    {{ 35.0627541593, 36.7485051894, 20.7861498019, 550.874956939, 58.7616518105, 48.1059950885 }}, /* 1576 K */
+    {{ 35.0655014754, 36.7510373183, 20.7861498024, 550.998815622, 58.7664591239, 48.1160194858 }}, /* 1577 K */
+    {{ 35.0682452714, 36.7535687928, 20.7861498028, 551.12254893, 58.7712598974, 48.1260368524 }}, /* 1578 K */
+    {{ 35.0709855529, 36.7560996158, 20.7861498033, 551.246156986, 58.7760541431, 48.1360471898 }}, /* 1579 K */
+    {{ 35.0737223252, 36.7586297905, 20.7861498037, 551.369639916, 58.7808418729, 48.1460504997 }}, /* 1580 K */
+    {{ 35.0764555936, 36.7611593199, 20.7861498042, 551.49299784, 58.785623099, 48.1560467834 }}, /* 1581 K */
+    {{ 35.0791853636, 36.763688207, 20.7861498046, 551.616230884, 58.7903978334, 48.1660360425 }}, /* 1582 K */
+    {{ 35.0819116406, 36.7662164547, 20.7861498051, 551.739339169, 58.795166088, 48.1760182786 }}, /* 1583 K */
+    {{ 35.0846344299, 36.7687440662, 20.7861498055, 551.862322819, 58.7999278747, 48.1859934932 }}, /* 1584 K */
+    {{ 35.0873537368, 36.7712710442, 20.7861498059, 551.985181957, 58.8046832056, 48.195961688 }}, /* 1585 K */
+    {{ 35.0900695668, 36.7737973918, 20.7861498063, 552.107916705, 58.8094320925, 48.2059228645 }}, /* 1586 K */
+    {{ 35.0927819251, 36.7763231119, 20.7861498067, 552.230527187, 58.8141745473, 48.2158770243 }}, /* 1587 K */
+    {{ 35.0954908172, 36.7788482073, 20.7861498071, 552.353013525, 58.8189105818, 48.2258241691 }}, /* 1588 K */
+    {{ 35.0981962483, 36.781372681, 20.7861498075, 552.475375842, 58.8236402078, 48.2357643006 }}, /* 1589 K */
+    {{ 35.1008982237, 36.7838965358, 20.7861498079, 552.597614259, 58.8283634372, 48.2456974204 }}, /* 1590 K */
+    {{ 35.1035967489, 36.7864197745, 20.7861498082, 552.719728901, 58.8330802816, 48.2556235301 }}, /* 1591 K */
+    {{ 35.106291829, 36.7889424, 20.7861498086, 552.841719888, 58.8377907528, 48.2655426315 }}, /* 1592 K */
+    {{ 35.1089834694, 36.7914644151, 20.7861498089, 552.963587343, 58.8424948626, 48.2754547263 }}, /* 1593 K */
+    {{ 35.1116716753, 36.7939858226, 20.7861498093, 553.085331388, 58.8471926225, 48.2853598163 }}, /* 1594 K */
+    {{ 35.1143564522, 36.7965066252, 20.7861498096, 553.206952145, 58.8518840443, 48.2952579031 }}, /* 1595 K */
+    {{ 35.1170378052, 36.7990268258, 20.78614981, 553.328449737, 58.8565691395, 48.3051489885 }}, /* 1596 K */
+    {{ 35.1197157395, 36.8015464269, 20.7861498103, 553.449824285, 58.8612479198, 48.3150330743 }}, /* 1597 K */
+    {{ 35.1223902606, 36.8040654314, 20.7861498106, 553.571075911, 58.8659203966, 48.3249101623 }}, /* 1598 K */
+    {{ 35.1250613736, 36.806583842, 20.7861498109, 553.692204736, 58.8705865817, 48.3347802543 }}, /* 1599 K */
+    {{ 35.1277290838, 36.8091016613, 20.7861498112, 553.813210882, 58.8752464863, 48.3446433521 }}, /* 1600 K */
+    {{ 35.1303933964, 36.811618892, 20.7861498115, 553.934094471, 58.8799001222, 48.3544994575 }}, /* 1601 K */
+    {{ 35.1330543166, 36.8141355368, 20.7861498118, 554.054855624, 58.8845475006, 48.3643485724 }}, /* 1602 K */
+    {{ 35.1357118497, 36.8166515982, 20.7861498121, 554.175494463, 58.8891886331, 48.3741906987 }}, /* 1603 K */
+    {{ 35.138366001, 36.819167079, 20.7861498123, 554.296011108, 58.893823531, 48.3840258381 }}, /* 1604 K */
+    {{ 35.1410167755, 36.8216819816, 20.7861498126, 554.416405681, 58.8984522057, 48.3938539927 }}, /* 1605 K */
+    {{ 35.1436641785, 36.8241963087, 20.7861498128, 554.536678303, 58.9030746686, 48.4036751643 }}, /* 1606 K */
+    {{ 35.1463082153, 36.8267100629, 20.7861498131, 554.656829095, 58.907690931, 48.4134893549 }}, /* 1607 K */
+    {{ 35.1489488909, 36.8292232467, 20.7861498133, 554.776858177, 58.9123010041, 48.4232965663 }}, /* 1608 K */
+    {{ 35.1515862106, 36.8317358625, 20.7861498136, 554.896765671, 58.9169048994, 48.4330968005 }}, /* 1609 K */
+    {{ 35.1542201796, 36.834247913, 20.7861498138, 555.016551697, 58.9215026279, 48.4428900596 }}, /* 1610 K */
+    {{ 35.156850803, 36.8367594007, 20.786149814, 555.136216376, 58.926094201, 48.4526763453 }}, /* 1611 K */
+    {{ 35.159478086, 36.8392703279, 20.7861498142, 555.255759828, 58.9306796297, 48.4624556599 }}, /* 1612 K */
+    {{ 35.1621020337, 36.8417806973, 20.7861498144, 555.375182174, 58.9352589254, 48.4722280051 }}, /* 1613 K */
+    {{ 35.1647226513, 36.8442905112, 20.7861498146, 555.494483534, 58.9398320991, 48.4819933832 }}, /* 1614 K */
+    {{ 35.1673399438, 36.846799772, 20.7861498148, 555.613664027, 58.9443991619, 48.491751796 }}, /* 1615 K */
+    {{ 35.1699539166, 36.8493084822, 20.786149815, 555.732723776, 58.948960125, 48.5015032456 }}, /* 1616 K */
+    {{ 35.1725645745, 36.8518166442, 20.7861498152, 555.851662898, 58.9535149994, 48.5112477342 }}, /* 1617 K */
+    {{ 35.1751719229, 36.8543242603, 20.7861498154, 555.970481515, 58.9580637961, 48.5209852637 }}, /* 1618 K */
+    {{ 35.1777759667, 36.856831333, 20.7861498155, 556.089179746, 58.9626065261, 48.5307158363 }}, /* 1619 K */
+    {{ 35.1803767111, 36.8593378646, 20.7861498157, 556.207757711, 58.9671432005, 48.540439454 }}, /* 1620 K */
+    {{ 35.1829741612, 36.8618438574, 20.7861498158, 556.32621553, 58.9716738301, 48.5501561189 }}, /* 1621 K */
+    {{ 35.1855683221, 36.8643493138, 20.786149816, 556.444553321, 58.976198426, 48.5598658333 }}, /* 1622 K */
+    {{ 35.1881591988, 36.866854236, 20.7861498161, 556.562771205, 58.9807169991, 48.5695685991 }}, /* 1623 K */
+    {{ 35.1907467964, 36.8693586264, 20.7861498162, 556.680869301, 58.9852295602, 48.5792644186 }}, /* 1624 K */
+    {{ 35.1933311199, 36.8718624872, 20.7861498163, 556.798847729, 58.9897361201, 48.5889532939 }}, /* 1625 K */
+    {{ 35.1959121745, 36.8743658207, 20.7861498164, 556.916706606, 58.9942366898, 48.5986352273 }}, /* 1626 K */
+    {{ 35.1984899652, 36.8768686291, 20.7861498166, 557.034446053, 58.99873128, 48.6083102208 }}, /* 1627 K */
+    {{ 35.2010644969, 36.8793709147, 20.7861498167, 557.152066189, 59.0032199016, 48.6179782766 }}, /* 1628 K */
+    {{ 35.2036357748, 36.8818726797, 20.7861498167, 557.269567132, 59.0077025652, 48.6276393971 }}, /* 1629 K */
+    {{ 35.2062038039, 36.8843739263, 20.7861498168, 557.386949001, 59.0121792817, 48.6372935844 }}, /* 1630 K */
+    {{ 35.2087685892, 36.8868746566, 20.7861498169, 557.504211915, 59.0166500617, 48.6469408407 }}, /* 1631 K */
+    {{ 35.2113301357, 36.8893748729, 20.786149817, 557.621355992, 59.0211149159, 48.6565811683 }}, /* 1632 K */
+    {{ 35.2138884484, 36.8918745773, 20.786149817, 557.738381352, 59.025573855, 48.6662145695 }}, /* 1633 K */
+    {{ 35.2164435323, 36.894373772, 20.7861498171, 557.855288111, 59.0300268896, 48.6758410465 }}, /* 1634 K */
+    {{ 35.2189953923, 36.896872459, 20.7861498171, 557.97207639, 59.0344740303, 48.6854606016 }}, /* 1635 K */
+    {{ 35.2215440336, 36.8993706406, 20.7861498172, 558.088746305, 59.0389152878, 48.6950732371 }}, /* 1636 K */
+    {{ 35.224089461, 36.9018683187, 20.7861498172, 558.205297975, 59.0433506726, 48.7046789553 }}, /* 1637 K */
+    {{ 35.2266316795, 36.9043654955, 20.7861498173, 558.321731518, 59.0477801952, 48.7142777586 }}, /* 1638 K */
+    {{ 35.2291706941, 36.9068621731, 20.7861498173, 558.438047052, 59.0522038661, 48.7238696492 }}, /* 1639 K */
+    {{ 35.2317065097, 36.9093583534, 20.7861498173, 558.554244695, 59.0566216959, 48.7334546296 }}, /* 1640 K */
+    {{ 35.2342391313, 36.9118540387, 20.7861498173, 558.670324564, 59.061033695, 48.743032702 }}, /* 1641 K */
+    {{ 35.2367685638, 36.9143492308, 20.7861498173, 558.786286777, 59.0654398738, 48.7526038688 }}, /* 1642 K */
+    {{ 35.2392948121, 36.9168439318, 20.7861498173, 558.902131452, 59.0698402429, 48.7621681325 }}, /* 1643 K */
+    {{ 35.2418178812, 36.9193381437, 20.7861498173, 559.017858706, 59.0742348124, 48.7717254953 }}, /* 1644 K */
+    {{ 35.244337776, 36.9218318686, 20.7861498173, 559.133468656, 59.078623593, 48.7812759598 }}, /* 1645 K */
+    {{ 35.2468545014, 36.9243251083, 20.7861498173, 559.248961419, 59.0830065948, 48.7908195282 }}, /* 1646 K */
+    {{ 35.2493680622, 36.9268178648, 20.7861498172, 559.364337114, 59.0873838283, 48.8003562031 }}, /* 1647 K */
+    {{ 35.2518784635, 36.9293101401, 20.7861498172, 559.479595856, 59.0917553037, 48.8098859869 }}, /* 1648 K */
+    {{ 35.25438571, 36.9318019361, 20.7861498171, 559.594737763, 59.0961210313, 48.8194088819 }}, /* 1649 K */
+    {{ 35.2568898066, 36.9342932548, 20.7861498171, 559.709762951, 59.1004810214, 48.8289248908 }}, /* 1650 K */
+    {{ 35.2593907583, 36.9367840979, 20.786149817, 559.824671538, 59.1048352841, 48.8384340158 }}, /* 1651 K */
+    {{ 35.2618885699, 36.9392744676, 20.786149817, 559.939463639, 59.1091838298, 48.8479362596 }}, /* 1652 K */
+    {{ 35.2643832462, 36.9417643655, 20.7861498169, 560.054139372, 59.1135266686, 48.8574316246 }}, /* 1653 K */
+    {{ 35.2668747921, 36.9442537937, 20.7861498168, 560.168698852, 59.1178638106, 48.8669201132 }}, /* 1654 K */
+    {{ 35.2693632124, 36.9467427539, 20.7861498168, 560.283142197, 59.122195266, 48.8764017281 }}, /* 1655 K */
+    {{ 35.2718485121, 36.949231248, 20.7861498167, 560.397469522, 59.1265210449, 48.8858764717 }}, /* 1656 K */
+    {{ 35.2743306958, 36.9517192778, 20.7861498166, 560.511680944, 59.1308411575, 48.8953443465 }}, /* 1657 K */
+    {{ 35.2768097684, 36.9542068451, 20.7861498165, 560.625776578, 59.1351556137, 48.9048053552 }}, /* 1658 K */
+    {{ 35.2792857348, 36.9566939518, 20.7861498164, 560.73975654, 59.1394644237, 48.9142595002 }}, /* 1659 K */
+    {{ 35.2817585997, 36.9591805996, 20.7861498162, 560.853620947, 59.1437675974, 48.9237067841 }}, /* 1660 K */
+    {{ 35.284228368, 36.9616667903, 20.7861498161, 560.967369914, 59.1480651449, 48.9331472094 }}, /* 1661 K */
+    {{ 35.2866950444, 36.9641525257, 20.786149816, 561.081003556, 59.1523570762, 48.9425807789 }}, /* 1662 K */
+    {{ 35.2891586338, 36.9666378076, 20.7861498159, 561.19452199, 59.1566434011, 48.952007495 }}, /* 1663 K */
+    {{ 35.2916191408, 36.9691226376, 20.7861498157, 561.30792533, 59.1609241297, 48.9614273603 }}, /* 1664 K */
+    {{ 35.2940765703, 36.9716070175, 20.7861498156, 561.421213693, 59.1651992718, 48.9708403775 }}, /* 1665 K */
+    {{ 35.2965309271, 36.9740909491, 20.7861498154, 561.534387192, 59.1694688374, 48.9802465492 }}, /* 1666 K */
+    {{ 35.2989822158, 36.9765744339, 20.7861498153, 561.647445944, 59.1737328363, 48.9896458781 }}, /* 1667 K */
+    {{ 35.3014304413, 36.9790574738, 20.7861498151, 561.760390063, 59.1779912784, 48.9990383666 }}, /* 1668 K */
+    {{ 35.3038756083, 36.9815400704, 20.7861498149, 561.873219664, 59.1822441735, 49.0084240176 }}, /* 1669 K */
+    {{ 35.3063177215, 36.9840222254, 20.7861498148, 561.985934862, 59.1864915313, 49.0178028337 }}, /* 1670 K */
+    {{ 35.3087567856, 36.9865039404, 20.7861498146, 562.098535772, 59.1907333618, 49.0271748175 }}, /* 1671 K */
+    {{ 35.3111928054, 36.9889852171, 20.7861498144, 562.211022508, 59.1949696745, 49.0365399718 }}, /* 1672 K */
+    {{ 35.3136257856, 36.9914660571, 20.7861498142, 562.323395185, 59.1992004794, 49.0458982991 }}, /* 1673 K */
+    {{ 35.3160557309, 36.9939464621, 20.786149814, 562.435653917, 59.203425786, 49.0552498023 }}, /* 1674 K */
+    {{ 35.318482646, 36.9964264335, 20.7861498138, 562.547798819, 59.2076456041, 49.064594484 }}, /* 1675 K */
+    {{ 35.3209065355, 36.9989059732, 20.7861498136, 562.659830005, 59.2118599434, 49.0739323469 }}, /* 1676 K */
+    {{ 35.3233274042, 37.0013850825, 20.7861498134, 562.771747589, 59.2160688135, 49.0832633938 }}, /* 1677 K */
+    {{ 35.3257452568, 37.0038637632, 20.7861498131, 562.883551684, 59.220272224, 49.0925876274 }}, /* 1678 K */
+    {{ 35.3281600979, 37.0063420167, 20.7861498129, 562.995242405, 59.2244701846, 49.1019050505 }}, /* 1679 K */
+    {{ 35.3305719321, 37.0088198446, 20.7861498127, 563.106819866, 59.2286627048, 49.1112156657 }}, /* 1680 K */
+    {{ 35.3329807642, 37.0112972486, 20.7861498124, 563.21828418, 59.2328497942, 49.120519476 }}, /* 1681 K */
+    {{ 35.3353865988, 37.01377423, 20.7861498122, 563.329635461, 59.2370314623, 49.1298164839 }}, /* 1682 K */
+    {{ 35.3377894405, 37.0162507904, 20.7861498119, 563.440873823, 59.2412077187, 49.1391066924 }}, /* 1683 K */
+    {{ 35.340189294, 37.0187269313, 20.7861498117, 563.551999378, 59.2453785729, 49.1483901041 }}, /* 1684 K */
+    {{ 35.3425861638, 37.0212026543, 20.7861498114, 563.66301224, 59.2495440343, 49.157666722 }}, /* 1685 K */
+    {{ 35.3449800547, 37.0236779608, 20.7861498111, 563.773912522, 59.2537041124, 49.1669365488 }}, /* 1686 K */
+    {{ 35.3473709712, 37.0261528522, 20.7861498109, 563.884700338, 59.2578588167, 49.1761995873 }}, /* 1687 K */
+    {{ 35.3497589179, 37.0286273301, 20.7861498106, 563.995375799, 59.2620081565, 49.1854558404 }}, /* 1688 K */
+    {{ 35.3521438995, 37.0311013959, 20.7861498103, 564.10593902, 59.2661521413, 49.1947053109 }}, /* 1689 K */
+    {{ 35.3545259205, 37.0335750511, 20.78614981, 564.216390113, 59.2702907804, 49.2039480016 }}, /* 1690 K */
+    {{ 35.3569049855, 37.036048297, 20.7861498097, 564.32672919, 59.2744240832, 49.2131839154 }}, /* 1691 K */
+    {{ 35.3592810991, 37.0385211351, 20.7861498094, 564.436956365, 59.278552059, 49.2224130551 }}, /* 1692 K */
+    {{ 35.3616542659, 37.0409935668, 20.7861498091, 564.547071749, 59.2826747172, 49.2316354236 }}, /* 1693 K */
+    {{ 35.3640244904, 37.0434655936, 20.7861498088, 564.657075454, 59.286792067, 49.2408510238 }}, /* 1694 K */
+    {{ 35.3663917772, 37.0459372167, 20.7861498084, 564.766967594, 59.2909041177, 49.2500598586 }}, /* 1695 K */
+    {{ 35.3687561308, 37.0484084376, 20.7861498081, 564.876748281, 59.2950108785, 49.2592619308 }}, /* 1696 K */
+    {{ 35.3711175558, 37.0508792577, 20.7861498078, 564.986417625, 59.2991123587, 49.2684572434 }}, /* 1697 K */
+    {{ 35.3734760568, 37.0533496782, 20.7861498074, 565.09597574, 59.3032085676, 49.2776457993 }}, /* 1698 K */
+    {{ 35.3758316381, 37.0558197006, 20.7861498071, 565.205422737, 59.3072995142, 49.2868276013 }}, /* 1699 K */
+    {{ 35.3781843045, 37.0582893262, 20.7861498067, 565.314758728, 59.3113852078, 49.2960026525 }}, /* 1700 K */
+    {{ 35.3805340603, 37.0607585564, 20.7861498064, 565.423983824, 59.3154656575, 49.3051709556 }}, /* 1701 K */
+    {{ 35.3828809102, 37.0632273923, 20.786149806, 565.533098137, 59.3195408724, 49.3143325138 }}, /* 1702 K */
+    {{ 35.3852248585, 37.0656958354, 20.7861498056, 565.642101779, 59.3236108617, 49.3234873299 }}, /* 1703 K */
+    {{ 35.3875659099, 37.068163887, 20.7861498053, 565.75099486, 59.3276756344, 49.3326354069 }}, /* 1704 K */
+    {{ 35.3899040687, 37.0706315483, 20.7861498049, 565.859777493, 59.3317351996, 49.3417767477 }}, /* 1705 K */
+    {{ 35.3922393395, 37.0730988206, 20.7861498045, 565.968449787, 59.3357895664, 49.3509113553 }}, /* 1706 K */
+    {{ 35.3945717267, 37.0755657051, 20.7861498041, 566.077011854, 59.3398387438, 49.3600392327 }}, /* 1707 K */
+    {{ 35.3969012348, 37.0780322032, 20.7861498037, 566.185463806, 59.3438827408, 49.3691603829 }}, /* 1708 K */
+    {{ 35.3992278683, 37.0804983161, 20.7861498033, 566.293805752, 59.3479215664, 49.3782748089 }}, /* 1709 K */
+    {{ 35.4015516317, 37.0829640451, 20.7861498029, 566.402037803, 59.3519552296, 49.3873825137 }}, /* 1710 K */
+    {{ 35.4038725293, 37.0854293912, 20.7861498025, 566.510160071, 59.3559837392, 49.3964835002 }}, /* 1711 K */
+    {{ 35.4061905656, 37.0878943559, 20.7861498021, 566.618172665, 59.3600071044, 49.4055777715 }}, /* 1712 K */
+    {{ 35.408505745, 37.0903589403, 20.7861498017, 566.726075696, 59.3640253339, 49.4146653307 }}, /* 1713 K */
+    {{ 35.410818072, 37.0928231455, 20.7861498013, 566.833869274, 59.3680384366, 49.4237461807 }}, /* 1714 K */
+    {{ 35.413127551, 37.0952869728, 20.7861498008, 566.941553509, 59.3720464215, 49.4328203246 }}, /* 1715 K */
+    {{ 35.4154341864, 37.0977504234, 20.7861498004, 567.049128512, 59.3760492974, 49.4418877655 }}, /* 1716 K */
+    {{ 35.4177379826, 37.1002134984, 20.7861498, 567.156594392, 59.3800470731, 49.4509485063 }}, /* 1717 K */
+    {{ 35.420038944, 37.102676199, 20.7861497995, 567.263951259, 59.3840397574, 49.4600025502 }}, /* 1718 K */
+    {{ 35.422337075, 37.1051385264, 20.7861497991, 567.371199223, 59.3880273592, 49.4690499002 }}, /* 1719 K */
+    {{ 35.42463238, 37.1076004817, 20.7861497986, 567.478338394, 59.3920098872, 49.4780905594 }}, /* 1720 K */
+    {{ 35.4269248633, 37.110062066, 20.7861497981, 567.585368881, 59.3959873501, 49.4871245308 }}, /* 1721 K */
+    {{ 35.4292145294, 37.1125232805, 20.7861497977, 567.692290794, 59.3999597568, 49.4961518177 }}, /* 1722 K */
+    {{ 35.4315013826, 37.1149841262, 20.7861497972, 567.799104241, 59.4039271159, 49.5051724229 }}, /* 1723 K */
+    {{ 35.4337854272, 37.1174446044, 20.7861497967, 567.905809333, 59.4078894361, 49.5141863497 }}, /* 1724 K */
+    {{ 35.4360666676, 37.119904716, 20.7861497963, 568.012406177, 59.4118467262, 49.5231936012 }}, /* 1725 K */
+    {{ 35.4383451082, 37.1223644622, 20.7861497958, 568.118894884, 59.4157989947, 49.5321941805 }}, /* 1726 K */
+    {{ 35.4406207532, 37.1248238441, 20.7861497953, 568.225275563, 59.4197462504, 49.5411880906 }}, /* 1727 K */
+    {{ 35.4428936071, 37.1272828628, 20.7861497948, 568.331548321, 59.4236885018, 49.5501753348 }}, /* 1728 K */
+    {{ 35.4451636741, 37.1297415192, 20.7861497943, 568.437713268, 59.4276257576, 49.5591559161 }}, /* 1729 K */
+    {{ 35.4474309585, 37.1321998145, 20.7861497938, 568.543770512, 59.4315580263, 49.5681298378 }}, /* 1730 K */
+    {{ 35.4496954648, 37.1346577498, 20.7861497933, 568.649720162, 59.4354853166, 49.5770971028 }}, /* 1731 K */
+    {{ 35.4519571971, 37.1371153259, 20.7861497928, 568.755562327, 59.4394076369, 49.5860577145 }}, /* 1732 K */
+    {{ 35.4542161597, 37.1395725441, 20.7861497922, 568.861297113, 59.4433249959, 49.595011676 }}, /* 1733 K */
+    {{ 35.4564723571, 37.1420294053, 20.7861497917, 568.966924631, 59.4472374019, 49.6039589903 }}, /* 1734 K */
+    {{ 35.4587257933, 37.1444859104, 20.7861497912, 569.072444987, 59.4511448636, 49.6128996608 }}, /* 1735 K */
+    {{ 35.4609764728, 37.1469420607, 20.7861497906, 569.17785829, 59.4550473894, 49.6218336905 }}, /* 1736 K */
+    {{ 35.4632243998, 37.1493978569, 20.7861497901, 569.283164647, 59.4589449878, 49.6307610827 }}, /* 1737 K */
+    {{ 35.4654695785, 37.1518533001, 20.7861497896, 569.388364167, 59.4628376671, 49.6396818406 }}, /* 1738 K */
+    {{ 35.4677120132, 37.1543083914, 20.786149789, 569.493456957, 59.4667254359, 49.6485959673 }}, /* 1739 K */
+    {{ 35.4699517082, 37.1567631316, 20.7861497885, 569.598443124, 59.4706083025, 49.6575034661 }}, /* 1740 K */
+    {{ 35.4721886676, 37.1592175217, 20.7861497879, 569.703322777, 59.4744862754, 49.6664043402 }}, /* 1741 K */
+    {{ 35.4744228959, 37.1616715627, 20.7861497873, 569.808096021, 59.4783593628, 49.6752985927 }}, /* 1742 K */
+    {{ 35.476654397, 37.1641252556, 20.7861497868, 569.912762966, 59.4822275732, 49.684186227 }}, /* 1743 K */
+    {{ 35.4788831754, 37.1665786012, 20.7861497862, 570.017323717, 59.4860909149, 49.6930672461 }}, /* 1744 K */
+    {{ 35.4811092352, 37.1690316006, 20.7861497856, 570.121778382, 59.4899493961, 49.7019416535 }}, /* 1745 K */
+    {{ 35.4833325806, 37.1714842545, 20.7861497851, 570.226127067, 59.4938030253, 49.7108094523 }}, /* 1746 K */
+    {{ 35.4855532158, 37.1739365641, 20.7861497845, 570.33036988, 59.4976518106, 49.7196706457 }}, /* 1747 K */
+    {{ 35.487771145, 37.17638853, 20.7861497839, 570.434506927, 59.5014957604, 49.728525237 }}, /* 1748 K */
+    {{ 35.4899863724, 37.1788401534, 20.7861497833, 570.538538315, 59.5053348828, 49.7373732295 }}, /* 1749 K */
+    {{ 35.4921989023, 37.1812914349, 20.7861497827, 570.642464151, 59.5091691862, 49.7462146264 }}, /* 1750 K */
+    {{ 35.4944087387, 37.1837423757, 20.7861497821, 570.74628454, 59.5129986787, 49.7550494311 }}, /* 1751 K */
+    {{ 35.4966158858, 37.1861929764, 20.7861497815, 570.849999589, 59.5168233685, 49.7638776466 }}, /* 1752 K */
+    {{ 35.4988203478, 37.188643238, 20.7861497809, 570.953609405, 59.5206432638, 49.7726992765 }}, /* 1753 K */
+    {{ 35.5010221289, 37.1910931614, 20.7861497803, 571.057114092, 59.5244583728, 49.7815143239 }}, /* 1754 K */
+    {{ 35.5032212332, 37.1935427473, 20.7861497796, 571.160513758, 59.5282687035, 49.7903227921 }}, /* 1755 K */
+    {{ 35.5054176648, 37.1959919967, 20.786149779, 571.263808509, 59.5320742642, 49.7991246844 }}, /* 1756 K */
+    {{ 35.5076114279, 37.1984409104, 20.7861497784, 571.366998449, 59.5358750628, 49.8079200042 }}, /* 1757 K */
+    {{ 35.5098025267, 37.2008894892, 20.7861497777, 571.470083685, 59.5396711076, 49.8167087547 }}, /* 1758 K */
+    {{ 35.5119909652, 37.203337734, 20.7861497771, 571.573064322, 59.5434624066, 49.8254909392 }}, /* 1759 K */
+    {{ 35.5141767475, 37.2057856455, 20.7861497765, 571.675940465, 59.5472489678, 49.8342665612 }}, /* 1760 K */
+    {{ 35.5163598778, 37.2082332246, 20.7861497758, 571.778712221, 59.5510307993, 49.8430356238 }}, /* 1761 K */
+    {{ 35.5185403603, 37.2106804721, 20.7861497752, 571.881379694, 59.554807909, 49.8517981304 }}, /* 1762 K */
+    {{ 35.5207181988, 37.2131273887, 20.7861497745, 571.983942989, 59.5585803051, 49.8605540843 }}, /* 1763 K */
+    {{ 35.5228933977, 37.2155739753, 20.7861497739, 572.086402212, 59.5623479955, 49.869303489 }}, /* 1764 K */
+    {{ 35.5250659609, 37.2180202326, 20.7861497732, 572.188757467, 59.5661109881, 49.8780463477 }}, /* 1765 K */
+    {{ 35.5272358925, 37.2204661615, 20.7861497725, 572.291008859, 59.5698692909, 49.8867826638 }}, /* 1766 K */
+    {{ 35.5294031966, 37.2229117626, 20.7861497719, 572.393156494, 59.5736229118, 49.8955124406 }}, /* 1767 K */
+    {{ 35.5315678774, 37.2253570368, 20.7861497712, 572.495200475, 59.5773718588, 49.9042356815 }}, /* 1768 K */
+    {{ 35.5337299387, 37.2278019847, 20.7861497705, 572.597140907, 59.5811161398, 49.9129523899 }}, /* 1769 K */
+    {{ 35.5358893847, 37.2302466072, 20.7861497698, 572.698977894, 59.5848557626, 49.9216625691 }}, /* 1770 K */
+    {{ 35.5380462194, 37.232690905, 20.7861497691, 572.800711542, 59.5885907352, 49.9303662225 }}, /* 1771 K */
+    {{ 35.540200447, 37.2351348788, 20.7861497685, 572.902341953, 59.5923210653, 49.9390633535 }}, /* 1772 K */
+    {{ 35.5423520713, 37.2375785294, 20.7861497678, 573.003869232, 59.5960467608, 49.9477539655 }}, /* 1773 K */
+    {{ 35.5445010964, 37.2400218574, 20.7861497671, 573.105293484, 59.5997678295, 49.9564380618 }}, /* 1774 K */
+    {{ 35.5466475264, 37.2424648635, 20.7861497664, 573.206614812, 59.6034842793, 49.9651156459 }}, /* 1775 K */
+    {{ 35.5487913653, 37.2449075485, 20.7861497657, 573.307833319, 59.6071961179, 49.9737867212 }}, /* 1776 K */
+    {{ 35.550932617, 37.2473499132, 20.7861497649, 573.40894911, 59.6109033531, 49.9824512909 }}, /* 1777 K */
+    {{ 35.5530712856, 37.249791958, 20.7861497642, 573.509962288, 59.6146059926, 49.9911093587 }}, /* 1778 K */
+    {{ 35.5552073751, 37.2522336838, 20.7861497635, 573.610872957, 59.6183040442, 49.9997609278 }}, /* 1779 K */
+    {{ 35.5573408894, 37.2546750913, 20.7861497628, 573.711681219, 59.6219975156, 50.0084060017 }}, /* 1780 K */
+    {{ 35.5594718326, 37.257116181, 20.7861497621, 573.812387179, 59.6256864145, 50.0170445839 }}, /* 1781 K */
+    {{ 35.5616002086, 37.2595569537, 20.7861497613, 573.912990939, 59.6293707486, 50.0256766776 }}, /* 1782 K */
+    {{ 35.5637260213, 37.2619974101, 20.7861497606, 574.013492603, 59.6330505255, 50.0343022864 }}, /* 1783 K */
+    {{ 35.5658492749, 37.2644375507, 20.7861497599, 574.113892273, 59.636725753, 50.0429214138 }}, /* 1784 K */
+    {{ 35.5679699731, 37.2668773762, 20.7861497591, 574.214190052, 59.6403964387, 50.0515340631 }}, /* 1785 K */
+    {{ 35.57008812, 37.2693168873, 20.7861497584, 574.314386043, 59.6440625901, 50.0601402377 }}, /* 1786 K */
+    {{ 35.5722037195, 37.2717560846, 20.7861497576, 574.414480349, 59.647724215, 50.0687399412 }}, /* 1787 K */
+    {{ 35.5743167755, 37.2741949687, 20.7861497569, 574.514473072, 59.6513813208, 50.077333177 }}, /* 1788 K */
+    {{ 35.576427292, 37.2766335403, 20.7861497561, 574.614364314, 59.6550339153, 50.0859199486 }}, /* 1789 K */
+    {{ 35.5785352729, 37.2790717999, 20.7861497554, 574.714154179, 59.6586820058, 50.0945002593 }}, /* 1790 K */
+    {{ 35.5806407221, 37.2815097481, 20.7861497546, 574.813842768, 59.6623256, 50.1030741127 }}, /* 1791 K */
+    {{ 35.5827436436, 37.2839473857, 20.7861497539, 574.913430183, 59.6659647055, 50.1116415123 }}, /* 1792 K */
+    {{ 35.5848440412, 37.2863847131, 20.7861497531, 575.012916526, 59.6695993296, 50.1202024614 }}, /* 1793 K */
+    {{ 35.5869419188, 37.288821731, 20.7861497523, 575.1123019, 59.67322948, 50.1287569637 }}, /* 1794 K */
+    {{ 35.5890372803, 37.2912584399, 20.7861497515, 575.211586405, 59.6768551641, 50.1373050226 }}, /* 1795 K */
+    {{ 35.5911301297, 37.2936948404, 20.7861497508, 575.310770145, 59.6804763894, 50.1458466415 }}, /* 1796 K */
+    {{ 35.5932204708, 37.2961309331, 20.78614975, 575.40985322, 59.6840931633, 50.1543818239 }}, /* 1797 K */
+    {{ 35.5953083074, 37.2985667186, 20.7861497492, 575.508835731, 59.6877054933, 50.1629105734 }}, /* 1798 K */
+    {{ 35.5973936435, 37.3010021973, 20.7861497484, 575.607717781, 59.6913133867, 50.1714328935 }}, /* 1799 K */
+    {{ 35.5994764829, 37.30343737, 20.7861497476, 575.706499471, 59.694916851, 50.1799487876 }}, /* 1800 K */
+    {{ 35.6015568295, 37.305872237, 20.7861497468, 575.805180901, 59.6985158937, 50.1884582593 }}, /* 1801 K */
+    {{ 35.6036346871, 37.3083067991, 20.786149746, 575.903762174, 59.7021105219, 50.196961312 }}, /* 1802 K */
+    {{ 35.6057100595, 37.3107410566, 20.7861497452, 576.002243389, 59.7057007432, 50.2054579493 }}, /* 1803 K */
+    {{ 35.6077829507, 37.3131750101, 20.7861497444, 576.100624648, 59.7092865649, 50.2139481747 }}, /* 1804 K */
+    {{ 35.6098533644, 37.3156086602, 20.7861497436, 576.198906051, 59.7128679943, 50.2224319917 }}, /* 1805 K */
+    {{ 35.6119213044, 37.3180420074, 20.7861497428, 576.2970877, 59.7164450386, 50.2309094039 }}, /* 1806 K */
+    {{ 35.6139867746, 37.3204750521, 20.786149742, 576.395169695, 59.7200177053, 50.2393804147 }}, /* 1807 K */
+    {{ 35.6160497788, 37.322907795, 20.7861497412, 576.493152136, 59.7235860015, 50.2478450278 }}, /* 1808 K */
+    {{ 35.6181103208, 37.3253402364, 20.7861497403, 576.591035123, 59.7271499347, 50.2563032465 }}, /* 1809 K */
+    {{ 35.6201684045, 37.3277723769, 20.7861497395, 576.688818757, 59.7307095119, 50.2647550746 }}, /* 1810 K */
+    {{ 35.6222240335, 37.330204217, 20.7861497387, 576.786503139, 59.7342647405, 50.2732005155 }}, /* 1811 K */
+    {{ 35.6242772116, 37.3326357572, 20.7861497378, 576.884088367, 59.7378156277, 50.2816395728 }}, /* 1812 K */
+    {{ 35.6263279428, 37.335066998, 20.786149737, 576.981574543, 59.7413621807, 50.29007225 }}, /* 1813 K */
+    {{ 35.6283762307, 37.3374979397, 20.7861497362, 577.078961766, 59.7449044066, 50.2984985507 }}, /* 1814 K */
+    {{ 35.6304220791, 37.339928583, 20.7861497353, 577.176250135, 59.7484423127, 50.3069184784 }}, /* 1815 K */
+    {{ 35.6324654918, 37.3423589282, 20.7861497345, 577.273439751, 59.7519759062, 50.3153320367 }}, /* 1816 K */
+    {{ 35.6345064726, 37.3447889758, 20.7861497336, 577.370530713, 59.7555051941, 50.3237392292 }}, /* 1817 K */
+    {{ 35.6365450251, 37.3472187263, 20.7861497328, 577.46752312, 59.7590301837, 50.3321400594 }}, /* 1818 K */
+    {{ 35.6385811532, 37.3496481801, 20.7861497319, 577.564417072, 59.762550882, 50.3405345309 }}, /* 1819 K */
+    {{ 35.6406148605, 37.3520773377, 20.7861497311, 577.661212667, 59.7660672961, 50.3489226473 }}, /* 1820 K */
+    {{ 35.6426461509, 37.3545061994, 20.7861497302, 577.757910006, 59.7695794332, 50.3573044122 }}, /* 1821 K */
+    {{ 35.644675028, 37.3569347659, 20.7861497294, 577.854509187, 59.7730873003, 50.3656798291 }}, /* 1822 K */
+    {{ 35.6467014956, 37.3593630373, 20.7861497285, 577.951010309, 59.7765909045, 50.3740489017 }}, /* 1823 K */
+    {{ 35.6487255574, 37.3617910143, 20.7861497276, 578.047413471, 59.7800902529, 50.3824116334 }}, /* 1824 K */
+    {{ 35.650747217, 37.3642186971, 20.7861497268, 578.143718772, 59.7835853523, 50.390768028 }}, /* 1825 K */
+    {{ 35.6527664783, 37.3666460862, 20.7861497259, 578.239926309, 59.78707621, 50.399118089 }}, /* 1826 K */
+    {{ 35.6547833449, 37.3690731821, 20.786149725, 578.336036183, 59.7905628329, 50.40746182 }}, /* 1827 K */
+    {{ 35.6567978204, 37.3714999851, 20.7861497241, 578.432048491, 59.794045228, 50.4157992245 }}, /* 1828 K */
+    {{ 35.6588099086, 37.3739264956, 20.7861497232, 578.527963331, 59.7975234022, 50.4241303063 }}, /* 1829 K */
+    {{ 35.6608196132, 37.376352714, 20.7861497224, 578.623780802, 59.8009973625, 50.4324550689 }}, /* 1830 K */
+    {{ 35.6628269378, 37.3787786407, 20.7861497215, 578.719501002, 59.804467116, 50.440773516 }}, /* 1831 K */
+    {{ 35.6648318861, 37.3812042761, 20.7861497206, 578.815124029, 59.8079326694, 50.449085651 }}, /* 1832 K */
+    {{ 35.6668344618, 37.3836296205, 20.7861497197, 578.910649981, 59.8113940298, 50.4573914778 }}, /* 1833 K */
+    {{ 35.6688346685, 37.3860546743, 20.7861497188, 579.006078956, 59.814851204, 50.4656909998 }}, /* 1834 K */
+    {{ 35.6708325099, 37.388479438, 20.7861497179, 579.10141105, 59.8183041989, 50.4739842207 }}, /* 1835 K */
+    {{ 35.6728279896, 37.3909039118, 20.786149717, 579.196646363, 59.8217530215, 50.4822711442 }}, /* 1836 K */
+    {{ 35.6748211112, 37.3933280961, 20.7861497161, 579.291784991, 59.8251976785, 50.4905517737 }}, /* 1837 K */
+    {{ 35.6768118784, 37.3957519912, 20.7861497152, 579.386827032, 59.8286381768, 50.4988261131 }}, /* 1838 K */
+    {{ 35.6788002949, 37.3981755976, 20.7861497143, 579.481772584, 59.8320745234, 50.5070941659 }}, /* 1839 K */
+    {{ 35.6807863642, 37.4005989155, 20.7861497134, 579.576621742, 59.8355067249, 50.5153559358 }}, /* 1840 K */
+    {{ 35.6827700899, 37.4030219454, 20.7861497124, 579.671374606, 59.8389347882, 50.5236114264 }}, /* 1841 K */
+    {{ 35.6847514757, 37.4054446874, 20.7861497115, 579.76603127, 59.8423587201, 50.5318606413 }}, /* 1842 K */
+    {{ 35.6867305252, 37.407867142, 20.7861497106, 579.860591834, 59.8457785274, 50.5401035842 }}, /* 1843 K */
+    {{ 35.6887072419, 37.4102893095, 20.7861497097, 579.955056392, 59.8491942168, 50.5483402587 }}, /* 1844 K */
+    {{ 35.6906816295, 37.4127111902, 20.7861497088, 580.049425042, 59.8526057951, 50.5565706686 }}, /* 1845 K */
+    {{ 35.6926536916, 37.4151327844, 20.7861497078, 580.143697881, 59.8560132691, 50.5647948173 }}, /* 1846 K */
+    {{ 35.6946234316, 37.4175540925, 20.7861497069, 580.237875005, 59.8594166454, 50.5730127087 }}, /* 1847 K */
+    {{ 35.6965908533, 37.4199751147, 20.786149706, 580.33195651, 59.8628159309, 50.5812243463 }}, /* 1848 K */
+    {{ 35.6985559602, 37.4223958513, 20.786149705, 580.425942494, 59.8662111321, 50.5894297339 }}, /* 1849 K */
+    {{ 35.7005187557, 37.4248163027, 20.7861497041, 580.519833051, 59.8696022558, 50.597628875 }}, /* 1850 K */
+    {{ 35.7024792436, 37.4272364691, 20.7861497032, 580.613628278, 59.8729893086, 50.6058217734 }}, /* 1851 K */
+    {{ 35.7044374273, 37.4296563508, 20.7861497022, 580.707328271, 59.8763722972, 50.6140084327 }}, /* 1852 K */
+    {{ 35.7063933104, 37.4320759481, 20.7861497013, 580.800933126, 59.8797512283, 50.6221888566 }}, /* 1853 K */
+    {{ 35.7083468964, 37.4344952613, 20.7861497003, 580.894442939, 59.8831261085, 50.6303630488 }}, /* 1854 K */
+    {{ 35.7102981889, 37.4369142907, 20.7861496994, 580.987857805, 59.8864969444, 50.638531013 }}, /* 1855 K */
+    {{ 35.7122471914, 37.4393330365, 20.7861496984, 581.08117782, 59.8898637426, 50.6466927527 }}, /* 1856 K */
+    {{ 35.7141939074, 37.441751499, 20.7861496975, 581.17440308, 59.8932265097, 50.6548482718 }}, /* 1857 K */
+    {{ 35.7161383404, 37.4441696784, 20.7861496965, 581.26753368, 59.8965852523, 50.6629975739 }}, /* 1858 K */
+    {{ 35.718080494, 37.4465875751, 20.7861496956, 581.360569715, 59.8999399769, 50.6711406626 }}, /* 1859 K */
+    {{ 35.7200203716, 37.4490051893, 20.7861496946, 581.45351128, 59.9032906902, 50.6792775417 }}, /* 1860 K */
+    {{ 35.7219579768, 37.4514225212, 20.7861496937, 581.546358471, 59.9066373986, 50.6874082149 }}, /* 1861 K */
+    {{ 35.723893313, 37.453839571, 20.7861496927, 581.639111383, 59.9099801087, 50.6955326858 }}, /* 1862 K */
+    {{ 35.7258263837, 37.4562563391, 20.7861496917, 581.73177011, 59.913318827, 50.7036509582 }}, /* 1863 K */
+    {{ 35.7277571925, 37.4586728256, 20.7861496908, 581.824334747, 59.91665356, 50.7117630358 }}, /* 1864 K */
+    {{ 35.7296857427, 37.4610890309, 20.7861496898, 581.916805389, 59.9199843142, 50.7198689222 }}, /* 1865 K */
+    {{ 35.7316120379, 37.463504955, 20.7861496888, 582.009182131, 59.9233110961, 50.7279686212 }}, /* 1866 K */
+    {{ 35.7335360816, 37.4659205983, 20.7861496878, 582.101465066, 59.9266339121, 50.7360621364 }}, /* 1867 K */
+    {{ 35.7354578771, 37.468335961, 20.7861496869, 582.19365429, 59.9299527686, 50.7441494716 }}, /* 1868 K */
+    {{ 35.737377428, 37.4707510432, 20.7861496859, 582.285749897, 59.9332676722, 50.7522306305 }}, /* 1869 K */
+    {{ 35.7392947377, 37.4731658452, 20.7861496849, 582.377751981, 59.9365786292, 50.7603056167 }}, /* 1870 K */
+    {{ 35.7412098096, 37.4755803673, 20.7861496839, 582.469660636, 59.9398856461, 50.7683744341 }}, /* 1871 K */
+    {{ 35.7431226472, 37.4779946096, 20.7861496829, 582.561475956, 59.9431887292, 50.7764370863 }}, /* 1872 K */
+    {{ 35.7450332539, 37.4804085723, 20.786149682, 582.653198035, 59.946487885, 50.7844935771 }}, /* 1873 K */
+    {{ 35.7469416331, 37.4828222556, 20.786149681, 582.744826967, 59.9497831198, 50.7925439101 }}, /* 1874 K */
+    {{ 35.7488477883, 37.4852356597, 20.78614968, 582.836362845, 59.95307444, 50.8005880891 }}, /* 1875 K */
+    {{ 35.7507517229, 37.4876487848, 20.786149679, 582.927805764, 59.9563618519, 50.8086261178 }}, /* 1876 K */
+    {{ 35.7526534402, 37.4900616312, 20.786149678, 583.019155816, 59.9596453618, 50.816658 }}, /* 1877 K */
+    {{ 35.7545529437, 37.4924741989, 20.786149677, 583.110413095, 59.9629249762, 50.8246837393 }}, /* 1878 K */
+    {{ 35.7564502369, 37.4948864881, 20.786149676, 583.201577694, 59.9662007012, 50.8327033395 }}, /* 1879 K */
+    {{ 35.758345323, 37.4972984991, 20.786149675, 583.292649707, 59.9694725432, 50.8407168043 }}, /* 1880 K */
+    {{ 35.7602382054, 37.499710232, 20.786149674, 583.383629227, 59.9727405086, 50.8487241375 }}, /* 1881 K */
+    {{ 35.7621288876, 37.5021216869, 20.786149673, 583.474516346, 59.9760046035, 50.8567253428 }}, /* 1882 K */
+    {{ 35.764017373, 37.5045328641, 20.786149672, 583.565311159, 59.9792648342, 50.864720424 }}, /* 1883 K */
+    {{ 35.7659036648, 37.5069437637, 20.786149671, 583.656013756, 59.9825212069, 50.8727093847 }}, /* 1884 K */
+    {{ 35.7677877665, 37.5093543858, 20.78614967, 583.746624232, 59.985773728, 50.8806922288 }}, /* 1885 K */
+    {{ 35.7696696814, 37.5117647307, 20.786149669, 583.837142679, 59.9890224036, 50.8886689599 }}, /* 1886 K */
+    {{ 35.7715494129, 37.5141747984, 20.786149668, 583.927569189, 59.99226724, 50.8966395818 }}, /* 1887 K */
+    {{ 35.7734269643, 37.5165845891, 20.7861496669, 584.017903855, 59.9955082433, 50.9046040983 }}, /* 1888 K */
+    {{ 35.775302339, 37.518994103, 20.7861496659, 584.108146769, 59.9987454197, 50.9125625131 }}, /* 1889 K */
+    {{ 35.7771755403, 37.5214033402, 20.7861496649, 584.198298023, 60.0019787755, 50.92051483 }}, /* 1890 K */
+    {{ 35.7790465716, 37.5238123007, 20.7861496639, 584.28835771, 60.0052083167, 50.9284610526 }}, /* 1891 K */
+    {{ 35.7809154361, 37.5262209849, 20.7861496629, 584.378325922, 60.0084340496, 50.9364011849 }}, /* 1892 K */
+    {{ 35.7827821372, 37.5286293927, 20.7861496619, 584.46820275, 60.0116559802, 50.9443352304 }}, /* 1893 K */
+    {{ 35.7846466782, 37.5310375244, 20.7861496608, 584.557988286, 60.0148741147, 50.9522631931 }}, /* 1894 K */
+    {{ 35.7865090624, 37.53344538, 20.7861496598, 584.647682623, 60.0180884592, 50.9601850765 }}, /* 1895 K */
+    {{ 35.7883692931, 37.5358529596, 20.7861496588, 584.737285851, 60.0212990199, 50.9681008846 }}, /* 1896 K */
+    {{ 35.7902273737, 37.5382602634, 20.7861496578, 584.826798063, 60.0245058027, 50.9760106211 }}, /* 1897 K */
+    {{ 35.7920833074, 37.5406672915, 20.7861496567, 584.916219349, 60.0277088138, 50.9839142897 }}, /* 1898 K */
+    {{ 35.7939370975, 37.543074044, 20.7861496557, 585.005549802, 60.0309080593, 50.9918118941 }}, /* 1899 K */
+    {{ 35.7957887473, 37.545480521, 20.7861496547, 585.094789512, 60.0341035452, 50.9997034383 }}, /* 1900 K */
+    {{ 35.7976382601, 37.5478867226, 20.7861496536, 585.183938571, 60.0372952775, 51.0075889258 }}, /* 1901 K */
+    {{ 35.7994856391, 37.5502926489, 20.7861496526, 585.27299707, 60.0404832624, 51.0154683606 }}, /* 1902 K */
+    {{ 35.8013308876, 37.5526983, 20.7861496516, 585.361965099, 60.0436675057, 51.0233417464 }}, /* 1903 K */
+    {{ 35.8031740089, 37.555103676, 20.7861496505, 585.45084275, 60.0468480136, 51.0312090869 }}, /* 1904 K */
+    {{ 35.8050150063, 37.5575087769, 20.7861496495, 585.539630113, 60.050024792, 51.0390703859 }}, /* 1905 K */
+    {{ 35.8068538829, 37.559913603, 20.7861496484, 585.628327279, 60.0531978469, 51.0469256472 }}, /* 1906 K */
+    {{ 35.808690642, 37.5623181541, 20.7861496474, 585.716934339, 60.0563671842, 51.0547748746 }}, /* 1907 K */
+    {{ 35.8105252869, 37.5647224305, 20.7861496464, 585.805451383, 60.05953281, 51.0626180719 }}, /* 1908 K */
+    {{ 35.8123578209, 37.5671264323, 20.7861496453, 585.893878502, 60.0626947302, 51.0704552428 }}, /* 1909 K */
+    {{ 35.8141882471, 37.5695301594, 20.7861496443, 585.982215786, 60.0658529508, 51.0782863912 }}, /* 1910 K */
+    {{ 35.8160165687, 37.5719336119, 20.7861496432, 586.070463324, 60.0690074775, 51.0861115207 }}, /* 1911 K */
+    {{ 35.817842789, 37.57433679, 20.7861496422, 586.158621208, 60.0721583165, 51.0939306352 }}, /* 1912 K */
+    {{ 35.8196669112, 37.5767396936, 20.7861496411, 586.246689527, 60.0753054735, 51.1017437385 }}, /* 1913 K */
+    {{ 35.8214889386, 37.5791423229, 20.7861496401, 586.334668371, 60.0784489546, 51.1095508344 }}, /* 1914 K */
+    {{ 35.8233088742, 37.5815446779, 20.786149639, 586.42255783, 60.0815887654, 51.1173519266 }}, /* 1915 K */
+    {{ 35.8251267214, 37.5839467587, 20.786149638, 586.510357994, 60.084724912, 51.125147019 }}, /* 1916 K */
+    {{ 35.8269424833, 37.5863485653, 20.7861496369, 586.598068952, 60.0878574002, 51.1329361153 }}, /* 1917 K */
+    {{ 35.828756163, 37.5887500977, 20.7861496358, 586.685690795, 60.0909862358, 51.1407192194 }}, /* 1918 K */
+    {{ 35.8305677639, 37.5911513561, 20.7861496348, 586.77322361, 60.0941114247, 51.1484963349 }}, /* 1919 K */
+    {{ 35.832377289, 37.5935523403, 20.7861496337, 586.860667488, 60.0972329727, 51.1562674658 }}, /* 1920 K */
+    {{ 35.8341847415, 37.5959530506, 20.7861496327, 586.948022518, 60.1003508857, 51.1640326158 }}, /* 1921 K */
+    {{ 35.8359901246, 37.598353487, 20.7861496316, 587.035288789, 60.1034651693, 51.1717917887 }}, /* 1922 K */
+    {{ 35.8377934415, 37.6007536493, 20.7861496306, 587.122466391, 60.1065758294, 51.1795449884 }}, /* 1923 K */
+    {{ 35.8395946953, 37.6031535378, 20.7861496295, 587.209555412, 60.1096828719, 51.1872922185 }}, /* 1924 K */
+    {{ 35.8413938892, 37.6055531524, 20.7861496284, 587.29655594, 60.1127863024, 51.1950334829 }}, /* 1925 K */
+    {{ 35.8431910263, 37.6079524932, 20.7861496274, 587.383468066, 60.1158861267, 51.2027687855 }}, /* 1926 K */
+    {{ 35.8449861098, 37.6103515602, 20.7861496263, 587.470291877, 60.1189823505, 51.21049813 }}, /* 1927 K */
+    {{ 35.8467791427, 37.6127503533, 20.7861496252, 587.557027462, 60.1220749797, 51.2182215202 }}, /* 1928 K */
+    {{ 35.8485701283, 37.6151488727, 20.7861496242, 587.64367491, 60.12516402, 51.22593896 }}, /* 1929 K */
+    {{ 35.8503590696, 37.6175471182, 20.7861496231, 587.730234309, 60.1282494769, 51.2336504531 }}, /* 1930 K */
+    {{ 35.8521459699, 37.6199450901, 20.786149622, 587.816705747, 60.1313313563, 51.2413560033 }}, /* 1931 K */
+    {{ 35.8539308321, 37.6223427882, 20.786149621, 587.903089313, 60.1344096639, 51.2490556145 }}, /* 1932 K */
+    {{ 35.8557136594, 37.6247402125, 20.7861496199, 587.989385094, 60.1374844053, 51.2567492904 }}, /* 1933 K */
+    {{ 35.8574944549, 37.6271373632, 20.7861496188, 588.075593179, 60.1405555861, 51.2644370349 }}, /* 1934 K */
+    {{ 35.8592732217, 37.62953424, 20.7861496177, 588.161713656, 60.1436232122, 51.2721188518 }}, /* 1935 K */
+    {{ 35.8610499629, 37.6319308432, 20.7861496167, 588.247746613, 60.146687289, 51.2797947449 }}, /* 1936 K */
+    {{ 35.8628246816, 37.6343271726, 20.7861496156, 588.333692137, 60.1497478223, 51.2874647181 }}, /* 1937 K */
+    {{ 35.864597381, 37.6367232283, 20.7861496145, 588.419550315, 60.1528048176, 51.295128775 }}, /* 1938 K */
+    {{ 35.8663680639, 37.6391190102, 20.7861496134, 588.505321237, 60.1558582807, 51.3027869196 }}, /* 1939 K */
+    {{ 35.8681367336, 37.6415145184, 20.7861496124, 588.591004988, 60.158908217, 51.3104391556 }}, /* 1940 K */
+    {{ 35.8699033931, 37.6439097528, 20.7861496113, 588.676601656, 60.1619546323, 51.318085487 }}, /* 1941 K */
+    {{ 35.8716680455, 37.6463047134, 20.7861496102, 588.76211133, 60.164997532, 51.3257259174 }}, /* 1942 K */
+    {{ 35.8734306938, 37.6486994002, 20.7861496091, 588.847534095, 60.1680369218, 51.3333604507 }}, /* 1943 K */
+    {{ 35.8751913411, 37.6510938132, 20.786149608, 588.932870039, 60.1710728071, 51.3409890908 }}, /* 1944 K */
+    {{ 35.8769499905, 37.6534879523, 20.786149607, 589.018119249, 60.1741051937, 51.3486118414 }}, /* 1945 K */
+    {{ 35.8787066449, 37.6558818175, 20.7861496059, 589.103281812, 60.177134087, 51.3562287064 }}, /* 1946 K */
+    {{ 35.8804613075, 37.6582754088, 20.7861496048, 589.188357814, 60.1801594925, 51.3638396896 }}, /* 1947 K */
+    {{ 35.8822139812, 37.6606687262, 20.7861496037, 589.273347343, 60.1831814158, 51.3714447948 }}, /* 1948 K */
+    {{ 35.8839646691, 37.6630617696, 20.7861496026, 589.358250485, 60.1861998624, 51.3790440259 }}, /* 1949 K */
+    {{ 35.8857133742, 37.665454539, 20.7861496016, 589.443067327, 60.1892148377, 51.3866373866 }}, /* 1950 K */
+    {{ 35.8874600995, 37.6678470343, 20.7861496005, 589.527797955, 60.1922263473, 51.3942248808 }}, /* 1951 K */
+    {{ 35.8892048481, 37.6702392555, 20.7861495994, 589.612442455, 60.1952343967, 51.4018065124 }}, /* 1952 K */
+    {{ 35.890947623, 37.6726312026, 20.7861495983, 589.697000914, 60.1982389913, 51.4093822851 }}, /* 1953 K */
+    {{ 35.8926884271, 37.6750228756, 20.7861495972, 589.781473418, 60.2012401366, 51.4169522028 }}, /* 1954 K */
+    {{ 35.8944272635, 37.6774142743, 20.7861495961, 589.865860053, 60.204237838, 51.4245162693 }}, /* 1955 K */
+    {{ 35.8961641352, 37.6798053987, 20.786149595, 589.950160904, 60.207232101, 51.4320744884 }}, /* 1956 K */
+    {{ 35.8978990451, 37.6821962488, 20.7861495939, 590.034376059, 60.2102229309, 51.439626864 }}, /* 1957 K */
+    {{ 35.8996319962, 37.6845868245, 20.7861495929, 590.118505602, 60.2132103333, 51.4471733999 }}, /* 1958 K */
+    {{ 35.9013629916, 37.6869771257, 20.7861495918, 590.20254962, 60.2161943136, 51.4547140999 }}, /* 1959 K */
+    {{ 35.9030920342, 37.6893671525, 20.7861495907, 590.286508198, 60.219174877, 51.4622489679 }}, /* 1960 K */
+    {{ 35.9048191269, 37.6917569047, 20.7861495896, 590.370381421, 60.2221520291, 51.4697780076 }}, /* 1961 K */
+    {{ 35.9065442728, 37.6941463822, 20.7861495885, 590.454169375, 60.2251257751, 51.477301223 }}, /* 1962 K */
+    {{ 35.9082674747, 37.6965355851, 20.7861495874, 590.537872146, 60.2280961205, 51.4848186178 }}, /* 1963 K */
+    {{ 35.9099887357, 37.6989245132, 20.7861495863, 590.621489818, 60.2310630706, 51.492330196 }}, /* 1964 K */
+    {{ 35.9117080588, 37.7013131665, 20.7861495852, 590.705022477, 60.2340266308, 51.4998359612 }}, /* 1965 K */
+    {{ 35.9134254467, 37.7037015448, 20.7861495841, 590.788470208, 60.2369868064, 51.5073359174 }}, /* 1966 K */
+    {{ 35.9151409026, 37.7060896482, 20.786149583, 590.871833096, 60.2399436027, 51.5148300685 }}, /* 1967 K */
+    {{ 35.9168544292, 37.7084774765, 20.7861495819, 590.955111226, 60.2428970251, 51.5223184181 }}, /* 1968 K */
+    {{ 35.9185660297, 37.7108650297, 20.7861495808, 591.038304682, 60.2458470788, 51.5298009702 }}, /* 1969 K */
+    {{ 35.9202757068, 37.7132523076, 20.7861495798, 591.121413549, 60.2487937692, 51.5372777286 }}, /* 1970 K */
+    {{ 35.9219834635, 37.7156393103, 20.7861495787, 591.204437913, 60.2517371015, 51.5447486972 }}, /* 1971 K */
+    {{ 35.9236893028, 37.7180260375, 20.7861495776, 591.287377857, 60.254677081, 51.5522138798 }}, /* 1972 K */
+    {{ 35.9253932274, 37.7204124893, 20.7861495765, 591.370233465, 60.257613713, 51.5596732801 }}, /* 1973 K */
+    {{ 35.9270952405, 37.7227986655, 20.7861495754, 591.453004824, 60.2605470028, 51.5671269021 }}, /* 1974 K */
+    {{ 35.9287953448, 37.725184566, 20.7861495743, 591.535692015, 60.2634769555, 51.5745747497 }}, /* 1975 K */
+    {{ 35.9304935432, 37.7275701908, 20.7861495732, 591.618295125, 60.2664035765, 51.5820168265 }}, /* 1976 K */
+    {{ 35.9321898387, 37.7299555398, 20.7861495721, 591.700814236, 60.2693268709, 51.5894531366 }}, /* 1977 K */
+    {{ 35.9338842341, 37.7323406128, 20.786149571, 591.783249433, 60.2722468441, 51.5968836837 }}, /* 1978 K */
+    {{ 35.9355767323, 37.7347254097, 20.7861495699, 591.865600799, 60.2751635011, 51.6043084716 }}, /* 1979 K */
+    {{ 35.9372673362, 37.7371099305, 20.7861495688, 591.94786842, 60.2780768472, 51.6117275042 }}, /* 1980 K */
+    {{ 35.9389560487, 37.739494175, 20.7861495677, 592.030052377, 60.2809868875, 51.6191407854 }}, /* 1981 K */
+    {{ 35.9406428727, 37.7418781432, 20.7861495666, 592.112152756, 60.2838936274, 51.626548319 }}, /* 1982 K */
+    {{ 35.9423278109, 37.7442618349, 20.7861495655, 592.194169639, 60.2867970718, 51.6339501088 }}, /* 1983 K */
+    {{ 35.9440108663, 37.74664525, 20.7861495644, 592.276103109, 60.2896972261, 51.6413461586 }}, /* 1984 K */
+    {{ 35.9456920417, 37.7490283884, 20.7861495633, 592.357953252, 60.2925940953, 51.6487364724 }}, /* 1985 K */
+    {{ 35.94737134, 37.7514112501, 20.7861495622, 592.439720148, 60.2954876846, 51.656121054 }}, /* 1986 K */
+    {{ 35.949048764, 37.7537938348, 20.7861495611, 592.521403883, 60.2983779991, 51.6634999071 }}, /* 1987 K */
+    {{ 35.9507243166, 37.7561761424, 20.78614956, 592.603004538, 60.3012650439, 51.6708730357 }}, /* 1988 K */
+    {{ 35.9523980005, 37.7585581729, 20.7861495589, 592.684522197, 60.3041488242, 51.6782404436 }}, /* 1989 K */
+    {{ 35.9540698187, 37.7609399262, 20.7861495578, 592.765956944, 60.307029345, 51.6856021346 }}, /* 1990 K */
+    {{ 35.955739774, 37.763321402, 20.7861495567, 592.847308859, 60.3099066115, 51.6929581126 }}, /* 1991 K */
+    {{ 35.9574078691, 37.7657026003, 20.7861495556, 592.928578028, 60.3127806288, 51.7003083814 }}, /* 1992 K */
+    {{ 35.9590741069, 37.7680835209, 20.7861495545, 593.009764531, 60.3156514018, 51.707652945 }}, /* 1993 K */
+    {{ 35.9607384903, 37.7704641638, 20.7861495534, 593.090868452, 60.3185189358, 51.714991807 }}, /* 1994 K */
+    {{ 35.9624010219, 37.7728445287, 20.7861495523, 593.171889873, 60.3213832356, 51.7223249714 }}, /* 1995 K */
+    {{ 35.9640617047, 37.7752246156, 20.7861495512, 593.252828877, 60.3242443065, 51.7296524419 }}, /* 1996 K */
+    {{ 35.9657205414, 37.7776044243, 20.7861495501, 593.333685545, 60.3271021534, 51.7369742226 }}, /* 1997 K */
+    {{ 35.9673775348, 37.7799839547, 20.786149549, 593.414459961, 60.3299567813, 51.7442903171 }}, /* 1998 K */
+    {{ 35.9690326878, 37.7823632067, 20.786149548, 593.495152206, 60.3328081953, 51.7516007294 }}, /* 1999 K */
+    {{ 35.970686003, 37.78474218, 20.7861495469, 593.575762362, 60.3356564004, 51.7589054633 }}, /* 2000 K */
+    {{ 35.9723374833, 37.7871208747, 20.7861495458, 593.656290512, 60.3385014016, 51.7662045226 }}, /* 2001 K */
+    {{ 35.9739871315, 37.7894992904, 20.7861495447, 593.736736736, 60.3413432039, 51.7734979113 }}, /* 2002 K */
+    {{ 35.9756349503, 37.7918774271, 20.7861495436, 593.817101118, 60.3441818122, 51.780785633 }}, /* 2003 K */
+    {{ 35.9772809425, 37.7942552847, 20.7861495425, 593.897383738, 60.3470172316, 51.7880676917 }}, /* 2004 K */
+    {{ 35.9789251108, 37.7966328629, 20.7861495414, 593.977584678, 60.3498494669, 51.7953440913 }}, /* 2005 K */
+    {{ 35.9805674581, 37.7990101617, 20.7861495403, 594.05770402, 60.3526785233, 51.8026148355 }}, /* 2006 K */
+    {{ 35.982207987, 37.8013871809, 20.7861495392, 594.137741845, 60.3555044055, 51.8098799283 }}, /* 2007 K */
+    {{ 35.9838467004, 37.8037639203, 20.7861495381, 594.217698234, 60.3583271186, 51.8171393734 }}, /* 2008 K */
+    {{ 35.9854836009, 37.8061403798, 20.786149537, 594.29757327, 60.3611466674, 51.8243931748 }}, /* 2009 K */
+    {{ 35.9871186913, 37.8085165591, 20.7861495359, 594.377367032, 60.3639630569, 51.8316413362 }}, /* 2010 K */
+    {{ 35.9887519744, 37.8108924583, 20.7861495348, 594.457079603, 60.3667762921, 51.8388838615 }}, /* 2011 K */
+    {{ 35.9903834528, 37.8132680771, 20.7861495337, 594.536711062, 60.3695863777, 51.8461207546 }}, /* 2012 K */
+    {{ 35.9920131294, 37.8156434153, 20.7861495326, 594.616261492, 60.3723933187, 51.8533520193 }}, /* 2013 K */
+    {{ 35.9936410067, 37.8180184728, 20.7861495315, 594.695730972, 60.3751971201, 51.8605776594 }}, /* 2014 K */
+    {{ 35.9952670876, 37.8203932494, 20.7861495304, 594.775119584, 60.3779977865, 51.8677976788 }}, /* 2015 K */
+    {{ 35.9968913747, 37.8227677449, 20.7861495293, 594.854427408, 60.380795323, 51.8750120814 }}, /* 2016 K */
+    {{ 35.9985138709, 37.8251419592, 20.7861495282, 594.933654524, 60.3835897344, 51.882220871 }}, /* 2017 K */
+    {{ 36.0001345786, 37.8275158922, 20.7861495271, 595.012801015, 60.3863810255, 51.8894240515 }}, /* 2018 K */
+    {{ 36.0017535008, 37.8298895436, 20.786149526, 595.091866958, 60.3891692012, 51.8966216266 }}, /* 2019 K */
+    {{ 36.00337064, 37.8322629133, 20.786149525, 595.170852436, 60.3919542662, 51.9038136002 }}, /* 2020 K */
+    {{ 36.0049859989, 37.834636001, 20.7861495239, 595.249757528, 60.3947362255, 51.9109999763 }}, /* 2021 K */
+    {{ 36.0065995803, 37.8370088067, 20.7861495228, 595.328582314, 60.3975150838, 51.9181807586 }}, /* 2022 K */
+    {{ 36.0082113868, 37.8393813302, 20.7861495217, 595.407326875, 60.400290846, 51.9253559509 }}, /* 2023 K */
+    {{ 36.0098214211, 37.8417535712, 20.7861495206, 595.48599129, 60.4030635168, 51.9325255572 }}, /* 2024 K */
+    {{ 36.0114296859, 37.8441255296, 20.7861495195, 595.564575639, 60.405833101, 51.9396895813 }}, /* 2025 K */
+    {{ 36.0130361838, 37.8464972052, 20.7861495184, 595.643080002, 60.4085996034, 51.9468480269 }}, /* 2026 K */
+    {{ 36.0146409175, 37.8488685979, 20.7861495173, 595.72150446, 60.4113630288, 51.9540008981 }}, /* 2027 K */
+    {{ 36.0162438897, 37.8512397074, 20.7861495162, 595.79984909, 60.414123382, 51.9611481985 }}, /* 2028 K */
+    {{ 36.017845103, 37.8536105336, 20.7861495151, 595.878113974, 60.4168806676, 51.9682899322 }}, /* 2029 K */
+    {{ 36.0194445601, 37.8559810762, 20.786149514, 595.95629919, 60.4196348904, 51.9754261028 }}, /* 2030 K */
+    {{ 36.0210422636, 37.8583513352, 20.786149513, 596.034404818, 60.4223860552, 51.9825567142 }}, /* 2031 K */
+    {{ 36.0226382162, 37.8607213102, 20.7861495119, 596.112430937, 60.4251341667, 51.9896817704 }}, /* 2032 K */
+    {{ 36.0242324205, 37.8630910011, 20.7861495108, 596.190377626, 60.4278792296, 51.9968012751 }}, /* 2033 K */
+    {{ 36.0258248791, 37.8654604078, 20.7861495097, 596.268244964, 60.4306212487, 52.0039152322 }}, /* 2034 K */
+    {{ 36.0274155946, 37.86782953, 20.7861495086, 596.346033032, 60.4333602285, 52.0110236455 }}, /* 2035 K */
+    {{ 36.0290045698, 37.8701983675, 20.7861495075, 596.423741906, 60.4360961739, 52.0181265189 }}, /* 2036 K */
+    {{ 36.0305918072, 37.8725669201, 20.7861495064, 596.501371667, 60.4388290894, 52.0252238562 }}, /* 2037 K */
+    {{ 36.0321773093, 37.8749351877, 20.7861495054, 596.578922393, 60.4415589799, 52.0323156613 }}, /* 2038 K */
+    {{ 36.033761079, 37.8773031701, 20.7861495043, 596.656394163, 60.4442858499, 52.039401938 }}, /* 2039 K */
+    {{ 36.0353431186, 37.8796708669, 20.7861495032, 596.733787055, 60.4470097041, 52.0464826902 }}, /* 2040 K */
+    {{ 36.036923431, 37.8820382781, 20.7861495021, 596.811101148, 60.4497305471, 52.0535579216 }}, /* 2041 K */
+    {{ 36.0385020186, 37.8844054035, 20.786149501, 596.88833652, 60.4524483837, 52.0606276362 }}, /* 2042 K */
+    {{ 36.040078884, 37.8867722427, 20.7861495, 596.965493251, 60.4551632184, 52.0676918378 }}, /* 2043 K */
+    {{ 36.0416540298, 37.8891387957, 20.7861494989, 597.042571417, 60.4578750558, 52.0747505302 }}, /* 2044 K */
+    {{ 36.0432274587, 37.8915050623, 20.7861494978, 597.119571097, 60.4605839006, 52.0818037173 }}, /* 2045 K */
+    {{ 36.0447991732, 37.8938710421, 20.7861494967, 597.19649237, 60.4632897574, 52.0888514029 }}, /* 2046 K */
+    {{ 36.0463691759, 37.896236735, 20.7861494956, 597.273335314, 60.4659926308, 52.0958935908 }}, /* 2047 K */
+    {{ 36.0479374693, 37.8986021409, 20.7861494946, 597.350100005, 60.4686925254, 52.1029302849 }}, /* 2048 K */
+    {{ 36.049504056, 37.9009672594, 20.7861494935, 597.426786523, 60.4713894457, 52.1099614891 }}, /* 2049 K */
+    {{ 36.0510689387, 37.9033320904, 20.7861494924, 597.503394945, 60.4740833964, 52.1169872072 }}, /* 2050 K */
+    {{ 36.0526321197, 37.9056966337, 20.7861494913, 597.579925349, 60.476774382, 52.1240074429 }}, /* 2051 K */
+    {{ 36.0541936018, 37.908060889, 20.7861494903, 597.656377811, 60.4794624071, 52.1310222003 }}, /* 2052 K */
+    {{ 36.0557533875, 37.9104248561, 20.7861494892, 597.732752411, 60.4821474762, 52.138031483 }}, /* 2053 K */
+    {{ 36.0573114793, 37.9127885349, 20.7861494881, 597.809049225, 60.4848295938, 52.1450352949 }}, /* 2054 K */
+    {{ 36.0588678797, 37.915151925, 20.786149487, 597.885268331, 60.4875087646, 52.15203364 }}, /* 2055 K */
+    {{ 36.0604225913, 37.9175150263, 20.786149486, 597.961409806, 60.490184993, 52.1590265219 }}, /* 2056 K */
+    {{ 36.0619756166, 37.9198778386, 20.7861494849, 598.037473727, 60.4928582836, 52.1660139447 }}, /* 2057 K */
+    {{ 36.0635269582, 37.9222403616, 20.7861494838, 598.113460171, 60.4955286408, 52.172995912 }}, /* 2058 K */
+    {{ 36.0650766186, 37.9246025951, 20.7861494828, 598.189369216, 60.4981960692, 52.1799724277 }}, /* 2059 K */
+    {{ 36.0666246003, 37.9269645389, 20.7861494817, 598.265200938, 60.5008605732, 52.1869434957 }}, /* 2060 K */
+    {{ 36.0681709059, 37.9293261928, 20.7861494806, 598.340955414, 60.5035221574, 52.1939091198 }}, /* 2061 K */
+    {{ 36.0697155378, 37.9316875565, 20.7861494796, 598.416632721, 60.5061808263, 52.2008693039 }}, /* 2062 K */
+    {{ 36.0712584985, 37.9340486298, 20.7861494785, 598.492232936, 60.5088365842, 52.2078240517 }}, /* 2063 K */
+    {{ 36.0727997906, 37.9364094125, 20.7861494774, 598.567756135, 60.5114894358, 52.2147733671 }}, /* 2064 K */
+    {{ 36.0743394165, 37.9387699044, 20.7861494764, 598.643202395, 60.5141393853, 52.221717254 }}, /* 2065 K */
+    {{ 36.0758773789, 37.9411301051, 20.7861494753, 598.718571793, 60.5167864373, 52.2286557162 }}, /* 2066 K */
+    {{ 36.07741368, 37.9434900146, 20.7861494742, 598.793864404, 60.5194305963, 52.2355887575 }}, /* 2067 K */
+    {{ 36.0789483226, 37.9458496325, 20.7861494732, 598.869080306, 60.5220718666, 52.2425163817 }}, /* 2068 K */
+    {{ 36.0804813089, 37.9482089587, 20.7861494721, 598.944219573, 60.5247102526, 52.2494385927 }}, /* 2069 K */
+    {{ 36.0820126416, 37.9505679928, 20.7861494711, 599.019282283, 60.5273457589, 52.2563553943 }}, /* 2070 K */
+    {{ 36.0835423231, 37.9529267347, 20.78614947, 599.094268512, 60.5299783898, 52.2632667904 }}, /* 2071 K */
+    {{ 36.0850703558, 37.9552851841, 20.786149469, 599.169178335, 60.5326081496, 52.2701727848 }}, /* 2072 K */
+    {{ 36.0865967423, 37.9576433408, 20.7861494679, 599.244011828, 60.5352350429, 52.2770733812 }}, /* 2073 K */
+    {{ 36.088121485, 37.9600012046, 20.7861494668, 599.318769068, 60.5378590739, 52.2839685836 }}, /* 2074 K */
+    {{ 36.0896445863, 37.9623587751, 20.7861494658, 599.39345013, 60.5404802471, 52.2908583958 }}, /* 2075 K */
+    {{ 36.0911660488, 37.9647160522, 20.7861494647, 599.468055089, 60.5430985669, 52.2977428216 }}, /* 2076 K */
+    {{ 36.0926858748, 37.9670730356, 20.7861494637, 599.542584022, 60.5457140375, 52.3046218648 }}, /* 2077 K */
+    {{ 36.0942040669, 37.9694297251, 20.7861494626, 599.617037003, 60.5483266634, 52.3114955292 }}, /* 2078 K */
+    {{ 36.0957206274, 37.9717861205, 20.7861494616, 599.691414108, 60.5509364489, 52.3183638188 }}, /* 2079 K */
+    {{ 36.0972355588, 37.9741422214, 20.7861494605, 599.765715413, 60.5535433983, 52.3252267372 }}, /* 2080 K */
+    {{ 36.0987488636, 37.9764980277, 20.7861494595, 599.839940993, 60.556147516, 52.3320842884 }}, /* 2081 K */
+    {{ 36.1002605442, 37.9788535391, 20.7861494584, 599.914090922, 60.5587488063, 52.3389364762 }}, /* 2082 K */
+    {{ 36.1017706029, 37.9812087553, 20.7861494574, 599.988165277, 60.5613472735, 52.3457833044 }}, /* 2083 K */
+    {{ 36.1032790424, 37.9835636762, 20.7861494564, 600.062164131, 60.563942922, 52.3526247767 }}, /* 2084 K */
+    {{ 36.1047858648, 37.9859183014, 20.7861494553, 600.136087561, 60.5665357559, 52.3594608971 }}, /* 2085 K */
+    {{ 36.1062910728, 37.9882726307, 20.7861494543, 600.20993564, 60.5691257797, 52.3662916694 }}, /* 2086 K */
+    {{ 36.1077946686, 37.9906266638, 20.7861494532, 600.283708444, 60.5717129976, 52.3731170973 }}, /* 2087 K */
+    {{ 36.1092966547, 37.9929804006, 20.7861494522, 600.357406047, 60.5742974139, 52.3799371848 }}, /* 2088 K */
+    {{ 36.1107970335, 37.9953338407, 20.7861494512, 600.431028525, 60.5768790328, 52.3867519356 }}, /* 2089 K */
+    {{ 36.1122958074, 37.9976869839, 20.7861494501, 600.50457595, 60.5794578587, 52.3935613536 }}, /* 2090 K */
+    {{ 36.1137929789, 38.00003983, 20.7861494491, 600.578048399, 60.5820338958, 52.4003654425 }}, /* 2091 K */
+    {{ 36.1152885502, 38.0023923787, 20.786149448, 600.651445945, 60.5846071483, 52.4071642062 }}, /* 2092 K */
+    {{ 36.1167825238, 38.0047446297, 20.786149447, 600.724768663, 60.5871776204, 52.4139576485 }}, /* 2093 K */
+    {{ 36.118274902, 38.0070965827, 20.786149446, 600.798016627, 60.5897453165, 52.4207457733 }}, /* 2094 K */
+    {{ 36.1197656873, 38.0094482376, 20.786149445, 600.871189911, 60.5923102408, 52.4275285843 }}, /* 2095 K */
+    {{ 36.1212548821, 38.0117995941, 20.7861494439, 600.944288588, 60.5948723973, 52.4343060853 }}, /* 2096 K */
+    {{ 36.1227424886, 38.0141506519, 20.7861494429, 601.017312734, 60.5974317905, 52.4410782803 }}, /* 2097 K */
+    {{ 36.1242285093, 38.0165014107, 20.7861494419, 601.090262422, 60.5999884245, 52.447845173 }}, /* 2098 K */
+    {{ 36.1257129466, 38.0188518703, 20.7861494408, 601.163137726, 60.6025423034, 52.4546067671 }}, /* 2099 K */
+    {{ 36.1271958027, 38.0212020304, 20.7861494398, 601.23593872, 60.6050934315, 52.4613630666 }}, /* 2100 K */
+    {{ 36.1286770801, 38.0235518907, 20.7861494388, 601.308665476, 60.6076418129, 52.4681140752 }}, /* 2101 K */
+    {{ 36.1301567811, 38.0259014511, 20.7861494378, 601.38131807, 60.6101874519, 52.4748597968 }}, /* 2102 K */
+    {{ 36.1316349081, 38.0282507112, 20.7861494368, 601.453896574, 60.6127303526, 52.4816002352 }}, /* 2103 K */
+    {{ 36.1331114634, 38.0305996708, 20.7861494357, 601.526401062, 60.6152705192, 52.4883353941 }}, /* 2104 K */
+    {{ 36.1345864493, 38.0329483295, 20.7861494347, 601.598831607, 60.6178079558, 52.4950652774 }}, /* 2105 K */
+    {{ 36.1360598682, 38.0352966872, 20.7861494337, 601.671188283, 60.6203426665, 52.501789889 }}, /* 2106 K */
+    {{ 36.1375317225, 38.0376447436, 20.7861494327, 601.743471162, 60.6228746556, 52.5085092325 }}, /* 2107 K */
+    {{ 36.1390020143, 38.0399924984, 20.7861494317, 601.815680319, 60.6254039271, 52.5152233119 }}, /* 2108 K */
+    {{ 36.1404707462, 38.0423399513, 20.7861494307, 601.887815825, 60.6279304852, 52.5219321308 }}, /* 2109 K */
+    {{ 36.1419379204, 38.0446871021, 20.7861494296, 601.959877754, 60.630454334, 52.5286356932 }}, /* 2110 K */
+    {{ 36.1434035392, 38.0470339504, 20.7861494286, 602.031866179, 60.6329754775, 52.5353340029 }}, /* 2111 K */
+    {{ 36.1448676049, 38.0493804961, 20.7861494276, 602.103781173, 60.63549392, 52.5420270636 }}, /* 2112 K */
+    {{ 36.1463301199, 38.0517267389, 20.7861494266, 602.175622808, 60.6380096655, 52.5487148791 }}, /* 2113 K */
+    {{ 36.1477910865, 38.0540726784, 20.7861494256, 602.247391157, 60.6405227181, 52.5553974533 }}, /* 2114 K */
+    {{ 36.1492505069, 38.0564183144, 20.7861494246, 602.319086293, 60.6430330819, 52.56207479 }}, /* 2115 K */
+    {{ 36.1507083834, 38.0587636467, 20.7861494236, 602.390708288, 60.645540761, 52.5687468929 }}, /* 2116 K */
+    {{ 36.1521647185, 38.0611086749, 20.7861494226, 602.462257215, 60.6480457593, 52.5754137659 }}, /* 2117 K */
+    {{ 36.1536195143, 38.0634533989, 20.7861494216, 602.533733146, 60.6505480811, 52.5820754127 }}, /* 2118 K */
+    {{ 36.1550727731, 38.0657978182, 20.7861494206, 602.605136153, 60.6530477303, 52.5887318372 }}, /* 2119 K */
+    {{ 36.1565244973, 38.0681419327, 20.7861494196, 602.676466308, 60.6555447111, 52.5953830432 }}, /* 2120 K */
+    {{ 36.157974689, 38.070485742, 20.7861494186, 602.747723685, 60.6580390273, 52.6020290344 }}, /* 2121 K */
+    {{ 36.1594233507, 38.0728292459, 20.7861494176, 602.818908353, 60.6605306832, 52.6086698147 }}, /* 2122 K */
+    {{ 36.1608704845, 38.0751724441, 20.7861494166, 602.890020387, 60.6630196827, 52.6153053878 }}, /* 2123 K */
+    {{ 36.1623160927, 38.0775153364, 20.7861494156, 602.961059857, 60.6655060298, 52.6219357576 }}, /* 2124 K */
+    {{ 36.1637601777, 38.0798579224, 20.7861494146, 603.032026836, 60.6679897285, 52.6285609278 }}, /* 2125 K */
+    {{ 36.1652027416, 38.0822002018, 20.7861494137, 603.102921395, 60.6704707829, 52.6351809023 }}, /* 2126 K */
+    {{ 36.1666437867, 38.0845421745, 20.7861494127, 603.173743605, 60.672949197, 52.6417956848 }}, /* 2127 K */
+    {{ 36.1680833153, 38.08688384, 20.7861494117, 603.244493539, 60.6754249747, 52.6484052791 }}, /* 2128 K */
+    {{ 36.1695213296, 38.0892251982, 20.7861494107, 603.315171269, 60.6778981201, 52.655009689 }}, /* 2129 K */
+    {{ 36.1709578319, 38.0915662487, 20.7861494097, 603.385776864, 60.6803686371, 52.6616089184 }}, /* 2130 K */
+    {{ 36.1723928244, 38.0939069913, 20.7861494087, 603.456310398, 60.6828365296, 52.6682029709 }}, /* 2131 K */
+    {{ 36.1738263094, 38.0962474257, 20.7861494078, 603.52677194, 60.6853018018, 52.6747918504 }}, /* 2132 K */
+    {{ 36.1752582891, 38.0985875515, 20.7861494068, 603.597161563, 60.6877644575, 52.6813755607 }}, /* 2133 K */
+    {{ 36.1766887657, 38.1009273686, 20.7861494058, 603.667479338, 60.6902245006, 52.6879541056 }}, /* 2134 K */
+    {{ 36.1781177414, 38.1032668766, 20.7861494048, 603.737725335, 60.6926819352, 52.6945274888 }}, /* 2135 K */
+    {{ 36.1795452185, 38.1056060752, 20.7861494039, 603.807899625, 60.6951367651, 52.7010957141 }}, /* 2136 K */
+    {{ 36.1809711993, 38.1079449642, 20.7861494029, 603.878002281, 60.6975889944, 52.7076587854 }}, /* 2137 K */
+    {{ 36.1823956859, 38.1102835432, 20.7861494019, 603.948033371, 60.7000386268, 52.7142167063 }}, /* 2138 K */
+    {{ 36.1838186805, 38.1126218121, 20.786149401, 604.017992968, 60.7024856664, 52.7207694808 }}, /* 2139 K */
+    {{ 36.1852401853, 38.1149597704, 20.7861494, 604.087881142, 60.7049301171, 52.7273171125 }}, /* 2140 K */
+    {{ 36.1866602026, 38.1172974179, 20.786149399, 604.157697963, 60.7073719828, 52.7338596052 }}, /* 2141 K */
+    {{ 36.1880787346, 38.1196347543, 20.7861493981, 604.227443502, 60.7098112673, 52.7403969628 }}, /* 2142 K */
+    {{ 36.1894957835, 38.1219717794, 20.7861493971, 604.29711783, 60.7122479746, 52.7469291889 }}, /* 2143 K */
+    {{ 36.1909113513, 38.1243084928, 20.7861493962, 604.366721017, 60.7146821086, 52.7534562875 }}, /* 2144 K */
+    {{ 36.1923254405, 38.1266448942, 20.7861493952, 604.436253133, 60.717113673, 52.7599782622 }}, /* 2145 K */
+    {{ 36.1937380531, 38.1289809834, 20.7861493942, 604.505714248, 60.7195426719, 52.7664951168 }}, /* 2146 K */
+    {{ 36.1951491913, 38.1313167601, 20.7861493933, 604.575104434, 60.7219691091, 52.7730068552 }}, /* 2147 K */
+    {{ 36.1965588573, 38.1336522239, 20.7861493923, 604.644423759, 60.7243929884, 52.779513481 }}, /* 2148 K */
+    {{ 36.1979670533, 38.1359873746, 20.7861493914, 604.713672294, 60.7268143137, 52.7860149981 }}, /* 2149 K */
+    {{ 36.1993737815, 38.1383222119, 20.7861493904, 604.782850109, 60.7292330889, 52.7925114102 }}, /* 2150 K */
+    {{ 36.200779044, 38.1406567355, 20.7861493895, 604.851957273, 60.7316493177, 52.7990027211 }}, /* 2151 K */
+    {{ 36.202182843, 38.1429909451, 20.7861493885, 604.920993857, 60.7340630041, 52.8054889346 }}, /* 2152 K */
+    {{ 36.2035851807, 38.1453248405, 20.7861493876, 604.989959931, 60.7364741518, 52.8119700544 }}, /* 2153 K */
+    {{ 36.2049860592, 38.1476584212, 20.7861493867, 605.058855563, 60.7388827647, 52.8184460844 }}, /* 2154 K */
+    {{ 36.2063854807, 38.149991687, 20.7861493857, 605.127680824, 60.7412888466, 52.8249170282 }}, /* 2155 K */
+    {{ 36.2077834473, 38.1523246377, 20.7861493848, 605.196435783, 60.7436924013, 52.8313828896 }}, /* 2156 K */
+    {{ 36.2091799612, 38.1546572729, 20.7861493838, 605.265120509, 60.7460934326, 52.8378436725 }}, /* 2157 K */
+    {{ 36.2105750245, 38.1569895923, 20.7861493829, 605.333735073, 60.7484919443, 52.8442993805 }}, /* 2158 K */
+    {{ 36.2119686395, 38.1593215956, 20.786149382, 605.402279543, 60.7508879402, 52.8507500174 }}, /* 2159 K */
+    {{ 36.2133608081, 38.1616532826, 20.786149381, 605.470753988, 60.7532814241, 52.857195587 }}, /* 2160 K */
+    {{ 36.2147515326, 38.163984653, 20.7861493801, 605.539158477, 60.7556723997, 52.8636360931 }}, /* 2161 K */
+    {{ 36.2161408151, 38.1663157063, 20.7861493792, 605.607493081, 60.7580608709, 52.8700715394 }}, /* 2162 K */
+    {{ 36.2175286576, 38.1686464425, 20.7861493783, 605.675757867, 60.7604468413, 52.8765019297 }}, /* 2163 K */
+    {{ 36.2189150625, 38.170976861, 20.7861493773, 605.743952905, 60.7628303148, 52.8829272677 }}, /* 2164 K */
+    {{ 36.2203000316, 38.1733069617, 20.7861493764, 605.812078263, 60.7652112952, 52.8893475572 }}, /* 2165 K */
+    {{ 36.2216835673, 38.1756367443, 20.7861493755, 605.880134011, 60.767589786, 52.8957628019 }}, /* 2166 K */
+    {{ 36.2230656716, 38.1779662084, 20.7861493746, 605.948120216, 60.7699657912, 52.9021730056 }}, /* 2167 K */
+    {{ 36.2244463465, 38.1802953537, 20.7861493737, 606.016036949, 60.7723393144, 52.9085781721 }}, /* 2168 K */
+    {{ 36.2258255943, 38.18262418, 20.7861493728, 606.083884276, 60.7747103594, 52.9149783051 }}, /* 2169 K */
+    {{ 36.227203417, 38.184952687, 20.7861493718, 606.151662268, 60.7770789298, 52.9213734083 }}, /* 2170 K */
+    {{ 36.2285798167, 38.1872808743, 20.7861493709, 606.219370991, 60.7794450295, 52.9277634856 }}, /* 2171 K */
+    {{ 36.2299547955, 38.1896087416, 20.78614937, 606.287010516, 60.781808662, 52.9341485406 }}, /* 2172 K */
+    {{ 36.2313283556, 38.1919362887, 20.7861493691, 606.354580909, 60.7841698312, 52.940528577 }}, /* 2173 K */
+    {{ 36.2327004989, 38.1942635152, 20.7861493682, 606.422082239, 60.7865285407, 52.9469035988 }}, /* 2174 K */
+    {{ 36.2340712276, 38.1965904208, 20.7861493673, 606.489514574, 60.7888847942, 52.9532736095 }}, /* 2175 K */
+    {{ 36.2354405438, 38.1989170053, 20.7861493664, 606.556877983, 60.7912385953, 52.959638613 }}, /* 2176 K */
+    {{ 36.2368084496, 38.2012432683, 20.7861493655, 606.624172534, 60.7935899479, 52.965998613 }}, /* 2177 K */
+    {{ 36.238174947, 38.2035692095, 20.7861493646, 606.691398293, 60.7959388555, 52.9723536132 }}, /* 2178 K */
+    {{ 36.2395400381, 38.2058948287, 20.7861493637, 606.75855533, 60.7982853217, 52.9787036173 }}, /* 2179 K */
+    {{ 36.2409037249, 38.2082201255, 20.7861493628, 606.825643711, 60.8006293504, 52.9850486292 }}, /* 2180 K */
+    {{ 36.2422660096, 38.2105450996, 20.7861493619, 606.892663505, 60.8029709451, 52.9913886525 }}, /* 2181 K */
+    {{ 36.2436268942, 38.2128697507, 20.786149361, 606.95961478, 60.8053101094, 52.997723691 }}, /* 2182 K */
+    {{ 36.2449863808, 38.2151940785, 20.7861493602, 607.026497603, 60.8076468471, 53.0040537485 }}, /* 2183 K */
+    {{ 36.2463444714, 38.2175180827, 20.7861493593, 607.09331204, 60.8099811617, 53.0103788285 }}, /* 2184 K */
+    {{ 36.247701168, 38.219841763, 20.7861493584, 607.160058161, 60.8123130569, 53.016698935 }}, /* 2185 K */
+    {{ 36.2490564728, 38.222165119, 20.7861493575, 607.226736032, 60.8146425363, 53.0230140716 }}, /* 2186 K */
+    {{ 36.2504103878, 38.2244881506, 20.7861493566, 607.293345721, 60.8169696035, 53.0293242421 }}, /* 2187 K */
+    {{ 36.251762915, 38.2268108573, 20.7861493557, 607.359887294, 60.8192942622, 53.0356294502 }}, /* 2188 K */
+    {{ 36.2531140564, 38.2291332389, 20.7861493549, 607.426360819, 60.8216165159, 53.0419296996 }}, /* 2189 K */
+    {{ 36.2544638141, 38.2314552951, 20.786149354, 607.492766364, 60.8239363683, 53.048224994 }}, /* 2190 K */
+    {{ 36.2558121901, 38.2337770255, 20.7861493531, 607.559103994, 60.8262538229, 53.0545153372 }}, /* 2191 K */
+    {{ 36.2571591865, 38.2360984299, 20.7861493523, 607.625373777, 60.8285688834, 53.0608007329 }}, /* 2192 K */
+    {{ 36.2585048053, 38.2384195078, 20.7861493514, 607.69157578, 60.8308815533, 53.0670811849 }}, /* 2193 K */
+    {{ 36.2598490484, 38.2407402592, 20.7861493505, 607.75771007, 60.8331918361, 53.0733566968 }}, /* 2194 K */
+    {{ 36.261191918, 38.2430606835, 20.7861493497, 607.823776713, 60.8354997356, 53.0796272724 }}, /* 2195 K */
+    {{ 36.262533416, 38.2453807806, 20.7861493488, 607.889775777, 60.8378052551, 53.0858929154 }}, /* 2196 K */
+    {{ 36.2638735445, 38.24770055, 20.7861493479, 607.955707327, 60.8401083984, 53.0921536295 }}, /* 2197 K */
+    {{ 36.2652123054, 38.2500199915, 20.7861493471, 608.02157143, 60.8424091689, 53.0984094185 }}, /* 2198 K */
+    {{ 36.2665497008, 38.2523391049, 20.7861493462, 608.087368153, 60.8447075702, 53.104660286 }}, /* 2199 K */
+    {{ 36.2678857327, 38.2546578897, 20.7861493454, 608.153097562, 60.8470036059, 53.1109062358 }}, /* 2200 K */
+    {{ 36.269220403, 38.2569763456, 20.7861493445, 608.218759723, 60.8492972794, 53.1171472716 }}, /* 2201 K */
+    {{ 36.2705537138, 38.2592944725, 20.7861493437, 608.284354704, 60.8515885944, 53.1233833971 }}, /* 2202 K */
+    {{ 36.2718856671, 38.2616122698, 20.7861493428, 608.349882568, 60.8538775543, 53.129614616 }}, /* 2203 K */
+    {{ 36.2732162648, 38.2639297374, 20.786149342, 608.415343384, 60.8561641626, 53.1358409321 }}, /* 2204 K */
+    {{ 36.2745455089, 38.266246875, 20.7861493412, 608.480737217, 60.8584484229, 53.142062349 }}, /* 2205 K */
+    {{ 36.2758734015, 38.2685636821, 20.7861493403, 608.546064133, 60.8607303387, 53.1482788705 }}, /* 2206 K */
+    {{ 36.2771999445, 38.2708801585, 20.7861493395, 608.611324198, 60.8630099135, 53.1544905002 }}, /* 2207 K */
+    {{ 36.2785251398, 38.273196304, 20.7861493386, 608.676517478, 60.8652871507, 53.1606972419 }}, /* 2208 K */
+    {{ 36.2798489895, 38.2755121181, 20.7861493378, 608.741644038, 60.867562054, 53.1668990993 }}, /* 2209 K */
+    {{ 36.2811714955, 38.2778276005, 20.786149337, 608.806703944, 60.8698346266, 53.1730960761 }}, /* 2210 K */
+    {{ 36.2824926598, 38.2801427511, 20.7861493361, 608.871697262, 60.8721048723, 53.1792881759 }}, /* 2211 K */
+    {{ 36.2838124844, 38.2824575693, 20.7861493353, 608.936624058, 60.8743727943, 53.1854754026 }}, /* 2212 K */
+    {{ 36.2851309712, 38.284772055, 20.7861493345, 609.001484396, 60.8766383962, 53.1916577597 }}, /* 2213 K */
+    {{ 36.2864481221, 38.2870862078, 20.7861493337, 609.066278343, 60.8789016814, 53.1978352511 }}, /* 2214 K */
+    {{ 36.2877639392, 38.2894000275, 20.7861493329, 609.131005964, 60.8811626535, 53.2040078803 }}, /* 2215 K */
+    {{ 36.2890784243, 38.2917135136, 20.786149332, 609.195667323, 60.8834213158, 53.2101756511 }}, /* 2216 K */
+    {{ 36.2903915795, 38.2940266659, 20.7861493312, 609.260262487, 60.8856776718, 53.2163385673 }}, /* 2217 K */
+    {{ 36.2917034066, 38.2963394841, 20.7861493304, 609.324791521, 60.887931725, 53.2224966324 }}, /* 2218 K */
+    {{ 36.2930139077, 38.2986519678, 20.7861493296, 609.389254488, 60.8901834787, 53.2286498502 }}, /* 2219 K */
+    {{ 36.2943230846, 38.3009641167, 20.7861493288, 609.453651456, 60.8924329364, 53.2347982243 }}, /* 2220 K */
+    {{ 36.2956309393, 38.3032759306, 20.786149328, 609.517982488, 60.8946801016, 53.2409417585 }}, /* 2221 K */
+    {{ 36.2969374737, 38.3055874091, 20.7861493272, 609.582247649, 60.8969249776, 53.2470804565 }}, /* 2222 K */
+    {{ 36.2982426897, 38.307898552, 20.7861493264, 609.646447004, 60.8991675678, 53.2532143219 }}, /* 2223 K */
+    {{ 36.2995465893, 38.3102093587, 20.7861493256, 609.710580619, 60.9014078758, 53.2593433584 }}, /* 2224 K */
+    {{ 36.3008491745, 38.3125198292, 20.7861493248, 609.774648557, 60.9036459048, 53.2654675698 }}, /* 2225 K */
+    {{ 36.302150447, 38.3148299631, 20.786149324, 609.838650883, 60.9058816583, 53.2715869596 }}, /* 2226 K */
+    {{ 36.3034504089, 38.3171397599, 20.7861493232, 609.902587663, 60.9081151397, 53.2777015317 }}, /* 2227 K */
+    {{ 36.304749062, 38.3194492195, 20.7861493224, 609.966458959, 60.9103463523, 53.2838112896 }}, /* 2228 K */
+    {{ 36.3060464082, 38.3217583416, 20.7861493216, 610.030264837, 60.9125752995, 53.289916237 }}, /* 2229 K */
+    {{ 36.3073424495, 38.3240671257, 20.7861493208, 610.094005362, 60.9148019847, 53.2960163777 }}, /* 2230 K */
+    {{ 36.3086371878, 38.3263755716, 20.78614932, 610.157680596, 60.9170264113, 53.3021117153 }}, /* 2231 K */
+    {{ 36.309930625, 38.328683679, 20.7861493193, 610.221290606, 60.9192485827, 53.3082022535 }}, /* 2232 K */
+    {{ 36.3112227629, 38.3309914475, 20.7861493185, 610.284835454, 60.9214685021, 53.3142879959 }}, /* 2233 K */
+    {{ 36.3125136034, 38.3332988769, 20.7861493177, 610.348315205, 60.923686173, 53.3203689463 }}, /* 2234 K */
+    {{ 36.3138031485, 38.3356059669, 20.7861493169, 610.411729923, 60.9259015987, 53.3264451082 }}, /* 2235 K */
+    {{ 36.3150914001, 38.337912717, 20.7861493161, 610.475079672, 60.9281147826, 53.3325164855 }}, /* 2236 K */
+    {{ 36.31637836, 38.340219127, 20.7861493154, 610.538364515, 60.9303257279, 53.3385830817 }}, /* 2237 K */
+    {{ 36.31766403, 38.3425251966, 20.7861493146, 610.601584517, 60.9325344381, 53.3446449005 }}, /* 2238 K */
+    {{ 36.3189484122, 38.3448309255, 20.7861493138, 610.664739741, 60.9347409163, 53.3507019457 }}, /* 2239 K */
+    {{ 36.3202315083, 38.3471363134, 20.7861493131, 610.727830251, 60.9369451661, 53.3567542208 }}, /* 2240 K */
+    {{ 36.3215133203, 38.3494413598, 20.7861493123, 610.790856111, 60.9391471906, 53.3628017295 }}, /* 2241 K */
+    {{ 36.3227938499, 38.3517460646, 20.7861493116, 610.853817384, 60.9413469933, 53.3688444755 }}, /* 2242 K */
+    {{ 36.3240730991, 38.3540504275, 20.7861493108, 610.916714134, 60.9435445773, 53.3748824624 }}, /* 2243 K */
+    {{ 36.3253510698, 38.356354448, 20.7861493101, 610.979546424, 60.945739946, 53.380915694 }}, /* 2244 K */
+    {{ 36.3266277637, 38.3586581258, 20.7861493093, 611.042314317, 60.9479331027, 53.3869441738 }}, /* 2245 K */
+    {{ 36.3279031828, 38.3609614608, 20.7861493085, 611.105017877, 60.9501240507, 53.3929679055 }}, /* 2246 K */
+    {{ 36.3291773289, 38.3632644525, 20.7861493078, 611.167657168, 60.9523127933, 53.3989868929 }}, /* 2247 K */
+    {{ 36.3304502038, 38.3655671006, 20.7861493071, 611.230232251, 60.9544993337, 53.4050011395 }}, /* 2248 K */
+    {{ 36.3317218095, 38.3678694048, 20.7861493063, 611.29274319, 60.9566836752, 53.411010649 }}, /* 2249 K */
+    {{ 36.3329921477, 38.3701713648, 20.7861493056, 611.355190049, 60.9588658212, 53.417015425 }}, /* 2250 K */
+    {{ 36.3342612203, 38.3724729803, 20.7861493048, 611.41757289, 60.9610457748, 53.4230154713 }}, /* 2251 K */
+    {{ 36.3355290291, 38.374774251, 20.7861493041, 611.479891777, 60.9632235393, 53.4290107914 }}, /* 2252 K */
+    {{ 36.336795576, 38.3770751765, 20.7861493034, 611.542146771, 60.965399118, 53.435001389 }}, /* 2253 K */
+    {{ 36.3380608628, 38.3793757566, 20.7861493026, 611.604337936, 60.9675725141, 53.4409872678 }}, /* 2254 K */
+    {{ 36.3393248913, 38.3816759908, 20.7861493019, 611.666465335, 60.9697437308, 53.4469684314 }}, /* 2255 K */
+    {{ 36.3405876634, 38.383975879, 20.7861493012, 611.72852903, 60.9719127715, 53.4529448834 }}, /* 2256 K */
+    {{ 36.3418491808, 38.3862754208, 20.7861493005, 611.790529084, 60.9740796393, 53.4589166275 }}, /* 2257 K */
+    {{ 36.3431094455, 38.3885746158, 20.7861492997, 611.852465559, 60.9762443375, 53.4648836673 }}, /* 2258 K */
+    {{ 36.3443684592, 38.3908734638, 20.786149299, 611.914338517, 60.9784068693, 53.4708460066 }}, /* 2259 K */
+    {{ 36.3456262237, 38.3931719644, 20.7861492983, 611.976148022, 60.9805672379, 53.4768036488 }}, /* 2260 K */
+    {{ 36.3468827409, 38.3954701174, 20.7861492976, 612.037894135, 60.9827254465, 53.4827565977 }}, /* 2261 K */
+    {{ 36.3481380125, 38.3977679223, 20.7861492969, 612.099576919, 60.9848814983, 53.4887048569 }}, /* 2262 K */
+    {{ 36.3493920404, 38.4000653789, 20.7861492962, 612.161196436, 60.9870353966, 53.49464843 }}, /* 2263 K */
+    {{ 36.3506448264, 38.402362487, 20.7861492955, 612.222752748, 60.9891871445, 53.5005873206 }}, /* 2264 K */
+    {{ 36.3518963723, 38.404659246, 20.7861492948, 612.284245917, 60.9913367452, 53.5065215325 }}, /* 2265 K */
+    {{ 36.3531466798, 38.4069556559, 20.7861492941, 612.345676005, 60.9934842019, 53.5124510692 }}, /* 2266 K */
+    {{ 36.3543957507, 38.4092517161, 20.7861492934, 612.407043074, 60.9956295179, 53.5183759343 }}, /* 2267 K */
+    {{ 36.355643587, 38.4115474265, 20.7861492927, 612.468347187, 60.9977726962, 53.5242961316 }}, /* 2268 K */
+    {{ 36.3568901902, 38.4138427866, 20.786149292, 612.529588404, 60.99991374, 53.5302116645 }}, /* 2269 K */
+    {{ 36.3581355623, 38.4161377963, 20.7861492913, 612.590766787, 61.0020526526, 53.5361225368 }}, /* 2270 K */
+    {{ 36.3593797051, 38.418432455, 20.7861492906, 612.651882399, 61.0041894371, 53.542028752 }}, /* 2271 K */
+    {{ 36.3606226202, 38.4207267627, 20.7861492899, 612.7129353, 61.0063240966, 53.5479303139 }}, /* 2272 K */
+    {{ 36.3618643094, 38.4230207189, 20.7861492892, 612.773925553, 61.0084566343, 53.5538272259 }}, /* 2273 K */
+    {{ 36.3631047747, 38.4253143233, 20.7861492885, 612.834853219, 61.0105870533, 53.5597194918 }}, /* 2274 K */
+    {{ 36.3643440176, 38.4276075755, 20.7861492879, 612.895718359, 61.0127153568, 53.5656071151 }}, /* 2275 K */
+    {{ 36.36558204, 38.4299004754, 20.7861492872, 612.956521035, 61.014841548, 53.5714900995 }}, /* 2276 K */
+    {{ 36.3668188437, 38.4321930226, 20.7861492865, 613.017261308, 61.0169656299, 53.5773684486 }}, /* 2277 K */
+    {{ 36.3680544304, 38.4344852167, 20.7861492858, 613.077939239, 61.0190876056, 53.5832421659 }}, /* 2278 K */
+    {{ 36.3692888018, 38.4367770574, 20.7861492852, 613.13855489, 61.0212074785, 53.5891112552 }}, /* 2279 K */
+    {{ 36.3705219598, 38.4390685445, 20.7861492845, 613.199108321, 61.0233252514, 53.59497572 }}, /* 2280 K */
+    {{ 36.3717539061, 38.4413596775, 20.7861492838, 613.259599594, 61.0254409276, 53.6008355639 }}, /* 2281 K */
+    {{ 36.3729846424, 38.4436504563, 20.7861492832, 613.320028769, 61.0275545101, 53.6066907906 }}, /* 2282 K */
+    {{ 36.3742141705, 38.4459408804, 20.7861492825, 613.380395908, 61.0296660021, 53.6125414036 }}, /* 2283 K */
+    {{ 36.3754424921, 38.4482309496, 20.7861492819, 613.440701071, 61.0317754067, 53.6183874066 }}, /* 2284 K */
+    {{ 36.376669609, 38.4505206636, 20.7861492812, 613.50094432, 61.0338827269, 53.6242288031 }}, /* 2285 K */
+    {{ 36.3778955229, 38.452810022, 20.7861492806, 613.561125715, 61.0359879659, 53.6300655969 }}, /* 2286 K */
+    {{ 36.3791202356, 38.4550990245, 20.7861492799, 613.621245316, 61.0380911267, 53.6358977913 }}, /* 2287 K */
+    {{ 36.3803437487, 38.4573876707, 20.7861492793, 613.681303185, 61.0401922124, 53.6417253902 }}, /* 2288 K */
+    {{ 36.381566064, 38.4596759605, 20.7861492786, 613.741299381, 61.0422912261, 53.647548397 }}, /* 2289 K */
+    {{ 36.3827871833, 38.4619638935, 20.786149278, 613.801233966, 61.0443881709, 53.6533668153 }}, /* 2290 K */
+    {{ 36.3840071083, 38.4642514693, 20.7861492773, 613.861107, 61.0464830498, 53.6591806489 }}, /* 2291 K */
+    {{ 36.3852258406, 38.4665386877, 20.7861492767, 613.920918542, 61.0485758659, 53.6649899011 }}, /* 2292 K */
+    {{ 36.3864433821, 38.4688255482, 20.7861492761, 613.980668655, 61.0506666222, 53.6707945758 }}, /* 2293 K */
+    {{ 36.3876597344, 38.4711120507, 20.7861492754, 614.040357397, 61.0527553219, 53.6765946763 }}, /* 2294 K */
+    {{ 36.3888748992, 38.4733981948, 20.7861492748, 614.099984829, 61.0548419679, 53.6823902064 }}, /* 2295 K */
+    {{ 36.3900888783, 38.4756839802, 20.7861492742, 614.159551011, 61.0569265633, 53.6881811696 }}, /* 2296 K */
+    {{ 36.3913016734, 38.4779694066, 20.7861492736, 614.219056003, 61.0590091111, 53.6939675696 }}, /* 2297 K */
+    {{ 36.3925132861, 38.4802544736, 20.7861492729, 614.278499865, 61.0610896144, 53.6997494098 }}, /* 2298 K */
+    {{ 36.3937237182, 38.482539181, 20.7861492723, 614.337882658, 61.0631680762, 53.7055266939 }}, /* 2299 K */
+    {{ 36.3949329714, 38.4848235283, 20.7861492717, 614.39720444, 61.0652444995, 53.7112994254 }}, /* 2300 K */
+    {{ 36.3961410473, 38.4871075154, 20.7861492711, 614.456465273, 61.0673188874, 53.717067608 }}, /* 2301 K */
+    {{ 36.3973479477, 38.489391142, 20.7861492705, 614.515665214, 61.0693912428, 53.7228312452 }}, /* 2302 K */
+    {{ 36.3985536743, 38.4916744076, 20.7861492699, 614.574804325, 61.0714615688, 53.7285903406 }}, /* 2303 K */
+    {{ 36.3997582287, 38.4939573119, 20.7861492693, 614.633882665, 61.0735298683, 53.7343448978 }}, /* 2304 K */
+    {{ 36.4009616127, 38.4962398548, 20.7861492687, 614.692900294, 61.0755961444, 53.7400949204 }}, /* 2305 K */
+    {{ 36.4021638279, 38.4985220357, 20.7861492681, 614.75185727, 61.0776604001, 53.7458404119 }}, /* 2306 K */
+    {{ 36.4033648759, 38.5008038546, 20.7861492675, 614.810753654, 61.0797226384, 53.7515813758 }}, /* 2307 K */
+    {{ 36.4045647586, 38.5030853109, 20.7861492669, 614.869589505, 61.0817828622, 53.7573178159 }}, /* 2308 K */
+    {{ 36.4057634775, 38.5053664045, 20.7861492663, 614.928364882, 61.0838410746, 53.7630497356 }}, /* 2309 K */
+    {{ 36.4069610343, 38.5076471349, 20.7861492657, 614.987079844, 61.0858972784, 53.7687771385 }}, /* 2310 K */
+    {{ 36.4081574308, 38.509927502, 20.7861492651, 615.045734451, 61.0879514768, 53.7745000281 }}, /* 2311 K */
+    {{ 36.4093526685, 38.5122075053, 20.7861492645, 615.104328762, 61.0900036726, 53.7802184082 }}, /* 2312 K */
+    {{ 36.4105467491, 38.5144871446, 20.7861492639, 615.162862836, 61.0920538689, 53.7859322821 }}, /* 2313 K */
+    {{ 36.4117396743, 38.5167664195, 20.7861492633, 615.221336732, 61.0941020685, 53.7916416535 }}, /* 2314 K */
+    {{ 36.4129314458, 38.5190453298, 20.7861492628, 615.279750508, 61.0961482745, 53.7973465259 }}, /* 2315 K */
+    {{ 36.4141220652, 38.5213238751, 20.7861492622, 615.338104225, 61.0981924897, 53.8030469029 }}, /* 2316 K */
+    {{ 36.4153115341, 38.5236020551, 20.7861492616, 615.39639794, 61.1002347173, 53.8087427881 }}, /* 2317 K */
+    {{ 36.4164998543, 38.5258798695, 20.7861492611, 615.454631713, 61.10227496, 53.8144341849 }}, /* 2318 K */
+    {{ 36.4176870273, 38.528157318, 20.7861492605, 615.512805603, 61.1043132208, 53.820121097 }}, /* 2319 K */
+    {{ 36.4188730549, 38.5304344003, 20.7861492599, 615.570919667, 61.1063495026, 53.825803528 }}, /* 2320 K */
+    {{ 36.4200579386, 38.532711116, 20.7861492594, 615.628973964, 61.1083838085, 53.8314814813 }}, /* 2321 K */
+    {{ 36.42124168, 38.5349874649, 20.7861492588, 615.686968554, 61.1104161413, 53.8371549605 }}, /* 2322 K */
+    {{ 36.422424281, 38.5372634467, 20.7861492582, 615.744903495, 61.1124465039, 53.8428239691 }}, /* 2323 K */
+    {{ 36.4236057429, 38.539539061, 20.7861492577, 615.802778844, 61.1144748992, 53.8484885108 }}, /* 2324 K */
+    {{ 36.4247860676, 38.5418143075, 20.7861492571, 615.860594661, 61.1165013302, 53.854148589 }}, /* 2325 K */
+    {{ 36.4259652566, 38.544089186, 20.7861492566, 615.918351004, 61.1185257998, 53.8598042074 }}, /* 2326 K */
+    {{ 36.4271433116, 38.546363696, 20.7861492561, 615.976047931, 61.1205483109, 53.8654553694 }}, /* 2327 K */
+    {{ 36.4283202342, 38.5486378374, 20.7861492555, 616.0336855, 61.1225688663, 53.8711020785 }}, /* 2328 K */
+    {{ 36.4294960259, 38.5509116097, 20.786149255, 616.091263769, 61.124587469, 53.8767443384 }}, /* 2329 K */
+    {{ 36.4306706885, 38.5531850127, 20.7861492544, 616.148782797, 61.1266041218, 53.8823821526 }}, /* 2330 K */
+    {{ 36.4318442235, 38.5554580461, 20.7861492539, 616.206242641, 61.1286188277, 53.8880155245 }}, /* 2331 K */
+    {{ 36.4330166326, 38.5577307096, 20.7861492534, 616.26364336, 61.1306315895, 53.8936444578 }}, /* 2332 K */
+    {{ 36.4341879173, 38.5600030028, 20.7861492528, 616.320985011, 61.1326424101, 53.8992689559 }}, /* 2333 K */
+    {{ 36.4353580793, 38.5622749254, 20.7861492523, 616.378267652, 61.1346512924, 53.9048890225 }}, /* 2334 K */
+    {{ 36.4365271202, 38.5645464772, 20.7861492518, 616.435491342, 61.1366582392, 53.910504661 }}, /* 2335 K */
+    {{ 36.4376950416, 38.5668176578, 20.7861492513, 616.492656137, 61.1386632534, 53.9161158749 }}, /* 2336 K */
+    {{ 36.4388618451, 38.5690884669, 20.7861492507, 616.549762095, 61.1406663379, 53.9217226679 }}, /* 2337 K */
+    {{ 36.4400275322, 38.5713589042, 20.7861492502, 616.606809275, 61.1426674955, 53.9273250433 }}, /* 2338 K */
+    {{ 36.4411921046, 38.5736289694, 20.7861492497, 616.663797733, 61.1446667291, 53.9329230048 }}, /* 2339 K */
+    {{ 36.4423555639, 38.5758986623, 20.7861492492, 616.720727527, 61.1466640415, 53.9385165558 }}, /* 2340 K */
+    {{ 36.4435179117, 38.5781679824, 20.7861492487, 616.777598715, 61.1486594356, 53.9441057 }}, /* 2341 K */
+    {{ 36.4446791495, 38.5804369295, 20.7861492482, 616.834411353, 61.1506529141, 53.9496904407 }}, /* 2342 K */
+    {{ 36.445839279, 38.5827055032, 20.7861492477, 616.8911655, 61.15264448, 53.9552707816 }}, /* 2343 K */
+    {{ 36.4469983017, 38.5849737033, 20.7861492472, 616.947861213, 61.154634136, 53.9608467261 }}, /* 2344 K */
+    {{ 36.4481562192, 38.5872415295, 20.7861492467, 617.004498548, 61.1566218851, 53.9664182777 }}, /* 2345 K */
+    {{ 36.449313033, 38.5895089814, 20.7861492462, 617.061077563, 61.1586077299, 53.97198544 }}, /* 2346 K */
+    {{ 36.4504687448, 38.5917760588, 20.7861492457, 617.117598315, 61.1605916734, 53.9775482165 }}, /* 2347 K */
+    {{ 36.4516233562, 38.5940427614, 20.7861492452, 617.174060861, 61.1625737183, 53.9831066107 }}, /* 2348 K */
+    {{ 36.4527768686, 38.5963090887, 20.7861492447, 617.230465258, 61.1645538675, 53.9886606261 }}, /* 2349 K */
+    {{ 36.4539292837, 38.5985750406, 20.7861492442, 617.286811563, 61.1665321237, 53.9942102662 }}, /* 2350 K */
+    {{ 36.4550806031, 38.6008406167, 20.7861492438, 617.343099833, 61.1685084898, 53.9997555345 }}, /* 2351 K */
+    {{ 36.4562308282, 38.6031058167, 20.7861492433, 617.399330124, 61.1704829686, 54.0052964346 }}, /* 2352 K */
+    {{ 36.4573799607, 38.6053706404, 20.7861492428, 617.455502494, 61.1724555628, 54.0108329698 }}, /* 2353 K */
+    {{ 36.4585280021, 38.6076350873, 20.7861492423, 617.511616998, 61.1744262752, 54.0163651438 }}, /* 2354 K */
+    {{ 36.4596749539, 38.6098991573, 20.7861492419, 617.567673695, 61.1763951086, 54.02189296 }}, /* 2355 K */
+    {{ 36.4608208178, 38.6121628499, 20.7861492414, 617.62367264, 61.1783620659, 54.0274164219 }}, /* 2356 K */
+    {{ 36.4619655953, 38.614426165, 20.7861492409, 617.679613889, 61.1803271497, 54.0329355331 }}, /* 2357 K */
+    {{ 36.4631092878, 38.6166891021, 20.7861492405, 617.7354975, 61.1822903628, 54.0384502969 }}, /* 2358 K */
+    {{ 36.464251897, 38.618951661, 20.78614924, 617.791323528, 61.1842517081, 54.043960717 }}, /* 2359 K */
+    {{ 36.4653934245, 38.6212138414, 20.7861492396, 617.84709203, 61.1862111883, 54.0494667967 }}, /* 2360 K */
+    {{ 36.4665338716, 38.623475643, 20.7861492391, 617.902803063, 61.1881688061, 54.0549685397 }}, /* 2361 K */
+    {{ 36.4676732401, 38.6257370655, 20.7861492387, 617.958456682, 61.1901245643, 54.0604659493 }}, /* 2362 K */
+    {{ 36.4688115313, 38.6279981086, 20.7861492382, 618.014052944, 61.1920784656, 54.0659590291 }}, /* 2363 K */
+    {{ 36.4699487469, 38.6302587719, 20.7861492378, 618.069591905, 61.1940305128, 54.0714477826 }}, /* 2364 K */
+    {{ 36.4710848884, 38.6325190552, 20.7861492373, 618.125073621, 61.1959807087, 54.0769322132 }}, /* 2365 K */
+    {{ 36.4722199573, 38.6347789582, 20.7861492369, 618.180498147, 61.1979290559, 54.0824123244 }}, /* 2366 K */
+    {{ 36.4733539551, 38.6370384805, 20.7861492364, 618.235865541, 61.1998755573, 54.0878881197 }}, /* 2367 K */
+    {{ 36.4744868834, 38.6392976219, 20.786149236, 618.291175857, 61.2018202155, 54.0933596025 }}, /* 2368 K */
+    {{ 36.4756187437, 38.6415563821, 20.7861492356, 618.346429152, 61.2037630332, 54.0988267765 }}, /* 2369 K */
+    {{ 36.4767495374, 38.6438147607, 20.7861492351, 618.401625481, 61.2057040133, 54.104289645 }}, /* 2370 K */
+    {{ 36.4778792661, 38.6460727575, 20.7861492347, 618.456764901, 61.2076431584, 54.1097482115 }}, /* 2371 K */
+    {{ 36.4790079314, 38.6483303722, 20.7861492343, 618.511847466, 61.2095804712, 54.1152024794 }}, /* 2372 K */
+    {{ 36.4801355347, 38.6505876044, 20.7861492339, 618.566873233, 61.2115159544, 54.1206524523 }}, /* 2373 K */
+    {{ 36.4812620775, 38.6528444539, 20.7861492335, 618.621842257, 61.2134496108, 54.1260981337 }}, /* 2374 K */
+    {{ 36.4823875614, 38.6551009203, 20.786149233, 618.676754594, 61.215381443, 54.1315395269 }}, /* 2375 K */
+    {{ 36.4835119878, 38.6573570035, 20.7861492326, 618.731610298, 61.2173114538, 54.1369766355 }}, /* 2376 K */
+    {{ 36.4846353582, 38.6596127029, 20.7861492322, 618.786409426, 61.2192396458, 54.142409463 }}, /* 2377 K */
+    {{ 36.4857576742, 38.6618680185, 20.7861492318, 618.841152033, 61.2211660218, 54.1478380127 }}, /* 2378 K */
+    {{ 36.4868789373, 38.6641229498, 20.7861492314, 618.895838173, 61.2230905844, 54.1532622881 }}, /* 2379 K */
+    {{ 36.4879991488, 38.6663774966, 20.786149231, 618.950467903, 61.2250133363, 54.1586822928 }}, /* 2380 K */
+    {{ 36.4891183104, 38.6686316586, 20.7861492306, 619.005041278, 61.2269342802, 54.1640980302 }}, /* 2381 K */
+    {{ 36.4902364235, 38.6708854354, 20.7861492302, 619.059558352, 61.2288534188, 54.1695095037 }}, /* 2382 K */
+    {{ 36.4913534896, 38.6731388268, 20.7861492298, 619.11401918, 61.2307707547, 54.1749167167 }}, /* 2383 K */
+    {{ 36.4924695102, 38.6753918325, 20.7861492294, 619.168423818, 61.2326862906, 54.1803196728 }}, /* 2384 K */
+    {{ 36.4935844868, 38.6776444522, 20.786149229, 619.222772321, 61.2346000291, 54.1857183754 }}, /* 2385 K */
+    {{ 36.4946984207, 38.6798966855, 20.7861492287, 619.277064743, 61.236511973, 54.191112828 }}, /* 2386 K */
+    {{ 36.4958113136, 38.6821485323, 20.7861492283, 619.33130114, 61.2384221249, 54.1965030339 }}, /* 2387 K */
+    {{ 36.4969231669, 38.6843999921, 20.7861492279, 619.385481566, 61.2403304874, 54.2018889967 }}, /* 2388 K */
+    {{ 36.4980339821, 38.6866510648, 20.7861492275, 619.439606076, 61.2422370633, 54.2072707197 }}, /* 2389 K */
+    {{ 36.4991437606, 38.6889017499, 20.7861492271, 619.493674724, 61.244141855, 54.2126482065 }}, /* 2390 K */
+    {{ 36.5002525039, 38.6911520472, 20.7861492268, 619.547687565, 61.2460448653, 54.2180214605 }}, /* 2391 K */
+    {{ 36.5013602134, 38.6934019565, 20.7861492264, 619.601644655, 61.2479460969, 54.2233904851 }}, /* 2392 K */
+    {{ 36.5024668907, 38.6956514774, 20.786149226, 619.655546046, 61.2498455523, 54.2287552837 }}, /* 2393 K */
+    {{ 36.5035725371, 38.6979006096, 20.7861492257, 619.709391795, 61.2517432341, 54.2341158598 }}, /* 2394 K */
+    {{ 36.5046771542, 38.7001493528, 20.7861492253, 619.763181954, 61.2536391451, 54.2394722169 }}, /* 2395 K */
+    {{ 36.5057807434, 38.7023977067, 20.786149225, 619.816916579, 61.2555332878, 54.2448243583 }}, /* 2396 K */
+    {{ 36.5068833062, 38.7046456711, 20.7861492246, 619.870595724, 61.2574256649, 54.2501722875 }}, /* 2397 K */
+    {{ 36.5079848439, 38.7068932457, 20.7861492242, 619.924219443, 61.2593162789, 54.255516008 }}, /* 2398 K */
+    {{ 36.5090853581, 38.7091404301, 20.7861492239, 619.97778779, 61.2612051324, 54.2608555231 }}, /* 2399 K */
+    {{ 36.5101848502, 38.711387224, 20.7861492236, 620.03130082, 61.2630922282, 54.2661908363 }}, /* 2400 K */
+    {{ 36.5112833216, 38.7136336272, 20.7861492232, 620.084758586, 61.2649775687, 54.2715219511 }}, /* 2401 K */
+    {{ 36.5123807739, 38.7158796394, 20.7861492229, 620.138161142, 61.2668611566, 54.2768488708 }}, /* 2402 K */
+    {{ 36.5134772083, 38.7181252603, 20.7861492225, 620.191508544, 61.2687429945, 54.2821715988 }}, /* 2403 K */
+    {{ 36.5145726264, 38.7203704896, 20.7861492222, 620.244800843, 61.2706230849, 54.2874901386 }}, /* 2404 K */
+    {{ 36.5156670295, 38.7226153269, 20.7861492219, 620.298038095, 61.2725014305, 54.2928044937 }}, /* 2405 K */
+    {{ 36.5167604192, 38.7248597721, 20.7861492215, 620.351220353, 61.2743780339, 54.2981146674 }}, /* 2406 K */
+    {{ 36.5178527969, 38.7271038248, 20.7861492212, 620.404347671, 61.2762528976, 54.3034206631 }}, /* 2407 K */
+    {{ 36.5189441639, 38.7293474847, 20.7861492209, 620.457420103, 61.2781260242, 54.3087224843 }}, /* 2408 K */
+    {{ 36.5200345217, 38.7315907516, 20.7861492206, 620.510437702, 61.2799974162, 54.3140201344 }}, /* 2409 K */
+    {{ 36.5211238717, 38.7338336251, 20.7861492202, 620.563400521, 61.2818670763, 54.3193136167 }}, /* 2410 K */
+    {{ 36.5222122154, 38.736076105, 20.7861492199, 620.616308616, 61.283735007, 54.3246029348 }}, /* 2411 K */
+    {{ 36.5232995542, 38.7383181909, 20.7861492196, 620.669162038, 61.2856012109, 54.329888092 }}, /* 2412 K */
+    {{ 36.5243858894, 38.7405598827, 20.7861492193, 620.721960841, 61.2874656905, 54.3351690916 }}, /* 2413 K */
+    {{ 36.5254712225, 38.7428011799, 20.786149219, 620.774705079, 61.2893284484, 54.3404459373 }}, /* 2414 K */
+    {{ 36.5265555549, 38.7450420823, 20.7861492187, 620.827394806, 61.2911894872, 54.3457186322 }}, /* 2415 K */
+    {{ 36.5276388881, 38.7472825897, 20.7861492184, 620.880030073, 61.2930488093, 54.3509871799 }}, /* 2416 K */
+    {{ 36.5287212233, 38.7495227016, 20.7861492181, 620.932610936, 61.2949064174, 54.3562515837 }}, /* 2417 K */
+    {{ 36.5298025621, 38.7517624179, 20.7861492178, 620.985137446, 61.2967623139, 54.3615118471 }}, /* 2418 K */
+    {{ 36.5308829058, 38.7540017383, 20.7861492175, 621.037609657, 61.2986165015, 54.3667679733 }}, /* 2419 K */
+    {{ 36.5319622558, 38.7562406624, 20.7861492172, 621.090027622, 61.3004689826, 54.3720199659 }}, /* 2420 K */
+    {{ 36.5330406135, 38.75847919, 20.7861492169, 621.142391394, 61.3023197598, 54.3772678283 }}, /* 2421 K */
+    {{ 36.5341179804, 38.7607173209, 20.7861492166, 621.194701027, 61.3041688356, 54.3825115637 }}, /* 2422 K */
+    {{ 36.5351943578, 38.7629550546, 20.7861492163, 621.246956572, 61.3060162125, 54.3877511757 }}, /* 2423 K */
+    {{ 36.536269747, 38.7651923909, 20.7861492161, 621.299158083, 61.3078618931, 54.3929866675 }}, /* 2424 K */
+    {{ 36.5373441496, 38.7674293296, 20.7861492158, 621.351305612, 61.3097058798, 54.3982180427 }}, /* 2425 K */
+    {{ 36.5384175668, 38.7696658703, 20.7861492155, 621.403399213, 61.3115481752, 54.4034453045 }}, /* 2426 K */
+    {{ 36.5394900001, 38.7719020128, 20.7861492152, 621.455438938, 61.3133887818, 54.4086684564 }}, /* 2427 K */
+    {{ 36.5405614509, 38.7741377568, 20.786149215, 621.50742484, 61.315227702, 54.4138875017 }}, /* 2428 K */
+    {{ 36.5416319204, 38.776373102, 20.7861492147, 621.559356971, 61.3170649385, 54.4191024438 }}, /* 2429 K */
+    {{ 36.5427014102, 38.7786080482, 20.7861492144, 621.611235383, 61.3189004936, 54.4243132862 }}, /* 2430 K */
+    {{ 36.5437699215, 38.7808425949, 20.7861492142, 621.663060131, 61.32073437, 54.4295200321 }}, /* 2431 K */
+    {{ 36.5448374558, 38.783076742, 20.7861492139, 621.714831265, 61.32256657, 54.434722685 }}, /* 2432 K */
+    {{ 36.5459040144, 38.7853104892, 20.7861492137, 621.766548838, 61.3243970961, 54.4399212483 }}, /* 2433 K */
+    {{ 36.5469695986, 38.7875438361, 20.7861492134, 621.818212903, 61.3262259509, 54.4451157252 }}, /* 2434 K */
+    {{ 36.54803421, 38.7897767826, 20.7861492132, 621.869823512, 61.3280531369, 54.4503061192 }}, /* 2435 K */
+    {{ 36.5490978497, 38.7920093283, 20.7861492129, 621.921380717, 61.3298786564, 54.4554924337 }}, /* 2436 K */
+    {{ 36.5501605192, 38.7942414729, 20.7861492127, 621.97288457, 61.331702512, 54.460674672 }}, /* 2437 K */
+    {{ 36.5512222199, 38.7964732162, 20.7861492124, 622.024335124, 61.3335247062, 54.4658528375 }}, /* 2438 K */
+    {{ 36.5522829531, 38.7987045579, 20.7861492122, 622.07573243, 61.3353452414, 54.4710269335 }}, /* 2439 K */
+    {{ 36.5533427201, 38.8009354977, 20.786149212, 622.127076541, 61.3371641201, 54.4761969634 }}, /* 2440 K */
+    {{ 36.5544015223, 38.8031660353, 20.7861492117, 622.178367509, 61.3389813447, 54.4813629307 }}, /* 2441 K */
+    {{ 36.5554593611, 38.8053961704, 20.7861492115, 622.229605385, 61.3407969177, 54.4865248385 }}, /* 2442 K */
+    {{ 36.5565162378, 38.8076259029, 20.7861492113, 622.280790221, 61.3426108415, 54.4916826904 }}, /* 2443 K */
+    {{ 36.5575721537, 38.8098552323, 20.786149211, 622.331922069, 61.3444231186, 54.4968364896 }}, /* 2444 K */
+    {{ 36.5586271102, 38.8120841584, 20.7861492108, 622.383000982, 61.3462337515, 54.5019862396 }}, /* 2445 K */
+    {{ 36.5596811087, 38.8143126809, 20.7861492106, 622.43402701, 61.3480427426, 54.5071319436 }}, /* 2446 K */
+    {{ 36.5607341504, 38.8165407996, 20.7861492104, 622.485000206, 61.3498500943, 54.512273605 }}, /* 2447 K */
+    {{ 36.5617862368, 38.8187685141, 20.7861492102, 622.53592062, 61.3516558091, 54.5174112272 }}, /* 2448 K */
+    {{ 36.5628373691, 38.8209958243, 20.78614921, 622.586788306, 61.3534598893, 54.5225448135 }}, /* 2449 K */
+    {{ 36.5638875487, 38.8232227298, 20.7861492098, 622.637603313, 61.3552623375, 54.5276743673 }}, /* 2450 K */
+    {{ 36.5649367769, 38.8254492303, 20.7861492096, 622.688365694, 61.357063156, 54.5327998919 }}, /* 2451 K */
+    {{ 36.5659850551, 38.8276753256, 20.7861492094, 622.7390755, 61.3588623473, 54.5379213907 }}, /* 2452 K */
+    {{ 36.5670323845, 38.8299010154, 20.7861492092, 622.789732783, 61.3606599138, 54.5430388669 }}, /* 2453 K */
+    {{ 36.5680787666, 38.8321262993, 20.786149209, 622.840337593, 61.3624558579, 54.548152324 }}, /* 2454 K */
+    {{ 36.5691242026, 38.8343511773, 20.7861492088, 622.890889982, 61.364250182, 54.5532617653 }}, /* 2455 K */
+    {{ 36.5701686938, 38.8365756489, 20.7861492086, 622.941390001, 61.3660428885, 54.5583671941 }}, /* 2456 K */
+    {{ 36.5712122415, 38.8387997139, 20.7861492084, 622.991837702, 61.3678339799, 54.5634686138 }}, /* 2457 K */
+    {{ 36.5722548472, 38.841023372, 20.7861492082, 623.042233136, 61.3696234585, 54.5685660276 }}, /* 2458 K */
+    {{ 36.5732965121, 38.843246623, 20.786149208, 623.092576352, 61.3714113268, 54.573659439 }}, /* 2459 K */
+    {{ 36.5743372374, 38.8454694665, 20.7861492078, 623.142867404, 61.373197587, 54.5787488512 }}, /* 2460 K */
+    {{ 36.5753770246, 38.8476919023, 20.7861492077, 623.193106341, 61.3749822417, 54.5838342676 }}, /* 2461 K */
+    {{ 36.5764158749, 38.8499139302, 20.7861492075, 623.243293215, 61.3767652933, 54.5889156915 }}, /* 2462 K */
+    {{ 36.5774537896, 38.8521355498, 20.7861492073, 623.293428076, 61.378546744, 54.5939931262 }}, /* 2463 K */
+    {{ 36.5784907701, 38.8543567609, 20.7861492071, 623.343510975, 61.3803265963, 54.5990665751 }}, /* 2464 K */
+    {{ 36.5795268176, 38.8565775632, 20.786149207, 623.393541964, 61.3821048525, 54.6041360415 }}, /* 2465 K */
+    {{ 36.5805619335, 38.8587979564, 20.7861492068, 623.443521092, 61.3838815151, 54.6092015287 }}, /* 2466 K */
+    {{ 36.581596119, 38.8610179404, 20.7861492066, 623.49344841, 61.3856565864, 54.61426304 }}, /* 2467 K */
+    {{ 36.5826293754, 38.8632375147, 20.7861492065, 623.54332397, 61.3874300688, 54.6193205788 }}, /* 2468 K */
+    {{ 36.5836617041, 38.8654566791, 20.7861492063, 623.593147821, 61.3892019646, 54.6243741483 }}, /* 2469 K */
+    {{ 36.5846931063, 38.8676754334, 20.7861492062, 623.642920014, 61.3909722762, 54.6294237519 }}, /* 2470 K */
+    {{ 36.5857235832, 38.8698937773, 20.786149206, 623.692640599, 61.392741006, 54.6344693928 }}, /* 2471 K */
+    {{ 36.5867531363, 38.8721117106, 20.7861492059, 623.742309628, 61.3945081563, 54.6395110745 }}, /* 2472 K */
+    {{ 36.5877817668, 38.8743292328, 20.7861492057, 623.79192715, 61.3962737295, 54.6445488002 }}, /* 2473 K */
+    {{ 36.5888094759, 38.8765463439, 20.7861492056, 623.841493216, 61.3980377279, 54.6495825732 }}, /* 2474 K */
+    {{ 36.589836265, 38.8787630435, 20.7861492055, 623.891007876, 61.3998001539, 54.6546123968 }}, /* 2475 K */
+    {{ 36.5908621353, 38.8809793313, 20.7861492053, 623.94047118, 61.4015610098, 54.6596382744 }}, /* 2476 K */
+    {{ 36.5918870881, 38.8831952071, 20.7861492052, 623.989883178, 61.403320298, 54.6646602091 }}, /* 2477 K */
+    {{ 36.5929111246, 38.8854106707, 20.7861492051, 624.039243921, 61.4050780207, 54.6696782044 }}, /* 2478 K */
+    {{ 36.5939342463, 38.8876257216, 20.7861492049, 624.088553459, 61.4068341804, 54.6746922636 }}, /* 2479 K */
+    {{ 36.5949564542, 38.8898403598, 20.7861492048, 624.137811841, 61.4085887793, 54.6797023898 }}, /* 2480 K */
+    {{ 36.5959777498, 38.8920545849, 20.7861492047, 624.187019118, 61.4103418199, 54.6847085865 }}, /* 2481 K */
+    {{ 36.5969981342, 38.8942683966, 20.7861492046, 624.236175339, 61.4120933043, 54.6897108569 }}, /* 2482 K */
+    {{ 36.5980176087, 38.8964817948, 20.7861492044, 624.285280555, 61.413843235, 54.6947092043 }}, /* 2483 K */
+    {{ 36.5990361746, 38.898694779, 20.7861492043, 624.334334816, 61.4155916142, 54.6997036321 }}, /* 2484 K */
+    {{ 36.6000538332, 38.9009073491, 20.7861492042, 624.38333817, 61.4173384443, 54.7046941434 }}, /* 2485 K */
+    {{ 36.6010705857, 38.9031195048, 20.7861492041, 624.432290668, 61.4190837276, 54.7096807416 }}, /* 2486 K */
+    {{ 36.6020864333, 38.9053312459, 20.786149204, 624.48119236, 61.4208274663, 54.71466343 }}, /* 2487 K */
+    {{ 36.6031013774, 38.907542572, 20.7861492039, 624.530043295, 61.4225696629, 54.7196422118 }}, /* 2488 K */
+    {{ 36.6041154191, 38.9097534829, 20.7861492038, 624.578843522, 61.4243103195, 54.7246170904 }}, /* 2489 K */
+    {{ 36.6051285597, 38.9119639784, 20.7861492037, 624.627593092, 61.4260494385, 54.7295880689 }}, /* 2490 K */
+    {{ 36.6061408006, 38.9141740582, 20.7861492036, 624.676292054, 61.4277870223, 54.7345551508 }}, /* 2491 K */
+    {{ 36.6071521428, 38.916383722, 20.7861492035, 624.724940457, 61.429523073, 54.7395183393 }}, /* 2492 K */
+    {{ 36.6081625877, 38.9185929695, 20.7861492034, 624.77353835, 61.4312575929, 54.7444776376 }}, /* 2493 K */
+    {{ 36.6091721365, 38.9208018005, 20.7861492033, 624.822085784, 61.4329905845, 54.749433049 }}, /* 2494 K */
+    {{ 36.6101807905, 38.9230102148, 20.7861492033, 624.870582807, 61.4347220499, 54.7543845769 }}, /* 2495 K */
+    {{ 36.6111885508, 38.9252182121, 20.7861492032, 624.919029469, 61.4364519914, 54.7593322244 }}, /* 2496 K */
+    {{ 36.6121954188, 38.9274257921, 20.7861492031, 624.967425818, 61.4381804113, 54.7642759949 }}, /* 2497 K */
+    {{ 36.6132013957, 38.9296329546, 20.786149203, 625.015771904, 61.4399073119, 54.7692158915 }}, /* 2498 K */
+    {{ 36.6142064826, 38.9318396992, 20.7861492029, 625.064067777, 61.4416326954, 54.7741519177 }}, /* 2499 K */
+    {{ 36.6152106808, 38.9340460258, 20.7861492029, 625.112313484, 61.4433565641, 54.7790840766 }}, /* 2500 K */
+    {{ 36.6162139917, 38.9362519341, 20.7861492028, 625.160509076, 61.4450789204, 54.7840123715 }}, /* 2501 K */
+    {{ 36.6172164162, 38.9384574239, 20.7861492027, 625.208654601, 61.4467997663, 54.7889368056 }}, /* 2502 K */
+    {{ 36.6182179558, 38.9406624948, 20.7861492027, 625.256750108, 61.4485191043, 54.7938573823 }}, /* 2503 K */
+    {{ 36.6192186117, 38.9428671466, 20.7861492026, 625.304795646, 61.4502369366, 54.7987741048 }}, /* 2504 K */
+    {{ 36.6202183849, 38.9450713791, 20.7861492026, 625.352791264, 61.4519532653, 54.8036869763 }}, /* 2505 K */
+    {{ 36.6212172769, 38.9472751919, 20.7861492025, 625.40073701, 61.4536680928, 54.8085960001 }}, /* 2506 K */
+    {{ 36.6222152887, 38.949478585, 20.7861492025, 625.448632933, 61.4553814214, 54.8135011795 }}, /* 2507 K */
+    {{ 36.6232124217, 38.9516815579, 20.7861492024, 625.496479083, 61.4570932531, 54.8184025177 }}, /* 2508 K */
+    {{ 36.6242086769, 38.9538841105, 20.7861492024, 625.544275507, 61.4588035904, 54.8233000179 }}, /* 2509 K */
+    {{ 36.6252040557, 38.9560862424, 20.7861492023, 625.592022254, 61.4605124354, 54.8281936834 }}, /* 2510 K */
+    {{ 36.6261985592, 38.9582879535, 20.7861492023, 625.639719374, 61.4622197904, 54.8330835175 }}, /* 2511 K */
+    {{ 36.6271921887, 38.9604892435, 20.7861492022, 625.687366913, 61.4639256576, 54.8379695233 }}, /* 2512 K */
+    {{ 36.6281849453, 38.962690112, 20.7861492022, 625.734964921, 61.4656300392, 54.8428517042 }}, /* 2513 K */
+    {{ 36.6291768303, 38.964890559, 20.7861492022, 625.782513446, 61.4673329375, 54.8477300634 }}, /* 2514 K */
+    {{ 36.6301678449, 38.9670905841, 20.7861492021, 625.830012537, 61.4690343546, 54.8526046041 }}, /* 2515 K */
+    {{ 36.6311579902, 38.969290187, 20.7861492021, 625.877462241, 61.4707342929, 54.8574753296 }}, /* 2516 K */
+    {{ 36.6321472674, 38.9714893676, 20.7861492021, 625.924862608, 61.4724327544, 54.862342243 }}, /* 2517 K */
+    {{ 36.6331356778, 38.9736881255, 20.7861492021, 625.972213685, 61.4741297415, 54.8672053477 }}, /* 2518 K */
+    {{ 36.6341232226, 38.9758864605, 20.7861492021, 626.01951552, 61.4758252564, 54.8720646468 }}, /* 2519 K */
+    {{ 36.6351099029, 38.9780843724, 20.786149202, 626.066768162, 61.4775193012, 54.8769201436 }}, /* 2520 K */
+    {{ 36.6360957199, 38.9802818609, 20.786149202, 626.113971659, 61.4792118782, 54.8817718414 }}, /* 2521 K */
+    {{ 36.6370806749, 38.9824789258, 20.786149202, 626.161126058, 61.4809029895, 54.8866197433 }}, /* 2522 K */
+    {{ 36.6380647689, 38.9846755668, 20.786149202, 626.208231408, 61.4825926374, 54.8914638525 }}, /* 2523 K */
+    {{ 36.6390480033, 38.9868717836, 20.786149202, 626.255287756, 61.484280824, 54.8963041724 }}, /* 2524 K */
+    {{ 36.6400303791, 38.9890675761, 20.786149202, 626.302295151, 61.4859675516, 54.9011407061 }}, /* 2525 K */
+    {{ 36.6410118976, 38.9912629439, 20.786149202, 626.349253641, 61.4876528223, 54.9059734568 }}, /* 2526 K */
+    {{ 36.6419925599, 38.9934578868, 20.786149202, 626.396163272, 61.4893366384, 54.9108024279 }}, /* 2527 K */
+    {{ 36.6429723672, 38.9956524047, 20.786149202, 626.443024094, 61.491019002, 54.9156276223 }}, /* 2528 K */
+    {{ 36.6439513207, 38.9978464971, 20.786149202, 626.489836153, 61.4926999153, 54.9204490435 }}, /* 2529 K */
+    {{ 36.6449294216, 39.0000401639, 20.786149202, 626.536599497, 61.4943793804, 54.9252666947 }}, /* 2530 K */
+    {{ 36.645906671, 39.0022334049, 20.786149202, 626.583314174, 61.4960573997, 54.9300805789 }}, /* 2531 K */
+    {{ 36.6468830701, 39.0044262197, 20.7861492021, 626.629980232, 61.4977339751, 54.9348906995 }}, /* 2532 K */
+    {{ 36.6478586201, 39.0066186082, 20.7861492021, 626.676597718, 61.499409109, 54.9396970596 }}, /* 2533 K */
+    {{ 36.6488333222, 39.0088105701, 20.7861492021, 626.723166679, 61.5010828034, 54.9444996625 }}, /* 2534 K */
+    {{ 36.6498071774, 39.0110021052, 20.7861492021, 626.769687163, 61.5027550605, 54.9492985114 }}, /* 2535 K */
+    {{ 36.650780187, 39.0131932131, 20.7861492021, 626.816159218, 61.5044258826, 54.9540936094 }}, /* 2536 K */
+    {{ 36.6517523521, 39.0153838937, 20.7861492022, 626.86258289, 61.5060952717, 54.9588849598 }}, /* 2537 K */
+    {{ 36.6527236739, 39.0175741468, 20.7861492022, 626.908958227, 61.50776323, 54.9636725658 }}, /* 2538 K */
+    {{ 36.6536941536, 39.019763972, 20.7861492022, 626.955285276, 61.5094297597, 54.9684564306 }}, /* 2539 K */
+    {{ 36.6546637922, 39.0219533691, 20.7861492023, 627.001564085, 61.5110948629, 54.9732365573 }}, /* 2540 K */
+    {{ 36.655632591, 39.024142338, 20.7861492023, 627.0477947, 61.5127585418, 54.9780129492 }}, /* 2541 K */
+    {{ 36.6566005511, 39.0263308783, 20.7861492024, 627.093977169, 61.5144207985, 54.9827856095 }}, /* 2542 K */
+    {{ 36.6575676737, 39.0285189898, 20.7861492024, 627.140111539, 61.5160816351, 54.9875545413 }}, /* 2543 K */
+    {{ 36.6585339599, 39.0307066723, 20.7861492024, 627.186197856, 61.5177410538, 54.9923197479 }}, /* 2544 K */
+    {{ 36.6594994108, 39.0328939255, 20.7861492025, 627.232236168, 61.5193990568, 54.9970812324 }}, /* 2545 K */
+    {{ 36.6604640276, 39.0350807492, 20.7861492025, 627.278226522, 61.5210556461, 55.001838998 }}, /* 2546 K */
+    {{ 36.6614278114, 39.0372671431, 20.7861492026, 627.324168965, 61.5227108239, 55.006593048 }}, /* 2547 K */
+    {{ 36.6623907634, 39.0394531071, 20.7861492027, 627.370063542, 61.5243645924, 55.0113433855 }}, /* 2548 K */
+    {{ 36.6633528847, 39.0416386409, 20.7861492027, 627.415910302, 61.5260169536, 55.0160900136 }}, /* 2549 K */
+    {{ 36.6643141765, 39.0438237441, 20.7861492028, 627.461709292, 61.5276679096, 55.0208329356 }}, /* 2550 K */
+    {{ 36.6652746399, 39.0460084167, 20.7861492029, 627.507460556, 61.5293174627, 55.0255721547 }}, /* 2551 K */
+    {{ 36.6662342759, 39.0481926583, 20.7861492029, 627.553164143, 61.5309656149, 55.030307674 }}, /* 2552 K */
+    {{ 36.6671930858, 39.0503764688, 20.786149203, 627.598820099, 61.5326123683, 55.0350394966 }}, /* 2553 K */
+    {{ 36.6681510708, 39.0525598478, 20.7861492031, 627.644428471, 61.5342577251, 55.0397676259 }}, /* 2554 K */
+    {{ 36.6691082318, 39.0547427952, 20.7861492031, 627.689989305, 61.5359016873, 55.0444920649 }}, /* 2555 K */
+    {{ 36.67006457, 39.0569253107, 20.7861492032, 627.735502647, 61.537544257, 55.0492128168 }}, /* 2556 K */
+    {{ 36.6710200866, 39.0591073941, 20.7861492033, 627.780968544, 61.5391854364, 55.0539298848 }}, /* 2557 K */
+    {{ 36.6719747827, 39.0612890451, 20.7861492034, 627.826387043, 61.5408252276, 55.0586432721 }}, /* 2558 K */
+    {{ 36.6729286594, 39.0634702635, 20.7861492035, 627.871758189, 61.5424636326, 55.0633529818 }}, /* 2559 K */
+    {{ 36.6738817178, 39.0656510491, 20.7861492036, 627.91708203, 61.5441006536, 55.0680590171 }}, /* 2560 K */
+    {{ 36.6748339591, 39.0678314017, 20.7861492037, 627.962358611, 61.5457362927, 55.0727613811 }}, /* 2561 K */
+    {{ 36.6757853843, 39.0700113209, 20.7861492037, 628.007587978, 61.5473705519, 55.077460077 }}, /* 2562 K */
+    {{ 36.6767359946, 39.0721908066, 20.7861492038, 628.052770178, 61.5490034333, 55.082155108 }}, /* 2563 K */
+    {{ 36.677685791, 39.0743698586, 20.7861492039, 628.097905257, 61.550634939, 55.0868464773 }}, /* 2564 K */
+    {{ 36.6786347748, 39.0765484766, 20.786149204, 628.142993261, 61.5522650711, 55.0915341879 }}, /* 2565 K */
+    {{ 36.6795829469, 39.0787266603, 20.7861492042, 628.188034236, 61.5538938317, 55.0962182431 }}, /* 2566 K */
+    {{ 36.6805303086, 39.0809044096, 20.7861492043, 628.233028228, 61.5555212228, 55.1008986459 }}, /* 2567 K */
+    {{ 36.6814768608, 39.0830817242, 20.7861492044, 628.277975283, 61.5571472466, 55.1055753997 }}, /* 2568 K */
+    {{ 36.6824226048, 39.0852586039, 20.7861492045, 628.322875446, 61.558771905, 55.1102485074 }}, /* 2569 K */
+    {{ 36.6833675416, 39.0874350484, 20.7861492046, 628.367728765, 61.5603952003, 55.1149179722 }}, /* 2570 K */
+    {{ 36.6843116723, 39.0896110576, 20.7861492047, 628.412535284, 61.5620171343, 55.1195837974 }}, /* 2571 K */
+    {{ 36.6852549981, 39.0917866311, 20.7861492048, 628.457295049, 61.5636377093, 55.1242459859 }}, /* 2572 K */
+    {{ 36.6861975199, 39.0939617689, 20.786149205, 628.502008106, 61.5652569272, 55.1289045411 }}, /* 2573 K */
+    {{ 36.687139239, 39.0961364705, 20.7861492051, 628.546674501, 61.5668747901, 55.133559466 }}, /* 2574 K */
+    {{ 36.6880801563, 39.0983107359, 20.7861492052, 628.591294279, 61.5684913001, 55.1382107637 }}, /* 2575 K */
+    {{ 36.6890202731, 39.1004845647, 20.7861492053, 628.635867487, 61.5701064593, 55.1428584375 }}, /* 2576 K */
+    {{ 36.6899595903, 39.1026579568, 20.7861492055, 628.680394169, 61.5717202696, 55.1475024903 }}, /* 2577 K */
+    {{ 36.6908981091, 39.104830912, 20.7861492056, 628.724874371, 61.5733327331, 55.1521429255 }}, /* 2578 K */
+    {{ 36.6918358305, 39.1070034299, 20.7861492058, 628.769308139, 61.5749438519, 55.156779746 }}, /* 2579 K */
+    {{ 36.6927727557, 39.1091755104, 20.7861492059, 628.813695517, 61.576553628, 55.1614129551 }}, /* 2580 K */
+    {{ 36.6937088857, 39.1113471533, 20.786149206, 628.858036552, 61.5781620634, 55.1660425558 }}, /* 2581 K */
+    {{ 36.6946442216, 39.1135183582, 20.7861492062, 628.902331289, 61.5797691603, 55.1706685513 }}, /* 2582 K */
+    {{ 36.6955787645, 39.1156891251, 20.7861492063, 628.946579773, 61.5813749206, 55.1752909448 }}, /* 2583 K */
+    {{ 36.6965125155, 39.1178594537, 20.7861492065, 628.990782049, 61.5829793463, 55.1799097393 }}, /* 2584 K */
+    {{ 36.6974454755, 39.1200293437, 20.7861492066, 629.034938162, 61.5845824395, 55.1845249379 }}, /* 2585 K */
+    {{ 36.6983776458, 39.1221987949, 20.7861492068, 629.079048159, 61.5861842022, 55.1891365439 }}, /* 2586 K */
+    {{ 36.6993090274, 39.1243678072, 20.7861492069, 629.123112083, 61.5877846365, 55.1937445602 }}, /* 2587 K */
+    {{ 36.7002396213, 39.1265363802, 20.7861492071, 629.16712998, 61.5893837443, 55.1983489901 }}, /* 2588 K */
+    {{ 36.7011694287, 39.1287045138, 20.7861492073, 629.211101895, 61.5909815277, 55.2029498366 }}, /* 2589 K */
+    {{ 36.7020984505, 39.1308722077, 20.7861492074, 629.255027872, 61.5925779887, 55.2075471029 }}, /* 2590 K */
+    {{ 36.7030266879, 39.1330394617, 20.7861492076, 629.298907958, 61.5941731293, 55.212140792 }}, /* 2591 K */
+    {{ 36.7039541419, 39.1352062757, 20.7861492078, 629.342742197, 61.5957669516, 55.2167309071 }}, /* 2592 K */
+    {{ 36.7048808136, 39.1373726493, 20.786149208, 629.386530633, 61.5973594574, 55.2213174513 }}, /* 2593 K */
+    {{ 36.705806704, 39.1395385824, 20.7861492081, 629.430273311, 61.5989506489, 55.2259004277 }}, /* 2594 K */
+    {{ 36.7067318142, 39.1417040747, 20.7861492083, 629.473970277, 61.6005405281, 55.2304798394 }}, /* 2595 K */
+    {{ 36.7076561453, 39.143869126, 20.7861492085, 629.517621575, 61.6021290969, 55.2350556895 }}, /* 2596 K */
+    {{ 36.7085796983, 39.1460337361, 20.7861492087, 629.56122725, 61.6037163573, 55.2396279811 }}, /* 2597 K */
+    {{ 36.7095024742, 39.1481979048, 20.7861492089, 629.604787346, 61.6053023114, 55.2441967173 }}, /* 2598 K */
+    {{ 36.7104244742, 39.1503616318, 20.786149209, 629.648301909, 61.6068869611, 55.2487619013 }}, /* 2599 K */
+    {{ 36.7113456993, 39.1525249171, 20.7861492092, 629.691770982, 61.6084703084, 55.253323536 }}, /* 2600 K */
+    {{ 36.7122661504, 39.1546877602, 20.7861492094, 629.73519461, 61.6100523554, 55.2578816247 }}, /* 2601 K */
+    {{ 36.7131858288, 39.156850161, 20.7861492096, 629.778572837, 61.611633104, 55.2624361703 }}, /* 2602 K */
+    {{ 36.7141047353, 39.1590121194, 20.7861492098, 629.821905709, 61.6132125561, 55.2669871761 }}, /* 2603 K */
+    {{ 36.7150228711, 39.161173635, 20.78614921, 629.865193269, 61.6147907138, 55.271534645 }}, /* 2604 K */
+    {{ 36.7159402372, 39.1633347076, 20.7861492102, 629.908435562, 61.6163675791, 55.2760785802 }}, /* 2605 K */
+    {{ 36.7168568347, 39.1654953372, 20.7861492104, 629.951632632, 61.6179431539, 55.2806189848 }}, /* 2606 K */
+    {{ 36.7177726645, 39.1676555233, 20.7861492106, 629.994784524, 61.6195174401, 55.2851558618 }}, /* 2607 K */
+    {{ 36.7186877277, 39.1698152659, 20.7861492109, 630.037891281, 61.6210904399, 55.2896892144 }}, /* 2608 K */
+    {{ 36.7196020254, 39.1719745647, 20.7861492111, 630.080952948, 61.6226621551, 55.2942190455 }}, /* 2609 K */
+    {{ 36.7205155586, 39.1741334194, 20.7861492113, 630.12396957, 61.6242325877, 55.2987453584 }}, /* 2610 K */
+    {{ 36.7214283283, 39.17629183, 20.7861492115, 630.166941189, 61.6258017397, 55.303268156 }}, /* 2611 K */
+    {{ 36.7223403355, 39.1784497961, 20.7861492117, 630.209867851, 61.627369613, 55.3077874415 }}, /* 2612 K */
+    {{ 36.7232515814, 39.1806073176, 20.7861492119, 630.252749598, 61.6289362096, 55.3123032179 }}, /* 2613 K */
+    {{ 36.7241620668, 39.1827643942, 20.7861492122, 630.295586477, 61.6305015314, 55.3168154883 }}, /* 2614 K */
+    {{ 36.7250717929, 39.1849210257, 20.7861492124, 630.338378529, 61.6320655805, 55.3213242558 }}, /* 2615 K */
+    {{ 36.7259807606, 39.187077212, 20.7861492126, 630.381125799, 61.6336283587, 55.3258295235 }}, /* 2616 K */
+    {{ 36.726888971, 39.1892329528, 20.7861492129, 630.423828332, 61.635189868, 55.3303312944 }}, /* 2617 K */
+    {{ 36.7277964251, 39.1913882478, 20.7861492131, 630.46648617, 61.6367501104, 55.3348295715 }}, /* 2618 K */
+    {{ 36.728703124, 39.193543097, 20.7861492133, 630.509099358, 61.6383090877, 55.339324358 }}, /* 2619 K */
+    {{ 36.7296090685, 39.1956975, 20.7861492136, 630.551667939, 61.6398668021, 55.343815657 }}, /* 2620 K */
+    {{ 36.7305142599, 39.1978514568, 20.7861492138, 630.594191957, 61.6414232552, 55.3483034714 }}, /* 2621 K */
+    {{ 36.731418699, 39.2000049669, 20.7861492141, 630.636671455, 61.6429784493, 55.3527878043 }}, /* 2622 K */
+    {{ 36.7323223869, 39.2021580304, 20.7861492143, 630.679106478, 61.644532386, 55.3572686588 }}, /* 2623 K */
+    {{ 36.7332253246, 39.2043106469, 20.7861492146, 630.721497069, 61.6460850675, 55.361746038 }}, /* 2624 K */
+    {{ 36.7341275131, 39.2064628162, 20.7861492148, 630.763843271, 61.6476364956, 55.366219945 }}, /* 2625 K */
+    {{ 36.7350289534, 39.2086145382, 20.7861492151, 630.806145128, 61.6491866722, 55.3706903826 }}, /* 2626 K */
+    {{ 36.7359296465, 39.2107658126, 20.7861492153, 630.848402684, 61.6507355993, 55.3751573541 }}, /* 2627 K */
+    {{ 36.7368295935, 39.2129166392, 20.7861492156, 630.890615981, 61.6522832788, 55.3796208625 }}, /* 2628 K */
+    {{ 36.7377287953, 39.2150670178, 20.7861492159, 630.932785063, 61.6538297126, 55.3840809108 }}, /* 2629 K */
+    {{ 36.7386272529, 39.2172169483, 20.7861492161, 630.974909974, 61.6553749026, 55.3885375021 }}, /* 2630 K */
+    {{ 36.7395249674, 39.2193664304, 20.7861492164, 631.016990756, 61.6569188508, 55.3929906394 }}, /* 2631 K */
+    {{ 36.7404219397, 39.2215154638, 20.7861492166, 631.059027454, 61.6584615591, 55.3974403257 }}, /* 2632 K */
+    {{ 36.7413181709, 39.2236640485, 20.7861492169, 631.101020109, 61.6600030293, 55.4018865642 }}, /* 2633 K */
+    {{ 36.7422136618, 39.2258121842, 20.7861492172, 631.142968766, 61.6615432634, 55.4063293578 }}, /* 2634 K */
+    {{ 36.7431084136, 39.2279598707, 20.7861492175, 631.184873467, 61.6630822634, 55.4107687096 }}, /* 2635 K */
+    {{ 36.7440024273, 39.2301071077, 20.7861492177, 631.226734256, 61.664620031, 55.4152046226 }}, /* 2636 K */
+    {{ 36.7448957037, 39.2322538952, 20.786149218, 631.268551176, 61.6661565682, 55.4196370998 }}, /* 2637 K */
+    {{ 36.7457882439, 39.2344002328, 20.7861492183, 631.310324269, 61.6676918769, 55.4240661444 }}, /* 2638 K */
+    {{ 36.7466800489, 39.2365461205, 20.7861492186, 631.352053579, 61.6692259591, 55.4284917592 }}, /* 2639 K */
+    {{ 36.7475711197, 39.2386915579, 20.7861492189, 631.393739148, 61.6707588165, 55.4329139475 }}, /* 2640 K */
+    {{ 36.7484614572, 39.2408365449, 20.7861492192, 631.435381019, 61.6722904511, 55.4373327121 }}, /* 2641 K */
+    {{ 36.7493510625, 39.2429810813, 20.7861492195, 631.476979236, 61.6738208648, 55.4417480561 }}, /* 2642 K */
+    {{ 36.7502399365, 39.2451251669, 20.7861492198, 631.518533841, 61.6753500594, 55.4461599826 }}, /* 2643 K */
+    {{ 36.7511280802, 39.2472688015, 20.7861492201, 631.560044876, 61.676878037, 55.4505684945 }}, /* 2644 K */
+    {{ 36.7520154946, 39.2494119849, 20.7861492204, 631.601512385, 61.6784047992, 55.4549735949 }}, /* 2645 K */
+    {{ 36.7529021807, 39.2515547169, 20.7861492207, 631.64293641, 61.6799303481, 55.4593752869 }}, /* 2646 K */
+    {{ 36.7537881394, 39.2536969973, 20.786149221, 631.684316994, 61.6814546854, 55.4637735733 }}, /* 2647 K */
+    {{ 36.7546733717, 39.2558388258, 20.7861492213, 631.72565418, 61.6829778132, 55.4681684573 }}, /* 2648 K */
+    {{ 36.7555578786, 39.2579802024, 20.7861492216, 631.766948009, 61.6844997332, 55.4725599419 }}, /* 2649 K */
+    {{ 36.7564416611, 39.2601211268, 20.7861492219, 631.808198525, 61.6860204473, 55.47694803 }}, /* 2650 K */
+    {{ 36.75732472, 39.2622615988, 20.7861492222, 631.84940577, 61.6875399574, 55.4813327248 }}, /* 2651 K */
+    {{ 36.7582070565, 39.2644016182, 20.7861492225, 631.890569786, 61.6890582653, 55.4857140291 }}, /* 2652 K */
+    {{ 36.7590886715, 39.2665411848, 20.7861492228, 631.931690616, 61.690575373, 55.490091946 }}, /* 2653 K */
+    {{ 36.7599695658, 39.2686802985, 20.7861492232, 631.972768303, 61.6920912823, 55.4944664786 }}, /* 2654 K */
+    {{ 36.7608497406, 39.270818959, 20.7861492235, 632.013802888, 61.693605995, 55.4988376298 }}, /* 2655 K */
+    {{ 36.7617291967, 39.2729571661, 20.7861492238, 632.054794413, 61.6951195131, 55.5032054026 }}, /* 2656 K */
+    {{ 36.7626079351, 39.2750949197, 20.7861492241, 632.095742922, 61.6966318383, 55.5075698 }}, /* 2657 K */
+    {{ 36.7634859568, 39.2772322195, 20.7861492245, 632.136648456, 61.6981429725, 55.5119308251 }}, /* 2658 K */
+    {{ 36.7643632628, 39.2793690654, 20.7861492248, 632.177511057, 61.6996529176, 55.5162884808 }}, /* 2659 K */
+    {{ 36.7652398539, 39.2815054571, 20.7861492251, 632.218330768, 61.7011616754, 55.5206427701 }}, /* 2660 K */
+    {{ 36.7661157312, 39.2836413946, 20.7861492255, 632.25910763, 61.7026692478, 55.5249936961 }}, /* 2661 K */
+    {{ 36.7669908955, 39.2857768775, 20.7861492258, 632.299841686, 61.7041756366, 55.5293412617 }}, /* 2662 K */
+    {{ 36.767865348, 39.2879119057, 20.7861492261, 632.340532978, 61.7056808437, 55.5336854698 }}, /* 2663 K */
+    {{ 36.7687390894, 39.290046479, 20.7861492265, 632.381181548, 61.7071848708, 55.5380263236 }}, /* 2664 K */
+    {{ 36.7696121207, 39.2921805972, 20.7861492268, 632.421787437, 61.70868772, 55.542363826 }}, /* 2665 K */
+    {{ 36.770484443, 39.2943142602, 20.7861492272, 632.462350687, 61.7101893928, 55.54669798 }}, /* 2666 K */
+    {{ 36.7713560571, 39.2964474677, 20.7861492275, 632.502871341, 61.7116898913, 55.5510287885 }}, /* 2667 K */
+    {{ 36.772226964, 39.2985802195, 20.7861492279, 632.54334944, 61.7131892173, 55.5553562546 }}, /* 2668 K */
+    {{ 36.7730971646, 39.3007125155, 20.7861492282, 632.583785025, 61.7146873725, 55.5596803812 }}, /* 2669 K */
+    {{ 36.7739666599, 39.3028443554, 20.7861492286, 632.62417814, 61.7161843588, 55.5640011714 }}, /* 2670 K */
+    {{ 36.7748354508, 39.3049757392, 20.786149229, 632.664528824, 61.717680178, 55.568318628 }}, /* 2671 K */
+    {{ 36.7757035383, 39.3071066665, 20.7861492293, 632.704837121, 61.719174832, 55.5726327541 }}, /* 2672 K */
+    {{ 36.7765709233, 39.3092371373, 20.7861492297, 632.745103071, 61.7206683226, 55.5769435527 }}, /* 2673 K */
+    {{ 36.7774376066, 39.3113671513, 20.78614923, 632.785326716, 61.7221606515, 55.5812510267 }}, /* 2674 K */
+    {{ 36.7783035894, 39.3134967083, 20.7861492304, 632.825508098, 61.7236518207, 55.585555179 }}, /* 2675 K */
+    {{ 36.7791688724, 39.3156258081, 20.7861492308, 632.865647259, 61.7251418319, 55.5898560128 }}, /* 2676 K */
+    {{ 36.7800334566, 39.3177544507, 20.7861492312, 632.905744238, 61.7266306869, 55.5941535309 }}, /* 2677 K */
+    {{ 36.780897343, 39.3198826357, 20.7861492315, 632.945799079, 61.7281183875, 55.5984477363 }}, /* 2678 K */
+    {{ 36.7817605325, 39.322010363, 20.7861492319, 632.985811823, 61.7296049357, 55.6027386319 }}, /* 2679 K */
+    {{ 36.782623026, 39.3241376324, 20.7861492323, 633.02578251, 61.731090333, 55.6070262208 }}, /* 2680 K */
+    {{ 36.7834848245, 39.3262644438, 20.7861492327, 633.065711182, 61.7325745815, 55.611310506 }}, /* 2681 K */
+    {{ 36.7843459287, 39.3283907969, 20.7861492331, 633.105597881, 61.7340576828, 55.6155914902 }}, /* 2682 K */
+    {{ 36.7852063398, 39.3305166916, 20.7861492334, 633.145442647, 61.7355396388, 55.6198691766 }}, /* 2683 K */
+    {{ 36.7860660586, 39.3326421277, 20.7861492338, 633.185245522, 61.7370204512, 55.6241435681 }}, /* 2684 K */
+    {{ 36.786925086, 39.3347671049, 20.7861492342, 633.225006548, 61.7385001219, 55.6284146676 }}, /* 2685 K */
+    {{ 36.7877834229, 39.3368916232, 20.7861492346, 633.264725764, 61.7399786527, 55.6326824781 }}, /* 2686 K */
+    {{ 36.7886410703, 39.3390156824, 20.786149235, 633.304403212, 61.7414560453, 55.6369470025 }}, /* 2687 K */
+    {{ 36.7894980291, 39.3411392822, 20.7861492354, 633.344038933, 61.7429323015, 55.6412082438 }}, /* 2688 K */
+    {{ 36.7903543002, 39.3432624225, 20.7861492358, 633.383632969, 61.7444074232, 55.645466205 }}, /* 2689 K */
+    {{ 36.7912098844, 39.3453851031, 20.7861492362, 633.42318536, 61.745881412, 55.649720889 }}, /* 2690 K */
+    {{ 36.7920647828, 39.3475073238, 20.7861492366, 633.462696147, 61.7473542699, 55.6539722987 }}, /* 2691 K */
+    {{ 36.7929189962, 39.3496290845, 20.786149237, 633.50216537, 61.7488259985, 55.6582204371 }}, /* 2692 K */
+    {{ 36.7937725255, 39.3517503849, 20.7861492374, 633.541593072, 61.7502965997, 55.6624653071 }}, /* 2693 K */
+    {{ 36.7946253717, 39.3538712249, 20.7861492378, 633.580979292, 61.7517660752, 55.6667069117 }}, /* 2694 K */
+    {{ 36.7954775356, 39.3559916044, 20.7861492382, 633.620324072, 61.7532344268, 55.6709452538 }}, /* 2695 K */
+    {{ 36.7963290182, 39.3581115231, 20.7861492386, 633.659627451, 61.7547016562, 55.6751803363 }}, /* 2696 K */
+    {{ 36.7971798203, 39.3602309808, 20.7861492391, 633.698889472, 61.7561677654, 55.6794121622 }}, /* 2697 K */
+    {{ 36.7980299429, 39.3623499774, 20.7861492395, 633.738110174, 61.7576327559, 55.6836407345 }}, /* 2698 K */
+    {{ 36.7988793868, 39.3644685128, 20.7861492399, 633.777289598, 61.7590966296, 55.687866056 }}, /* 2699 K */
+    {{ 36.799728153, 39.3665865867, 20.7861492403, 633.816427785, 61.7605593882, 55.6920881296 }}, /* 2700 K */
+    {{ 36.8005762424, 39.3687041989, 20.7861492407, 633.855524774, 61.7620210336, 55.6963069584 }}, /* 2701 K */
+    {{ 36.8014236557, 39.3708213493, 20.7861492412, 633.894580608, 61.7634815674, 55.7005225452 }}, /* 2702 K */
+    {{ 36.8022703941, 39.3729380378, 20.7861492416, 633.933595326, 61.7649409914, 55.704734893 }}, /* 2703 K */
+    {{ 36.8031164582, 39.375054264, 20.786149242, 633.972568968, 61.7663993075, 55.7089440047 }}, /* 2704 K */
+    {{ 36.8039618491, 39.377170028, 20.7861492425, 634.011501576, 61.7678565172, 55.7131498832 }}, /* 2705 K */
+    {{ 36.8048065676, 39.3792853294, 20.7861492429, 634.050393189, 61.7693126225, 55.7173525314 }}, /* 2706 K */
+    {{ 36.8056506146, 39.3814001682, 20.7861492433, 634.089243847, 61.7707676249, 55.7215519523 }}, /* 2707 K */
+    {{ 36.806493991, 39.3835145441, 20.7861492438, 634.128053592, 61.7722215264, 55.7257481488 }}, /* 2708 K */
+    {{ 36.8073366977, 39.385628457, 20.7861492442, 634.166822463, 61.7736743286, 55.7299411238 }}, /* 2709 K */
+    {{ 36.8081787356, 39.3877419067, 20.7861492446, 634.2055505, 61.7751260332, 55.7341308801 }}, /* 2710 K */
+    {{ 36.8090201055, 39.389854893, 20.7861492451, 634.244237743, 61.7765766421, 55.7383174208 }}, /* 2711 K */
+    {{ 36.8098608083, 39.3919674158, 20.7861492455, 634.282884234, 61.7780261569, 55.7425007487 }}, /* 2712 K */
+    {{ 36.8107008449, 39.3940794749, 20.786149246, 634.321490011, 61.7794745794, 55.7466808668 }}, /* 2713 K */
+    {{ 36.8115402163, 39.3961910702, 20.7861492464, 634.360055116, 61.7809219114, 55.7508577779 }}, /* 2714 K */
+    {{ 36.8123789232, 39.3983022014, 20.7861492469, 634.398579587, 61.7823681545, 55.755031485 }}, /* 2715 K */
+    {{ 36.8132169666, 39.4004128683, 20.7861492473, 634.437063465, 61.7838133105, 55.7592019909 }}, /* 2716 K */
+    {{ 36.8140543472, 39.402523071, 20.7861492478, 634.47550679, 61.7852573811, 55.7633692986 }}, /* 2717 K */
+    {{ 36.8148910661, 39.404632809, 20.7861492483, 634.513909601, 61.7867003681, 55.767533411 }}, /* 2718 K */
+    {{ 36.8157271241, 39.4067420824, 20.7861492487, 634.55227194, 61.7881422731, 55.7716943309 }}, /* 2719 K */
+    {{ 36.816562522, 39.4088508909, 20.7861492492, 634.590593844, 61.7895830979, 55.7758520613 }}, /* 2720 K */
+    {{ 36.8173972607, 39.4109592343, 20.7861492497, 634.628875355, 61.7910228443, 55.780006605 }}, /* 2721 K */
+    {{ 36.818231341, 39.4130671126, 20.7861492501, 634.667116512, 61.7924615139, 55.7841579651 }}, /* 2722 K */
+    {{ 36.819064764, 39.4151745254, 20.7861492506, 634.705317355, 61.7938991085, 55.7883061442 }}, /* 2723 K */
+    {{ 36.8198975303, 39.4172814728, 20.7861492511, 634.743477924, 61.7953356297, 55.7924511454 }}, /* 2724 K */
+    {{ 36.8207296409, 39.4193879544, 20.7861492515, 634.781598257, 61.7967710794, 55.7965929716 }}, /* 2725 K */
+    {{ 36.8215610967, 39.4214939701, 20.786149252, 634.819678395, 61.7982054591, 55.8007316255 }}, /* 2726 K */
+    {{ 36.8223918985, 39.4235995199, 20.7861492525, 634.857718377, 61.7996387706, 55.8048671102 }}, /* 2727 K */
+    {{ 36.8232220471, 39.4257046034, 20.786149253, 634.895718244, 61.8010710157, 55.8089994285 }}, /* 2728 K */
+    {{ 36.8240515435, 39.4278092206, 20.7861492534, 634.933678033, 61.802502196, 55.8131285833 }}, /* 2729 K */
+    {{ 36.8248803884, 39.4299133712, 20.7861492539, 634.971597786, 61.8039323132, 55.8172545774 }}, /* 2730 K */
+    {{ 36.8257085828, 39.4320170552, 20.7861492544, 635.00947754, 61.805361369, 55.8213774137 }}, /* 2731 K */
+    {{ 36.8265361275, 39.4341202724, 20.7861492549, 635.047317337, 61.8067893652, 55.8254970952 }}, /* 2732 K */
+    {{ 36.8273630234, 39.4362230225, 20.7861492554, 635.085117214, 61.8082163034, 55.8296136247 }}, /* 2733 K */
+    {{ 36.8281892712, 39.4383253055, 20.7861492559, 635.122877212, 61.8096421854, 55.833727005 }}, /* 2734 K */
+    {{ 36.8290148719, 39.4404271211, 20.7861492564, 635.160597369, 61.8110670127, 55.8378372391 }}, /* 2735 K */
+    {{ 36.8298398263, 39.4425284693, 20.7861492569, 635.198277726, 61.8124907872, 55.8419443298 }}, /* 2736 K */
+    {{ 36.8306641352, 39.4446293498, 20.7861492574, 635.23591832, 61.8139135105, 55.84604828 }}, /* 2737 K */
+    {{ 36.8314877996, 39.4467297626, 20.7861492579, 635.273519192, 61.8153351842, 55.8501490926 }}, /* 2738 K */
+    {{ 36.8323108202, 39.4488297073, 20.7861492584, 635.31108038, 61.8167558102, 55.8542467704 }}, /* 2739 K */
+    {{ 36.8331331979, 39.450929184, 20.7861492589, 635.348601923, 61.81817539, 55.8583413163 }}, /* 2740 K */
+    {{ 36.8339549335, 39.4530281923, 20.7861492594, 635.386083862, 61.8195939253, 55.8624327331 }}, /* 2741 K */
+    {{ 36.8347760279, 39.4551267323, 20.7861492599, 635.423526233, 61.8210114179, 55.8665210238 }}, /* 2742 K */
+    {{ 36.835596482, 39.4572248036, 20.7861492604, 635.460929078, 61.8224278694, 55.8706061911 }}, /* 2743 K */
+    {{ 36.8364162965, 39.4593224062, 20.7861492609, 635.498292434, 61.8238432815, 55.874688238 }}, /* 2744 K */
+    {{ 36.8372354723, 39.4614195399, 20.7861492614, 635.535616341, 61.8252576558, 55.8787671672 }}, /* 2745 K */
+    {{ 36.8380540102, 39.4635162046, 20.7861492619, 635.572900837, 61.8266709941, 55.8828429817 }}, /* 2746 K */
+    {{ 36.8388719111, 39.4656124, 20.7861492624, 635.610145962, 61.828083298, 55.8869156844 }}, /* 2747 K */
+    {{ 36.8396891758, 39.4677081261, 20.786149263, 635.647351753, 61.8294945691, 55.890985278 }}, /* 2748 K */
+    {{ 36.8405058051, 39.4698033826, 20.7861492635, 635.684518251, 61.8309048092, 55.8950517653 }}, /* 2749 K */
+    {{ 36.8413218, 39.4718981695, 20.786149264, 635.721645493, 61.8323140199, 55.8991151494 }}, /* 2750 K */
+    {{ 36.8421371611, 39.4739924865, 20.7861492645, 635.758733518, 61.8337222029, 55.9031754329 }}, /* 2751 K */
+    {{ 36.8429518894, 39.4760863336, 20.786149265, 635.795782366, 61.8351293598, 55.9072326189 }}, /* 2752 K */
+    {{ 36.8437659856, 39.4781797105, 20.7861492656, 635.832792074, 61.8365354923, 55.91128671 }}, /* 2753 K */
+    {{ 36.8445794506, 39.4802726171, 20.7861492661, 635.869762682, 61.837940602, 55.9153377091 }}, /* 2754 K */
+    {{ 36.8453922852, 39.4823650533, 20.7861492666, 635.906694227, 61.8393446907, 55.9193856191 }}, /* 2755 K */
+    {{ 36.8462044903, 39.4844570189, 20.7861492672, 635.943586749, 61.8407477599, 55.9234304429 }}, /* 2756 K */
+    {{ 36.8470160666, 39.4865485137, 20.7861492677, 635.980440286, 61.8421498113, 55.9274721832 }}, /* 2757 K */
+    {{ 36.847827015, 39.4886395377, 20.7861492682, 636.017254876, 61.8435508466, 55.9315108429 }}, /* 2758 K */
+    {{ 36.8486373364, 39.4907300906, 20.7861492688, 636.054030558, 61.8449508675, 55.9355464248 }}, /* 2759 K */
+    {{ 36.8494470314, 39.4928201723, 20.7861492693, 636.090767371, 61.8463498754, 55.9395789318 }}, /* 2760 K */
+    {{ 36.850256101, 39.4949097827, 20.7861492699, 636.127465352, 61.8477478722, 55.9436083666 }}, /* 2761 K */
+    {{ 36.851064546, 39.4969989216, 20.7861492704, 636.164124539, 61.8491448595, 55.9476347322 }}, /* 2762 K */
+    {{ 36.8518723671, 39.4990875889, 20.7861492709, 636.200744972, 61.8505408388, 55.9516580314 }}, /* 2763 K */
+    {{ 36.8526795652, 39.5011757843, 20.7861492715, 636.237326689, 61.8519358119, 55.9556782669 }}, /* 2764 K */
+    {{ 36.8534861411, 39.5032635079, 20.786149272, 636.273869727, 61.8533297804, 55.9596954417 }}, /* 2765 K */
+    {{ 36.8542920957, 39.5053507593, 20.7861492726, 636.310374125, 61.8547227458, 55.9637095584 }}, /* 2766 K */
+    {{ 36.8550974297, 39.5074375385, 20.7861492731, 636.346839921, 61.8561147099, 55.96772062 }}, /* 2767 K */
+    {{ 36.8559021439, 39.5095238454, 20.7861492737, 636.383267153, 61.8575056743, 55.9717286293 }}, /* 2768 K */
+    {{ 36.8567062391, 39.5116096797, 20.7861492743, 636.419655859, 61.8588956406, 55.975733589 }}, /* 2769 K */
+    {{ 36.8575097162, 39.5136950413, 20.7861492748, 636.456006077, 61.8602846105, 55.9797355021 }}, /* 2770 K */
+    {{ 36.858312576, 39.5157799302, 20.7861492754, 636.492317846, 61.8616725854, 55.9837343712 }}, /* 2771 K */
+    {{ 36.8591148192, 39.517864346, 20.7861492759, 636.528591203, 61.8630595672, 55.9877301993 }}, /* 2772 K */
+    {{ 36.8599164467, 39.5199482888, 20.7861492765, 636.564826186, 61.8644455574, 55.9917229892 }}, /* 2773 K */
+    {{ 36.8607174593, 39.5220317584, 20.7861492771, 636.601022834, 61.8658305577, 55.9957127436 }}, /* 2774 K */
+    {{ 36.8615178577, 39.5241147545, 20.7861492776, 636.637181183, 61.8672145695, 55.9996994653 }}, /* 2775 K */
+    {{ 36.8623176429, 39.5261972771, 20.7861492782, 636.673301272, 61.8685975947, 56.0036831572 }}, /* 2776 K */
+    {{ 36.8631168154, 39.528279326, 20.7861492788, 636.709383139, 61.8699796348, 56.0076638221 }}, /* 2777 K */
+    {{ 36.8639153763, 39.5303609011, 20.7861492793, 636.745426821, 61.8713606913, 56.0116414628 }}, /* 2778 K */
+    {{ 36.8647133262, 39.5324420023, 20.7861492799, 636.781432356, 61.872740766, 56.015616082 }}, /* 2779 K */
+    {{ 36.8655106659, 39.5345226294, 20.7861492805, 636.817399782, 61.8741198604, 56.0195876827 }}, /* 2780 K */
+    {{ 36.8663073964, 39.5366027822, 20.7861492811, 636.853329136, 61.8754979761, 56.0235562675 }}, /* 2781 K */
+    {{ 36.8671035182, 39.5386824606, 20.7861492817, 636.889220457, 61.8768751148, 56.0275218392 }}, /* 2782 K */
+    {{ 36.8678990323, 39.5407616645, 20.7861492822, 636.925073781, 61.878251278, 56.0314844008 }}, /* 2783 K */
+    {{ 36.8686939394, 39.5428403937, 20.7861492828, 636.960889146, 61.8796264674, 56.0354439549 }}, /* 2784 K */
+    {{ 36.8694882404, 39.5449186482, 20.7861492834, 636.99666659, 61.8810006846, 56.0394005044 }}, /* 2785 K */
+    {{ 36.8702819359, 39.5469964277, 20.786149284, 637.032406151, 61.8823739311, 56.043354052 }}, /* 2786 K */
+    {{ 36.8710750268, 39.5490737321, 20.7861492846, 637.068107865, 61.8837462086, 56.0473046005 }}, /* 2787 K */
+    {{ 36.8718675139, 39.5511505613, 20.7861492852, 637.103771771, 61.8851175186, 56.0512521528 }}, /* 2788 K */
+    {{ 36.8726593979, 39.5532269151, 20.7861492858, 637.139397905, 61.8864878628, 56.0551967115 }}, /* 2789 K */
+    {{ 36.8734506797, 39.5553027935, 20.7861492863, 637.174986305, 61.8878572427, 56.0591382796 }}, /* 2790 K */
+    {{ 36.8742413601, 39.5573781962, 20.7861492869, 637.210537008, 61.8892256599, 56.0630768598 }}, /* 2791 K */
+    {{ 36.8750314397, 39.5594531231, 20.7861492875, 637.246050051, 61.8905931161, 56.0670124548 }}, /* 2792 K */
+    {{ 36.8758209194, 39.5615275742, 20.7861492881, 637.281525473, 61.8919596128, 56.0709450674 }}, /* 2793 K */
+    {{ 36.8766097999, 39.5636015492, 20.7861492887, 637.316963309, 61.8933251516, 56.0748747004 }}, /* 2794 K */
+    {{ 36.8773980821, 39.565675048, 20.7861492893, 637.352363598, 61.8946897341, 56.0788013567 }}, /* 2795 K */
+    {{ 36.8781857667, 39.5677480705, 20.7861492899, 637.387726376, 61.8960533619, 56.0827250389 }}, /* 2796 K */
+    {{ 36.8789728545, 39.5698206166, 20.7861492905, 637.42305168, 61.8974160365, 56.0866457498 }}, /* 2797 K */
+    {{ 36.8797593463, 39.5718926861, 20.7861492911, 637.458339548, 61.8987777595, 56.0905634922 }}, /* 2798 K */
+    {{ 36.8805452428, 39.5739642789, 20.7861492918, 637.493590017, 61.9001385325, 56.094478269 }}, /* 2799 K */
+    {{ 36.8813305448, 39.5760353948, 20.7861492924, 637.528803123, 61.9014983572, 56.0983900827 }}, /* 2800 K */
+    {{ 36.882115253, 39.5781060338, 20.786149293, 637.563978904, 61.902857235, 56.1022989363 }}, /* 2801 K */
+    {{ 36.8828993684, 39.5801761956, 20.7861492936, 637.599117396, 61.9042151675, 56.1062048325 }}, /* 2802 K */
+    {{ 36.8836828915, 39.5822458803, 20.7861492942, 637.634218637, 61.9055721563, 56.1101077739 }}, /* 2803 K */
+    {{ 36.8844658232, 39.5843150875, 20.7861492948, 637.669282663, 61.906928203, 56.1140077635 }}, /* 2804 K */
+    {{ 36.8852481642, 39.5863838172, 20.7861492954, 637.704309512, 61.9082833092, 56.117904804 }}, /* 2805 K */
+    {{ 36.8860299154, 39.5884520693, 20.7861492961, 637.739299219, 61.9096374763, 56.1217988981 }}, /* 2806 K */
+    {{ 36.8868110774, 39.5905198436, 20.7861492967, 637.774251822, 61.910990706, 56.1256900485 }}, /* 2807 K */
+    {{ 36.8875916511, 39.59258714, 20.7861492973, 637.809167358, 61.9123429999, 56.1295782581 }}, /* 2808 K */
+    {{ 36.8883716371, 39.5946539584, 20.7861492979, 637.844045863, 61.9136943594, 56.1334635295 }}, /* 2809 K */
+    {{ 36.8891510363, 39.5967202987, 20.7861492985, 637.878887374, 61.9150447863, 56.1373458656 }}, /* 2810 K */
+    {{ 36.8899298494, 39.5987861606, 20.7861492992, 637.913691928, 61.9163942819, 56.1412252691 }}, /* 2811 K */
+    {{ 36.8907080772, 39.6008515442, 20.7861492998, 637.94845956, 61.9177428479, 56.1451017427 }}, /* 2812 K */
+    {{ 36.8914857204, 39.6029164492, 20.7861493004, 637.983190309, 61.9190904858, 56.1489752892 }}, /* 2813 K */
+    {{ 36.8922627798, 39.6049808755, 20.7861493011, 638.01788421, 61.9204371972, 56.1528459113 }}, /* 2814 K */
+    {{ 36.8930392561, 39.607044823, 20.7861493017, 638.0525413, 61.9217829836, 56.1567136118 }}, /* 2815 K */
+    {{ 36.8938151501, 39.6091082916, 20.7861493023, 638.087161615, 61.9231278466, 56.1605783934 }}, /* 2816 K */
+    {{ 36.8945904625, 39.6111712812, 20.786149303, 638.121745192, 61.9244717878, 56.1644402589 }}, /* 2817 K */
+    {{ 36.8953651941, 39.6132337916, 20.7861493036, 638.156292067, 61.9258148086, 56.168299211 }}, /* 2818 K */
+    {{ 36.8961393457, 39.6152958227, 20.7861493042, 638.190802276, 61.9271569106, 56.1721552523 }}, /* 2819 K */
+    {{ 36.8969129179, 39.6173573743, 20.7861493049, 638.225275857, 61.9284980954, 56.1760083858 }}, /* 2820 K */
+    {{ 36.8976859116, 39.6194184464, 20.7861493055, 638.259712845, 61.9298383644, 56.179858614 }}, /* 2821 K */
+    {{ 36.8984583275, 39.6214790388, 20.7861493062, 638.294113276, 61.9311777194, 56.1837059398 }}, /* 2822 K */
+    {{ 36.8992301662, 39.6235391514, 20.7861493068, 638.328477188, 61.9325161617, 56.1875503658 }}, /* 2823 K */
+    {{ 36.9000014287, 39.6255987841, 20.7861493075, 638.362804615, 61.9338536929, 56.1913918949 }}, /* 2824 K */
+    {{ 36.9007721155, 39.6276579368, 20.7861493081, 638.397095594, 61.9351903145, 56.1952305296 }}, /* 2825 K */
+    {{ 36.9015422275, 39.6297166093, 20.7861493088, 638.431350162, 61.9365260282, 56.1990662728 }}, /* 2826 K */
+    {{ 36.9023117654, 39.6317748015, 20.7861493094, 638.465568354, 61.9378608353, 56.2028991272 }}, /* 2827 K */
+    {{ 36.9030807299, 39.6338325132, 20.7861493101, 638.499750207, 61.9391947375, 56.2067290954 }}, /* 2828 K */
+    {{ 36.9038491218, 39.6358897445, 20.7861493107, 638.533895757, 61.9405277363, 56.2105561803 }}, /* 2829 K */
+    {{ 36.9046169418, 39.637946495, 20.7861493114, 638.568005039, 61.9418598332, 56.2143803845 }}, /* 2830 K */
+    {{ 36.9053841906, 39.6400027648, 20.786149312, 638.60207809, 61.9431910297, 56.2182017108 }}, /* 2831 K */
+    {{ 36.906150869, 39.6420585537, 20.7861493127, 638.636114945, 61.9445213273, 56.2220201618 }}, /* 2832 K */
+    {{ 36.9069169777, 39.6441138616, 20.7861493134, 638.670115641, 61.9458507276, 56.2258357403 }}, /* 2833 K */
+    {{ 36.9076825175, 39.6461686884, 20.786149314, 638.704080213, 61.9471792321, 56.229648449 }}, /* 2834 K */
+    {{ 36.908447489, 39.6482230339, 20.7861493147, 638.738008698, 61.9485068424, 56.2334582906 }}, /* 2835 K */
+    {{ 36.909211893, 39.650276898, 20.7861493153, 638.77190113, 61.9498335598, 56.2372652678 }}, /* 2836 K */
+    {{ 36.9099757303, 39.6523302806, 20.786149316, 638.805757547, 61.951159386, 56.2410693834 }}, /* 2837 K */
+    {{ 36.9107390015, 39.6543831816, 20.7861493167, 638.839577983, 61.9524843224, 56.2448706399 }}, /* 2838 K */
+    {{ 36.9115017074, 39.6564356008, 20.7861493173, 638.873362475, 61.9538083706, 56.2486690403 }}, /* 2839 K */
+    {{ 36.9122638488, 39.6584875383, 20.786149318, 638.907111057, 61.955131532, 56.252464587 }}, /* 2840 K */
+    {{ 36.9130254262, 39.6605389937, 20.7861493187, 638.940823767, 61.9564538083, 56.2562572829 }}, /* 2841 K */
+    {{ 36.9137864405, 39.6625899671, 20.7861493194, 638.974500639, 61.9577752008, 56.2600471307 }}, /* 2842 K */
+    {{ 36.9145468924, 39.6646404582, 20.78614932, 639.008141708, 61.9590957112, 56.263834133 }}, /* 2843 K */
+    {{ 36.9153067826, 39.6666904671, 20.7861493207, 639.041747012, 61.9604153408, 56.2676182925 }}, /* 2844 K */
+    {{ 36.9160661119, 39.6687399935, 20.7861493214, 639.075316584, 61.9617340913, 56.271399612 }}, /* 2845 K */
+    {{ 36.9168248809, 39.6707890374, 20.7861493221, 639.108850461, 61.963051964, 56.2751780941 }}, /* 2846 K */
+    {{ 36.9175830903, 39.6728375987, 20.7861493228, 639.142348678, 61.9643689606, 56.2789537415 }}, /* 2847 K */
+    {{ 36.9183407409, 39.6748856771, 20.7861493234, 639.175811271, 61.9656850825, 56.2827265569 }}, /* 2848 K */
+    {{ 36.9190978335, 39.6769332727, 20.7861493241, 639.209238274, 61.9670003311, 56.286496543 }}, /* 2849 K */
+    {{ 36.9198543686, 39.6789803852, 20.7861493248, 639.242629724, 61.9683147081, 56.2902637026 }}, /* 2850 K */
+    {{ 36.9206103471, 39.6810270147, 20.7861493255, 639.275985655, 61.9696282149, 56.2940280382 }}, /* 2851 K */
+    {{ 36.9213657696, 39.6830731609, 20.7861493262, 639.309306104, 61.9709408529, 56.2977895525 }}, /* 2852 K */
+    {{ 36.9221206368, 39.6851188238, 20.7861493269, 639.342591104, 61.9722526237, 56.3015482483 }}, /* 2853 K */
+    {{ 36.9228749496, 39.6871640033, 20.7861493276, 639.375840692, 61.9735635288, 56.3053041282 }}, /* 2854 K */
+    {{ 36.9236287085, 39.6892086992, 20.7861493282, 639.409054903, 61.9748735696, 56.3090571949 }}, /* 2855 K */
+    {{ 36.9243819142, 39.6912529114, 20.7861493289, 639.442233772, 61.9761827476, 56.3128074512 }}, /* 2856 K */
+    {{ 36.9251345676, 39.6932966398, 20.7861493296, 639.475377333, 61.9774910644, 56.3165548995 }}, /* 2857 K */
+    {{ 36.9258866692, 39.6953398843, 20.7861493303, 639.508485623, 61.9787985213, 56.3202995427 }}, /* 2858 K */
+    {{ 36.9266382199, 39.6973826449, 20.786149331, 639.541558676, 61.98010512, 56.3240413834 }}, /* 2859 K */
+    {{ 36.9273892203, 39.6994249213, 20.7861493317, 639.574596528, 61.9814108618, 56.3277804243 }}, /* 2860 K */
+    {{ 36.928139671, 39.7014667135, 20.7861493324, 639.607599212, 61.9827157482, 56.331516668 }}, /* 2861 K */
+    {{ 36.9288895729, 39.7035080214, 20.7861493331, 639.640566765, 61.9840197808, 56.3352501173 }}, /* 2862 K */
+    {{ 36.9296389266, 39.7055488448, 20.7861493338, 639.673499222, 61.9853229609, 56.3389807747 }}, /* 2863 K */
+    {{ 36.9303877328, 39.7075891837, 20.7861493345, 639.706396616, 61.9866252901, 56.342708643 }}, /* 2864 K */
+    {{ 36.9311359923, 39.709629038, 20.7861493352, 639.739258984, 61.9879267698, 56.3464337248 }}, /* 2865 K */
+    {{ 36.9318837056, 39.7116684074, 20.7861493359, 639.772086359, 61.9892274016, 56.3501560227 }}, /* 2866 K */
+    {{ 36.9326308735, 39.713707292, 20.7861493366, 639.804878778, 61.9905271868, 56.3538755395 }}, /* 2867 K */
+    {{ 36.9333774968, 39.7157456917, 20.7861493373, 639.837636274, 61.9918261269, 56.3575922778 }}, /* 2868 K */
+    {{ 36.934123576, 39.7177836062, 20.7861493381, 639.870358882, 61.9931242235, 56.3613062402 }}, /* 2869 K */
+    {{ 36.934869112, 39.7198210356, 20.7861493388, 639.903046638, 61.9944214779, 56.3650174295 }}, /* 2870 K */
+    {{ 36.9356141053, 39.7218579797, 20.7861493395, 639.935699576, 61.9957178917, 56.3687258482 }}, /* 2871 K */
+    {{ 36.9363585567, 39.7238944384, 20.7861493402, 639.96831773, 61.9970134662, 56.372431499 }}, /* 2872 K */
+    {{ 36.9371024668, 39.7259304116, 20.7861493409, 640.000901135, 61.9983082031, 56.3761343846 }}, /* 2873 K */
+    {{ 36.9378458365, 39.7279658992, 20.7861493416, 640.033449826, 61.9996021036, 56.3798345076 }}, /* 2874 K */
+    {{ 36.9385886662, 39.7300009011, 20.7861493423, 640.065963838, 62.0008951693, 56.3835318707 }}, /* 2875 K */
+    {{ 36.9393309569, 39.7320354171, 20.7861493431, 640.098443204, 62.0021874016, 56.3872264764 }}, /* 2876 K */
+    {{ 36.940072709, 39.7340694473, 20.7861493438, 640.13088796, 62.003478802, 56.3909183276 }}, /* 2877 K */
+    {{ 36.9408139233, 39.7361029915, 20.7861493445, 640.16329814, 62.0047693719, 56.3946074267 }}, /* 2878 K */
+    {{ 36.9415546006, 39.7381360495, 20.7861493452, 640.195673778, 62.0060591129, 56.3982937764 }}, /* 2879 K */
+    {{ 36.9422947414, 39.7401686213, 20.7861493459, 640.22801491, 62.0073480262, 56.4019773795 }}, /* 2880 K */
+    {{ 36.9430343464, 39.7422007068, 20.7861493467, 640.260321568, 62.0086361134, 56.4056582384 }}, /* 2881 K */
+    {{ 36.9437734165, 39.7442323059, 20.7861493474, 640.292593789, 62.009923376, 56.4093363559 }}, /* 2882 K */
+    {{ 36.9445119521, 39.7462634184, 20.7861493481, 640.324831605, 62.0112098153, 56.4130117346 }}, /* 2883 K */
+    {{ 36.945249954, 39.7482940443, 20.7861493488, 640.357035051, 62.0124954329, 56.4166843771 }}, /* 2884 K */
+    {{ 36.9459874229, 39.7503241836, 20.7861493496, 640.389204162, 62.0137802301, 56.4203542861 }}, /* 2885 K */
+    {{ 36.9467243595, 39.7523538359, 20.7861493503, 640.421338972, 62.0150642084, 56.4240214641 }}, /* 2886 K */
+    {{ 36.9474607644, 39.7543830014, 20.786149351, 640.453439515, 62.0163473692, 56.4276859139 }}, /* 2887 K */
+    {{ 36.9481966383, 39.7564116799, 20.7861493518, 640.485505826, 62.017629714, 56.431347638 }}, /* 2888 K */
+    {{ 36.9489319819, 39.7584398712, 20.7861493525, 640.517537937, 62.0189112442, 56.435006639 }}, /* 2889 K */
+    {{ 36.9496667959, 39.7604675753, 20.7861493532, 640.549535884, 62.0201919613, 56.4386629197 }}, /* 2890 K */
+    {{ 36.9504010809, 39.7624947921, 20.786149354, 640.581499701, 62.0214718667, 56.4423164826 }}, /* 2891 K */
+    {{ 36.9511348376, 39.7645215215, 20.7861493547, 640.613429421, 62.0227509617, 56.4459673303 }}, /* 2892 K */
+    {{ 36.9518680667, 39.7665477634, 20.7861493554, 640.64532508, 62.0240292479, 56.4496154654 }}, /* 2893 K */
+    {{ 36.9526007688, 39.7685735177, 20.7861493562, 640.677186709, 62.0253067267, 56.4532608906 }}, /* 2894 K */
+    {{ 36.9533329446, 39.7705987843, 20.7861493569, 640.709014345, 62.0265833995, 56.4569036085 }}, /* 2895 K */
+    {{ 36.9540645948, 39.7726235631, 20.7861493577, 640.74080802, 62.0278592677, 56.4605436217 }}, /* 2896 K */
+    {{ 36.9547957201, 39.774647854, 20.7861493584, 640.772567769, 62.0291343327, 56.4641809329 }}, /* 2897 K */
+    {{ 36.9555263211, 39.7766716569, 20.7861493591, 640.804293625, 62.0304085961, 56.4678155445 }}, /* 2898 K */
+    {{ 36.9562563984, 39.7786949717, 20.7861493599, 640.835985622, 62.0316820591, 56.4714474593 }}, /* 2899 K */
+    {{ 36.9569859528, 39.7807177984, 20.7861493606, 640.867643794, 62.0329547232, 56.4750766798 }}, /* 2900 K */
+    {{ 36.9577149849, 39.7827401368, 20.7861493614, 640.899268176, 62.0342265899, 56.4787032087 }}, /* 2901 K */
+    {{ 36.9584434953, 39.7847619868, 20.7861493621, 640.930858799, 62.0354976605, 56.4823270485 }}, /* 2902 K */
+    {{ 36.9591714848, 39.7867833484, 20.7861493629, 640.9624157, 62.0367679365, 56.4859482019 }}, /* 2903 K */
+    {{ 36.959898954, 39.7888042215, 20.7861493636, 640.99393891, 62.0380374193, 56.4895666715 }}, /* 2904 K */
+    {{ 36.9606259035, 39.7908246059, 20.7861493644, 641.025428464, 62.0393061103, 56.4931824598 }}, /* 2905 K */
+    {{ 36.961352334, 39.7928445016, 20.7861493651, 641.056884395, 62.0405740109, 56.4967955695 }}, /* 2906 K */
+    {{ 36.9620782462, 39.7948639084, 20.7861493659, 641.088306738, 62.0418411225, 56.5004060031 }}, /* 2907 K */
+    {{ 36.9628036407, 39.7968828264, 20.7861493666, 641.119695525, 62.0431074466, 56.5040137633 }}, /* 2908 K */
+    {{ 36.9635285182, 39.7989012553, 20.7861493674, 641.15105079, 62.0443729844, 56.5076188526 }}, /* 2909 K */
+    {{ 36.9642528793, 39.8009191952, 20.7861493682, 641.182372566, 62.0456377376, 56.5112212737 }}, /* 2910 K */
+    {{ 36.9649767247, 39.8029366459, 20.7861493689, 641.213660888, 62.0469017073, 56.5148210291 }}, /* 2911 K */
+    {{ 36.965700055, 39.8049536073, 20.7861493697, 641.244915788, 62.0481648952, 56.5184181214 }}, /* 2912 K */
+    {{ 36.9664228709, 39.8069700793, 20.7861493704, 641.276137301, 62.0494273025, 56.5220125533 }}, /* 2913 K */
+    {{ 36.967145173, 39.8089860619, 20.7861493712, 641.307325458, 62.0506889306, 56.5256043272 }}, /* 2914 K */
+    {{ 36.967866962, 39.8110015549, 20.786149372, 641.338480295, 62.051949781, 56.5291934458 }}, /* 2915 K */
+    {{ 36.9685882385, 39.8130165583, 20.7861493727, 641.369601843, 62.0532098551, 56.5327799117 }}, /* 2916 K */
+    {{ 36.9693090032, 39.815031072, 20.7861493735, 641.400690137, 62.0544691542, 56.5363637274 }}, /* 2917 K */
+    {{ 36.9700292567, 39.817045096, 20.7861493742, 641.43174521, 62.0557276797, 56.5399448956 }}, /* 2918 K */
+    {{ 36.9707489997, 39.81905863, 20.786149375, 641.462767094, 62.0569854331, 56.5435234187 }}, /* 2919 K */
+    {{ 36.9714682329, 39.821071674, 20.7861493758, 641.493755824, 62.0582424158, 56.5470992994 }}, /* 2920 K */
+    {{ 36.9721869567, 39.823084228, 20.7861493765, 641.524711432, 62.059498629, 56.5506725403 }}, /* 2921 K */
+    {{ 36.972905172, 39.8250962918, 20.7861493773, 641.555633952, 62.0607540743, 56.5542431439 }}, /* 2922 K */
+    {{ 36.9736228793, 39.8271078654, 20.7861493781, 641.586523416, 62.062008753, 56.5578111129 }}, /* 2923 K */
+    {{ 36.9743400793, 39.8291189487, 20.7861493788, 641.617379858, 62.0632626664, 56.5613764497 }}, /* 2924 K */
+    {{ 36.9750567726, 39.8311295416, 20.7861493796, 641.648203311, 62.0645158161, 56.5649391569 }}, /* 2925 K */
+    {{ 36.9757729599, 39.833139644, 20.7861493804, 641.678993807, 62.0657682033, 56.5684992371 }}, /* 2926 K */
+    {{ 36.9764886418, 39.8351492558, 20.7861493812, 641.709751381, 62.0670198294, 56.572056693 }}, /* 2927 K */
+    {{ 36.9772038189, 39.8371583769, 20.7861493819, 641.740476064, 62.0682706959, 56.5756115269 }}, /* 2928 K */
+    {{ 36.9779184918, 39.8391670073, 20.7861493827, 641.77116789, 62.0695208041, 56.5791637416 }}, /* 2929 K */
+    {{ 36.9786326613, 39.8411751469, 20.7861493835, 641.801826892, 62.0707701554, 56.5827133395 }}, /* 2930 K */
+    {{ 36.979346328, 39.8431827956, 20.7861493843, 641.832453102, 62.0720187511, 56.5862603233 }}, /* 2931 K */
+    {{ 36.9800594923, 39.8451899534, 20.786149385, 641.863046554, 62.0732665927, 56.5898046954 }}, /* 2932 K */
+    {{ 36.9807721552, 39.84719662, 20.7861493858, 641.89360728, 62.0745136815, 56.5933464585 }}, /* 2933 K */
+    {{ 36.981484317, 39.8492027955, 20.7861493866, 641.924135313, 62.0757600189, 56.596885615 }}, /* 2934 K */
+    {{ 36.9821959785, 39.8512084798, 20.7861493874, 641.954630687, 62.0770056062, 56.6004221677 }}, /* 2935 K */
+    {{ 36.9829071403, 39.8532136727, 20.7861493882, 641.985093432, 62.0782504449, 56.6039561189 }}, /* 2936 K */
+    {{ 36.983617803, 39.8552183743, 20.7861493889, 642.015523584, 62.0794945362, 56.6074874712 }}, /* 2937 K */
+    {{ 36.9843279673, 39.8572225843, 20.7861493897, 642.045921173, 62.0807378817, 56.6110162273 }}, /* 2938 K */
+    {{ 36.9850376338, 39.8592263029, 20.7861493905, 642.076286233, 62.0819804826, 56.6145423896 }}, /* 2939 K */
+    {{ 36.9857468031, 39.8612295298, 20.7861493913, 642.106618796, 62.0832223403, 56.6180659607 }}, /* 2940 K */
+    {{ 36.9864554758, 39.863232265, 20.7861493921, 642.136918895, 62.0844634561, 56.6215869432 }}, /* 2941 K */
+    {{ 36.9871636525, 39.8652345084, 20.7861493929, 642.167186563, 62.0857038315, 56.6251053395 }}, /* 2942 K */
+    {{ 36.987871334, 39.8672362599, 20.7861493937, 642.197421832, 62.0869434678, 56.6286211522 }}, /* 2943 K */
+    {{ 36.9885785207, 39.8692375195, 20.7861493944, 642.227624735, 62.0881823664, 56.6321343839 }}, /* 2944 K */
+    {{ 36.9892852134, 39.8712382871, 20.7861493952, 642.257795303, 62.0894205285, 56.6356450371 }}, /* 2945 K */
+    {{ 36.9899914126, 39.8732385626, 20.786149396, 642.28793357, 62.0906579556, 56.6391531143 }}, /* 2946 K */
+    {{ 36.9906971189, 39.8752383459, 20.7861493968, 642.318039568, 62.0918946491, 56.6426586181 }}, /* 2947 K */
+    {{ 36.9914023331, 39.8772376369, 20.7861493976, 642.348113329, 62.0931306102, 56.646161551 }}, /* 2948 K */
+    {{ 36.9921070556, 39.8792364357, 20.7861493984, 642.378154886, 62.0943658404, 56.6496619156 }}, /* 2949 K */
+    {{ 36.9928112871, 39.881234742, 20.7861493992, 642.408164271, 62.095600341, 56.6531597143 }}, /* 2950 K */
+    {{ 36.9935150283, 39.8832325558, 20.7861494, 642.438141517, 62.0968341133, 56.6566549497 }}, /* 2951 K */
+    {{ 36.9942182798, 39.8852298771, 20.7861494008, 642.468086655, 62.0980671587, 56.6601476243 }}, /* 2952 K */
+    {{ 36.994921042, 39.8872267058, 20.7861494016, 642.497999718, 62.0992994785, 56.6636377406 }}, /* 2953 K */
+    {{ 36.9956233158, 39.8892230417, 20.7861494024, 642.527880738, 62.1005310742, 56.6671253012 }}, /* 2954 K */
+    {{ 36.9963251016, 39.8912188849, 20.7861494032, 642.557729748, 62.1017619469, 56.6706103087 }}, /* 2955 K */
+    {{ 36.9970264002, 39.8932142352, 20.786149404, 642.587546779, 62.1029920982, 56.6740927654 }}, /* 2956 K */
+    {{ 36.997727212, 39.8952090926, 20.7861494048, 642.617331863, 62.1042215292, 56.6775726739 }}, /* 2957 K */
+    {{ 36.9984275378, 39.897203457, 20.7861494056, 642.647085034, 62.1054502415, 56.6810500369 }}, /* 2958 K */
+    {{ 36.9991273781, 39.8991973284, 20.7861494064, 642.676806322, 62.1066782362, 56.6845248566 }}, /* 2959 K */
+    {{ 36.9998267335, 39.9011907066, 20.7861494072, 642.70649576, 62.1079055148, 56.6879971358 }}, /* 2960 K */
+    {{ 37.0005256047, 39.9031835916, 20.786149408, 642.73615338, 62.1091320786, 56.6914668768 }}, /* 2961 K */
+    {{ 37.0012239922, 39.9051759833, 20.7861494088, 642.765779214, 62.1103579289, 56.6949340823 }}, /* 2962 K */
+    {{ 37.0019218966, 39.9071678816, 20.7861494096, 642.795373294, 62.1115830671, 56.6983987547 }}, /* 2963 K */
+    {{ 37.0026193186, 39.9091592865, 20.7861494104, 642.824935652, 62.1128074944, 56.7018608965 }}, /* 2964 K */
+    {{ 37.0033162588, 39.911150198, 20.7861494112, 642.854466319, 62.1140312123, 56.7053205102 }}, /* 2965 K */
+    {{ 37.0040127177, 39.9131406158, 20.786149412, 642.883965328, 62.115254222, 56.7087775984 }}, /* 2966 K */
+    {{ 37.004708696, 39.9151305401, 20.7861494128, 642.913432711, 62.116476525, 56.7122321635 }}, /* 2967 K */
+    {{ 37.0054041943, 39.9171199706, 20.7861494136, 642.942868499, 62.1176981224, 56.715684208 }}, /* 2968 K */
+    {{ 37.0060992131, 39.9191089074, 20.7861494144, 642.972272724, 62.1189190157, 56.7191337345 }}, /* 2969 K */
+    {{ 37.0067937531, 39.9210973503, 20.7861494152, 643.001645418, 62.1201392062, 56.7225807455 }}, /* 2970 K */
+    {{ 37.0074878148, 39.9230852993, 20.786149416, 643.030986612, 62.1213586952, 56.7260252434 }}, /* 2971 K */
+    {{ 37.008181399, 39.9250727543, 20.7861494168, 643.060296339, 62.122577484, 56.7294672307 }}, /* 2972 K */
+    {{ 37.008874506, 39.9270597153, 20.7861494176, 643.08957463, 62.123795574, 56.7329067099 }}, /* 2973 K */
+    {{ 37.0095671366, 39.9290461821, 20.7861494184, 643.118821516, 62.1250129664, 56.7363436836 }}, /* 2974 K */
+    {{ 37.0102592914, 39.9310321548, 20.7861494193, 643.14803703, 62.1262296627, 56.7397781542 }}, /* 2975 K */
+    {{ 37.0109509709, 39.9330176333, 20.7861494201, 643.177221203, 62.127445664, 56.7432101242 }}, /* 2976 K */
+    {{ 37.0116421757, 39.9350026174, 20.7861494209, 643.206374066, 62.1286609718, 56.7466395961 }}, /* 2977 K */
+    {{ 37.0123329064, 39.9369871071, 20.7861494217, 643.235495651, 62.1298755873, 56.7500665724 }}, /* 2978 K */
+    {{ 37.0130231637, 39.9389711025, 20.7861494225, 643.26458599, 62.1310895119, 56.7534910555 }}, /* 2979 K */
+    {{ 37.0137129481, 39.9409546033, 20.7861494233, 643.293645114, 62.1323027469, 56.756913048 }}, /* 2980 K */
+    {{ 37.0144022601, 39.9429376095, 20.7861494241, 643.322673054, 62.1335152936, 56.7603325523 }}, /* 2981 K */
+    {{ 37.0150911005, 39.9449201211, 20.786149425, 643.351669843, 62.1347271533, 56.763749571 }}, /* 2982 K */
+    {{ 37.0157794697, 39.946902138, 20.7861494258, 643.38063551, 62.1359383273, 56.7671641064 }}, /* 2983 K */
+    {{ 37.0164673684, 39.9488836601, 20.7861494266, 643.409570088, 62.1371488169, 56.7705761611 }}, /* 2984 K */
+    {{ 37.0171547971, 39.9508646874, 20.7861494274, 643.438473609, 62.1383586235, 56.7739857376 }}, /* 2985 K */
+    {{ 37.0178417565, 39.9528452198, 20.7861494282, 643.467346103, 62.1395677483, 56.7773928383 }}, /* 2986 K */
+    {{ 37.018528247, 39.9548252573, 20.786149429, 643.496187601, 62.1407761927, 56.7807974656 }}, /* 2987 K */
+    {{ 37.0192142694, 39.9568047997, 20.7861494299, 643.524998136, 62.1419839579, 56.7841996222 }}, /* 2988 K */
+    {{ 37.0198998242, 39.9587838471, 20.7861494307, 643.553777737, 62.1431910453, 56.7875993104 }}, /* 2989 K */
+    {{ 37.0205849119, 39.9607623993, 20.7861494315, 643.582526437, 62.1443974561, 56.7909965327 }}, /* 2990 K */
+    {{ 37.0212695332, 39.9627404563, 20.7861494323, 643.611244267, 62.1456031918, 56.7943912915 }}, /* 2991 K */
+    {{ 37.0219536885, 39.9647180181, 20.7861494331, 643.639931257, 62.1468082535, 56.7977835894 }}, /* 2992 K */
+    {{ 37.0226373786, 39.9666950845, 20.786149434, 643.668587439, 62.1480126425, 56.8011734288 }}, /* 2993 K */
+    {{ 37.023320604, 39.9686716556, 20.7861494348, 643.697212844, 62.1492163602, 56.8045608122 }}, /* 2994 K */
+    {{ 37.0240033652, 39.9706477312, 20.7861494356, 643.725807504, 62.1504194079, 56.807945742 }}, /* 2995 K */
+    {{ 37.0246856629, 39.9726233113, 20.7861494364, 643.754371448, 62.1516217868, 56.8113282207 }}, /* 2996 K */
+    {{ 37.0253674976, 39.9745983959, 20.7861494373, 643.782904708, 62.1528234983, 56.8147082507 }}, /* 2997 K */
+    {{ 37.0260488699, 39.9765729848, 20.7861494381, 643.811407316, 62.1540245436, 56.8180858345 }}, /* 2998 K */
+    {{ 37.0267297803, 39.9785470781, 20.7861494389, 643.839879301, 62.1552249241, 56.8214609746 }}, /* 2999 K */
+    {{ 37.0274102295, 39.9805206756, 20.7861494397, 643.868320696, 62.156424641, 56.8248336734 }}, /* 3000 K */
+    {{ 37.028090218, 39.9824937774, 20.7861494406, 643.89673153, 62.1576236956, 56.8282039333 }}, /* 3001 K */
+    {{ 37.0287697464, 39.9844663833, 20.7861494414, 643.925111836, 62.1588220892, 56.8315717569 }}, /* 3002 K */
+    {{ 37.0294488152, 39.9864384932, 20.7861494422, 643.953461642, 62.1600198231, 56.8349371465 }}, /* 3003 K */
+    {{ 37.0301274251, 39.9884101073, 20.786149443, 643.981780982, 62.1612168986, 56.8383001046 }}, /* 3004 K */
+    {{ 37.0308055765, 39.9903812252, 20.7861494439, 644.010069884, 62.1624133169, 56.8416606337 }}, /* 3005 K */
+    {{ 37.0314832701, 39.9923518472, 20.7861494447, 644.038328381, 62.1636090794, 56.8450187362 }}, /* 3006 K */
+    {{ 37.0321605065, 39.9943219729, 20.7861494455, 644.066556503, 62.1648041873, 56.8483744145 }}, /* 3007 K */
+    {{ 37.0328372861, 39.9962916025, 20.7861494464, 644.094754279, 62.1659986419, 56.8517276711 }}, /* 3008 K */
+    {{ 37.0335136096, 39.9982607359, 20.7861494472, 644.122921743, 62.1671924445, 56.8550785084 }}, /* 3009 K */
+    {{ 37.0341894775, 40.0002293729, 20.786149448, 644.151058922, 62.1683855964, 56.8584269288 }}, /* 3010 K */
+    {{ 37.0348648905, 40.0021975137, 20.7861494489, 644.17916585, 62.1695780988, 56.8617729349 }}, /* 3011 K */
+    {{ 37.0355398489, 40.0041651579, 20.7861494497, 644.207242555, 62.1707699531, 56.8651165289 }}, /* 3012 K */
+    {{ 37.0362143536, 40.0061323058, 20.7861494505, 644.23528907, 62.1719611604, 56.8684577135 }}, /* 3013 K */
+    {{ 37.0368884048, 40.0080989571, 20.7861494514, 644.263305423, 62.1731517222, 56.8717964909 }}, /* 3014 K */
+    {{ 37.0375620034, 40.0100651119, 20.7861494522, 644.291291646, 62.1743416396, 56.8751328637 }}, /* 3015 K */
+    {{ 37.0382351497, 40.01203077, 20.786149453, 644.31924777, 62.1755309138, 56.8784668342 }}, /* 3016 K */
+    {{ 37.0389078444, 40.0139959315, 20.7861494539, 644.347173824, 62.1767195463, 56.8817984049 }}, /* 3017 K */
+    {{ 37.0395800881, 40.0159605962, 20.7861494547, 644.375069839, 62.1779075383, 56.8851275782 }}, /* 3018 K */
+    {{ 37.0402518812, 40.0179247642, 20.7861494555, 644.402935846, 62.179094891, 56.8884543565 }}, /* 3019 K */
+    {{ 37.0409232243, 40.0198884353, 20.7861494564, 644.430771875, 62.1802816056, 56.8917787423 }}, /* 3020 K */
+    {{ 37.0415941181, 40.0218516096, 20.7861494572, 644.458577956, 62.1814676836, 56.8951007379 }}, /* 3021 K */
+    {{ 37.042264563, 40.0238142869, 20.786149458, 644.48635412, 62.182653126, 56.8984203459 }}, /* 3022 K */
+    {{ 37.0429345596, 40.0257764673, 20.7861494589, 644.514100397, 62.1838379343, 56.9017375685 }}, /* 3023 K */
+    {{ 37.0436041085, 40.0277381506, 20.7861494597, 644.541816818, 62.1850221096, 56.9050524083 }}, /* 3024 K */
+    {{ 37.0442732102, 40.0296993369, 20.7861494605, 644.569503411, 62.1862056533, 56.9083648676 }}, /* 3025 K */
+    {{ 37.0449418652, 40.031660026, 20.7861494614, 644.597160209, 62.1873885665, 56.9116749489 }}, /* 3026 K */
+    {{ 37.0456100742, 40.0336202179, 20.7861494622, 644.624787241, 62.1885708505, 56.9149826546 }}, /* 3027 K */
+    {{ 37.0462778377, 40.0355799127, 20.7861494631, 644.652384536, 62.1897525067, 56.918287987 }}, /* 3028 K */
+    {{ 37.0469451561, 40.0375391101, 20.7861494639, 644.679952126, 62.1909335362, 56.9215909486 }}, /* 3029 K */
+    {{ 37.0476120302, 40.0394978102, 20.7861494647, 644.707490041, 62.1921139403, 56.9248915419 }}, /* 3030 K */
+    {{ 37.0482784604, 40.041456013, 20.7861494656, 644.73499831, 62.1932937203, 56.9281897691 }}, /* 3031 K */
+    {{ 37.0489444472, 40.0434137183, 20.7861494664, 644.762476963, 62.1944728774, 56.9314856327 }}, /* 3032 K */
+    {{ 37.0496099913, 40.0453709262, 20.7861494673, 644.789926032, 62.1956514128, 56.9347791352 }}, /* 3033 K */
+    {{ 37.0502750931, 40.0473276366, 20.7861494681, 644.817345545, 62.1968293279, 56.9380702788 }}, /* 3034 K */
+    {{ 37.0509397532, 40.0492838494, 20.7861494689, 644.844735532, 62.1980066239, 56.9413590661 }}, /* 3035 K */
+    {{ 37.0516039722, 40.0512395646, 20.7861494698, 644.872096024, 62.199183302, 56.9446454994 }}, /* 3036 K */
+    {{ 37.0522677506, 40.0531947822, 20.7861494706, 644.899427051, 62.2003593634, 56.9479295811 }}, /* 3037 K */
+    {{ 37.0529310889, 40.055149502, 20.7861494715, 644.926728642, 62.2015348095, 56.9512113136 }}, /* 3038 K */
+    {{ 37.0535939877, 40.0571037242, 20.7861494723, 644.954000828, 62.2027096415, 56.9544906993 }}, /* 3039 K */
+    {{ 37.0542564475, 40.0590574485, 20.7861494731, 644.981243638, 62.2038838606, 56.9577677406 }}, /* 3040 K */
+    {{ 37.0549184689, 40.061010675, 20.786149474, 645.008457102, 62.205057468, 56.9610424398 }}, /* 3041 K */
+    {{ 37.0555800524, 40.0629634037, 20.7861494748, 645.03564125, 62.206230465, 56.9643147995 }}, /* 3042 K */
+    {{ 37.0562411985, 40.0649156344, 20.7861494757, 645.062796111, 62.2074028529, 56.9675848219 }}, /* 3043 K */
+    {{ 37.0569019079, 40.0668673672, 20.7861494765, 645.089921716, 62.2085746328, 56.9708525094 }}, /* 3044 K */
+    {{ 37.0575621809, 40.0688186019, 20.7861494774, 645.117018094, 62.2097458061, 56.9741178645 }}, /* 3045 K */
+    {{ 37.0582220182, 40.0707693386, 20.7861494782, 645.144085274, 62.2109163739, 56.9773808895 }}, /* 3046 K */
+    {{ 37.0588814203, 40.0727195773, 20.786149479, 645.171123288, 62.2120863375, 56.9806415868 }}, /* 3047 K */
+    {{ 37.0595403878, 40.0746693178, 20.7861494799, 645.198132163, 62.2132556982, 56.9838999587 }}, /* 3048 K */
+    {{ 37.0601989211, 40.0766185601, 20.7861494807, 645.22511193, 62.2144244571, 56.9871560078 }}, /* 3049 K */
+    {{ 37.0608570208, 40.0785673042, 20.7861494816, 645.252062619, 62.2155926155, 56.9904097362 }}, /* 3050 K */
+    {{ 37.0615146875, 40.0805155501, 20.7861494824, 645.278984258, 62.2167601747, 56.9936611465 }}, /* 3051 K */
+    {{ 37.0621719216, 40.0824632977, 20.7861494833, 645.305876878, 62.2179271358, 56.9969102409 }}, /* 3052 K */
+    {{ 37.0628287237, 40.0844105469, 20.7861494841, 645.332740508, 62.2190935001, 57.0001570219 }}, /* 3053 K */
+    {{ 37.0634850944, 40.0863572977, 20.786149485, 645.359575178, 62.2202592689, 57.0034014918 }}, /* 3054 K */
+    {{ 37.0641410341, 40.0883035502, 20.7861494858, 645.386380916, 62.2214244433, 57.0066436531 }}, /* 3055 K */
+    {{ 37.0647965434, 40.0902493042, 20.7861494866, 645.413157753, 62.2225890246, 57.009883508 }}, /* 3056 K */
+    {{ 37.0654516228, 40.0921945597, 20.7861494875, 645.439905718, 62.223753014, 57.0131210589 }}, /* 3057 K */
+    {{ 37.0661062729, 40.0941393166, 20.7861494883, 645.46662484, 62.2249164127, 57.0163563082 }}, /* 3058 K */
+    {{ 37.0667604941, 40.096083575, 20.7861494892, 645.493315148, 62.2260792221, 57.0195892583 }}, /* 3059 K */
+    {{ 37.0674142871, 40.0980273348, 20.78614949, 645.519976673, 62.2272414432, 57.0228199115 }}, /* 3060 K */
+    {{ 37.0680676523, 40.0999705959, 20.7861494909, 645.546609442, 62.2284030773, 57.0260482702 }}, /* 3061 K */
+    {{ 37.0687205902, 40.1019133583, 20.7861494917, 645.573213486, 62.2295641256, 57.0292743368 }}, /* 3062 K */
+    {{ 37.0693731014, 40.1038556221, 20.7861494926, 645.599788834, 62.2307245894, 57.0324981135 }}, /* 3063 K */
+    {{ 37.0700251864, 40.105797387, 20.7861494934, 645.626335515, 62.2318844698, 57.0357196028 }}, /* 3064 K */
+    {{ 37.0706768458, 40.1077386532, 20.7861494943, 645.652853558, 62.2330437682, 57.038938807 }}, /* 3065 K */
+    {{ 37.07132808, 40.1096794205, 20.7861494951, 645.679342993, 62.2342024856, 57.0421557285 }}, /* 3066 K */
+    {{ 37.0719788895, 40.111619689, 20.786149496, 645.705803848, 62.2353606234, 57.0453703696 }}, /* 3067 K */
+    {{ 37.072629275, 40.1135594585, 20.7861494968, 645.732236152, 62.2365181827, 57.0485827327 }}, /* 3068 K */
+    {{ 37.0732792369, 40.1154987291, 20.7861494977, 645.758639936, 62.2376751648, 57.0517928201 }}, /* 3069 K */
+    {{ 37.0739287757, 40.1174375008, 20.7861494985, 645.785015227, 62.2388315708, 57.0550006342 }}, /* 3070 K */
+    {{ 37.0745778919, 40.1193757734, 20.7861494994, 645.811362055, 62.239987402, 57.0582061773 }}, /* 3071 K */
+    {{ 37.0752265861, 40.121313547, 20.7861495002, 645.837680449, 62.2411426596, 57.0614094517 }}, /* 3072 K */
+    {{ 37.0758748588, 40.1232508215, 20.7861495011, 645.863970438, 62.2422973447, 57.0646104599 }}, /* 3073 K */
+    {{ 37.0765227105, 40.1251875969, 20.7861495019, 645.890232051, 62.2434514587, 57.067809204 }}, /* 3074 K */
+    {{ 37.0771701417, 40.1271238731, 20.7861495027, 645.916465317, 62.2446050027, 57.0710056866 }}, /* 3075 K */
+    {{ 37.077817153, 40.1290596502, 20.7861495036, 645.942670265, 62.2457579779, 57.0741999099 }}, /* 3076 K */
+    {{ 37.0784637448, 40.130994928, 20.7861495044, 645.968846923, 62.2469103855, 57.0773918762 }}, /* 3077 K */
+    {{ 37.0791099176, 40.1329297067, 20.7861495053, 645.994995321, 62.2480622268, 57.080581588 }}, /* 3078 K */
+    {{ 37.0797556721, 40.134863986, 20.7861495061, 646.021115488, 62.2492135029, 57.0837690474 }}, /* 3079 K */
+    {{ 37.0804010086, 40.136797766, 20.786149507, 646.047207451, 62.250364215, 57.086954257 }}, /* 3080 K */
+    {{ 37.0810459277, 40.1387310467, 20.7861495078, 646.073271241, 62.2515143644, 57.0901372189 }}, /* 3081 K */
+    {{ 37.0816904299, 40.140663828, 20.7861495087, 646.099306885, 62.2526639522, 57.0933179355 }}, /* 3082 K */
+    {{ 37.0823345158, 40.1425961099, 20.7861495095, 646.125314413, 62.2538129797, 57.0964964092 }}, /* 3083 K */
+    {{ 37.0829781857, 40.1445278924, 20.7861495104, 646.151293854, 62.2549614479, 57.0996726423 }}, /* 3084 K */
+    {{ 37.0836214403, 40.1464591754, 20.7861495112, 646.177245235, 62.2561093582, 57.102846637 }}, /* 3085 K */
+    {{ 37.0842642801, 40.1483899589, 20.7861495121, 646.203168586, 62.2572567118, 57.1060183958 }}, /* 3086 K */
+    {{ 37.0849067055, 40.1503202429, 20.7861495129, 646.229063935, 62.2584035098, 57.109187921 }}, /* 3087 K */
+    {{ 37.085548717, 40.1522500273, 20.7861495138, 646.254931311, 62.2595497533, 57.1123552148 }}, /* 3088 K */
+    {{ 37.0861903152, 40.1541793122, 20.7861495146, 646.280770743, 62.2606954437, 57.1155202795 }}, /* 3089 K */
+    {{ 37.0868315006, 40.1561080974, 20.7861495155, 646.306582259, 62.2618405821, 57.1186831176 }}, /* 3090 K */
+    {{ 37.0874722737, 40.158036383, 20.7861495163, 646.332365887, 62.2629851698, 57.1218437313 }}, /* 3091 K */
+    {{ 37.0881126349, 40.1599641689, 20.7861495172, 646.358121657, 62.2641292077, 57.125002123 }}, /* 3092 K */
+    {{ 37.0887525848, 40.1618914552, 20.786149518, 646.383849596, 62.2652726973, 57.1281582949 }}, /* 3093 K */
+    {{ 37.0893921239, 40.1638182417, 20.7861495189, 646.409549733, 62.2664156396, 57.1313122493 }}, /* 3094 K */
+    {{ 37.0900312527, 40.1657445284, 20.7861495197, 646.435222097, 62.2675580359, 57.1344639886 }}, /* 3095 K */
+    {{ 37.0906699717, 40.1676703154, 20.7861495206, 646.460866716, 62.2686998873, 57.1376135151 }}, /* 3096 K */
+    {{ 37.0913082813, 40.1695956026, 20.7861495214, 646.486483618, 62.2698411951, 57.1407608311 }}, /* 3097 K */
+    {{ 37.0919461822, 40.1715203899, 20.7861495223, 646.512072832, 62.2709819604, 57.1439059389 }}, /* 3098 K */
+    {{ 37.0925836747, 40.1734446774, 20.7861495231, 646.537634387, 62.2721221843, 57.1470488408 }}, /* 3099 K */
+    {{ 37.0932207594, 40.175368465, 20.786149524, 646.563168309, 62.2732618681, 57.1501895391 }}, /* 3100 K */
+    {{ 37.0938574368, 40.1772917527, 20.7861495248, 646.588674628, 62.274401013, 57.153328036 }}, /* 3101 K */
+    {{ 37.0944937073, 40.1792145405, 20.7861495257, 646.614153373, 62.2755396201, 57.156464334 }}, /* 3102 K */
+    {{ 37.0951295715, 40.1811368283, 20.7861495265, 646.63960457, 62.2766776907, 57.1595984353 }}, /* 3103 K */
+    {{ 37.0957650299, 40.1830586161, 20.7861495274, 646.665028249, 62.2778152258, 57.1627303421 }}, /* 3104 K */
+    {{ 37.096400083, 40.1849799039, 20.7861495282, 646.690424438, 62.2789522267, 57.1658600569 }}, /* 3105 K */
+    {{ 37.0970347312, 40.1869006917, 20.7861495291, 646.715793164, 62.2800886945, 57.1689875818 }}, /* 3106 K */
+    {{ 37.0976689751, 40.1888209794, 20.7861495299, 646.741134456, 62.2812246305, 57.1721129193 }}, /* 3107 K */
+    {{ 37.0983028151, 40.1907407671, 20.7861495308, 646.766448343, 62.2823600358, 57.1752360714 }}, /* 3108 K */
+    {{ 37.0989362517, 40.1926600546, 20.7861495316, 646.791734851, 62.2834949115, 57.1783570407 }}, /* 3109 K */
+    {{ 37.0995692855, 40.194578842, 20.7861495325, 646.81699401, 62.2846292589, 57.1814758293 }}, /* 3110 K */
+    {{ 37.1002019169, 40.1964971293, 20.7861495333, 646.842225847, 62.2857630791, 57.1845924395 }}, /* 3111 K */
+    {{ 37.1008341464, 40.1984149164, 20.7861495342, 646.867430391, 62.2868963733, 57.1877068736 }}, /* 3112 K */
+    {{ 37.1014659745, 40.2003322033, 20.786149535, 646.892607669, 62.2880291427, 57.190819134 }}, /* 3113 K */
+    {{ 37.1020974016, 40.20224899, 20.7861495358, 646.917757709, 62.2891613884, 57.1939292228 }}, /* 3114 K */
+    {{ 37.1027284284, 40.2041652765, 20.7861495367, 646.942880539, 62.2902931115, 57.1970371424 }}, /* 3115 K */
+    {{ 37.1033590552, 40.2060810627, 20.7861495375, 646.967976188, 62.2914243134, 57.200142895 }}, /* 3116 K */
+    {{ 37.1039892825, 40.2079963486, 20.7861495384, 646.993044682, 62.292554995, 57.203246483 }}, /* 3117 K */
+    {{ 37.1046191109, 40.2099111343, 20.7861495392, 647.018086051, 62.2936851577, 57.2063479085 }}, /* 3118 K */
+    {{ 37.1052485408, 40.2118254196, 20.7861495401, 647.043100321, 62.2948148025, 57.209447174 }}, /* 3119 K */
+    {{ 37.1058775727, 40.2137392046, 20.7861495409, 647.068087521, 62.2959439306, 57.2125442815 }}, /* 3120 K */
+    {{ 37.1065062071, 40.2156524892, 20.7861495418, 647.093047678, 62.2970725432, 57.2156392335 }}, /* 3121 K */
+    {{ 37.1071344445, 40.2175652735, 20.7861495426, 647.117980821, 62.2982006415, 57.2187320322 }}, /* 3122 K */
+    {{ 37.1077622853, 40.2194775573, 20.7861495435, 647.142886977, 62.2993282265, 57.2218226798 }}, /* 3123 K */
+    {{ 37.10838973, 40.2213893408, 20.7861495443, 647.167766173, 62.3004552996, 57.2249111787 }}, /* 3124 K */
+    {{ 37.1090167792, 40.2233006238, 20.7861495452, 647.192618437, 62.3015818617, 57.227997531 }}, /* 3125 K */
+    {{ 37.1096434333, 40.2252114064, 20.786149546, 647.217443798, 62.3027079141, 57.2310817391 }}, /* 3126 K */
+    {{ 37.1102696927, 40.2271216885, 20.7861495468, 647.242242282, 62.3038334579, 57.2341638052 }}, /* 3127 K */
+    {{ 37.110895558, 40.2290314701, 20.7861495477, 647.267013918, 62.3049584944, 57.2372437316 }}, /* 3128 K */
+    {{ 37.1115210296, 40.2309407512, 20.7861495485, 647.291758733, 62.3060830245, 57.2403215206 }}, /* 3129 K */
+    {{ 37.1121461081, 40.2328495318, 20.7861495494, 647.316476754, 62.3072070496, 57.2433971743 }}, /* 3130 K */
+    {{ 37.1127707938, 40.2347578119, 20.7861495502, 647.341168009, 62.3083305707, 57.2464706951 }}, /* 3131 K */
+    {{ 37.1133950873, 40.2366655914, 20.7861495511, 647.365832526, 62.3094535891, 57.2495420852 }}, /* 3132 K */
+    {{ 37.114018989, 40.2385728703, 20.7861495519, 647.390470333, 62.3105761057, 57.2526113469 }}, /* 3133 K */
+    {{ 37.1146424995, 40.2404796487, 20.7861495528, 647.415081455, 62.3116981219, 57.2556784823 }}, /* 3134 K */
+    {{ 37.1152656192, 40.2423859265, 20.7861495536, 647.439665922, 62.3128196387, 57.2587434939 }}, /* 3135 K */
+    {{ 37.1158883485, 40.2442917037, 20.7861495544, 647.46422376, 62.3139406574, 57.2618063838 }}, /* 3136 K */
+    {{ 37.1165106879, 40.2461969802, 20.7861495553, 647.488754998, 62.3150611789, 57.2648671542 }}, /* 3137 K */
+    {{ 37.117132638, 40.2481017561, 20.7861495561, 647.513259661, 62.3161812046, 57.2679258074 }}, /* 3138 K */
+    {{ 37.1177541992, 40.2500060313, 20.786149557, 647.537737779, 62.3173007355, 57.2709823458 }}, /* 3139 K */
+    {{ 37.1183753719, 40.2519098059, 20.7861495578, 647.562189377, 62.3184197728, 57.2740367714 }}, /* 3140 K */
+    {{ 37.1189961566, 40.2538130798, 20.7861495587, 647.586614484, 62.3195383175, 57.2770890865 }}, /* 3141 K */
+    {{ 37.1196165539, 40.255715853, 20.7861495595, 647.611013126, 62.320656371, 57.2801392935 }}, /* 3142 K */
+    {{ 37.1202365641, 40.2576181254, 20.7861495603, 647.635385331, 62.3217739343, 57.2831873944 }}, /* 3143 K */
+    {{ 37.1208561878, 40.2595198972, 20.7861495612, 647.659731127, 62.3228910085, 57.2862333917 }}, /* 3144 K */
+    {{ 37.1214754253, 40.2614211682, 20.786149562, 647.68405054, 62.3240075948, 57.2892772874 }}, /* 3145 K */
+    {{ 37.1220942773, 40.2633219385, 20.7861495629, 647.708343597, 62.3251236944, 57.2923190839 }}, /* 3146 K */
+    {{ 37.122712744, 40.265222208, 20.7861495637, 647.732610326, 62.3262393083, 57.2953587833 }}, /* 3147 K */
+    {{ 37.1233308261, 40.2671219767, 20.7861495645, 647.756850754, 62.3273544377, 57.298396388 }}, /* 3148 K */
+    {{ 37.123948524, 40.2690212447, 20.7861495654, 647.781064908, 62.3284690837, 57.3014319001 }}, /* 3149 K */
+    {{ 37.1245658381, 40.2709200119, 20.7861495662, 647.805252815, 62.3295832475, 57.3044653218 }}, /* 3150 K */
+    {{ 37.1251827688, 40.2728182782, 20.7861495671, 647.829414503, 62.3306969302, 57.3074966554 }}, /* 3151 K */
+    {{ 37.1257993168, 40.2747160438, 20.7861495679, 647.853549997, 62.331810133, 57.3105259032 }}, /* 3152 K */
+    {{ 37.1264154824, 40.2766133085, 20.7861495687, 647.877659326, 62.3329228569, 57.3135530673 }}, /* 3153 K */
+    {{ 37.1270312661, 40.2785100724, 20.7861495696, 647.901742516, 62.3340351032, 57.31657815 }}, /* 3154 K */
+    {{ 37.1276466683, 40.2804063354, 20.7861495704, 647.925799595, 62.3351468728, 57.3196011534 }}, /* 3155 K */
+    {{ 37.1282616896, 40.2823020976, 20.7861495712, 647.949830589, 62.3362581671, 57.3226220799 }}, /* 3156 K */
+    {{ 37.1288763303, 40.284197359, 20.7861495721, 647.973835524, 62.337368987, 57.3256409315 }}, /* 3157 K */
+    {{ 37.129490591, 40.2860921194, 20.7861495729, 647.997814429, 62.3384793337, 57.3286577107 }}, /* 3158 K */
+    {{ 37.1301044721, 40.287986379, 20.7861495738, 648.02176733, 62.3395892084, 57.3316724195 }}, /* 3159 K */
+    {{ 37.130717974, 40.2898801377, 20.7861495746, 648.045694254, 62.3406986122, 57.3346850601 }}, /* 3160 K */
+    {{ 37.1313310972, 40.2917733955, 20.7861495754, 648.069595227, 62.3418075462, 57.3376956349 }}, /* 3161 K */
+    {{ 37.1319438423, 40.2936661524, 20.7861495763, 648.093470277, 62.3429160115, 57.3407041459 }}, /* 3162 K */
+    {{ 37.1325562095, 40.2955584084, 20.7861495771, 648.117319431, 62.3440240092, 57.3437105955 }}, /* 3163 K */
+    {{ 37.1331681994, 40.2974501634, 20.7861495779, 648.141142714, 62.3451315405, 57.3467149858 }}, /* 3164 K */
+    {{ 37.1337798125, 40.2993414176, 20.7861495788, 648.164940154, 62.3462386065, 57.349717319 }}, /* 3165 K */
+    {{ 37.1343910492, 40.3012321708, 20.7861495796, 648.188711777, 62.3473452083, 57.3527175974 }}, /* 3166 K */
+    {{ 37.1350019099, 40.303122423, 20.7861495804, 648.212457611, 62.3484513471, 57.3557158231 }}, /* 3167 K */
+    {{ 37.1356123951, 40.3050121744, 20.7861495813, 648.236177682, 62.3495570239, 57.3587119983 }}, /* 3168 K */
+    {{ 37.1362225053, 40.3069014247, 20.7861495821, 648.259872016, 62.3506622398, 57.3617061253 }}, /* 3169 K */
+    {{ 37.1368322409, 40.3087901742, 20.7861495829, 648.283540641, 62.3517669961, 57.3646982062 }}, /* 3170 K */
+    {{ 37.1374416024, 40.3106784226, 20.7861495837, 648.307183582, 62.3528712937, 57.3676882433 }}, /* 3171 K */
+    {{ 37.1380505902, 40.3125661701, 20.7861495846, 648.330800866, 62.3539751339, 57.3706762387 }}, /* 3172 K */
+    {{ 37.1386592047, 40.3144534166, 20.7861495854, 648.354392521, 62.3550785177, 57.3736621947 }}, /* 3173 K */
+    {{ 37.1392674465, 40.3163401622, 20.7861495862, 648.377958572, 62.3561814462, 57.3766461133 }}, /* 3174 K */
+    {{ 37.1398753159, 40.3182264068, 20.7861495871, 648.401499046, 62.3572839207, 57.3796279969 }}, /* 3175 K */
+    {{ 37.1404828135, 40.3201121504, 20.7861495879, 648.425013969, 62.358385942, 57.3826078477 }}, /* 3176 K */
+    {{ 37.1410899396, 40.321997393, 20.7861495887, 648.448503369, 62.3594875115, 57.3855856677 }}, /* 3177 K */
+    {{ 37.1416966947, 40.3238821346, 20.7861495895, 648.47196727, 62.3605886302, 57.3885614592 }}, /* 3178 K */
+    {{ 37.1423030793, 40.3257663752, 20.7861495904, 648.495405701, 62.3616892991, 57.3915352244 }}, /* 3179 K */
+    {{ 37.1429090938, 40.3276501149, 20.7861495912, 648.518818686, 62.3627895195, 57.3945069655 }}, /* 3180 K */
+    {{ 37.1435147387, 40.3295333535, 20.786149592, 648.542206254, 62.3638892924, 57.3974766846 }}, /* 3181 K */
+    {{ 37.1441200143, 40.3314160912, 20.7861495929, 648.565568429, 62.3649886189, 57.400444384 }}, /* 3182 K */
+    {{ 37.1447249212, 40.3332983278, 20.7861495937, 648.588905238, 62.3660875002, 57.4034100657 }}, /* 3183 K */
+    {{ 37.1453294598, 40.3351800634, 20.7861495945, 648.612216708, 62.3671859372, 57.4063737321 }}, /* 3184 K */
+    {{ 37.1459336306, 40.3370612981, 20.7861495953, 648.635502865, 62.3682839313, 57.4093353853 }}, /* 3185 K */
+    {{ 37.1465374339, 40.3389420317, 20.7861495961, 648.658763735, 62.3693814834, 57.4122950274 }}, /* 3186 K */
+    {{ 37.1471408702, 40.3408222644, 20.786149597, 648.681999344, 62.3704785946, 57.4152526606 }}, /* 3187 K */
+    {{ 37.14774394, 40.342701996, 20.7861495978, 648.705209718, 62.371575266, 57.4182082871 }}, /* 3188 K */
+    {{ 37.1483466436, 40.3445812266, 20.7861495986, 648.728394885, 62.3726714989, 57.4211619091 }}, /* 3189 K */
+    {{ 37.1489489817, 40.3464599562, 20.7861495994, 648.751554869, 62.3737672941, 57.4241135288 }}, /* 3190 K */
+    {{ 37.1495509545, 40.3483381848, 20.7861496003, 648.774689697, 62.374862653, 57.4270631483 }}, /* 3191 K */
+    {{ 37.1501525625, 40.3502159124, 20.7861496011, 648.797799396, 62.3759575764, 57.4300107697 }}, /* 3192 K */
+    {{ 37.1507538062, 40.3520931391, 20.7861496019, 648.82088399, 62.3770520657, 57.4329563953 }}, /* 3193 K */
+    {{ 37.151354686, 40.3539698647, 20.7861496027, 648.843943507, 62.3781461217, 57.4359000273 }}, /* 3194 K */
+    {{ 37.1519552024, 40.3558460893, 20.7861496035, 648.866977972, 62.3792397457, 57.4388416677 }}, /* 3195 K */
+    {{ 37.1525553557, 40.3577218129, 20.7861496043, 648.889987412, 62.3803329387, 57.4417813187 }}, /* 3196 K */
+    {{ 37.1531551464, 40.3595970355, 20.7861496052, 648.912971852, 62.3814257019, 57.4447189826 }}, /* 3197 K */
+    {{ 37.153754575, 40.3614717571, 20.786149606, 648.935931318, 62.3825180363, 57.4476546614 }}, /* 3198 K */
+    {{ 37.1543536419, 40.3633459777, 20.7861496068, 648.958865837, 62.383609943, 57.4505883574 }}, /* 3199 K */
+    {{ 37.1549523475, 40.3652196973, 20.7861496076, 648.981775434, 62.3847014231, 57.4535200726 }}, /* 3200 K */
+    {{ 37.1555506922, 40.367092916, 20.7861496084, 649.004660135, 62.3857924777, 57.4564498093 }}, /* 3201 K */
+    {{ 37.1561486765, 40.3689656336, 20.7861496092, 649.027519966, 62.3868831079, 57.4593775696 }}, /* 3202 K */
+    {{ 37.1567463009, 40.3708378503, 20.7861496101, 649.050354954, 62.3879733147, 57.4623033556 }}, /* 3203 K */
+    {{ 37.1573435657, 40.372709566, 20.7861496109, 649.073165123, 62.3890630993, 57.4652271695 }}, /* 3204 K */
+    {{ 37.1579404714, 40.3745807808, 20.7861496117, 649.095950499, 62.3901524628, 57.4681490134 }}, /* 3205 K */
+    {{ 37.1585370184, 40.3764514945, 20.7861496125, 649.118711109, 62.3912414062, 57.4710688896 }}, /* 3206 K */
+    {{ 37.1591332072, 40.3783217073, 20.7861496133, 649.141446978, 62.3923299307, 57.4739868001 }}, /* 3207 K */
+    {{ 37.1597290382, 40.3801914192, 20.7861496141, 649.164158132, 62.3934180372, 57.476902747 }}, /* 3208 K */
+    {{ 37.1603245118, 40.3820606301, 20.7861496149, 649.186844597, 62.394505727, 57.4798167327 }}, /* 3209 K */
+    {{ 37.1609196284, 40.38392934, 20.7861496157, 649.209506398, 62.395593001, 57.482728759 }}, /* 3210 K */
+    {{ 37.1615143884, 40.385797549, 20.7861496165, 649.232143561, 62.3966798604, 57.4856388283 }}, /* 3211 K */
+    {{ 37.1621087924, 40.3876652571, 20.7861496173, 649.254756112, 62.3977663062, 57.4885469427 }}, /* 3212 K */
+    {{ 37.1627028407, 40.3895324642, 20.7861496182, 649.277344076, 62.3988523395, 57.4914531042 }}, /* 3213 K */
+    {{ 37.1632965338, 40.3913991704, 20.786149619, 649.299907479, 62.3999379615, 57.4943573151 }}, /* 3214 K */
+    {{ 37.163889872, 40.3932653757, 20.7861496198, 649.322446347, 62.4010231731, 57.4972595774 }}, /* 3215 K */
+    {{ 37.1644828559, 40.3951310801, 20.7861496206, 649.344960705, 62.4021079755, 57.5001598934 }}, /* 3216 K */
+    {{ 37.1650754857, 40.3969962836, 20.7861496214, 649.367450578, 62.4031923697, 57.503058265 }}, /* 3217 K */
+    {{ 37.1656677621, 40.3988609862, 20.7861496222, 649.389915993, 62.4042763569, 57.5059546945 }}, /* 3218 K */
+    {{ 37.1662596853, 40.4007251879, 20.786149623, 649.412356975, 62.405359938, 57.5088491841 }}, /* 3219 K */
+    {{ 37.1668512558, 40.4025888888, 20.7861496238, 649.434773549, 62.4064431142, 57.5117417357 }}, /* 3220 K */
+    {{ 37.1674424741, 40.4044520887, 20.7861496246, 649.45716574, 62.4075258866, 57.5146323516 }}, /* 3221 K */
+    {{ 37.1680333405, 40.4063147878, 20.7861496254, 649.479533575, 62.4086082562, 57.5175210339 }}, /* 3222 K */
+    {{ 37.1686238554, 40.4081769861, 20.7861496262, 649.501877078, 62.409690224, 57.5204077846 }}, /* 3223 K */
+    {{ 37.1692140194, 40.4100386835, 20.786149627, 649.524196275, 62.4107717912, 57.523292606 }}, /* 3224 K */
+    {{ 37.1698038328, 40.41189988, 20.7861496278, 649.546491191, 62.4118529589, 57.5261755002 }}, /* 3225 K */
+    {{ 37.170393296, 40.4137605758, 20.7861496286, 649.568761852, 62.4129337281, 57.5290564691 }}, /* 3226 K */
+    {{ 37.1709824095, 40.4156207707, 20.7861496294, 649.591008283, 62.4140140998, 57.5319355151 }}, /* 3227 K */
+    {{ 37.1715711736, 40.4174804648, 20.7861496302, 649.613230509, 62.4150940752, 57.5348126402 }}, /* 3228 K */
+    {{ 37.1721595889, 40.4193396581, 20.786149631, 649.635428556, 62.4161736552, 57.5376878465 }}, /* 3229 K */
+    {{ 37.1727476556, 40.4211983507, 20.7861496318, 649.657602449, 62.4172528411, 57.5405611361 }}, /* 3230 K */
+    {{ 37.1733353743, 40.4230565424, 20.7861496326, 649.679752213, 62.4183316338, 57.5434325111 }}, /* 3231 K */
+    {{ 37.1739227454, 40.4249142334, 20.7861496333, 649.701877873, 62.4194100344, 57.5463019737 }}, /* 3232 K */
+    {{ 37.1745097692, 40.4267714237, 20.7861496341, 649.723979454, 62.420488044, 57.549169526 }}, /* 3233 K */
+    {{ 37.1750964462, 40.4286281132, 20.7861496349, 649.746056982, 62.4215656637, 57.55203517 }}, /* 3234 K */
+    {{ 37.1756827767, 40.430484302, 20.7861496357, 649.768110482, 62.4226428944, 57.5548989079 }}, /* 3235 K */
+    {{ 37.1762687613, 40.4323399901, 20.7861496365, 649.790139979, 62.4237197373, 57.5577607418 }}, /* 3236 K */
+    {{ 37.1768544004, 40.4341951774, 20.7861496373, 649.812145498, 62.4247961934, 57.5606206738 }}, /* 3237 K */
+    {{ 37.1774396942, 40.4360498641, 20.7861496381, 649.834127064, 62.4258722639, 57.563478706 }}, /* 3238 K */
+    {{ 37.1780246433, 40.4379040501, 20.7861496389, 649.856084702, 62.4269479497, 57.5663348404 }}, /* 3239 K */
+    {{ 37.1786092481, 40.4397577355, 20.7861496397, 649.878018437, 62.4280232518, 57.5691890793 }}, /* 3240 K */
+    {{ 37.179193509, 40.4416109201, 20.7861496404, 649.899928295, 62.4290981715, 57.5720414246 }}, /* 3241 K */
+    {{ 37.1797774263, 40.4434636042, 20.7861496412, 649.9218143, 62.4301727097, 57.5748918785 }}, /* 3242 K */
+    {{ 37.1803610006, 40.4453157876, 20.786149642, 649.943676477, 62.4312468675, 57.5777404431 }}, /* 3243 K */
+    {{ 37.1809442322, 40.4471674704, 20.7861496428, 649.965514851, 62.4323206459, 57.5805871205 }}, /* 3244 K */
+    {{ 37.1815271215, 40.4490186527, 20.7861496436, 649.987329447, 62.433394046, 57.5834319127 }}, /* 3245 K */
+    {{ 37.1821096689, 40.4508693343, 20.7861496444, 650.009120291, 62.4344670688, 57.586274822 }}, /* 3246 K */
+    {{ 37.1826918749, 40.4527195154, 20.7861496451, 650.030887406, 62.4355397155, 57.5891158502 }}, /* 3247 K */
+    {{ 37.1832737398, 40.4545691959, 20.7861496459, 650.052630818, 62.436611987, 57.5919549996 }}, /* 3248 K */
+    {{ 37.1838552641, 40.4564183759, 20.7861496467, 650.074350551, 62.4376838845, 57.5947922722 }}, /* 3249 K */
+    {{ 37.1844364481, 40.4582670554, 20.7861496475, 650.096046631, 62.4387554089, 57.5976276702 }}, /* 3250 K */
+    {{ 37.1850172923, 40.4601152343, 20.7861496483, 650.117719082, 62.4398265613, 57.6004611955 }}, /* 3251 K */
+    {{ 37.1855977971, 40.4619629128, 20.786149649, 650.139367929, 62.4408973428, 57.6032928503 }}, /* 3252 K */
+    {{ 37.1861779629, 40.4638100908, 20.7861496498, 650.160993197, 62.4419677544, 57.6061226367 }}, /* 3253 K */
+    {{ 37.1867577901, 40.4656567684, 20.7861496506, 650.18259491, 62.4430377972, 57.6089505567 }}, /* 3254 K */
+    {{ 37.1873372791, 40.4675029455, 20.7861496514, 650.204173093, 62.4441074722, 57.6117766124 }}, /* 3255 K */
+    {{ 37.1879164303, 40.4693486222, 20.7861496521, 650.225727771, 62.4451767804, 57.614600806 }}, /* 3256 K */
+    {{ 37.1884952441, 40.4711937985, 20.7861496529, 650.247258969, 62.446245723, 57.6174231394 }}, /* 3257 K */
+    {{ 37.1890737209, 40.4730384744, 20.7861496537, 650.268766711, 62.4473143009, 57.6202436147 }}, /* 3258 K */
+    {{ 37.1896518611, 40.47488265, 20.7861496544, 650.290251022, 62.4483825152, 57.6230622341 }}, /* 3259 K */
+    {{ 37.1902296652, 40.4767263252, 20.7861496552, 650.311711926, 62.4494503669, 57.6258789995 }}, /* 3260 K */
+    {{ 37.1908071334, 40.4785695, 20.786149656, 650.333149448, 62.4505178572, 57.6286939132 }}, /* 3261 K */
+    {{ 37.1913842663, 40.4804121746, 20.7861496567, 650.354563613, 62.4515849869, 57.631506977 }}, /* 3262 K */
+    {{ 37.1919610642, 40.4822543489, 20.7861496575, 650.375954444, 62.4526517573, 57.6343181932 }}, /* 3263 K */
+    {{ 37.1925375275, 40.4840960228, 20.7861496583, 650.397321968, 62.4537181692, 57.6371275637 }}, /* 3264 K */
+    {{ 37.1931136567, 40.4859371966, 20.786149659, 650.418666207, 62.4547842239, 57.6399350907 }}, /* 3265 K */
+    {{ 37.193689452, 40.4877778701, 20.7861496598, 650.439987187, 62.4558499222, 57.6427407761 }}, /* 3266 K */
+    {{ 37.194264914, 40.4896180434, 20.7861496606, 650.461284932, 62.4569152652, 57.6455446221 }}, /* 3267 K */
+    {{ 37.194840043, 40.4914577164, 20.7861496613, 650.482559466, 62.457980254, 57.6483466307 }}, /* 3268 K */
+    {{ 37.1954148394, 40.4932968894, 20.7861496621, 650.503810815, 62.4590448896, 57.651146804 }}, /* 3269 K */
+    {{ 37.1959893036, 40.4951355621, 20.7861496629, 650.525039001, 62.4601091731, 57.653945144 }}, /* 3270 K */
+    {{ 37.196563436, 40.4969737347, 20.7861496636, 650.54624405, 62.4611731055, 57.6567416528 }}, /* 3271 K */
+    {{ 37.1971372371, 40.4988114072, 20.7861496644, 650.567425986, 62.4622366878, 57.6595363324 }}, /* 3272 K */
+    {{ 37.1977107071, 40.5006485797, 20.7861496651, 650.588584833, 62.463299921, 57.662329185 }}, /* 3273 K */
+    {{ 37.1982838466, 40.502485252, 20.7861496659, 650.609720616, 62.4643628062, 57.6651202125 }}, /* 3274 K */
+    {{ 37.1988566558, 40.5043214243, 20.7861496666, 650.630833359, 62.4654253445, 57.6679094169 }}, /* 3275 K */
+    {{ 37.1994291352, 40.5061570966, 20.7861496674, 650.651923086, 62.4664875368, 57.6706968005 }}, /* 3276 K */
+    {{ 37.2000012852, 40.5079922689, 20.7861496681, 650.672989821, 62.4675493841, 57.6734823651 }}, /* 3277 K */
+    {{ 37.2005731062, 40.5098269412, 20.7861496689, 650.694033589, 62.4686108876, 57.6762661129 }}, /* 3278 K */
+    {{ 37.2011445985, 40.5116611135, 20.7861496696, 650.715054413, 62.4696720483, 57.6790480458 }}, /* 3279 K */
+    {{ 37.2017157626, 40.5134947859, 20.7861496704, 650.736052318, 62.4707328671, 57.681828166 }}, /* 3280 K */
+    {{ 37.2022865989, 40.5153279584, 20.7861496711, 650.757027329, 62.4717933452, 57.6846064755 }}, /* 3281 K */
+    {{ 37.2028571077, 40.517160631, 20.7861496719, 650.777979468, 62.4728534834, 57.6873829762 }}, /* 3282 K */
+    {{ 37.2034272894, 40.5189928037, 20.7861496726, 650.798908761, 62.473913283, 57.6901576703 }}, /* 3283 K */
+    {{ 37.2039971445, 40.5208244766, 20.7861496734, 650.819815232, 62.4749727448, 57.6929305598 }}, /* 3284 K */
+    {{ 37.2045666732, 40.5226556496, 20.7861496741, 650.840698903, 62.47603187, 57.6957016468 }}, /* 3285 K */
+    {{ 37.2051358761, 40.5244863229, 20.7861496749, 650.861559801, 62.4770906595, 57.6984709332 }}, /* 3286 K */
+    {{ 37.2057047535, 40.5263164964, 20.7861496756, 650.882397947, 62.4781491143, 57.7012384211 }}, /* 3287 K */
+    {{ 37.2062733057, 40.5281461702, 20.7861496764, 650.903213368, 62.4792072356, 57.7040041125 }}, /* 3288 K */
+    {{ 37.2068415332, 40.5299753442, 20.7861496771, 650.924006086, 62.4802650242, 57.7067680095 }}, /* 3289 K */
+    {{ 37.2074094364, 40.5318040186, 20.7861496778, 650.944776125, 62.4813224813, 57.709530114 }}, /* 3290 K */
+    {{ 37.2079770156, 40.5336321933, 20.7861496786, 650.96552351, 62.4823796079, 57.7122904282 }}, /* 3291 K */
+    {{ 37.2085442713, 40.5354598683, 20.7861496793, 650.986248264, 62.4834364049, 57.715048954 }}, /* 3292 K */
+    {{ 37.2091112037, 40.5372870437, 20.78614968, 651.006950411, 62.4844928735, 57.7178056935 }}, /* 3293 K */
+    {{ 37.2096778134, 40.5391137196, 20.7861496808, 651.027629976, 62.4855490145, 57.7205606487 }}, /* 3294 K */
+    {{ 37.2102441006, 40.5409398958, 20.7861496815, 651.048286981, 62.4866048291, 57.7233138216 }}, /* 3295 K */
+    {{ 37.2108100659, 40.5427655726, 20.7861496823, 651.068921451, 62.4876603183, 57.7260652143 }}, /* 3296 K */
+    {{ 37.2113757094, 40.5445907498, 20.786149683, 651.08953341, 62.488715483, 57.7288148286 }}, /* 3297 K */
+    {{ 37.2119410318, 40.5464154275, 20.7861496837, 651.110122881, 62.4897703244, 57.7315626668 }}, /* 3298 K */
+    {{ 37.2125060332, 40.5482396058, 20.7861496844, 651.130689888, 62.4908248433, 57.7343087308 }}, /* 3299 K */
+    {{ 37.2130707141, 40.5500632847, 20.7861496852, 651.151234456, 62.4918790409, 57.7370530225 }}, /* 3300 K */
+    {{ 37.213635075, 40.5518864641, 20.7861496859, 651.171756607, 62.4929329181, 57.7397955441 }}, /* 3301 K */
+    {{ 37.2141991161, 40.5537091442, 20.7861496866, 651.192256365, 62.493986476, 57.7425362975 }}, /* 3302 K */
+    {{ 37.2147628378, 40.555531325, 20.7861496874, 651.212733754, 62.4950397155, 57.7452752848 }}, /* 3303 K */
+    {{ 37.2153262406, 40.5573530064, 20.7861496881, 651.233188798, 62.4960926377, 57.7480125079 }}, /* 3304 K */
+    {{ 37.2158893248, 40.5591741886, 20.7861496888, 651.253621521, 62.4971452436, 57.7507479689 }}, /* 3305 K */
+    {{ 37.2164520908, 40.5609948714, 20.7861496895, 651.274031945, 62.4981975342, 57.7534816698 }}, /* 3306 K */
+    {{ 37.2170145389, 40.5628150551, 20.7861496902, 651.294420095, 62.4992495105, 57.7562136125 }}, /* 3307 K */
+    {{ 37.2175766697, 40.5646347396, 20.786149691, 651.314785994, 62.5003011736, 57.7589437991 }}, /* 3308 K */
+    {{ 37.2181384833, 40.5664539249, 20.7861496917, 651.335129666, 62.5013525244, 57.7616722316 }}, /* 3309 K */
+    {{ 37.2186999802, 40.568272611, 20.7861496924, 651.355451134, 62.5024035639, 57.764398912 }}, /* 3310 K */
+    {{ 37.2192611608, 40.570090798, 20.7861496931, 651.375750422, 62.5034542932, 57.7671238422 }}, /* 3311 K */
+    {{ 37.2198220255, 40.571908486, 20.7861496938, 651.396027553, 62.5045047132, 57.7698470244 }}, /* 3312 K */
+    {{ 37.2203825747, 40.5737256749, 20.7861496945, 651.416282551, 62.5055548251, 57.7725684604 }}, /* 3313 K */
+    {{ 37.2209428086, 40.5755423648, 20.7861496953, 651.436515439, 62.5066046296, 57.7752881524 }}, /* 3314 K */
+    {{ 37.2215027277, 40.5773585557, 20.786149696, 651.456726241, 62.507654128, 57.7780061021 }}, /* 3315 K */
+    {{ 37.2220623324, 40.5791742477, 20.7861496967, 651.47691498, 62.5087033211, 57.7807223118 }}, /* 3316 K */
+    {{ 37.222621623, 40.5809894407, 20.7861496974, 651.497081679, 62.5097522101, 57.7834367833 }}, /* 3317 K */
+    {{ 37.2231806, 40.5828041349, 20.7861496981, 651.517226362, 62.5108007958, 57.7861495187 }}, /* 3318 K */
+    {{ 37.2237392636, 40.5846183302, 20.7861496988, 651.537349053, 62.5118490793, 57.7888605199 }}, /* 3319 K */
+    {{ 37.2242976143, 40.5864320266, 20.7861496995, 651.557449774, 62.5128970616, 57.7915697889 }}, /* 3320 K */
+    {{ 37.2248556524, 40.5882452243, 20.7861497002, 651.577528548, 62.5139447437, 57.7942773278 }}, /* 3321 K */
+    {{ 37.2254133783, 40.5900579232, 20.7861497009, 651.5975854, 62.5149921266, 57.7969831384 }}, /* 3322 K */
+    {{ 37.2259707924, 40.5918701234, 20.7861497016, 651.617620353, 62.5160392113, 57.7996872228 }}, /* 3323 K */
+    {{ 37.2265278951, 40.5936818248, 20.7861497023, 651.637633429, 62.5170859988, 57.802389583 }}, /* 3324 K */
+    {{ 37.2270846867, 40.5954930277, 20.786149703, 651.657624652, 62.51813249, 57.8050902209 }}, /* 3325 K */
+    {{ 37.2276411675, 40.5973037318, 20.7861497037, 651.677594045, 62.5191786861, 57.8077891386 }}, /* 3326 K */
+    {{ 37.228197338, 40.5991139374, 20.7861497044, 651.697541631, 62.520224588, 57.810486338 }}, /* 3327 K */
+    {{ 37.2287531986, 40.6009236445, 20.7861497051, 651.717467434, 62.5212701966, 57.813181821 }}, /* 3328 K */
+    {{ 37.2293087495, 40.6027328529, 20.7861497058, 651.737371476, 62.522315513, 57.8158755897 }}, /* 3329 K */
+    {{ 37.2298639913, 40.604541563, 20.7861497065, 651.757253781, 62.5233605382, 57.818567646 }}, /* 3330 K */
+    {{ 37.2304189241, 40.6063497745, 20.7861497072, 651.777114372, 62.5244052732, 57.8212579919 }}, /* 3331 K */
+    {{ 37.2309735485, 40.6081574876, 20.7861497079, 651.796953272, 62.525449719, 57.8239466294 }}, /* 3332 K */
+    {{ 37.2315278647, 40.6099647023, 20.7861497086, 651.816770504, 62.5264938765, 57.8266335605 }}, /* 3333 K */
+    {{ 37.2320818732, 40.6117714187, 20.7861497092, 651.836566091, 62.5275377467, 57.829318787 }}, /* 3334 K */
+    {{ 37.2326355743, 40.6135776368, 20.7861497099, 651.856340056, 62.5285813307, 57.832002311 }}, /* 3335 K */
+    {{ 37.2331889683, 40.6153833566, 20.7861497106, 651.876092422, 62.5296246295, 57.8346841345 }}, /* 3336 K */
+    {{ 37.2337420557, 40.6171885781, 20.7861497113, 651.895823212, 62.5306676439, 57.8373642594 }}, /* 3337 K */
+    {{ 37.2342948368, 40.6189933014, 20.786149712, 651.915532449, 62.5317103751, 57.8400426876 }}, /* 3338 K */
+    {{ 37.234847312, 40.6207975266, 20.7861497127, 651.935220157, 62.532752824, 57.8427194212 }}, /* 3339 K */
+    {{ 37.2353994816, 40.6226012536, 20.7861497133, 651.954886357, 62.5337949915, 57.8453944621 }}, /* 3340 K */
+    {{ 37.235951346, 40.6244044825, 20.786149714, 651.974531073, 62.5348368788, 57.8480678122 }}, /* 3341 K */
+    {{ 37.2365029055, 40.6262072133, 20.7861497147, 651.994154327, 62.5358784867, 57.8507394735 }}, /* 3342 K */
+    {{ 37.2370541606, 40.6280094461, 20.7861497154, 652.013756143, 62.5369198163, 57.853409448 }}, /* 3343 K */
+    {{ 37.2376051115, 40.629811181, 20.7861497161, 652.033336544, 62.5379608685, 57.8560777376 }}, /* 3344 K */
+    {{ 37.2381557587, 40.6316124178, 20.7861497167, 652.052895552, 62.5390016444, 57.8587443443 }}, /* 3345 K */
+    {{ 37.2387061026, 40.6334131568, 20.7861497174, 652.07243319, 62.5400421448, 57.86140927 }}, /* 3346 K */
+    {{ 37.2392561433, 40.6352133979, 20.7861497181, 652.09194948, 62.5410823709, 57.8640725167 }}, /* 3347 K */
+    {{ 37.2398058815, 40.6370131411, 20.7861497187, 652.111444446, 62.5421223235, 57.8667340863 }}, /* 3348 K */
+    {{ 37.2403553173, 40.6388123866, 20.7861497194, 652.130918111, 62.5431620037, 57.8693939808 }}, /* 3349 K */
+    {{ 37.2409044511, 40.6406111343, 20.7861497201, 652.150370496, 62.5442014125, 57.8720522021 }}, /* 3350 K */
+    {{ 37.2414532834, 40.6424093842, 20.7861497207, 652.169801626, 62.5452405508, 57.8747087522 }}, /* 3351 K */
+    {{ 37.2420018144, 40.6442071365, 20.7861497214, 652.189211521, 62.5462794196, 57.8773636329 }}, /* 3352 K */
+    {{ 37.2425500446, 40.6460043912, 20.7861497221, 652.208600206, 62.5473180199, 57.8800168464 }}, /* 3353 K */
+    {{ 37.2430979742, 40.6478011482, 20.7861497227, 652.227967702, 62.5483563526, 57.8826683944 }}, /* 3354 K */
+    {{ 37.2436456037, 40.6495974077, 20.7861497234, 652.247314033, 62.5493944188, 57.8853182789 }}, /* 3355 K */
+    {{ 37.2441929334, 40.6513931696, 20.786149724, 652.266639221, 62.5504322194, 57.8879665019 }}, /* 3356 K */
+    {{ 37.2447399637, 40.6531884341, 20.7861497247, 652.285943288, 62.5514697554, 57.8906130653 }}, /* 3357 K */
+    {{ 37.2452866948, 40.6549832011, 20.7861497254, 652.305226258, 62.5525070279, 57.8932579711 }}, /* 3358 K */
+    {{ 37.2458331273, 40.6567774708, 20.786149726, 652.324488152, 62.5535440376, 57.8959012211 }}, /* 3359 K */
+    {{ 37.2463792613, 40.658571243, 20.7861497267, 652.343728993, 62.5545807857, 57.8985428174 }}, /* 3360 K */
+    {{ 37.2469250974, 40.660364518, 20.7861497273, 652.362948804, 62.5556172731, 57.9011827617 }}, /* 3361 K */
+    {{ 37.2474706358, 40.6621572956, 20.786149728, 652.382147607, 62.5566535008, 57.9038210562 }}, /* 3362 K */
+    {{ 37.2480158769, 40.6639495761, 20.7861497286, 652.401325424, 62.5576894698, 57.9064577026 }}, /* 3363 K */
+    {{ 37.248560821, 40.6657413593, 20.7861497293, 652.420482279, 62.558725181, 57.909092703 }}, /* 3364 K */
+    {{ 37.2491054685, 40.6675326454, 20.7861497299, 652.439618193, 62.5597606354, 57.9117260592 }}, /* 3365 K */
+    {{ 37.2496498198, 40.6693234343, 20.7861497306, 652.458733189, 62.560795834, 57.9143577732 }}, /* 3366 K */
+    {{ 37.2501938752, 40.6711137262, 20.7861497312, 652.477827289, 62.5618307777, 57.9169878469 }}, /* 3367 K */
+    {{ 37.250737635, 40.6729035211, 20.7861497318, 652.496900516, 62.5628654675, 57.9196162822 }}, /* 3368 K */
+    {{ 37.2512810997, 40.674692819, 20.7861497325, 652.515952891, 62.5638999044, 57.9222430811 }}, /* 3369 K */
+    {{ 37.2518242695, 40.6764816199, 20.7861497331, 652.534984438, 62.5649340894, 57.9248682454 }}, /* 3370 K */
+    {{ 37.2523671448, 40.678269924, 20.7861497338, 652.553995179, 62.5659680235, 57.927491777 }}, /* 3371 K */
+    {{ 37.252909726, 40.6800577312, 20.7861497344, 652.572985135, 62.5670017075, 57.930113678 }}, /* 3372 K */
+    {{ 37.2534520134, 40.6818450415, 20.786149735, 652.59195433, 62.5680351425, 57.9327339502 }}, /* 3373 K */
+    {{ 37.2539940073, 40.6836318551, 20.7861497357, 652.610902785, 62.5690683294, 57.9353525955 }}, /* 3374 K */
+    {{ 37.2545357082, 40.685418172, 20.7861497363, 652.629830522, 62.5701012692, 57.9379696159 }}, /* 3375 K */
+    {{ 37.2550771163, 40.6872039922, 20.7861497369, 652.648737564, 62.5711339629, 57.9405850132 }}, /* 3376 K */
+    {{ 37.2556182321, 40.6889893158, 20.7861497376, 652.667623934, 62.5721664114, 57.9431987893 }}, /* 3377 K */
+    {{ 37.2561590558, 40.6907741428, 20.7861497382, 652.686489652, 62.5731986157, 57.9458109462 }}, /* 3378 K */
+    {{ 37.2566995878, 40.6925584732, 20.7861497388, 652.705334742, 62.5742305768, 57.9484214858 }}, /* 3379 K */
+    {{ 37.2572398284, 40.6943423071, 20.7861497394, 652.724159225, 62.5752622956, 57.9510304099 }}, /* 3380 K */
+    {{ 37.2577797781, 40.6961256446, 20.7861497401, 652.742963123, 62.5762937731, 57.9536377206 }}, /* 3381 K */
+    {{ 37.2583194371, 40.6979084857, 20.7861497407, 652.76174646, 62.5773250102, 57.9562434196 }}, /* 3382 K */
+    {{ 37.2588588058, 40.6996908304, 20.7861497413, 652.780509255, 62.578356008, 57.9588475089 }}, /* 3383 K */
+    {{ 37.2593978845, 40.7014726788, 20.7861497419, 652.799251533, 62.5793867673, 57.9614499904 }}, /* 3384 K */
+    {{ 37.2599366736, 40.7032540309, 20.7861497425, 652.817973314, 62.5804172892, 57.9640508659 }}, /* 3385 K */
+    {{ 37.2604751735, 40.7050348867, 20.7861497432, 652.836674621, 62.5814475745, 57.9666501374 }}, /* 3386 K */
+    {{ 37.2610133844, 40.7068152464, 20.7861497438, 652.855355476, 62.5824776243, 57.9692478069 }}, /* 3387 K */
+    {{ 37.2615513067, 40.70859511, 20.7861497444, 652.874015901, 62.5835074395, 57.971843876 }}, /* 3388 K */
+    {{ 37.2620889408, 40.7103744775, 20.786149745, 652.892655917, 62.5845370211, 57.9744383469 }}, /* 3389 K */
+    {{ 37.262626287, 40.7121533489, 20.7861497456, 652.911275547, 62.58556637, 57.9770312213 }}, /* 3390 K */
+    {{ 37.2631633456, 40.7139317243, 20.7861497462, 652.929874812, 62.5865954872, 57.9796225011 }}, /* 3391 K */
+    {{ 37.2637001171, 40.7157096038, 20.7861497468, 652.948453734, 62.5876243737, 57.9822121883 }}, /* 3392 K */
+    {{ 37.2642366016, 40.7174869874, 20.7861497474, 652.967012336, 62.5886530303, 57.9848002847 }}, /* 3393 K */
+    {{ 37.2647727997, 40.7192638752, 20.786149748, 652.985550639, 62.5896814581, 57.9873867922 }}, /* 3394 K */
+    {{ 37.2653087115, 40.7210402671, 20.7861497486, 653.004068665, 62.590709658, 57.9899717127 }}, /* 3395 K */
+    {{ 37.2658443375, 40.7228161633, 20.7861497492, 653.022566436, 62.591737631, 57.9925550481 }}, /* 3396 K */
+    {{ 37.266379678, 40.7245915638, 20.7861497498, 653.041043973, 62.592765378, 57.9951368002 }}, /* 3397 K */
+    {{ 37.2669147334, 40.7263664686, 20.7861497504, 653.059501298, 62.5937928999, 57.997716971 }}, /* 3398 K */
+    {{ 37.2674495039, 40.7281408778, 20.786149751, 653.077938434, 62.5948201978, 58.0002955623 }}, /* 3399 K */
+    {{ 37.2679839899, 40.7299147915, 20.7861497516, 653.096355401, 62.5958472725, 58.002872576 }}, /* 3400 K */
+    {{ 37.2685181918, 40.7316882096, 20.7861497522, 653.114752222, 62.5968741251, 58.0054480139 }}, /* 3401 K */
+    {{ 37.2690521098, 40.7334611323, 20.7861497528, 653.133128918, 62.5979007565, 58.008021878 }}, /* 3402 K */
+    {{ 37.2695857444, 40.7352335596, 20.7861497534, 653.151485511, 62.5989271675, 58.0105941702 }}, /* 3403 K */
+    {{ 37.2701190959, 40.7370054915, 20.786149754, 653.169822023, 62.5999533593, 58.0131648922 }}, /* 3404 K */
+    {{ 37.2706521646, 40.7387769281, 20.7861497546, 653.188138474, 62.6009793326, 58.015734046 }}, /* 3405 K */
+    {{ 37.2711849508, 40.7405478694, 20.7861497551, 653.206434888, 62.6020050886, 58.0183016335 }}, /* 3406 K */
+    {{ 37.2717174549, 40.7423183155, 20.7861497557, 653.224711285, 62.603030628, 58.0208676564 }}, /* 3407 K */
+    {{ 37.2722496772, 40.7440882665, 20.7861497563, 653.242967686, 62.604055952, 58.0234321167 }}, /* 3408 K */
+    {{ 37.2727816181, 40.7458577223, 20.7861497569, 653.261204115, 62.6050810613, 58.0259950163 }}, /* 3409 K */
+    {{ 37.2733132778, 40.7476266831, 20.7861497575, 653.279420591, 62.606105957, 58.028556357 }}, /* 3410 K */
+    {{ 37.2738446568, 40.7493951489, 20.786149758, 653.297617137, 62.60713064, 58.0311161406 }}, /* 3411 K */
+    {{ 37.2743757553, 40.7511631197, 20.7861497586, 653.315793775, 62.6081551112, 58.0336743691 }}, /* 3412 K */
+    {{ 37.2749065737, 40.7529305957, 20.7861497592, 653.333950524, 62.6091793717, 58.0362310442 }}, /* 3413 K */
+    {{ 37.2754371124, 40.7546975767, 20.7861497598, 653.352087408, 62.6102034223, 58.038786168 }}, /* 3414 K */
+    {{ 37.2759673716, 40.756464063, 20.7861497603, 653.370204447, 62.6112272639, 58.0413397421 }}, /* 3415 K */
+    {{ 37.2764973517, 40.7582300545, 20.7861497609, 653.388301664, 62.6122508976, 58.0438917685 }}, /* 3416 K */
+    {{ 37.277027053, 40.7599955513, 20.7861497615, 653.406379078, 62.6132743242, 58.046442249 }}, /* 3417 K */
+    {{ 37.2775564759, 40.7617605535, 20.786149762, 653.424436712, 62.6142975448, 58.0489911855 }}, /* 3418 K */
+    {{ 37.2780856206, 40.763525061, 20.7861497626, 653.442474588, 62.6153205602, 58.0515385798 }}, /* 3419 K */
+    {{ 37.2786144876, 40.7652890741, 20.7861497632, 653.460492726, 62.6163433714, 58.0540844338 }}, /* 3420 K */
+    {{ 37.2791430771, 40.7670525926, 20.7861497637, 653.478491147, 62.6173659793, 58.0566287493 }}, /* 3421 K */
+    {{ 37.2796713895, 40.7688156167, 20.7861497643, 653.496469874, 62.6183883849, 58.0591715282 }}, /* 3422 K */
+    {{ 37.2801994252, 40.7705781465, 20.7861497648, 653.514428927, 62.6194105891, 58.0617127723 }}, /* 3423 K */
+    {{ 37.2807271843, 40.7723401819, 20.7861497654, 653.532368328, 62.6204325928, 58.0642524835 }}, /* 3424 K */
+    {{ 37.2812546674, 40.774101723, 20.786149766, 653.550288097, 62.621454397, 58.0667906636 }}, /* 3425 K */
+    {{ 37.2817818746, 40.7758627699, 20.7861497665, 653.568188257, 62.6224760026, 58.0693273145 }}, /* 3426 K */
+    {{ 37.2823088064, 40.7776233226, 20.7861497671, 653.586068828, 62.6234974106, 58.071862438 }}, /* 3427 K */
+    {{ 37.282835463, 40.7793833813, 20.7861497676, 653.603929832, 62.6245186219, 58.0743960359 }}, /* 3428 K */
+    {{ 37.2833618448, 40.7811429458, 20.7861497682, 653.621771289, 62.6255396374, 58.0769281101 }}, /* 3429 K */
+    {{ 37.2838879522, 40.7829020164, 20.7861497687, 653.639593221, 62.626560458, 58.0794586624 }}, /* 3430 K */
+    {{ 37.2844137854, 40.784660593, 20.7861497692, 653.657395649, 62.6275810848, 58.0819876947 }}, /* 3431 K */
+    {{ 37.2849393447, 40.7864186758, 20.7861497698, 653.675178595, 62.6286015186, 58.0845152087 }}, /* 3432 K */
+    {{ 37.2854646306, 40.7881762647, 20.7861497703, 653.692942079, 62.6296217603, 58.0870412064 }}, /* 3433 K */
+    {{ 37.2859896432, 40.7899333598, 20.7861497709, 653.710686122, 62.6306418109, 58.0895656895 }}, /* 3434 K */
+    {{ 37.286514383, 40.7916899612, 20.7861497714, 653.728410745, 62.6316616714, 58.0920886599 }}, /* 3435 K */
+    {{ 37.2870388503, 40.7934460689, 20.7861497719, 653.74611597, 62.6326813426, 58.0946101195 }}, /* 3436 K */
+    {{ 37.2875630454, 40.795201683, 20.7861497725, 653.763801817, 62.6337008255, 58.0971300699 }}, /* 3437 K */
+    {{ 37.2880869686, 40.7969568036, 20.786149773, 653.781468308, 62.634720121, 58.0996485132 }}, /* 3438 K */
+    {{ 37.2886106203, 40.7987114306, 20.7861497735, 653.799115463, 62.6357392301, 58.102165451 }}, /* 3439 K */
+    {{ 37.2891340008, 40.8004655642, 20.7861497741, 653.816743304, 62.6367581536, 58.1046808853 }}, /* 3440 K */
+    {{ 37.2896571103, 40.8022192044, 20.7861497746, 653.834351851, 62.6377768926, 58.1071948178 }}, /* 3441 K */
+    {{ 37.2901799493, 40.8039723513, 20.7861497751, 653.851941126, 62.6387954479, 58.1097072504 }}, /* 3442 K */
+    {{ 37.290702518, 40.8057250049, 20.7861497756, 653.869511148, 62.6398138204, 58.1122181849 }}, /* 3443 K */
+    {{ 37.2912248168, 40.8074771653, 20.7861497762, 653.88706194, 62.6408320111, 58.114727623 }}, /* 3444 K */
+    {{ 37.2917468459, 40.8092288325, 20.7861497767, 653.904593522, 62.641850021, 58.1172355667 }}, /* 3445 K */
+    {{ 37.2922686058, 40.8109800067, 20.7861497772, 653.922105915, 62.6428678509, 58.1197420178 }}, /* 3446 K */
+    {{ 37.2927900967, 40.8127306878, 20.7861497777, 653.939599139, 62.6438855017, 58.122246978 }}, /* 3447 K */
+    {{ 37.293311319, 40.8144808759, 20.7861497782, 653.957073216, 62.6449029745, 58.1247504491 }}, /* 3448 K */
+    {{ 37.2938322729, 40.816230571, 20.7861497787, 653.974528167, 62.64592027, 58.1272524331 }}, /* 3449 K */
+    {{ 37.2943529589, 40.8179797733, 20.7861497793, 653.991964011, 62.6469373893, 58.1297529316 }}, /* 3450 K */
+    {{ 37.2948733771, 40.8197284828, 20.7861497798, 654.00938077, 62.6479543333, 58.1322519465 }}, /* 3451 K */
+    {{ 37.295393528, 40.8214766996, 20.7861497803, 654.026778465, 62.6489711028, 58.1347494797 }}, /* 3452 K */
+    {{ 37.2959134119, 40.8232244236, 20.7861497808, 654.044157117, 62.6499876989, 58.1372455329 }}, /* 3453 K */
+    {{ 37.296433029, 40.824971655, 20.7861497813, 654.061516745, 62.6510041224, 58.1397401079 }}, /* 3454 K */
+    {{ 37.2969523797, 40.8267183939, 20.7861497818, 654.078857371, 62.6520203742, 58.1422332065 }}, /* 3455 K */
+    {{ 37.2974714644, 40.8284646402, 20.7861497823, 654.096179016, 62.6530364553, 58.1447248305 }}, /* 3456 K */
+    {{ 37.2979902832, 40.830210394, 20.7861497828, 654.1134817, 62.6540523666, 58.1472149818 }}, /* 3457 K */
+    {{ 37.2985088366, 40.8319556555, 20.7861497833, 654.130765443, 62.655068109, 58.1497036621 }}, /* 3458 K */
+    {{ 37.2990271249, 40.8337004246, 20.7861497838, 654.148030267, 62.6560836835, 58.1521908733 }}, /* 3459 K */
+    {{ 37.2995451484, 40.8354447015, 20.7861497843, 654.165276191, 62.6570990908, 58.154676617 }}, /* 3460 K */
+    {{ 37.3000629074, 40.8371884861, 20.7861497848, 654.182503238, 62.6581143321, 58.1571608952 }}, /* 3461 K */
+    {{ 37.3005804021, 40.8389317786, 20.7861497853, 654.199711426, 62.6591294081, 58.1596437097 }}, /* 3462 K */
+    {{ 37.3010976331, 40.840674579, 20.7861497857, 654.216900777, 62.6601443199, 58.1621250621 }}, /* 3463 K */
+    {{ 37.3016146004, 40.8424168874, 20.7861497862, 654.234071311, 62.6611590682, 58.1646049543 }}, /* 3464 K */
+    {{ 37.3021313045, 40.8441587037, 20.7861497867, 654.251223048, 62.6621736541, 58.1670833882 }}, /* 3465 K */
+    {{ 37.3026477458, 40.8459000282, 20.7861497872, 654.26835601, 62.6631880784, 58.1695603654 }}, /* 3466 K */
+    {{ 37.3031639244, 40.8476408608, 20.7861497877, 654.285470216, 62.6642023421, 58.1720358878 }}, /* 3467 K */
+    {{ 37.3036798407, 40.8493812017, 20.7861497882, 654.302565688, 62.6652164461, 58.1745099572 }}, /* 3468 K */
+    {{ 37.304195495, 40.8511210508, 20.7861497886, 654.319642445, 62.6662303913, 58.1769825753 }}, /* 3469 K */
+    {{ 37.3047108877, 40.8528604082, 20.7861497891, 654.336700507, 62.6672441785, 58.1794537439 }}, /* 3470 K */
+    {{ 37.305226019, 40.8545992741, 20.7861497896, 654.353739896, 62.6682578088, 58.1819234649 }}, /* 3471 K */
+    {{ 37.3057408893, 40.8563376484, 20.7861497901, 654.370760632, 62.669271283, 58.18439174 }}, /* 3472 K */
+    {{ 37.3062554988, 40.8580755312, 20.7861497905, 654.387762735, 62.6702846021, 58.1868585709 }}, /* 3473 K */
+    {{ 37.306769848, 40.8598129226, 20.786149791, 654.404746225, 62.6712977669, 58.1893239595 }}, /* 3474 K */
+    {{ 37.307283937, 40.8615498226, 20.7861497915, 654.421711123, 62.6723107784, 58.1917879075 }}, /* 3475 K */
+    {{ 37.3077977663, 40.8632862314, 20.7861497919, 654.438657448, 62.6733236374, 58.1942504168 }}, /* 3476 K */
+    {{ 37.308311336, 40.8650221489, 20.7861497924, 654.455585222, 62.6743363449, 58.196711489 }}, /* 3477 K */
+    {{ 37.3088246466, 40.8667575753, 20.7861497929, 654.472494465, 62.6753489019, 58.199171126 }}, /* 3478 K */
+    {{ 37.3093376984, 40.8684925105, 20.7861497933, 654.489385196, 62.6763613091, 58.2016293295 }}, /* 3479 K */
+    {{ 37.3098504916, 40.8702269548, 20.7861497938, 654.506257436, 62.6773735675, 58.2040861014 }}, /* 3480 K */
+    {{ 37.3103630266, 40.871960908, 20.7861497942, 654.523111206, 62.6783856781, 58.2065414433 }}, /* 3481 K */
+    {{ 37.3108753036, 40.8736943704, 20.7861497947, 654.539946525, 62.6793976416, 58.208995357 }}, /* 3482 K */
+    {{ 37.311387323, 40.8754273419, 20.7861497951, 654.556763413, 62.6804094591, 58.2114478444 }}, /* 3483 K */
+    {{ 37.3118990852, 40.8771598226, 20.7861497956, 654.573561892, 62.6814211315, 58.2138989071 }}, /* 3484 K */
+    {{ 37.3124105903, 40.8788918126, 20.786149796, 654.59034198, 62.6824326596, 58.216348547 }}, /* 3485 K */
+    {{ 37.3129218387, 40.880623312, 20.7861497965, 654.607103698, 62.6834440443, 58.2187967658 }}, /* 3486 K */
+    {{ 37.3134328308, 40.8823543207, 20.7861497969, 654.623847066, 62.6844552866, 58.2212435652 }}, /* 3487 K */
+    {{ 37.3139435667, 40.884084839, 20.7861497974, 654.640572104, 62.6854663873, 58.2236889471 }}, /* 3488 K */
+    {{ 37.3144540469, 40.8858148668, 20.7861497978, 654.657278833, 62.6864773474, 58.2261329131 }}, /* 3489 K */
+    {{ 37.3149642717, 40.8875444042, 20.7861497983, 654.673967272, 62.6874881678, 58.2285754651 }}, /* 3490 K */
+    {{ 37.3154742413, 40.8892734512, 20.7861497987, 654.690637441, 62.6884988493, 58.2310166048 }}, /* 3491 K */
+    {{ 37.315983956, 40.891002008, 20.7861497991, 654.707289361, 62.6895093929, 58.233456334 }}, /* 3492 K */
+    {{ 37.3164934162, 40.8927300747, 20.7861497996, 654.723923051, 62.6905197995, 58.2358946543 }}, /* 3493 K */
+    {{ 37.3170026222, 40.8944576511, 20.7861498, 654.740538531, 62.6915300699, 58.2383315677 }}, /* 3494 K */
+    {{ 37.3175115742, 40.8961847376, 20.7861498004, 654.757135822, 62.6925402051, 58.2407670757 }}, /* 3495 K */
+    {{ 37.3180202726, 40.897911334, 20.7861498008, 654.773714942, 62.693550206, 58.2432011802 }}, /* 3496 K */
+    {{ 37.3185287177, 40.8996374405, 20.7861498013, 654.790275913, 62.6945600735, 58.2456338829 }}, /* 3497 K */
+    {{ 37.3190369097, 40.9013630571, 20.7861498017, 654.806818754, 62.6955698084, 58.2480651856 }}, /* 3498 K */
+    {{ 37.3195448491, 40.903088184, 20.7861498021, 654.823343485, 62.6965794117, 58.2504950899 }}, /* 3499 K */
+    {{ 37.320052536, 40.9048128211, 20.7861498025, 654.839850125, 62.6975888842, 58.2529235977 }}, /* 3500 K */
+    {{ 37.3205599709, 40.9065369685, 20.786149803, 654.856338696, 62.698598227, 58.2553507108 }}, /* 3501 K */
+    {{ 37.3210671539, 40.9082606264, 20.7861498034, 654.872809215, 62.6996074408, 58.2577764307 }}, /* 3502 K */
+    {{ 37.3215740854, 40.9099837947, 20.7861498038, 654.889261704, 62.7006165265, 58.2602007593 }}, /* 3503 K */
+    {{ 37.3220807658, 40.9117064736, 20.7861498042, 654.905696182, 62.7016254851, 58.2626236984 }}, /* 3504 K */
+    {{ 37.3225871952, 40.9134286631, 20.7861498046, 654.922112669, 62.7026343175, 58.2650452495 }}, /* 3505 K */
+    {{ 37.3230933741, 40.9151503632, 20.786149805, 654.938511184, 62.7036430245, 58.2674654146 }}, /* 3506 K */
+    {{ 37.3235993026, 40.9168715741, 20.7861498054, 654.954891748, 62.704651607, 58.2698841953 }}, /* 3507 K */
+    {{ 37.3241049812, 40.9185922958, 20.7861498058, 654.97125438, 62.705660066, 58.2723015934 }}, /* 3508 K */
+    {{ 37.3246104101, 40.9203125284, 20.7861498062, 654.987599099, 62.7066684023, 58.2747176105 }}, /* 3509 K */
+    {{ 37.3251155896, 40.9220322719, 20.7861498066, 655.003925926, 62.7076766168, 58.2771322485 }}, /* 3510 K */
+    {{ 37.32562052, 40.9237515265, 20.786149807, 655.020234881, 62.7086847105, 58.2795455091 }}, /* 3511 K */
+    {{ 37.3261252016, 40.9254702921, 20.7861498074, 655.036525981, 62.7096926841, 58.2819573939 }}, /* 3512 K */
+    {{ 37.3266296347, 40.9271885689, 20.7861498078, 655.052799249, 62.7107005387, 58.2843679047 }}, /* 3513 K */
+    {{ 37.3271338196, 40.928906357, 20.7861498082, 655.069054702, 62.711708275, 58.2867770433 }}, /* 3514 K */
+    {{ 37.3276377567, 40.9306236563, 20.7861498086, 655.085292361, 62.7127158941, 58.2891848113 }}, /* 3515 K */
+    {{ 37.3281414461, 40.932340467, 20.786149809, 655.101512245, 62.7137233967, 58.2915912105 }}, /* 3516 K */
+    {{ 37.3286448883, 40.9340567891, 20.7861498094, 655.117714374, 62.7147307837, 58.2939962426 }}, /* 3517 K */
+    {{ 37.3291480835, 40.9357726227, 20.7861498098, 655.133898768, 62.7157380561, 58.2963999094 }}, /* 3518 K */
+    {{ 37.3296510319, 40.9374879679, 20.7861498101, 655.150065445, 62.7167452148, 58.2988022125 }}, /* 3519 K */
+    {{ 37.330153734, 40.9392028247, 20.7861498105, 655.166214425, 62.7177522606, 58.3012031537 }}, /* 3520 K */
+    {{ 37.3306561899, 40.9409171933, 20.7861498109, 655.182345728, 62.7187591944, 58.3036027346 }}, /* 3521 K */
+    {{ 37.3311584001, 40.9426310736, 20.7861498113, 655.198459374, 62.7197660171, 58.3060009571 }}, /* 3522 K */
+    {{ 37.3316603647, 40.9443444658, 20.7861498117, 655.214555381, 62.7207727296, 58.3083978227 }}, /* 3523 K */
+    {{ 37.3321620842, 40.9460573699, 20.786149812, 655.23063377, 62.7217793328, 58.3107933333 }}, /* 3524 K */
+    {{ 37.3326635587, 40.947769786, 20.7861498124, 655.246694559, 62.7227858275, 58.3131874906 }}, /* 3525 K */
+    {{ 37.3331647886, 40.9494817142, 20.7861498128, 655.262737768, 62.7237922147, 58.3155802962 }}, /* 3526 K */
+    {{ 37.3336657741, 40.9511931545, 20.7861498131, 655.278763417, 62.7247984953, 58.3179717518 }}, /* 3527 K */
+    {{ 37.3341665157, 40.9529041071, 20.7861498135, 655.294771524, 62.72580467, 58.3203618592 }}, /* 3528 K */
+    {{ 37.3346670135, 40.9546145719, 20.7861498139, 655.31076211, 62.7268107399, 58.3227506201 }}, /* 3529 K */
+    {{ 37.3351672678, 40.9563245491, 20.7861498142, 655.326735193, 62.7278167057, 58.3251380362 }}, /* 3530 K */
+    {{ 37.335667279, 40.9580340386, 20.7861498146, 655.342690792, 62.7288225685, 58.3275241091 }}, /* 3531 K */
+    {{ 37.3361670474, 40.9597430407, 20.7861498149, 655.358628928, 62.7298283289, 58.3299088407 }}, /* 3532 K */
+    {{ 37.3366665732, 40.9614515554, 20.7861498153, 655.374549619, 62.7308339881, 58.3322922325 }}, /* 3533 K */
+    {{ 37.3371658567, 40.9631595827, 20.7861498157, 655.390452885, 62.7318395467, 58.3346742863 }}, /* 3534 K */
+    {{ 37.3376648982, 40.9648671227, 20.786149816, 655.406338745, 62.7328450057, 58.3370550038 }}, /* 3535 K */
+    {{ 37.3381636981, 40.9665741756, 20.7861498164, 655.422207218, 62.7338503661, 58.3394343867 }}, /* 3536 K */
+    {{ 37.3386622566, 40.9682807412, 20.7861498167, 655.438058323, 62.7348556286, 58.3418124367 }}, /* 3537 K */
+    {{ 37.339160574, 40.9699868198, 20.786149817, 655.453892079, 62.7358607941, 58.3441891554 }}, /* 3538 K */
+    {{ 37.3396586505, 40.9716924114, 20.7861498174, 655.469708506, 62.7368658635, 58.3465645446 }}, /* 3539 K */
+    {{ 37.3401564866, 40.9733975161, 20.7861498177, 655.485507623, 62.7378708378, 58.348938606 }}, /* 3540 K */
+    {{ 37.3406540824, 40.975102134, 20.7861498181, 655.501289449, 62.7388757177, 58.3513113412 }}, /* 3541 K */
+    {{ 37.3411514383, 40.9768062651, 20.7861498184, 655.517054003, 62.7398805042, 58.353682752 }}, /* 3542 K */
+    {{ 37.3416485546, 40.9785099094, 20.7861498187, 655.532801304, 62.7408851982, 58.35605284 }}, /* 3543 K */
+    {{ 37.3421454315, 40.9802130672, 20.7861498191, 655.548531372, 62.7418898004, 58.3584216069 }}, /* 3544 K */
+    {{ 37.3426420694, 40.9819157384, 20.7861498194, 655.564244225, 62.7428943119, 58.3607890544 }}, /* 3545 K */
+    {{ 37.3431384684, 40.9836179231, 20.7861498197, 655.579939882, 62.7438987334, 58.3631551842 }}, /* 3546 K */
+    {{ 37.343634629, 40.9853196214, 20.7861498201, 655.595618362, 62.7449030659, 58.365519998 }}, /* 3547 K */
+    {{ 37.3441305514, 40.9870208334, 20.7861498204, 655.611279685, 62.7459073101, 58.3678834974 }}, /* 3548 K */
+    {{ 37.3446262359, 40.9887215592, 20.7861498207, 655.62692387, 62.7469114671, 58.3702456842 }}, /* 3549 K */
+    {{ 37.3451216828, 40.9904217987, 20.786149821, 655.642550934, 62.7479155377, 58.37260656 }}, /* 3550 K */
+    {{ 37.3456168924, 40.9921215522, 20.7861498213, 655.658160899, 62.7489195227, 58.3749661264 }}, /* 3551 K */
+    {{ 37.3461118649, 40.9938208196, 20.7861498217, 655.673753781, 62.749923423, 58.3773243852 }}, /* 3552 K */
+    {{ 37.3466066006, 40.9955196011, 20.786149822, 655.689329601, 62.7509272395, 58.3796813381 }}, /* 3553 K */
+    {{ 37.3471010999, 40.9972178967, 20.7861498223, 655.704888377, 62.751930973, 58.3820369867 }}, /* 3554 K */
+    {{ 37.3475953631, 40.9989157065, 20.7861498226, 655.720430128, 62.7529346246, 58.3843913327 }}, /* 3555 K */
+    {{ 37.3480893903, 41.0006130306, 20.7861498229, 655.735954873, 62.7539381949, 58.3867443777 }}, /* 3556 K */
+    {{ 37.3485831819, 41.002309869, 20.7861498232, 655.751462631, 62.7549416849, 58.3890961235 }}, /* 3557 K */
+    {{ 37.3490767382, 41.0040062218, 20.7861498235, 655.76695342, 62.7559450954, 58.3914465717 }}, /* 3558 K */
+    {{ 37.3495700595, 41.0057020892, 20.7861498238, 655.78242726, 62.7569484274, 58.3937957239 }}, /* 3559 K */
+    {{ 37.350063146, 41.0073974711, 20.7861498241, 655.797884169, 62.7579516817, 58.3961435819 }}, /* 3560 K */
+    {{ 37.3505559981, 41.0090923677, 20.7861498244, 655.813324167, 62.7589548591, 58.3984901473 }}, /* 3561 K */
+    {{ 37.351048616, 41.010786779, 20.7861498247, 655.828747271, 62.7599579605, 58.4008354217 }}, /* 3562 K */
+    {{ 37.351541, 41.0124807051, 20.786149825, 655.8441535, 62.7609609869, 58.4031794069 }}, /* 3563 K */
+    {{ 37.3520331504, 41.0141741461, 20.7861498253, 655.859542874, 62.761963939, 58.4055221044 }}, /* 3564 K */
+    {{ 37.3525250675, 41.0158671021, 20.7861498256, 655.874915411, 62.7629668178, 58.407863516 }}, /* 3565 K */
+    {{ 37.3530167515, 41.0175595731, 20.7861498259, 655.89027113, 62.7639696241, 58.4102036433 }}, /* 3566 K */
+    {{ 37.3535082028, 41.0192515592, 20.7861498262, 655.90561005, 62.7649723587, 58.4125424879 }}, /* 3567 K */
+    {{ 37.3539994216, 41.0209430605, 20.7861498264, 655.920932188, 62.7659750226, 58.4148800516 }}, /* 3568 K */
+    {{ 37.3544904082, 41.0226340771, 20.7861498267, 655.936237564, 62.7669776166, 58.417216336 }}, /* 3569 K */
+    {{ 37.354981163, 41.024324609, 20.786149827, 655.951526197, 62.7679801416, 58.4195513426 }}, /* 3570 K */
+    {{ 37.3554716861, 41.0260146563, 20.7861498273, 655.966798104, 62.7689825984, 58.4218850733 }}, /* 3571 K */
+    {{ 37.3559619778, 41.0277042192, 20.7861498276, 655.982053306, 62.7699849879, 58.4242175296 }}, /* 3572 K */
+    {{ 37.3564520385, 41.0293932976, 20.7861498278, 655.997291819, 62.770987311, 58.4265487131 }}, /* 3573 K */
+    {{ 37.3569418684, 41.0310818917, 20.7861498281, 656.012513664, 62.7719895685, 58.4288786256 }}, /* 3574 K */
+    {{ 37.3574314679, 41.0327700016, 20.7861498284, 656.027718857, 62.7729917613, 58.4312072686 }}, /* 3575 K */
+    {{ 37.3579208371, 41.0344576272, 20.7861498286, 656.042907419, 62.7739938902, 58.4335346439 }}, /* 3576 K */
+    {{ 37.3584099764, 41.0361447688, 20.7861498289, 656.058079366, 62.7749959562, 58.435860753 }}, /* 3577 K */
+    {{ 37.358898886, 41.0378314263, 20.7861498292, 656.073234719, 62.7759979601, 58.4381855977 }}, /* 3578 K */
+    {{ 37.3593875663, 41.0395175999, 20.7861498294, 656.088373495, 62.7769999027, 58.4405091795 }}, /* 3579 K */
+    {{ 37.3598760174, 41.0412032896, 20.7861498297, 656.103495713, 62.7780017849, 58.4428315 }}, /* 3580 K */
+    {{ 37.3603642398, 41.0428884955, 20.7861498299, 656.118601392, 62.7790036076, 58.445152561 }}, /* 3581 K */
+    {{ 37.3608522336, 41.0445732178, 20.7861498302, 656.133690549, 62.7800053716, 58.4474723641 }}, /* 3582 K */
+    {{ 37.3613399992, 41.0462574564, 20.7861498304, 656.148763203, 62.7810070778, 58.4497909108 }}, /* 3583 K */
+    {{ 37.3618275368, 41.0479412114, 20.7861498307, 656.163819372, 62.7820087271, 58.4521082029 }}, /* 3584 K */
+    {{ 37.3623148467, 41.049624483, 20.7861498309, 656.178859076, 62.7830103203, 58.454424242 }}, /* 3585 K */
+    {{ 37.3628019292, 41.0513072712, 20.7861498312, 656.193882332, 62.7840118582, 58.4567390297 }}, /* 3586 K */
+    {{ 37.3632887846, 41.052989576, 20.7861498314, 656.208889158, 62.7850133418, 58.4590525676 }}, /* 3587 K */
+    {{ 37.3637754131, 41.0546713977, 20.7861498317, 656.223879573, 62.7860147718, 58.4613648574 }}, /* 3588 K */
+    {{ 37.364261815, 41.0563527362, 20.7861498319, 656.238853596, 62.7870161492, 58.4636759006 }}, /* 3589 K */
+    {{ 37.3647479906, 41.0580335916, 20.7861498321, 656.253811244, 62.7880174748, 58.465985699 }}, /* 3590 K */
+    {{ 37.3652339402, 41.0597139641, 20.7861498324, 656.268752536, 62.7890187494, 58.4682942541 }}, /* 3591 K */
+    {{ 37.3657196641, 41.0613938536, 20.7861498326, 656.28367749, 62.790019974, 58.4706015676 }}, /* 3592 K */
+    {{ 37.3662051624, 41.0630732603, 20.7861498328, 656.298586124, 62.7910211493, 58.4729076411 }}, /* 3593 K */
+    {{ 37.3666904356, 41.0647521843, 20.7861498331, 656.313478457, 62.7920222763, 58.4752124762 }}, /* 3594 K */
+    {{ 37.3671754839, 41.0664306256, 20.7861498333, 656.328354507, 62.7930233557, 58.4775160746 }}, /* 3595 K */
+    {{ 37.3676603075, 41.0681085843, 20.7861498335, 656.343214292, 62.7940243885, 58.4798184378 }}, /* 3596 K */
+    {{ 37.3681449067, 41.0697860606, 20.7861498337, 656.35805783, 62.7950253755, 58.4821195675 }}, /* 3597 K */
+    {{ 37.3686292819, 41.0714630544, 20.7861498339, 656.372885139, 62.7960263175, 58.4844194652 }}, /* 3598 K */
+    {{ 37.3691134332, 41.0731395658, 20.7861498342, 656.387696237, 62.7970272154, 58.4867181327 }}, /* 3599 K */
+    {{ 37.369597361, 41.0748155951, 20.7861498344, 656.402491144, 62.7980280701, 58.4890155715 }}, /* 3600 K */
+    {{ 37.3700810655, 41.0764911421, 20.7861498346, 656.417269875, 62.7990288823, 58.4913117833 }}, /* 3601 K */
+    {{ 37.370564547, 41.0781662071, 20.7861498348, 656.432032451, 62.800029653, 58.4936067696 }}, /* 3602 K */
+    {{ 37.3710478058, 41.07984079, 20.786149835, 656.446778889, 62.8010303831, 58.495900532 }}, /* 3603 K */
+    {{ 37.3715308422, 41.081514891, 20.7861498352, 656.461509206, 62.8020310733, 58.4981930723 }}, /* 3604 K */
+    {{ 37.3720136564, 41.0831885102, 20.7861498354, 656.476223421, 62.8030317245, 58.5004843919 }}, /* 3605 K */
+    {{ 37.3724962487, 41.0848616476, 20.7861498356, 656.490921553, 62.8040323375, 58.5027744925 }}, /* 3606 K */
+    {{ 37.3729786193, 41.0865343034, 20.7861498358, 656.505603618, 62.8050329133, 58.5050633757 }}, /* 3607 K */
+    {{ 37.3734607686, 41.0882064775, 20.786149836, 656.520269635, 62.8060334527, 58.507351043 }}, /* 3608 K */
+    {{ 37.3739426969, 41.0898781701, 20.7861498362, 656.534919622, 62.8070339564, 58.5096374962 }}, /* 3609 K */
+    {{ 37.3744244043, 41.0915493813, 20.7861498364, 656.549553598, 62.8080344254, 58.5119227368 }}, /* 3610 K */
+    {{ 37.3749058912, 41.0932201112, 20.7861498366, 656.564171579, 62.8090348606, 58.5142067664 }}, /* 3611 K */
+    {{ 37.3753871578, 41.0948903598, 20.7861498368, 656.578773583, 62.8100352626, 58.5164895866 }}, /* 3612 K */
+    {{ 37.3758682044, 41.0965601272, 20.786149837, 656.59335963, 62.8110356325, 58.5187711989 }}, /* 3613 K */
+    {{ 37.3763490313, 41.0982294136, 20.7861498371, 656.607929736, 62.8120359711, 58.5210516051 }}, /* 3614 K */
+    {{ 37.3768296388, 41.0998982189, 20.7861498373, 656.62248392, 62.8130362791, 58.5233308067 }}, /* 3615 K */
+    {{ 37.377310027, 41.1015665433, 20.7861498375, 656.637022198, 62.8140365575, 58.5256088052 }}, /* 3616 K */
+    {{ 37.3777901964, 41.1032343868, 20.7861498377, 656.65154459, 62.8150368071, 58.5278856024 }}, /* 3617 K */
+    {{ 37.3782701471, 41.1049017496, 20.7861498379, 656.666051113, 62.8160370288, 58.5301611997 }}, /* 3618 K */
+    {{ 37.3787498795, 41.1065686317, 20.786149838, 656.680541785, 62.8170372233, 58.5324355987 }}, /* 3619 K */
+    {{ 37.3792293937, 41.1082350332, 20.7861498382, 656.695016624, 62.8180373915, 58.5347088011 }}, /* 3620 K */
+    {{ 37.3797086902, 41.1099009543, 20.7861498384, 656.709475646, 62.8190375344, 58.5369808084 }}, /* 3621 K */
+    {{ 37.380187769, 41.1115663949, 20.7861498385, 656.723918871, 62.8200376526, 58.5392516223 }}, /* 3622 K */
+    {{ 37.3806666306, 41.1132313551, 20.7861498387, 656.738346316, 62.8210377471, 58.5415212443 }}, /* 3623 K */
+    {{ 37.3811452752, 41.1148958352, 20.7861498389, 656.752757998, 62.8220378187, 58.5437896759 }}, /* 3624 K */
+    {{ 37.381623703, 41.116559835, 20.786149839, 656.767153936, 62.8230378683, 58.5460569189 }}, /* 3625 K */
+    {{ 37.3821019143, 41.1182233548, 20.7861498392, 656.781534147, 62.8240378967, 58.5483229746 }}, /* 3626 K */
+    {{ 37.3825799094, 41.1198863946, 20.7861498393, 656.795898648, 62.8250379047, 58.5505878449 }}, /* 3627 K */
+    {{ 37.3830576886, 41.1215489545, 20.7861498395, 656.810247457, 62.8260378932, 58.5528515311 }}, /* 3628 K */
+    {{ 37.383535252, 41.1232110345, 20.7861498396, 656.824580593, 62.827037863, 58.5551140349 }}, /* 3629 K */
+    {{ 37.3840126001, 41.1248726348, 20.7861498398, 656.838898072, 62.8280378149, 58.5573753579 }}, /* 3630 K */
+    {{ 37.384489733, 41.1265337555, 20.7861498399, 656.853199913, 62.8290377499, 58.5596355017 }}, /* 3631 K */
+    {{ 37.3849666511, 41.1281943966, 20.7861498401, 656.867486132, 62.8300376687, 58.5618944677 }}, /* 3632 K */
+    {{ 37.3854433545, 41.1298545582, 20.7861498402, 656.881756747, 62.8310375722, 58.5641522577 }}, /* 3633 K */
+    {{ 37.3859198435, 41.1315142405, 20.7861498404, 656.896011777, 62.8320374612, 58.5664088731 }}, /* 3634 K */
+    {{ 37.3863961185, 41.1331734434, 20.7861498405, 656.910251238, 62.8330373366, 58.5686643155 }}, /* 3635 K */
+    {{ 37.3868721797, 41.1348321671, 20.7861498406, 656.924475148, 62.8340371992, 58.5709185865 }}, /* 3636 K */
+    {{ 37.3873480274, 41.1364904117, 20.7861498408, 656.938683524, 62.8350370498, 58.5731716877 }}, /* 3637 K */
+    {{ 37.3878236617, 41.1381481772, 20.7861498409, 656.952876385, 62.8360368893, 58.5754236207 }}, /* 3638 K */
+    {{ 37.388299083, 41.1398054638, 20.786149841, 656.967053747, 62.8370367185, 58.5776743869 }}, /* 3639 K */
+    {{ 37.3887742916, 41.1414622715, 20.7861498411, 656.981215628, 62.8380365382, 58.579923988 }}, /* 3640 K */
+    {{ 37.3892492877, 41.1431186004, 20.7861498413, 656.995362045, 62.8390363494, 58.5821724255 }}, /* 3641 K */
+    {{ 37.3897240716, 41.1447744506, 20.7861498414, 657.009493017, 62.8400361528, 58.584419701 }}, /* 3642 K */
+    {{ 37.3901986435, 41.1464298222, 20.7861498415, 657.023608559, 62.8410359492, 58.586665816 }}, /* 3643 K */
+    {{ 37.3906730037, 41.1480847153, 20.7861498416, 657.03770869, 62.8420357396, 58.5889107722 }}, /* 3644 K */
+    {{ 37.3911471525, 41.14973913, 20.7861498417, 657.051793428, 62.8430355246, 58.591154571 }}, /* 3645 K */
+    {{ 37.3916210901, 41.1513930663, 20.7861498419, 657.065862788, 62.8440353053, 58.593397214 }}, /* 3646 K */
+    {{ 37.3920948168, 41.1530465243, 20.786149842, 657.079916789, 62.8450350823, 58.5956387028 }}, /* 3647 K */
+    {{ 37.3925683329, 41.1546995042, 20.7861498421, 657.093955449, 62.8460348566, 58.5978790389 }}, /* 3648 K */
+    {{ 37.3930416385, 41.156352006, 20.7861498422, 657.107978784, 62.847034629, 58.6001182238 }}, /* 3649 K */
+    {{ 37.3935147341, 41.1580040298, 20.7861498423, 657.121986811, 62.8480344003, 58.6023562592 }}, /* 3650 K */
+    {{ 37.3939876198, 41.1596555757, 20.7861498424, 657.135979548, 62.8490341713, 58.6045931466 }}, /* 3651 K */
+    {{ 37.394460296, 41.1613066438, 20.7861498425, 657.149957013, 62.8500339428, 58.6068288875 }}, /* 3652 K */
+    {{ 37.3949327628, 41.1629572341, 20.7861498426, 657.163919222, 62.8510337158, 58.6090634835 }}, /* 3653 K */
+    {{ 37.3954050205, 41.1646073469, 20.7861498427, 657.177866193, 62.852033491, 58.6112969361 }}, /* 3654 K */
+    {{ 37.3958770694, 41.166256982, 20.7861498428, 657.191797943, 62.8530332693, 58.6135292468 }}, /* 3655 K */
+    {{ 37.3963489098, 41.1679061397, 20.7861498429, 657.205714489, 62.8540330515, 58.6157604173 }}, /* 3656 K */
+    {{ 37.3968205419, 41.1695548201, 20.7861498429, 657.219615848, 62.8550328384, 58.617990449 }}, /* 3657 K */
+    {{ 37.397291966, 41.1712030231, 20.786149843, 657.233502038, 62.8560326309, 58.6202193435 }}, /* 3658 K */
+    {{ 37.3977631823, 41.172850749, 20.7861498431, 657.247373075, 62.8570324298, 58.6224471023 }}, /* 3659 K */
+    {{ 37.3982341911, 41.1744979977, 20.7861498432, 657.261228977, 62.8580322359, 58.624673727 }}, /* 3660 K */
+    {{ 37.3987049927, 41.1761447694, 20.7861498433, 657.275069761, 62.85903205, 58.6268992191 }}, /* 3661 K */
+    {{ 37.3991755873, 41.1777910642, 20.7861498433, 657.288895445, 62.860031873, 58.6291235801 }}, /* 3662 K */
+    {{ 37.3996459752, 41.1794368822, 20.7861498434, 657.302706044, 62.8610317058, 58.6313468115 }}, /* 3663 K */
+    {{ 37.4001161566, 41.1810822234, 20.7861498435, 657.316501576, 62.862031549, 58.633568915 }}, /* 3664 K */
+    {{ 37.4005861318, 41.182727088, 20.7861498436, 657.330282059, 62.8630314037, 58.6357898921 }}, /* 3665 K */
+    {{ 37.401055901, 41.184371476, 20.7861498436, 657.344047508, 62.8640312705, 58.6380097441 }}, /* 3666 K */
+    {{ 37.4015254646, 41.1860153876, 20.7861498437, 657.357797942, 62.8650311504, 58.6402284728 }}, /* 3667 K */
+    {{ 37.4019948228, 41.1876588227, 20.7861498437, 657.371533378, 62.866031044, 58.6424460796 }}, /* 3668 K */
+    {{ 37.4024639758, 41.1893017816, 20.7861498438, 657.385253831, 62.8670309524, 58.6446625661 }}, /* 3669 K */
+    {{ 37.4029329238, 41.1909442642, 20.7861498439, 657.39895932, 62.8680308763, 58.6468779337 }}, /* 3670 K */
+    {{ 37.4034016673, 41.1925862707, 20.7861498439, 657.412649862, 62.8690308165, 58.6490921841 }}, /* 3671 K */
+    {{ 37.4038702063, 41.1942278013, 20.786149844, 657.426325472, 62.8700307738, 58.6513053186 }}, /* 3672 K */
+    {{ 37.4043385412, 41.1958688559, 20.786149844, 657.439986168, 62.8710307492, 58.6535173389 }}, /* 3673 K */
+    {{ 37.4048066722, 41.1975094346, 20.7861498441, 657.453631968, 62.8720307433, 58.6557282465 }}, /* 3674 K */
+    {{ 37.4052745996, 41.1991495376, 20.7861498441, 657.467262887, 62.873030757, 58.6579380428 }}, /* 3675 K */
+    {{ 37.4057423236, 41.2007891649, 20.7861498442, 657.480878943, 62.8740307912, 58.6601467295 }}, /* 3676 K */
+    {{ 37.4062098445, 41.2024283167, 20.7861498442, 657.494480153, 62.8750308467, 58.662354308 }}, /* 3677 K */
+    {{ 37.4066771626, 41.204066993, 20.7861498442, 657.508066533, 62.8760309243, 58.6645607798 }}, /* 3678 K */
+    {{ 37.4071442781, 41.2057051939, 20.7861498443, 657.5216381, 62.8770310248, 58.6667661464 }}, /* 3679 K */
+    {{ 37.4076111912, 41.2073429196, 20.7861498443, 657.535194872, 62.878031149, 58.6689704094 }}, /* 3680 K */
+    {{ 37.4080779022, 41.20898017, 20.7861498443, 657.548736864, 62.8790312978, 58.6711735703 }}, /* 3681 K */
+    {{ 37.4085444115, 41.2106169453, 20.7861498444, 657.562264095, 62.880031472, 58.6733756306 }}, /* 3682 K */
+    {{ 37.4090107191, 41.2122532457, 20.7861498444, 657.575776579, 62.8810316724, 58.6755765917 }}, /* 3683 K */
+    {{ 37.4094768254, 41.2138890711, 20.7861498444, 657.589274335, 62.8820318998, 58.6777764553 }}, /* 3684 K */
+    {{ 37.4099427307, 41.2155244216, 20.7861498445, 657.602757379, 62.8830321551, 58.6799752228 }}, /* 3685 K */
+    {{ 37.4104084352, 41.2171592974, 20.7861498445, 657.616225728, 62.884032439, 58.6821728957 }}, /* 3686 K */
+    {{ 37.4108739391, 41.2187936986, 20.7861498445, 657.629679398, 62.8850327525, 58.6843694754 }}, /* 3687 K */
+    {{ 37.4113392427, 41.2204276253, 20.7861498445, 657.643118406, 62.8860330962, 58.6865649637 }}, /* 3688 K */
+    {{ 37.4118043462, 41.2220610774, 20.7861498445, 657.656542768, 62.8870334711, 58.6887593618 }}, /* 3689 K */
+    {{ 37.41226925, 41.2236940552, 20.7861498445, 657.669952503, 62.8880338779, 58.6909526714 }}, /* 3690 K */
+    {{ 37.4127339542, 41.2253265588, 20.7861498445, 657.683347625, 62.8890343175, 58.6931448938 }}, /* 3691 K */
+    {{ 37.4131984592, 41.2269585881, 20.7861498445, 657.696728152, 62.8900347907, 58.6953360307 }}, /* 3692 K */
+    {{ 37.4136627651, 41.2285901434, 20.7861498446, 657.7100941, 62.8910352983, 58.6975260835 }}, /* 3693 K */
+    {{ 37.4141268722, 41.2302212247, 20.7861498446, 657.723445486, 62.8920358411, 58.6997150537 }}, /* 3694 K */
+    {{ 37.4145907808, 41.231851832, 20.7861498446, 657.736782326, 62.8930364199, 58.7019029429 }}, /* 3695 K */
+    {{ 37.4150544912, 41.2334819656, 20.7861498446, 657.750104638, 62.8940370356, 58.7040897524 }}, /* 3696 K */
+    {{ 37.4155180035, 41.2351116254, 20.7861498445, 657.763412437, 62.895037689, 58.7062754838 }}, /* 3697 K */
+    {{ 37.415981318, 41.2367408117, 20.7861498445, 657.77670574, 62.8960383809, 58.7084601385 }}, /* 3698 K */
+    {{ 37.4164444351, 41.2383695244, 20.7861498445, 657.789984563, 62.8970391121, 58.7106437182 }}, /* 3699 K */
+    {{ 37.4169073549, 41.2399977637, 20.7861498445, 657.803248924, 62.8980398834, 58.7128262242 }}, /* 3700 K */
+    {{ 37.4173700776, 41.2416255296, 20.7861498445, 657.816498839, 62.8990406956, 58.715007658 }}, /* 3701 K */
+    {{ 37.4178326036, 41.2432528223, 20.7861498445, 657.829734323, 62.9000415496, 58.7171880212 }}, /* 3702 K */
+    {{ 37.4182949331, 41.2448796419, 20.7861498445, 657.842955394, 62.9010424461, 58.7193673152 }}, /* 3703 K */
+    {{ 37.4187570663, 41.2465059884, 20.7861498444, 657.856162067, 62.9020433861, 58.7215455414 }}, /* 3704 K */
+    {{ 37.4192190036, 41.2481318619, 20.7861498444, 657.86935436, 62.9030443702, 58.7237227015 }}, /* 3705 K */
+    {{ 37.419680745, 41.2497572626, 20.7861498444, 657.882532289, 62.9040453993, 58.7258987968 }}, /* 3706 K */
+    {{ 37.420142291, 41.2513821905, 20.7861498444, 657.89569587, 62.9050464743, 58.7280738288 }}, /* 3707 K */
+    {{ 37.4206036417, 41.2530066457, 20.7861498443, 657.908845119, 62.9060475959, 58.730247799 }}, /* 3708 K */
+    {{ 37.4210647974, 41.2546306284, 20.7861498443, 657.921980054, 62.9070487649, 58.732420709 }}, /* 3709 K */
+    {{ 37.4215257583, 41.2562541386, 20.7861498443, 657.935100689, 62.9080499822, 58.7345925601 }}, /* 3710 K */
+    {{ 37.4219865248, 41.2578771763, 20.7861498442, 657.948207042, 62.9090512486, 58.7367633538 }}, /* 3711 K */
+    {{ 37.4224470969, 41.2594997418, 20.7861498442, 657.961299129, 62.9100525648, 58.7389330916 }}, /* 3712 K */
+    {{ 37.4229074751, 41.2611218351, 20.7861498442, 657.974376966, 62.9110539318, 58.741101775 }}, /* 3713 K */
+    {{ 37.4233676595, 41.2627434563, 20.7861498441, 657.987440569, 62.9120553502, 58.7432694055 }}, /* 3714 K */
+    {{ 37.4238276504, 41.2643646055, 20.7861498441, 658.000489955, 62.913056821, 58.7454359845 }}, /* 3715 K */
+    {{ 37.424287448, 41.2659852827, 20.786149844, 658.01352514, 62.9140583449, 58.7476015135 }}, /* 3716 K */
+    {{ 37.4247470527, 41.2676054882, 20.786149844, 658.026546139, 62.9150599227, 58.7497659939 }}, /* 3717 K */
+    {{ 37.4252064645, 41.2692252219, 20.7861498439, 658.039552971, 62.9160615552, 58.7519294272 }}, /* 3718 K */
+    {{ 37.4256656838, 41.270844484, 20.7861498438, 658.05254565, 62.9170632434, 58.754091815 }}, /* 3719 K */
+    {{ 37.4261247109, 41.2724632746, 20.7861498438, 658.065524192, 62.9180649879, 58.7562531585 }}, /* 3720 K */
+    {{ 37.426583546, 41.2740815937, 20.7861498437, 658.078488615, 62.9190667895, 58.7584134594 }}, /* 3721 K */
+    {{ 37.4270421892, 41.2756994415, 20.7861498437, 658.091438933, 62.9200686492, 58.7605727191 }}, /* 3722 K */
+    {{ 37.427500641, 41.2773168181, 20.7861498436, 658.104375164, 62.9210705676, 58.7627309389 }}, /* 3723 K */
+    {{ 37.4279589014, 41.2789337235, 20.7861498435, 658.117297323, 62.9220725456, 58.7648881205 }}, /* 3724 K */
+    {{ 37.4284169709, 41.2805501579, 20.7861498435, 658.130205426, 62.923074584, 58.7670442652 }}, /* 3725 K */
+    {{ 37.4288748495, 41.2821661213, 20.7861498434, 658.14309949, 62.9240766836, 58.7691993745 }}, /* 3726 K */
+    {{ 37.4293325376, 41.2837816139, 20.7861498433, 658.15597953, 62.9250788453, 58.7713534498 }}, /* 3727 K */
+    {{ 37.4297900354, 41.2853966357, 20.7861498432, 658.168845563, 62.9260810698, 58.7735064927 }}, /* 3728 K */
+    {{ 37.4302473432, 41.2870111869, 20.7861498432, 658.181697605, 62.9270833579, 58.7756585045 }}, /* 3729 K */
+    {{ 37.4307044611, 41.2886252675, 20.7861498431, 658.194535671, 62.9280857104, 58.7778094867 }}, /* 3730 K */
+    {{ 37.4311613895, 41.2902388776, 20.786149843, 658.207359778, 62.9290881282, 58.7799594408 }}, /* 3731 K */
+    {{ 37.4316181286, 41.2918520174, 20.7861498429, 658.220169942, 62.930090612, 58.7821083681 }}, /* 3732 K */
+    {{ 37.4320746787, 41.2934646869, 20.7861498428, 658.232966179, 62.9310931627, 58.7842562702 }}, /* 3733 K */
+    {{ 37.4325310399, 41.2950768863, 20.7861498427, 658.245748504, 62.932095781, 58.7864031485 }}, /* 3734 K */
+    {{ 37.4329872125, 41.2966886155, 20.7861498426, 658.258516934, 62.9330984677, 58.7885490045 }}, /* 3735 K */
+    {{ 37.4334431968, 41.2982998748, 20.7861498425, 658.271271484, 62.9341012238, 58.7906938395 }}, /* 3736 K */
+    {{ 37.433898993, 41.2999106642, 20.7861498424, 658.284012171, 62.9351040499, 58.792837655 }}, /* 3737 K */
+    {{ 37.4343546014, 41.3015209838, 20.7861498423, 658.29673901, 62.9361069468, 58.7949804525 }}, /* 3738 K */
+    {{ 37.4348100222, 41.3031308337, 20.7861498422, 658.309452017, 62.9371099155, 58.7971222334 }}, /* 3739 K */
+    {{ 37.4352652556, 41.3047402141, 20.7861498421, 658.322151209, 62.9381129566, 58.7992629991 }}, /* 3740 K */
+    {{ 37.4357203019, 41.306349125, 20.786149842, 658.3348366, 62.939116071, 58.8014027511 }}, /* 3741 K */
+    {{ 37.4361751614, 41.3079575665, 20.7861498419, 658.347508208, 62.9401192594, 58.8035414908 }}, /* 3742 K */
+    {{ 37.4366298342, 41.3095655386, 20.7861498418, 658.360166047, 62.9411225228, 58.8056792197 }}, /* 3743 K */
+    {{ 37.4370843206, 41.3111730416, 20.7861498417, 658.372810133, 62.9421258618, 58.8078159391 }}, /* 3744 K */
+    {{ 37.4375386209, 41.3127800755, 20.7861498416, 658.385440483, 62.9431292773, 58.8099516506 }}, /* 3745 K */
+    {{ 37.4379927354, 41.3143866405, 20.7861498414, 658.398057111, 62.9441327701, 58.8120863555 }}, /* 3746 K */
+    {{ 37.4384466641, 41.3159927365, 20.7861498413, 658.410660035, 62.9451363409, 58.8142200552 }}, /* 3747 K */
+    {{ 37.4389004075, 41.3175983637, 20.7861498412, 658.423249269, 62.9461399907, 58.8163527513 }}, /* 3748 K */
+    {{ 37.4393539657, 41.3192035222, 20.7861498411, 658.43582483, 62.9471437201, 58.818484445 }}, /* 3749 K */
+    {{ 37.439807339, 41.3208082122, 20.7861498409, 658.448386732, 62.94814753, 58.8206151379 }}, /* 3750 K */
+    {{ 37.4402605275, 41.3224124336, 20.7861498408, 658.460934992, 62.9491514211, 58.8227448314 }}, /* 3751 K */
+    {{ 37.4407135317, 41.3240161866, 20.7861498407, 658.473469626, 62.9501553944, 58.8248735269 }}, /* 3752 K */
+    {{ 37.4411663517, 41.3256194713, 20.7861498405, 658.485990648, 62.9511594505, 58.8270012258 }}, /* 3753 K */
+    {{ 37.4416189877, 41.3272222879, 20.7861498404, 658.498498075, 62.9521635903, 58.8291279295 }}, /* 3754 K */
+    {{ 37.4420714399, 41.3288246363, 20.7861498403, 658.510991923, 62.9531678146, 58.8312536395 }}, /* 3755 K */
+    {{ 37.4425237087, 41.3304265167, 20.7861498401, 658.523472207, 62.9541721241, 58.8333783572 }}, /* 3756 K */
+    {{ 37.4429757943, 41.3320279292, 20.78614984, 658.535938942, 62.9551765197, 58.8355020839 }}, /* 3757 K */
+    {{ 37.4434276969, 41.333628874, 20.7861498398, 658.548392145, 62.9561810022, 58.8376248212 }}, /* 3758 K */
+    {{ 37.4438794168, 41.335229351, 20.7861498397, 658.56083183, 62.9571855723, 58.8397465703 }}, /* 3759 K */
+    {{ 37.4443309541, 41.3368293604, 20.7861498395, 658.573258014, 62.9581902309, 58.8418673329 }}, /* 3760 K */
+    {{ 37.4447823091, 41.3384289023, 20.7861498394, 658.585670711, 62.9591949787, 58.8439871101 }}, /* 3761 K */
+    {{ 37.4452334822, 41.3400279768, 20.7861498392, 658.598069938, 62.9601998166, 58.8461059035 }}, /* 3762 K */
+    {{ 37.4456844734, 41.3416265841, 20.786149839, 658.610455711, 62.9612047453, 58.8482237145 }}, /* 3763 K */
+    {{ 37.4461352831, 41.3432247241, 20.7861498389, 658.622828043, 62.9622097656, 58.8503405444 }}, /* 3764 K */
+    {{ 37.4465859115, 41.344822397, 20.7861498387, 658.635186952, 62.9632148784, 58.8524563947 }}, /* 3765 K */
+    {{ 37.4470363588, 41.3464196029, 20.7861498385, 658.647532451, 62.9642200844, 58.8545712668 }}, /* 3766 K */
+    {{ 37.4474866252, 41.3480163419, 20.7861498384, 658.659864558, 62.9652253844, 58.8566851621 }}, /* 3767 K */
+    {{ 37.4479367111, 41.3496126141, 20.7861498382, 658.672183287, 62.9662307792, 58.858798082 }}, /* 3768 K */
+    {{ 37.4483866166, 41.3512084197, 20.786149838, 658.684488654, 62.9672362697, 58.8609100279 }}, /* 3769 K */
+    {{ 37.448836342, 41.3528037586, 20.7861498378, 658.696780675, 62.9682418565, 58.8630210012 }}, /* 3770 K */
+    {{ 37.4492858876, 41.354398631, 20.7861498377, 658.709059363, 62.9692475405, 58.8651310032 }}, /* 3771 K */
+    {{ 37.4497352534, 41.355993037, 20.7861498375, 658.721324736, 62.9702533225, 58.8672400355 }}, /* 3772 K */
+    {{ 37.4501844399, 41.3575869768, 20.7861498373, 658.733576808, 62.9712592033, 58.8693480993 }}, /* 3773 K */
+    {{ 37.4506334473, 41.3591804503, 20.7861498371, 658.745815595, 62.9722651837, 58.8714551962 }}, /* 3774 K */
+    {{ 37.4510822757, 41.3607734578, 20.7861498369, 658.758041112, 62.9732712644, 58.8735613274 }}, /* 3775 K */
+    {{ 37.4515309254, 41.3623659993, 20.7861498367, 658.770253374, 62.9742774463, 58.8756664943 }}, /* 3776 K */
+    {{ 37.4519793966, 41.3639580748, 20.7861498365, 658.782452397, 62.9752837301, 58.8777706985 }}, /* 3777 K */
+    {{ 37.4524276897, 41.3655496846, 20.7861498364, 658.794638195, 62.9762901166, 58.8798739412 }}, /* 3778 K */
+    {{ 37.4528758048, 41.3671408287, 20.7861498362, 658.806810786, 62.9772966067, 58.8819762238 }}, /* 3779 K */
+    {{ 37.4533237421, 41.3687315073, 20.786149836, 658.818970182, 62.978303201, 58.8840775478 }}, /* 3780 K */
+    {{ 37.4537715019, 41.3703217203, 20.7861498357, 658.8311164, 62.9793099005, 58.8861779145 }}, /* 3781 K */
+    {{ 37.4542190845, 41.371911468, 20.7861498355, 658.843249456, 62.9803167059, 58.8882773253 }}, /* 3782 K */
+    {{ 37.4546664901, 41.3735007504, 20.7861498353, 658.855369363, 62.9813236179, 58.8903757816 }}, /* 3783 K */
+    {{ 37.4551137188, 41.3750895676, 20.7861498351, 658.867476138, 62.9823306375, 58.8924732847 }}, /* 3784 K */
+    {{ 37.455560771, 41.3766779198, 20.7861498349, 658.879569796, 62.9833377652, 58.8945698361 }}, /* 3785 K */
+    {{ 37.4560076469, 41.378265807, 20.7861498347, 658.891650351, 62.9843450021, 58.8966654372 }}, /* 3786 K */
+    {{ 37.4564543467, 41.3798532293, 20.7861498345, 658.903717819, 62.9853523487, 58.8987600893 }}, /* 3787 K */
+    {{ 37.4569008706, 41.3814401868, 20.7861498343, 658.915772216, 62.986359806, 58.9008537937 }}, /* 3788 K */
+    {{ 37.457347219, 41.3830266797, 20.786149834, 658.927813555, 62.9873673747, 58.902946552 }}, /* 3789 K */
+    {{ 37.4577933919, 41.384612708, 20.7861498338, 658.939841853, 62.9883750556, 58.9050383653 }}, /* 3790 K */
+    {{ 37.4582393897, 41.3861982719, 20.7861498336, 658.951857124, 62.9893828495, 58.9071292352 }}, /* 3791 K */
+    {{ 37.4586852126, 41.3877833714, 20.7861498334, 658.963859384, 62.9903907571, 58.909219163 }}, /* 3792 K */
+    {{ 37.4591308609, 41.3893680067, 20.7861498331, 658.975848647, 62.9913987793, 58.9113081501 }}, /* 3793 K */
+    {{ 37.4595763347, 41.3909521778, 20.7861498329, 658.987824929, 62.9924069169, 58.9133961978 }}, /* 3794 K */
+    {{ 37.4600216343, 41.3925358849, 20.7861498327, 658.999788245, 62.9934151706, 58.9154833075 }}, /* 3795 K */
+    {{ 37.4604667599, 41.3941191281, 20.7861498324, 659.011738609, 62.9944235411, 58.9175694806 }}, /* 3796 K */
+    {{ 37.4609117118, 41.3957019074, 20.7861498322, 659.023676037, 62.9954320294, 58.9196547184 }}, /* 3797 K */
+    {{ 37.4613564902, 41.3972842229, 20.7861498319, 659.035600544, 62.9964406362, 58.9217390224 }}, /* 3798 K */
+    {{ 37.4618010953, 41.3988660749, 20.7861498317, 659.047512144, 62.9974493623, 58.9238223938 }}, /* 3799 K */
+    {{ 37.4622455274, 41.4004474633, 20.7861498314, 659.059410853, 62.9984582084, 58.925904834 }}, /* 3800 K */
+    {{ 37.4626897867, 41.4020283883, 20.7861498312, 659.071296686, 62.9994671753, 58.9279863445 }}, /* 3801 K */
+    {{ 37.4631338734, 41.4036088499, 20.7861498309, 659.083169657, 63.0004762638, 58.9300669265 }}, /* 3802 K */
+    {{ 37.4635777878, 41.4051888484, 20.7861498307, 659.095029781, 63.0014854748, 58.9321465815 }}, /* 3803 K */
+    {{ 37.4640215301, 41.4067683837, 20.7861498304, 659.106877074, 63.0024948089, 58.9342253107 }}, /* 3804 K */
+    {{ 37.4644651005, 41.4083474561, 20.7861498302, 659.11871155, 63.0035042671, 58.9363031155 }}, /* 3805 K */
+    {{ 37.4649084993, 41.4099260655, 20.7861498299, 659.130533224, 63.0045138499, 58.9383799974 }}, /* 3806 K */
+    {{ 37.4653517267, 41.4115042121, 20.7861498296, 659.142342111, 63.0055235583, 58.9404559576 }}, /* 3807 K */
+    {{ 37.465794783, 41.4130818961, 20.7861498294, 659.154138226, 63.0065333931, 58.9425309975 }}, /* 3808 K */
+    {{ 37.4662376683, 41.4146591174, 20.7861498291, 659.165921584, 63.0075433549, 58.9446051185 }}, /* 3809 K */
+    {{ 37.4666803829, 41.4162358763, 20.7861498288, 659.177692199, 63.0085534446, 58.9466783219 }}, /* 3810 K */
+    {{ 37.467122927, 41.4178121727, 20.7861498286, 659.189450086, 63.009563663, 58.948750609 }}, /* 3811 K */
+    {{ 37.4675653009, 41.4193880069, 20.7861498283, 659.20119526, 63.0105740108, 58.9508219812 }}, /* 3812 K */
+    {{ 37.4680075047, 41.4209633789, 20.786149828, 659.212927737, 63.0115844888, 58.9528924399 }}, /* 3813 K */
+    {{ 37.4684495388, 41.4225382889, 20.7861498277, 659.224647529, 63.0125950978, 58.9549619864 }}, /* 3814 K */
+    {{ 37.4688914034, 41.4241127369, 20.7861498274, 659.236354653, 63.0136058386, 58.9570306221 }}, /* 3815 K */
+    {{ 37.4693330986, 41.425686723, 20.7861498272, 659.248049123, 63.014616712, 58.9590983482 }}, /* 3816 K */
+    {{ 37.4697746248, 41.4272602474, 20.7861498269, 659.259730954, 63.0156277187, 58.9611651662 }}, /* 3817 K */
+    {{ 37.4702159821, 41.4288333101, 20.7861498266, 659.27140016, 63.0166388596, 58.9632310773 }}, /* 3818 K */
+    {{ 37.4706571708, 41.4304059113, 20.7861498263, 659.283056757, 63.0176501353, 58.965296083 }}, /* 3819 K */
+    {{ 37.4710981911, 41.431978051, 20.786149826, 659.294700758, 63.0186615467, 58.9673601845 }}, /* 3820 K */
+    {{ 37.4715390432, 41.4335497295, 20.7861498257, 659.306332179, 63.0196730946, 58.9694233832 }}, /* 3821 K */
+    {{ 37.4719797274, 41.4351209466, 20.7861498254, 659.317951033, 63.0206847797, 58.9714856805 }}, /* 3822 K */
+    {{ 37.4724202439, 41.4366917027, 20.7861498251, 659.329557337, 63.0216966029, 58.9735470776 }}, /* 3823 K */
+    {{ 37.472860593, 41.4382619977, 20.7861498248, 659.341151103, 63.0227085648, 58.9756075759 }}, /* 3824 K */
+    {{ 37.4733007748, 41.4398318319, 20.7861498245, 659.352732348, 63.0237206663, 58.9776671767 }}, /* 3825 K */
+    {{ 37.4737407896, 41.4414012052, 20.7861498242, 659.364301085, 63.0247329081, 58.9797258814 }}, /* 3826 K */
+    {{ 37.4741806376, 41.4429701178, 20.7861498239, 659.37585733, 63.0257452911, 58.9817836913 }}, /* 3827 K */
+    {{ 37.4746203191, 41.4445385698, 20.7861498236, 659.387401095, 63.0267578159, 58.9838406077 }}, /* 3828 K */
+    {{ 37.4750598342, 41.4461065614, 20.7861498232, 659.398932397, 63.0277704834, 58.985896632 }}, /* 3829 K */
+    {{ 37.4754991833, 41.4476740925, 20.7861498229, 659.41045125, 63.0287832944, 58.9879517655 }}, /* 3830 K */
+    {{ 37.4759383665, 41.4492411634, 20.7861498226, 659.421957668, 63.0297962496, 58.9900060094 }}, /* 3831 K */
+    {{ 37.4763773841, 41.4508077741, 20.7861498223, 659.433451665, 63.0308093498, 58.9920593652 }}, /* 3832 K */
+    {{ 37.4768162362, 41.4523739248, 20.786149822, 659.444933257, 63.0318225958, 58.9941118342 }}, /* 3833 K */
+    {{ 37.4772549232, 41.4539396155, 20.7861498216, 659.456402457, 63.0328359884, 58.9961634176 }}, /* 3834 K */
+    {{ 37.4776934453, 41.4555048463, 20.7861498213, 659.467859281, 63.0338495282, 58.9982141168 }}, /* 3835 K */
+    {{ 37.4781318026, 41.4570696174, 20.786149821, 659.479303741, 63.0348632162, 59.0002639331 }}, /* 3836 K */
+    {{ 37.4785699954, 41.4586339289, 20.7861498206, 659.490735854, 63.035877053, 59.0023128679 }}, /* 3837 K */
+    {{ 37.479008024, 41.4601977808, 20.7861498203, 659.502155633, 63.0368910395, 59.0043609224 }}, /* 3838 K */
+    {{ 37.4794458885, 41.4617611733, 20.7861498199, 659.513563093, 63.0379051764, 59.006408098 }}, /* 3839 K */
+    {{ 37.4798835893, 41.4633241064, 20.7861498196, 659.524958248, 63.0389194645, 59.0084543959 }}, /* 3840 K */
+    {{ 37.4803211264, 41.4648865804, 20.7861498193, 659.536341112, 63.0399339046, 59.0104998176 }}, /* 3841 K */
+    {{ 37.4807585002, 41.4664485953, 20.7861498189, 659.5477117, 63.0409484974, 59.0125443643 }}, /* 3842 K */
+    {{ 37.4811957109, 41.4680101511, 20.7861498186, 659.559070026, 63.0419632437, 59.0145880373 }}, /* 3843 K */
+    {{ 37.4816327587, 41.4695712481, 20.7861498182, 659.570416105, 63.0429781444, 59.0166308379 }}, /* 3844 K */
+    {{ 37.4820696438, 41.4711318863, 20.7861498179, 659.58174995, 63.0439932, 59.0186727674 }}, /* 3845 K */
+    {{ 37.4825063665, 41.4726920658, 20.7861498175, 659.593071576, 63.0450084115, 59.0207138272 }}, /* 3846 K */
+    {{ 37.4829429269, 41.4742517867, 20.7861498171, 659.604380998, 63.0460237796, 59.0227540186 }}, /* 3847 K */
+    {{ 37.4833793254, 41.4758110492, 20.7861498168, 659.615678229, 63.0470393051, 59.0247933428 }}, /* 3848 K */
+    {{ 37.4838155621, 41.4773698533, 20.7861498164, 659.626963284, 63.0480549887, 59.0268318011 }}, /* 3849 K */
+    {{ 37.4842516372, 41.4789281992, 20.7861498161, 659.638236177, 63.0490708312, 59.028869395 }}, /* 3850 K */
+    {{ 37.4846875511, 41.4804860869, 20.7861498157, 659.649496922, 63.0500868335, 59.0309061256 }}, /* 3851 K */
+    {{ 37.4851233039, 41.4820435166, 20.7861498153, 659.660745534, 63.0511029961, 59.0329419942 }}, /* 3852 K */
+    {{ 37.4855588958, 41.4836004884, 20.786149815, 659.671982026, 63.05211932, 59.0349770023 }}, /* 3853 K */
+    {{ 37.4859943271, 41.4851570023, 20.7861498146, 659.683206413, 63.0531358059, 59.0370111509 }}, /* 3854 K */
+    {{ 37.486429598, 41.4867130585, 20.7861498142, 659.694418709, 63.0541524546, 59.0390444416 }}, /* 3855 K */
+    {{ 37.4868647087, 41.4882686572, 20.7861498138, 659.705618929, 63.0551692667, 59.0410768755 }}, /* 3856 K */
+    {{ 37.4872996594, 41.4898237983, 20.7861498134, 659.716807085, 63.0561862432, 59.0431084539 }}, /* 3857 K */
+    {{ 37.4877344504, 41.4913784821, 20.7861498131, 659.727983193, 63.0572033848, 59.0451391782 }}, /* 3858 K */
+    {{ 37.4881690819, 41.4929327086, 20.7861498127, 659.739147266, 63.0582206921, 59.0471690496 }}, /* 3859 K */
+    {{ 37.4886035542, 41.4944864779, 20.7861498123, 659.750299319, 63.0592381661, 59.0491980695 }}, /* 3860 K */
+    {{ 37.4890378673, 41.4960397901, 20.7861498119, 659.761439365, 63.0602558075, 59.051226239 }}, /* 3861 K */
+    {{ 37.4894720217, 41.4975926454, 20.7861498115, 659.772567419, 63.061273617, 59.0532535596 }}, /* 3862 K */
+    {{ 37.4899060174, 41.4991450439, 20.7861498111, 659.783683495, 63.0622915954, 59.0552800324 }}, /* 3863 K */
+    {{ 37.4903398548, 41.5006969856, 20.7861498107, 659.794787606, 63.0633097435, 59.0573056588 }}, /* 3864 K */
+    {{ 37.490773534, 41.5022484707, 20.7861498103, 659.805879767, 63.064328062, 59.0593304401 }}, /* 3865 K */
+    {{ 37.4912070553, 41.5037994993, 20.7861498099, 659.816959992, 63.0653465518, 59.0613543775 }}, /* 3866 K */
+    {{ 37.4916404189, 41.5053500714, 20.7861498095, 659.828028295, 63.0663652135, 59.0633774723 }}, /* 3867 K */
+    {{ 37.492073625, 41.5069001873, 20.7861498091, 659.839084689, 63.067384048, 59.0653997258 }}, /* 3868 K */
+    {{ 37.4925066738, 41.5084498469, 20.7861498087, 659.850129189, 63.0684030559, 59.0674211394 }}, /* 3869 K */
+    {{ 37.4929395656, 41.5099990505, 20.7861498083, 659.861161809, 63.0694222381, 59.0694417141 }}, /* 3870 K */
+    {{ 37.4933723006, 41.5115477981, 20.7861498079, 659.872182562, 63.0704415954, 59.0714614514 }}, /* 3871 K */
+    {{ 37.4938048789, 41.5130960898, 20.7861498074, 659.883191462, 63.0714611285, 59.0734803526 }}, /* 3872 K */
+    {{ 37.494237301, 41.5146439258, 20.786149807, 659.894188524, 63.0724808381, 59.0754984188 }}, /* 3873 K */
+    {{ 37.4946695669, 41.5161913062, 20.7861498066, 659.905173761, 63.0735007251, 59.0775156514 }}, /* 3874 K */
+    {{ 37.4951016768, 41.5177382309, 20.7861498062, 659.916147187, 63.0745207902, 59.0795320516 }}, /* 3875 K */
+    {{ 37.4955336311, 41.5192847003, 20.7861498058, 659.927108817, 63.0755410341, 59.0815476207 }}, /* 3876 K */
+    {{ 37.4959654299, 41.5208307143, 20.7861498053, 659.938058662, 63.0765614577, 59.08356236 }}, /* 3877 K */
+    {{ 37.4963970734, 41.5223762732, 20.7861498049, 659.948996739, 63.0775820616, 59.0855762707 }}, /* 3878 K */
+    {{ 37.496828562, 41.5239213769, 20.7861498045, 659.95992306, 63.0786028467, 59.0875893542 }}, /* 3879 K */
+    {{ 37.4972598957, 41.5254660256, 20.786149804, 659.970837639, 63.0796238137, 59.0896016116 }}, /* 3880 K */
+    {{ 37.4976910748, 41.5270102195, 20.7861498036, 659.98174049, 63.0806449634, 59.0916130443 }}, /* 3881 K */
+    {{ 37.4981220996, 41.5285539585, 20.7861498032, 659.992631627, 63.0816662965, 59.0936236534 }}, /* 3882 K */
+    {{ 37.4985529702, 41.530097243, 20.7861498027, 660.003511064, 63.0826878138, 59.0956334404 }}, /* 3883 K */
+    {{ 37.4989836869, 41.5316400728, 20.7861498023, 660.014378813, 63.0837095161, 59.0976424064 }}, /* 3884 K */
+    {{ 37.4994142499, 41.5331824482, 20.7861498018, 660.02523489, 63.0847314041, 59.0996505526 }}, /* 3885 K */
+    {{ 37.4998446595, 41.5347243693, 20.7861498014, 660.036079308, 63.0857534786, 59.1016578805 }}, /* 3886 K */
+    {{ 37.5002749158, 41.5362658362, 20.7861498009, 660.046912079, 63.0867757403, 59.1036643911 }}, /* 3887 K */
+    {{ 37.5007050191, 41.5378068489, 20.7861498005, 660.057733219, 63.0877981901, 59.1056700858 }}, /* 3888 K */
+    {{ 37.5011349695, 41.5393474076, 20.7861498, 660.068542741, 63.0888208286, 59.1076749658 }}, /* 3889 K */
+    {{ 37.5015647674, 41.5408875125, 20.7861497996, 660.079340658, 63.0898436567, 59.1096790324 }}, /* 3890 K */
+    {{ 37.5019944129, 41.5424271635, 20.7861497991, 660.090126985, 63.090866675, 59.1116822868 }}, /* 3891 K */
+    {{ 37.5024239063, 41.5439663609, 20.7861497986, 660.100901734, 63.0918898844, 59.1136847303 }}, /* 3892 K */
+    {{ 37.5028532477, 41.5455051047, 20.7861497982, 660.111664919, 63.0929132856, 59.1156863641 }}, /* 3893 K */
+    {{ 37.5032824374, 41.5470433951, 20.7861497977, 660.122416554, 63.0939368794, 59.1176871895 }}, /* 3894 K */
+    {{ 37.5037114757, 41.5485812321, 20.7861497972, 660.133156653, 63.0949606665, 59.1196872078 }}, /* 3895 K */
+    {{ 37.5041403627, 41.5501186159, 20.7861497968, 660.143885229, 63.0959846477, 59.1216864201 }}, /* 3896 K */
+    {{ 37.5045690986, 41.5516555466, 20.7861497963, 660.154602295, 63.0970088238, 59.1236848277 }}, /* 3897 K */
+    {{ 37.5049976838, 41.5531920242, 20.7861497958, 660.165307865, 63.0980331954, 59.1256824319 }}, /* 3898 K */
+    {{ 37.5054261183, 41.554728049, 20.7861497953, 660.176001954, 63.0990577634, 59.1276792339 }}, /* 3899 K */
+    {{ 37.5058544025, 41.556263621, 20.7861497949, 660.186684573, 63.1000825286, 59.129675235 }}, /* 3900 K */
+    {{ 37.5062825364, 41.5577987403, 20.7861497944, 660.197355737, 63.1011074916, 59.1316704363 }}, /* 3901 K */
+    {{ 37.5067105205, 41.559333407, 20.7861497939, 660.20801546, 63.1021326533, 59.1336648392 }}, /* 3902 K */
+    {{ 37.5071383548, 41.5608676212, 20.7861497934, 660.218663754, 63.1031580143, 59.1356584448 }}, /* 3903 K */
+    {{ 37.5075660396, 41.5624013832, 20.7861497929, 660.229300633, 63.1041835755, 59.1376512545 }}, /* 3904 K */
+    {{ 37.5079935752, 41.5639346929, 20.7861497924, 660.239926111, 63.1052093377, 59.1396432694 }}, /* 3905 K */
+    {{ 37.5084209617, 41.5654675504, 20.7861497919, 660.250540201, 63.1062353015, 59.1416344908 }}, /* 3906 K */
+    {{ 37.5088481993, 41.566999956, 20.7861497914, 660.261142916, 63.1072614677, 59.1436249199 }}, /* 3907 K */
+    {{ 37.5092752883, 41.5685319096, 20.7861497909, 660.27173427, 63.1082878371, 59.1456145579 }}, /* 3908 K */
+    {{ 37.5097022289, 41.5700634115, 20.7861497904, 660.282314276, 63.1093144104, 59.1476034061 }}, /* 3909 K */
+    {{ 37.5101290213, 41.5715944617, 20.7861497899, 660.292882948, 63.1103411884, 59.1495914657 }}, /* 3910 K */
+    {{ 37.5105556658, 41.5731250603, 20.7861497894, 660.303440299, 63.1113681719, 59.151578738 }}, /* 3911 K */
+    {{ 37.5109821625, 41.5746552074, 20.7861497889, 660.313986342, 63.1123953616, 59.1535652241 }}, /* 3912 K */
+    {{ 37.5114085117, 41.5761849032, 20.7861497884, 660.324521091, 63.1134227582, 59.1555509253 }}, /* 3913 K */
+    {{ 37.5118347135, 41.5777141478, 20.7861497879, 660.335044558, 63.1144503626, 59.1575358428 }}, /* 3914 K */
+    {{ 37.5122607683, 41.5792429413, 20.7861497874, 660.345556758, 63.1154781754, 59.1595199779 }}, /* 3915 K */
+    {{ 37.5126866762, 41.5807712837, 20.7861497869, 660.356057704, 63.1165061975, 59.1615033317 }}, /* 3916 K */
+    {{ 37.5131124374, 41.5822991753, 20.7861497863, 660.366547408, 63.1175344295, 59.1634859055 }}, /* 3917 K */
+    {{ 37.5135380522, 41.583826616, 20.7861497858, 660.377025884, 63.1185628723, 59.1654677005 }}, /* 3918 K */
+    {{ 37.5139635208, 41.5853536061, 20.7861497853, 660.387493146, 63.1195915265, 59.167448718 }}, /* 3919 K */
+    {{ 37.5143888434, 41.5868801457, 20.7861497848, 660.397949206, 63.120620393, 59.169428959 }}, /* 3920 K */
+    {{ 37.5148140202, 41.5884062347, 20.7861497843, 660.408394078, 63.1216494725, 59.171408425 }}, /* 3921 K */
+    {{ 37.5152390514, 41.5899318735, 20.7861497837, 660.418827775, 63.1226787657, 59.173387117 }}, /* 3922 K */
+    {{ 37.5156639372, 41.591457062, 20.7861497832, 660.429250311, 63.1237082734, 59.1753650363 }}, /* 3923 K */
+    {{ 37.516088678, 41.5929818004, 20.7861497827, 660.439661697, 63.1247379964, 59.1773421841 }}, /* 3924 K */
+    {{ 37.5165132738, 41.5945060888, 20.7861497821, 660.450061948, 63.1257679353, 59.1793185616 }}, /* 3925 K */
+    {{ 37.5169377249, 41.5960299273, 20.7861497816, 660.460451077, 63.1267980911, 59.1812941701 }}, /* 3926 K */
+    {{ 37.5173620316, 41.5975533161, 20.786149781, 660.470829097, 63.1278284643, 59.1832690107 }}, /* 3927 K */
+    {{ 37.5177861939, 41.5990762551, 20.7861497805, 660.48119602, 63.1288590558, 59.1852430846 }}, /* 3928 K */
+    {{ 37.5182102123, 41.6005987446, 20.78614978, 660.491551861, 63.1298898663, 59.1872163931 }}, /* 3929 K */
+    {{ 37.5186340868, 41.6021207847, 20.7861497794, 660.501896632, 63.1309208966, 59.1891889373 }}, /* 3930 K */
+    {{ 37.5190578176, 41.6036423755, 20.7861497789, 660.512230346, 63.1319521474, 59.1911607185 }}, /* 3931 K */
+    {{ 37.5194814051, 41.605163517, 20.7861497783, 660.522553016, 63.1329836194, 59.1931317379 }}, /* 3932 K */
+    {{ 37.5199048494, 41.6066842095, 20.7861497777, 660.532864656, 63.1340153135, 59.1951019966 }}, /* 3933 K */
+    {{ 37.5203281508, 41.6082044529, 20.7861497772, 660.543165278, 63.1350472303, 59.197071496 }}, /* 3934 K */
+    {{ 37.5207513093, 41.6097242475, 20.7861497766, 660.553454895, 63.1360793706, 59.199040237 }}, /* 3935 K */
+    {{ 37.5211743254, 41.6112435933, 20.7861497761, 660.563733521, 63.1371117353, 59.2010082211 }}, /* 3936 K */
+    {{ 37.5215971991, 41.6127624904, 20.7861497755, 660.574001168, 63.1381443249, 59.2029754493 }}, /* 3937 K */
+    {{ 37.5220199308, 41.6142809391, 20.7861497749, 660.58425785, 63.1391771403, 59.2049419229 }}, /* 3938 K */
+    {{ 37.5224425205, 41.6157989392, 20.7861497744, 660.594503579, 63.1402101822, 59.2069076431 }}, /* 3939 K */
+    {{ 37.5228649686, 41.6173164911, 20.7861497738, 660.604738368, 63.1412434514, 59.208872611 }}, /* 3940 K */
+    {{ 37.5232872752, 41.6188335948, 20.7861497732, 660.614962231, 63.1422769485, 59.2108368278 }}, /* 3941 K */
+    {{ 37.5237094406, 41.6203502504, 20.7861497727, 660.62517518, 63.1433106745, 59.2128002948 }}, /* 3942 K */
+    {{ 37.524131465, 41.621866458, 20.7861497721, 660.635377228, 63.1443446299, 59.2147630131 }}, /* 3943 K */
+    {{ 37.5245533485, 41.6233822178, 20.7861497715, 660.645568388, 63.1453788157, 59.216724984 }}, /* 3944 K */
+    {{ 37.5249750915, 41.6248975298, 20.7861497709, 660.655748673, 63.1464132324, 59.2186862085 }}, /* 3945 K */
+    {{ 37.5253966941, 41.6264123942, 20.7861497703, 660.665918096, 63.1474478809, 59.220646688 }}, /* 3946 K */
+    {{ 37.5258181565, 41.6279268111, 20.7861497698, 660.676076669, 63.1484827618, 59.2226064235 }}, /* 3947 K */
+    {{ 37.526239479, 41.6294407806, 20.7861497692, 660.686224406, 63.149517876, 59.2245654163 }}, /* 3948 K */
+    {{ 37.5266606617, 41.6309543027, 20.7861497686, 660.696361319, 63.1505532243, 59.2265236675 }}, /* 3949 K */
+    {{ 37.527081705, 41.6324673777, 20.786149768, 660.706487421, 63.1515888072, 59.2284811784 }}, /* 3950 K */
+    {{ 37.5275026089, 41.6339800057, 20.7861497674, 660.716602726, 63.1526246257, 59.2304379501 }}, /* 3951 K */
+    {{ 37.5279233737, 41.6354921866, 20.7861497668, 660.726707245, 63.1536606804, 59.2323939838 }}, /* 3952 K */
+    {{ 37.5283439997, 41.6370039208, 20.7861497662, 660.736800991, 63.154696972, 59.2343492806 }}, /* 3953 K */
+    {{ 37.528764487, 41.6385152082, 20.7861497656, 660.746883978, 63.1557335014, 59.2363038418 }}, /* 3954 K */
+    {{ 37.5291848358, 41.640026049, 20.786149765, 660.756956218, 63.1567702693, 59.2382576686 }}, /* 3955 K */
+    {{ 37.5296050464, 41.6415364433, 20.7861497644, 660.767017723, 63.1578072764, 59.240210762 }}, /* 3956 K */
+    {{ 37.530025119, 41.6430463912, 20.7861497638, 660.777068507, 63.1588445235, 59.2421631233 }}, /* 3957 K */
+    {{ 37.5304450538, 41.6445558929, 20.7861497632, 660.787108582, 63.1598820113, 59.2441147537 }}, /* 3958 K */
+    {{ 37.530864851, 41.6460649484, 20.7861497626, 660.797137962, 63.1609197405, 59.2460656542 }}, /* 3959 K */
+    {{ 37.5312845109, 41.6475735579, 20.786149762, 660.807156657, 63.1619577119, 59.2480158262 }}, /* 3960 K */
+    {{ 37.5317040335, 41.6490817214, 20.7861497614, 660.817164682, 63.1629959263, 59.2499652707 }}, /* 3961 K */
+    {{ 37.5321234193, 41.6505894391, 20.7861497607, 660.827162049, 63.1640343843, 59.251913989 }}, /* 3962 K */
+    {{ 37.5325426682, 41.6520967112, 20.7861497601, 660.837148771, 63.1650730868, 59.2538619821 }}, /* 3963 K */
+    {{ 37.5329617807, 41.6536035376, 20.7861497595, 660.847124859, 63.1661120345, 59.2558092513 }}, /* 3964 K */
+    {{ 37.5333807568, 41.6551099186, 20.7861497589, 660.857090327, 63.1671512281, 59.2577557977 }}, /* 3965 K */
+    {{ 37.5337995969, 41.6566158542, 20.7861497582, 660.867045188, 63.1681906684, 59.2597016226 }}, /* 3966 K */
+    {{ 37.5342183011, 41.6581213446, 20.7861497576, 660.876989454, 63.1692303561, 59.2616467269 }}, /* 3967 K */
+    {{ 37.5346368696, 41.6596263898, 20.786149757, 660.886923137, 63.1702702919, 59.263591112 }}, /* 3968 K */
+    {{ 37.5350553026, 41.6611309901, 20.7861497564, 660.89684625, 63.1713104766, 59.2655347789 }}, /* 3969 K */
+    {{ 37.5354736004, 41.6626351454, 20.7861497557, 660.906758806, 63.172350911, 59.2674777289 }}, /* 3970 K */
+    {{ 37.5358917632, 41.664138856, 20.7861497551, 660.916660817, 63.1733915957, 59.2694199631 }}, /* 3971 K */
+    {{ 37.5363097911, 41.6656421219, 20.7861497545, 660.926552296, 63.1744325316, 59.2713614826 }}, /* 3972 K */
+    {{ 37.5367276844, 41.6671449432, 20.7861497538, 660.936433255, 63.1754737193, 59.2733022886 }}, /* 3973 K */
+    {{ 37.5371454434, 41.6686473201, 20.7861497532, 660.946303707, 63.1765151596, 59.2752423822 }}, /* 3974 K */
+    {{ 37.5375630681, 41.6701492527, 20.7861497525, 660.956163664, 63.1775568533, 59.2771817647 }}, /* 3975 K */
+    {{ 37.5379805589, 41.6716507411, 20.7861497519, 660.966013138, 63.1785988011, 59.2791204371 }}, /* 3976 K */
+    {{ 37.538397916, 41.6731517853, 20.7861497512, 660.975852143, 63.1796410037, 59.2810584006 }}, /* 3977 K */
+    {{ 37.5388151394, 41.6746523856, 20.7861497506, 660.98568069, 63.1806834619, 59.2829956564 }}, /* 3978 K */
+    {{ 37.5392322296, 41.676152542, 20.7861497499, 660.995498791, 63.1817261764, 59.2849322056 }}, /* 3979 K */
+    {{ 37.5396491866, 41.6776522547, 20.7861497493, 661.005306461, 63.1827691479, 59.2868680493 }}, /* 3980 K */
+    {{ 37.5400660107, 41.6791515238, 20.7861497486, 661.01510371, 63.1838123773, 59.2888031887 }}, /* 3981 K */
+    {{ 37.5404827022, 41.6806503493, 20.786149748, 661.024890551, 63.1848558651, 59.290737625 }}, /* 3982 K */
+    {{ 37.5408992611, 41.6821487314, 20.7861497473, 661.034666997, 63.1858996123, 59.2926713592 }}, /* 3983 K */
+    {{ 37.5413156878, 41.6836466702, 20.7861497466, 661.044433059, 63.1869436194, 59.2946043926 }}, /* 3984 K */
+    {{ 37.5417319824, 41.6851441659, 20.786149746, 661.054188751, 63.1879878874, 59.2965367262 }}, /* 3985 K */
+    {{ 37.5421481451, 41.6866412185, 20.7861497453, 661.063934084, 63.1890324168, 59.2984683613 }}, /* 3986 K */
+    {{ 37.5425641762, 41.6881378282, 20.7861497446, 661.073669071, 63.1900772084, 59.3003992988 }}, /* 3987 K */
+    {{ 37.5429800759, 41.689633995, 20.786149744, 661.083393724, 63.191122263, 59.3023295401 }}, /* 3988 K */
+    {{ 37.5433958443, 41.6911297191, 20.7861497433, 661.093108056, 63.1921675814, 59.3042590862 }}, /* 3989 K */
+    {{ 37.5438114818, 41.6926250006, 20.7861497426, 661.102812078, 63.1932131642, 59.3061879382 }}, /* 3990 K */
+    {{ 37.5442269884, 41.6941198396, 20.7861497419, 661.112505803, 63.1942590121, 59.3081160973 }}, /* 3991 K */
+    {{ 37.5446423645, 41.6956142363, 20.7861497413, 661.122189243, 63.195305126, 59.3100435647 }}, /* 3992 K */
+    {{ 37.5450576102, 41.6971081907, 20.7861497406, 661.131862411, 63.1963515066, 59.3119703413 }}, /* 3993 K */
+    {{ 37.5454727257, 41.698601703, 20.7861497399, 661.141525319, 63.1973981546, 59.3138964285 }}, /* 3994 K */
+    {{ 37.5458877113, 41.7000947733, 20.7861497392, 661.151177978, 63.1984450707, 59.3158218273 }}, /* 3995 K */
+    {{ 37.5463025671, 41.7015874016, 20.7861497385, 661.160820401, 63.1994922557, 59.3177465388 }}, /* 3996 K */
+    {{ 37.5467172934, 41.7030795882, 20.7861497378, 661.170452601, 63.2005397103, 59.3196705641 }}, /* 3997 K */
+    {{ 37.5471318904, 41.7045713331, 20.7861497371, 661.180074589, 63.2015874352, 59.3215939045 }}, /* 3998 K */
+    {{ 37.5475463582, 41.7060626364, 20.7861497364, 661.189686378, 63.2026354313, 59.3235165609 }}, /* 3999 K */
+    {{ 37.5479606972, 41.7075534983, 20.7861497357, 661.199287979, 63.2036836991, 59.3254385346 }}, /* 4000 K */
+    {{ 37.5483749074, 41.7090439189, 20.786149735, 661.208879405, 63.2047322396, 59.3273598267 }}, /* 4001 K */
+    {{ 37.5487889892, 41.7105338982, 20.7861497343, 661.218460668, 63.2057810533, 59.3292804382 }}, /* 4002 K */
+    {{ 37.5492029427, 41.7120234365, 20.7861497336, 661.22803178, 63.2068301411, 59.3312003704 }}, /* 4003 K */
+    {{ 37.5496167682, 41.7135125338, 20.7861497329, 661.237592753, 63.2078795036, 59.3331196242 }}, /* 4004 K */
+    {{ 37.5500304657, 41.7150011902, 20.7861497322, 661.247143599, 63.2089291417, 59.3350382009 }}, /* 4005 K */
+    {{ 37.5504440357, 41.7164894059, 20.7861497315, 661.256684331, 63.209979056, 59.3369561015 }}, /* 4006 K */
+    {{ 37.5508574782, 41.717977181, 20.7861497308, 661.26621496, 63.2110292472, 59.3388733272 }}, /* 4007 K */
+    {{ 37.5512707935, 41.7194645155, 20.7861497301, 661.275735498, 63.2120797162, 59.3407898791 }}, /* 4008 K */
+    {{ 37.5516839818, 41.7209514097, 20.7861497294, 661.285245957, 63.2131304636, 59.3427057582 }}, /* 4009 K */
+    {{ 37.5520970433, 41.7224378635, 20.7861497287, 661.29474635, 63.2141814903, 59.3446209658 }}, /* 4010 K */
+    {{ 37.5525099781, 41.7239238772, 20.786149728, 661.304236689, 63.2152327968, 59.3465355028 }}, /* 4011 K */
+    {{ 37.5529227866, 41.7254094509, 20.7861497272, 661.313716984, 63.216284384, 59.3484493705 }}, /* 4012 K */
+    {{ 37.5533354689, 41.7268945846, 20.7861497265, 661.323187249, 63.2173362526, 59.35036257 }}, /* 4013 K */
+    {{ 37.5537480253, 41.7283792785, 20.7861497258, 661.332647495, 63.2183884033, 59.3522751022 }}, /* 4014 K */
+    {{ 37.5541604559, 41.7298635327, 20.7861497251, 661.342097734, 63.2194408368, 59.3541869684 }}, /* 4015 K */
+    {{ 37.5545727609, 41.7313473473, 20.7861497243, 661.351537978, 63.220493554, 59.3560981696 }}, /* 4016 K */
+    {{ 37.5549849406, 41.7328307225, 20.7861497236, 661.36096824, 63.2215465554, 59.358008707 }}, /* 4017 K */
+    {{ 37.5553969952, 41.7343136583, 20.7861497229, 661.37038853, 63.2225998419, 59.3599185816 }}, /* 4018 K */
+    {{ 37.5558089248, 41.7357961549, 20.7861497221, 661.379798861, 63.2236534143, 59.3618277946 }}, /* 4019 K */
+    {{ 37.5562207297, 41.7372782123, 20.7861497214, 661.389199245, 63.2247072731, 59.363736347 }}, /* 4020 K */
+    {{ 37.5566324101, 41.7387598308, 20.7861497207, 661.398589693, 63.2257614192, 59.36564424 }}, /* 4021 K */
+    {{ 37.5570439662, 41.7402410104, 20.7861497199, 661.407970218, 63.2268158532, 59.3675514746 }}, /* 4022 K */
+    {{ 37.5574553983, 41.7417217512, 20.7861497192, 661.417340831, 63.227870576, 59.369458052 }}, /* 4023 K */
+    {{ 37.5578667064, 41.7432020533, 20.7861497184, 661.426701544, 63.2289255883, 59.3713639732 }}, /* 4024 K */
+    {{ 37.5582778909, 41.7446819169, 20.7861497177, 661.436052368, 63.2299808907, 59.3732692393 }}, /* 4025 K */
+    {{ 37.5586889519, 41.7461613422, 20.7861497169, 661.445393317, 63.231036484, 59.3751738514 }}, /* 4026 K */
+    {{ 37.5590998896, 41.7476403291, 20.7861497162, 661.4547244, 63.232092369, 59.3770778107 }}, /* 4027 K */
+    {{ 37.5595107043, 41.7491188778, 20.7861497154, 661.464045631, 63.2331485464, 59.3789811181 }}, /* 4028 K */
+    {{ 37.5599213962, 41.7505969885, 20.7861497147, 661.473357021, 63.2342050169, 59.3808837748 }}, /* 4029 K */
+    {{ 37.5603319654, 41.7520746612, 20.7861497139, 661.482658582, 63.2352617812, 59.382785782 }}, /* 4030 K */
+    {{ 37.5607424122, 41.7535518961, 20.7861497132, 661.491950325, 63.2363188401, 59.3846871406 }}, /* 4031 K */
+    {{ 37.5611527368, 41.7550286932, 20.7861497124, 661.501232262, 63.2373761943, 59.3865878517 }}, /* 4032 K */
+    {{ 37.5615629394, 41.7565050528, 20.7861497117, 661.510504404, 63.2384338445, 59.3884879165 }}, /* 4033 K */
+    {{ 37.5619730201, 41.7579809749, 20.7861497109, 661.519766765, 63.2394917915, 59.3903873359 }}, /* 4034 K */
+    {{ 37.5623829793, 41.7594564596, 20.7861497101, 661.529019354, 63.240550036, 59.3922861112 }}, /* 4035 K */
+    {{ 37.5627928171, 41.7609315071, 20.7861497094, 661.538262185, 63.2416085787, 59.3941842434 }}, /* 4036 K */
+    {{ 37.5632025337, 41.7624061175, 20.7861497086, 661.547495267, 63.2426674203, 59.3960817335 }}, /* 4037 K */
+    {{ 37.5636121293, 41.7638802908, 20.7861497078, 661.556718614, 63.2437265617, 59.3979785827 }}, /* 4038 K */
+    {{ 37.5640216042, 41.7653540273, 20.786149707, 661.565932237, 63.2447860035, 59.399874792 }}, /* 4039 K */
+    {{ 37.5644309585, 41.7668273269, 20.7861497063, 661.575136147, 63.2458457464, 59.4017703625 }}, /* 4040 K */
+    {{ 37.5648401925, 41.76830019, 20.7861497055, 661.584330356, 63.2469057911, 59.4036652952 }}, /* 4041 K */
+    {{ 37.5652493063, 41.7697726164, 20.7861497047, 661.593514875, 63.2479661385, 59.4055595913 }}, /* 4042 K */
+    {{ 37.5656583001, 41.7712446065, 20.7861497039, 661.602689717, 63.2490267892, 59.4074532518 }}, /* 4043 K */
+    {{ 37.5660671743, 41.7727161602, 20.7861497032, 661.611854892, 63.250087744, 59.4093462777 }}, /* 4044 K */
+    {{ 37.5664759289, 41.7741872778, 20.7861497024, 661.621010412, 63.2511490035, 59.4112386703 }}, /* 4045 K */
+    {{ 37.5668845642, 41.7756579593, 20.7861497016, 661.630156289, 63.2522105686, 59.4131304304 }}, /* 4046 K */
+    {{ 37.5672930804, 41.7771282048, 20.7861497008, 661.639292534, 63.2532724399, 59.4150215593 }}, /* 4047 K */
+    {{ 37.5677014777, 41.7785980145, 20.7861497, 661.648419159, 63.2543346181, 59.4169120579 }}, /* 4048 K */
+    {{ 37.5681097563, 41.7800673884, 20.7861496992, 661.657536176, 63.2553971041, 59.4188019273 }}, /* 4049 K */
+    {{ 37.5685179164, 41.7815363268, 20.7861496984, 661.666643594, 63.2564598985, 59.4206911686 }}, /* 4050 K */
+    {{ 37.5689259582, 41.7830048297, 20.7861496976, 661.675741428, 63.2575230021, 59.4225797828 }}, /* 4051 K */
+    {{ 37.569333882, 41.7844728972, 20.7861496968, 661.684829686, 63.2585864155, 59.4244677711 }}, /* 4052 K */
+    {{ 37.5697416878, 41.7859405295, 20.786149696, 661.693908382, 63.2596501395, 59.4263551345 }}, /* 4053 K */
+    {{ 37.570149376, 41.7874077266, 20.7861496952, 661.702977526, 63.2607141749, 59.4282418739 }}, /* 4054 K */
+    {{ 37.5705569468, 41.7888744887, 20.7861496944, 661.71203713, 63.2617785223, 59.4301279906 }}, /* 4055 K */
+    {{ 37.5709644003, 41.7903408159, 20.7861496936, 661.721087205, 63.2628431825, 59.4320134855 }}, /* 4056 K */
+    {{ 37.5713717367, 41.7918067084, 20.7861496928, 661.730127763, 63.2639081563, 59.4338983597 }}, /* 4057 K */
+    {{ 37.5717789563, 41.7932721662, 20.786149692, 661.739158815, 63.2649734442, 59.4357826143 }}, /* 4058 K */
+    {{ 37.5721860593, 41.7947371894, 20.7861496912, 661.748180373, 63.2660390472, 59.4376662503 }}, /* 4059 K */
+    {{ 37.5725930458, 41.7962017783, 20.7861496904, 661.757192447, 63.2671049658, 59.4395492688 }}, /* 4060 K */
+    {{ 37.5729999162, 41.7976659328, 20.7861496896, 661.766195049, 63.2681712008, 59.4414316707 }}, /* 4061 K */
+    {{ 37.5734066705, 41.7991296531, 20.7861496888, 661.775188191, 63.269237753, 59.4433134573 }}, /* 4062 K */
+    {{ 37.573813309, 41.8005929394, 20.786149688, 661.784171883, 63.2703046231, 59.4451946294 }}, /* 4063 K */
+    {{ 37.5742198318, 41.8020557917, 20.7861496871, 661.793146137, 63.2713718117, 59.4470751882 }}, /* 4064 K */
+    {{ 37.5746262393, 41.8035182101, 20.7861496863, 661.802110965, 63.2724393197, 59.4489551348 }}, /* 4065 K */
+    {{ 37.5750325316, 41.8049801949, 20.7861496855, 661.811066377, 63.2735071477, 59.45083447 }}, /* 4066 K */
+    {{ 37.5754387089, 41.8064417461, 20.7861496847, 661.820012385, 63.2745752965, 59.4527131951 }}, /* 4067 K */
+    {{ 37.5758447714, 41.8079028637, 20.7861496838, 661.828949, 63.2756437668, 59.4545913111 }}, /* 4068 K */
+    {{ 37.5762507194, 41.8093635481, 20.786149683, 661.837876233, 63.2767125592, 59.4564688189 }}, /* 4069 K */
+    {{ 37.5766565529, 41.8108237991, 20.7861496822, 661.846794096, 63.2777816747, 59.4583457196 }}, /* 4070 K */
+    {{ 37.5770622723, 41.8122836171, 20.7861496814, 661.855702599, 63.2788511137, 59.4602220143 }}, /* 4071 K */
+    {{ 37.5774678777, 41.813743002, 20.7861496805, 661.864601754, 63.2799208772, 59.462097704 }}, /* 4072 K */
+    {{ 37.5778733694, 41.8152019541, 20.7861496797, 661.873491573, 63.2809909658, 59.4639727898 }}, /* 4073 K */
+    {{ 37.5782787475, 41.8166604734, 20.7861496788, 661.882372065, 63.2820613802, 59.4658472726 }}, /* 4074 K */
+    {{ 37.5786840123, 41.81811856, 20.786149678, 661.891243243, 63.2831321212, 59.4677211536 }}, /* 4075 K */
+    {{ 37.5790891639, 41.8195762141, 20.7861496772, 661.900105117, 63.2842031895, 59.4695944337 }}, /* 4076 K */
+    {{ 37.5794942026, 41.8210334358, 20.7861496763, 661.908957699, 63.2852745857, 59.471467114 }}, /* 4077 K */
+    {{ 37.5798991286, 41.8224902252, 20.7861496755, 661.917801, 63.2863463107, 59.4733391954 }}, /* 4078 K */
+    {{ 37.580303942, 41.8239465824, 20.7861496746, 661.92663503, 63.2874183652, 59.4752106792 }}, /* 4079 K */
+    {{ 37.5807086431, 41.8254025076, 20.7861496738, 661.935459802, 63.2884907498, 59.4770815662 }}, /* 4080 K */
+    {{ 37.5811132321, 41.8268580008, 20.7861496729, 661.944275325, 63.2895634653, 59.4789518575 }}, /* 4081 K */
+    {{ 37.5815177092, 41.8283130622, 20.7861496721, 661.953081612, 63.2906365124, 59.4808215541 }}, /* 4082 K */
+    {{ 37.5819220745, 41.8297676919, 20.7861496712, 661.961878672, 63.2917098919, 59.4826906571 }}, /* 4083 K */
+    {{ 37.5823263284, 41.83122189, 20.7861496704, 661.970666518, 63.2927836044, 59.4845591675 }}, /* 4084 K */
+    {{ 37.5827304709, 41.8326756566, 20.7861496695, 661.97944516, 63.2938576507, 59.4864270862 }}, /* 4085 K */
+    {{ 37.5831345024, 41.8341289919, 20.7861496687, 661.988214609, 63.2949320315, 59.4882944144 }}, /* 4086 K */
+    {{ 37.5835384229, 41.835581896, 20.7861496678, 661.996974876, 63.2960067475, 59.4901611531 }}, /* 4087 K */
+    {{ 37.5839422328, 41.8370343689, 20.786149667, 662.005725972, 63.2970817995, 59.4920273031 }}, /* 4088 K */
+    {{ 37.5843459322, 41.8384864109, 20.7861496661, 662.014467909, 63.2981571882, 59.4938928657 }}, /* 4089 K */
+    {{ 37.5847495213, 41.839938022, 20.7861496652, 662.023200696, 63.2992329142, 59.4957578418 }}, /* 4090 K */
+    {{ 37.5851530003, 41.8413892023, 20.7861496644, 662.031924346, 63.3003089783, 59.4976222324 }}, /* 4091 K */
+    {{ 37.5855563695, 41.842839952, 20.7861496635, 662.040638868, 63.3013853813, 59.4994860385 }}, /* 4092 K */
+    {{ 37.5859596289, 41.8442902712, 20.7861496626, 662.049344275, 63.3024621238, 59.5013492612 }}, /* 4093 K */
+    {{ 37.586362779, 41.84574016, 20.7861496618, 662.058040576, 63.3035392066, 59.5032119014 }}, /* 4094 K */
+    {{ 37.5867658197, 41.8471896185, 20.7861496609, 662.066727783, 63.3046166304, 59.5050739602 }}, /* 4095 K */
+    {{ 37.5871687514, 41.8486386468, 20.78614966, 662.075405906, 63.3056943959, 59.5069354386 }}, /* 4096 K */
+    {{ 37.5875715743, 41.8500872451, 20.7861496591, 662.084074956, 63.3067725038, 59.5087963376 }}, /* 4097 K */
+    {{ 37.5879742885, 41.8515354135, 20.7861496583, 662.092734945, 63.3078509549, 59.5106566582 }}, /* 4098 K */
+    {{ 37.5883768942, 41.8529831521, 20.7861496574, 662.101385883, 63.3089297498, 59.5125164014 }}, /* 4099 K */
+    {{ 37.5887793918, 41.854430461, 20.7861496565, 662.110027781, 63.3100088893, 59.5143755682 }}, /* 4100 K */
+    {{ 37.5891817812, 41.8558773403, 20.7861496556, 662.11866065, 63.3110883741, 59.5162341596 }}, /* 4101 K */
+    {{ 37.5895840629, 41.8573237902, 20.7861496547, 662.1272845, 63.312168205, 59.5180921766 }}, /* 4102 K */
+    {{ 37.5899862369, 41.8587698108, 20.7861496538, 662.135899343, 63.3132483826, 59.5199496203 }}, /* 4103 K */
+    {{ 37.5903883034, 41.8602154021, 20.786149653, 662.144505189, 63.3143289076, 59.5218064916 }}, /* 4104 K */
+    {{ 37.5907902628, 41.8616605644, 20.7861496521, 662.153102048, 63.3154097809, 59.5236627915 }}, /* 4105 K */
+    {{ 37.5911921151, 41.8631052977, 20.7861496512, 662.161689933, 63.316491003, 59.525518521 }}, /* 4106 K */
+    {{ 37.5915938606, 41.8645496021, 20.7861496503, 662.170268852, 63.3175725747, 59.5273736812 }}, /* 4107 K */
+    {{ 37.5919954995, 41.8659934778, 20.7861496494, 662.178838818, 63.3186544968, 59.5292282729 }}, /* 4108 K */
+    {{ 37.592397032, 41.8674369249, 20.7861496485, 662.18739984, 63.31973677, 59.5310822973 }}, /* 4109 K */
+    {{ 37.5927984583, 41.8688799435, 20.7861496476, 662.19595193, 63.3208193949, 59.5329357553 }}, /* 4110 K */
+    {{ 37.5931997786, 41.8703225337, 20.7861496467, 662.204495099, 63.3219023723, 59.5347886479 }}, /* 4111 K */
+    {{ 37.593600993, 41.8717646957, 20.7861496458, 662.213029356, 63.3229857029, 59.5366409761 }}, /* 4112 K */
+    {{ 37.5940021019, 41.8732064296, 20.7861496449, 662.221554712, 63.3240693874, 59.5384927409 }}, /* 4113 K */
+    {{ 37.5944031054, 41.8746477354, 20.786149644, 662.230071179, 63.3251534266, 59.5403439433 }}, /* 4114 K */
+    {{ 37.5948040037, 41.8760886133, 20.7861496431, 662.238578767, 63.3262378211, 59.5421945842 }}, /* 4115 K */
+    {{ 37.5952047969, 41.8775290634, 20.7861496422, 662.247077486, 63.3273225717, 59.5440446647 }}, /* 4116 K */
+    {{ 37.5956054854, 41.8789690859, 20.7861496413, 662.255567347, 63.3284076791, 59.5458941857 }}, /* 4117 K */
+    {{ 37.5960060694, 41.8804086809, 20.7861496404, 662.26404836, 63.329493144, 59.5477431482 }}, /* 4118 K */
+    {{ 37.5964065489, 41.8818478484, 20.7861496395, 662.272520537, 63.3305789671, 59.5495915533 }}, /* 4119 K */
+    {{ 37.5968069242, 41.8832865886, 20.7861496385, 662.280983888, 63.3316651492, 59.5514394018 }}, /* 4120 K */
+    {{ 37.5972071956, 41.8847249017, 20.7861496376, 662.289438423, 63.3327516909, 59.5532866948 }}, /* 4121 K */
+    {{ 37.5976073632, 41.8861627877, 20.7861496367, 662.297884153, 63.333838593, 59.5551334332 }}, /* 4122 K */
+    {{ 37.5980074272, 41.8876002467, 20.7861496358, 662.306321089, 63.3349258561, 59.5569796181 }}, /* 4123 K */
+    {{ 37.5984073879, 41.889037279, 20.7861496349, 662.314749241, 63.3360134811, 59.5588252504 }}, /* 4124 K */
+    {{ 37.5988072454, 41.8904738845, 20.786149634, 662.323168619, 63.3371014686, 59.5606703311 }}, /* 4125 K */
+    {{ 37.5992069999, 41.8919100634, 20.786149633, 662.331579234, 63.3381898193, 59.5625148612 }}, /* 4126 K */
+    {{ 37.5996066516, 41.8933458159, 20.7861496321, 662.339981096, 63.339278534, 59.5643588415 }}, /* 4127 K */
+    {{ 37.6000062008, 41.894781142, 20.7861496312, 662.348374216, 63.3403676133, 59.5662022732 }}, /* 4128 K */
+    {{ 37.6004056477, 41.8962160419, 20.7861496303, 662.356758605, 63.341457058, 59.5680451572 }}, /* 4129 K */
+    {{ 37.6008049923, 41.8976505157, 20.7861496293, 662.365134273, 63.3425468688, 59.5698874944 }}, /* 4130 K */
+    {{ 37.6012042351, 41.8990845635, 20.7861496284, 662.37350123, 63.3436370465, 59.5717292859 }}, /* 4131 K */
+    {{ 37.601603376, 41.9005181855, 20.7861496275, 662.381859486, 63.3447275916, 59.5735705325 }}, /* 4132 K */
+    {{ 37.6020024155, 41.9019513817, 20.7861496265, 662.390209053, 63.345818505, 59.5754112353 }}, /* 4133 K */
+    {{ 37.6024013535, 41.9033841523, 20.7861496256, 662.39854994, 63.3469097873, 59.5772513953 }}, /* 4134 K */
+    {{ 37.6028001905, 41.9048164973, 20.7861496247, 662.406882158, 63.3480014392, 59.5790910133 }}, /* 4135 K */
+    {{ 37.6031989264, 41.906248417, 20.7861496237, 662.415205718, 63.3490934616, 59.5809300904 }}, /* 4136 K */
+    {{ 37.6035975617, 41.9076799114, 20.7861496228, 662.423520629, 63.3501858551, 59.5827686275 }}, /* 4137 K */
+    {{ 37.6039960964, 41.9091109807, 20.7861496219, 662.431826902, 63.3512786203, 59.5846066256 }}, /* 4138 K */
+    {{ 37.6043945308, 41.9105416249, 20.7861496209, 662.440124547, 63.3523717581, 59.5864440856 }}, /* 4139 K */
+    {{ 37.604792865, 41.9119718443, 20.78614962, 662.448413575, 63.3534652691, 59.5882810085 }}, /* 4140 K */
+    {{ 37.6051910993, 41.9134016388, 20.786149619, 662.456693996, 63.354559154, 59.5901173953 }}, /* 4141 K */
+    {{ 37.6055892338, 41.9148310087, 20.7861496181, 662.46496582, 63.3556534136, 59.591953247 }}, /* 4142 K */
+    {{ 37.6059872689, 41.916259954, 20.7861496171, 662.473229057, 63.3567480486, 59.5937885644 }}, /* 4143 K */
+    {{ 37.6063852046, 41.9176884749, 20.7861496162, 662.481483718, 63.3578430597, 59.5956233485 }}, /* 4144 K */
+    {{ 37.6067830411, 41.9191165715, 20.7861496152, 662.489729814, 63.3589384475, 59.5974576003 }}, /* 4145 K */
+    {{ 37.6071807788, 41.9205442439, 20.7861496143, 662.497967353, 63.3600342129, 59.5992913207 }}, /* 4146 K */
+    {{ 37.6075784177, 41.9219714922, 20.7861496133, 662.506196347, 63.3611303564, 59.6011245108 }}, /* 4147 K */
+    {{ 37.6079759581, 41.9233983166, 20.7861496124, 662.514416806, 63.3622268789, 59.6029571714 }}, /* 4148 K */
+    {{ 37.6083734002, 41.9248247171, 20.7861496114, 662.52262874, 63.3633237811, 59.6047893034 }}, /* 4149 K */
+    {{ 37.6087707441, 41.9262506939, 20.7861496105, 662.530832159, 63.3644210636, 59.6066209079 }}, /* 4150 K */
+    {{ 37.6091679902, 41.9276762472, 20.7861496095, 662.539027073, 63.3655187272, 59.6084519858 }}, /* 4151 K */
+    {{ 37.6095651385, 41.929101377, 20.7861496086, 662.547213492, 63.3666167725, 59.610282538 }}, /* 4152 K */
+    {{ 37.6099621893, 41.9305260834, 20.7861496076, 662.555391428, 63.3677152004, 59.6121125655 }}, /* 4153 K */
+    {{ 37.6103591428, 41.9319503666, 20.7861496066, 662.563560889, 63.3688140114, 59.6139420692 }}, /* 4154 K */
+    {{ 37.6107559991, 41.9333742267, 20.7861496057, 662.571721886, 63.3699132064, 59.6157710501 }}, /* 4155 K */
+    {{ 37.6111527586, 41.9347976638, 20.7861496047, 662.579874429, 63.3710127859, 59.6175995091 }}, /* 4156 K */
+    {{ 37.6115494214, 41.936220678, 20.7861496037, 662.588018528, 63.3721127508, 59.6194274471 }}, /* 4157 K */
+    {{ 37.6119459876, 41.9376432694, 20.7861496028, 662.596154193, 63.3732131018, 59.6212548651 }}, /* 4158 K */
+    {{ 37.6123424575, 41.9390654383, 20.7861496018, 662.604281435, 63.3743138395, 59.623081764 }}, /* 4159 K */
+    {{ 37.6127388313, 41.9404871846, 20.7861496008, 662.612400263, 63.3754149647, 59.6249081448 }}, /* 4160 K */
+    {{ 37.6131351093, 41.9419085085, 20.7861495999, 662.620510687, 63.376516478, 59.6267340084 }}, /* 4161 K */
+    {{ 37.6135312915, 41.9433294102, 20.7861495989, 662.628612718, 63.3776183803, 59.6285593557 }}, /* 4162 K */
+    {{ 37.6139273782, 41.9447498897, 20.7861495979, 662.636706365, 63.3787206721, 59.6303841876 }}, /* 4163 K */
+    {{ 37.6143233696, 41.9461699472, 20.7861495969, 662.644791639, 63.3798233542, 59.6322085052 }}, /* 4164 K */
+    {{ 37.6147192659, 41.9475895828, 20.786149596, 662.65286855, 63.3809264274, 59.6340323092 }}, /* 4165 K */
+    {{ 37.6151150672, 41.9490087966, 20.786149595, 662.660937107, 63.3820298923, 59.6358556008 }}, /* 4166 K */
+    {{ 37.6155107739, 41.9504275887, 20.786149594, 662.66899732, 63.3831337496, 59.6376783807 }}, /* 4167 K */
+    {{ 37.6159063861, 41.9518459593, 20.786149593, 662.6770492, 63.384238, 59.6395006499 }}, /* 4168 K */
+    {{ 37.616301904, 41.9532639084, 20.786149592, 662.685092757, 63.3853426443, 59.6413224093 }}, /* 4169 K */
+    {{ 37.6166973278, 41.9546814362, 20.7861495911, 662.693128, 63.3864476832, 59.6431436599 }}, /* 4170 K */
+    {{ 37.6170926577, 41.9560985429, 20.7861495901, 662.701154939, 63.3875531173, 59.6449644026 }}, /* 4171 K */
+    {{ 37.6174878939, 41.9575152284, 20.7861495891, 662.709173584, 63.3886589474, 59.6467846383 }}, /* 4172 K */
+    {{ 37.6178830366, 41.9589314931, 20.7861495881, 662.717183946, 63.3897651742, 59.6486043679 }}, /* 4173 K */
+    {{ 37.618278086, 41.9603473368, 20.7861495871, 662.725186033, 63.3908717984, 59.6504235924 }}, /* 4174 K */
+    {{ 37.6186730423, 41.9617627599, 20.7861495861, 662.733179857, 63.3919788208, 59.6522423127 }}, /* 4175 K */
+    {{ 37.6190679057, 41.9631777624, 20.7861495851, 662.741165426, 63.3930862419, 59.6540605296 }}, /* 4176 K */
+    {{ 37.6194626764, 41.9645923444, 20.7861495841, 662.749142751, 63.3941940625, 59.6558782441 }}, /* 4177 K */
+    {{ 37.6198573546, 41.9660065061, 20.7861495831, 662.757111841, 63.3953022834, 59.6576954572 }}, /* 4178 K */
+    {{ 37.6202519405, 41.9674202476, 20.7861495822, 662.765072707, 63.3964109052, 59.6595121697 }}, /* 4179 K */
+    {{ 37.6206464344, 41.9688335689, 20.7861495812, 662.773025358, 63.3975199286, 59.6613283825 }}, /* 4180 K */
+    {{ 37.6210408363, 41.9702464703, 20.7861495802, 662.780969804, 63.3986293544, 59.6631440966 }}, /* 4181 K */
+    {{ 37.6214351466, 41.9716589517, 20.7861495792, 662.788906055, 63.3997391833, 59.6649593129 }}, /* 4182 K */
+    {{ 37.6218293653, 41.9730710135, 20.7861495782, 662.79683412, 63.4008494159, 59.6667740323 }}, /* 4183 K */
+    {{ 37.6222234928, 41.9744826556, 20.7861495772, 662.804754009, 63.401960053, 59.6685882556 }}, /* 4184 K */
+    {{ 37.6226175291, 41.9758938782, 20.7861495762, 662.812665733, 63.4030710953, 59.6704019839 }}, /* 4185 K */
+    {{ 37.6230114746, 41.9773046814, 20.7861495752, 662.8205693, 63.4041825435, 59.6722152179 }}, /* 4186 K */
+    {{ 37.6234053294, 41.9787150654, 20.7861495742, 662.828464721, 63.4052943982, 59.6740279587 }}, /* 4187 K */
+    {{ 37.6237990937, 41.9801250302, 20.7861495731, 662.836352005, 63.4064066603, 59.6758402071 }}, /* 4188 K */
+    {{ 37.6241927677, 41.981534576, 20.7861495721, 662.844231162, 63.4075193304, 59.677651964 }}, /* 4189 K */
+    {{ 37.6245863516, 41.9829437028, 20.7861495711, 662.852102202, 63.4086324092, 59.6794632303 }}, /* 4190 K */
+    {{ 37.6249798457, 41.9843524109, 20.7861495701, 662.859965134, 63.4097458974, 59.681274007 }}, /* 4191 K */
+    {{ 37.62537325, 41.9857607004, 20.7861495691, 662.867819968, 63.4108597957, 59.6830842949 }}, /* 4192 K */
+    {{ 37.6257665648, 41.9871685712, 20.7861495681, 662.875666714, 63.4119741049, 59.6848940949 }}, /* 4193 K */
+    {{ 37.6261597904, 41.9885760237, 20.7861495671, 662.883505381, 63.4130888256, 59.6867034079 }}, /* 4194 K */
+    {{ 37.6265529269, 41.9899830579, 20.7861495661, 662.891335979, 63.4142039585, 59.6885122349 }}, /* 4195 K */
+    {{ 37.6269459744, 41.9913896738, 20.7861495651, 662.899158518, 63.4153195044, 59.6903205766 }}, /* 4196 K */
+    {{ 37.6273389333, 41.9927958717, 20.786149564, 662.906973007, 63.416435464, 59.6921284341 }}, /* 4197 K */
+    {{ 37.6277318037, 41.9942016517, 20.786149563, 662.914779456, 63.4175518379, 59.6939358082 }}, /* 4198 K */
+    {{ 37.6281245858, 41.9956070139, 20.786149562, 662.922577874, 63.4186686269, 59.6957426997 }}, /* 4199 K */
+    {{ 37.6285172798, 41.9970119583, 20.786149561, 662.930368271, 63.4197858316, 59.6975491097 }}, /* 4200 K */
+    {{ 37.628909886, 41.9984164852, 20.78614956, 662.938150656, 63.4209034528, 59.6993550389 }}, /* 4201 K */
+    {{ 37.6293024044, 41.9998205946, 20.786149559, 662.94592504, 63.4220214912, 59.7011604883 }}, /* 4202 K */
+    {{ 37.6296948353, 42.0012242867, 20.7861495579, 662.953691431, 63.4231399475, 59.7029654587 }}, /* 4203 K */
+    {{ 37.630087179, 42.0026275615, 20.7861495569, 662.96144984, 63.4242588224, 59.7047699511 }}, /* 4204 K */
+    {{ 37.6304794356, 42.0040304192, 20.7861495559, 662.969200275, 63.4253781166, 59.7065739663 }}, /* 4205 K */
+    {{ 37.6308716052, 42.00543286, 20.7861495549, 662.976942746, 63.4264978308, 59.7083775051 }}, /* 4206 K */
+    {{ 37.6312636882, 42.0068348839, 20.7861495538, 662.984677263, 63.4276179656, 59.7101805686 }}, /* 4207 K */
+    {{ 37.6316556847, 42.0082364911, 20.7861495528, 662.992403835, 63.4287385219, 59.7119831576 }}, /* 4208 K */
+    {{ 37.6320475949, 42.0096376817, 20.7861495518, 663.000122471, 63.4298595003, 59.7137852729 }}, /* 4209 K */
+    {{ 37.632439419, 42.0110384557, 20.7861495507, 663.007833182, 63.4309809015, 59.7155869154 }}, /* 4210 K */
+    {{ 37.6328311572, 42.0124388134, 20.7861495497, 663.015535976, 63.4321027263, 59.717388086 }}, /* 4211 K */
+    {{ 37.6332228097, 42.0138387548, 20.7861495487, 663.023230863, 63.4332249752, 59.7191887857 }}, /* 4212 K */
+    {{ 37.6336143768, 42.0152382801, 20.7861495476, 663.030917852, 63.4343476491, 59.7209890151 }}, /* 4213 K */
+    {{ 37.6340058585, 42.0166373894, 20.7861495466, 663.038596953, 63.4354707486, 59.7227887754 }}, /* 4214 K */
+    {{ 37.6343972551, 42.0180360828, 20.7861495456, 663.046268175, 63.4365942745, 59.7245880672 }}, /* 4215 K */
+    {{ 37.6347885669, 42.0194343604, 20.7861495445, 663.053931527, 63.4377182273, 59.7263868915 }}, /* 4216 K */
+    {{ 37.6351797939, 42.0208322223, 20.7861495435, 663.061587019, 63.438842608, 59.7281852491 }}, /* 4217 K */
+    {{ 37.6355709365, 42.0222296687, 20.7861495425, 663.069234661, 63.439967417, 59.729983141 }}, /* 4218 K */
+    {{ 37.6359619948, 42.0236266997, 20.7861495414, 663.076874461, 63.4410926552, 59.731780568 }}, /* 4219 K */
+    {{ 37.6363529689, 42.0250233155, 20.7861495404, 663.084506429, 63.4422183233, 59.7335775309 }}, /* 4220 K */
+    {{ 37.6367438592, 42.026419516, 20.7861495393, 663.092130574, 63.4433444219, 59.7353740307 }}, /* 4221 K */
+    {{ 37.6371346658, 42.0278153015, 20.7861495383, 663.099746905, 63.4444709517, 59.7371700682 }}, /* 4222 K */
+    {{ 37.6375253888, 42.029210672, 20.7861495373, 663.107355433, 63.4455979135, 59.7389656442 }}, /* 4223 K */
+    {{ 37.6379160286, 42.0306056278, 20.7861495362, 663.114956165, 63.446725308, 59.7407607596 }}, /* 4224 K */
+    {{ 37.6383065853, 42.0320001689, 20.7861495352, 663.122549112, 63.4478531358, 59.7425554154 }}, /* 4225 K */
+    {{ 37.6386970591, 42.0333942953, 20.7861495341, 663.130134282, 63.4489813977, 59.7443496122 }}, /* 4226 K */
+    {{ 37.6390874501, 42.0347880074, 20.7861495331, 663.137711685, 63.4501100944, 59.7461433511 }}, /* 4227 K */
+    {{ 37.6394777587, 42.0361813051, 20.786149532, 663.14528133, 63.4512392265, 59.7479366328 }}, /* 4228 K */
+    {{ 37.639867985, 42.0375741886, 20.786149531, 663.152843227, 63.4523687947, 59.7497294583 }}, /* 4229 K */
+    {{ 37.6402581292, 42.038966658, 20.7861495299, 663.160397384, 63.4534987999, 59.7515218283 }}, /* 4230 K */
+    {{ 37.6406481915, 42.0403587135, 20.7861495289, 663.16794381, 63.4546292426, 59.7533137438 }}, /* 4231 K */
+    {{ 37.641038172, 42.0417503551, 20.7861495278, 663.175482516, 63.4557601236, 59.7551052056 }}, /* 4232 K */
+    {{ 37.6414280711, 42.0431415829, 20.7861495268, 663.183013509, 63.4568914435, 59.7568962145 }}, /* 4233 K */
+    {{ 37.6418178888, 42.0445323972, 20.7861495257, 663.1905368, 63.4580232032, 59.7586867714 }}, /* 4234 K */
+    {{ 37.6422076255, 42.045922798, 20.7861495247, 663.198052397, 63.4591554032, 59.7604768771 }}, /* 4235 K */
+    {{ 37.6425972813, 42.0473127854, 20.7861495236, 663.205560309, 63.4602880442, 59.7622665326 }}, /* 4236 K */
+    {{ 37.6429868563, 42.0487023596, 20.7861495226, 663.213060546, 63.4614211271, 59.7640557385 }}, /* 4237 K */
+    {{ 37.6433763508, 42.0500915206, 20.7861495215, 663.220553117, 63.4625546524, 59.7658444959 }}, /* 4238 K */
+    {{ 37.6437657651, 42.0514802687, 20.7861495205, 663.228038031, 63.4636886209, 59.7676328055 }}, /* 4239 K */
+    {{ 37.6441550992, 42.0528686039, 20.7861495194, 663.235515296, 63.4648230333, 59.7694206682 }}, /* 4240 K */
+    {{ 37.6445443534, 42.0542565263, 20.7861495183, 663.242984922, 63.4659578902, 59.7712080848 }}, /* 4241 K */
+    {{ 37.6449335279, 42.055644036, 20.7861495173, 663.250446919, 63.4670931924, 59.7729950562 }}, /* 4242 K */
+    {{ 37.6453226229, 42.0570311333, 20.7861495162, 663.257901294, 63.4682289406, 59.7747815832 }}, /* 4243 K */
+    {{ 37.6457116385, 42.0584178181, 20.7861495152, 663.265348058, 63.4693651355, 59.7765676667 }}, /* 4244 K */
+    {{ 37.6461005751, 42.0598040907, 20.7861495141, 663.272787219, 63.4705017778, 59.7783533074 }}, /* 4245 K */
+    {{ 37.6464894327, 42.0611899511, 20.786149513, 663.280218786, 63.4716388681, 59.7801385063 }}, /* 4246 K */
+    {{ 37.6468782117, 42.0625753995, 20.786149512, 663.287642768, 63.4727764072, 59.7819232641 }}, /* 4247 K */
+    {{ 37.6472669121, 42.0639604359, 20.7861495109, 663.295059174, 63.4739143958, 59.7837075818 }}, /* 4248 K */
+    {{ 37.6476555342, 42.0653450606, 20.7861495098, 663.302468013, 63.4750528345, 59.7854914601 }}, /* 4249 K */
+    {{ 37.6480440782, 42.0667292735, 20.7861495088, 663.309869294, 63.4761917241, 59.7872748998 }}, /* 4250 K */
+    {{ 37.6484325442, 42.0681130749, 20.7861495077, 663.317263027, 63.4773310653, 59.7890579019 }}, /* 4251 K */
+    {{ 37.6488209326, 42.0694964649, 20.7861495066, 663.324649219, 63.4784708588, 59.7908404671 }}, /* 4252 K */
+    {{ 37.6492092434, 42.0708794436, 20.7861495056, 663.33202788, 63.4796111052, 59.7926225963 }}, /* 4253 K */
+    {{ 37.6495974769, 42.0722620111, 20.7861495045, 663.33939902, 63.4807518053, 59.7944042902 }}, /* 4254 K */
+    {{ 37.6499856332, 42.0736441675, 20.7861495034, 663.346762645, 63.4818929598, 59.7961855498 }}, /* 4255 K */
+    {{ 37.6503737127, 42.0750259129, 20.7861495024, 663.354118767, 63.4830345693, 59.7979663759 }}, /* 4256 K */
+    {{ 37.6507617154, 42.0764072475, 20.7861495013, 663.361467393, 63.4841766346, 59.7997467692 }}, /* 4257 K */
+    {{ 37.6511496416, 42.0777881714, 20.7861495002, 663.368808532, 63.4853191564, 59.8015267306 }}, /* 4258 K */
+    {{ 37.6515374915, 42.0791686847, 20.7861494991, 663.376142194, 63.4864621353, 59.803306261 }}, /* 4259 K */
+    {{ 37.6519252652, 42.0805487875, 20.7861494981, 663.383468386, 63.4876055721, 59.8050853611 }}, /* 4260 K */
+    {{ 37.652312963, 42.08192848, 20.786149497, 663.390787119, 63.4887494674, 59.8068640318 }}, /* 4261 K */
+    {{ 37.6527005851, 42.0833077622, 20.7861494959, 663.3980984, 63.489893822, 59.8086422738 }}, /* 4262 K */
+    {{ 37.6530881317, 42.0846866344, 20.7861494948, 663.405402239, 63.4910386365, 59.8104200881 }}, /* 4263 K */
+    {{ 37.6534756029, 42.0860650965, 20.7861494938, 663.412698644, 63.4921839117, 59.8121974754 }}, /* 4264 K */
+    {{ 37.653862999, 42.0874431488, 20.7861494927, 663.419987625, 63.4933296483, 59.8139744366 }}, /* 4265 K */
+    {{ 37.6542503202, 42.0888207913, 20.7861494916, 663.427269189, 63.4944758468, 59.8157509724 }}, /* 4266 K */
+    {{ 37.6546375666, 42.0901980242, 20.7861494905, 663.434543346, 63.4956225082, 59.8175270837 }}, /* 4267 K */
+    {{ 37.6550247385, 42.0915748476, 20.7861494895, 663.441810104, 63.4967696329, 59.8193027713 }}, /* 4268 K */
+    {{ 37.655411836, 42.0929512616, 20.7861494884, 663.449069472, 63.4979172218, 59.821078036 }}, /* 4269 K */
+    {{ 37.6557988594, 42.0943272663, 20.7861494873, 663.456321459, 63.4990652756, 59.8228528786 }}, /* 4270 K */
+    {{ 37.6561858089, 42.0957028619, 20.7861494862, 663.463566074, 63.5002137948, 59.8246272999 }}, /* 4271 K */
+    {{ 37.6565726846, 42.0970780484, 20.7861494851, 663.470803325, 63.5013627803, 59.8264013007 }}, /* 4272 K */
+    {{ 37.6569594868, 42.0984528261, 20.7861494841, 663.478033222, 63.5025122327, 59.8281748819 }}, /* 4273 K */
+    {{ 37.6573462156, 42.0998271949, 20.786149483, 663.485255771, 63.5036621528, 59.8299480443 }}, /* 4274 K */
+    {{ 37.6577328713, 42.1012011551, 20.7861494819, 663.492470983, 63.5048125411, 59.8317207886 }}, /* 4275 K */
+    {{ 37.6581194541, 42.1025747068, 20.7861494808, 663.499678866, 63.5059633985, 59.8334931156 }}, /* 4276 K */
+    {{ 37.6585059641, 42.10394785, 20.7861494797, 663.506879429, 63.5071147256, 59.8352650262 }}, /* 4277 K */
+    {{ 37.6588924016, 42.1053205849, 20.7861494786, 663.51407268, 63.508266523, 59.8370365212 }}, /* 4278 K */
+    {{ 37.6592787667, 42.1066929116, 20.7861494776, 663.521258628, 63.5094187916, 59.8388076014 }}, /* 4279 K */
+    {{ 37.6596650596, 42.1080648303, 20.7861494765, 663.528437281, 63.510571532, 59.8405782675 }}, /* 4280 K */
+    {{ 37.6600512806, 42.109436341, 20.7861494754, 663.535608648, 63.5117247449, 59.8423485203 }}, /* 4281 K */
+    {{ 37.6604374299, 42.1108074439, 20.7861494743, 663.542772738, 63.5128784309, 59.8441183608 }}, /* 4282 K */
+    {{ 37.6608235076, 42.1121781391, 20.7861494732, 663.549929559, 63.5140325909, 59.8458877895 }}, /* 4283 K */
+    {{ 37.661209514, 42.1135484267, 20.7861494721, 663.55707912, 63.5151872254, 59.8476568075 }}, /* 4284 K */
+    {{ 37.6615954492, 42.1149183069, 20.786149471, 663.564221429, 63.5163423352, 59.8494254154 }}, /* 4285 K */
+    {{ 37.6619813134, 42.1162877797, 20.7861494699, 663.571356495, 63.517497921, 59.851193614 }}, /* 4286 K */
+    {{ 37.6623671069, 42.1176568453, 20.7861494688, 663.578484326, 63.5186539834, 59.8529614042 }}, /* 4287 K */
+    {{ 37.6627528298, 42.1190255038, 20.7861494678, 663.585604932, 63.5198105232, 59.8547287866 }}, /* 4288 K */
+    {{ 37.6631384824, 42.1203937553, 20.7861494667, 663.592718319, 63.5209675411, 59.8564957622 }}, /* 4289 K */
+    {{ 37.6635240647, 42.1217616, 20.7861494656, 663.599824498, 63.5221250377, 59.8582623317 }}, /* 4290 K */
+    {{ 37.6639095772, 42.1231290379, 20.7861494645, 663.606923476, 63.5232830138, 59.8600284959 }}, /* 4291 K */
+    {{ 37.6642950199, 42.1244960692, 20.7861494634, 663.614015262, 63.52444147, 59.8617942556 }}, /* 4292 K */
+    {{ 37.664680393, 42.1258626939, 20.7861494623, 663.621099864, 63.525600407, 59.8635596115 }}, /* 4293 K */
+    {{ 37.6650656967, 42.1272289124, 20.7861494612, 663.62817729, 63.5267598256, 59.8653245645 }}, /* 4294 K */
+    {{ 37.6654509313, 42.1285947245, 20.7861494601, 663.63524755, 63.5279197264, 59.8670891153 }}, /* 4295 K */
+    {{ 37.6658360969, 42.1299601305, 20.786149459, 663.642310651, 63.5290801101, 59.8688532647 }}, /* 4296 K */
+    {{ 37.6662211937, 42.1313251305, 20.7861494579, 663.649366603, 63.5302409774, 59.8706170135 }}, /* 4297 K */
+    {{ 37.666606222, 42.1326897246, 20.7861494568, 663.656415412, 63.531402329, 59.8723803624 }}, /* 4298 K */
+    {{ 37.6669911819, 42.1340539129, 20.7861494557, 663.663457089, 63.5325641657, 59.8741433123 }}, /* 4299 K */
+    {{ 37.6673760736, 42.1354176956, 20.7861494546, 663.67049164, 63.533726488, 59.875905864 }}, /* 4300 K */
+    {{ 37.6677608973, 42.1367810727, 20.7861494535, 663.677519075, 63.5348892967, 59.8776680181 }}, /* 4301 K */
+    {{ 37.6681456533, 42.1381440444, 20.7861494524, 663.684539402, 63.5360525925, 59.8794297755 }}, /* 4302 K */
+    {{ 37.6685303417, 42.1395066108, 20.7861494514, 663.691552629, 63.5372163761, 59.881191137 }}, /* 4303 K */
+    {{ 37.6689149627, 42.1408687721, 20.7861494503, 663.698558764, 63.5383806481, 59.8829521033 }}, /* 4304 K */
+    {{ 37.6692995165, 42.1422305282, 20.7861494492, 663.705557816, 63.5395454094, 59.8847126752 }}, /* 4305 K */
+    {{ 37.6696840034, 42.1435918795, 20.7861494481, 663.712549793, 63.5407106604, 59.8864728535 }}, /* 4306 K */
+    {{ 37.6700684234, 42.1449528259, 20.786149447, 663.719534703, 63.5418764021, 59.8882326389 }}, /* 4307 K */
+    {{ 37.6704527769, 42.1463133676, 20.7861494459, 663.726512555, 63.5430426349, 59.8899920322 }}, /* 4308 K */
+    {{ 37.670837064, 42.1476735048, 20.7861494448, 663.733483357, 63.5442093597, 59.8917510342 }}, /* 4309 K */
+    {{ 37.671221285, 42.1490332375, 20.7861494437, 663.740447117, 63.5453765772, 59.8935096456 }}, /* 4310 K */
+    {{ 37.6716054399, 42.1503925658, 20.7861494426, 663.747403844, 63.5465442879, 59.8952678672 }}, /* 4311 K */
+    {{ 37.671989529, 42.15175149, 20.7861494415, 663.754353545, 63.5477124927, 59.8970256998 }}, /* 4312 K */
+    {{ 37.6723735526, 42.15311001, 20.7861494404, 663.761296229, 63.5488811922, 59.8987831441 }}, /* 4313 K */
+    {{ 37.6727575107, 42.1544681261, 20.7861494393, 663.768231904, 63.5500503871, 59.9005402009 }}, /* 4314 K */
+    {{ 37.6731414037, 42.1558258383, 20.7861494382, 663.775160578, 63.551220078, 59.902296871 }}, /* 4315 K */
+    {{ 37.6735252317, 42.1571831468, 20.7861494371, 663.782082259, 63.5523902658, 59.904053155 }}, /* 4316 K */
+    {{ 37.6739089949, 42.1585400517, 20.786149436, 663.788996956, 63.553560951, 59.9058090539 }}, /* 4317 K */
+    {{ 37.6742926935, 42.1598965531, 20.7861494349, 663.795904677, 63.5547321344, 59.9075645683 }}, /* 4318 K */
+    {{ 37.6746763277, 42.1612526511, 20.7861494338, 663.802805429, 63.5559038167, 59.9093196989 }}, /* 4319 K */
+    {{ 37.6750598977, 42.1626083458, 20.7861494327, 663.809699222, 63.5570759985, 59.9110744466 }}, /* 4320 K */
+    {{ 37.6754434037, 42.1639636374, 20.7861494316, 663.816586062, 63.5582486806, 59.9128288121 }}, /* 4321 K */
+    {{ 37.6758268459, 42.165318526, 20.7861494305, 663.823465959, 63.5594218636, 59.9145827961 }}, /* 4322 K */
+    {{ 37.6762102245, 42.1666730117, 20.7861494293, 663.830338921, 63.5605955483, 59.9163363994 }}, /* 4323 K */
+    {{ 37.6765935397, 42.1680270946, 20.7861494282, 663.837204954, 63.5617697352, 59.9180896228 }}, /* 4324 K */
+    {{ 37.6769767917, 42.1693807749, 20.7861494271, 663.844064068, 63.5629444252, 59.919842467 }}, /* 4325 K */
+    {{ 37.6773599807, 42.1707340526, 20.786149426, 663.850916271, 63.5641196189, 59.9215949327 }}, /* 4326 K */
+    {{ 37.6777431069, 42.1720869279, 20.7861494249, 663.85776157, 63.5652953169, 59.9233470207 }}, /* 4327 K */
+    {{ 37.6781261705, 42.173439401, 20.7861494238, 663.864599974, 63.5664715201, 59.9250987317 }}, /* 4328 K */
+    {{ 37.6785091716, 42.1747914718, 20.7861494227, 663.871431491, 63.5676482291, 59.9268500665 }}, /* 4329 K */
+    {{ 37.6788921106, 42.1761431406, 20.7861494216, 663.878256128, 63.5688254445, 59.9286010259 }}, /* 4330 K */
+    {{ 37.6792749876, 42.1774944075, 20.7861494205, 663.885073894, 63.570003167, 59.9303516105 }}, /* 4331 K */
+    {{ 37.6796578027, 42.1788452725, 20.7861494194, 663.891884796, 63.5711813975, 59.9321018211 }}, /* 4332 K */
+    {{ 37.6800405563, 42.1801957358, 20.7861494183, 663.898688843, 63.5723601364, 59.9338516585 }}, /* 4333 K */
+    {{ 37.6804232484, 42.1815457976, 20.7861494172, 663.905486043, 63.5735393846, 59.9356011234 }}, /* 4334 K */
+    {{ 37.6808058793, 42.1828954579, 20.7861494161, 663.912276404, 63.5747191428, 59.9373502164 }}, /* 4335 K */
+    {{ 37.6811884492, 42.1842447169, 20.786149415, 663.919059933, 63.5758994115, 59.9390989385 }}, /* 4336 K */
+    {{ 37.6815709583, 42.1855935747, 20.7861494139, 663.925836638, 63.5770801916, 59.9408472903 }}, /* 4337 K */
+    {{ 37.6819534068, 42.1869420313, 20.7861494128, 663.932606528, 63.5782614836, 59.9425952724 }}, /* 4338 K */
+    {{ 37.6823357948, 42.188290087, 20.7861494117, 663.93936961, 63.5794432883, 59.9443428858 }}, /* 4339 K */
+    {{ 37.6827181227, 42.1896377418, 20.7861494106, 663.946125892, 63.5806256064, 59.9460901311 }}, /* 4340 K */
+    {{ 37.6831003905, 42.1909849959, 20.7861494095, 663.952875383, 63.5818084386, 59.9478370089 }}, /* 4341 K */
+    {{ 37.6834825985, 42.1923318494, 20.7861494084, 663.959618089, 63.5829917855, 59.9495835202 }}, /* 4342 K */
+    {{ 37.6838647468, 42.1936783024, 20.7861494073, 663.966354019, 63.5841756479, 59.9513296655 }}, /* 4343 K */
+    {{ 37.6842468358, 42.195024355, 20.7861494062, 663.973083181, 63.5853600264, 59.9530754457 }}, /* 4344 K */
+    {{ 37.6846288655, 42.1963700073, 20.786149405, 663.979805583, 63.5865449217, 59.9548208614 }}, /* 4345 K */
+    {{ 37.6850108362, 42.1977152595, 20.7861494039, 663.986521231, 63.5877303346, 59.9565659134 }}, /* 4346 K */
+    {{ 37.6853927481, 42.1990601117, 20.7861494028, 663.993230135, 63.5889162656, 59.9583106023 }}, /* 4347 K */
+    {{ 37.6857746014, 42.200404564, 20.7861494017, 663.999932302, 63.5901027156, 59.960054929 }}, /* 4348 K */
+    {{ 37.6861563962, 42.2017486165, 20.7861494006, 664.00662774, 63.5912896851, 59.9617988942 }}, /* 4349 K */
+    {{ 37.6865381328, 42.2030922693, 20.7861493995, 664.013316456, 63.5924771749, 59.9635424985 }}, /* 4350 K */
+    {{ 37.6869198114, 42.2044355226, 20.7861493984, 664.019998458, 63.5936651857, 59.9652857427 }}, /* 4351 K */
+    {{ 37.6873014321, 42.2057783765, 20.7861493973, 664.026673755, 63.5948537181, 59.9670286274 }}, /* 4352 K */
+    {{ 37.6876829952, 42.2071208311, 20.7861493962, 664.033342354, 63.5960427729, 59.9687711535 }}, /* 4353 K */
+    {{ 37.6880645009, 42.2084628865, 20.7861493951, 664.040004262, 63.5972323507, 59.9705133217 }}, /* 4354 K */
+    {{ 37.6884459494, 42.2098045428, 20.786149394, 664.046659487, 63.5984224522, 59.9722551326 }}, /* 4355 K */
+    {{ 37.6888273408, 42.2111458002, 20.7861493929, 664.053308037, 63.5996130781, 59.9739965869 }}, /* 4356 K */
+    {{ 37.6892086754, 42.2124866587, 20.7861493918, 664.05994992, 63.6008042291, 59.9757376855 }}, /* 4357 K */
+    {{ 37.6895899533, 42.2138271186, 20.7861493907, 664.066585144, 63.6019959059, 59.9774784289 }}, /* 4358 K */
+    {{ 37.6899711748, 42.2151671799, 20.7861493896, 664.073213715, 63.6031881092, 59.979218818 }}, /* 4359 K */
+    {{ 37.6903523401, 42.2165068427, 20.7861493885, 664.079835642, 63.6043808397, 59.9809588533 }}, /* 4360 K */
+    {{ 37.6907334493, 42.2178461072, 20.7861493874, 664.086450933, 63.605574098, 59.9826985357 }}, /* 4361 K */
+    {{ 37.6911145027, 42.2191849734, 20.7861493863, 664.093059595, 63.6067678848, 59.9844378658 }}, /* 4362 K */
+    {{ 37.6914955005, 42.2205234415, 20.7861493852, 664.099661635, 63.6079622008, 59.9861768444 }}, /* 4363 K */
+    {{ 37.6918764428, 42.2218615117, 20.7861493841, 664.106257062, 63.6091570468, 59.9879154721 }}, /* 4364 K */
+    {{ 37.6922573299, 42.223199184, 20.7861493829, 664.112845882, 63.6103524234, 59.9896537496 }}, /* 4365 K */
+    {{ 37.692638162, 42.2245364585, 20.7861493818, 664.119428104, 63.6115483313, 59.9913916777 }}, /* 4366 K */
+    {{ 37.6930189392, 42.2258733354, 20.7861493807, 664.126003735, 63.6127447711, 59.9931292571 }}, /* 4367 K */
+    {{ 37.6933996617, 42.2272098148, 20.7861493796, 664.132572783, 63.6139417436, 59.9948664884 }}, /* 4368 K */
+    {{ 37.6937803299, 42.2285458968, 20.7861493785, 664.139135255, 63.6151392495, 59.9966033723 }}, /* 4369 K */
+    {{ 37.6941609437, 42.2298815815, 20.7861493774, 664.145691159, 63.6163372894, 59.9983399096 }}, /* 4370 K */
+    {{ 37.6945415036, 42.2312168691, 20.7861493763, 664.152240502, 63.6175358641, 60.000076101 }}, /* 4371 K */
+    {{ 37.6949220096, 42.2325517596, 20.7861493752, 664.158783292, 63.6187349741, 60.0018119471 }}, /* 4372 K */
+    {{ 37.6953024619, 42.2338862533, 20.7861493741, 664.165319537, 63.6199346203, 60.0035474487 }}, /* 4373 K */
+    {{ 37.6956828608, 42.2352203501, 20.786149373, 664.171849243, 63.6211348033, 60.0052826064 }}, /* 4374 K */
+    {{ 37.6960632065, 42.2365540503, 20.7861493719, 664.178372419, 63.6223355237, 60.0070174209 }}, /* 4375 K */
+    {{ 37.6964434991, 42.2378873539, 20.7861493708, 664.184889071, 63.6235367823, 60.0087518929 }}, /* 4376 K */
+    {{ 37.6968237389, 42.239220261, 20.7861493697, 664.191399208, 63.6247385798, 60.0104860232 }}, /* 4377 K */
+    {{ 37.697203926, 42.2405527719, 20.7861493686, 664.197902836, 63.6259409168, 60.0122198124 }}, /* 4378 K */
+    {{ 37.6975840607, 42.2418848865, 20.7861493675, 664.204399964, 63.627143794, 60.0139532611 }}, /* 4379 K */
+    {{ 37.6979641431, 42.2432166051, 20.7861493664, 664.210890599, 63.6283472122, 60.0156863702 }}, /* 4380 K */
+    {{ 37.6983441735, 42.2445479277, 20.7861493653, 664.217374747, 63.6295511719, 60.0174191402 }}, /* 4381 K */
+    {{ 37.698724152, 42.2458788545, 20.7861493642, 664.223852417, 63.630755674, 60.0191515719 }}, /* 4382 K */
+    {{ 37.6991040789, 42.2472093855, 20.7861493631, 664.230323616, 63.631960719, 60.0208836659 }}, /* 4383 K */
+    {{ 37.6994839543, 42.2485395209, 20.786149362, 664.236788352, 63.6331663077, 60.0226154229 }}, /* 4384 K */
+    {{ 37.6998637785, 42.2498692609, 20.7861493609, 664.243246631, 63.6343724407, 60.0243468436 }}, /* 4385 K */
+    {{ 37.7002435516, 42.2511986055, 20.7861493598, 664.249698461, 63.6355791188, 60.0260779287 }}, /* 4386 K */
+    {{ 37.7006232739, 42.2525275548, 20.7861493587, 664.256143849, 63.6367863425, 60.0278086789 }}, /* 4387 K */
+    {{ 37.7010029455, 42.253856109, 20.7861493576, 664.262582803, 63.6379941127, 60.0295390949 }}, /* 4388 K */
+    {{ 37.7013825667, 42.2551842682, 20.7861493565, 664.269015331, 63.63920243, 60.0312691772 }}, /* 4389 K */
+    {{ 37.7017621376, 42.2565120326, 20.7861493554, 664.275441438, 63.6404112951, 60.0329989266 }}, /* 4390 K */
+    {{ 37.7021416585, 42.2578394021, 20.7861493543, 664.281861134, 63.6416207086, 60.0347283439 }}, /* 4391 K */
+    {{ 37.7025211295, 42.259166377, 20.7861493532, 664.288274424, 63.6428306713, 60.0364574295 }}, /* 4392 K */
+    {{ 37.7029005508, 42.2604929574, 20.7861493521, 664.294681317, 63.6440411838, 60.0381861843 }}, /* 4393 K */
+    {{ 37.7032799228, 42.2618191433, 20.786149351, 664.301081819, 63.6452522469, 60.0399146089 }}, /* 4394 K */
+    {{ 37.7036592454, 42.2631449349, 20.7861493499, 664.307475938, 63.6464638612, 60.0416427039 }}, /* 4395 K */
+    {{ 37.704038519, 42.2644703324, 20.7861493488, 664.313863681, 63.6476760273, 60.0433704701 }}, /* 4396 K */
+    {{ 37.7044177438, 42.2657953358, 20.7861493477, 664.320245056, 63.648888746, 60.0450979081 }}, /* 4397 K */
+    {{ 37.7047969199, 42.2671199453, 20.7861493466, 664.326620069, 63.650102018, 60.0468250186 }}, /* 4398 K */
+    {{ 37.7051760475, 42.268444161, 20.7861493455, 664.332988728, 63.651315844, 60.0485518021 }}, /* 4399 K */
+    {{ 37.7055551269, 42.2697679829, 20.7861493444, 664.33935104, 63.6525302246, 60.0502782595 }}, /* 4400 K */
+    {{ 37.7059341583, 42.2710914113, 20.7861493434, 664.345707012, 63.6537451605, 60.0520043914 }}, /* 4401 K */
+    {{ 37.7063131418, 42.2724144462, 20.7861493423, 664.352056651, 63.6549606524, 60.0537301984 }}, /* 4402 K */
+    {{ 37.7066920776, 42.2737370877, 20.7861493412, 664.358399965, 63.656176701, 60.0554556812 }}, /* 4403 K */
+    {{ 37.707070966, 42.275059336, 20.7861493401, 664.364736961, 63.657393307, 60.0571808404 }}, /* 4404 K */
+    {{ 37.7074498071, 42.2763811912, 20.786149339, 664.371067646, 63.6586104711, 60.0589056768 }}, /* 4405 K */
+    {{ 37.7078286012, 42.2777026535, 20.7861493379, 664.377392026, 63.6598281939, 60.0606301909 }}, /* 4406 K */
+    {{ 37.7082073484, 42.2790237228, 20.7861493368, 664.38371011, 63.6610464761, 60.0623543834 }}, /* 4407 K */
+    {{ 37.708586049, 42.2803443994, 20.7861493357, 664.390021904, 63.6622653185, 60.0640782551 }}, /* 4408 K */
+    {{ 37.7089647031, 42.2816646834, 20.7861493346, 664.396327415, 63.6634847216, 60.0658018064 }}, /* 4409 K */
+    {{ 37.709343311, 42.2829845748, 20.7861493335, 664.402626651, 63.6647046863, 60.0675250382 }}, /* 4410 K */
+    {{ 37.7097218728, 42.2843040739, 20.7861493324, 664.408919618, 63.6659252131, 60.0692479511 }}, /* 4411 K */
+    {{ 37.7101003887, 42.2856231806, 20.7861493314, 664.415206324, 63.6671463027, 60.0709705456 }}, /* 4412 K */
+    {{ 37.710478859, 42.2869418952, 20.7861493303, 664.421486776, 63.668367956, 60.0726928225 }}, /* 4413 K */
+    {{ 37.7108572839, 42.2882602178, 20.7861493292, 664.42776098, 63.6695901734, 60.0744147824 }}, /* 4414 K */
+    {{ 37.7112356635, 42.2895781484, 20.7861493281, 664.434028944, 63.6708129557, 60.0761364259 }}, /* 4415 K */
+    {{ 37.7116139981, 42.2908956872, 20.786149327, 664.440290675, 63.6720363037, 60.0778577537 }}, /* 4416 K */
+    {{ 37.7119922878, 42.2922128344, 20.7861493259, 664.446546179, 63.6732602179, 60.0795787665 }}, /* 4417 K */
+    {{ 37.7123705328, 42.2935295899, 20.7861493248, 664.452795465, 63.6744846991, 60.0812994649 }}, /* 4418 K */
+    {{ 37.7127487334, 42.2948459541, 20.7861493238, 664.459038538, 63.6757097479, 60.0830198495 }}, /* 4419 K */
+    {{ 37.7131268898, 42.2961619268, 20.7861493227, 664.465275406, 63.676935365, 60.084739921 }}, /* 4420 K */
+    {{ 37.7135050021, 42.2974775084, 20.7861493216, 664.471506075, 63.6781615512, 60.08645968 }}, /* 4421 K */
+    {{ 37.7138830705, 42.2987926989, 20.7861493205, 664.477730554, 63.679388307, 60.0881791272 }}, /* 4422 K */
+    {{ 37.7142610953, 42.3001074984, 20.7861493194, 664.483948848, 63.6806156333, 60.0898982632 }}, /* 4423 K */
+    {{ 37.7146390767, 42.301421907, 20.7861493184, 664.490160964, 63.6818435306, 60.0916170886 }}, /* 4424 K */
+    {{ 37.7150170148, 42.3027359249, 20.7861493173, 664.49636691, 63.6830719996, 60.0933356041 }}, /* 4425 K */
+    {{ 37.7153949099, 42.3040495521, 20.7861493162, 664.502566693, 63.6843010411, 60.0950538103 }}, /* 4426 K */
+    {{ 37.7157727621, 42.3053627889, 20.7861493151, 664.508760318, 63.6855306557, 60.0967717078 }}, /* 4427 K */
+    {{ 37.7161505717, 42.3066756352, 20.786149314, 664.514947794, 63.6867608441, 60.0984892974 }}, /* 4428 K */
+    {{ 37.7165283388, 42.3079880913, 20.786149313, 664.521129127, 63.687991607, 60.1002065796 }}, /* 4429 K */
+    {{ 37.7169060637, 42.3093001572, 20.7861493119, 664.527304324, 63.689222945, 60.101923555 }}, /* 4430 K */
+    {{ 37.7172837465, 42.3106118331, 20.7861493108, 664.533473392, 63.6904548589, 60.1036402243 }}, /* 4431 K */
+    {{ 37.7176613875, 42.3119231191, 20.7861493097, 664.539636337, 63.6916873493, 60.1053565881 }}, /* 4432 K */
+    {{ 37.7180389869, 42.3132340153, 20.7861493087, 664.545793167, 63.692920417, 60.107072647 }}, /* 4433 K */
+    {{ 37.7184165448, 42.3145445218, 20.7861493076, 664.551943888, 63.6941540625, 60.1087884018 }}, /* 4434 K */
+    {{ 37.7187940615, 42.3158546387, 20.7861493065, 664.558088508, 63.6953882866, 60.1105038529 }}, /* 4435 K */
+    {{ 37.7191715371, 42.3171643662, 20.7861493055, 664.564227032, 63.69662309, 60.112219001 }}, /* 4436 K */
+    {{ 37.7195489719, 42.3184737044, 20.7861493044, 664.570359468, 63.6978584733, 60.1139338468 }}, /* 4437 K */
+    {{ 37.7199263661, 42.3197826533, 20.7861493033, 664.576485822, 63.6990944372, 60.1156483908 }}, /* 4438 K */
+    {{ 37.7203037198, 42.3210912131, 20.7861493022, 664.582606102, 63.7003309825, 60.1173626338 }}, /* 4439 K */
+    {{ 37.7206810333, 42.322399384, 20.7861493012, 664.588720313, 63.7015681097, 60.1190765762 }}, /* 4440 K */
+    {{ 37.7210583067, 42.323707166, 20.7861493001, 664.594828464, 63.7028058197, 60.1207902188 }}, /* 4441 K */
+    {{ 37.7214355404, 42.3250145593, 20.786149299, 664.60093056, 63.7040441129, 60.1225035622 }}, /* 4442 K */
+    {{ 37.7218127343, 42.326321564, 20.786149298, 664.607026608, 63.7052829903, 60.1242166069 }}, /* 4443 K */
+    {{ 37.7221898889, 42.3276281801, 20.7861492969, 664.613116614, 63.7065224523, 60.1259293536 }}, /* 4444 K */
+    {{ 37.7225670042, 42.3289344079, 20.7861492959, 664.619200587, 63.7077624998, 60.1276418029 }}, /* 4445 K */
+    {{ 37.7229440805, 42.3302402474, 20.7861492948, 664.625278532, 63.7090031333, 60.1293539554 }}, /* 4446 K */
+    {{ 37.723321118, 42.3315456987, 20.7861492937, 664.631350456, 63.7102443536, 60.1310658117 }}, /* 4447 K */
+    {{ 37.7236981168, 42.332850762, 20.7861492927, 664.637416365, 63.7114861614, 60.1327773725 }}, /* 4448 K */
+    {{ 37.7240750772, 42.3341554374, 20.7861492916, 664.643476267, 63.7127285573, 60.1344886383 }}, /* 4449 K */
+    {{ 37.7244519994, 42.335459725, 20.7861492906, 664.649530167, 63.713971542, 60.1361996098 }}, /* 4450 K */
+    {{ 37.7248288836, 42.3367636249, 20.7861492895, 664.655578073, 63.7152151162, 60.1379102876 }}, /* 4451 K */
+    {{ 37.7252057299, 42.3380671372, 20.7861492884, 664.661619992, 63.7164592806, 60.1396206722 }}, /* 4452 K */
+    {{ 37.7255825386, 42.3393702621, 20.7861492874, 664.667655929, 63.7177040358, 60.1413307643 }}, /* 4453 K */
+    {{ 37.7259593099, 42.3406729996, 20.7861492863, 664.673685891, 63.7189493826, 60.1430405645 }}, /* 4454 K */
+    {{ 37.726336044, 42.34197535, 20.7861492853, 664.679709886, 63.7201953216, 60.1447500735 }}, /* 4455 K */
+    {{ 37.7267127411, 42.3432773132, 20.7861492842, 664.685727919, 63.7214418535, 60.1464592917 }}, /* 4456 K */
+    {{ 37.7270894013, 42.3445788895, 20.7861492832, 664.691739997, 63.722688979, 60.1481682198 }}, /* 4457 K */
+    {{ 37.727466025, 42.3458800789, 20.7861492821, 664.697746126, 63.7239366988, 60.1498768584 }}, /* 4458 K */
+    {{ 37.7278426122, 42.3471808815, 20.7861492811, 664.703746314, 63.7251850136, 60.1515852081 }}, /* 4459 K */
+    {{ 37.7282191632, 42.3484812975, 20.78614928, 664.709740567, 63.7264339239, 60.1532932695 }}, /* 4460 K */
+    {{ 37.7285956782, 42.349781327, 20.786149279, 664.715728891, 63.7276834306, 60.1550010433 }}, /* 4461 K */
+    {{ 37.7289721574, 42.3510809702, 20.7861492779, 664.721711293, 63.7289335342, 60.1567085299 }}, /* 4462 K */
+    {{ 37.729348601, 42.352380227, 20.7861492769, 664.727687779, 63.7301842356, 60.15841573 }}, /* 4463 K */
+    {{ 37.7297250092, 42.3536790977, 20.7861492758, 664.733658355, 63.7314355353, 60.1601226442 }}, /* 4464 K */
+    {{ 37.7301013822, 42.3549775823, 20.7861492748, 664.739623029, 63.732687434, 60.1618292731 }}, /* 4465 K */
+    {{ 37.7304777202, 42.356275681, 20.7861492738, 664.745581807, 63.7339399324, 60.1635356172 }}, /* 4466 K */
+    {{ 37.7308540234, 42.3575733939, 20.7861492727, 664.751534694, 63.7351930313, 60.1652416772 }}, /* 4467 K */
+    {{ 37.731230292, 42.3588707211, 20.7861492717, 664.757481699, 63.7364467312, 60.1669474537 }}, /* 4468 K */
+    {{ 37.7316065262, 42.3601676627, 20.7861492706, 664.763422826, 63.7377010329, 60.1686529472 }}, /* 4469 K */
+    {{ 37.7319827262, 42.3614642189, 20.7861492696, 664.769358083, 63.738955937, 60.1703581584 }}, /* 4470 K */
+    {{ 37.7323588922, 42.3627603897, 20.7861492686, 664.775287475, 63.7402114443, 60.1720630877 }}, /* 4471 K */
+    {{ 37.7327350244, 42.3640561753, 20.7861492675, 664.78121101, 63.7414675553, 60.1737677359 }}, /* 4472 K */
+    {{ 37.7331111231, 42.3653515758, 20.7861492665, 664.787128693, 63.7427242709, 60.1754721034 }}, /* 4473 K */
+    {{ 37.7334871883, 42.3666465913, 20.7861492655, 664.793040531, 63.7439815916, 60.177176191 }}, /* 4474 K */
+    {{ 37.7338632204, 42.367941222, 20.7861492644, 664.798946531, 63.7452395181, 60.178879999 }}, /* 4475 K */
+    {{ 37.7342392195, 42.3692354678, 20.7861492634, 664.804846698, 63.7464980512, 60.1805835283 }}, /* 4476 K */
+    {{ 37.7346151858, 42.3705293291, 20.7861492624, 664.81074104, 63.7477571915, 60.1822867792 }}, /* 4477 K */
+    {{ 37.7349911196, 42.3718228058, 20.7861492613, 664.816629561, 63.7490169396, 60.1839897524 }}, /* 4478 K */
+    {{ 37.7353670209, 42.373115898, 20.7861492603, 664.82251227, 63.7502772963, 60.1856924485 }}, /* 4479 K */
+    {{ 37.7357428901, 42.374408606, 20.7861492593, 664.828389171, 63.7515382623, 60.1873948681 }}, /* 4480 K */
+    {{ 37.7361187273, 42.3757009299, 20.7861492583, 664.834260272, 63.7527998382, 60.1890970117 }}, /* 4481 K */
+    {{ 37.7364945328, 42.3769928696, 20.7861492573, 664.840125578, 63.7540620247, 60.1907988798 }}, /* 4482 K */
+    {{ 37.7368703067, 42.3782844254, 20.7861492562, 664.845985096, 63.7553248225, 60.1925004732 }}, /* 4483 K */
+    {{ 37.7372460492, 42.3795755974, 20.7861492552, 664.851838832, 63.7565882322, 60.1942017923 }}, /* 4484 K */
+    {{ 37.7376217606, 42.3808663857, 20.7861492542, 664.857686793, 63.7578522546, 60.1959028377 }}, /* 4485 K */
+    {{ 37.737997441, 42.3821567904, 20.7861492532, 664.863528984, 63.7591168903, 60.19760361 }}, /* 4486 K */
+    {{ 37.7383730907, 42.3834468116, 20.7861492522, 664.869365412, 63.76038214, 60.1993041098 }}, /* 4487 K */
+    {{ 37.7387487098, 42.3847364494, 20.7861492511, 664.875196083, 63.7616480044, 60.2010043376 }}, /* 4488 K */
+    {{ 37.7391242985, 42.386025704, 20.7861492501, 664.881021003, 63.7629144842, 60.202704294 }}, /* 4489 K */
+    {{ 37.7394998571, 42.3873145755, 20.7861492491, 664.886840179, 63.76418158, 60.2044039795 }}, /* 4490 K */
+    {{ 37.7398753858, 42.3886030639, 20.7861492481, 664.892653616, 63.7654492925, 60.2061033948 }}, /* 4491 K */
+    {{ 37.7402508847, 42.3898911694, 20.7861492471, 664.898461321, 63.7667176224, 60.2078025403 }}, /* 4492 K */
+    {{ 37.7406263541, 42.3911788922, 20.7861492461, 664.904263301, 63.7679865705, 60.2095014167 }}, /* 4493 K */
+    {{ 37.7410017942, 42.3924662323, 20.7861492451, 664.91005956, 63.7692561372, 60.2112000246 }}, /* 4494 K */
+    {{ 37.7413772051, 42.3937531899, 20.7861492441, 664.915850105, 63.7705263234, 60.2128983644 }}, /* 4495 K */
+    {{ 37.7417525871, 42.395039765, 20.7861492431, 664.921634943, 63.7717971298, 60.2145964367 }}, /* 4496 K */
+    {{ 37.7421279403, 42.3963259578, 20.7861492421, 664.92741408, 63.7730685569, 60.2162942421 }}, /* 4497 K */
+    {{ 37.7425032651, 42.3976117684, 20.7861492411, 664.933187521, 63.7743406055, 60.2179917812 }}, /* 4498 K */
+    {{ 37.7428785615, 42.3988971969, 20.7861492401, 664.938955273, 63.7756132763, 60.2196890544 }}, /* 4499 K */
+    {{ 37.7432538298, 42.4001822434, 20.7861492391, 664.944717341, 63.7768865699, 60.2213860624 }}, /* 4500 K */
+    {{ 37.7436290702, 42.4014669081, 20.7861492381, 664.950473733, 63.778160487, 60.2230828058 }}, /* 4501 K */
+    {{ 37.7440042828, 42.4027511911, 20.7861492371, 664.956224453, 63.7794350283, 60.224779285 }}, /* 4502 K */
+    {{ 37.744379468, 42.4040350924, 20.7861492361, 664.961969508, 63.7807101945, 60.2264755006 }}, /* 4503 K */
+    {{ 37.7447546258, 42.4053186122, 20.7861492351, 664.967708905, 63.7819859862, 60.2281714532 }}, /* 4504 K */
+    {{ 37.7451297566, 42.4066017506, 20.7861492341, 664.973442648, 63.7832624042, 60.2298671433 }}, /* 4505 K */
+    {{ 37.7455048605, 42.4078845078, 20.7861492331, 664.979170745, 63.784539449, 60.2315625714 }}, /* 4506 K */
+    {{ 37.7458799376, 42.4091668838, 20.7861492321, 664.984893201, 63.7858171215, 60.2332577382 }}, /* 4507 K */
+    {{ 37.7462549883, 42.4104488787, 20.7861492312, 664.990610021, 63.7870954222, 60.2349526441 }}, /* 4508 K */
+    {{ 37.7466300127, 42.4117304927, 20.7861492302, 664.996321213, 63.7883743519, 60.2366472898 }}, /* 4509 K */
+    {{ 37.7470050109, 42.4130117259, 20.7861492292, 665.002026782, 63.7896539112, 60.2383416757 }}, /* 4510 K */
+    {{ 37.7473799834, 42.4142925784, 20.7861492282, 665.007726734, 63.7909341008, 60.2400358023 }}, /* 4511 K */
+    {{ 37.7477549301, 42.4155730503, 20.7861492272, 665.013421075, 63.7922149213, 60.2417296704 }}, /* 4512 K */
+    {{ 37.7481298513, 42.4168531417, 20.7861492263, 665.019109811, 63.7934963736, 60.2434232802 }}, /* 4513 K */
+    {{ 37.7485047473, 42.4181328528, 20.7861492253, 665.024792948, 63.7947784581, 60.2451166325 }}, /* 4514 K */
+    {{ 37.7488796182, 42.4194121837, 20.7861492243, 665.030470491, 63.7960611757, 60.2468097278 }}, /* 4515 K */
+    {{ 37.7492544643, 42.4206911344, 20.7861492233, 665.036142447, 63.797344527, 60.2485025665 }}, /* 4516 K */
+    {{ 37.7496292857, 42.4219697051, 20.7861492224, 665.041808822, 63.7986285126, 60.2501951493 }}, /* 4517 K */
+    {{ 37.7500040826, 42.423247896, 20.7861492214, 665.047469621, 63.7999131333, 60.2518874766 }}, /* 4518 K */
+    {{ 37.7503788553, 42.424525707, 20.7861492204, 665.05312485, 63.8011983897, 60.253579549 }}, /* 4519 K */
+    {{ 37.7507536039, 42.4258031384, 20.7861492195, 665.058774516, 63.8024842826, 60.255271367 }}, /* 4520 K */
+    {{ 37.7511283287, 42.4270801903, 20.7861492185, 665.064418624, 63.8037708125, 60.2569629312 }}, /* 4521 K */
+    {{ 37.7515030299, 42.4283568627, 20.7861492175, 665.07005718, 63.8050579801, 60.2586542421 }}, /* 4522 K */
+    {{ 37.7518777076, 42.4296331558, 20.7861492166, 665.075690189, 63.8063457862, 60.2603453002 }}, /* 4523 K */
+    {{ 37.7522523621, 42.4309090697, 20.7861492156, 665.081317658, 63.8076342315, 60.262036106 }}, /* 4524 K */
+    {{ 37.7526269935, 42.4321846045, 20.7861492147, 665.086939592, 63.8089233165, 60.2637266602 }}, /* 4525 K */
+    {{ 37.7530016022, 42.4334597603, 20.7861492137, 665.092555998, 63.810213042, 60.2654169631 }}, /* 4526 K */
+    {{ 37.7533761882, 42.4347345373, 20.7861492128, 665.09816688, 63.8115034086, 60.2671070153 }}, /* 4527 K */
+    {{ 37.7537507518, 42.4360089355, 20.7861492118, 665.103772245, 63.8127944171, 60.2687968174 }}, /* 4528 K */
+    {{ 37.7541252931, 42.4372829551, 20.7861492109, 665.109372099, 63.8140860681, 60.2704863699 }}, /* 4529 K */
+    {{ 37.7544998125, 42.4385565962, 20.7861492099, 665.114966447, 63.8153783622, 60.2721756733 }}, /* 4530 K */
+    {{ 37.7548743101, 42.4398298589, 20.786149209, 665.120555295, 63.8166713002, 60.2738647281 }}, /* 4531 K */
+    {{ 37.7552487861, 42.4411027433, 20.786149208, 665.126138648, 63.8179648828, 60.2755535348 }}, /* 4532 K */
+    {{ 37.7556232406, 42.4423752496, 20.7861492071, 665.131716514, 63.8192591105, 60.277242094 }}, /* 4533 K */
+    {{ 37.755997674, 42.4436473778, 20.7861492062, 665.137288896, 63.8205539842, 60.2789304061 }}, /* 4534 K */
+    {{ 37.7563720864, 42.444919128, 20.7861492052, 665.142855801, 63.8218495044, 60.2806184718 }}, /* 4535 K */
+    {{ 37.756746478, 42.4461905004, 20.7861492043, 665.148417235, 63.8231456719, 60.2823062914 }}, /* 4536 K */
+    {{ 37.7571208491, 42.4474614952, 20.7861492033, 665.153973203, 63.8244424873, 60.2839938656 }}, /* 4537 K */
+    {{ 37.7574951998, 42.4487321123, 20.7861492024, 665.159523711, 63.8257399513, 60.2856811948 }}, /* 4538 K */
+    {{ 37.7578695303, 42.4500023519, 20.7861492015, 665.165068764, 63.8270380646, 60.2873682796 }}, /* 4539 K */
+    {{ 37.7582438408, 42.4512722142, 20.7861492006, 665.170608369, 63.8283368278, 60.2890551204 }}, /* 4540 K */
+    {{ 37.7586181316, 42.4525416992, 20.7861491996, 665.17614253, 63.8296362417, 60.2907417177 }}, /* 4541 K */
+    {{ 37.7589924029, 42.453810807, 20.7861491987, 665.181671254, 63.8309363068, 60.2924280722 }}, /* 4542 K */
+    {{ 37.7593666547, 42.4550795379, 20.7861491978, 665.187194546, 63.832237024, 60.2941141842 }}, /* 4543 K */
+    {{ 37.7597408875, 42.4563478918, 20.7861491969, 665.192712412, 63.8335383938, 60.2958000543 }}, /* 4544 K */
+    {{ 37.7601151013, 42.457615869, 20.7861491959, 665.198224857, 63.834840417, 60.297485683 }}, /* 4545 K */
+    {{ 37.7604892964, 42.4588834694, 20.786149195, 665.203731887, 63.8361430941, 60.2991710708 }}, /* 4546 K */
+    {{ 37.760863473, 42.4601506933, 20.7861491941, 665.209233507, 63.837446426, 60.3008562183 }}, /* 4547 K */
+    {{ 37.7612376312, 42.4614175407, 20.7861491932, 665.214729724, 63.8387504132, 60.3025411258 }}, /* 4548 K */
+    {{ 37.7616117713, 42.4626840118, 20.7861491923, 665.220220542, 63.8400550565, 60.3042257939 }}, /* 4549 K */
+    {{ 37.7619858935, 42.4639501067, 20.7861491914, 665.225705967, 63.8413603565, 60.3059102232 }}, /* 4550 K */
+    {{ 37.762359998, 42.4652158254, 20.7861491905, 665.231186004, 63.8426663139, 60.307594414 }}, /* 4551 K */
+    {{ 37.762734085, 42.4664811682, 20.7861491896, 665.23666066, 63.8439729294, 60.3092783669 }}, /* 4552 K */
+    {{ 37.7631081547, 42.4677461351, 20.7861491887, 665.242129939, 63.8452802036, 60.3109620825 }}, /* 4553 K */
+    {{ 37.7634822073, 42.4690107262, 20.7861491878, 665.247593848, 63.8465881373, 60.3126455611 }}, /* 4554 K */
+    {{ 37.7638562431, 42.4702749416, 20.7861491869, 665.253052391, 63.8478967311, 60.3143288034 }}, /* 4555 K */
+    {{ 37.7642302621, 42.4715387815, 20.786149186, 665.258505574, 63.8492059856, 60.3160118097 }}, /* 4556 K */
+    {{ 37.7646042647, 42.472802246, 20.7861491851, 665.263953403, 63.8505159016, 60.3176945806 }}, /* 4557 K */
+    {{ 37.764978251, 42.4740653351, 20.7861491842, 665.269395883, 63.8518264798, 60.3193771165 }}, /* 4558 K */
+    {{ 37.7653522213, 42.475328049, 20.7861491833, 665.274833019, 63.8531377207, 60.3210594181 }}, /* 4559 K */
+    {{ 37.7657261757, 42.4765903879, 20.7861491824, 665.280264817, 63.8544496251, 60.3227414856 }}, /* 4560 K */
+    {{ 37.7661001144, 42.4778523518, 20.7861491815, 665.285691282, 63.8557621937, 60.3244233198 }}, /* 4561 K */
+    {{ 37.7664740377, 42.4791139408, 20.7861491807, 665.29111242, 63.8570754272, 60.3261049209 }}, /* 4562 K */
+    {{ 37.7668479458, 42.4803751551, 20.7861491798, 665.296528236, 63.8583893261, 60.3277862895 }}, /* 4563 K */
+    {{ 37.7672218388, 42.4816359947, 20.7861491789, 665.301938736, 63.8597038913, 60.3294674262 }}, /* 4564 K */
+    {{ 37.767595717, 42.4828964598, 20.786149178, 665.307343924, 63.8610191233, 60.3311483313 }}, /* 4565 K */
+    {{ 37.7679695806, 42.4841565505, 20.7861491772, 665.312743806, 63.8623350228, 60.3328290054 }}, /* 4566 K */
+    {{ 37.7683434298, 42.4854162669, 20.7861491763, 665.318138389, 63.8636515906, 60.3345094489 }}, /* 4567 K */
+    {{ 37.7687172647, 42.4866756091, 20.7861491754, 665.323527676, 63.8649688273, 60.3361896623 }}, /* 4568 K */
+    {{ 37.7690910857, 42.4879345773, 20.7861491745, 665.328911673, 63.8662867335, 60.3378696462 }}, /* 4569 K */
+    {{ 37.7694648929, 42.4891931714, 20.7861491737, 665.334290386, 63.86760531, 60.3395494009 }}, /* 4570 K */
+    {{ 37.7698386864, 42.4904513918, 20.7861491728, 665.33966382, 63.8689245574, 60.341228927 }}, /* 4571 K */
+    {{ 37.7702124666, 42.4917092384, 20.786149172, 665.345031979, 63.8702444764, 60.3429082249 }}, /* 4572 K */
+    {{ 37.7705862337, 42.4929667114, 20.7861491711, 665.350394871, 63.8715650677, 60.3445872951 }}, /* 4573 K */
+    {{ 37.7709599877, 42.4942238109, 20.7861491703, 665.355752499, 63.8728863319, 60.3462661381 }}, /* 4574 K */
+    {{ 37.771333729, 42.495480537, 20.7861491694, 665.361104869, 63.8742082697, 60.3479447544 }}, /* 4575 K */
+    {{ 37.7717074577, 42.4967368898, 20.7861491686, 665.366451986, 63.8755308819, 60.3496231444 }}, /* 4576 K */
+    {{ 37.7720811741, 42.4979928695, 20.7861491677, 665.371793856, 63.876854169, 60.3513013085 }}, /* 4577 K */
+    {{ 37.7724548784, 42.4992484761, 20.7861491669, 665.377130484, 63.8781781318, 60.3529792474 }}, /* 4578 K */
+    {{ 37.7728285707, 42.5005037097, 20.786149166, 665.382461874, 63.8795027709, 60.3546569614 }}, /* 4579 K */
+    {{ 37.7732022512, 42.5017585706, 20.7861491652, 665.387788033, 63.880828087, 60.356334451 }}, /* 4580 K */
+    {{ 37.7735759203, 42.5030130587, 20.7861491643, 665.393108965, 63.8821540807, 60.3580117167 }}, /* 4581 K */
+    {{ 37.773949578, 42.5042671742, 20.7861491635, 665.398424676, 63.8834807529, 60.3596887589 }}, /* 4582 K */
+    {{ 37.7743232246, 42.5055209172, 20.7861491627, 665.40373517, 63.884808104, 60.3613655781 }}, /* 4583 K */
+    {{ 37.7746968604, 42.5067742879, 20.7861491618, 665.409040454, 63.8861361349, 60.3630421747 }}, /* 4584 K */
+    {{ 37.7750704854, 42.5080272863, 20.786149161, 665.414340531, 63.8874648461, 60.3647185493 }}, /* 4585 K */
+    {{ 37.7754440999, 42.5092799125, 20.7861491602, 665.419635408, 63.8887942384, 60.3663947023 }}, /* 4586 K */
+    {{ 37.7758177042, 42.5105321667, 20.7861491594, 665.424925089, 63.8901243124, 60.3680706341 }}, /* 4587 K */
+    {{ 37.7761912984, 42.511784049, 20.7861491585, 665.430209579, 63.8914550688, 60.3697463452 }}, /* 4588 K */
+    {{ 37.7765648827, 42.5130355594, 20.7861491577, 665.435488884, 63.8927865083, 60.3714218361 }}, /* 4589 K */
+    {{ 37.7769384574, 42.5142866982, 20.7861491569, 665.440763009, 63.8941186316, 60.3730971072 }}, /* 4590 K */
+    {{ 37.7773120226, 42.5155374653, 20.7861491561, 665.446031959, 63.8954514392, 60.374772159 }}, /* 4591 K */
+    {{ 37.7776855785, 42.516787861, 20.7861491553, 665.451295738, 63.896784932, 60.3764469919 }}, /* 4592 K */
+    {{ 37.7780591255, 42.5180378853, 20.7861491545, 665.456554353, 63.8981191106, 60.3781216064 }}, /* 4593 K */
+    {{ 37.7784326636, 42.5192875383, 20.7861491537, 665.461807807, 63.8994539756, 60.3797960029 }}, /* 4594 K */
+    {{ 37.7788061931, 42.5205368202, 20.7861491529, 665.467056107, 63.9007895277, 60.3814701819 }}, /* 4595 K */
+    {{ 37.7791797141, 42.5217857311, 20.7861491521, 665.472299257, 63.9021257677, 60.3831441438 }}, /* 4596 K */
+    {{ 37.779553227, 42.5230342711, 20.7861491513, 665.477537262, 63.9034626961, 60.3848178892 }}, /* 4597 K */
+    {{ 37.7799267319, 42.5242824402, 20.7861491505, 665.482770127, 63.9048003136, 60.3864914183 }}, /* 4598 K */
+    {{ 37.7803002289, 42.5255302387, 20.7861491497, 665.487997857, 63.906138621, 60.3881647317 }}, /* 4599 K */
+    {{ 37.7806737184, 42.5267776666, 20.7861491489, 665.493220457, 63.9074776189, 60.3898378299 }}, /* 4600 K */
+    {{ 37.7810472006, 42.528024724, 20.7861491481, 665.498437933, 63.908817308, 60.3915107132 }}, /* 4601 K */
+    {{ 37.7814206755, 42.529271411, 20.7861491473, 665.503650289, 63.9101576889, 60.3931833821 }}, /* 4602 K */
+    {{ 37.7817941435, 42.5305177278, 20.7861491466, 665.508857529, 63.9114987624, 60.3948558371 }}, /* 4603 K */
+    {{ 37.7821676047, 42.5317636744, 20.7861491458, 665.51405966, 63.912840529, 60.3965280786 }}, /* 4604 K */
+    {{ 37.7825410595, 42.5330092511, 20.786149145, 665.519256686, 63.9141829895, 60.398200107 }}, /* 4605 K */
+    {{ 37.7829145078, 42.5342544578, 20.7861491442, 665.524448612, 63.9155261446, 60.3998719228 }}, /* 4606 K */
+    {{ 37.7832879501, 42.5354992947, 20.7861491435, 665.529635443, 63.9168699949, 60.4015435264 }}, /* 4607 K */
+    {{ 37.7836613864, 42.5367437619, 20.7861491427, 665.534817183, 63.9182145411, 60.4032149183 }}, /* 4608 K */
+    {{ 37.784034817, 42.5379878596, 20.7861491419, 665.539993838, 63.9195597838, 60.4048860988 }}, /* 4609 K */
+    {{ 37.7844082421, 42.5392315877, 20.7861491412, 665.545165413, 63.9209057238, 60.4065570685 }}, /* 4610 K */
+    {{ 37.784781662, 42.5404749466, 20.7861491404, 665.550331912, 63.9222523617, 60.4082278277 }}, /* 4611 K */
+    {{ 37.7851550767, 42.5417179361, 20.7861491397, 665.55549334, 63.9235996983, 60.4098983769 }}, /* 4612 K */
+    {{ 37.7855284866, 42.5429605566, 20.7861491389, 665.560649703, 63.924947734, 60.4115687165 }}, /* 4613 K */
+    {{ 37.7859018918, 42.544202808, 20.7861491382, 665.565801005, 63.9262964698, 60.413238847 }}, /* 4614 K */
+    {{ 37.7862752925, 42.5454446905, 20.7861491374, 665.57094725, 63.9276459061, 60.4149087687 }}, /* 4615 K */
+    {{ 37.786648689, 42.5466862042, 20.7861491367, 665.576088444, 63.9289960437, 60.4165784822 }}, /* 4616 K */
+    {{ 37.7870220815, 42.5479273492, 20.7861491359, 665.581224592, 63.9303468833, 60.4182479877 }}, /* 4617 K */
+    {{ 37.7873954701, 42.5491681256, 20.7861491352, 665.586355698, 63.9316984256, 60.4199172859 }}, /* 4618 K */
+    {{ 37.7877688552, 42.5504085336, 20.7861491345, 665.591481767, 63.9330506711, 60.421586377 }}, /* 4619 K */
+    {{ 37.7881422368, 42.5516485732, 20.7861491337, 665.596602804, 63.9344036207, 60.4232552615 }}, /* 4620 K */
+    {{ 37.7885156152, 42.5528882445, 20.786149133, 665.601718814, 63.9357572749, 60.4249239399 }}, /* 4621 K */
+    {{ 37.7888889906, 42.5541275478, 20.7861491323, 665.606829801, 63.9371116344, 60.4265924125 }}, /* 4622 K */
+    {{ 37.7892623632, 42.555366483, 20.7861491316, 665.61193577, 63.9384666999, 60.4282606798 }}, /* 4623 K */
+    {{ 37.7896357332, 42.5566050503, 20.7861491308, 665.617036727, 63.9398224722, 60.4299287422 }}, /* 4624 K */
+    {{ 37.7900091009, 42.5578432497, 20.7861491301, 665.622132674, 63.9411789517, 60.4315966001 }}, /* 4625 K */
+    {{ 37.7903824664, 42.5590810815, 20.7861491294, 665.627223619, 63.9425361393, 60.4332642539 }}, /* 4626 K */
+    {{ 37.79075583, 42.5603185457, 20.7861491287, 665.632309564, 63.9438940357, 60.4349317041 }}, /* 4627 K */
+    {{ 37.7911291919, 42.5615556425, 20.786149128, 665.637390515, 63.9452526413, 60.436598951 }}, /* 4628 K */
+    {{ 37.7915025522, 42.5627923718, 20.7861491273, 665.642466477, 63.9466119571, 60.4382659951 }}, /* 4629 K */
+    {{ 37.7918759112, 42.5640287339, 20.7861491266, 665.647537453, 63.9479719836, 60.4399328368 }}, /* 4630 K */
+    {{ 37.792249269, 42.5652647289, 20.7861491259, 665.65260345, 63.9493327214, 60.4415994765 }}, /* 4631 K */
+    {{ 37.792622626, 42.5665003569, 20.7861491252, 665.657664471, 63.9506941714, 60.4432659146 }}, /* 4632 K */
+    {{ 37.7929959823, 42.5677356179, 20.7861491245, 665.662720521, 63.952056334, 60.4449321516 }}, /* 4633 K */
+    {{ 37.7933693382, 42.5689705121, 20.7861491238, 665.667771605, 63.9534192101, 60.4465981877 }}, /* 4634 K */
+    {{ 37.7937426937, 42.5702050396, 20.7861491231, 665.672817727, 63.9547828003, 60.4482640235 }}, /* 4635 K */
+    {{ 37.7941160492, 42.5714392005, 20.7861491225, 665.677858892, 63.9561471053, 60.4499296593 }}, /* 4636 K */
+    {{ 37.7944894049, 42.572672995, 20.7861491218, 665.682895105, 63.9575121257, 60.4515950956 }}, /* 4637 K */
+    {{ 37.7948627609, 42.5739064231, 20.7861491211, 665.68792637, 63.9588778622, 60.4532603328 }}, /* 4638 K */
+    {{ 37.7952361174, 42.5751394849, 20.7861491204, 665.692952692, 63.9602443155, 60.4549253712 }}, /* 4639 K */
+    {{ 37.7956094748, 42.5763721805, 20.7861491198, 665.697974075, 63.9616114863, 60.4565902112 }}, /* 4640 K */
+    {{ 37.7959828332, 42.5776045102, 20.7861491191, 665.702990524, 63.9629793752, 60.4582548533 }}, /* 4641 K */
+    {{ 37.7963561927, 42.5788364739, 20.7861491184, 665.708002044, 63.9643479829, 60.4599192979 }}, /* 4642 K */
+    {{ 37.7967295537, 42.5800680717, 20.7861491178, 665.713008638, 63.96571731, 60.4615835453 }}, /* 4643 K */
+    {{ 37.7971029163, 42.5812993039, 20.7861491171, 665.718010312, 63.9670873574, 60.463247596 }}, /* 4644 K */
+    {{ 37.7974762807, 42.5825301704, 20.7861491165, 665.72300707, 63.9684581255, 60.4649114504 }}, /* 4645 K */
+    {{ 37.7978496472, 42.5837606715, 20.7861491158, 665.727998917, 63.9698296152, 60.4665751088 }}, /* 4646 K */
+    {{ 37.7982230159, 42.5849908072, 20.7861491152, 665.732985856, 63.971201827, 60.4682385716 }}, /* 4647 K */
+    {{ 37.7985963871, 42.5862205776, 20.7861491145, 665.737967893, 63.9725747617, 60.4699018393 }}, /* 4648 K */
+    {{ 37.798969761, 42.5874499829, 20.7861491139, 665.742945033, 63.9739484199, 60.4715649122 }}, /* 4649 K */
+    {{ 37.7993431378, 42.588679023, 20.7861491132, 665.747917278, 63.9753228023, 60.4732277907 }}, /* 4650 K */
+    {{ 37.7997165176, 42.5899076983, 20.7861491126, 665.752884635, 63.9766979095, 60.4748904753 }}, /* 4651 K */
+    {{ 37.8000899008, 42.5911360087, 20.786149112, 665.757847107, 63.9780737423, 60.4765529662 }}, /* 4652 K */
+    {{ 37.8004632875, 42.5923639544, 20.7861491114, 665.762804699, 63.9794503013, 60.478215264 }}, /* 4653 K */
+    {{ 37.8008366779, 42.5935915355, 20.7861491107, 665.767757415, 63.9808275872, 60.4798773689 }}, /* 4654 K */
+    {{ 37.8012100723, 42.594818752, 20.7861491101, 665.772705259, 63.9822056007, 60.4815392813 }}, /* 4655 K */
+    {{ 37.8015834709, 42.5960456042, 20.7861491095, 665.777648237, 63.9835843423, 60.4832010018 }}, /* 4656 K */
+    {{ 37.8019568738, 42.5972720921, 20.7861491089, 665.782586352, 63.9849638129, 60.4848625305 }}, /* 4657 K */
+    {{ 37.8023302812, 42.5984982158, 20.7861491083, 665.787519609, 63.9863440131, 60.486523868 }}, /* 4658 K */
+    {{ 37.8027036935, 42.5997239754, 20.7861491077, 665.792448012, 63.9877249435, 60.4881850146 }}, /* 4659 K */
+    {{ 37.8030771108, 42.600949371, 20.7861491071, 665.797371566, 63.9891066048, 60.4898459706 }}, /* 4660 K */
+    {{ 37.8034505332, 42.6021744028, 20.7861491065, 665.802290275, 63.9904889977, 60.4915067365 }}, /* 4661 K */
+    {{ 37.8038239612, 42.6033990709, 20.7861491059, 665.807204143, 63.9918721229, 60.4931673126 }}, /* 4662 K */
+    {{ 37.8041973947, 42.6046233753, 20.7861491053, 665.812113174, 63.9932559811, 60.4948276994 }}, /* 4663 K */
+    {{ 37.8045708341, 42.6058473162, 20.7861491047, 665.817017373, 63.9946405728, 60.4964878971 }}, /* 4664 K */
+    {{ 37.8049442795, 42.6070708937, 20.7861491041, 665.821916745, 63.9960258988, 60.4981479062 }}, /* 4665 K */
+    {{ 37.8053177313, 42.6082941078, 20.7861491035, 665.826811293, 63.9974119598, 60.4998077271 }}, /* 4666 K */
+    {{ 37.8056911895, 42.6095169588, 20.786149103, 665.831701022, 63.9987987564, 60.50146736 }}, /* 4667 K */
+    {{ 37.8060646544, 42.6107394467, 20.7861491024, 665.836585936, 64.0001862894, 60.5031268054 }}, /* 4668 K */
+    {{ 37.8064381262, 42.6119615715, 20.7861491018, 665.841466039, 64.0015745593, 60.5047860637 }}, /* 4669 K */
+    {{ 37.8068116051, 42.6131833335, 20.7861491013, 665.846341336, 64.0029635668, 60.5064451352 }}, /* 4670 K */
+    {{ 37.8071850914, 42.6144047328, 20.7861491007, 665.85121183, 64.0043533127, 60.5081040203 }}, /* 4671 K */
+    {{ 37.8075585852, 42.6156257694, 20.7861491001, 665.856077527, 64.0057437975, 60.5097627194 }}, /* 4672 K */
+    {{ 37.8079320868, 42.6168464434, 20.7861490996, 665.86093843, 64.0071350221, 60.5114212328 }}, /* 4673 K */
+    {{ 37.8083055964, 42.618066755, 20.786149099, 665.865794543, 64.0085269869, 60.5130795609 }}, /* 4674 K */
+    {{ 37.8086791141, 42.6192867042, 20.7861490985, 665.870645871, 64.0099196928, 60.514737704 }}, /* 4675 K */
+    {{ 37.8090526402, 42.6205062912, 20.7861490979, 665.875492418, 64.0113131404, 60.5163956626 }}, /* 4676 K */
+    {{ 37.8094261749, 42.6217255161, 20.7861490974, 665.880334188, 64.0127073303, 60.5180534369 }}, /* 4677 K */
+    {{ 37.8097997185, 42.622944379, 20.7861490969, 665.885171186, 64.0141022633, 60.5197110274 }}, /* 4678 K */
+    {{ 37.8101732711, 42.62416288, 20.7861490963, 665.890003414, 64.0154979399, 60.5213684344 }}, /* 4679 K */
+    {{ 37.8105468329, 42.6253810191, 20.7861490958, 665.894830879, 64.016894361, 60.5230256582 }}, /* 4680 K */
+    {{ 37.8109204042, 42.6265987966, 20.7861490953, 665.899653583, 64.018291527, 60.5246826993 }}, /* 4681 K */
+    {{ 37.8112939852, 42.6278162125, 20.7861490948, 665.90447153, 64.0196894388, 60.5263395579 }}, /* 4682 K */
+    {{ 37.811667576, 42.629033267, 20.7861490942, 665.909284726, 64.021088097, 60.5279962345 }}, /* 4683 K */
+    {{ 37.812041177, 42.63024996, 20.7861490937, 665.914093174, 64.0224875023, 60.5296527294 }}, /* 4684 K */
+    {{ 37.8124147883, 42.6314662918, 20.7861490932, 665.918896878, 64.0238876553, 60.5313090429 }}, /* 4685 K */
+    {{ 37.8127884101, 42.6326822625, 20.7861490927, 665.923695842, 64.0252885567, 60.5329651754 }}, /* 4686 K */
+    {{ 37.8131620426, 42.6338978721, 20.7861490922, 665.928490071, 64.0266902071, 60.5346211272 }}, /* 4687 K */
+    {{ 37.8135356861, 42.6351131208, 20.7861490917, 665.933279567, 64.0280926074, 60.5362768988 }}, /* 4688 K */
+    {{ 37.8139093407, 42.6363280087, 20.7861490912, 665.938064337, 64.029495758, 60.5379324904 }}, /* 4689 K */
+    {{ 37.8142830068, 42.6375425358, 20.7861490907, 665.942844382, 64.0308996598, 60.5395879024 }}, /* 4690 K */
+    {{ 37.8146566844, 42.6387567023, 20.7861490902, 665.947619709, 64.0323043133, 60.5412431351 }}, /* 4691 K */
+    {{ 37.8150303738, 42.6399705083, 20.7861490898, 665.952390319, 64.0337097192, 60.5428981889 }}, /* 4692 K */
+    {{ 37.8154040753, 42.6411839539, 20.7861490893, 665.957156219, 64.0351158783, 60.5445530641 }}, /* 4693 K */
+    {{ 37.815777789, 42.6423970393, 20.7861490888, 665.961917411, 64.0365227912, 60.5462077611 }}, /* 4694 K */
+    {{ 37.8161515151, 42.6436097644, 20.7861490883, 665.966673899, 64.0379304585, 60.5478622803 }}, /* 4695 K */
+    {{ 37.8165252539, 42.6448221294, 20.7861490879, 665.971425688, 64.0393388809, 60.5495166219 }}, /* 4696 K */
+    {{ 37.8168990056, 42.6460341345, 20.7861490874, 665.976172782, 64.0407480592, 60.5511707863 }}, /* 4697 K */
+    {{ 37.8172727704, 42.6472457797, 20.786149087, 665.980915184, 64.0421579939, 60.5528247738 }}, /* 4698 K */
+    {{ 37.8176465485, 42.6484570652, 20.7861490865, 665.985652898, 64.0435686858, 60.5544785848 }}, /* 4699 K */
+    {{ 37.8180203401, 42.649667991, 20.7861490861, 665.990385929, 64.0449801354, 60.5561322197 }}, /* 4700 K */
+    {{ 37.8183941454, 42.6508785573, 20.7861490856, 665.99511428, 64.0463923436, 60.5577856786 }}, /* 4701 K */
+    {{ 37.8187679647, 42.6520887641, 20.7861490852, 665.999837955, 64.047805311, 60.5594389621 }}, /* 4702 K */
+    {{ 37.8191417981, 42.6532986116, 20.7861490847, 666.004556958, 64.0492190381, 60.5610920704 }}, /* 4703 K */
+    {{ 37.819515646, 42.6545080999, 20.7861490843, 666.009271294, 64.0506335258, 60.5627450039 }}, /* 4704 K */
+    {{ 37.8198895084, 42.655717229, 20.7861490839, 666.013980965, 64.0520487746, 60.5643977628 }}, /* 4705 K */
+    {{ 37.8202633856, 42.6569259992, 20.7861490835, 666.018685976, 64.0534647853, 60.5660503476 }}, /* 4706 K */
+    {{ 37.8206372779, 42.6581344104, 20.786149083, 666.023386331, 64.0548815586, 60.5677027585 }}, /* 4707 K */
+    {{ 37.8210111854, 42.6593424628, 20.7861490826, 666.028082033, 64.056299095, 60.5693549959 }}, /* 4708 K */
+    {{ 37.8213851083, 42.6605501566, 20.7861490822, 666.032773086, 64.0577173953, 60.5710070601 }}, /* 4709 K */
+    {{ 37.8217590469, 42.6617574917, 20.7861490818, 666.037459495, 64.0591364601, 60.5726589514 }}, /* 4710 K */
+    {{ 37.8221330014, 42.6629644684, 20.7861490814, 666.042141263, 64.0605562901, 60.5743106702 }}, /* 4711 K */
+    {{ 37.822506972, 42.6641710867, 20.786149081, 666.046818393, 64.061976886, 60.5759622167 }}, /* 4712 K */
+    {{ 37.8228809589, 42.6653773467, 20.7861490806, 666.051490891, 64.0633982485, 60.5776135914 }}, /* 4713 K */
+    {{ 37.8232549623, 42.6665832486, 20.7861490802, 666.056158758, 64.0648203781, 60.5792647945 }}, /* 4714 K */
+    {{ 37.8236289825, 42.6677887924, 20.7861490798, 666.060822, 64.0662432757, 60.5809158263 }}, /* 4715 K */
+    {{ 37.8240030196, 42.6689939782, 20.7861490794, 666.06548062, 64.0676669419, 60.5825666873 }}, /* 4716 K */
+    {{ 37.8243770739, 42.6701988063, 20.7861490791, 666.070134622, 64.0690913772, 60.5842173776 }}, /* 4717 K */
+    {{ 37.8247511456, 42.6714032765, 20.7861490787, 666.074784009, 64.0705165825, 60.5858678976 }}, /* 4718 K */
+    {{ 37.8251252349, 42.6726073892, 20.7861490783, 666.079428785, 64.0719425584, 60.5875182476 }}, /* 4719 K */
+    {{ 37.825499342, 42.6738111443, 20.786149078, 666.084068955, 64.0733693055, 60.589168428 }}, /* 4720 K */
+    {{ 37.8258734672, 42.675014542, 20.7861490776, 666.088704521, 64.0747968246, 60.590818439 }}, /* 4721 K */
+    {{ 37.8262476106, 42.6762175823, 20.7861490772, 666.093335487, 64.0762251162, 60.592468281 }}, /* 4722 K */
+    {{ 37.8266217725, 42.6774202655, 20.7861490769, 666.097961858, 64.0776541812, 60.5941179543 }}, /* 4723 K */
+    {{ 37.8269959531, 42.6786225915, 20.7861490765, 666.102583637, 64.07908402, 60.5957674592 }}, /* 4724 K */
+    {{ 37.8273701525, 42.6798245606, 20.7861490762, 666.107200826, 64.0805146335, 60.597416796 }}, /* 4725 K */
+    {{ 37.8277443711, 42.6810261727, 20.7861490759, 666.111813432, 64.0819460222, 60.599065965 }}, /* 4726 K */
+    {{ 37.8281186091, 42.6822274281, 20.7861490755, 666.116421456, 64.083378187, 60.6007149665 }}, /* 4727 K */
+    {{ 37.8284928665, 42.6834283268, 20.7861490752, 666.121024902, 64.0848111283, 60.6023638008 }}, /* 4728 K */
+    {{ 37.8288671438, 42.6846288689, 20.7861490749, 666.125623775, 64.0862448469, 60.6040124683 }}, /* 4729 K */
+    {{ 37.829241441, 42.6858290545, 20.7861490746, 666.130218077, 64.0876793435, 60.6056609692 }}, /* 4730 K */
+    {{ 37.8296157584, 42.6870288837, 20.7861490742, 666.134807813, 64.0891146188, 60.6073093039 }}, /* 4731 K */
+    {{ 37.8299900963, 42.6882283567, 20.7861490739, 666.139392985, 64.0905506733, 60.6089574726 }}, /* 4732 K */
+    {{ 37.8303644548, 42.6894274736, 20.7861490736, 666.143973599, 64.0919875079, 60.6106054757 }}, /* 4733 K */
+    {{ 37.8307388341, 42.6906262343, 20.7861490733, 666.148549656, 64.0934251231, 60.6122533134 }}, /* 4734 K */
+    {{ 37.8311132345, 42.6918246391, 20.786149073, 666.153121161, 64.0948635196, 60.6139009861 }}, /* 4735 K */
+    {{ 37.8314876562, 42.6930226881, 20.7861490727, 666.157688118, 64.0963026981, 60.615548494 }}, /* 4736 K */
+    {{ 37.8318620994, 42.6942203813, 20.7861490725, 666.162250529, 64.0977426593, 60.6171958374 }}, /* 4737 K */
+    {{ 37.8322365643, 42.6954177189, 20.7861490722, 666.166808399, 64.0991834038, 60.6188430167 }}, /* 4738 K */
+    {{ 37.8326110511, 42.696614701, 20.7861490719, 666.17136173, 64.1006249324, 60.6204900322 }}, /* 4739 K */
+    {{ 37.8329855601, 42.6978113276, 20.7861490716, 666.175910528, 64.1020672456, 60.6221368841 }}, /* 4740 K */
+    {{ 37.8333600914, 42.6990075989, 20.7861490713, 666.180454794, 64.1035103442, 60.6237835727 }}, /* 4741 K */
+    {{ 37.8337346454, 42.700203515, 20.7861490711, 666.184994532, 64.1049542288, 60.6254300983 }}, /* 4742 K */
+    {{ 37.8341092221, 42.701399076, 20.7861490708, 666.189529747, 64.1063989001, 60.6270764612 }}, /* 4743 K */
+    {{ 37.8344838219, 42.7025942819, 20.7861490706, 666.194060441, 64.1078443588, 60.6287226618 }}, /* 4744 K */
+    {{ 37.8348584449, 42.703789133, 20.7861490703, 666.198586618, 64.1092906055, 60.6303687002 }}, /* 4745 K */
+    {{ 37.8352330914, 42.7049836292, 20.7861490701, 666.203108281, 64.1107376409, 60.6320145768 }}, /* 4746 K */
+    {{ 37.8356077616, 42.7061777708, 20.7861490698, 666.207625435, 64.1121854657, 60.6336602919 }}, /* 4747 K */
+    {{ 37.8359824556, 42.7073715577, 20.7861490696, 666.212138081, 64.1136340806, 60.6353058457 }}, /* 4748 K */
+    {{ 37.8363571738, 42.7085649902, 20.7861490694, 666.216646225, 64.1150834862, 60.6369512386 }}, /* 4749 K */
+    {{ 37.8367319163, 42.7097580683, 20.7861490691, 666.221149868, 64.1165336832, 60.6385964708 }}, /* 4750 K */
+    {{ 37.8371066833, 42.7109507921, 20.7861490689, 666.225649015, 64.1179846722, 60.6402415425 }}, /* 4751 K */
+    {{ 37.8374814751, 42.7121431617, 20.7861490687, 666.23014367, 64.119436454, 60.6418864542 }}, /* 4752 K */
+    {{ 37.8378562919, 42.7133351772, 20.7861490685, 666.234633834, 64.1208890292, 60.643531206 }}, /* 4753 K */
+    {{ 37.8382311339, 42.7145268388, 20.7861490683, 666.239119512, 64.1223423985, 60.6451757983 }}, /* 4754 K */
+    {{ 37.8386060013, 42.7157181465, 20.7861490681, 666.243600708, 64.1237965625, 60.6468202313 }}, /* 4755 K */
+    {{ 37.8389808944, 42.7169091004, 20.7861490679, 666.248077423, 64.125251522, 60.6484645053 }}, /* 4756 K */
+    {{ 37.8393558133, 42.7180997007, 20.7861490677, 666.252549663, 64.1267072776, 60.6501086206 }}, /* 4757 K */
+    {{ 37.8397307583, 42.7192899474, 20.7861490675, 666.25701743, 64.1281638299, 60.6517525774 }}, /* 4758 K */
+    {{ 37.8401057295, 42.7204798406, 20.7861490673, 666.261480727, 64.1296211797, 60.6533963761 }}, /* 4759 K */
+    {{ 37.8404807273, 42.7216693805, 20.7861490672, 666.265939558, 64.1310793275, 60.6550400168 }}, /* 4760 K */
+    {{ 37.8408557519, 42.7228585672, 20.786149067, 666.270393927, 64.1325382742, 60.6566835 }}, /* 4761 K */
+    {{ 37.8412308034, 42.7240474007, 20.7861490668, 666.274843835, 64.1339980203, 60.6583268257 }}, /* 4762 K */
+    {{ 37.841605882, 42.7252358812, 20.7861490667, 666.279289288, 64.1354585665, 60.6599699944 }}, /* 4763 K */
+    {{ 37.8419809881, 42.7264240087, 20.7861490665, 666.283730287, 64.1369199135, 60.6616130062 }}, /* 4764 K */
+    {{ 37.8423561217, 42.7276117834, 20.7861490664, 666.288166837, 64.138382062, 60.6632558616 }}, /* 4765 K */
+    {{ 37.8427312832, 42.7287992053, 20.7861490662, 666.29259894, 64.1398450126, 60.6648985606 }}, /* 4766 K */
+    {{ 37.8431064728, 42.7299862746, 20.7861490661, 666.297026601, 64.141308766, 60.6665411036 }}, /* 4767 K */
+    {{ 37.8434816906, 42.7311729914, 20.7861490659, 666.301449821, 64.1427733229, 60.6681834908 }}, /* 4768 K */
+    {{ 37.8438569369, 42.7323593558, 20.7861490658, 666.305868604, 64.144238684, 60.6698257226 }}, /* 4769 K */
+    {{ 37.8442322119, 42.7335453678, 20.7861490657, 666.310282954, 64.1457048498, 60.6714677991 }}, /* 4770 K */
+    {{ 37.8446075158, 42.7347310277, 20.7861490656, 666.314692873, 64.1471718212, 60.6731097206 }}, /* 4771 K */
+    {{ 37.8449828489, 42.7359163354, 20.7861490654, 666.319098366, 64.1486395987, 60.6747514875 }}, /* 4772 K */
+    {{ 37.8453582114, 42.7371012911, 20.7861490653, 666.323499434, 64.1501081831, 60.6763930999 }}, /* 4773 K */
+    {{ 37.8457336034, 42.7382858948, 20.7861490652, 666.327896082, 64.1515775749, 60.6780345581 }}, /* 4774 K */
+    {{ 37.8461090252, 42.7394701468, 20.7861490651, 666.332288312, 64.1530477749, 60.6796758624 }}, /* 4775 K */
+    {{ 37.8464844771, 42.7406540471, 20.786149065, 666.336676127, 64.1545187838, 60.681317013 }}, /* 4776 K */
+    {{ 37.8468599592, 42.7418375957, 20.786149065, 666.341059531, 64.1559906022, 60.6829580101 }}, /* 4777 K */
+    {{ 37.8472354718, 42.7430207929, 20.7861490649, 666.345438527, 64.1574632308, 60.6845988541 }}, /* 4778 K */
+    {{ 37.8476110151, 42.7442036386, 20.7861490648, 666.349813118, 64.1589366702, 60.6862395452 }}, /* 4779 K */
+    {{ 37.8479865893, 42.745386133, 20.7861490647, 666.354183308, 64.1604109212, 60.6878800836 }}, /* 4780 K */
+    {{ 37.8483621946, 42.7465682763, 20.7861490647, 666.358549098, 64.1618859844, 60.6895204696 }}, /* 4781 K */
+    {{ 37.8487378313, 42.7477500684, 20.7861490646, 666.362910492, 64.1633618604, 60.6911607035 }}, /* 4782 K */
+    {{ 37.8491134995, 42.7489315096, 20.7861490645, 666.367267494, 64.16483855, 60.6928007854 }}, /* 4783 K */
+    {{ 37.8494891995, 42.7501125999, 20.7861490645, 666.371620107, 64.1663160538, 60.6944407157 }}, /* 4784 K */
+    {{ 37.8498649316, 42.7512933393, 20.7861490644, 666.375968333, 64.1677943725, 60.6960804945 }}, /* 4785 K */
+    {{ 37.8502406958, 42.7524737281, 20.7861490644, 666.380312175, 64.1692735067, 60.6977201222 }}, /* 4786 K */
+    {{ 37.8506164925, 42.7536537663, 20.7861490644, 666.384651637, 64.1707534572, 60.6993595989 }}, /* 4787 K */
+    {{ 37.8509923219, 42.754833454, 20.7861490643, 666.388986722, 64.1722342245, 60.7009989249 }}, /* 4788 K */
+    {{ 37.8513681842, 42.7560127913, 20.7861490643, 666.393317432, 64.1737158094, 60.7026381005 }}, /* 4789 K */
+    {{ 37.8517440797, 42.7571917784, 20.7861490643, 666.397643771, 64.1751982126, 60.7042771259 }}, /* 4790 K */
+    {{ 37.8521200084, 42.7583704152, 20.7861490643, 666.401965742, 64.1766814347, 60.7059160013 }}, /* 4791 K */
+    {{ 37.8524959707, 42.759548702, 20.7861490643, 666.406283347, 64.1781654763, 60.707554727 }}, /* 4792 K */
+    {{ 37.8528719668, 42.7607266388, 20.7861490643, 666.41059659, 64.1796503382, 60.7091933032 }}, /* 4793 K */
+    {{ 37.8532479969, 42.7619042257, 20.7861490643, 666.414905473, 64.1811360211, 60.7108317301 }}, /* 4794 K */
+    {{ 37.8536240613, 42.7630814628, 20.7861490643, 666.41921, 64.1826225255, 60.712470008 }}, /* 4795 K */
+    {{ 37.85400016, 42.7642583503, 20.7861490643, 666.423510174, 64.1841098522, 60.7141081372 }}, /* 4796 K */
+    {{ 37.8543762935, 42.7654348882, 20.7861490643, 666.427805997, 64.1855980018, 60.7157461178 }}, /* 4797 K */
+    {{ 37.8547524618, 42.7666110766, 20.7861490643, 666.432097473, 64.187086975, 60.71738395 }}, /* 4798 K */
+    {{ 37.8551286653, 42.7677869156, 20.7861490644, 666.436384603, 64.1885767725, 60.7190216342 }}, /* 4799 K */
+    {{ 37.855504904, 42.7689624054, 20.7861490644, 666.440667392, 64.190067395, 60.7206591706 }}, /* 4800 K */
+    {{ 37.8558811784, 42.770137546, 20.7861490645, 666.444945843, 64.1915588431, 60.7222965593 }}, /* 4801 K */
+    {{ 37.8562574885, 42.7713123375, 20.7861490645, 666.449219957, 64.1930511174, 60.7239338006 }}, /* 4802 K */
+    {{ 37.8566338346, 42.77248678, 20.7861490646, 666.453489738, 64.1945442187, 60.7255708947 }}, /* 4803 K */
+    {{ 37.857010217, 42.7736608737, 20.7861490646, 666.457755189, 64.1960381477, 60.7272078419 }}, /* 4804 K */
+    {{ 37.8573866358, 42.7748346186, 20.7861490647, 666.462016312, 64.197532905, 60.7288446424 }}, /* 4805 K */
+    {{ 37.8577630912, 42.7760080149, 20.7861490648, 666.466273111, 64.1990284912, 60.7304812963 }}, /* 4806 K */
+    {{ 37.8581395836, 42.7771810625, 20.7861490648, 666.470525589, 64.2005249071, 60.732117804 }}, /* 4807 K */
+    {{ 37.8585161131, 42.7783537617, 20.7861490649, 666.474773747, 64.2020221532, 60.7337541657 }}, /* 4808 K */
+    {{ 37.8588926799, 42.7795261125, 20.786149065, 666.47901759, 64.2035202304, 60.7353903815 }}, /* 4809 K */
+    {{ 37.8592692842, 42.7806981151, 20.7861490651, 666.483257119, 64.2050191392, 60.7370264517 }}, /* 4810 K */
+    {{ 37.8596459264, 42.7818697695, 20.7861490652, 666.487492338, 64.2065188804, 60.7386623765 }}, /* 4811 K */
+    {{ 37.8600226066, 42.7830410758, 20.7861490653, 666.491723249, 64.2080194545, 60.7402981562 }}, /* 4812 K */
+    {{ 37.860399325, 42.7842120341, 20.7861490654, 666.495949855, 64.2095208624, 60.7419337908 }}, /* 4813 K */
+    {{ 37.8607760818, 42.7853826446, 20.7861490655, 666.50017216, 64.2110231045, 60.7435692808 }}, /* 4814 K */
+    {{ 37.8611528773, 42.7865529073, 20.7861490657, 666.504390165, 64.2125261817, 60.7452046262 }}, /* 4815 K */
+    {{ 37.8615297118, 42.7877228223, 20.7861490658, 666.508603873, 64.2140300945, 60.7468398273 }}, /* 4816 K */
+    {{ 37.8619065853, 42.7888923898, 20.7861490659, 666.512813288, 64.2155348437, 60.7484748843 }}, /* 4817 K */
+    {{ 37.8622834982, 42.7900616098, 20.7861490661, 666.517018411, 64.21704043, 60.7501097974 }}, /* 4818 K */
+    {{ 37.8626604507, 42.7912304824, 20.7861490662, 666.521219246, 64.2185468539, 60.7517445668 }}, /* 4819 K */
+    {{ 37.8630374429, 42.7923990078, 20.7861490664, 666.525415796, 64.2200541162, 60.7533791927 }}, /* 4820 K */
+    {{ 37.8634144752, 42.7935671859, 20.7861490665, 666.529608062, 64.2215622175, 60.7550136754 }}, /* 4821 K */
+    {{ 37.8637915478, 42.794735017, 20.7861490667, 666.533796048, 64.2230711585, 60.756648015 }}, /* 4822 K */
+    {{ 37.8641686608, 42.7959025012, 20.7861490669, 666.537979757, 64.2245809399, 60.7582822118 }}, /* 4823 K */
+    {{ 37.8645458144, 42.7970696384, 20.7861490671, 666.54215919, 64.2260915624, 60.7599162659 }}, /* 4824 K */
+    {{ 37.8649230091, 42.7982364289, 20.7861490672, 666.546334352, 64.2276030265, 60.7615501775 }}, /* 4825 K */
+    {{ 37.8653002448, 42.7994028727, 20.7861490674, 666.550505243, 64.2291153331, 60.763183947 }}, /* 4826 K */
+    {{ 37.8656775219, 42.8005689699, 20.7861490676, 666.554671868, 64.2306284827, 60.7648175744 }}, /* 4827 K */
+    {{ 37.8660548406, 42.8017347206, 20.7861490678, 666.558834228, 64.232142476, 60.7664510599 }}, /* 4828 K */
+    {{ 37.8664322011, 42.802900125, 20.786149068, 666.562992327, 64.2336573138, 60.7680844038 }}, /* 4829 K */
+    {{ 37.8668096037, 42.8040651831, 20.7861490683, 666.567146166, 64.2351729966, 60.7697176063 }}, /* 4830 K */
+    {{ 37.8671870485, 42.805229895, 20.7861490685, 666.571295749, 64.2366895252, 60.7713506675 }}, /* 4831 K */
+    {{ 37.8675645358, 42.8063942608, 20.7861490687, 666.575441078, 64.2382069002, 60.7729835877 }}, /* 4832 K */
+    {{ 37.8679420658, 42.8075582806, 20.7861490689, 666.579582155, 64.2397251222, 60.774616367 }}, /* 4833 K */
+    {{ 37.8683196388, 42.8087219545, 20.7861490692, 666.583718984, 64.241244192, 60.7762490057 }}, /* 4834 K */
+    {{ 37.8686972549, 42.8098852827, 20.7861490694, 666.587851566, 64.2427641103, 60.7778815038 }}, /* 4835 K */
+    {{ 37.8690749144, 42.8110482651, 20.7861490697, 666.591979905, 64.2442848776, 60.7795138618 }}, /* 4836 K */
+    {{ 37.8694526175, 42.812210902, 20.7861490699, 666.596104002, 64.2458064947, 60.7811460796 }}, /* 4837 K */
+    {{ 37.8698303645, 42.8133731934, 20.7861490702, 666.600223861, 64.2473289623, 60.7827781575 }}, /* 4838 K */
+    {{ 37.8702081555, 42.8145351393, 20.7861490705, 666.604339483, 64.2488522809, 60.7844100958 }}, /* 4839 K */
+    {{ 37.8705859908, 42.81569674, 20.7861490708, 666.608450873, 64.2503764514, 60.7860418945 }}, /* 4840 K */
+    {{ 37.8709638707, 42.8168579955, 20.786149071, 666.61255803, 64.2519014742, 60.7876735539 }}, /* 4841 K */
+    {{ 37.8713417952, 42.8180189059, 20.7861490713, 666.61666096, 64.2534273502, 60.7893050741 }}, /* 4842 K */
+    {{ 37.8717197648, 42.8191794712, 20.7861490716, 666.620759663, 64.25495408, 60.7909364554 }}, /* 4843 K */
+    {{ 37.8720977795, 42.8203396917, 20.7861490719, 666.624854142, 64.2564816643, 60.7925676979 }}, /* 4844 K */
+    {{ 37.8724758397, 42.8214995674, 20.7861490722, 666.6289444, 64.2580101037, 60.7941988018 }}, /* 4845 K */
+    {{ 37.8728539455, 42.8226590983, 20.7861490726, 666.633030439, 64.2595393989, 60.7958297673 }}, /* 4846 K */
+    {{ 37.8732320971, 42.8238182846, 20.7861490729, 666.637112262, 64.2610695506, 60.7974605946 }}, /* 4847 K */
+    {{ 37.8736102949, 42.8249771264, 20.7861490732, 666.641189871, 64.2626005594, 60.7990912838 }}, /* 4848 K */
+    {{ 37.873988539, 42.8261356238, 20.7861490735, 666.645263269, 64.2641324261, 60.8007218352 }}, /* 4849 K */
+    {{ 37.8743668297, 42.8272937769, 20.7861490739, 666.649332457, 64.2656651512, 60.8023522488 }}, /* 4850 K */
+    {{ 37.8747451671, 42.8284515858, 20.7861490742, 666.653397438, 64.2671987355, 60.8039825249 }}, /* 4851 K */
+    {{ 37.8751235515, 42.8296090505, 20.7861490746, 666.657458216, 64.2687331796, 60.8056126637 }}, /* 4852 K */
+    {{ 37.8755019832, 42.8307661712, 20.7861490749, 666.661514791, 64.2702684842, 60.8072426653 }}, /* 4853 K */
+    {{ 37.8758804623, 42.831922948, 20.7861490753, 666.665567166, 64.27180465, 60.8088725299 }}, /* 4854 K */
+    {{ 37.8762589891, 42.8330793809, 20.7861490757, 666.669615345, 64.2733416776, 60.8105022576 }}, /* 4855 K */
+    {{ 37.8766375638, 42.8342354701, 20.7861490761, 666.673659328, 64.2748795678, 60.8121318487 }}, /* 4856 K */
+    {{ 37.8770161867, 42.8353912156, 20.7861490765, 666.677699119, 64.2764183211, 60.8137613034 }}, /* 4857 K */
+    {{ 37.8773948579, 42.8365466176, 20.7861490769, 666.68173472, 64.2779579383, 60.8153906217 }}, /* 4858 K */
+    {{ 37.8777735778, 42.8377016762, 20.7861490773, 666.685766132, 64.27949842, 60.8170198038 }}, /* 4859 K */
+    {{ 37.8781523464, 42.8388563914, 20.7861490777, 666.68979336, 64.2810397669, 60.81864885 }}, /* 4860 K */
+    {{ 37.8785311641, 42.8400107634, 20.7861490781, 666.693816403, 64.2825819797, 60.8202777603 }}, /* 4861 K */
+    {{ 37.8789100311, 42.8411647922, 20.7861490785, 666.697835266, 64.284125059, 60.821906535 }}, /* 4862 K */
+    {{ 37.8792889475, 42.8423184779, 20.7861490789, 666.70184995, 64.2856690055, 60.8235351742 }}, /* 4863 K */
+    {{ 37.8796679137, 42.8434718207, 20.7861490794, 666.705860457, 64.2872138199, 60.825163678 }}, /* 4864 K */
+    {{ 37.8800469299, 42.8446248206, 20.7861490798, 666.709866791, 64.2887595029, 60.8267920467 }}, /* 4865 K */
+    {{ 37.8804259962, 42.8457774777, 20.7861490803, 666.713868952, 64.290306055, 60.8284202804 }}, /* 4866 K */
+    {{ 37.880805113, 42.8469297922, 20.7861490807, 666.717866943, 64.2918534771, 60.8300483792 }}, /* 4867 K */
+    {{ 37.8811842804, 42.848081764, 20.7861490812, 666.721860767, 64.2934017697, 60.8316763434 }}, /* 4868 K */
+    {{ 37.8815634987, 42.8492333934, 20.7861490816, 666.725850426, 64.2949509336, 60.8333041729 }}, /* 4869 K */
+    {{ 37.8819427681, 42.8503846805, 20.7861490821, 666.729835921, 64.2965009694, 60.8349318682 }}, /* 4870 K */
+    {{ 37.8823220888, 42.8515356252, 20.7861490826, 666.733817256, 64.2980518777, 60.8365594292 }}, /* 4871 K */
+    {{ 37.8827014611, 42.8526862277, 20.7861490831, 666.737794431, 64.2996036593, 60.8381868561 }}, /* 4872 K */
+    {{ 37.8830808851, 42.8538364881, 20.7861490836, 666.74176745, 64.3011563148, 60.8398141491 }}, /* 4873 K */
+    {{ 37.8834603612, 42.8549864065, 20.7861490841, 666.745736315, 64.3027098449, 60.8414413083 }}, /* 4874 K */
+    {{ 37.8838398895, 42.856135983, 20.7861490846, 666.749701028, 64.3042642502, 60.8430683339 }}, /* 4875 K */
+    {{ 37.8842194703, 42.8572852177, 20.7861490851, 666.75366159, 64.3058195315, 60.8446952261 }}, /* 4876 K */
+    {{ 37.8845991038, 42.8584341107, 20.7861490856, 666.757618005, 64.3073756894, 60.8463219849 }}, /* 4877 K */
+    {{ 37.8849787902, 42.8595826621, 20.7861490862, 666.761570273, 64.3089327246, 60.8479486106 }}, /* 4878 K */
+    {{ 37.8853585298, 42.8607308719, 20.7861490867, 666.765518398, 64.3104906377, 60.8495751032 }}, /* 4879 K */
+    {{ 37.8857383227, 42.8618787403, 20.7861490873, 666.769462381, 64.3120494294, 60.851201463 }}, /* 4880 K */
+    {{ 37.8861181693, 42.8630262674, 20.7861490878, 666.773402225, 64.3136091004, 60.85282769 }}, /* 4881 K */
+    {{ 37.8864980697, 42.8641734532, 20.7861490884, 666.777337931, 64.3151696513, 60.8544537844 }}, /* 4882 K */
+    {{ 37.8868780242, 42.8653202979, 20.7861490889, 666.781269502, 64.3167310829, 60.8560797464 }}, /* 4883 K */
+    {{ 37.8872580331, 42.8664668015, 20.7861490895, 666.78519694, 64.3182933958, 60.8577055761 }}, /* 4884 K */
+    {{ 37.8876380964, 42.8676129642, 20.7861490901, 666.789120246, 64.3198565907, 60.8593312736 }}, /* 4885 K */
+    {{ 37.8880182145, 42.868758786, 20.7861490907, 666.793039423, 64.3214206681, 60.8609568391 }}, /* 4886 K */
+    {{ 37.8883983876, 42.869904267, 20.7861490913, 666.796954473, 64.3229856289, 60.8625822726 }}, /* 4887 K */
+    {{ 37.888778616, 42.8710494074, 20.7861490919, 666.800865398, 64.3245514737, 60.8642075745 }}, /* 4888 K */
+    {{ 37.8891588998, 42.8721942072, 20.7861490925, 666.8047722, 64.3261182032, 60.8658327447 }}, /* 4889 K */
+    {{ 37.8895392392, 42.8733386665, 20.7861490931, 666.80867488, 64.3276858179, 60.8674577834 }}, /* 4890 K */
+    {{ 37.8899196346, 42.8744827855, 20.7861490937, 666.812573441, 64.3292543187, 60.8690826907 }}, /* 4891 K */
+    {{ 37.8903000862, 42.8756265641, 20.7861490944, 666.816467886, 64.3308237061, 60.8707074669 }}, /* 4892 K */
+    {{ 37.8906805941, 42.8767700025, 20.786149095, 666.820358215, 64.3323939808, 60.8723321119 }}, /* 4893 K */
+    {{ 37.8910611586, 42.8779131009, 20.7861490957, 666.824244431, 64.3339651436, 60.873956626 }}, /* 4894 K */
+    {{ 37.89144178, 42.8790558592, 20.7861490963, 666.828126535, 64.335537195, 60.8755810093 }}, /* 4895 K */
+    {{ 37.8918224584, 42.8801982776, 20.786149097, 666.832004531, 64.3371101358, 60.8772052619 }}, /* 4896 K */
+    {{ 37.8922031942, 42.8813403562, 20.7861490976, 666.835878419, 64.3386839667, 60.8788293839 }}, /* 4897 K */
+    {{ 37.8925839874, 42.8824820951, 20.7861490983, 666.839748201, 64.3402586882, 60.8804533754 }}, /* 4898 K */
+    {{ 37.8929648385, 42.8836234943, 20.786149099, 666.84361388, 64.341834301, 60.8820772367 }}, /* 4899 K */
+    {{ 37.8933457475, 42.884764554, 20.7861490997, 666.847475458, 64.3434108059, 60.8837009677 }}, /* 4900 K */
+    {{ 37.8937267147, 42.8859052742, 20.7861491004, 666.851332935, 64.3449882035, 60.8853245686 }}, /* 4901 K */
+    {{ 37.8941077404, 42.8870456551, 20.7861491011, 666.855186315, 64.3465664945, 60.8869480397 }}, /* 4902 K */
+    {{ 37.8944888248, 42.8881856967, 20.7861491018, 666.859035599, 64.3481456795, 60.8885713808 }}, /* 4903 K */
+    {{ 37.8948699682, 42.8893253992, 20.7861491025, 666.862880789, 64.3497257593, 60.8901945923 }}, /* 4904 K */
+    {{ 37.8952511706, 42.8904647626, 20.7861491033, 666.866721886, 64.3513067344, 60.8918176742 }}, /* 4905 K */
+    {{ 37.8956324325, 42.891603787, 20.786149104, 666.870558893, 64.3528886056, 60.8934406265 }}, /* 4906 K */
+    {{ 37.8960137539, 42.8927424725, 20.7861491047, 666.874391812, 64.3544713736, 60.8950634496 }}, /* 4907 K */
+    {{ 37.8963951352, 42.8938808193, 20.7861491055, 666.878220644, 64.3560550389, 60.8966861434 }}, /* 4908 K */
+    {{ 37.8967765766, 42.8950188273, 20.7861491062, 666.882045391, 64.3576396023, 60.898308708 }}, /* 4909 K */
+    {{ 37.8971580783, 42.8961564968, 20.786149107, 666.885866054, 64.3592250645, 60.8999311437 }}, /* 4910 K */
+    {{ 37.8975396405, 42.8972938277, 20.7861491078, 666.889682637, 64.360811426, 60.9015534504 }}, /* 4911 K */
+    {{ 37.8979212635, 42.8984308202, 20.7861491086, 666.89349514, 64.3623986877, 60.9031756284 }}, /* 4912 K */
+    {{ 37.8983029476, 42.8995674744, 20.7861491094, 666.897303565, 64.3639868501, 60.9047976777 }}, /* 4913 K */
+    {{ 37.8986846928, 42.9007037903, 20.7861491101, 666.901107914, 64.3655759139, 60.9064195984 }}, /* 4914 K */
+    {{ 37.8990664996, 42.9018397681, 20.786149111, 666.904908189, 64.3671658799, 60.9080413906 }}, /* 4915 K */
+    {{ 37.899448368, 42.9029754079, 20.7861491118, 666.908704392, 64.3687567486, 60.9096630545 }}, /* 4916 K */
+    {{ 37.8998302984, 42.9041107097, 20.7861491126, 666.912496523, 64.3703485208, 60.9112845901 }}, /* 4917 K */
+    {{ 37.9002122909, 42.9052456736, 20.7861491134, 666.916284586, 64.371941197, 60.9129059976 }}, /* 4918 K */
+    {{ 37.9005943459, 42.9063802998, 20.7861491142, 666.920068581, 64.3735347781, 60.9145272771 }}, /* 4919 K */
+    {{ 37.9009764634, 42.9075145883, 20.7861491151, 666.923848511, 64.3751292646, 60.9161484286 }}, /* 4920 K */
+    {{ 37.9013586439, 42.9086485392, 20.7861491159, 666.927624377, 64.3767246573, 60.9177694522 }}, /* 4921 K */
+    {{ 37.9017408875, 42.9097821526, 20.7861491168, 666.931396181, 64.3783209567, 60.9193903482 }}, /* 4922 K */
+    {{ 37.9021231943, 42.9109154286, 20.7861491177, 666.935163924, 64.3799181637, 60.9210111165 }}, /* 4923 K */
+    {{ 37.9025055648, 42.9120483673, 20.7861491185, 666.938927608, 64.3815162787, 60.9226317572 }}, /* 4924 K */
+    {{ 37.9028879991, 42.9131809688, 20.7861491194, 666.942687236, 64.3831153026, 60.9242522706 }}, /* 4925 K */
+    {{ 37.9032704974, 42.9143132332, 20.7861491203, 666.946442807, 64.384715236, 60.9258726565 }}, /* 4926 K */
+    {{ 37.90365306, 42.9154451605, 20.7861491212, 666.950194325, 64.3863160795, 60.9274929153 }}, /* 4927 K */
+    {{ 37.904035687, 42.9165767509, 20.7861491221, 666.95394179, 64.3879178338, 60.9291130469 }}, /* 4928 K */
+    {{ 37.9044183789, 42.9177080044, 20.786149123, 666.957685205, 64.3895204997, 60.9307330514 }}, /* 4929 K */
+    {{ 37.9048011357, 42.9188389212, 20.7861491239, 666.96142457, 64.3911240777, 60.9323529289 }}, /* 4930 K */
+    {{ 37.9051839577, 42.9199695013, 20.7861491249, 666.965159889, 64.3927285686, 60.9339726796 }}, /* 4931 K */
+    {{ 37.9055668451, 42.9210997449, 20.7861491258, 666.968891161, 64.3943339729, 60.9355923035 }}, /* 4932 K */
+    {{ 37.9059497982, 42.9222296519, 20.7861491268, 666.972618389, 64.3959402915, 60.9372118007 }}, /* 4933 K */
+    {{ 37.9063328172, 42.9233592226, 20.7861491277, 666.976341574, 64.3975475249, 60.9388311713 }}, /* 4934 K */
+    {{ 37.9067159024, 42.924488457, 20.7861491287, 666.980060718, 64.3991556738, 60.9404504154 }}, /* 4935 K */
+    {{ 37.907099054, 42.9256173551, 20.7861491296, 666.983775823, 64.400764739, 60.942069533 }}, /* 4936 K */
+    {{ 37.9074822721, 42.9267459172, 20.7861491306, 666.987486889, 64.402374721, 60.9436885243 }}, /* 4937 K */
+    {{ 37.9078655571, 42.9278741432, 20.7861491316, 666.991193919, 64.4039856205, 60.9453073893 }}, /* 4938 K */
+    {{ 37.9082489093, 42.9290020333, 20.7861491326, 666.994896913, 64.4055974383, 60.9469261281 }}, /* 4939 K */
+    {{ 37.9086323287, 42.9301295875, 20.7861491336, 666.998595875, 64.407210175, 60.9485447408 }}, /* 4940 K */
+    {{ 37.9090158156, 42.931256806, 20.7861491346, 667.002290804, 64.4088238312, 60.9501632276 }}, /* 4941 K */
+    {{ 37.9093993704, 42.9323836888, 20.7861491356, 667.005981703, 64.4104384076, 60.9517815883 }}, /* 4942 K */
+    {{ 37.9097829932, 42.933510236, 20.7861491367, 667.009668572, 64.412053905, 60.9533998232 }}, /* 4943 K */
+    {{ 37.9101666842, 42.9346364478, 20.7861491377, 667.013351414, 64.4136703239, 60.9550179323 }}, /* 4944 K */
+    {{ 37.9105504438, 42.9357623241, 20.7861491387, 667.01703023, 64.415287665, 60.9566359158 }}, /* 4945 K */
+    {{ 37.9109342721, 42.9368878652, 20.7861491398, 667.020705021, 64.4169059291, 60.9582537735 }}, /* 4946 K */
+    {{ 37.9113181693, 42.9380130711, 20.7861491409, 667.024375789, 64.4185251167, 60.9598715058 }}, /* 4947 K */
+    {{ 37.9117021358, 42.9391379418, 20.7861491419, 667.028042536, 64.4201452286, 60.9614891125 }}, /* 4948 K */
+    {{ 37.9120861717, 42.9402624775, 20.786149143, 667.031705261, 64.4217662655, 60.9631065938 }}, /* 4949 K */
+    {{ 37.9124702772, 42.9413866782, 20.7861491441, 667.035363968, 64.4233882279, 60.9647239498 }}, /* 4950 K */
+    {{ 37.9128544527, 42.9425105442, 20.7861491452, 667.039018658, 64.4250111166, 60.9663411805 }}, /* 4951 K */
+    {{ 37.9132386983, 42.9436340753, 20.7861491463, 667.042669331, 64.4266349323, 60.967958286 }}, /* 4952 K */
+    {{ 37.9136230143, 42.9447572718, 20.7861491474, 667.046315989, 64.4282596756, 60.9695752664 }}, /* 4953 K */
+    {{ 37.914007401, 42.9458801337, 20.7861491485, 667.049958634, 64.4298853471, 60.9711921217 }}, /* 4954 K */
+    {{ 37.9143918584, 42.9470026611, 20.7861491496, 667.053597267, 64.4315119476, 60.972808852 }}, /* 4955 K */
+    {{ 37.914776387, 42.9481248541, 20.7861491508, 667.057231889, 64.4331394778, 60.9744254574 }}, /* 4956 K */
+    {{ 37.9151609869, 42.9492467128, 20.7861491519, 667.060862501, 64.4347679382, 60.9760419378 }}, /* 4957 K */
+    {{ 37.9155456584, 42.9503682373, 20.7861491531, 667.064489106, 64.4363973297, 60.9776582935 }}, /* 4958 K */
+    {{ 37.9159304017, 42.9514894276, 20.7861491542, 667.068111704, 64.4380276527, 60.9792745245 }}, /* 4959 K */
+    {{ 37.916315217, 42.9526102839, 20.7861491554, 667.071730297, 64.4396589081, 60.9808906307 }}, /* 4960 K */
+    {{ 37.9167001046, 42.9537308063, 20.7861491566, 667.075344885, 64.4412910965, 60.9825066123 }}, /* 4961 K */
+    {{ 37.9170850648, 42.9548509948, 20.7861491578, 667.078955471, 64.4429242186, 60.9841224694 }}, /* 4962 K */
+    {{ 37.9174700976, 42.9559708495, 20.786149159, 667.082562055, 64.4445582749, 60.9857382019 }}, /* 4963 K */
+    {{ 37.9178552035, 42.9570903705, 20.7861491602, 667.086164639, 64.4461932663, 60.98735381 }}, /* 4964 K */
+    {{ 37.9182403826, 42.9582095579, 20.7861491614, 667.089763224, 64.4478291934, 60.9889692937 }}, /* 4965 K */
+    {{ 37.9186256352, 42.9593284118, 20.7861491626, 667.093357811, 64.4494660568, 60.9905846531 }}, /* 4966 K */
+    {{ 37.9190109614, 42.9604469323, 20.7861491638, 667.096948402, 64.4511038572, 60.9921998881 }}, /* 4967 K */
+    {{ 37.9193963616, 42.9615651195, 20.7861491651, 667.100534998, 64.4527425953, 60.9938149989 }}, /* 4968 K */
+    {{ 37.919781836, 42.9626829734, 20.7861491663, 667.104117599, 64.4543822718, 60.9954299855 }}, /* 4969 K */
+    {{ 37.9201673848, 42.9638004942, 20.7861491676, 667.107696208, 64.4560228873, 60.997044848 }}, /* 4970 K */
+    {{ 37.9205530083, 42.9649176819, 20.7861491688, 667.111270825, 64.4576644426, 60.9986595864 }}, /* 4971 K */
+    {{ 37.9209387067, 42.9660345366, 20.7861491701, 667.114841451, 64.4593069382, 61.0002742008 }}, /* 4972 K */
+    {{ 37.9213244802, 42.9671510584, 20.7861491714, 667.118408089, 64.4609503748, 61.0018886912 }}, /* 4973 K */
+    {{ 37.921710329, 42.9682672475, 20.7861491727, 667.121970738, 64.4625947532, 61.0035030576 }}, /* 4974 K */
+    {{ 37.9220962535, 42.9693831038, 20.786149174, 667.125529401, 64.464240074, 61.0051173001 }}, /* 4975 K */
+    {{ 37.9224822538, 42.9704986275, 20.7861491753, 667.129084077, 64.4658863379, 61.0067314187 }}, /* 4976 K */
+    {{ 37.9228683302, 42.9716138187, 20.7861491766, 667.13263477, 64.4675335455, 61.0083454136 }}, /* 4977 K */
+    {{ 37.923254483, 42.9727286774, 20.786149178, 667.136181478, 64.4691816975, 61.0099592846 }}, /* 4978 K */
+    {{ 37.9236407123, 42.9738432038, 20.7861491793, 667.139724205, 64.4708307946, 61.011573032 }}, /* 4979 K */
+    {{ 37.9240270184, 42.9749573979, 20.7861491806, 667.14326295, 64.4724808374, 61.0131866556 }}, /* 4980 K */
+    {{ 37.9244134016, 42.9760712598, 20.786149182, 667.146797715, 64.4741318267, 61.0148001556 }}, /* 4981 K */
+    {{ 37.924799862, 42.9771847896, 20.7861491834, 667.150328501, 64.4757837631, 61.0164135319 }}, /* 4982 K */
+    {{ 37.9251864, 42.9782979874, 20.7861491847, 667.153855309, 64.4774366472, 61.0180267847 }}, /* 4983 K */
+    {{ 37.9255730157, 42.9794108533, 20.7861491861, 667.157378141, 64.4790904798, 61.019639914 }}, /* 4984 K */
+    {{ 37.9259597094, 42.9805233873, 20.7861491875, 667.160896996, 64.4807452615, 61.0212529197 }}, /* 4985 K */
+    {{ 37.9263464814, 42.9816355896, 20.7861491889, 667.164411877, 64.4824009931, 61.0228658019 }}, /* 4986 K */
+    {{ 37.9267333319, 42.9827474602, 20.7861491903, 667.167922785, 64.484057675, 61.0244785607 }}, /* 4987 K */
+    {{ 37.9271202611, 42.9838589993, 20.7861491917, 667.171429719, 64.4857153081, 61.0260911961 }}, /* 4988 K */
+    {{ 37.9275072692, 42.9849702069, 20.7861491931, 667.174932682, 64.487373893, 61.0277037081 }}, /* 4989 K */
+    {{ 37.9278943566, 42.9860810831, 20.7861491946, 667.178431675, 64.4890334304, 61.0293160968 }}, /* 4990 K */
+    {{ 37.9282815233, 42.987191628, 20.786149196, 667.181926698, 64.490693921, 61.0309283621 }}, /* 4991 K */
+    {{ 37.9286687698, 42.9883018416, 20.7861491975, 667.185417752, 64.4923553653, 61.0325405041 }}, /* 4992 K */
+    {{ 37.9290560962, 42.9894117241, 20.7861491989, 667.188904839, 64.4940177642, 61.0341525229 }}, /* 4993 K */
+    {{ 37.9294435028, 42.9905212756, 20.7861492004, 667.192387959, 64.4956811182, 61.0357644184 }}, /* 4994 K */
+    {{ 37.9298309898, 42.9916304961, 20.7861492019, 667.195867114, 64.4973454281, 61.0373761906 }}, /* 4995 K */
+    {{ 37.9302185574, 42.9927393857, 20.7861492034, 667.199342304, 64.4990106945, 61.0389878397 }}, /* 4996 K */
+    {{ 37.9306062059, 42.9938479445, 20.7861492049, 667.20281353, 64.500676918, 61.0405993656 }}, /* 4997 K */
+    {{ 37.9309939355, 42.9949561727, 20.7861492064, 667.206280794, 64.5023440995, 61.0422107683 }}, /* 4998 K */
+    {{ 37.9313817465, 42.9960640702, 20.7861492079, 667.209744095, 64.5040122394, 61.0438220479 }}, /* 4999 K */
+    {{ 37.9317696391, 42.9971716372, 20.7861492095, 667.213203436, 64.5056813386, 61.0454332044 }}, /* 5000 K */
+    {{ 37.9321576136, 42.9982788737, 20.786149211, 667.216658817, 64.5073513976, 61.0470442378 }}, /* 5001 K */
+    {{ 37.9325456701, 42.9993857799, 20.7861492125, 667.220110238, 64.5090224172, 61.048655148 }}, /* 5002 K */
+    {{ 37.932933809, 43.0004923558, 20.7861492141, 667.223557702, 64.510694398, 61.0502659352 }}, /* 5003 K */
+    {{ 37.9333220305, 43.0015986015, 20.7861492157, 667.227001208, 64.5123673407, 61.0518765994 }}, /* 5004 K */
+    {{ 37.9337103348, 43.0027045171, 20.7861492172, 667.230440758, 64.5140412459, 61.0534871405 }}, /* 5005 K */
+    {{ 37.9340987222, 43.0038101027, 20.7861492188, 667.233876352, 64.5157161144, 61.0550975586 }}, /* 5006 K */
+    {{ 37.9344871928, 43.0049153583, 20.7861492204, 667.237307991, 64.5173919469, 61.0567078536 }}, /* 5007 K */
+    {{ 37.934875747, 43.0060202842, 20.786149222, 667.240735677, 64.5190687439, 61.0583180257 }}, /* 5008 K */
+    {{ 37.935264385, 43.0071248802, 20.7861492236, 667.244159409, 64.5207465061, 61.0599280747 }}, /* 5009 K */
+    {{ 37.935653107, 43.0082291466, 20.7861492253, 667.247579189, 64.5224252343, 61.0615380007 }}, /* 5010 K */
+    {{ 37.9360419133, 43.0093330834, 20.7861492269, 667.250995018, 64.5241049291, 61.0631478038 }}, /* 5011 K */
+    {{ 37.9364308041, 43.0104366907, 20.7861492285, 667.254406896, 64.5257855911, 61.0647574839 }}, /* 5012 K */
+    {{ 37.9368197797, 43.0115399686, 20.7861492302, 667.257814825, 64.5274672211, 61.066367041 }}, /* 5013 K */
+    {{ 37.9372088402, 43.0126429171, 20.7861492318, 667.261218804, 64.5291498197, 61.0679764751 }}, /* 5014 K */
+    {{ 37.937597986, 43.0137455364, 20.7861492335, 667.264618835, 64.5308333876, 61.0695857863 }}, /* 5015 K */
+    {{ 37.9379872173, 43.0148478266, 20.7861492352, 667.268014919, 64.5325179255, 61.0711949745 }}, /* 5016 K */
+    {{ 37.9383765343, 43.0159497876, 20.7861492369, 667.271407056, 64.534203434, 61.0728040398 }}, /* 5017 K */
+    {{ 37.9387659373, 43.0170514197, 20.7861492386, 667.274795247, 64.5358899139, 61.074412982 }}, /* 5018 K */
+    {{ 37.9391554265, 43.0181527228, 20.7861492403, 667.278179492, 64.5375773657, 61.0760218013 }}, /* 5019 K */
+    {{ 37.9395450022, 43.0192536971, 20.786149242, 667.281559794, 64.5392657902, 61.0776304977 }}, /* 5020 K */
+    {{ 37.9399346646, 43.0203543427, 20.7861492437, 667.284936151, 64.5409551879, 61.079239071 }}, /* 5021 K */
+    {{ 37.9403244139, 43.0214546597, 20.7861492455, 667.288308565, 64.5426455597, 61.0808475214 }}, /* 5022 K */
+    {{ 37.9407142504, 43.022554648, 20.7861492472, 667.291677037, 64.5443369062, 61.0824558488 }}, /* 5023 K */
+    {{ 37.9411041743, 43.0236543079, 20.786149249, 667.295041567, 64.546029228, 61.0840640533 }}, /* 5024 K */
+    {{ 37.9414941859, 43.0247536394, 20.7861492508, 667.298402156, 64.5477225259, 61.0856721347 }}, /* 5025 K */
+    {{ 37.9418842855, 43.0258526425, 20.7861492525, 667.301758805, 64.5494168004, 61.0872800931 }}, /* 5026 K */
+    {{ 37.9422744732, 43.0269513175, 20.7861492543, 667.305111514, 64.5511120523, 61.0888879285 }}, /* 5027 K */
+    {{ 37.9426647493, 43.0280496642, 20.7861492561, 667.308460284, 64.5528082823, 61.0904956409 }}, /* 5028 K */
+    {{ 37.943055114, 43.029147683, 20.7861492579, 667.311805116, 64.5545054909, 61.0921032302 }}, /* 5029 K */
+    {{ 37.9434455677, 43.0302453737, 20.7861492598, 667.31514601, 64.556203679, 61.0937106965 }}, /* 5030 K */
+    {{ 37.9438361105, 43.0313427365, 20.7861492616, 667.318482967, 64.5579028471, 61.0953180397 }}, /* 5031 K */
+    {{ 37.9442267427, 43.0324397715, 20.7861492634, 667.321815987, 64.5596029959, 61.0969252599 }}, /* 5032 K */
+    {{ 37.9446174645, 43.0335364788, 20.7861492653, 667.325145071, 64.5613041262, 61.0985323569 }}, /* 5033 K */
+    {{ 37.9450082763, 43.0346328584, 20.7861492671, 667.32847022, 64.5630062385, 61.1001393309 }}, /* 5034 K */
+    {{ 37.9453991781, 43.0357289105, 20.786149269, 667.331791434, 64.5647093336, 61.1017461817 }}, /* 5035 K */
+    {{ 37.9457901703, 43.0368246351, 20.7861492709, 667.335108714, 64.5664134121, 61.1033529093 }}, /* 5036 K */
+    {{ 37.9461812531, 43.0379200323, 20.7861492728, 667.33842206, 64.5681184747, 61.1049595138 }}, /* 5037 K */
+    {{ 37.9465724268, 43.0390151022, 20.7861492747, 667.341731474, 64.5698245221, 61.1065659951 }}, /* 5038 K */
+    {{ 37.9469636916, 43.0401098448, 20.7861492766, 667.345036954, 64.5715315549, 61.1081723532 }}, /* 5039 K */
+    {{ 37.9473550477, 43.0412042603, 20.7861492785, 667.348338503, 64.5732395738, 61.1097785881 }}, /* 5040 K */
+    {{ 37.9477464954, 43.0422983487, 20.7861492804, 667.35163612, 64.5749485796, 61.1113846997 }}, /* 5041 K */
+    {{ 37.948138035, 43.0433921102, 20.7861492824, 667.354929807, 64.5766585728, 61.112990688 }}, /* 5042 K */
+    {{ 37.9485296666, 43.0444855447, 20.7861492843, 667.358219563, 64.5783695541, 61.1145965529 }}, /* 5043 K */
+    {{ 37.9489213906, 43.0455786525, 20.7861492863, 667.361505388, 64.5800815243, 61.1162022946 }}, /* 5044 K */
+    {{ 37.9493132072, 43.0466714335, 20.7861492883, 667.364787285, 64.5817944839, 61.1178079129 }}, /* 5045 K */
+    {{ 37.9497051166, 43.0477638878, 20.7861492902, 667.368065252, 64.5835084337, 61.1194134078 }}, /* 5046 K */
+    {{ 37.950097119, 43.0488560156, 20.7861492922, 667.371339291, 64.5852233743, 61.1210187792 }}, /* 5047 K */
+    {{ 37.9504892148, 43.0499478169, 20.7861492942, 667.374609402, 64.5869393065, 61.1226240272 }}, /* 5048 K */
+    {{ 37.9508814042, 43.0510392917, 20.7861492962, 667.377875585, 64.5886562308, 61.1242291517 }}, /* 5049 K */
+    {{ 37.9512736873, 43.0521304403, 20.7861492983, 667.381137841, 64.590374148, 61.1258341527 }}, /* 5050 K */
+    {{ 37.9516660646, 43.0532212626, 20.7861493003, 667.38439617, 64.5920930587, 61.1274390301 }}, /* 5051 K */
+    {{ 37.9520585361, 43.0543117588, 20.7861493023, 667.387650573, 64.5938129636, 61.1290437839 }}, /* 5052 K */
+    {{ 37.9524511022, 43.0554019288, 20.7861493044, 667.39090105, 64.5955338633, 61.1306484141 }}, /* 5053 K */
+    {{ 37.9528437631, 43.0564917729, 20.7861493065, 667.394147601, 64.5972557587, 61.1322529206 }}, /* 5054 K */
+    {{ 37.953236519, 43.0575812911, 20.7861493085, 667.397390228, 64.5989786502, 61.1338573034 }}, /* 5055 K */
+    {{ 37.9536293702, 43.0586704834, 20.7861493106, 667.400628929, 64.6007025386, 61.1354615625 }}, /* 5056 K */
+    {{ 37.954022317, 43.05975935, 20.7861493127, 667.403863706, 64.6024274246, 61.1370656977 }}, /* 5057 K */
+    {{ 37.9544153595, 43.0608478909, 20.7861493148, 667.407094559, 64.6041533089, 61.1386697091 }}, /* 5058 K */
+    {{ 37.9548084981, 43.0619361063, 20.7861493169, 667.410321489, 64.6058801921, 61.1402735967 }}, /* 5059 K */
+    {{ 37.955201733, 43.0630239961, 20.7861493191, 667.413544495, 64.6076080748, 61.1418773603 }}, /* 5060 K */
+    {{ 37.9555950644, 43.0641115605, 20.7861493212, 667.416763577, 64.6093369579, 61.1434809999 }}, /* 5061 K */
+    {{ 37.9559884926, 43.0651987995, 20.7861493234, 667.419978738, 64.6110668418, 61.1450845156 }}, /* 5062 K */
+    {{ 37.9563820178, 43.0662857133, 20.7861493255, 667.423189976, 64.6127977274, 61.1466879072 }}, /* 5063 K */
+    {{ 37.9567756403, 43.0673723019, 20.7861493277, 667.426397292, 64.6145296153, 61.1482911746 }}, /* 5064 K */
+    {{ 37.9571693604, 43.0684585655, 20.7861493299, 667.429600686, 64.6162625061, 61.1498943179 }}, /* 5065 K */
+    {{ 37.9575631782, 43.0695445039, 20.7861493321, 667.432800158, 64.6179964005, 61.151497337 }}, /* 5066 K */
+    {{ 37.957957094, 43.0706301175, 20.7861493343, 667.435995709, 64.6197312993, 61.1531002319 }}, /* 5067 K */
+    {{ 37.9583511081, 43.0717154062, 20.7861493365, 667.43918734, 64.6214672031, 61.1547030024 }}, /* 5068 K */
+    {{ 37.9587452207, 43.0728003701, 20.7861493387, 667.442375049, 64.6232041125, 61.1563056485 }}, /* 5069 K */
+    {{ 37.9591394321, 43.0738850093, 20.7861493409, 667.445558839, 64.6249420282, 61.1579081703 }}, /* 5070 K */
+    {{ 37.9595337425, 43.0749693239, 20.7861493432, 667.448738707, 64.6266809509, 61.1595105675 }}, /* 5071 K */
+    {{ 37.9599281522, 43.076053314, 20.7861493454, 667.451914656, 64.6284208814, 61.1611128403 }}, /* 5072 K */
+    {{ 37.9603226614, 43.0771369796, 20.7861493477, 667.455086686, 64.6301618201, 61.1627149884 }}, /* 5073 K */
+    {{ 37.9607172704, 43.0782203208, 20.78614935, 667.458254795, 64.6319037679, 61.1643170119 }}, /* 5074 K */
+    {{ 37.9611119793, 43.0793033377, 20.7861493523, 667.461418985, 64.6336467254, 61.1659189106 }}, /* 5075 K */
+    {{ 37.9615067886, 43.0803860304, 20.7861493546, 667.464579256, 64.6353906933, 61.1675206846 }}, /* 5076 K */
+    {{ 37.9619016984, 43.081468399, 20.7861493569, 667.467735608, 64.6371356723, 61.1691223338 }}, /* 5077 K */
+    {{ 37.9622967089, 43.0825504435, 20.7861493592, 667.470888041, 64.6388816629, 61.170723858 }}, /* 5078 K */
+    {{ 37.9626918204, 43.0836321641, 20.7861493615, 667.474036556, 64.640628666, 61.1723252573 }}, /* 5079 K */
+    {{ 37.9630870332, 43.0847135607, 20.7861493639, 667.477181152, 64.6423766821, 61.1739265316 }}, /* 5080 K */
+    {{ 37.9634823476, 43.0857946335, 20.7861493662, 667.480321829, 64.644125712, 61.1755276808 }}, /* 5081 K */
+    {{ 37.9638777636, 43.0868753826, 20.7861493686, 667.483458588, 64.6458757563, 61.1771287048 }}, /* 5082 K */
+    {{ 37.9642732818, 43.087955808, 20.786149371, 667.486591429, 64.6476268156, 61.1787296036 }}, /* 5083 K */
+    {{ 37.9646689021, 43.0890359099, 20.7861493734, 667.489720352, 64.6493788908, 61.1803303771 }}, /* 5084 K */
+    {{ 37.965064625, 43.0901156882, 20.7861493758, 667.492845357, 64.6511319824, 61.1819310252 }}, /* 5085 K */
+    {{ 37.9654604507, 43.0911951432, 20.7861493782, 667.495966445, 64.6528860911, 61.1835315479 }}, /* 5086 K */
+    {{ 37.9658563794, 43.0922742747, 20.7861493806, 667.499083614, 64.6546412177, 61.1851319451 }}, /* 5087 K */
+    {{ 37.9662524113, 43.0933530831, 20.786149383, 667.502196866, 64.6563973626, 61.1867322166 }}, /* 5088 K */
+    {{ 37.9666485468, 43.0944315682, 20.7861493855, 667.5053062, 64.6581545268, 61.1883323626 }}, /* 5089 K */
+    {{ 37.967044786, 43.0955097302, 20.7861493879, 667.508411616, 64.6599127107, 61.1899323828 }}, /* 5090 K */
+    {{ 37.9674411293, 43.0965875692, 20.7861493904, 667.511513115, 64.6616719152, 61.1915322771 }}, /* 5091 K */
+    {{ 37.9678375769, 43.0976650853, 20.7861493929, 667.514610697, 64.6634321408, 61.1931320456 }}, /* 5092 K */
+    {{ 37.9682341289, 43.0987422784, 20.7861493954, 667.517704361, 64.6651933882, 61.1947316881 }}, /* 5093 K */
+    {{ 37.9686307858, 43.0998191488, 20.7861493979, 667.520794107, 64.6669556582, 61.1963312046 }}, /* 5094 K */
+    {{ 37.9690275477, 43.1008956965, 20.7861494004, 667.523879936, 64.6687189514, 61.197930595 }}, /* 5095 K */
+    {{ 37.9694244148, 43.1019719215, 20.7861494029, 667.526961848, 64.6704832684, 61.1995298591 }}, /* 5096 K */
+    {{ 37.9698213875, 43.103047824, 20.7861494055, 667.530039842, 64.67224861, 61.2011289969 }}, /* 5097 K */
+    {{ 37.970218466, 43.104123404, 20.786149408, 667.533113919, 64.6740149768, 61.2027280084 }}, /* 5098 K */
+    {{ 37.9706156506, 43.1051986616, 20.7861494106, 667.536184078, 64.6757823695, 61.2043268934 }}, /* 5099 K */
+    {{ 37.9710129414, 43.1062735969, 20.7861494131, 667.539250319, 64.6775507887, 61.2059256518 }}, /* 5100 K */
+    {{ 37.9714103387, 43.1073482099, 20.7861494157, 667.542312643, 64.6793202352, 61.2075242836 }}, /* 5101 K */
+    {{ 37.9718078429, 43.1084225008, 20.7861494183, 667.54537105, 64.6810907096, 61.2091227887 }}, /* 5102 K */
+    {{ 37.9722054541, 43.1094964696, 20.7861494209, 667.548425538, 64.6828622126, 61.210721167 }}, /* 5103 K */
+    {{ 37.9726031726, 43.1105701163, 20.7861494235, 667.551476109, 64.6846347448, 61.2123194184 }}, /* 5104 K */
+    {{ 37.9730009987, 43.1116434411, 20.7861494262, 667.554522761, 64.686408307, 61.2139175427 }}, /* 5105 K */
+    {{ 37.9733989326, 43.1127164441, 20.7861494288, 667.557565496, 64.6881828999, 61.21551554 }}, /* 5106 K */
+    {{ 37.9737969745, 43.1137891253, 20.7861494314, 667.560604312, 64.689958524, 61.2171134101 }}, /* 5107 K */
+    {{ 37.9741951247, 43.1148614848, 20.7861494341, 667.563639211, 64.6917351801, 61.218711153 }}, /* 5108 K */
+    {{ 37.9745933836, 43.1159335226, 20.7861494368, 667.56667019, 64.6935128688, 61.2203087684 }}, /* 5109 K */
+    {{ 37.9749917512, 43.1170052389, 20.7861494395, 667.569697252, 64.6952915908, 61.2219062564 }}, /* 5110 K */
+    {{ 37.9753902279, 43.1180766338, 20.7861494422, 667.572720394, 64.6970713468, 61.2235036168 }}, /* 5111 K */
+    {{ 37.975788814, 43.1191477072, 20.7861494449, 667.575739618, 64.6988521375, 61.2251008496 }}, /* 5112 K */
+    {{ 37.9761875096, 43.1202184593, 20.7861494476, 667.578754923, 64.7006339636, 61.2266979546 }}, /* 5113 K */
+    {{ 37.9765863151, 43.1212888902, 20.7861494503, 667.581766309, 64.7024168256, 61.2282949317 }}, /* 5114 K */
+    {{ 37.9769852306, 43.1223589999, 20.7861494531, 667.584773775, 64.7042007244, 61.2298917809 }}, /* 5115 K */
+    {{ 37.9773842565, 43.1234287886, 20.7861494558, 667.587777322, 64.7059856605, 61.231488502 }}, /* 5116 K */
+    {{ 37.977783393, 43.1244982562, 20.7861494586, 667.590776949, 64.7077716347, 61.233085095 }}, /* 5117 K */
+    {{ 37.9781826404, 43.1255674029, 20.7861494614, 667.593772656, 64.7095586476, 61.2346815596 }}, /* 5118 K */
+    {{ 37.9785819988, 43.1266362287, 20.7861494642, 667.596764442, 64.7113466998, 61.2362778959 }}, /* 5119 K */
+    {{ 37.9789814687, 43.1277047337, 20.786149467, 667.599752309, 64.7131357922, 61.2378741037 }}, /* 5120 K */
+    {{ 37.9793810501, 43.128772918, 20.7861494698, 667.602736255, 64.7149259253, 61.2394701829 }}, /* 5121 K */
+    {{ 37.9797807434, 43.1298407817, 20.7861494726, 667.605716279, 64.7167170998, 61.2410661334 }}, /* 5122 K */
+    {{ 37.9801805489, 43.1309083249, 20.7861494755, 667.608692383, 64.7185093164, 61.2426619551 }}, /* 5123 K */
+    {{ 37.9805804667, 43.1319755475, 20.7861494783, 667.611664565, 64.7203025758, 61.2442576478 }}, /* 5124 K */
+    {{ 37.9809804972, 43.1330424498, 20.7861494812, 667.614632825, 64.7220968787, 61.2458532115 }}, /* 5125 K */
+    {{ 37.9813806406, 43.1341090317, 20.7861494841, 667.617597164, 64.7238922256, 61.2474486461 }}, /* 5126 K */
+    {{ 37.9817808971, 43.1351752934, 20.786149487, 667.62055758, 64.7256886174, 61.2490439514 }}, /* 5127 K */
+    {{ 37.982181267, 43.1362412349, 20.7861494899, 667.623514073, 64.7274860546, 61.2506391273 }}, /* 5128 K */
+    {{ 37.9825817506, 43.1373068563, 20.7861494928, 667.626466644, 64.729284538, 61.2522341737 }}, /* 5129 K */
+    {{ 37.9829823481, 43.1383721576, 20.7861494957, 667.629415291, 64.7310840683, 61.2538290905 }}, /* 5130 K */
+    {{ 37.9833830597, 43.1394371391, 20.7861494986, 667.632360014, 64.732884646, 61.2554238776 }}, /* 5131 K */
+    {{ 37.9837838858, 43.1405018006, 20.7861495016, 667.635300814, 64.7346862719, 61.2570185348 }}, /* 5132 K */
+    {{ 37.9841848266, 43.1415661423, 20.7861495045, 667.638237689, 64.7364889467, 61.258613062 }}, /* 5133 K */
+    {{ 37.9845858824, 43.1426301643, 20.7861495075, 667.64117064, 64.738292671, 61.2602074592 }}, /* 5134 K */
+    {{ 37.9849870533, 43.1436938667, 20.7861495105, 667.644099665, 64.7400974455, 61.2618017261 }}, /* 5135 K */
+    {{ 37.9853883397, 43.1447572495, 20.7861495135, 667.647024765, 64.7419032709, 61.2633958627 }}, /* 5136 K */
+    {{ 37.9857897418, 43.1458203128, 20.7861495165, 667.649945939, 64.7437101478, 61.2649898688 }}, /* 5137 K */
+    {{ 37.9861912598, 43.1468830566, 20.7861495195, 667.652863187, 64.745518077, 61.2665837443 }}, /* 5138 K */
+    {{ 37.9865928941, 43.1479454811, 20.7861495226, 667.655776509, 64.7473270591, 61.2681774892 }}, /* 5139 K */
+    {{ 37.9869946449, 43.1490075863, 20.7861495256, 667.658685903, 64.7491370948, 61.2697711031 }}, /* 5140 K */
+    {{ 37.9873965124, 43.1500693723, 20.7861495287, 667.661591369, 64.7509481848, 61.2713645861 }}, /* 5141 K */
+    {{ 37.9877984969, 43.1511308392, 20.7861495318, 667.664492908, 64.7527603297, 61.272957938 }}, /* 5142 K */
+    {{ 37.9882005987, 43.152191987, 20.7861495348, 667.667390518, 64.7545735302, 61.2745511587 }}, /* 5143 K */
+    {{ 37.988602818, 43.1532528159, 20.7861495379, 667.6702842, 64.756387787, 61.276144248 }}, /* 5144 K */
+    {{ 37.989005155, 43.1543133258, 20.786149541, 667.673173952, 64.7582031008, 61.2777372058 }}, /* 5145 K */
+    {{ 37.9894076101, 43.1553735169, 20.7861495442, 667.676059774, 64.7600194722, 61.2793300319 }}, /* 5146 K */
+    {{ 37.9898101834, 43.1564333893, 20.7861495473, 667.678941666, 64.7618369019, 61.2809227263 }}, /* 5147 K */
+    {{ 37.9902128753, 43.1574929429, 20.7861495505, 667.681819627, 64.7636553907, 61.2825152888 }}, /* 5148 K */
+    {{ 37.990615686, 43.158552178, 20.7861495536, 667.684693657, 64.7654749391, 61.2841077192 }}, /* 5149 K */
+    {{ 37.9910186158, 43.1596110945, 20.7861495568, 667.687563755, 64.7672955479, 61.2857000175 }}, /* 5150 K */
+    {{ 37.9914216649, 43.1606696925, 20.78614956, 667.69042992, 64.7691172177, 61.2872921835 }}, /* 5151 K */
+    {{ 37.9918248335, 43.1617279721, 20.7861495632, 667.693292153, 64.7709399492, 61.288884217 }}, /* 5152 K */
+    {{ 37.992228122, 43.1627859334, 20.7861495664, 667.696150452, 64.7727637431, 61.2904761178 }}, /* 5153 K */
+    {{ 37.9926315306, 43.1638435765, 20.7861495696, 667.699004817, 64.7745886, 61.292067886 }}, /* 5154 K */
+    {{ 37.9930350596, 43.1649009014, 20.7861495728, 667.701855248, 64.7764145207, 61.2936595213 }}, /* 5155 K */
+    {{ 37.9934387091, 43.1659579082, 20.7861495761, 667.704701743, 64.7782415058, 61.2952510235 }}, /* 5156 K */
+    {{ 37.9938424795, 43.167014597, 20.7861495794, 667.707544303, 64.780069556, 61.2968423926 }}, /* 5157 K */
+    {{ 37.9942463711, 43.1680709678, 20.7861495826, 667.710382926, 64.7818986719, 61.2984336283 }}, /* 5158 K */
+    {{ 37.994650384, 43.1691270207, 20.7861495859, 667.713217613, 64.7837288543, 61.3000247306 }}, /* 5159 K */
+    {{ 37.9950545186, 43.1701827558, 20.7861495892, 667.716048362, 64.7855601039, 61.3016156992 }}, /* 5160 K */
+    {{ 37.9954587751, 43.1712381732, 20.7861495925, 667.718875172, 64.7873924212, 61.3032065341 }}, /* 5161 K */
+    {{ 37.9958631538, 43.1722932729, 20.7861495959, 667.721698044, 64.7892258069, 61.3047972351 }}, /* 5162 K */
+    {{ 37.9962676549, 43.1733480551, 20.7861495992, 667.724516977, 64.7910602619, 61.306387802 }}, /* 5163 K */
+    {{ 37.9966722787, 43.1744025197, 20.7861496025, 667.727331969, 64.7928957866, 61.3079782346 }}, /* 5164 K */
+    {{ 37.9970770254, 43.1754566668, 20.7861496059, 667.730143021, 64.7947323819, 61.3095685329 }}, /* 5165 K */
+    {{ 37.9974818954, 43.1765104966, 20.7861496093, 667.732950131, 64.7965700484, 61.3111586967 }}, /* 5166 K */
+    {{ 37.9978868888, 43.1775640091, 20.7861496127, 667.735753299, 64.7984087867, 61.3127487258 }}, /* 5167 K */
+    {{ 37.9982920059, 43.1786172043, 20.7861496161, 667.738552525, 64.8002485975, 61.31433862 }}, /* 5168 K */
+    {{ 37.9986972471, 43.1796700824, 20.7861496195, 667.741347807, 64.8020894816, 61.3159283793 }}, /* 5169 K */
+    {{ 37.9991026125, 43.1807226434, 20.7861496229, 667.744139144, 64.8039314395, 61.3175180033 }}, /* 5170 K */
+    {{ 37.9995081024, 43.1817748874, 20.7861496264, 667.746926537, 64.805774472, 61.3191074921 }}, /* 5171 K */
+    {{ 37.999913717, 43.1828268144, 20.7861496298, 667.749709984, 64.8076185798, 61.3206968454 }}, /* 5172 K */
+    {{ 38.0003194567, 43.1838784245, 20.7861496333, 667.752489485, 64.8094637634, 61.322286063 }}, /* 5173 K */
+    {{ 38.0007253217, 43.1849297179, 20.7861496368, 667.755265039, 64.8113100237, 61.3238751449 }}, /* 5174 K */
+    {{ 38.0011313123, 43.1859806945, 20.7861496403, 667.758036645, 64.8131573613, 61.3254640907 }}, /* 5175 K */
+    {{ 38.0015374286, 43.1870313544, 20.7861496438, 667.760804302, 64.8150057768, 61.3270529004 }}, /* 5176 K */
+    {{ 38.0019436711, 43.1880816978, 20.7861496473, 667.76356801, 64.8168552709, 61.3286415739 }}, /* 5177 K */
+    {{ 38.0023500399, 43.1891317247, 20.7861496509, 667.766327767, 64.8187058444, 61.3302301108 }}, /* 5178 K */
+    {{ 38.0027565353, 43.1901814351, 20.7861496544, 667.769083574, 64.8205574978, 61.3318185112 }}, /* 5179 K */
+    {{ 38.0031631575, 43.1912308291, 20.786149658, 667.771835429, 64.8224102319, 61.3334067747 }}, /* 5180 K */
+    {{ 38.0035699069, 43.1922799068, 20.7861496615, 667.774583331, 64.8242640473, 61.3349949012 }}, /* 5181 K */
+    {{ 38.0039767837, 43.1933286683, 20.7861496651, 667.77732728, 64.8261189448, 61.3365828906 }}, /* 5182 K */
+    {{ 38.0043837881, 43.1943771136, 20.7861496687, 667.780067275, 64.827974925, 61.3381707427 }}, /* 5183 K */
+    {{ 38.0047909204, 43.1954252428, 20.7861496724, 667.782803314, 64.8298319885, 61.3397584573 }}, /* 5184 K */
+    {{ 38.005198181, 43.196473056, 20.786149676, 667.785535398, 64.8316901361, 61.3413460342 }}, /* 5185 K */
+    {{ 38.0056055699, 43.1975205532, 20.7861496796, 667.788263525, 64.8335493684, 61.3429334732 }}, /* 5186 K */
+    {{ 38.0060130875, 43.1985677346, 20.7861496833, 667.790987694, 64.8354096861, 61.3445207743 }}, /* 5187 K */
+    {{ 38.0064207342, 43.1996146001, 20.786149687, 667.793707905, 64.8372710899, 61.3461079371 }}, /* 5188 K */
+    {{ 38.00682851, 43.2006611499, 20.7861496906, 667.796424156, 64.8391335805, 61.3476949616 }}, /* 5189 K */
+    {{ 38.0072364153, 43.201707384, 20.7861496943, 667.799136447, 64.8409971585, 61.3492818475 }}, /* 5190 K */
+    {{ 38.0076444504, 43.2027533025, 20.786149698, 667.801844776, 64.8428618247, 61.3508685947 }}, /* 5191 K */
+    {{ 38.0080526155, 43.2037989055, 20.7861497018, 667.804549144, 64.8447275796, 61.352455203 }}, /* 5192 K */
+    {{ 38.0084609109, 43.204844193, 20.7861497055, 667.807249549, 64.846594424, 61.3540416722 }}, /* 5193 K */
+    {{ 38.0088693368, 43.2058891651, 20.7861497093, 667.809945989, 64.8484623586, 61.355628002 }}, /* 5194 K */
+    {{ 38.0092778936, 43.2069338219, 20.786149713, 667.812638465, 64.850331384, 61.3572141924 }}, /* 5195 K */
+    {{ 38.0096865814, 43.2079781634, 20.7861497168, 667.815326975, 64.8522015009, 61.3588002432 }}, /* 5196 K */
+    {{ 38.0100954005, 43.2090221898, 20.7861497206, 667.818011518, 64.85407271, 61.3603861541 }}, /* 5197 K */
+    {{ 38.0105043512, 43.210065901, 20.7861497244, 667.820692093, 64.8559450119, 61.361971925 }}, /* 5198 K */
+    {{ 38.0109134338, 43.2111092972, 20.7861497282, 667.823368699, 64.8578184074, 61.3635575557 }}, /* 5199 K */
+    {{ 38.0113226486, 43.2121523783, 20.7861497321, 667.826041336, 64.8596928972, 61.3651430459 }}, /* 5200 K */
+    {{ 38.0117319957, 43.2131951446, 20.7861497359, 667.828710001, 64.8615684818, 61.3667283956 }}, /* 5201 K */
+    {{ 38.0121414755, 43.2142375961, 20.7861497398, 667.831374695, 64.863445162, 61.3683136044 }}, /* 5202 K */
+    {{ 38.0125510882, 43.2152797327, 20.7861497437, 667.834035417, 64.8653229385, 61.3698986723 }}, /* 5203 K */
+    {{ 38.0129608341, 43.2163215547, 20.7861497475, 667.836692164, 64.8672018119, 61.371483599 }}, /* 5204 K */
+    {{ 38.0133707134, 43.217363062, 20.7861497514, 667.839344937, 64.8690817829, 61.3730683843 }}, /* 5205 K */
+    {{ 38.0137807265, 43.2184042547, 20.7861497554, 667.841993733, 64.8709628522, 61.3746530281 }}, /* 5206 K */
+    {{ 38.0141908735, 43.219445133, 20.7861497593, 667.844638553, 64.8728450205, 61.3762375301 }}, /* 5207 K */
+    {{ 38.0146011548, 43.2204856968, 20.7861497632, 667.847279394, 64.8747282885, 61.3778218901 }}, /* 5208 K */
+    {{ 38.0150115706, 43.2215259462, 20.7861497672, 667.849916257, 64.8766126567, 61.3794061079 }}, /* 5209 K */
+    {{ 38.0154221212, 43.2225658814, 20.7861497712, 667.852549139, 64.878498126, 61.3809901834 }}, /* 5210 K */
+    {{ 38.0158328068, 43.2236055023, 20.7861497752, 667.85517804, 64.880384697, 61.3825741164 }}, /* 5211 K */
+    {{ 38.0162436277, 43.224644809, 20.7861497792, 667.857802959, 64.8822723703, 61.3841579065 }}, /* 5212 K */
+    {{ 38.0166545842, 43.2256838017, 20.7861497832, 667.860423894, 64.8841611467, 61.3857415537 }}, /* 5213 K */
+    {{ 38.0170656766, 43.2267224803, 20.7861497872, 667.863040844, 64.8860510268, 61.3873250577 }}, /* 5214 K */
+    {{ 38.017476905, 43.227760845, 20.7861497913, 667.865653809, 64.8879420113, 61.3889084183 }}, /* 5215 K */
+    {{ 38.0178882699, 43.2287988958, 20.7861497953, 667.868262787, 64.8898341009, 61.3904916353 }}, /* 5216 K */
+    {{ 38.0182997714, 43.2298366327, 20.7861497994, 667.870867777, 64.8917272963, 61.3920747085 }}, /* 5217 K */
+    {{ 38.0187114097, 43.2308740559, 20.7861498035, 667.873468778, 64.8936215981, 61.3936576377 }}, /* 5218 K */
+    {{ 38.0191231853, 43.2319111654, 20.7861498076, 667.876065788, 64.895517007, 61.3952404227 }}, /* 5219 K */
+    {{ 38.0195350983, 43.2329479613, 20.7861498117, 667.878658807, 64.8974135237, 61.3968230633 }}, /* 5220 K */
+    {{ 38.019947149, 43.2339844437, 20.7861498158, 667.881247833, 64.8993111489, 61.3984055593 }}, /* 5221 K */
+    {{ 38.0203593377, 43.2350206125, 20.78614982, 667.883832865, 64.9012098832, 61.3999879103 }}, /* 5222 K */
+    {{ 38.0207716646, 43.2360564679, 20.7861498241, 667.886413902, 64.9031097274, 61.4015701164 }}, /* 5223 K */
+    {{ 38.0211841301, 43.23709201, 20.7861498283, 667.888990943, 64.9050106821, 61.4031521771 }}, /* 5224 K */
+    {{ 38.0215967343, 43.2381272388, 20.7861498325, 667.891563986, 64.906912748, 61.4047340923 }}, /* 5225 K */
+    {{ 38.0220094776, 43.2391621544, 20.7861498367, 667.89413303, 64.9088159258, 61.4063158619 }}, /* 5226 K */
+    {{ 38.0224223601, 43.2401967568, 20.7861498409, 667.896698075, 64.9107202161, 61.4078974855 }}, /* 5227 K */
+    {{ 38.0228353823, 43.2412310461, 20.7861498451, 667.899259118, 64.9126256196, 61.4094789629 }}, /* 5228 K */
+    {{ 38.0232485443, 43.2422650224, 20.7861498494, 667.901816158, 64.9145321371, 61.411060294 }}, /* 5229 K */
+    {{ 38.0236618464, 43.2432986857, 20.7861498536, 667.904369195, 64.9164397691, 61.4126414785 }}, /* 5230 K */
+    {{ 38.0240752889, 43.2443320361, 20.7861498579, 667.906918226, 64.9183485165, 61.4142225161 }}, /* 5231 K */
+    {{ 38.0244888721, 43.2453650737, 20.7861498622, 667.909463252, 64.9202583797, 61.4158034068 }}, /* 5232 K */
+    {{ 38.0249025962, 43.2463977986, 20.7861498665, 667.912004269, 64.9221693596, 61.4173841501 }}, /* 5233 K */
+    {{ 38.0253164615, 43.2474302108, 20.7861498708, 667.914541278, 64.9240814569, 61.418964746 }}, /* 5234 K */
+    {{ 38.0257304682, 43.2484623103, 20.7861498752, 667.917074276, 64.9259946721, 61.4205451942 }}, /* 5235 K */
+    {{ 38.0261446167, 43.2494940973, 20.7861498795, 667.919603262, 64.9279090059, 61.4221254944 }}, /* 5236 K */
+    {{ 38.0265589071, 43.2505255718, 20.7861498839, 667.922128236, 64.9298244592, 61.4237056465 }}, /* 5237 K */
+    {{ 38.0269733399, 43.2515567338, 20.7861498883, 667.924649195, 64.9317410324, 61.4252856501 }}, /* 5238 K */
+    {{ 38.0273879151, 43.2525875835, 20.7861498926, 667.927166139, 64.9336587264, 61.4268655052 }}, /* 5239 K */
+    {{ 38.0278026332, 43.2536181209, 20.7861498971, 667.929679065, 64.9355775417, 61.4284452114 }}, /* 5240 K */
+    {{ 38.0282174943, 43.254648346, 20.7861499015, 667.932187974, 64.9374974791, 61.4300247684 }}, /* 5241 K */
+    {{ 38.0286324988, 43.255678259, 20.7861499059, 667.934692862, 64.9394185393, 61.4316041762 }}, /* 5242 K */
+    {{ 38.0290476469, 43.2567078598, 20.7861499104, 667.937193729, 64.9413407229, 61.4331834344 }}, /* 5243 K */
+    {{ 38.0294629389, 43.2577371487, 20.7861499148, 667.939690574, 64.9432640306, 61.4347625428 }}, /* 5244 K */
+    {{ 38.0298783751, 43.2587661255, 20.7861499193, 667.942183394, 64.9451884631, 61.4363415012 }}, /* 5245 K */
+    {{ 38.0302939556, 43.2597947904, 20.7861499238, 667.94467219, 64.9471140211, 61.4379203093 }}, /* 5246 K */
+    {{ 38.0307096809, 43.2608231435, 20.7861499283, 667.947156958, 64.9490407052, 61.4394989669 }}, /* 5247 K */
+    {{ 38.0311255511, 43.2618511848, 20.7861499328, 667.949637698, 64.9509685161, 61.4410774737 }}, /* 5248 K */
+    {{ 38.0315415666, 43.2628789144, 20.7861499374, 667.952114409, 64.9528974546, 61.4426558296 }}, /* 5249 K */
+    {{ 38.0319577276, 43.2639063323, 20.7861499419, 667.954587088, 64.9548275212, 61.4442340342 }}, /* 5250 K */
+    {{ 38.0323740343, 43.2649334387, 20.7861499465, 667.957055734, 64.9567587168, 61.4458120874 }}, /* 5251 K */
+    {{ 38.0327904871, 43.2659602335, 20.7861499511, 667.959520347, 64.9586910418, 61.4473899888 }}, /* 5252 K */
+    {{ 38.0332070862, 43.2669867168, 20.7861499557, 667.961980924, 64.9606244971, 61.4489677383 }}, /* 5253 K */
+    {{ 38.0336238319, 43.2680128888, 20.7861499603, 667.964437463, 64.9625590833, 61.4505453355 }}, /* 5254 K */
+    {{ 38.0340407245, 43.2690387494, 20.7861499649, 667.966889964, 64.9644948011, 61.4521227804 }}, /* 5255 K */
+    {{ 38.0344577642, 43.2700642987, 20.7861499696, 667.969338425, 64.9664316512, 61.4537000725 }}, /* 5256 K */
+    {{ 38.0348749513, 43.2710895369, 20.7861499743, 667.971782845, 64.9683696342, 61.4552772116 }}, /* 5257 K */
+    {{ 38.0352922861, 43.2721144639, 20.7861499789, 667.974223221, 64.9703087509, 61.4568541976 }}, /* 5258 K */
+    {{ 38.0357097688, 43.2731390798, 20.7861499836, 667.976659553, 64.9722490019, 61.4584310301 }}, /* 5259 K */
+    {{ 38.0361273998, 43.2741633847, 20.7861499883, 667.979091838, 64.9741903879, 61.4600077089 }}, /* 5260 K */
+    {{ 38.0365451792, 43.2751873786, 20.7861499931, 667.981520075, 64.9761329095, 61.4615842337 }}, /* 5261 K */
+    {{ 38.0369631074, 43.2762110617, 20.7861499978, 667.983944263, 64.9780765675, 61.4631606043 }}, /* 5262 K */
+    {{ 38.0373811847, 43.2772344339, 20.7861500026, 667.9863644, 64.9800213626, 61.4647368205 }}, /* 5263 K */
+    {{ 38.0377994112, 43.2782574953, 20.7861500073, 667.988780485, 64.9819672954, 61.4663128819 }}, /* 5264 K */
+    {{ 38.0382177873, 43.2792802461, 20.7861500121, 667.991192515, 64.9839143665, 61.4678887883 }}, /* 5265 K */
+    {{ 38.0386363133, 43.2803026862, 20.7861500169, 667.99360049, 64.9858625768, 61.4694645395 }}, /* 5266 K */
+    {{ 38.0390549895, 43.2813248157, 20.7861500217, 667.996004407, 64.9878119268, 61.4710401353 }}, /* 5267 K */
+    {{ 38.039473816, 43.2823466347, 20.7861500266, 667.998404265, 64.9897624173, 61.4726155752 }}, /* 5268 K */
+    {{ 38.0398927932, 43.2833681433, 20.7861500314, 668.000800063, 64.9917140489, 61.4741908591 }}, /* 5269 K */
+    {{ 38.0403119213, 43.2843893415, 20.7861500363, 668.003191798, 64.9936668223, 61.4757659868 }}, /* 5270 K */
+    {{ 38.0407312006, 43.2854102293, 20.7861500411, 668.005579469, 64.9956207381, 61.4773409579 }}, /* 5271 K */
+    {{ 38.0411506315, 43.2864308069, 20.786150046, 668.007963075, 64.9975757972, 61.4789157722 }}, /* 5272 K */
+    {{ 38.0415702141, 43.2874510743, 20.7861500509, 668.010342614, 64.9995320001, 61.4804904294 }}, /* 5273 K */
+    {{ 38.0419899488, 43.2884710315, 20.7861500559, 668.012718083, 65.0014893475, 61.4820649292 }}, /* 5274 K */
+    {{ 38.0424098357, 43.2894906787, 20.7861500608, 668.015089482, 65.0034478402, 61.4836392715 }}, /* 5275 K */
+    {{ 38.0428298753, 43.2905100158, 20.7861500658, 668.017456809, 65.0054074787, 61.4852134559 }}, /* 5276 K */
+    {{ 38.0432500677, 43.291529043, 20.7861500707, 668.019820062, 65.0073682638, 61.4867874821 }}, /* 5277 K */
+    {{ 38.0436704133, 43.2925477603, 20.7861500757, 668.022179239, 65.0093301962, 61.4883613499 }}, /* 5278 K */
+    {{ 38.0440909123, 43.2935661677, 20.7861500807, 668.024534338, 65.0112932765, 61.489935059 }}, /* 5279 K */
+    {{ 38.0445115649, 43.2945842654, 20.7861500858, 668.026885358, 65.0132575054, 61.4915086092 }}, /* 5280 K */
+    {{ 38.0449323715, 43.2956020533, 20.7861500908, 668.029232298, 65.0152228837, 61.4930820001 }}, /* 5281 K */
+    {{ 38.0453533324, 43.2966195316, 20.7861500958, 668.031575154, 65.0171894119, 61.4946552315 }}, /* 5282 K */
+    {{ 38.0457744477, 43.2976367004, 20.7861501009, 668.033913926, 65.0191570908, 61.4962283031 }}, /* 5283 K */
+    {{ 38.0461957179, 43.2986535596, 20.786150106, 668.036248612, 65.021125921, 61.4978012146 }}, /* 5284 K */
+    {{ 38.0466171431, 43.2996701093, 20.7861501111, 668.03857921, 65.0230959033, 61.4993739658 }}, /* 5285 K */
+    {{ 38.0470387237, 43.3006863496, 20.7861501162, 668.040905718, 65.0250670382, 61.5009465564 }}, /* 5286 K */
+    {{ 38.0474604598, 43.3017022806, 20.7861501213, 668.043228134, 65.0270393266, 61.502518986 }}, /* 5287 K */
+    {{ 38.0478823519, 43.3027179023, 20.7861501265, 668.045546457, 65.0290127691, 61.5040912545 }}, /* 5288 K */
+    {{ 38.0483044001, 43.3037332147, 20.7861501316, 668.047860685, 65.0309873663, 61.5056633615 }}, /* 5289 K */
+    {{ 38.0487266047, 43.304748218, 20.7861501368, 668.050170816, 65.0329631189, 61.5072353068 }}, /* 5290 K */
+    {{ 38.0491489661, 43.3057629122, 20.786150142, 668.052476848, 65.0349400277, 61.5088070901 }}, /* 5291 K */
+    {{ 38.0495714844, 43.3067772973, 20.7861501472, 668.054778779, 65.0369180932, 61.510378711 }}, /* 5292 K */
+    {{ 38.04999416, 43.3077913735, 20.7861501525, 668.057076607, 65.0388973163, 61.5119501693 }}, /* 5293 K */
+    {{ 38.0504169932, 43.3088051407, 20.7861501577, 668.059370331, 65.0408776975, 61.5135214647 }}, /* 5294 K */
+    {{ 38.0508399842, 43.3098185991, 20.786150163, 668.061659948, 65.0428592376, 61.5150925969 }}, /* 5295 K */
+    {{ 38.0512631333, 43.3108317487, 20.7861501682, 668.063945458, 65.0448419372, 61.5166635657 }}, /* 5296 K */
+    {{ 38.0516864407, 43.3118445895, 20.7861501735, 668.066226857, 65.046825797, 61.5182343707 }}, /* 5297 K */
+    {{ 38.0521099068, 43.3128571216, 20.7861501788, 668.068504144, 65.0488108177, 61.5198050117 }}, /* 5298 K */
+    {{ 38.0525335318, 43.3138693452, 20.7861501842, 668.070777317, 65.050797, 61.5213754883 }}, /* 5299 K */
+    {{ 38.0529573161, 43.3148812601, 20.7861501895, 668.073046375, 65.0527843446, 61.5229458003 }}, /* 5300 K */
+    {{ 38.0533812598, 43.3158928665, 20.7861501949, 668.075311314, 65.0547728521, 61.5245159473 }}, /* 5301 K */
+    {{ 38.0538053633, 43.3169041645, 20.7861502002, 668.077572134, 65.0567625233, 61.5260859292 }}, /* 5302 K */
+    {{ 38.0542296268, 43.3179151541, 20.7861502056, 668.079828832, 65.0587533587, 61.5276557455 }}, /* 5303 K */
+    {{ 38.0546540506, 43.3189258354, 20.786150211, 668.082081407, 65.0607453592, 61.5292253959 }}, /* 5304 K */
+    {{ 38.055078635, 43.3199362084, 20.7861502165, 668.084329856, 65.0627385253, 61.5307948803 }}, /* 5305 K */
+    {{ 38.0555033803, 43.3209462732, 20.7861502219, 668.086574177, 65.0647328578, 61.5323641982 }}, /* 5306 K */
+    {{ 38.0559282867, 43.3219560298, 20.7861502273, 668.088814369, 65.0667283573, 61.5339333495 }}, /* 5307 K */
+    {{ 38.0563533546, 43.3229654783, 20.7861502328, 668.091050429, 65.0687250245, 61.5355023337 }}, /* 5308 K */
+    {{ 38.0567785841, 43.3239746188, 20.7861502383, 668.093282356, 65.0707228602, 61.5370711505 }}, /* 5309 K */
+    {{ 38.0572039757, 43.3249834513, 20.7861502438, 668.095510147, 65.0727218649, 61.5386397998 }}, /* 5310 K */
+    {{ 38.0576295295, 43.3259919759, 20.7861502493, 668.0977338, 65.0747220395, 61.5402082811 }}, /* 5311 K */
+    {{ 38.0580552458, 43.3270001927, 20.7861502549, 668.099953314, 65.0767233844, 61.5417765942 }}, /* 5312 K */
+    {{ 38.058481125, 43.3280081016, 20.7861502604, 668.102168686, 65.0787259006, 61.5433447387 }}, /* 5313 K */
+    {{ 38.0589071673, 43.3290157028, 20.786150266, 668.104379915, 65.0807295885, 61.5449127144 }}, /* 5314 K */
+    {{ 38.0593333729, 43.3300229963, 20.7861502716, 668.106586998, 65.082734449, 61.5464805209 }}, /* 5315 K */
+    {{ 38.0597597422, 43.3310299821, 20.7861502772, 668.108789933, 65.0847404826, 61.548048158 }}, /* 5316 K */
+    {{ 38.0601862754, 43.3320366604, 20.7861502828, 668.110988717, 65.0867476901, 61.5496156252 }}, /* 5317 K */
+    {{ 38.0606129729, 43.3330430312, 20.7861502885, 668.11318335, 65.0887560722, 61.5511829224 }}, /* 5318 K */
+    {{ 38.0610398348, 43.3340490945, 20.7861502941, 668.115373829, 65.0907656295, 61.5527500492 }}, /* 5319 K */
+    {{ 38.0614668615, 43.3350548504, 20.7861502998, 668.117560152, 65.0927763628, 61.5543170052 }}, /* 5320 K */
+    {{ 38.0618940533, 43.336060299, 20.7861503055, 668.119742316, 65.0947882726, 61.5558837902 }}, /* 5321 K */
+    {{ 38.0623214104, 43.3370654403, 20.7861503112, 668.12192032, 65.0968013598, 61.5574504039 }}, /* 5322 K */
+    {{ 38.0627489331, 43.3380702744, 20.7861503169, 668.124094161, 65.0988156249, 61.5590168459 }}, /* 5323 K */
+    {{ 38.0631766218, 43.3390748013, 20.7861503227, 668.126263838, 65.1008310686, 61.5605831159 }}, /* 5324 K */
+    {{ 38.0636044766, 43.340079021, 20.7861503284, 668.128429347, 65.1028476918, 61.5621492136 }}, /* 5325 K */
+    {{ 38.0640324978, 43.3410829338, 20.7861503342, 668.130590688, 65.1048654949, 61.5637151386 }}, /* 5326 K */
+    {{ 38.0644606858, 43.3420865395, 20.78615034, 668.132747858, 65.1068844788, 61.5652808907 }}, /* 5327 K */
+    {{ 38.0648890408, 43.3430898382, 20.7861503458, 668.134900854, 65.108904644, 61.5668464696 }}, /* 5328 K */
+    {{ 38.0653175631, 43.3440928301, 20.7861503516, 668.137049674, 65.1109259913, 61.5684118748 }}, /* 5329 K */
+    {{ 38.065746253, 43.3450955152, 20.7861503575, 668.139194317, 65.1129485214, 61.5699771062 }}, /* 5330 K */
+    {{ 38.0661751107, 43.3460978935, 20.7861503633, 668.141334779, 65.114972235, 61.5715421633 }}, /* 5331 K */
+    {{ 38.0666041366, 43.347099965, 20.7861503692, 668.14347106, 65.1169971326, 61.5731070458 }}, /* 5332 K */
+    {{ 38.0670333309, 43.3481017299, 20.7861503751, 668.145603156, 65.1190232151, 61.5746717534 }}, /* 5333 K */
+    {{ 38.0674626939, 43.3491031882, 20.786150381, 668.147731066, 65.1210504831, 61.5762362858 }}, /* 5334 K */
+    {{ 38.0678922259, 43.3501043399, 20.7861503869, 668.149854786, 65.1230789372, 61.5778006426 }}, /* 5335 K */
+    {{ 38.0683219272, 43.3511051852, 20.7861503929, 668.151974316, 65.1251085783, 61.5793648236 }}, /* 5336 K */
+    {{ 38.068751798, 43.352105724, 20.7861503988, 668.154089652, 65.1271394068, 61.5809288283 }}, /* 5337 K */
+    {{ 38.0691818387, 43.3531059564, 20.7861504048, 668.156200792, 65.1291714236, 61.5824926565 }}, /* 5338 K */
+    {{ 38.0696120495, 43.3541058825, 20.7861504108, 668.158307735, 65.1312046294, 61.5840563079 }}, /* 5339 K */
+    {{ 38.0700424307, 43.3551055023, 20.7861504168, 668.160410477, 65.1332390247, 61.5856197819 }}, /* 5340 K */
+    {{ 38.0704729825, 43.3561048159, 20.7861504229, 668.162509016, 65.1352746103, 61.5871830785 }}, /* 5341 K */
+    {{ 38.0709037053, 43.3571038233, 20.7861504289, 668.164603351, 65.1373113869, 61.5887461971 }}, /* 5342 K */
+    {{ 38.0713345994, 43.3581025246, 20.786150435, 668.166693479, 65.1393493552, 61.5903091376 }}, /* 5343 K */
+    {{ 38.071765665, 43.3591009199, 20.7861504411, 668.168779397, 65.1413885158, 61.5918718994 }}, /* 5344 K */
+    {{ 38.0721969024, 43.3600990092, 20.7861504472, 668.170861103, 65.1434288694, 61.5934344824 }}, /* 5345 K */
+    {{ 38.0726283119, 43.3610967925, 20.7861504533, 668.172938596, 65.1454704168, 61.5949968861 }}, /* 5346 K */
+    {{ 38.0730598938, 43.36209427, 20.7861504594, 668.175011871, 65.1475131585, 61.5965591102 }}, /* 5347 K */
+    {{ 38.0734916483, 43.3630914416, 20.7861504656, 668.177080928, 65.1495570953, 61.5981211544 }}, /* 5348 K */
+    {{ 38.0739235758, 43.3640883074, 20.7861504718, 668.179145763, 65.1516022279, 61.5996830183 }}, /* 5349 K */
+    {{ 38.0743556765, 43.3650848675, 20.786150478, 668.181206375, 65.1536485569, 61.6012447015 }}, /* 5350 K */
+    {{ 38.0747879508, 43.3660811219, 20.7861504842, 668.183262761, 65.1556960831, 61.6028062039 }}, /* 5351 K */
+    {{ 38.0752203988, 43.3670770708, 20.7861504904, 668.185314918, 65.1577448071, 61.6043675249 }}, /* 5352 K */
+    {{ 38.0756530209, 43.368072714, 20.7861504966, 668.187362845, 65.1597947296, 61.6059286642 }}, /* 5353 K */
+    {{ 38.0760858174, 43.3690680518, 20.7861505029, 668.189406538, 65.1618458513, 61.6074896216 }}, /* 5354 K */
+    {{ 38.0765187886, 43.370063084, 20.7861505092, 668.191445996, 65.1638981729, 61.6090503965 }}, /* 5355 K */
+    {{ 38.0769519346, 43.3710578109, 20.7861505155, 668.193481216, 65.165951695, 61.6106109888 }}, /* 5356 K */
+    {{ 38.0773852559, 43.3720522325, 20.7861505218, 668.195512195, 65.1680064184, 61.612171398 }}, /* 5357 K */
+    {{ 38.0778187527, 43.3730463487, 20.7861505281, 668.19753893, 65.1700623437, 61.6137316238 }}, /* 5358 K */
+    {{ 38.0782524253, 43.3740401597, 20.7861505345, 668.199561421, 65.1721194716, 61.6152916658 }}, /* 5359 K */
+    {{ 38.078686274, 43.3750336656, 20.7861505408, 668.201579663, 65.1741778029, 61.6168515237 }}, /* 5360 K */
+    {{ 38.079120299, 43.3760268663, 20.7861505472, 668.203593656, 65.1762373381, 61.6184111971 }}, /* 5361 K */
+    {{ 38.0795545007, 43.3770197619, 20.7861505536, 668.205603395, 65.178298078, 61.6199706857 }}, /* 5362 K */
+    {{ 38.0799888793, 43.3780123525, 20.7861505601, 668.207608878, 65.1803600232, 61.6215299891 }}, /* 5363 K */
+    {{ 38.0804234351, 43.3790046381, 20.7861505665, 668.209610104, 65.1824231746, 61.6230891069 }}, /* 5364 K */
+    {{ 38.0808581685, 43.3799966188, 20.786150573, 668.21160707, 65.1844875326, 61.6246480388 }}, /* 5365 K */
+    {{ 38.0812930796, 43.3809882946, 20.7861505794, 668.213599772, 65.186553098, 61.6262067844 }}, /* 5366 K */
+    {{ 38.0817281688, 43.3819796656, 20.7861505859, 668.215588209, 65.1886198716, 61.6277653434 }}, /* 5367 K */
+    {{ 38.0821634364, 43.3829707318, 20.7861505924, 668.217572378, 65.190687854, 61.6293237154 }}, /* 5368 K */
+    {{ 38.0825988826, 43.3839614934, 20.786150599, 668.219552276, 65.1927570458, 61.6308819 }}, /* 5369 K */
+    {{ 38.0830345077, 43.3849519502, 20.7861506055, 668.221527901, 65.1948274478, 61.6324398969 }}, /* 5370 K */
+    {{ 38.0834703121, 43.3859421025, 20.7861506121, 668.22349925, 65.1968990606, 61.6339977057 }}, /* 5371 K */
+    {{ 38.0839062959, 43.3869319502, 20.7861506187, 668.225466321, 65.198971885, 61.635555326 }}, /* 5372 K */
+    {{ 38.0843424596, 43.3879214934, 20.7861506253, 668.227429111, 65.2010459216, 61.6371127575 }}, /* 5373 K */
+    {{ 38.0847788034, 43.3889107322, 20.7861506319, 668.229387618, 65.2031211711, 61.6386699997 }}, /* 5374 K */
+    {{ 38.0852153275, 43.3898996665, 20.7861506385, 668.231341838, 65.2051976342, 61.6402270524 }}, /* 5375 K */
+    {{ 38.0856520323, 43.3908882966, 20.7861506452, 668.23329177, 65.2072753115, 61.6417839152 }}, /* 5376 K */
+    {{ 38.086088918, 43.3918766223, 20.7861506519, 668.23523741, 65.2093542038, 61.6433405876 }}, /* 5377 K */
+    {{ 38.0865259849, 43.3928646438, 20.7861506586, 668.237178757, 65.2114343118, 61.6448970693 }}, /* 5378 K */
+    {{ 38.0869632334, 43.3938523611, 20.7861506653, 668.239115806, 65.2135156361, 61.64645336 }}, /* 5379 K */
+    {{ 38.0874006637, 43.3948397742, 20.786150672, 668.241048556, 65.2155981775, 61.6480094592 }}, /* 5380 K */
+    {{ 38.0878382761, 43.3958268833, 20.7861506788, 668.242977005, 65.2176819365, 61.6495653666 }}, /* 5381 K */
+    {{ 38.0882760708, 43.3968136883, 20.7861506856, 668.244901148, 65.219766914, 61.6511210818 }}, /* 5382 K */
+    {{ 38.0887140483, 43.3978001893, 20.7861506923, 668.246820985, 65.2218531105, 61.6526766044 }}, /* 5383 K */
+    {{ 38.0891522087, 43.3987863864, 20.7861506992, 668.248736511, 65.2239405268, 61.6542319341 }}, /* 5384 K */
+    {{ 38.0895905523, 43.3997722796, 20.786150706, 668.250647724, 65.2260291636, 61.6557870704 }}, /* 5385 K */
+    {{ 38.0900290795, 43.400757869, 20.7861507128, 668.252554623, 65.2281190215, 61.6573420131 }}, /* 5386 K */
+    {{ 38.0904677905, 43.4017431546, 20.7861507197, 668.254457203, 65.2302101012, 61.6588967616 }}, /* 5387 K */
+    {{ 38.0909066856, 43.4027281364, 20.7861507266, 668.256355462, 65.2323024035, 61.6604513156 }}, /* 5388 K */
+    {{ 38.0913457652, 43.4037128146, 20.7861507335, 668.258249397, 65.2343959289, 61.6620056747 }}, /* 5389 K */
+    {{ 38.0917850294, 43.4046971892, 20.7861507404, 668.260139006, 65.2364906783, 61.6635598386 }}, /* 5390 K */
+    {{ 38.0922244786, 43.4056812601, 20.7861507473, 668.262024286, 65.2385866522, 61.6651138069 }}, /* 5391 K */
+    {{ 38.0926641131, 43.4066650276, 20.7861507543, 668.263905234, 65.2406838514, 61.6666675791 }}, /* 5392 K */
+    {{ 38.0931039331, 43.4076484915, 20.7861507613, 668.265781847, 65.2427822766, 61.6682211549 }}, /* 5393 K */
+    {{ 38.093543939, 43.408631652, 20.7861507683, 668.267654123, 65.2448819284, 61.6697745339 }}, /* 5394 K */
+    {{ 38.093984131, 43.4096145092, 20.7861507753, 668.269522059, 65.2469828075, 61.6713277156 }}, /* 5395 K */
+    {{ 38.0944245095, 43.410597063, 20.7861507823, 668.271385652, 65.2490849146, 61.6728806998 }}, /* 5396 K */
+    {{ 38.0948650747, 43.4115793135, 20.7861507894, 668.273244899, 65.2511882504, 61.674433486 }}, /* 5397 K */
+    {{ 38.0953058269, 43.4125612608, 20.7861507964, 668.275099797, 65.2532928157, 61.6759860738 }}, /* 5398 K */
+    {{ 38.0957467664, 43.4135429049, 20.7861508035, 668.276950343, 65.255398611, 61.6775384629 }}, /* 5399 K */
+    {{ 38.0961878935, 43.4145242458, 20.7861508106, 668.278796536, 65.257505637, 61.6790906527 }}, /* 5400 K */
+    {{ 38.0966292085, 43.4155052837, 20.7861508178, 668.280638371, 65.2596138945, 61.680642643 }}, /* 5401 K */
+    {{ 38.0970707117, 43.4164860185, 20.7861508249, 668.282475846, 65.2617233842, 61.6821944333 }}, /* 5402 K */
+    {{ 38.0975124033, 43.4174664504, 20.7861508321, 668.284308958, 65.2638341067, 61.6837460233 }}, /* 5403 K */
+    {{ 38.0979542837, 43.4184465793, 20.7861508393, 668.286137704, 65.2659460627, 61.6852974125 }}, /* 5404 K */
+    {{ 38.0983963531, 43.4194264053, 20.7861508465, 668.287962082, 65.2680592529, 61.6868486005 }}, /* 5405 K */
+    {{ 38.0988386119, 43.4204059285, 20.7861508537, 668.289782088, 65.270173678, 61.6883995869 }}, /* 5406 K */
+    {{ 38.0992810603, 43.4213851489, 20.7861508609, 668.29159772, 65.2722893386, 61.6899503714 }}, /* 5407 K */
+    {{ 38.0997236987, 43.4223640665, 20.7861508682, 668.293408974, 65.2744062356, 61.6915009535 }}, /* 5408 K */
+    {{ 38.1001665272, 43.4233426815, 20.7861508755, 668.295215848, 65.2765243695, 61.6930513328 }}, /* 5409 K */
+    {{ 38.1006095463, 43.4243209938, 20.7861508828, 668.297018339, 65.278643741, 61.6946015089 }}, /* 5410 K */
+    {{ 38.1010527562, 43.4252990035, 20.7861508901, 668.298816444, 65.2807643509, 61.6961514814 }}, /* 5411 K */
+    {{ 38.1014961571, 43.4262767106, 20.7861508974, 668.30061016, 65.2828861998, 61.6977012499 }}, /* 5412 K */
+    {{ 38.1019397494, 43.4272541153, 20.7861509048, 668.302399483, 65.2850092883, 61.699250814 }}, /* 5413 K */
+    {{ 38.1023835335, 43.4282312175, 20.7861509122, 668.304184412, 65.2871336173, 61.7008001733 }}, /* 5414 K */
+    {{ 38.1028275095, 43.4292080173, 20.7861509196, 668.305964942, 65.2892591874, 61.7023493273 }}, /* 5415 K */
+    {{ 38.1032716777, 43.4301845147, 20.786150927, 668.307741072, 65.2913859993, 61.7038982756 }}, /* 5416 K */
+    {{ 38.1037160385, 43.4311607098, 20.7861509344, 668.309512798, 65.2935140536, 61.7054470179 }}, /* 5417 K */
+    {{ 38.1041605922, 43.4321366026, 20.7861509419, 668.311280116, 65.295643351, 61.7069955538 }}, /* 5418 K */
+    {{ 38.104605339, 43.4331121933, 20.7861509494, 668.313043025, 65.2977738923, 61.7085438827 }}, /* 5419 K */
+    {{ 38.1050502792, 43.4340874817, 20.7861509569, 668.31480152, 65.2999056781, 61.7100920043 }}, /* 5420 K */
+    {{ 38.1054954132, 43.435062468, 20.7861509644, 668.3165556, 65.3020387092, 61.7116399182 }}, /* 5421 K */
+    {{ 38.1059407412, 43.4360371523, 20.7861509719, 668.318305261, 65.3041729861, 61.7131876239 }}, /* 5422 K */
+    {{ 38.1063862635, 43.4370115345, 20.7861509795, 668.320050499, 65.3063085097, 61.714735121 }}, /* 5423 K */
+    {{ 38.1068319804, 43.4379856148, 20.786150987, 668.321791312, 65.3084452805, 61.7162824092 }}, /* 5424 K */
+    {{ 38.1072778922, 43.4389593931, 20.7861509946, 668.323527698, 65.3105832993, 61.717829488 }}, /* 5425 K */
+    {{ 38.1077239992, 43.4399328695, 20.7861510022, 668.325259651, 65.3127225667, 61.7193763569 }}, /* 5426 K */
+    {{ 38.1081703017, 43.440906044, 20.7861510099, 668.326987171, 65.3148630835, 61.7209230155 }}, /* 5427 K */
+    {{ 38.1086168001, 43.4418789168, 20.7861510175, 668.328710253, 65.3170048503, 61.7224694635 }}, /* 5428 K */
+    {{ 38.1090634944, 43.4428514878, 20.7861510252, 668.330428894, 65.3191478679, 61.7240157004 }}, /* 5429 K */
+    {{ 38.1095103852, 43.4438237571, 20.7861510329, 668.332143091, 65.3212921369, 61.7255617257 }}, /* 5430 K */
+    {{ 38.1099574726, 43.4447957248, 20.7861510406, 668.333852842, 65.3234376579, 61.7271075391 }}, /* 5431 K */
+    {{ 38.110404757, 43.4457673908, 20.7861510483, 668.335558143, 65.3255844318, 61.7286531401 }}, /* 5432 K */
+    {{ 38.1108522387, 43.4467387553, 20.7861510561, 668.337258991, 65.3277324592, 61.7301985282 }}, /* 5433 K */
+    {{ 38.1112999179, 43.4477098183, 20.7861510639, 668.338955383, 65.3298817407, 61.7317437031 }}, /* 5434 K */
+    {{ 38.111747795, 43.4486805798, 20.7861510717, 668.340647315, 65.3320322771, 61.7332886643 }}, /* 5435 K */
+    {{ 38.1121958703, 43.4496510398, 20.7861510795, 668.342334784, 65.334184069, 61.7348334114 }}, /* 5436 K */
+    {{ 38.1126441439, 43.4506211985, 20.7861510873, 668.344017788, 65.3363371172, 61.7363779439 }}, /* 5437 K */
+    {{ 38.1130926163, 43.4515910558, 20.7861510952, 668.345696323, 65.3384914223, 61.7379222615 }}, /* 5438 K */
+    {{ 38.1135412878, 43.4525606118, 20.786151103, 668.347370386, 65.3406469851, 61.7394663636 }}, /* 5439 K */
+    {{ 38.1139901586, 43.4535298666, 20.7861511109, 668.349039974, 65.3428038061, 61.7410102498 }}, /* 5440 K */
+    {{ 38.114439229, 43.4544988202, 20.7861511188, 668.350705083, 65.3449618862, 61.7425539198 }}, /* 5441 K */
+    {{ 38.1148884994, 43.4554674726, 20.7861511268, 668.352365711, 65.3471212259, 61.744097373 }}, /* 5442 K */
+    {{ 38.1153379699, 43.4564358239, 20.7861511347, 668.354021853, 65.349281826, 61.745640609 }}, /* 5443 K */
+    {{ 38.115787641, 43.4574038742, 20.7861511427, 668.355673507, 65.3514436872, 61.7471836274 }}, /* 5444 K */
+    {{ 38.1162375129, 43.4583716234, 20.7861511507, 668.35732067, 65.3536068102, 61.7487264278 }}, /* 5445 K */
+    {{ 38.1166875859, 43.4593390716, 20.7861511587, 668.358963338, 65.3557711956, 61.7502690096 }}, /* 5446 K */
+    {{ 38.1171378604, 43.4603062189, 20.7861511668, 668.360601509, 65.3579368441, 61.7518113725 }}, /* 5447 K */
+    {{ 38.1175883365, 43.4612730653, 20.7861511748, 668.362235178, 65.3601037565, 61.753353516 }}, /* 5448 K */
+    {{ 38.1180390146, 43.4622396109, 20.7861511829, 668.363864342, 65.3622719333, 61.7548954397 }}, /* 5449 K */
+    {{ 38.1184898951, 43.4632058556, 20.786151191, 668.365488999, 65.3644413754, 61.756437143 }}, /* 5450 K */
+    {{ 38.1189409781, 43.4641717996, 20.7861511991, 668.367109144, 65.3666120834, 61.7579786256 }}, /* 5451 K */
+    {{ 38.1193922641, 43.4651374429, 20.7861512072, 668.368724776, 65.368784058, 61.7595198871 }}, /* 5452 K */
+    {{ 38.1198437532, 43.4661027855, 20.7861512154, 668.370335889, 65.3709572999, 61.7610609268 }}, /* 5453 K */
+    {{ 38.1202954459, 43.4670678275, 20.7861512236, 668.371942481, 65.3731318098, 61.7626017445 }}, /* 5454 K */
+    {{ 38.1207473423, 43.4680325689, 20.7861512318, 668.373544549, 65.3753075883, 61.7641423397 }}, /* 5455 K */
+    {{ 38.1211994428, 43.4689970097, 20.78615124, 668.37514209, 65.3774846361, 61.7656827119 }}, /* 5456 K */
+    {{ 38.1216517478, 43.4699611501, 20.7861512482, 668.376735099, 65.379662954, 61.7672228606 }}, /* 5457 K */
+    {{ 38.1221042574, 43.47092499, 20.7861512565, 668.378323574, 65.3818425427, 61.7687627854 }}, /* 5458 K */
+    {{ 38.122556972, 43.4718885294, 20.7861512648, 668.379907511, 65.3840234027, 61.7703024858 }}, /* 5459 K */
+    {{ 38.1230098918, 43.4728517686, 20.7861512731, 668.381486906, 65.3862055349, 61.7718419614 }}, /* 5460 K */
+    {{ 38.1234630173, 43.4738147073, 20.7861512814, 668.383061758, 65.3883889399, 61.7733812117 }}, /* 5461 K */
+    {{ 38.1239163487, 43.4747773459, 20.7861512898, 668.384632061, 65.3905736184, 61.7749202363 }}, /* 5462 K */
+    {{ 38.1243698862, 43.4757396841, 20.7861512981, 668.386197812, 65.3927595711, 61.7764590347 }}, /* 5463 K */
+    {{ 38.1248236302, 43.4767017222, 20.7861513065, 668.387759009, 65.3949467987, 61.7779976065 }}, /* 5464 K */
+    {{ 38.125277581, 43.4776634601, 20.7861513149, 668.389315648, 65.3971353018, 61.7795359511 }}, /* 5465 K */
+    {{ 38.1257317389, 43.4786248979, 20.7861513233, 668.390867725, 65.3993250812, 61.7810740681 }}, /* 5466 K */
+    {{ 38.1261861042, 43.4795860356, 20.7861513318, 668.392415237, 65.4015161375, 61.7826119571 }}, /* 5467 K */
+    {{ 38.1266406772, 43.4805468733, 20.7861513403, 668.39395818, 65.4037084715, 61.7841496175 }}, /* 5468 K */
+    {{ 38.1270954581, 43.4815074111, 20.7861513488, 668.395496551, 65.4059020839, 61.785687049 }}, /* 5469 K */
+    {{ 38.1275504474, 43.4824676488, 20.7861513573, 668.397030347, 65.4080969752, 61.787224251 }}, /* 5470 K */
+    {{ 38.1280056452, 43.4834275867, 20.7861513658, 668.398559564, 65.4102931463, 61.788761223 }}, /* 5471 K */
+    {{ 38.1284610519, 43.4843872247, 20.7861513744, 668.400084198, 65.4124905978, 61.7902979647 }}, /* 5472 K */
+    {{ 38.1289166678, 43.4853465629, 20.7861513829, 668.401604246, 65.4146893304, 61.7918344755 }}, /* 5473 K */
+    {{ 38.1293724932, 43.4863056013, 20.7861513915, 668.403119705, 65.4168893448, 61.793370755 }}, /* 5474 K */
+    {{ 38.1298285284, 43.48726434, 20.7861514002, 668.40463057, 65.4190906416, 61.7949068027 }}, /* 5475 K */
+    {{ 38.1302847736, 43.488222779, 20.7861514088, 668.40613684, 65.4212932217, 61.7964426181 }}, /* 5476 K */
+    {{ 38.1307412293, 43.4891809183, 20.7861514175, 668.407638509, 65.4234970856, 61.7979782007 }}, /* 5477 K */
+    {{ 38.1311978956, 43.490138758, 20.7861514261, 668.409135574, 65.4257022341, 61.7995135501 }}, /* 5478 K */
+    {{ 38.131654773, 43.4910962981, 20.7861514348, 668.410628032, 65.4279086678, 61.8010486658 }}, /* 5479 K */
+    {{ 38.1321118616, 43.4920535387, 20.7861514436, 668.41211588, 65.4301163875, 61.8025835473 }}, /* 5480 K */
+    {{ 38.1325691619, 43.4930104799, 20.7861514523, 668.413599113, 65.4323253939, 61.8041181942 }}, /* 5481 K */
+    {{ 38.133026674, 43.4939671215, 20.7861514611, 668.415077729, 65.4345356875, 61.8056526058 }}, /* 5482 K */
+    {{ 38.1334843984, 43.4949234638, 20.7861514699, 668.416551723, 65.4367472692, 61.8071867819 }}, /* 5483 K */
+    {{ 38.1339423353, 43.4958795067, 20.7861514787, 668.418021091, 65.4389601396, 61.8087207218 }}, /* 5484 K */
+    {{ 38.1344004849, 43.4968352502, 20.7861514875, 668.419485832, 65.4411742994, 61.8102544252 }}, /* 5485 K */
+    {{ 38.1348588477, 43.4977906945, 20.7861514964, 668.420945939, 65.4433897493, 61.8117878914 }}, /* 5486 K */
+    {{ 38.1353174239, 43.4987458395, 20.7861515052, 668.422401411, 65.4456064899, 61.8133211201 }}, /* 5487 K */
+    {{ 38.1357762138, 43.4997006854, 20.7861515141, 668.423852244, 65.4478245221, 61.8148541108 }}, /* 5488 K */
+    {{ 38.1362352178, 43.500655232, 20.7861515231, 668.425298433, 65.4500438465, 61.8163868629 }}, /* 5489 K */
+    {{ 38.136694436, 43.5016094795, 20.786151532, 668.426739975, 65.4522644637, 61.817919376 }}, /* 5490 K */
+    {{ 38.1371538689, 43.502563428, 20.786151541, 668.428176867, 65.4544863744, 61.8194516496 }}, /* 5491 K */
+    {{ 38.1376135168, 43.5035170773, 20.7861515499, 668.429609105, 65.4567095795, 61.8209836831 }}, /* 5492 K */
+    {{ 38.1380733798, 43.5044704277, 20.7861515589, 668.431036684, 65.4589340795, 61.8225154762 }}, /* 5493 K */
+    {{ 38.1385334584, 43.5054234791, 20.786151568, 668.432459603, 65.4611598751, 61.8240470283 }}, /* 5494 K */
+    {{ 38.1389937529, 43.5063762316, 20.786151577, 668.433877856, 65.463386967, 61.8255783389 }}, /* 5495 K */
+    {{ 38.1394542635, 43.5073286852, 20.7861515861, 668.43529144, 65.465615356, 61.8271094075 }}, /* 5496 K */
+    {{ 38.1399149905, 43.5082808399, 20.7861515952, 668.436700351, 65.4678450427, 61.8286402336 }}, /* 5497 K */
+    {{ 38.1403759343, 43.5092326958, 20.7861516043, 668.438104586, 65.4700760278, 61.8301708168 }}, /* 5498 K */
+    {{ 38.1408370952, 43.510184253, 20.7861516134, 668.439504141, 65.472308312, 61.8317011565 }}, /* 5499 K */
+    {{ 38.1412984734, 43.5111355114, 20.7861516226, 668.440899012, 65.474541896, 61.8332312522 }}, /* 5500 K */
+    {{ 38.1417600693, 43.5120864711, 20.7861516318, 668.442289195, 65.4767767805, 61.8347611035 }}, /* 5501 K */
+    {{ 38.1422218832, 43.5130371321, 20.786151641, 668.443674688, 65.4790129662, 61.8362907098 }}, /* 5502 K */
+    {{ 38.1426839153, 43.5139874946, 20.7861516502, 668.445055484, 65.4812504538, 61.8378200707 }}, /* 5503 K */
+    {{ 38.1431461661, 43.5149375584, 20.7861516595, 668.446431582, 65.4834892439, 61.8393491855 }}, /* 5504 K */
+    {{ 38.1436086357, 43.5158873237, 20.7861516687, 668.447802978, 65.4857293373, 61.8408780539 }}, /* 5505 K */
+    {{ 38.1440713246, 43.5168367905, 20.786151678, 668.449169666, 65.4879707347, 61.8424066753 }}, /* 5506 K */
+    {{ 38.1445342329, 43.5177859588, 20.7861516873, 668.450531645, 65.4902134367, 61.8439350493 }}, /* 5507 K */
+    {{ 38.144997361, 43.5187348287, 20.7861516967, 668.451888909, 65.492457444, 61.8454631752 }}, /* 5508 K */
+    {{ 38.1454607093, 43.5196834002, 20.786151706, 668.453241456, 65.4947027574, 61.8469910527 }}, /* 5509 K */
+    {{ 38.145924278, 43.5206316734, 20.7861517154, 668.45458928, 65.4969493776, 61.8485186811 }}, /* 5510 K */
+    {{ 38.1463880674, 43.5215796482, 20.7861517248, 668.455932379, 65.4991973051, 61.85004606 }}, /* 5511 K */
+    {{ 38.1468520778, 43.5225273248, 20.7861517342, 668.457270749, 65.5014465408, 61.8515731889 }}, /* 5512 K */
+    {{ 38.1473163096, 43.5234747031, 20.7861517437, 668.458604385, 65.5036970853, 61.8531000672 }}, /* 5513 K */
+    {{ 38.1477807631, 43.5244217832, 20.7861517531, 668.459933284, 65.5059489393, 61.8546266945 }}, /* 5514 K */
+    {{ 38.1482454384, 43.5253685651, 20.7861517626, 668.461257442, 65.5082021035, 61.8561530703 }}, /* 5515 K */
+    {{ 38.1487103361, 43.5263150489, 20.7861517721, 668.462576855, 65.5104565786, 61.8576791939 }}, /* 5516 K */
+    {{ 38.1491754563, 43.5272612346, 20.7861517817, 668.463891519, 65.5127123653, 61.859205065 }}, /* 5517 K */
+    {{ 38.1496407994, 43.5282071223, 20.7861517912, 668.46520143, 65.5149694642, 61.8607306829 }}, /* 5518 K */
+    {{ 38.1501063657, 43.5291527119, 20.7861518008, 668.466506585, 65.5172278762, 61.8622560472 }}, /* 5519 K */
+    {{ 38.1505721555, 43.5300980035, 20.7861518104, 668.467806979, 65.5194876018, 61.8637811574 }}, /* 5520 K */
+    {{ 38.151038169, 43.5310429972, 20.78615182, 668.469102609, 65.5217486418, 61.8653060129 }}, /* 5521 K */
+    {{ 38.1515044067, 43.531987693, 20.7861518297, 668.47039347, 65.5240109969, 61.8668306132 }}, /* 5522 K */
+    {{ 38.1519708688, 43.5329320909, 20.7861518394, 668.471679559, 65.5262746677, 61.8683549578 }}, /* 5523 K */
+    {{ 38.1524375556, 43.533876191, 20.7861518491, 668.472960871, 65.528539655, 61.8698790461 }}, /* 5524 K */
+    {{ 38.1529044675, 43.5348199933, 20.7861518588, 668.474237403, 65.5308059594, 61.8714028777 }}, /* 5525 K */
+    {{ 38.1533716046, 43.5357634978, 20.7861518685, 668.475509151, 65.5330735817, 61.872926452 }}, /* 5526 K */
+    {{ 38.1538389675, 43.5367067045, 20.7861518783, 668.476776111, 65.5353425225, 61.8744497685 }}, /* 5527 K */
+    {{ 38.1543065563, 43.5376496136, 20.7861518881, 668.478038278, 65.5376127825, 61.8759728266 }}, /* 5528 K */
+    {{ 38.1547743713, 43.538592225, 20.7861518979, 668.479295649, 65.5398843625, 61.8774956259 }}, /* 5529 K */
+    {{ 38.155242413, 43.5395345388, 20.7861519077, 668.480548219, 65.5421572631, 61.8790181658 }}, /* 5530 K */
+    {{ 38.1557106815, 43.540476555, 20.7861519176, 668.481795986, 65.544431485, 61.8805404457 }}, /* 5531 K */
+    {{ 38.1561791772, 43.5414182736, 20.7861519274, 668.483038944, 65.5467070289, 61.8820624652 }}, /* 5532 K */
+    {{ 38.1566479005, 43.5423596948, 20.7861519373, 668.484277089, 65.5489838955, 61.8835842238 }}, /* 5533 K */
+    {{ 38.1571168515, 43.5433008184, 20.7861519473, 668.485510418, 65.5512620855, 61.8851057207 }}, /* 5534 K */
+    {{ 38.1575860307, 43.5442416446, 20.7861519572, 668.486738927, 65.5535415996, 61.8866269557 }}, /* 5535 K */
+    {{ 38.1580554383, 43.5451821734, 20.7861519672, 668.487962611, 65.5558224385, 61.888147928 }}, /* 5536 K */
+    {{ 38.1585250746, 43.5461224048, 20.7861519772, 668.489181467, 65.5581046029, 61.8896686372 }}, /* 5537 K */
+    {{ 38.15899494, 43.5470623388, 20.7861519872, 668.49039549, 65.5603880935, 61.8911890828 }}, /* 5538 K */
+    {{ 38.1594650348, 43.5480019756, 20.7861519972, 668.491604676, 65.562672911, 61.8927092641 }}, /* 5539 K */
+    {{ 38.1599353592, 43.548941315, 20.7861520073, 668.492809021, 65.564959056, 61.8942291807 }}, /* 5540 K */
+    {{ 38.1604059136, 43.5498803573, 20.7861520174, 668.494008521, 65.5672465293, 61.895748832 }}, /* 5541 K */
+    {{ 38.1608766983, 43.5508191023, 20.7861520275, 668.495203172, 65.5695353316, 61.8972682175 }}, /* 5542 K */
+    {{ 38.1613477137, 43.5517575501, 20.7861520376, 668.49639297, 65.5718254635, 61.8987873366 }}, /* 5543 K */
+    {{ 38.1618189599, 43.5526957008, 20.7861520478, 668.49757791, 65.5741169258, 61.9003061888 }}, /* 5544 K */
+    {{ 38.1622904374, 43.5536335544, 20.7861520579, 668.498757989, 65.5764097191, 61.9018247736 }}, /* 5545 K */
+    {{ 38.1627621464, 43.5545711109, 20.7861520681, 668.499933202, 65.5787038442, 61.9033430904 }}, /* 5546 K */
+    {{ 38.1632340873, 43.5555083704, 20.7861520784, 668.501103546, 65.5809993018, 61.9048611386 }}, /* 5547 K */
+    {{ 38.1637062603, 43.5564453329, 20.7861520886, 668.502269015, 65.5832960925, 61.9063789177 }}, /* 5548 K */
+    {{ 38.1641786658, 43.5573819984, 20.7861520989, 668.503429606, 65.585594217, 61.9078964272 }}, /* 5549 K */
+    {{ 38.1646513041, 43.558318367, 20.7861521092, 668.504585315, 65.587893676, 61.9094136664 }}, /* 5550 K */
+    {{ 38.1651241755, 43.5592544386, 20.7861521195, 668.505736137, 65.5901944703, 61.910930635 }}, /* 5551 K */
+    {{ 38.1655972803, 43.5601902134, 20.7861521298, 668.506882069, 65.5924966005, 61.9124473322 }}, /* 5552 K */
+    {{ 38.1660706189, 43.5611256914, 20.7861521402, 668.508023105, 65.5948000674, 61.9139637576 }}, /* 5553 K */
+    {{ 38.1665441915, 43.5620608725, 20.7861521506, 668.509159242, 65.5971048715, 61.9154799106 }}, /* 5554 K */
+    {{ 38.1670179984, 43.5629957569, 20.786152161, 668.510290476, 65.5994110137, 61.9169957906 }}, /* 5555 K */
+    {{ 38.16749204, 43.5639303445, 20.7861521714, 668.511416802, 65.6017184946, 61.9185113971 }}, /* 5556 K */
+    {{ 38.1679663166, 43.5648646354, 20.7861521819, 668.512538216, 65.6040273149, 61.9200267296 }}, /* 5557 K */
+    {{ 38.1684408284, 43.5657986297, 20.7861521924, 668.513654713, 65.6063374753, 61.9215417874 }}, /* 5558 K */
+    {{ 38.1689155759, 43.5667323273, 20.7861522029, 668.514766291, 65.6086489765, 61.9230565701 }}, /* 5559 K */
+    {{ 38.1693905593, 43.5676657282, 20.7861522134, 668.515872943, 65.6109618192, 61.924571077 }}, /* 5560 K */
+    {{ 38.1698657789, 43.5685988327, 20.786152224, 668.516974667, 65.6132760041, 61.9260853076 }}, /* 5561 K */
+    {{ 38.1703412351, 43.5695316405, 20.7861522345, 668.518071457, 65.6155915319, 61.9275992613 }}, /* 5562 K */
+    {{ 38.1708169281, 43.5704641519, 20.7861522451, 668.519163309, 65.6179084033, 61.9291129376 }}, /* 5563 K */
+    {{ 38.1712928583, 43.5713963667, 20.7861522558, 668.520250219, 65.620226619, 61.9306263359 }}, /* 5564 K */
+    {{ 38.171769026, 43.5723282851, 20.7861522664, 668.521332184, 65.6225461796, 61.9321394557 }}, /* 5565 K */
+    {{ 38.1722454315, 43.5732599071, 20.7861522771, 668.522409197, 65.624867086, 61.9336522963 }}, /* 5566 K */
+    {{ 38.1727220751, 43.5741912327, 20.7861522878, 668.523481256, 65.6271893387, 61.9351648573 }}, /* 5567 K */
+    {{ 38.1731989571, 43.5751222619, 20.7861522985, 668.524548355, 65.6295129385, 61.936677138 }}, /* 5568 K */
+    {{ 38.1736760779, 43.5760529948, 20.7861523093, 668.52561049, 65.6318378861, 61.9381891378 }}, /* 5569 K */
+    {{ 38.1741534377, 43.5769834315, 20.78615232, 668.526667658, 65.6341641821, 61.9397008563 }}, /* 5570 K */
+    {{ 38.1746310369, 43.5779135718, 20.7861523308, 668.527719853, 65.6364918274, 61.9412122928 }}, /* 5571 K */
+    {{ 38.1751088759, 43.5788434159, 20.7861523417, 668.528767071, 65.6388208225, 61.9427234467 }}, /* 5572 K */
+    {{ 38.1755869548, 43.5797729638, 20.7861523525, 668.529809308, 65.6411511681, 61.9442343176 }}, /* 5573 K */
+    {{ 38.176065274, 43.5807022156, 20.7861523634, 668.530846559, 65.643482865, 61.9457449047 }}, /* 5574 K */
+    {{ 38.1765438339, 43.5816311711, 20.7861523743, 668.531878821, 65.6458159139, 61.9472552076 }}, /* 5575 K */
+    {{ 38.1770226347, 43.5825598306, 20.7861523852, 668.532906088, 65.6481503154, 61.9487652257 }}, /* 5576 K */
+    {{ 38.1775016768, 43.583488194, 20.7861523961, 668.533928356, 65.6504860703, 61.9502749583 }}, /* 5577 K */
+    {{ 38.1779809605, 43.5844162614, 20.7861524071, 668.53494562, 65.6528231793, 61.951784405 }}, /* 5578 K */
+    {{ 38.1784604861, 43.5853440327, 20.7861524181, 668.535957877, 65.655161643, 61.9532935651 }}, /* 5579 K */
+    {{ 38.1789402539, 43.586271508, 20.7861524291, 668.536965122, 65.6575014621, 61.954802438 }}, /* 5580 K */
+    {{ 38.1794202643, 43.5871986874, 20.7861524401, 668.53796735, 65.6598426374, 61.9563110232 }}, /* 5581 K */
+    {{ 38.1799005175, 43.5881255708, 20.7861524512, 668.538964557, 65.6621851696, 61.9578193201 }}, /* 5582 K */
+    {{ 38.1803810138, 43.5890521584, 20.7861524623, 668.539956738, 65.6645290593, 61.9593273281 }}, /* 5583 K */
+    {{ 38.1808617537, 43.58997845, 20.7861524734, 668.540943889, 65.6668743072, 61.9608350466 }}, /* 5584 K */
+    {{ 38.1813427373, 43.5909044459, 20.7861524845, 668.541926006, 65.6692209141, 61.962342475 }}, /* 5585 K */
+    {{ 38.1818239651, 43.5918301459, 20.7861524957, 668.542903083, 65.6715688806, 61.9638496128 }}, /* 5586 K */
+    {{ 38.1823054373, 43.5927555501, 20.7861525069, 668.543875116, 65.6739182075, 61.9653564593 }}, /* 5587 K */
+    {{ 38.1827871543, 43.5936806585, 20.7861525181, 668.544842102, 65.6762688954, 61.966863014 }}, /* 5588 K */
+    {{ 38.1832691163, 43.5946054713, 20.7861525293, 668.545804035, 65.678620945, 61.9683692763 }}, /* 5589 K */
+    {{ 38.1837513238, 43.5955299883, 20.7861525406, 668.54676091, 65.6809743571, 61.9698752456 }}, /* 5590 K */
+    {{ 38.1842337769, 43.5964542097, 20.7861525518, 668.547712724, 65.6833291323, 61.9713809213 }}, /* 5591 K */
+    {{ 38.1847164761, 43.5973781354, 20.7861525632, 668.548659471, 65.6856852713, 61.9728863028 }}, /* 5592 K */
+    {{ 38.1851994216, 43.5983017655, 20.7861525745, 668.549601147, 65.6880427749, 61.9743913896 }}, /* 5593 K */
+    {{ 38.1856826138, 43.5992251, 20.7861525859, 668.550537748, 65.6904016437, 61.9758961809 }}, /* 5594 K */
+    {{ 38.186166053, 43.600148139, 20.7861525972, 668.551469268, 65.6927618784, 61.9774006763 }}, /* 5595 K */
+    {{ 38.1866497395, 43.6010708825, 20.7861526086, 668.552395704, 65.6951234798, 61.9789048751 }}, /* 5596 K */
+    {{ 38.1871336736, 43.6019933304, 20.7861526201, 668.55331705, 65.6974864485, 61.9804087767 }}, /* 5597 K */
+    {{ 38.1876178556, 43.6029154829, 20.7861526315, 668.554233303, 65.6998507852, 61.9819123806 }}, /* 5598 K */
+    {{ 38.1881022859, 43.6038373399, 20.786152643, 668.555144456, 65.7022164906, 61.9834156861 }}, /* 5599 K */
+    {{ 38.1885869648, 43.6047589015, 20.7861526545, 668.556050507, 65.7045835655, 61.9849186926 }}, /* 5600 K */
+    {{ 38.1890718926, 43.6056801678, 20.7861526661, 668.55695145, 65.7069520105, 61.9864213996 }}, /* 5601 K */
+    {{ 38.1895570696, 43.6066011386, 20.7861526776, 668.55784728, 65.7093218263, 61.9879238064 }}, /* 5602 K */
+    {{ 38.1900424961, 43.6075218142, 20.7861526892, 668.558737993, 65.7116930137, 61.9894259124 }}, /* 5603 K */
+    {{ 38.1905281725, 43.6084421944, 20.7861527008, 668.559623584, 65.7140655733, 61.990927717 }}, /* 5604 K */
+    {{ 38.1910140991, 43.6093622793, 20.7861527124, 668.560504049, 65.7164395058, 61.9924292197 }}, /* 5605 K */
+    {{ 38.1915002762, 43.610282069, 20.7861527241, 668.561379382, 65.7188148119, 61.9939304198 }}, /* 5606 K */
+    {{ 38.1919867041, 43.6112015635, 20.7861527358, 668.56224958, 65.7211914924, 61.9954313167 }}, /* 5607 K */
+    {{ 38.1924733831, 43.6121207628, 20.7861527475, 668.563114637, 65.7235695478, 61.9969319097 }}, /* 5608 K */
+    {{ 38.1929603136, 43.6130396669, 20.7861527592, 668.563974548, 65.725948979, 61.9984321984 }}, /* 5609 K */
+    {{ 38.1934474959, 43.6139582758, 20.786152771, 668.56482931, 65.7283297867, 61.999932182 }}, /* 5610 K */
+    {{ 38.1939349303, 43.6148765896, 20.7861527828, 668.565678916, 65.7307119714, 62.00143186 }}, /* 5611 K */
+    {{ 38.1944226171, 43.6157946084, 20.7861527946, 668.566523363, 65.733095534, 62.0029312318 }}, /* 5612 K */
+    {{ 38.1949105567, 43.6167123321, 20.7861528064, 668.567362646, 65.7354804751, 62.0044302967 }}, /* 5613 K */
+    {{ 38.1953987493, 43.6176297607, 20.7861528183, 668.56819676, 65.7378667954, 62.0059290541 }}, /* 5614 K */
+    {{ 38.1958871953, 43.6185468943, 20.7861528302, 668.5690257, 65.7402544957, 62.0074275034 }}, /* 5615 K */
+    {{ 38.1963758951, 43.6194637329, 20.7861528421, 668.569849461, 65.7426435766, 62.008925644 }}, /* 5616 K */
+    {{ 38.1968648488, 43.6203802766, 20.786152854, 668.570668039, 65.7450340388, 62.0104234753 }}, /* 5617 K */
+    {{ 38.197354057, 43.6212965254, 20.786152866, 668.571481429, 65.747425883, 62.0119209966 }}, /* 5618 K */
+    {{ 38.1978435198, 43.6222124792, 20.786152878, 668.572289626, 65.74981911, 62.0134182074 }}, /* 5619 K */
+    {{ 38.1983332376, 43.6231281381, 20.78615289, 668.573092625, 65.7522137204, 62.014915107 }}, /* 5620 K */
+    {{ 38.1988232107, 43.6240435022, 20.7861529021, 668.573890422, 65.7546097149, 62.0164116948 }}, /* 5621 K */
+    {{ 38.1993134395, 43.6249585714, 20.7861529141, 668.574683011, 65.7570070943, 62.0179079701 }}, /* 5622 K */
+    {{ 38.1998039242, 43.6258733459, 20.7861529262, 668.575470387, 65.7594058592, 62.0194039324 }}, /* 5623 K */
+    {{ 38.2002946652, 43.6267878255, 20.7861529383, 668.576252547, 65.7618060103, 62.020899581 }}, /* 5624 K */
+    {{ 38.2007856629, 43.6277020104, 20.7861529505, 668.577029485, 65.7642075484, 62.0223949153 }}, /* 5625 K */
+    {{ 38.2012769175, 43.6286159006, 20.7861529627, 668.577801196, 65.7666104741, 62.0238899347 }}, /* 5626 K */
+    {{ 38.2017684293, 43.629529496, 20.7861529748, 668.578567675, 65.7690147881, 62.0253846385 }}, /* 5627 K */
+    {{ 38.2022601987, 43.6304427968, 20.7861529871, 668.579328917, 65.7714204912, 62.0268790262 }}, /* 5628 K */
+    {{ 38.2027522261, 43.6313558029, 20.7861529993, 668.580084918, 65.773827584, 62.028373097 }}, /* 5629 K */
+    {{ 38.2032445117, 43.6322685143, 20.7861530116, 668.580835673, 65.7762360672, 62.0298668503 }}, /* 5630 K */
+    {{ 38.2037370558, 43.6331809312, 20.7861530239, 668.581581176, 65.7786459416, 62.0313602856 }}, /* 5631 K */
+    {{ 38.2042298588, 43.6340930534, 20.7861530362, 668.582321423, 65.7810572078, 62.0328534022 }}, /* 5632 K */
+    {{ 38.2047229211, 43.6350048811, 20.7861530486, 668.583056409, 65.7834698666, 62.0343461994 }}, /* 5633 K */
+    {{ 38.2052162428, 43.6359164143, 20.786153061, 668.583786129, 65.7858839186, 62.0358386767 }}, /* 5634 K */
+    {{ 38.2057098244, 43.6368276529, 20.7861530734, 668.584510578, 65.7882993646, 62.0373308333 }}, /* 5635 K */
+    {{ 38.2062036662, 43.6377385971, 20.7861530858, 668.585229751, 65.7907162052, 62.0388226686 }}, /* 5636 K */
+    {{ 38.2066977685, 43.6386492467, 20.7861530983, 668.585943643, 65.7931344412, 62.0403141821 }}, /* 5637 K */
+    {{ 38.2071921316, 43.639559602, 20.7861531107, 668.586652249, 65.7955540732, 62.0418053731 }}, /* 5638 K */
+    {{ 38.2076867559, 43.6404696628, 20.7861531233, 668.587355564, 65.797975102, 62.0432962408 }}, /* 5639 K */
+    {{ 38.2081816417, 43.6413794292, 20.7861531358, 668.588053583, 65.8003975283, 62.0447867848 }}, /* 5640 K */
+    {{ 38.2086767893, 43.6422889012, 20.7861531484, 668.588746301, 65.8028213527, 62.0462770043 }}, /* 5641 K */
+    {{ 38.209172199, 43.6431980789, 20.7861531609, 668.589433714, 65.8052465759, 62.0477668987 }}, /* 5642 K */
+    {{ 38.2096678712, 43.6441069622, 20.7861531736, 668.590115816, 65.8076731988, 62.0492564673 }}, /* 5643 K */
+    {{ 38.2101638061, 43.6450155513, 20.7861531862, 668.590792601, 65.8101012219, 62.0507457096 }}, /* 5644 K */
+    {{ 38.2106600042, 43.645923846, 20.7861531989, 668.591464066, 65.8125306459, 62.0522346249 }}, /* 5645 K */
+    {{ 38.2111564657, 43.6468318465, 20.7861532116, 668.592130205, 65.8149614717, 62.0537232124 }}, /* 5646 K */
+    {{ 38.211653191, 43.6477395528, 20.7861532243, 668.592791012, 65.8173936998, 62.0552114716 }}, /* 5647 K */
+    {{ 38.2121501803, 43.6486469648, 20.786153237, 668.593446484, 65.819827331, 62.0566994019 }}, /* 5648 K */
+    {{ 38.2126474341, 43.6495540826, 20.7861532498, 668.594096614, 65.822262366, 62.0581870025 }}, /* 5649 K */
+    {{ 38.2131449526, 43.6504609063, 20.7861532626, 668.594741398, 65.8246988054, 62.0596742729 }}, /* 5650 K */
+    {{ 38.2136427362, 43.6513674358, 20.7861532754, 668.595380831, 65.8271366501, 62.0611612123 }}, /* 5651 K */
+    {{ 38.2141407852, 43.6522736712, 20.7861532883, 668.596014907, 65.8295759006, 62.0626478201 }}, /* 5652 K */
+    {{ 38.2146390999, 43.6531796124, 20.7861533012, 668.596643622, 65.8320165577, 62.0641340957 }}, /* 5653 K */
+    {{ 38.2151376807, 43.6540852596, 20.7861533141, 668.59726697, 65.8344586221, 62.0656200384 }}, /* 5654 K */
+    {{ 38.2156365279, 43.6549906127, 20.786153327, 668.597884947, 65.8369020946, 62.0671056476 }}, /* 5655 K */
+    {{ 38.2161356418, 43.6558956718, 20.78615334, 668.598497546, 65.8393469757, 62.0685909225 }}, /* 5656 K */
+    {{ 38.2166350227, 43.6568004368, 20.786153353, 668.599104763, 65.8417932662, 62.0700758626 }}, /* 5657 K */
+    {{ 38.2171346709, 43.6577049079, 20.786153366, 668.599706594, 65.8442409668, 62.0715604671 }}, /* 5658 K */
+    {{ 38.2176345869, 43.658609085, 20.7861533791, 668.600303031, 65.8466900783, 62.0730447355 }}, /* 5659 K */
+    {{ 38.2181347709, 43.6595129681, 20.7861533921, 668.600894072, 65.8491406012, 62.074528667 }}, /* 5660 K */
+    {{ 38.2186352233, 43.6604165572, 20.7861534052, 668.60147971, 65.8515925364, 62.0760122611 }}, /* 5661 K */
+    {{ 38.2191359443, 43.6613198525, 20.7861534183, 668.602059939, 65.8540458845, 62.0774955169 }}, /* 5662 K */
+    {{ 38.2196369343, 43.6622228538, 20.7861534315, 668.602634756, 65.8565006462, 62.0789784339 }}, /* 5663 K */
+    {{ 38.2201381937, 43.6631255613, 20.7861534447, 668.603204155, 65.8589568222, 62.0804610114 }}, /* 5664 K */
+    {{ 38.2206397228, 43.6640279749, 20.7861534579, 668.60376813, 65.8614144133, 62.0819432488 }}, /* 5665 K */
+    {{ 38.2211415218, 43.6649300947, 20.7861534711, 668.604326676, 65.8638734201, 62.0834251453 }}, /* 5666 K */
+    {{ 38.2216435912, 43.6658319207, 20.7861534844, 668.604879788, 65.8663338434, 62.0849067003 }}, /* 5667 K */
+    {{ 38.2221459312, 43.6667334529, 20.7861534977, 668.605427462, 65.8687956838, 62.0863879131 }}, /* 5668 K */
+    {{ 38.2226485422, 43.6676346913, 20.786153511, 668.60596969, 65.871258942, 62.0878687831 }}, /* 5669 K */
+    {{ 38.2231514246, 43.6685356359, 20.7861535243, 668.60650647, 65.8737236188, 62.0893493096 }}, /* 5670 K */
+    {{ 38.2236545786, 43.6694362868, 20.7861535377, 668.607037794, 65.8761897149, 62.0908294918 }}, /* 5671 K */
+    {{ 38.2241580045, 43.670336644, 20.7861535511, 668.607563658, 65.8786572309, 62.0923093293 }}, /* 5672 K */
+    {{ 38.2246617028, 43.6712367075, 20.7861535645, 668.608084057, 65.8811261676, 62.0937888212 }}, /* 5673 K */
+    {{ 38.2251656737, 43.6721364773, 20.786153578, 668.608598985, 65.8835965256, 62.0952679668 }}, /* 5674 K */
+    {{ 38.2256699176, 43.6730359534, 20.7861535915, 668.609108436, 65.8860683058, 62.0967467656 }}, /* 5675 K */
+    {{ 38.2261744348, 43.6739351359, 20.786153605, 668.609612407, 65.8885415087, 62.0982252169 }}, /* 5676 K */
+    {{ 38.2266792256, 43.6748340248, 20.7861536185, 668.610110891, 65.891016135, 62.0997033199 }}, /* 5677 K */
+    {{ 38.2271842904, 43.6757326201, 20.7861536321, 668.610603883, 65.8934921856, 62.1011810739 }}, /* 5678 K */
+    {{ 38.2276896295, 43.6766309218, 20.7861536457, 668.611091377, 65.8959696611, 62.1026584784 }}, /* 5679 K */
+    {{ 38.2281952432, 43.6775289299, 20.7861536593, 668.611573369, 65.8984485622, 62.1041355326 }}, /* 5680 K */
+    {{ 38.2287011318, 43.6784266445, 20.7861536729, 668.612049853, 65.9009288895, 62.1056122358 }}, /* 5681 K */
+    {{ 38.2292072958, 43.6793240656, 20.7861536866, 668.612520823, 65.9034106439, 62.1070885874 }}, /* 5682 K */
+    {{ 38.2297137354, 43.6802211931, 20.7861537003, 668.612986275, 65.905893826, 62.1085645866 }}, /* 5683 K */
+    {{ 38.2302204509, 43.6811180272, 20.786153714, 668.613446202, 65.9083784365, 62.1100402328 }}, /* 5684 K */
+    {{ 38.2307274427, 43.6820145678, 20.7861537278, 668.6139006, 65.9108644761, 62.1115155253 }}, /* 5685 K */
+    {{ 38.2312347111, 43.6829108149, 20.7861537416, 668.614349464, 65.9133519456, 62.1129904634 }}, /* 5686 K */
+    {{ 38.2317422565, 43.6838067686, 20.7861537554, 668.614792787, 65.9158408455, 62.1144650464 }}, /* 5687 K */
+    {{ 38.2322500792, 43.6847024289, 20.7861537692, 668.615230564, 65.9183311768, 62.1159392737 }}, /* 5688 K */
+    {{ 38.2327581795, 43.6855977957, 20.7861537831, 668.61566279, 65.9208229399, 62.1174131445 }}, /* 5689 K */
+    {{ 38.2332665577, 43.6864928692, 20.786153797, 668.616089459, 65.9233161358, 62.1188866581 }}, /* 5690 K */
+    {{ 38.2337752143, 43.6873876493, 20.7861538109, 668.616510567, 65.9258107649, 62.1203598139 }}, /* 5691 K */
+    {{ 38.2342841494, 43.6882821361, 20.7861538249, 668.616926107, 65.9283068282, 62.1218326111 }}, /* 5692 K */
+    {{ 38.2347933635, 43.6891763295, 20.7861538389, 668.617336074, 65.9308043262, 62.1233050491 }}, /* 5693 K */
+    {{ 38.2353028569, 43.6900702296, 20.7861538529, 668.617740462, 65.9333032596, 62.1247771272 }}, /* 5694 K */
+    {{ 38.2358126299, 43.6909638364, 20.7861538669, 668.618139267, 65.9358036293, 62.1262488446 }}, /* 5695 K */
+    {{ 38.2363226828, 43.69185715, 20.786153881, 668.618532483, 65.9383054358, 62.1277202008 }}, /* 5696 K */
+    {{ 38.2368330161, 43.6927501702, 20.7861538951, 668.618920104, 65.9408086799, 62.1291911948 }}, /* 5697 K */
+    {{ 38.23734363, 43.6936428973, 20.7861539092, 668.619302124, 65.9433133624, 62.1306618262 }}, /* 5698 K */
+    {{ 38.2378545248, 43.694535331, 20.7861539233, 668.619678539, 65.9458194838, 62.1321320942 }}, /* 5699 K */
+    {{ 38.2383657009, 43.6954274716, 20.7861539375, 668.620049342, 65.9483270449, 62.133601998 }}, /* 5700 K */
+    {{ 38.2388771586, 43.696319319, 20.7861539517, 668.620414528, 65.9508360465, 62.135071537 }}, /* 5701 K */
+    {{ 38.2393888983, 43.6972108731, 20.786153966, 668.620774092, 65.9533464891, 62.1365407104 }}, /* 5702 K */
+    {{ 38.2399009203, 43.6981021342, 20.7861539802, 668.621128028, 65.9558583736, 62.1380095176 }}, /* 5703 K */
+    {{ 38.240413225, 43.698993102, 20.7861539945, 668.621476331, 65.9583717007, 62.1394779579 }}, /* 5704 K */
+    {{ 38.2409258125, 43.6998837767, 20.7861540088, 668.621818994, 65.9608864709, 62.1409460305 }}, /* 5705 K */
+    {{ 38.2414386834, 43.7007741583, 20.7861540232, 668.622156013, 65.9634026851, 62.1424137348 }}, /* 5706 K */
+    {{ 38.241951838, 43.7016642468, 20.7861540376, 668.622487382, 65.965920344, 62.1438810699 }}, /* 5707 K */
+    {{ 38.2424652765, 43.7025540422, 20.786154052, 668.622813095, 65.9684394482, 62.1453480353 }}, /* 5708 K */
+    {{ 38.2429789993, 43.7034435446, 20.7861540664, 668.623133146, 65.9709599985, 62.1468146303 }}, /* 5709 K */
+    {{ 38.2434930068, 43.7043327538, 20.7861540809, 668.623447531, 65.9734819956, 62.148280854 }}, /* 5710 K */
+    {{ 38.2440072992, 43.7052216701, 20.7861540954, 668.623756243, 65.9760054402, 62.1497467058 }}, /* 5711 K */
+    {{ 38.244521877, 43.7061102932, 20.7861541099, 668.624059276, 65.9785303329, 62.151212185 }}, /* 5712 K */
+    {{ 38.2450367404, 43.7069986234, 20.7861541245, 668.624356626, 65.9810566745, 62.1526772908 }}, /* 5713 K */
+    {{ 38.2455518898, 43.7078866606, 20.786154139, 668.624648286, 65.9835844658, 62.1541420226 }}, /* 5714 K */
+    {{ 38.2460673256, 43.7087744048, 20.7861541536, 668.624934252, 65.9861137073, 62.1556063796 }}, /* 5715 K */
+    {{ 38.246583048, 43.709661856, 20.7861541683, 668.625214516, 65.9886443999, 62.1570703611 }}, /* 5716 K */
+    {{ 38.2470990574, 43.7105490143, 20.786154183, 668.625489074, 65.9911765442, 62.1585339664 }}, /* 5717 K */
+    {{ 38.2476153542, 43.7114358796, 20.7861541976, 668.625757919, 65.9937101409, 62.1599971947 }}, /* 5718 K */
+    {{ 38.2481319386, 43.712322452, 20.7861542124, 668.626021047, 65.9962451908, 62.1614600454 }}, /* 5719 K */
+    {{ 38.2486488111, 43.7132087315, 20.7861542271, 668.626278452, 65.9987816945, 62.1629225177 }}, /* 5720 K */
+    {{ 38.2491659719, 43.714094718, 20.7861542419, 668.626530127, 66.0013196528, 62.164384611 }}, /* 5721 K */
+    {{ 38.2496834214, 43.7149804117, 20.7861542567, 668.626776067, 66.0038590663, 62.1658463244 }}, /* 5722 K */
+    {{ 38.25020116, 43.7158658125, 20.7861542716, 668.627016267, 66.0063999358, 62.1673076572 }}, /* 5723 K */
+    {{ 38.2507191879, 43.7167509205, 20.7861542864, 668.62725072, 66.008942262, 62.1687686088 }}, /* 5724 K */
+    {{ 38.2512375055, 43.7176357356, 20.7861543013, 668.627479421, 66.0114860455, 62.1702291784 }}, /* 5725 K */
+    {{ 38.2517561132, 43.7185202579, 20.7861543163, 668.627702364, 66.0140312872, 62.1716893653 }}, /* 5726 K */
+    {{ 38.2522750112, 43.7194044873, 20.7861543312, 668.627919544, 66.0165779877, 62.1731491687 }}, /* 5727 K */
+    {{ 38.2527942, 43.720288424, 20.7861543462, 668.628130954, 66.0191261476, 62.1746085879 }}, /* 5728 K */
+    {{ 38.2533136799, 43.7211720678, 20.7861543612, 668.628336589, 66.0216757678, 62.1760676221 }}, /* 5729 K */
+    {{ 38.2538334511, 43.7220554189, 20.7861543763, 668.628536443, 66.0242268489, 62.1775262708 }}, /* 5730 K */
+    {{ 38.2543535141, 43.7229384772, 20.7861543914, 668.62873051, 66.0267793917, 62.178984533 }}, /* 5731 K */
+    {{ 38.2548738692, 43.7238212428, 20.7861544065, 668.628918785, 66.0293333968, 62.1804424082 }}, /* 5732 K */
+    {{ 38.2553945167, 43.7247037156, 20.7861544216, 668.629101262, 66.031888865, 62.1818998954 }}, /* 5733 K */
+    {{ 38.255915457, 43.7255858956, 20.7861544368, 668.629277934, 66.0344457969, 62.1833569941 }}, /* 5734 K */
+    {{ 38.2564366903, 43.726467783, 20.786154452, 668.629448797, 66.0370041933, 62.1848137035 }}, /* 5735 K */
+    {{ 38.2569582171, 43.7273493776, 20.7861544672, 668.629613844, 66.0395640548, 62.1862700228 }}, /* 5736 K */
+    {{ 38.2574800377, 43.7282306796, 20.7861544824, 668.629773069, 66.0421253823, 62.1877259513 }}, /* 5737 K */
+    {{ 38.2580021525, 43.7291116889, 20.7861544977, 668.629926466, 66.0446881764, 62.1891814882 }}, /* 5738 K */
+    {{ 38.2585245616, 43.7299924055, 20.786154513, 668.63007403, 66.0472524377, 62.1906366328 }}, /* 5739 K */
+    {{ 38.2590472656, 43.7308728294, 20.7861545284, 668.630215755, 66.0498181671, 62.1920913845 }}, /* 5740 K */
+    {{ 38.2595702648, 43.7317529607, 20.7861545437, 668.630351635, 66.0523853652, 62.1935457423 }}, /* 5741 K */
+    {{ 38.2600935594, 43.7326327993, 20.7861545591, 668.630481664, 66.0549540327, 62.1949997057 }}, /* 5742 K */
+    {{ 38.2606171498, 43.7335123454, 20.7861545746, 668.630605836, 66.0575241704, 62.1964532737 }}, /* 5743 K */
+    {{ 38.2611410365, 43.7343915988, 20.78615459, 668.630724146, 66.0600957789, 62.1979064458 }}, /* 5744 K */
+    {{ 38.2616652196, 43.7352705596, 20.7861546055, 668.630836586, 66.062668859, 62.1993592211 }}, /* 5745 K */
+    {{ 38.2621896996, 43.7361492278, 20.786154621, 668.630943153, 66.0652434114, 62.2008115989 }}, /* 5746 K */
+    {{ 38.2627144768, 43.7370276034, 20.7861546366, 668.631043838, 66.0678194367, 62.2022635785 }}, /* 5747 K */
+    {{ 38.2632395515, 43.7379056865, 20.7861546522, 668.631138637, 66.0703969357, 62.203715159 }}, /* 5748 K */
+    {{ 38.2637649242, 43.738783477, 20.7861546678, 668.631227544, 66.0729759092, 62.2051663398 }}, /* 5749 K */
+    {{ 38.264290595, 43.739660975, 20.7861546834, 668.631310552, 66.0755563577, 62.2066171201 }}, /* 5750 K */
+    {{ 38.2648165644, 43.7405381804, 20.7861546991, 668.631387656, 66.0781382821, 62.2080674991 }}, /* 5751 K */
+    {{ 38.2653428327, 43.7414150933, 20.7861547148, 668.63145885, 66.080721683, 62.2095174762 }}, /* 5752 K */
+    {{ 38.2658694003, 43.7422917137, 20.7861547305, 668.631524127, 66.0833065611, 62.2109670504 }}, /* 5753 K */
+    {{ 38.2663962674, 43.7431680415, 20.7861547463, 668.631583482, 66.0858929172, 62.2124162211 }}, /* 5754 K */
+    {{ 38.2669234345, 43.7440440769, 20.7861547621, 668.631636909, 66.0884807519, 62.2138649875 }}, /* 5755 K */
+    {{ 38.2674509019, 43.7449198198, 20.7861547779, 668.631684402, 66.091070066, 62.2153133489 }}, /* 5756 K */
+    {{ 38.2679786699, 43.7457952702, 20.7861547938, 668.631725954, 66.0936608602, 62.2167613045 }}, /* 5757 K */
+    {{ 38.2685067389, 43.7466704281, 20.7861548097, 668.63176156, 66.0962531352, 62.2182088536 }}, /* 5758 K */
+    {{ 38.2690351092, 43.7475452935, 20.7861548256, 668.631791214, 66.0988468917, 62.2196559953 }}, /* 5759 K */
+    {{ 38.2695637812, 43.7484198666, 20.7861548415, 668.631814909, 66.1014421304, 62.2211027289 }}, /* 5760 K */
+    {{ 38.2700927551, 43.7492941471, 20.7861548575, 668.63183264, 66.104038852, 62.2225490536 }}, /* 5761 K */
+    {{ 38.2706220314, 43.7501681353, 20.7861548735, 668.6318444, 66.1066370572, 62.2239949688 }}, /* 5762 K */
+    {{ 38.2711516104, 43.751041831, 20.7861548895, 668.631850184, 66.1092367468, 62.2254404736 }}, /* 5763 K */
+    {{ 38.2716814924, 43.7519152343, 20.7861549056, 668.631849985, 66.1118379215, 62.2268855672 }}, /* 5764 K */
+    {{ 38.2722116778, 43.7527883452, 20.7861549217, 668.631843798, 66.1144405819, 62.2283302489 }}, /* 5765 K */
+    {{ 38.2727421669, 43.7536611637, 20.7861549378, 668.631831615, 66.1170447288, 62.2297745179 }}, /* 5766 K */
+    {{ 38.2732729601, 43.7545336898, 20.786154954, 668.631813432, 66.1196503629, 62.2312183735 }}, /* 5767 K */
+    {{ 38.2738040578, 43.7554059235, 20.7861549702, 668.631789241, 66.1222574848, 62.2326618149 }}, /* 5768 K */
+    {{ 38.2743354601, 43.7562778649, 20.7861549864, 668.631759038, 66.1248660954, 62.2341048412 }}, /* 5769 K */
+    {{ 38.2748671676, 43.7571495138, 20.7861550027, 668.631722815, 66.1274761953, 62.2355474518 }}, /* 5770 K */
+    {{ 38.2753991806, 43.7580208705, 20.7861550189, 668.631680567, 66.1300877853, 62.2369896459 }}, /* 5771 K */
+    {{ 38.2759314993, 43.7588919348, 20.7861550352, 668.631632287, 66.1327008659, 62.2384314226 }}, /* 5772 K */
+    {{ 38.2764641242, 43.7597627067, 20.7861550516, 668.631577969, 66.1353154381, 62.2398727813 }}, /* 5773 K */
+    {{ 38.2769970555, 43.7606331863, 20.786155068, 668.631517608, 66.1379315024, 62.2413137211 }}, /* 5774 K */
+    {{ 38.2775302937, 43.7615033736, 20.7861550844, 668.631451196, 66.1405490596, 62.2427542412 }}, /* 5775 K */
+    {{ 38.2780638391, 43.7623732685, 20.7861551008, 668.631378729, 66.1431681103, 62.2441943409 }}, /* 5776 K */
+    {{ 38.278597692, 43.7632428712, 20.7861551173, 668.631300198, 66.1457886554, 62.2456340195 }}, /* 5777 K */
+    {{ 38.2791318528, 43.7641121815, 20.7861551338, 668.6312156, 66.1484106955, 62.247073276 }}, /* 5778 K */
+    {{ 38.2796663219, 43.7649811996, 20.7861551503, 668.631124926, 66.1510342313, 62.2485121098 }}, /* 5779 K */
+    {{ 38.2802010995, 43.7658499254, 20.7861551669, 668.631028171, 66.1536592636, 62.24995052 }}, /* 5780 K */
+    {{ 38.280736186, 43.7667183588, 20.7861551835, 668.630925329, 66.156285793, 62.2513885059 }}, /* 5781 K */
+    {{ 38.2812715818, 43.7675865, 20.7861552001, 668.630816394, 66.1589138202, 62.2528260667 }}, /* 5782 K */
+    {{ 38.2818072872, 43.768454349, 20.7861552167, 668.630701358, 66.1615433461, 62.2542632015 }}, /* 5783 K */
+    {{ 38.2823433025, 43.7693219056, 20.7861552334, 668.630580217, 66.1641743712, 62.2556999097 }}, /* 5784 K */
+    {{ 38.2828796282, 43.77018917, 20.7861552501, 668.630452964, 66.1668068963, 62.2571361904 }}, /* 5785 K */
+    {{ 38.2834162645, 43.7710561422, 20.7861552669, 668.630319592, 66.1694409222, 62.2585720429 }}, /* 5786 K */
+    {{ 38.2839532118, 43.7719228221, 20.7861552837, 668.630180095, 66.1720764494, 62.2600074663 }}, /* 5787 K */
+    {{ 38.2844904705, 43.7727892098, 20.7861553005, 668.630034467, 66.1747134788, 62.2614424598 }}, /* 5788 K */
+    {{ 38.2850280409, 43.7736553052, 20.7861553173, 668.629882701, 66.1773520111, 62.2628770227 }}, /* 5789 K */
+    {{ 38.2855659233, 43.7745211085, 20.7861553342, 668.629724792, 66.1799920469, 62.2643111542 }}, /* 5790 K */
+    {{ 38.2861041182, 43.7753866195, 20.7861553511, 668.629560733, 66.1826335869, 62.2657448535 }}, /* 5791 K */
+    {{ 38.2866426258, 43.7762518382, 20.786155368, 668.629390518, 66.185276632, 62.2671781197 }}, /* 5792 K */
+    {{ 38.2871814465, 43.7771167648, 20.786155385, 668.62921414, 66.1879211828, 62.2686109521 }}, /* 5793 K */
+    {{ 38.2877205806, 43.7779813992, 20.786155402, 668.629031593, 66.1905672399, 62.2700433499 }}, /* 5794 K */
+    {{ 38.2882600286, 43.7788457413, 20.786155419, 668.62884287, 66.1932148043, 62.2714753124 }}, /* 5795 K */
+    {{ 38.2887997907, 43.7797097913, 20.7861554361, 668.628647966, 66.1958638764, 62.2729068386 }}, /* 5796 K */
+    {{ 38.2893398673, 43.7805735491, 20.7861554532, 668.628446874, 66.1985144571, 62.2743379277 }}, /* 5797 K */
+    {{ 38.2898802587, 43.7814370147, 20.7861554703, 668.628239587, 66.2011665471, 62.2757685791 }}, /* 5798 K */
+    {{ 38.2904209653, 43.7823001881, 20.7861554875, 668.6280261, 66.203820147, 62.2771987919 }}, /* 5799 K */
+    {{ 38.2909619875, 43.7831630693, 20.7861555047, 668.627806405, 66.2064752576, 62.2786285653 }}, /* 5800 K */
+    {{ 38.2915033256, 43.7840256584, 20.7861555219, 668.627580497, 66.2091318797, 62.2800578984 }}, /* 5801 K */
+    {{ 38.2920449799, 43.7848879553, 20.7861555392, 668.627348369, 66.2117900139, 62.2814867905 }}, /* 5802 K */
+    {{ 38.2925869509, 43.78574996, 20.7861555565, 668.627110014, 66.2144496609, 62.2829152408 }}, /* 5803 K */
+    {{ 38.2931292388, 43.7866116726, 20.7861555738, 668.626865426, 66.2171108214, 62.2843432485 }}, /* 5804 K */
+    {{ 38.293671844, 43.787473093, 20.7861555911, 668.6266146, 66.2197734962, 62.2857708127 }}, /* 5805 K */
+    {{ 38.2942147668, 43.7883342213, 20.7861556085, 668.626357527, 66.222437686, 62.2871979327 }}, /* 5806 K */
+    {{ 38.2947580077, 43.7891950574, 20.7861556259, 668.626094202, 66.2251033915, 62.2886246076 }}, /* 5807 K */
+    {{ 38.2953015669, 43.7900556013, 20.7861556434, 668.625824619, 66.2277706133, 62.2900508367 }}, /* 5808 K */
+    {{ 38.2958454448, 43.7909158532, 20.7861556609, 668.625548771, 66.2304393523, 62.291476619 }}, /* 5809 K */
+    {{ 38.2963896418, 43.7917758129, 20.7861556784, 668.625266651, 66.2331096092, 62.2929019539 }}, /* 5810 K */
+    {{ 38.2969341582, 43.7926354804, 20.7861556959, 668.624978252, 66.2357813845, 62.2943268404 }}, /* 5811 K */
+    {{ 38.2974789944, 43.7934948559, 20.7861557135, 668.62468357, 66.2384546792, 62.2957512779 }}, /* 5812 K */
+    {{ 38.2980241507, 43.7943539392, 20.7861557311, 668.624382596, 66.2411294938, 62.2971752654 }}, /* 5813 K */
+    {{ 38.2985696274, 43.7952127303, 20.7861557487, 668.624075325, 66.2438058291, 62.2985988021 }}, /* 5814 K */
+    {{ 38.299115425, 43.7960712294, 20.7861557664, 668.623761749, 66.2464836858, 62.3000218872 }}, /* 5815 K */
+    {{ 38.2996615438, 43.7969294363, 20.7861557841, 668.623441863, 66.2491630646, 62.30144452 }}, /* 5816 K */
+    {{ 38.3002079841, 43.7977873511, 20.7861558019, 668.62311566, 66.2518439663, 62.3028666995 }}, /* 5817 K */
+    {{ 38.3007547462, 43.7986449739, 20.7861558196, 668.622783133, 66.2545263915, 62.3042884251 }}, /* 5818 K */
+    {{ 38.3013018306, 43.7995023044, 20.7861558374, 668.622444276, 66.2572103409, 62.3057096957 }}, /* 5819 K */
+    {{ 38.3018492376, 43.8003593429, 20.7861558553, 668.622099082, 66.2598958154, 62.3071305107 }}, /* 5820 K */
+    {{ 38.3023969676, 43.8012160893, 20.7861558732, 668.621747545, 66.2625828155, 62.3085508691 }}, /* 5821 K */
+    {{ 38.3029450208, 43.8020725436, 20.7861558911, 668.621389657, 66.2652713421, 62.3099707703 }}, /* 5822 K */
+    {{ 38.3034933977, 43.8029287057, 20.786155909, 668.621025413, 66.2679613958, 62.3113902133 }}, /* 5823 K */
+    {{ 38.3040420986, 43.8037845758, 20.786155927, 668.620654806, 66.2706529773, 62.3128091973 }}, /* 5824 K */
+    {{ 38.3045911239, 43.8046401537, 20.786155945, 668.620277829, 66.2733460873, 62.3142277214 }}, /* 5825 K */
+    {{ 38.3051404739, 43.8054954396, 20.786155963, 668.619894476, 66.2760407267, 62.315645785 }}, /* 5826 K */
+    {{ 38.3056901489, 43.8063504333, 20.7861559811, 668.61950474, 66.278736896, 62.3170633871 }}, /* 5827 K */
+    {{ 38.3062401494, 43.807205135, 20.7861559992, 668.619108614, 66.281434596, 62.3184805268 }}, /* 5828 K */
+    {{ 38.3067904756, 43.8080595446, 20.7861560173, 668.618706091, 66.2841338275, 62.3198972035 }}, /* 5829 K */
+    {{ 38.307341128, 43.808913662, 20.7861560355, 668.618297166, 66.2868345911, 62.3213134162 }}, /* 5830 K */
+    {{ 38.3078921069, 43.8097674874, 20.7861560537, 668.617881831, 66.2895368875, 62.322729164 }}, /* 5831 K */
+    {{ 38.3084434126, 43.8106210207, 20.7861560719, 668.61746008, 66.2922407175, 62.3241444463 }}, /* 5832 K */
+    {{ 38.3089950456, 43.8114742619, 20.7861560901, 668.617031906, 66.2949460817, 62.3255592621 }}, /* 5833 K */
+    {{ 38.309547006, 43.812327211, 20.7861561084, 668.616597303, 66.297652981, 62.3269736105 }}, /* 5834 K */
+    {{ 38.3100992944, 43.813179868, 20.7861561268, 668.616156263, 66.300361416, 62.3283874908 }}, /* 5835 K */
+    {{ 38.3106519111, 43.8140322329, 20.7861561451, 668.61570878, 66.3030713874, 62.3298009022 }}, /* 5836 K */
+    {{ 38.3112048564, 43.8148843057, 20.7861561635, 668.615254847, 66.3057828959, 62.3312138437 }}, /* 5837 K */
+    {{ 38.3117581307, 43.8157360864, 20.786156182, 668.614794458, 66.3084959424, 62.3326263145 }}, /* 5838 K */
+    {{ 38.3123117343, 43.8165875751, 20.7861562004, 668.614327606, 66.3112105274, 62.3340383138 }}, /* 5839 K */
+    {{ 38.3128656676, 43.8174387716, 20.7861562189, 668.613854283, 66.3139266516, 62.3354498408 }}, /* 5840 K */
+    {{ 38.313419931, 43.818289676, 20.7861562375, 668.613374484, 66.3166443159, 62.3368608946 }}, /* 5841 K */
+    {{ 38.3139745247, 43.8191402884, 20.786156256, 668.612888202, 66.319363521, 62.3382714743 }}, /* 5842 K */
+    {{ 38.3145294493, 43.8199906087, 20.7861562746, 668.61239543, 66.3220842674, 62.3396815792 }}, /* 5843 K */
+    {{ 38.315084705, 43.8208406368, 20.7861562932, 668.61189616, 66.3248065561, 62.3410912083 }}, /* 5844 K */
+    {{ 38.3156402921, 43.8216903729, 20.7861563119, 668.611390387, 66.3275303876, 62.3425003608 }}, /* 5845 K */
+    {{ 38.3161962111, 43.8225398169, 20.7861563306, 668.610878103, 66.3302557627, 62.3439090359 }}, /* 5846 K */
+    {{ 38.3167524623, 43.8233889687, 20.7861563493, 668.610359302, 66.3329826821, 62.3453172328 }}, /* 5847 K */
+    {{ 38.317309046, 43.8242378285, 20.7861563681, 668.609833977, 66.3357111465, 62.3467249504 }}, /* 5848 K */
+    {{ 38.3178659627, 43.8250863962, 20.7861563869, 668.609302121, 66.3384411567, 62.3481321881 }}, /* 5849 K */
+    {{ 38.3184232126, 43.8259346718, 20.7861564057, 668.608763727, 66.3411727134, 62.349538945 }}, /* 5850 K */
+    {{ 38.3189807962, 43.8267826552, 20.7861564246, 668.608218789, 66.3439058172, 62.3509452202 }}, /* 5851 K */
+    {{ 38.3195387137, 43.8276303466, 20.7861564435, 668.607667299, 66.346640469, 62.3523510128 }}, /* 5852 K */
+    {{ 38.3200969656, 43.8284777459, 20.7861564624, 668.607109251, 66.3493766693, 62.353756322 }}, /* 5853 K */
+    {{ 38.3206555522, 43.829324853, 20.7861564814, 668.606544637, 66.352114419, 62.355161147 }}, /* 5854 K */
+    {{ 38.3212144739, 43.8301716681, 20.7861565004, 668.605973452, 66.3548537188, 62.3565654868 }}, /* 5855 K */
+    {{ 38.321773731, 43.831018191, 20.7861565194, 668.605395688, 66.3575945693, 62.3579693407 }}, /* 5856 K */
+    {{ 38.3223333239, 43.8318644218, 20.7861565385, 668.604811338, 66.3603369713, 62.3593727077 }}, /* 5857 K */
+    {{ 38.3228932529, 43.8327103605, 20.7861565576, 668.604220395, 66.3630809255, 62.360775587 }}, /* 5858 K */
+    {{ 38.3234535184, 43.8335560071, 20.7861565767, 668.603622853, 66.3658264326, 62.3621779777 }}, /* 5859 K */
+    {{ 38.3240141208, 43.8344013615, 20.7861565959, 668.603018704, 66.3685734934, 62.3635798791 }}, /* 5860 K */
+    {{ 38.3245750605, 43.8352464238, 20.7861566151, 668.602407942, 66.3713221085, 62.3649812901 }}, /* 5861 K */
+    {{ 38.3251363377, 43.836091194, 20.7861566344, 668.60179056, 66.3740722787, 62.36638221 }}, /* 5862 K */
+    {{ 38.3256979528, 43.8369356721, 20.7861566536, 668.60116655, 66.3768240047, 62.3677826378 }}, /* 5863 K */
+    {{ 38.3262599063, 43.837779858, 20.7861566729, 668.600535907, 66.3795772872, 62.3691825728 }}, /* 5864 K */
+    {{ 38.3268221984, 43.8386237518, 20.7861566923, 668.599898622, 66.3823321269, 62.370582014 }}, /* 5865 K */
+    {{ 38.3273848296, 43.8394673535, 20.7861567117, 668.599254689, 66.3850885246, 62.3719809606 }}, /* 5866 K */
+    {{ 38.3279478002, 43.840310663, 20.7861567311, 668.598604101, 66.387846481, 62.3733794117 }}, /* 5867 K */
+    {{ 38.3285111105, 43.8411536804, 20.7861567505, 668.59794685, 66.3906059967, 62.3747773664 }}, /* 5868 K */
+    {{ 38.3290747609, 43.8419964056, 20.78615677, 668.597282931, 66.3933670726, 62.3761748238 }}, /* 5869 K */
+    {{ 38.3296387518, 43.8428388386, 20.7861567895, 668.596612336, 66.3961297093, 62.3775717832 }}, /* 5870 K */
+    {{ 38.3302030835, 43.8436809795, 20.7861568091, 668.595935058, 66.3988939075, 62.3789682436 }}, /* 5871 K */
+    {{ 38.3307677564, 43.8445228282, 20.7861568286, 668.595251089, 66.401659668, 62.3803642041 }}, /* 5872 K */
+    {{ 38.3313327709, 43.8453643848, 20.7861568483, 668.594560424, 66.4044269915, 62.3817596638 }}, /* 5873 K */
+    {{ 38.3318981273, 43.8462056492, 20.7861568679, 668.593863054, 66.4071958787, 62.383154622 }}, /* 5874 K */
+    {{ 38.332463826, 43.8470466214, 20.7861568876, 668.593158974, 66.4099663303, 62.3845490776 }}, /* 5875 K */
+    {{ 38.3330298674, 43.8478873014, 20.7861569073, 668.592448175, 66.412738347, 62.3859430299 }}, /* 5876 K */
+    {{ 38.3335962517, 43.8487276892, 20.7861569271, 668.591730651, 66.4155119296, 62.3873364779 }}, /* 5877 K */
+    {{ 38.3341629795, 43.8495677849, 20.7861569469, 668.591006394, 66.4182870788, 62.3887294208 }}, /* 5878 K */
+    {{ 38.3347300509, 43.8504075883, 20.7861569667, 668.590275398, 66.4210637953, 62.3901218577 }}, /* 5879 K */
+    {{ 38.3352974665, 43.8512470996, 20.7861569866, 668.589537656, 66.4238420798, 62.3915137876 }}, /* 5880 K */
+    {{ 38.3358652265, 43.8520863186, 20.7861570065, 668.58879316, 66.426621933, 62.3929052098 }}, /* 5881 K */
+    {{ 38.3364333314, 43.8529252454, 20.7861570264, 668.588041904, 66.4294033557, 62.3942961233 }}, /* 5882 K */
+    {{ 38.3370017814, 43.85376388, 20.7861570464, 668.587283879, 66.4321863486, 62.3956865272 }}, /* 5883 K */
+    {{ 38.337570577, 43.8546022224, 20.7861570664, 668.58651908, 66.4349709123, 62.3970764207 }}, /* 5884 K */
+    {{ 38.3381397185, 43.8554402726, 20.7861570864, 668.585747499, 66.4377570477, 62.3984658028 }}, /* 5885 K */
+    {{ 38.3387092063, 43.8562780305, 20.7861571065, 668.584969128, 66.4405447554, 62.3998546728 }}, /* 5886 K */
+    {{ 38.3392790408, 43.8571154962, 20.7861571266, 668.584183962, 66.4433340362, 62.4012430296 }}, /* 5887 K */
+    {{ 38.3398492222, 43.8579526696, 20.7861571467, 668.583391992, 66.4461248908, 62.4026308724 }}, /* 5888 K */
+    {{ 38.3404197511, 43.8587895508, 20.7861571669, 668.582593211, 66.4489173199, 62.4040182003 }}, /* 5889 K */
+    {{ 38.3409906277, 43.8596261397, 20.7861571871, 668.581787613, 66.4517113241, 62.4054050124 }}, /* 5890 K */
+    {{ 38.3415618523, 43.8604624364, 20.7861572073, 668.580975189, 66.4545069044, 62.4067913078 }}, /* 5891 K */
+    {{ 38.3421334255, 43.8612984408, 20.7861572276, 668.580155934, 66.4573040612, 62.4081770857 }}, /* 5892 K */
+    {{ 38.3427053475, 43.8621341529, 20.7861572479, 668.579329839, 66.4601027955, 62.409562345 }}, /* 5893 K */
+    {{ 38.3432776187, 43.8629695727, 20.7861572683, 668.578496897, 66.4629031079, 62.410947085 }}, /* 5894 K */
+    {{ 38.3438502394, 43.8638047002, 20.7861572887, 668.577657102, 66.465704999, 62.4123313047 }}, /* 5895 K */
+    {{ 38.3444232101, 43.8646395354, 20.7861573091, 668.576810446, 66.4685084698, 62.4137150033 }}, /* 5896 K */
+    {{ 38.3449965311, 43.8654740783, 20.7861573296, 668.575956922, 66.4713135208, 62.4150981797 }}, /* 5897 K */
+    {{ 38.3455702028, 43.8663083289, 20.7861573501, 668.575096522, 66.4741201527, 62.4164808332 }}, /* 5898 K */
+    {{ 38.3461442255, 43.8671422872, 20.7861573706, 668.57422924, 66.4769283664, 62.4178629628 }}, /* 5899 K */
+    {{ 38.3467185996, 43.8679759532, 20.7861573912, 668.573355068, 66.4797381625, 62.4192445677 }}, /* 5900 K */
+    {{ 38.3472933255, 43.8688093268, 20.7861574118, 668.572473998, 66.4825495418, 62.4206256468 }}, /* 5901 K */
+    {{ 38.3478684035, 43.8696424081, 20.7861574324, 668.571586024, 66.4853625049, 62.4220061993 }}, /* 5902 K */
+    {{ 38.3484438339, 43.870475197, 20.7861574531, 668.570691138, 66.4881770526, 62.4233862244 }}, /* 5903 K */
+    {{ 38.3490196173, 43.8713076935, 20.7861574738, 668.569789334, 66.4909931857, 62.424765721 }}, /* 5904 K */
+    {{ 38.3495957539, 43.8721398977, 20.7861574945, 668.568880603, 66.4938109047, 62.4261446884 }}, /* 5905 K */
+    {{ 38.3501722441, 43.8729718095, 20.7861575153, 668.567964938, 66.4966302106, 62.4275231255 }}, /* 5906 K */
+    {{ 38.3507490883, 43.8738034289, 20.7861575361, 668.567042333, 66.4994511039, 62.4289010314 }}, /* 5907 K */
+    {{ 38.3513262868, 43.874634756, 20.786157557, 668.566112779, 66.5022735854, 62.4302784053 }}, /* 5908 K */
+    {{ 38.35190384, 43.8754657906, 20.7861575778, 668.565176269, 66.5050976558, 62.4316552463 }}, /* 5909 K */
+    {{ 38.3524817483, 43.8762965328, 20.7861575988, 668.564232797, 66.5079233159, 62.4330315534 }}, /* 5910 K */
+    {{ 38.353060012, 43.8771269826, 20.7861576197, 668.563282354, 66.5107505663, 62.4344073257 }}, /* 5911 K */
+    {{ 38.3536386315, 43.87795714, 20.7861576407, 668.562324934, 66.5135794078, 62.4357825623 }}, /* 5912 K */
+    {{ 38.3542176072, 43.8787870049, 20.7861576618, 668.561360528, 66.5164098412, 62.4371572622 }}, /* 5913 K */
+    {{ 38.3547969395, 43.8796165774, 20.7861576828, 668.560389131, 66.519241867, 62.4385314247 }}, /* 5914 K */
+    {{ 38.3553766287, 43.8804458574, 20.7861577039, 668.559410733, 66.5220754861, 62.4399050486 }}, /* 5915 K */
+    {{ 38.3559566751, 43.8812748449, 20.7861577251, 668.558425328, 66.5249106992, 62.4412781333 }}, /* 5916 K */
+    {{ 38.3565370792, 43.88210354, 20.7861577462, 668.557432909, 66.527747507, 62.4426506776 }}, /* 5917 K */
+    {{ 38.3571178414, 43.8829319426, 20.7861577675, 668.556433468, 66.5305859103, 62.4440226807 }}, /* 5918 K */
+    {{ 38.3576989619, 43.8837600527, 20.7861577887, 668.555426997, 66.5334259096, 62.4453941416 }}, /* 5919 K */
+    {{ 38.3582804412, 43.8845878703, 20.78615781, 668.55441349, 66.5362675059, 62.4467650595 }}, /* 5920 K */
+    {{ 38.3588622796, 43.8854153954, 20.7861578313, 668.553392938, 66.5391106997, 62.4481354334 }}, /* 5921 K */
+    {{ 38.3594444776, 43.8862426279, 20.7861578527, 668.552365335, 66.5419554918, 62.4495052624 }}, /* 5922 K */
+    {{ 38.3600270354, 43.8870695679, 20.7861578741, 668.551330672, 66.544801883, 62.4508745455 }}, /* 5923 K */
+    {{ 38.3606099534, 43.8878962154, 20.7861578955, 668.550288943, 66.5476498739, 62.4522432819 }}, /* 5924 K */
+    {{ 38.3611932321, 43.8887225703, 20.786157917, 668.54924014, 66.5504994653, 62.4536114706 }}, /* 5925 K */
+    {{ 38.3617768718, 43.8895486326, 20.7861579385, 668.548184255, 66.553350658, 62.4549791106 }}, /* 5926 K */
+    {{ 38.3623608728, 43.8903744024, 20.78615796, 668.547121281, 66.5562034525, 62.4563462011 }}, /* 5927 K */
+    {{ 38.3629452355, 43.8911998795, 20.7861579816, 668.546051211, 66.5590578497, 62.4577127411 }}, /* 5928 K */
+    {{ 38.3635299604, 43.8920250641, 20.7861580032, 668.544974037, 66.5619138503, 62.4590787297 }}, /* 5929 K */
+    {{ 38.3641150477, 43.892849956, 20.7861580249, 668.543889751, 66.564771455, 62.4604441659 }}, /* 5930 K */
+    {{ 38.3647004978, 43.8936745553, 20.7861580465, 668.542798346, 66.5676306645, 62.4618090489 }}, /* 5931 K */
+    {{ 38.3652863112, 43.894498862, 20.7861580683, 668.541699814, 66.5704914796, 62.4631733776 }}, /* 5932 K */
+    {{ 38.3658724881, 43.8953228761, 20.78615809, 668.540594148, 66.5733539009, 62.4645371511 }}, /* 5933 K */
+    {{ 38.3664590291, 43.8961465975, 20.7861581118, 668.539481341, 66.5762179292, 62.4659003686 }}, /* 5934 K */
+    {{ 38.3670459343, 43.8969700262, 20.7861581337, 668.538361384, 66.5790835653, 62.467263029 }}, /* 5935 K */
+    {{ 38.3676332042, 43.8977931622, 20.7861581555, 668.537234271, 66.5819508097, 62.4686251314 }}, /* 5936 K */
+    {{ 38.3682208393, 43.8986160055, 20.7861581774, 668.536099993, 66.5848196634, 62.4699866749 }}, /* 5937 K */
+    {{ 38.3688088397, 43.8994385561, 20.7861581994, 668.534958543, 66.5876901269, 62.4713476586 }}, /* 5938 K */
+    {{ 38.369397206, 43.900260814, 20.7861582214, 668.533809913, 66.5905622011, 62.4727080814 }}, /* 5939 K */
+    {{ 38.3699859385, 43.9010827792, 20.7861582434, 668.532654097, 66.5934358866, 62.4740679425 }}, /* 5940 K */
+    {{ 38.3705750375, 43.9019044516, 20.7861582654, 668.531491086, 66.5963111842, 62.4754272409 }}, /* 5941 K */
+    {{ 38.3711645035, 43.9027258313, 20.7861582875, 668.530320872, 66.5991880945, 62.4767859757 }}, /* 5942 K */
+    {{ 38.3717543368, 43.9035469182, 20.7861583097, 668.529143448, 66.6020666184, 62.4781441459 }}, /* 5943 K */
+    {{ 38.3723445378, 43.9043677123, 20.7861583318, 668.527958807, 66.6049467565, 62.4795017505 }}, /* 5944 K */
+    {{ 38.3729351069, 43.9051882136, 20.786158354, 668.526766941, 66.6078285096, 62.4808587887 }}, /* 5945 K */
+    {{ 38.3735260444, 43.9060084221, 20.7861583763, 668.525567841, 66.6107118783, 62.4822152595 }}, /* 5946 K */
+    {{ 38.3741173507, 43.9068283378, 20.7861583986, 668.524361501, 66.6135968635, 62.4835711618 }}, /* 5947 K */
+    {{ 38.3747090262, 43.9076479607, 20.7861584209, 668.523147913, 66.6164834658, 62.4849264949 }}, /* 5948 K */
+    {{ 38.3753010712, 43.9084672907, 20.7861584433, 668.521927069, 66.619371686, 62.4862812576 }}, /* 5949 K */
+    {{ 38.3758934862, 43.9092863278, 20.7861584656, 668.520698961, 66.6222615248, 62.4876354491 }}, /* 5950 K */
+    {{ 38.3764862715, 43.9101050721, 20.7861584881, 668.519463582, 66.6251529829, 62.4889890684 }}, /* 5951 K */
+    {{ 38.3770794274, 43.9109235234, 20.7861585105, 668.518220924, 66.628046061, 62.4903421146 }}, /* 5952 K */
+    {{ 38.3776729545, 43.9117416819, 20.7861585331, 668.516970979, 66.6309407599, 62.4916945866 }}, /* 5953 K */
+    {{ 38.3782668529, 43.9125595474, 20.7861585556, 668.51571374, 66.6338370802, 62.4930464836 }}, /* 5954 K */
+    {{ 38.3788611232, 43.91337712, 20.7861585782, 668.514449199, 66.6367350228, 62.4943978046 }}, /* 5955 K */
+    {{ 38.3794557657, 43.9141943997, 20.7861586008, 668.513177348, 66.6396345884, 62.4957485486 }}, /* 5956 K */
+    {{ 38.3800507807, 43.9150113864, 20.7861586235, 668.511898179, 66.6425357776, 62.4970987146 }}, /* 5957 K */
+    {{ 38.3806461687, 43.9158280801, 20.7861586462, 668.510611685, 66.6454385912, 62.4984483018 }}, /* 5958 K */
+    {{ 38.3812419299, 43.9166444808, 20.7861586689, 668.509317857, 66.6483430299, 62.499797309 }}, /* 5959 K */
+    {{ 38.3818380649, 43.9174605885, 20.7861586917, 668.508016689, 66.6512490944, 62.5011457355 }}, /* 5960 K */
+    {{ 38.3824345739, 43.9182764032, 20.7861587145, 668.506708172, 66.6541567856, 62.5024935801 }}, /* 5961 K */
+    {{ 38.3830314574, 43.9190919249, 20.7861587373, 668.505392299, 66.657066104, 62.503840842 }}, /* 5962 K */
+    {{ 38.3836287157, 43.9199071535, 20.7861587602, 668.504069061, 66.6599770504, 62.5051875201 }}, /* 5963 K */
+    {{ 38.3842263492, 43.920722089, 20.7861587831, 668.502738452, 66.6628896257, 62.5065336136 }}, /* 5964 K */
+    {{ 38.3848243582, 43.9215367315, 20.7861588061, 668.501400462, 66.6658038303, 62.5078791214 }}, /* 5965 K */
+    {{ 38.3854227433, 43.9223510808, 20.7861588291, 668.500055085, 66.6687196652, 62.5092240425 }}, /* 5966 K */
+    {{ 38.3860215046, 43.923165137, 20.7861588521, 668.498702312, 66.671637131, 62.5105683761 }}, /* 5967 K */
+    {{ 38.3866206427, 43.9239789001, 20.7861588752, 668.497342136, 66.6745562285, 62.511912121 }}, /* 5968 K */
+    {{ 38.3872201578, 43.9247923701, 20.7861588983, 668.495974549, 66.6774769583, 62.5132552765 }}, /* 5969 K */
+    {{ 38.3878200504, 43.9256055469, 20.7861589215, 668.494599542, 66.6803993213, 62.5145978414 }}, /* 5970 K */
+    {{ 38.3884203209, 43.9264184305, 20.7861589447, 668.493217109, 66.6833233181, 62.5159398147 }}, /* 5971 K */
+    {{ 38.3890209695, 43.9272310209, 20.7861589679, 668.491827241, 66.6862489495, 62.5172811957 }}, /* 5972 K */
+    {{ 38.3896219968, 43.9280433181, 20.7861589911, 668.49042993, 66.6891762161, 62.5186219831 }}, /* 5973 K */
+    {{ 38.390223403, 43.9288553221, 20.7861590145, 668.489025168, 66.6921051188, 62.5199621762 }}, /* 5974 K */
+    {{ 38.3908251886, 43.9296670328, 20.7861590378, 668.487612949, 66.6950356582, 62.5213017738 }}, /* 5975 K */
+    {{ 38.3914273539, 43.9304784502, 20.7861590612, 668.486193262, 66.6979678351, 62.522640775 }}, /* 5976 K */
+    {{ 38.3920298994, 43.9312895744, 20.7861590846, 668.484766102, 66.7009016502, 62.5239791789 }}, /* 5977 K */
+    {{ 38.3926328253, 43.9321004053, 20.7861591081, 668.483331459, 66.7038371042, 62.5253169844 }}, /* 5978 K */
+    {{ 38.3932361321, 43.9329109428, 20.7861591316, 668.481889326, 66.7067741979, 62.5266541906 }}, /* 5979 K */
+    {{ 38.3938398202, 43.9337211871, 20.7861591551, 668.480439695, 66.7097129319, 62.5279907965 }}, /* 5980 K */
+    {{ 38.3944438899, 43.9345311379, 20.7861591787, 668.478982558, 66.7126533071, 62.529326801 }}, /* 5981 K */
+    {{ 38.3950483416, 43.9353407954, 20.7861592023, 668.477517907, 66.7155953241, 62.5306622033 }}, /* 5982 K */
+    {{ 38.3956531757, 43.9361501596, 20.7861592259, 668.476045734, 66.7185389837, 62.5319970023 }}, /* 5983 K */
+    {{ 38.3962583926, 43.9369592303, 20.7861592496, 668.474566032, 66.7214842865, 62.533331197 }}, /* 5984 K */
+    {{ 38.3968639926, 43.9377680076, 20.7861592734, 668.473078791, 66.7244312334, 62.5346647865 }}, /* 5985 K */
+    {{ 38.3974699762, 43.9385764914, 20.7861592971, 668.471584004, 66.7273798251, 62.5359977698 }}, /* 5986 K */
+    {{ 38.3980763436, 43.9393846818, 20.786159321, 668.470081663, 66.7303300622, 62.5373301458 }}, /* 5987 K */
+    {{ 38.3986830954, 43.9401925787, 20.7861593448, 668.468571761, 66.7332819455, 62.5386619135 }}, /* 5988 K */
+    {{ 38.3992902319, 43.9410001822, 20.7861593687, 668.467054289, 66.7362354757, 62.5399930721 }}, /* 5989 K */
+    {{ 38.3998977534, 43.9418074921, 20.7861593926, 668.465529238, 66.7391906537, 62.5413236205 }}, /* 5990 K */
+    {{ 38.4005056603, 43.9426145085, 20.7861594166, 668.463996602, 66.74214748, 62.5426535576 }}, /* 5991 K */
+    {{ 38.4011139531, 43.9434212313, 20.7861594406, 668.462456371, 66.7451059554, 62.5439828826 }}, /* 5992 K */
+    {{ 38.4017226321, 43.9442276605, 20.7861594646, 668.460908539, 66.7480660807, 62.5453115943 }}, /* 5993 K */
+    {{ 38.4023316976, 43.9450337962, 20.7861594887, 668.459353096, 66.7510278566, 62.5466396919 }}, /* 5994 K */
+    {{ 38.4029411502, 43.9458396382, 20.7861595128, 668.457790035, 66.7539912837, 62.5479671742 }}, /* 5995 K */
+    {{ 38.4035509901, 43.9466451867, 20.786159537, 668.456219348, 66.7569563629, 62.5492940404 }}, /* 5996 K */
+    {{ 38.4041612177, 43.9474504414, 20.7861595612, 668.454641027, 66.7599230949, 62.5506202894 }}, /* 5997 K */
+    {{ 38.4047718334, 43.9482554025, 20.7861595854, 668.453055063, 66.7628914804, 62.5519459201 }}, /* 5998 K */
+    {{ 38.4053828376, 43.94906007, 20.7861596097, 668.451461448, 66.7658615201, 62.5532709317 }}, /* 5999 K */
+    {{ 38.4056884855, 43.9494622935, 20.7861596219, 668.45066177, 66.7673471605, 62.553933205 }}, /* 6000 K */
+};
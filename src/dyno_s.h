@@ -0,0 +1,39 @@
+/* A speed holding dynamometer on the crankshaft. While on it absorbs or supplies
+ * the torque of a PI controller that pulls the crankshaft towards the target speed
+ * within the time constant and trims out the engine's own torque over the integral
+ * time constant, slow enough to leave the firing pulses' speed ripple in.
+ */
+
+constexpr double g_dyno_default_time_constant_s = 0.05;
+constexpr double g_dyno_integral_time_constant_s = 0.25;
+
+struct dyno_s
+{
+    double target_angular_velocity_r_per_s;
+    double time_constant_s;
+    double integral_r;
+    bool is_on;
+};
+
+static double
+calc_dyno_torque_n_m(struct dyno_s* self, struct crankshaft_s* crankshaft, double moment_of_inertia_kg_m2)
+{
+    if(self->is_on == false)
+    {
+        return 0.0;
+    }
+    double time_constant_s = self->time_constant_s > 0.0 ? self->time_constant_s : g_dyno_default_time_constant_s;
+    double delta_r_per_s = self->target_angular_velocity_r_per_s - crankshaft->angular_velocity_r_per_s;
+    return moment_of_inertia_kg_m2 / time_constant_s * (delta_r_per_s + self->integral_r / g_dyno_integral_time_constant_s);
+}
+
+static void
+integrate_dyno(struct dyno_s* self, struct crankshaft_s* crankshaft)
+{
+    if(self->is_on == false)
+    {
+        self->integral_r = 0.0;
+        return;
+    }
+    self->integral_r += (self->target_angular_velocity_r_per_s - crankshaft->angular_velocity_r_per_s) * g_std_dt_s;
+}
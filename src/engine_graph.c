@@ -2,72 +2,209 @@
 #include <string.h>
 #include <math.h>
 
-// Asumimos 255 como el marcador de "no hay ms conexiones"
-constexpr uint8_t END_OF_LINKS = 255;
+// next[] termina en 0 (el nodo 0 es siempre el source, nadie apunta a l)
+constexpr uint16_t END_OF_LINKS = 0;
 
-static void
+// Defaults para lo que params deja en 0: los mismos valores que usan los JSON de configs/
+constexpr double g_graph_source_sink_volume_m3 = 1.00e20;
+constexpr double g_graph_throttle_volume_m3 = 2.0e-4;
+constexpr double g_graph_injector_volume_m3 = 4.8e-6;
+constexpr double g_graph_manifold_volume_m3 = 1.0e-3;
+constexpr double g_graph_runner_volume_m3 = 2.2e-4;
+constexpr double g_graph_exhaust_volume_m3 = 2.5e-4;
+constexpr double g_graph_runner_area_m2 = 1.2e-3;
+constexpr double g_graph_gas_damping_tau_s = 0.53e-3;
+constexpr double g_graph_piston_head_density_kg_per_m3 = 9500.0;
+constexpr double g_graph_piston_head_compression_height_m = 0.025;
+constexpr double g_graph_piston_head_clearance_m = 0.007;
+constexpr double g_graph_piston_dynamic_friction = 0.029;
+constexpr double g_graph_piston_static_friction = 0.90;
+constexpr double g_graph_eplenum_pipe_length_m = 1.1;
+constexpr double g_graph_eplenum_mic_position_ratio = 0.1;
+constexpr double g_graph_eplenum_velocity_low_pass_hz = 6000.0;
+
+// ngulos del modelo: el PMS de combustin est en 2 pi y el de cruce en 0 (4 pi)
+constexpr double g_graph_intake_engage_r = -0.25 * g_std_pi_r;
+constexpr double g_graph_intake_ramp_r = 1.00 * g_std_pi_r;
+constexpr double g_graph_exhaust_engage_r = 2.70 * g_std_pi_r;
+constexpr double g_graph_exhaust_ramp_r = 0.95 * g_std_pi_r;
+constexpr double g_graph_sparkplug_engage_r = 2.05 * g_std_pi_r;
+constexpr double g_graph_sparkplug_on_r = 0.25 * g_std_pi_r;
+
+// calc_valve_nozzle_open_ratio abre la vlvula durante 1.342 rampas (pico en 1)
+constexpr double g_graph_valve_open_per_ramp = 1.342;
+
+// reas de nozzle relativas al runner de admisin (mismas proporciones que hotreload_engine.h)
+constexpr double g_graph_source_area_ratio = 0.50;
+constexpr double g_graph_throttle_area_ratio = 0.42;
+constexpr double g_graph_iplenum_area_ratio = 1.00;
+constexpr double g_graph_injector_area_ratio = 0.0083;
+constexpr double g_graph_piston_area_ratio = 0.83;
+constexpr double g_graph_erunner_area_ratio = 0.75;
+constexpr double g_graph_eplenum_area_ratio = 3.00;
+constexpr double g_graph_exhaust_area_ratio = 1.50;
+
+static double
+calc_graph_deg_to_r(double deg)
+{
+    return deg * (g_std_pi_r / 180.0);
+}
+
+static double
+pick_graph_value(double value, double fallback)
+{
+    return value > 0.0 ? value : fallback;
+}
+
+// Los grados de params se cuentan desde el PMS de combustin (0..720); el modelo lo tiene en 2 pi.
+// Sin ventana (close <= open) se usa la rampa, y sin rampa el default.
+static struct valve_s
+make_graph_valve(float open_deg, float close_deg, float ramp_deg, double phase_r, double engage_r, double ramp_r)
+{
+    struct valve_s valve = {};
+    bool has_timing = open_deg != 0.0f || close_deg != 0.0f;
+    valve.engage_r = phase_r + (has_timing ? calc_graph_deg_to_r(open_deg + 360.0) : engage_r);
+    valve.ramp_r = ramp_r;
+    if (close_deg > open_deg)
+    {
+        valve.ramp_r = calc_graph_deg_to_r(close_deg - open_deg) / g_graph_valve_open_per_ramp;
+    }
+    else if (ramp_deg > 0.0f)
+    {
+        valve.ramp_r = calc_graph_deg_to_r(ramp_deg);
+    }
+    return valve;
+}
+
+static struct chamber_s
+make_graph_chamber(double volume_m3, double area_m2, double tau_s)
+{
+    struct chamber_s chamber = {};
+    chamber.volume_m3 = volume_m3;
+    chamber.nozzle_max_flow_area_m2 = area_m2;
+    chamber.gas_momentum_damping_time_constant_s = tau_s;
+    return chamber;
+}
+
+static bool
 link_node(struct node_s* nodes, size_t from_idx, size_t to_idx)
 {
     for (size_t i = 0; i < g_nodes_node_children; i++)
     {
         if (nodes[from_idx].next[i] == END_OF_LINKS)
         {
-            nodes[from_idx].next[i] = (uint8_t)to_idx;
-            return;
+            nodes[from_idx].next[i] = (uint16_t)to_idx;
+            return true;
         }
     }
     // Si llegs ac, te quedaste sin slots en g_nodes_node_children (16)
-    g_panic_message = "Node children limit exceeded";
+    return false;
 }
 
 struct node_s*
     build_dynamic_engine_nodes(const ensim4_engine_params_t* params, size_t* out_node_count)
 {
-    // 1. Calcular tamao (1 Source + 1 Throttle + 1 iplenum + N*(runner, inj, piston, erunner) + 1 eplenum + 1 exhaust + 1 sink)
+    *out_node_count = 0;
+    if (params->cylinders == 0 || params->cylinders > ENSIM4_MAX_CYLINDERS)
+    {
+        return NULL;
+    }
+
+    // Bancos y caos en 0 toman el default: un banco, y un cao por banco
     size_t n = params->cylinders;
-    size_t total_nodes = 6 + (n * 4);
+    size_t banks = params->banks > 0 ? params->banks : 1;
+    size_t pipes = params->flow.exhaust_pipes > 0 ? params->flow.exhaust_pipes : banks;
+    if (banks > n || pipes > n)
+    {
+        return NULL;
+    }
 
-    struct node_s* nodes = (struct node_s*)malloc(total_nodes * sizeof(struct node_s));
+    // 1. Calcular tamao (1 Source + 1 Throttle + 1 iplenum por banco + N*(runner, inj, piston, erunner) + 1 eplenum y 1 exhaust por cao + 1 sink)
+    size_t total_nodes = 3 + banks + (n * 4) + (pipes * 2);
 
-    // Inicializar memoria a 0, pero forzar los arrays "next" a END_OF_LINKS
-    memset(nodes, 0, total_nodes * sizeof(struct node_s));
-    for (size_t i = 0; i < total_nodes; i++) {
-        memset(nodes[i].next, END_OF_LINKS, g_nodes_node_children);
+    // calloc deja los arrays "next" en END_OF_LINKS
+    struct node_s* nodes = (struct node_s*)calloc(total_nodes, sizeof(struct node_s));
+    if (!nodes)
+    {
+        return NULL;
     }
 
-    // 2. Asignar ndices
+    double tau = pick_graph_value(params->solver.gas_momentum_damping_time_constant_s, g_graph_gas_damping_tau_s);
+    double runner_area = pick_graph_value(params->flow.runner_nozzle_max_area_m2, g_graph_runner_area_m2);
+    double manifold_volume = pick_graph_value(params->flow.manifold_volume_m3, g_graph_manifold_volume_m3);
+    double runner_volume = pick_graph_value(params->flow.runner_volume_m3, g_graph_runner_volume_m3);
+    double exhaust_volume = pick_graph_value(params->flow.exhaust_volume_m3, g_graph_exhaust_volume_m3);
+
+    // 2. Asignar ndices
     size_t current = 0;
     size_t idx_source = current++;
     size_t idx_throttle = current++;
-    size_t idx_iplenum = current++; // Centralizamos el aire aqu antes de los runners
+    size_t idx_iplenum = current; // Centralizamos el aire de cada banco en su iplenum antes de los runners
+    current += banks;
 
-    size_t idx_eplenum = total_nodes - 3;
-    size_t idx_exhaust = total_nodes - 2;
+    size_t idx_eplenum = total_nodes - 1 - (pipes * 2); // cada cao es un eplenum seguido de su exhaust
     size_t idx_sink = total_nodes - 1;
 
-    // 3. Configurar Nodos Globales (Ajustar volmenes segn tu lgica de normalizacin)
+    // 3. Configurar Nodos Globales
     nodes[idx_source].type = g_is_source;
+    nodes[idx_source].as.source.chamber = make_graph_chamber(g_graph_source_sink_volume_m3, g_graph_source_area_ratio * runner_area, tau);
 
+    // El throttle reparte entre los bancos: el rea total no cambia con la cantidad
     nodes[idx_throttle].type = g_is_throttle;
-    nodes[idx_throttle].as.chamber.volume_m3 = 2.0e-4; // O tomarlo de params->flow
-    nodes[idx_throttle].as.chamber.nozzle_max_flow_area_m2 = params->throttle.throttle_body_area_m2;
+    nodes[idx_throttle].as.throttle.chamber = make_graph_chamber(
+        g_graph_throttle_volume_m3,
+        pick_graph_value(params->throttle.throttle_body_area_m2, g_graph_throttle_area_ratio * runner_area) / banks,
+        tau);
 
-    nodes[idx_iplenum].type = g_is_iplenum;
-    nodes[idx_iplenum].as.chamber.volume_m3 = params->flow.manifold_volume_m3;
+    // 4. Conexiones Globales: las de cada banco y cada cao se hacen al armarlos
+    bool is_linked = link_node(nodes, idx_source, idx_throttle);
 
-    nodes[idx_eplenum].type = g_is_eplenum;
-    nodes[idx_eplenum].as.chamber.volume_m3 = params->flow.exhaust_volume_m3;
-    nodes[idx_eplenum].as.chamber.nozzle_max_flow_area_m2 = params->flow.exhaust_nozzle_max_area_m2;
-    // Ojo: Ac tendras que inicializar el wave_index si params->enable_waves es true
+    for (size_t b = 0; b < banks; b++)
+    {
+        nodes[idx_iplenum + b].type = g_is_iplenum;
+        nodes[idx_iplenum + b].as.iplenum.chamber = make_graph_chamber(
+            manifold_volume / banks,
+            pick_graph_value(params->flow.plenum_nozzle_max_area_m2, g_graph_iplenum_area_ratio * runner_area),
+            tau);
+        is_linked = is_linked && link_node(nodes, idx_throttle, idx_iplenum + b);
+    }
+
+    // Un eplenum por cao: wave_index p es su slot en la tabla de waves del engine.
+    // Los caos se reparten el volumen y el rea del escape, as uno solo es el de siempre.
+    for (size_t p = 0; p < pipes; p++)
+    {
+        size_t idx_pipe = idx_eplenum + (p * 2);
+        nodes[idx_pipe].type = g_is_eplenum;
+        struct eplenum_s* eplenum = &nodes[idx_pipe].as.eplenum;
+        eplenum->chamber = make_graph_chamber(
+            exhaust_volume / pipes,
+            pick_graph_value(params->flow.exhaust_nozzle_max_area_m2, g_graph_eplenum_area_ratio * runner_area) / pipes,
+            tau);
+        eplenum->wave_index = p;
+        eplenum->pipe_length_m = g_graph_eplenum_pipe_length_m;
+        eplenum->mic_position_ratio = g_graph_eplenum_mic_position_ratio;
+        eplenum->velocity_low_pass_cutoff_frequency_hz = g_graph_eplenum_velocity_low_pass_hz;
+
+        nodes[idx_pipe + 1].type = g_is_exhaust;
+        nodes[idx_pipe + 1].as.exhaust.chamber = make_graph_chamber(exhaust_volume / pipes, g_graph_exhaust_area_ratio * runner_area / pipes, tau);
+
+        is_linked = is_linked
+            && link_node(nodes, idx_pipe, idx_pipe + 1)
+            && link_node(nodes, idx_pipe + 1, idx_sink);
+    }
 
-    nodes[idx_exhaust].type = g_is_exhaust;
     nodes[idx_sink].type = g_is_sink;
+    nodes[idx_sink].as.sink.chamber = make_graph_chamber(g_graph_source_sink_volume_m3, 0.0, tau);
+
+    // Encendido: avance en grados antes del PMS, o el default del modelo
+    const ensim4_curve_rpm_f32_t* advance = &params->ignition.spark_advance_deg_by_rpm;
+    double spark_r = advance->count > 0
+        ? calc_graph_deg_to_r(360.0 - advance->value[0])
+        : g_graph_sparkplug_engage_r;
 
-    // 4. Conexiones Globales
-    link_node(nodes, idx_source, idx_throttle);
-    link_node(nodes, idx_throttle, idx_iplenum);
-    link_node(nodes, idx_eplenum, idx_exhaust);
-    link_node(nodes, idx_exhaust, idx_sink);
+    double clearance_m = params->mech.compression_ratio > 1.0f
+        ? params->mech.stroke_m / (params->mech.compression_ratio - 1.0)
+        : g_graph_piston_head_clearance_m;
 
     // 5. Construccin y Firing Order Dinmico de Cilindros
     for (size_t i = 0; i < n; i++)
@@ -77,51 +214,67 @@ struct node_s*
         size_t idx_piston = current++;
         size_t idx_erunner = current++;
 
+        // Asignacin de fase dinmica (modo manual vs auto): el pistn llega al PMS en phase_r
+        double phase_deg = params->firing.mode == ENSIM4_FIRE_MANUAL_DEGREES
+            ? params->firing.firing_deg[i]
+            : 720.0 / n * i;
+        phase_deg += params->firing.global_phase_deg + params->cylinder_phase_offset_deg[i];
+        double phase_r = calc_graph_deg_to_r(phase_deg);
+
         // I-Runner
         nodes[idx_irunner].type = g_is_irunner;
-        nodes[idx_irunner].as.irunner.chamber.volume_m3 = params->flow.runner_volume_m3;
-        nodes[idx_irunner].as.irunner.chamber.nozzle_max_flow_area_m2 = params->flow.runner_nozzle_max_area_m2;
-        nodes[idx_irunner].as.irunner.valve.engage_r = params->valves.intake_open_deg * (g_std_pi_r / 180.0);
-        nodes[idx_irunner].as.irunner.valve.ramp_r = params->valves.intake_ramp_deg * (g_std_pi_r / 180.0);
+        struct irunner_s* irunner = &nodes[idx_irunner].as.irunner;
+        irunner->chamber = make_graph_chamber(runner_volume, runner_area, tau);
+        irunner->valve = make_graph_valve(
+            params->valves.intake_open_deg, params->valves.intake_close_deg, params->valves.intake_ramp_deg,
+            phase_r, g_graph_intake_engage_r, g_graph_intake_ramp_r);
 
-        // Injector
+        // Injector: reservoir que abre cuando abre su runner
         nodes[idx_injector].type = g_is_injector;
-        // Inyector es un "reservoir", normalizar despus
+        nodes[idx_injector].as.injector.chamber = make_graph_chamber(g_graph_injector_volume_m3, g_graph_injector_area_ratio * runner_area, tau);
+        nodes[idx_injector].as.injector.nozzle_index = idx_irunner;
 
-        // Piston (Aplicamos termodinmica geomtrica)
+        // Piston (Aplicamos termodinmica geomtrica; el volumen sale de la geometra)
         nodes[idx_piston].type = g_is_piston;
         struct piston_s* p = &nodes[idx_piston].as.piston;
+        p->chamber = make_graph_chamber(0.0, g_graph_piston_area_ratio * runner_area, tau);
+        p->valve = make_graph_valve(
+            params->valves.exhaust_open_deg, params->valves.exhaust_close_deg, params->valves.exhaust_ramp_deg,
+            phase_r, g_graph_exhaust_engage_r, g_graph_exhaust_ramp_r);
+        p->sparkplug.engage_r = phase_r + spark_r;
+        p->sparkplug.on_r = g_graph_sparkplug_on_r;
+        p->theta_r = -phase_r;
         p->diameter_m = params->mech.bore_m;
         p->crank_throw_length_m = params->mech.stroke_m / 2.0;
         p->connecting_rod_length_m = params->mech.rod_length_m;
         p->connecting_rod_mass_kg = params->mech.rod_mass_kg;
-        p->head_compression_height_m = 0.025; // Opcional: Extraer a params
-        p->head_clearance_height_m = (params->mech.stroke_m) / (params->mech.compression_ratio - 1.0);
-        p->dynamic_friction_n_m_s_per_r = params->mech.dynamic_friction_n_m_s_per_r;
-        p->static_friction_n_m_s_per_r = params->mech.static_friction_n_m_s_per_r;
-
-        // Asignacin de fase dinmica (modo manual vs auto)
-        if (params->firing.mode == ENSIM4_FIRE_MANUAL_DEGREES) {
-            p->theta_r = params->firing.firing_deg[i] * (g_std_pi_r / 180.0);
-        }
-        else {
-            // Lgica auto fallback
-            p->theta_r = (720.0 / n * i) * (g_std_pi_r / 180.0);
-        }
+        p->head_mass_density_kg_per_m3 = g_graph_piston_head_density_kg_per_m3;
+        p->head_compression_height_m = g_graph_piston_head_compression_height_m;
+        p->head_clearance_height_m = clearance_m;
+        p->dynamic_friction_n_m_s_per_r = pick_graph_value(params->mech.dynamic_friction_n_m_s_per_r, g_graph_piston_dynamic_friction);
+        p->static_friction_n_m_s_per_r = pick_graph_value(params->mech.static_friction_n_m_s_per_r, g_graph_piston_static_friction);
 
         // E-Runner
         nodes[idx_erunner].type = g_is_erunner;
-        nodes[idx_erunner].as.chamber.volume_m3 = params->flow.exhaust_volume_m3 / n; // Aproximacin simple
-
-        // 6. Cableado del Cilindro
-        link_node(nodes, idx_iplenum, idx_irunner);
-        link_node(nodes, idx_irunner, idx_piston);
-        link_node(nodes, idx_injector, idx_piston);
-        link_node(nodes, idx_piston, idx_erunner);
-        link_node(nodes, idx_erunner, idx_eplenum);
+        nodes[idx_erunner].as.erunner.chamber = make_graph_chamber(exhaust_volume / n, g_graph_erunner_area_ratio * runner_area, tau); // Aproximacin simple
+
+        // 6. Cableado del Cilindro: los bancos y los caos se turnan los cilindros en orden
+        is_linked = is_linked
+            && link_node(nodes, idx_iplenum + (i % banks), idx_irunner)
+            && link_node(nodes, idx_irunner, idx_piston)
+            && link_node(nodes, idx_injector, idx_piston)
+            && link_node(nodes, idx_piston, idx_erunner)
+            && link_node(nodes, idx_erunner, idx_eplenum + ((i % pipes) * 2));
+    }
+
+    // Sin slots en next[] (ms de 16 hijos por nodo): no hay motor que devolver
+    if (!is_linked)
+    {
+        free(nodes);
+        return NULL;
     }
 
     // Retorno de datos
     *out_node_count = total_nodes;
     return nodes;
-}
\ No newline at end of file
+}
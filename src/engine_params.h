@@ -182,6 +182,7 @@ extern "C" {
         float exhaust_volume_m3;
         float exhaust_nozzle_max_area_m2;
         float exhaust_flow_loss_k;
+        uint32_t exhaust_pipes;        // eplenums, cada uno con su caño (0 = uno por banco)
 
         // Turbo/supercharger (si induction != NA)
         float boost_target_kpa;        // objetivo (sobre atmósfera o absoluto, definilo en tu implementación)
@@ -3,15 +3,50 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/* A nozzle between two nodes, compiled from the next[] lists so the flow loop
+ * is a linear scan with no node type tests. Edges keep the authored node order,
+ * which is also the order gas mail is applied in.
+ */
+
+struct edge_s
+{
+    struct node_s* x;
+    struct node_s* y;
+    uint16_t x_index;
+    uint16_t y_index;
+    size_t wave_index;
+    double x_momentum_damping_ratio;
+    double y_momentum_damping_ratio;
+    bool is_from_reservoir;
+    bool is_eplenum;
+};
+
+/* Everything one simulated engine touches lives here, so any number of engines
+ * can run side by side, each on its own thread. Panics stick until the next
+ * reset_engine. The block size is how many samples each run simulates, zero
+ * picking the monitor refresh default.
+ */
+
 struct engine_s
 {
     const char* name;
     struct node_s* node;
     size_t size;
+    struct edge_s* edge;
+    size_t edges;
+    struct batch_flow_s batch_flow;
+    struct wave_table_s waves;
+    struct wave_job_s* wave_job;
+    struct wave_fence_s wave_fence;
+    size_t block_size;
+    const double* impulse;
+    size_t impulse_size;
+    const char* panic_message;
     struct crankshaft_s crankshaft;
     struct flywheel_s flywheel;
     struct starter_s starter;
     struct limiter_s limiter;
+    struct dyno_s dyno;
     double throttle_open_ratio;
     double no_throttle;
     double low_throttle;
@@ -19,12 +54,19 @@ struct engine_s
     double high_throttle;
     double radial_spacing;
     double volume;
+    enum convo_filter_mode_e convo_filter_mode;
+    enum flow_mode_e flow_mode;
     bool use_cfd;
+    bool use_waveguide;
     bool use_convolution;
     bool can_ignite;
     bool use_plot_filter;
 };
 
+/* Steps add up profile clock ticks, each run turns them into milliseconds, so
+ * the per sample phases cost a time stamp read rather than a clock call.
+ */
+
 struct engine_time_s
 {
     double fluids_time_ms;
@@ -32,15 +74,42 @@ struct engine_time_s
     double thermo_time_ms;
     double synth_time_ms;
     double wave_time_ms;
+    uint64_t fluids_ticks;
+    uint64_t kinematics_ticks;
+    uint64_t thermo_ticks;
     double (*get_ticks_ms)();
 };
 
+/* Every eplenum owns one slot of the engine's wave table, so wave indices must
+ * cover 0 to eplenums - 1 exactly once.
+ */
+
 static void
 analyze_engine(struct engine_s* self)
 {
+    if(self->size > g_nodes_max_nodes)
+    {
+        fprintf(stderr, "error: engine has %lu nodes, limit is %lu\n", self->size, g_nodes_max_nodes);
+        exit(1);
+    }
+    size_t eplenums = count_nodes(self->node, self->size, g_is_eplenum);
+    bool* is_wave_used = calloc(eplenums + 1, sizeof(*is_wave_used));
+    if(is_wave_used == nullptr)
+    {
+        fprintf(stderr, "error: could not allocate %lu wave flags\n", eplenums);
+        exit(1);
+    }
     for(size_t i = 0; i < self->size; i++)
     {
         struct node_s* node = &self->node[i];
+        for(size_t next, j = 0; (next = node->next[j]); j++)
+        {
+            if(next >= self->size)
+            {
+                fprintf(stderr, "error: node[%lu] next[%lu] points past the last node\n", i, j);
+                exit(1);
+            }
+        }
         if(node->type == g_is_eplenum)
         {
             if(count_node_edges(node) != 1)
@@ -48,6 +117,18 @@ analyze_engine(struct engine_s* self)
                 fprintf(stderr, "error: eplenum[%lu] requires exactly one next[] edge\n", i);
                 exit(1);
             }
+            size_t wave_index = node->as.eplenum.wave_index;
+            if(wave_index >= eplenums)
+            {
+                fprintf(stderr, "error: eplenum[%lu] wave_index %lu is out of range for %lu eplenums\n", i, wave_index, eplenums);
+                exit(1);
+            }
+            if(is_wave_used[wave_index])
+            {
+                fprintf(stderr, "error: eplenum[%lu] shares wave_index %lu with another eplenum\n", i, wave_index);
+                exit(1);
+            }
+            is_wave_used[wave_index] = true;
         }
         if(node->type == g_is_injector)
         {
@@ -64,6 +145,74 @@ analyze_engine(struct engine_s* self)
             }
         }
     }
+    free(is_wave_used);
+}
+
+static void
+compile_engine_edges(struct engine_s* self)
+{
+    size_t edges = 0;
+    for(size_t i = 0; i < self->size; i++)
+    {
+        edges += count_node_edges(&self->node[i]);
+    }
+    free(self->edge);
+    self->edge = calloc(edges + 1, sizeof(*self->edge));
+    if(self->edge == nullptr)
+    {
+        fprintf(stderr, "error: could not allocate %lu engine edges\n", edges);
+        exit(1);
+    }
+    self->edges = 0;
+    for(size_t i = 0; i < self->size; i++)
+    {
+        struct node_s* x = &self->node[i];
+        for(size_t next, j = 0; (next = x->next[j]); j++)
+        {
+            self->edge[self->edges++] = (struct edge_s) {
+                .x = x,
+                .y = &self->node[next],
+                .x_index = i,
+                .y_index = next,
+                .wave_index = x->type == g_is_eplenum ? x->as.eplenum.wave_index : 0,
+                .x_momentum_damping_ratio = calc_momentum_damping_ratio(&x->as.chamber),
+                .y_momentum_damping_ratio = calc_momentum_damping_ratio(&self->node[next].as.chamber),
+                .is_from_reservoir = is_reservoir(x),
+                .is_eplenum = x->type == g_is_eplenum,
+            };
+        }
+    }
+}
+
+static void
+plan_engine_waves(struct engine_s* self)
+{
+    size_t eplenums = count_nodes(self->node, self->size, g_is_eplenum);
+    free(self->wave_job);
+    self->wave_job = calloc(eplenums + 1, sizeof(*self->wave_job));
+    if(self->wave_job == nullptr || plan_wave_table(&self->waves, eplenums, self->block_size) == false)
+    {
+        fprintf(stderr, "error: could not allocate %lu engine waves\n", eplenums);
+        exit(1);
+    }
+    reset_wave_table(&self->waves);
+}
+
+static void
+plan_engine_batch_flow(struct engine_s* self)
+{
+    struct batch_flow_s* batch_flow = &self->batch_flow;
+    if(plan_batch_flow(batch_flow, self->size, self->edges) == false)
+    {
+        fprintf(stderr, "error: could not allocate batched flow for %lu nodes\n", self->size);
+        exit(1);
+    }
+    for(size_t i = 0; i < self->edges; i++)
+    {
+        struct edge_s* edge = &self->edge[i];
+        schedule_batch_flow_edge(batch_flow, i, edge->x_index, edge->y_index);
+    }
+    order_batch_flow_waves(batch_flow);
 }
 
 static void
@@ -88,41 +237,88 @@ rig_engine_pistons(struct engine_s* self)
     }
 }
 
+/* Everything flow_engine does with an edge once its nozzle flow is known.
+ */
+
+static void
+mail_engine_edge(struct engine_s* self, struct sampler_s* sampler, struct edge_s* edge, struct nozzle_flow_s* nozzle_flow)
+{
+    if(edge->x->is_selected)
+    {
+        PROFILE_BEGIN(sampler);
+        sample_channel(sampler, edge->x, nozzle_flow, &self->crankshaft);
+        PROFILE_END(sampler);
+    }
+    nozzle_flow->gas_mail.is_from_reservoir = edge->is_from_reservoir;
+    if(nozzle_flow->is_success)
+    {
+        /* Flow swaps x and y when the gas runs backwards. */
+        bool is_forward = nozzle_flow->gas_mail.x == &edge->x->as.chamber;
+        nozzle_flow->gas_mail.x_momentum_damping_ratio = is_forward ? edge->x_momentum_damping_ratio : edge->y_momentum_damping_ratio;
+        nozzle_flow->gas_mail.y_momentum_damping_ratio = is_forward ? edge->y_momentum_damping_ratio : edge->x_momentum_damping_ratio;
+        mail_gas_mail(&nozzle_flow->gas_mail);
+    }
+    if(edge->is_eplenum)
+    {
+        struct wave_prim_s prim = {
+            .r = nozzle_flow->flow_field.static_density_kg_per_m3,
+            .u = nozzle_flow->flow_field.velocity_m_per_s,
+            .p = nozzle_flow->flow_field.static_pressure_pa,
+        };
+        stage_wave(&self->waves.wave[edge->wave_index], prim);
+    }
+}
+
 static void
 flow_engine(struct engine_s* self, struct sampler_s* sampler)
 {
-    for(size_t i = 0; i < self->size; i++)
+    for(size_t i = 0; i < self->edges; i++)
     {
-        struct node_s* x = &self->node[i];
-        for(size_t next, j = 0; (next = x->next[j]); j++)
+        struct edge_s* edge = &self->edge[i];
+        PROFILE_NODE_BEGIN();
+        struct nozzle_flow_s nozzle_flow = flow(&edge->x->as.chamber, &edge->y->as.chamber);
+        mail_engine_edge(self, sampler, edge, &nozzle_flow);
+        PROFILE_NODE_END(edge->x->type);
+    }
+}
+
+/* Wave by wave alternative to flow_engine; see batch_flow_s.h. Edges that share
+ * a chamber, an exhaust plenum's staged wave included, are still stepped in the
+ * order flow_engine steps them. Selected nodes on different chambers are not,
+ * so each one samples into the channel flow_engine would have given it.
+ */
+
+static void
+flow_engine_batched(struct engine_s* self, struct sampler_s* sampler)
+{
+    struct batch_flow_s* batch_flow = &self->batch_flow;
+    size_t channels = 0;
+    for(size_t i = 0; i < self->edges; i++)
+    {
+        batch_flow->edge_channel[i] = channels;
+        channels += self->edge[i].x->is_selected;
+    }
+    for(size_t wave = 0; wave < batch_flow->waves; wave++)
+    {
+        size_t begin = batch_flow->wave_start[wave];
+        size_t end = batch_flow->wave_start[wave + 1];
+        for(size_t i = begin; i < end; i++)
         {
-            struct node_s* y = &self->node[next];
-            struct nozzle_flow_s nozzle_flow = flow(&x->as.chamber, &y->as.chamber);
-            if(x->is_selected)
-            {
-                sample_channel(sampler, x, &nozzle_flow, &self->crankshaft);
-            }
-            if(is_reservoir(x))
-            {
-                nozzle_flow.gas_mail.is_from_reservoir = true;
-            }
-            if(nozzle_flow.is_success)
-            {
-                mail_gas_mail(&nozzle_flow.gas_mail);
-            }
-            if(x->type == g_is_eplenum)
-            {
-                struct eplenum_s* eplenum = &x->as.eplenum;
-                size_t wave_index = eplenum->wave_index;
-                struct wave_prim_s prim = {
-                    .r = nozzle_flow.flow_field.static_density_kg_per_m3,
-                    .u = nozzle_flow.flow_field.velocity_m_per_s,
-                    .p = nozzle_flow.flow_field.static_pressure_pa,
-                };
-                stage_wave(wave_index, prim);
-            }
+            struct edge_s* edge = &self->edge[batch_flow->wave_edge[i]];
+            load_batch_flow_lane(batch_flow, i - begin, &edge->x->as.chamber, &edge->y->as.chamber);
+        }
+        flow_batch_lanes(batch_flow, end - begin);
+        for(size_t i = begin; i < end; i++)
+        {
+            struct edge_s* edge = &self->edge[batch_flow->wave_edge[i]];
+            PROFILE_NODE_BEGIN();
+            struct nozzle_flow_s nozzle_flow = get_batch_nozzle_flow(batch_flow, i - begin, &edge->x->as.chamber, &edge->y->as.chamber);
+            sampler->channel_index = batch_flow->edge_channel[batch_flow->wave_edge[i]];
+            mail_engine_edge(self, sampler, edge, &nozzle_flow);
+            PROFILE_NODE_END(edge->x->type);
         }
     }
+    sampler->channel_index = channels < g_sampler_max_channels ? channels : g_sampler_max_channels;
 }
 
 static double
@@ -163,8 +359,10 @@ calc_engine_moment_of_inertia_kg_m2(struct engine_s* self)
 static void
 crank_engine(struct engine_s* self, struct sampler_s* sampler)
 {
-    double torque_n_m = calc_engine_torque_n_m(self);
     double moment_of_inertia_kg_m2 = calc_engine_moment_of_inertia_kg_m2(self);
+    double torque_n_m = calc_engine_torque_n_m(self);
+    torque_n_m += calc_dyno_torque_n_m(&self->dyno, &self->crankshaft, moment_of_inertia_kg_m2);
+    integrate_dyno(&self->dyno, &self->crankshaft);
     double angular_acceleration_r_per_s2 = torque_n_m / moment_of_inertia_kg_m2;
     accelerate_crankshaft(&self->crankshaft, angular_acceleration_r_per_s2);
     double theta_0_r = self->crankshaft.theta_r;
@@ -286,19 +484,48 @@ enable_engine_cfd(struct engine_s* self, bool use_cfd)
     }
 }
 
+/* Only plenums with a waveguide network switch; the rest keep the solver.
+ */
+
+static void
+enable_engine_waveguide(struct engine_s* self, bool use_waveguide)
+{
+    self->use_waveguide = use_waveguide;
+    for(size_t i = 0; i < self->size; i++)
+    {
+        struct node_s* node = &self->node[i];
+        if(node->type == g_is_eplenum)
+        {
+            node->as.eplenum.use_waveguide = use_waveguide;
+        }
+    }
+}
+
 static void
 reset_engine(struct engine_s* self)
 {
     analyze_engine(self);
+    compile_engine_edges(self);
+    plan_engine_batch_flow(self);
     enable_engine_cfd(self, true);
+    enable_engine_waveguide(self, true);
     self->use_convolution = true;
+    self->convo_filter_mode = g_convo_filter_mode_uniform;
+    self->flow_mode = g_flow_mode_sequential;
     self->use_plot_filter = true;
     self->starter.is_on = false;
+    self->dyno.is_on = false;
     self->throttle_open_ratio = 0.01;
-    reset_all_waves();
+    self->panic_message = nullptr;
+    if(self->block_size == 0)
+    {
+        self->block_size = g_synth_buffer_size;
+    }
+    plan_engine_waves(self);
     rig_engine_pistons(self);
     normalize_engine(self);
     select_nodes(self->node, self->size, g_is_piston);
+    get_profile_ticks_per_s(); // calibrates once, here rather than in the first block
 }
 
 static void
@@ -309,7 +536,7 @@ flip_engine_waves(struct engine_s* self)
         struct node_s* node = &self->node[i];
         if(node->type == g_is_eplenum)
         {
-            flip_wave(node->as.eplenum.wave_index);
+            flip_wave(&self->waves.wave[node->as.eplenum.wave_index]);
         }
     }
 }
@@ -317,39 +544,54 @@ flip_engine_waves(struct engine_s* self)
 static void
 launch_engine_waves(struct engine_s* self)
 {
+    size_t jobs = 0;
     for(size_t i = 0; i < self->size; i++)
     {
         struct node_s* node = &self->node[i];
         if(node->type == g_is_eplenum)
         {
-            launch_eplenum_wave_thread(&node->as.eplenum);
+            struct eplenum_s* eplenum = &node->as.eplenum;
+            self->wave_job[jobs++] = get_eplenum_wave_job(eplenum, &self->waves.wave[eplenum->wave_index]);
         }
     }
+    post_wave_jobs(self->wave_job, jobs, &self->wave_fence);
 }
 
 static void
 wait_for_engine_waves(struct engine_s* self)
 {
-    for(size_t i = 0; i < self->size; i++)
+    wait_for_wave_fence(&self->wave_fence);
+}
+
+/* Smaller blocks cut latency but pay the per block costs, the wave jobs and the
+ * synth filters, more often. Takes effect from the next run. If the new blocks
+ * cannot be allocated the engine keeps its old size.
+ */
+
+static bool
+resize_engine_block(struct engine_s* self, size_t block_size)
+{
+    block_size = clamp(block_size, g_synth_min_block_size, g_synth_max_block_size);
+    wait_for_engine_waves(self);
+    if(plan_wave_table_block(&self->waves, block_size) == false)
     {
-        struct node_s* node = &self->node[i];
-        if(node->type == g_is_eplenum)
-        {
-            wait_for_eplenum_wave_thread(&node->as.eplenum);
-        }
+        fprintf(stderr, "error: could not allocate %lu sample engine blocks\n", block_size);
+        return false;
     }
+    self->block_size = block_size;
+    return true;
 }
 
 static void
 sum_engine_waves(struct engine_s* self)
 {
-    clear_wave_buffer();
+    clear_wave_buffer(&self->waves);
     for(size_t i = 0; i < self->size; i++)
     {
         struct node_s* node = &self->node[i];
         if(node->type == g_is_eplenum)
         {
-            add_to_wave_buffer(node->as.eplenum.wave_index);
+            add_to_wave_buffer(&self->waves, &self->waves.wave[node->as.eplenum.wave_index]);
         }
     }
 }
@@ -358,9 +600,25 @@ static void
 push_engine_wave_buffer_to_synth(struct engine_s* self, struct synth_s* synth, sampler_synth_t sampler_synth)
 {
     sum_engine_waves(self);
-    for(size_t i = 0; i < g_synth_buffer_size; i++)
+    double* buffer_pa = self->waves.buffer_pa;
+    size_t size = self->block_size;
+    if(synth->out == nullptr && plan_synth(synth, size) == false)
+    {
+        fprintf(stderr, "error: could not allocate %lu synth samples\n", size);
+        exit(1);
+    }
+    PROFILE_BEGIN(convolution);
+    PERF_BEGIN(convolution);
+    const char* error = filter_synth(synth, buffer_pa, size, self->use_convolution, self->convo_filter_mode, self->impulse, self->impulse_size);
+    PERF_END(convolution);
+    PROFILE_END(convolution);
+    if(error)
+    {
+        self->panic_message = error;
+    }
+    for(size_t i = 0; i < size; i++)
     {
-        sampler_synth[i] = push_synth(synth, &self->crankshaft, g_wave_buffer_pa[i], self->use_convolution, self->volume);
+        sampler_synth[i] = push_synth(synth, &self->crankshaft, buffer_pa[i], self->volume);
     }
 }
 
@@ -370,24 +628,64 @@ step_engine(
     struct engine_time_s* engine_time,
     struct sampler_s* sampler)
 {
+    PROFILE_BEGIN(step);
     reset_sampler_channel(sampler);
-    double t0 = engine_time->get_ticks_ms();
-    flow_engine(self, sampler);
-    double t1 = engine_time->get_ticks_ms();
+    uint64_t t0 = read_profile_ticks();
+    PROFILE_BEGIN(flow);
+    PERF_BEGIN(flow);
+    if(self->flow_mode == g_flow_mode_batched)
+    {
+        flow_engine_batched(self, sampler);
+    }
+    else
+    {
+        flow_engine(self, sampler);
+    }
+    PERF_END(flow);
+    PROFILE_END(flow);
+    uint64_t t1 = read_profile_ticks();
+    PERF_BEGIN(kinematics);
+    PROFILE_BEGIN(crank);
     crank_engine(self, sampler);
+    PROFILE_END(crank);
+    PROFILE_BEGIN(compress);
     compress_engine_pistons(self);
+    PROFILE_END(compress);
+    PROFILE_BEGIN(valves);
     update_engine_nozzle_open_ratios(self);
+    PROFILE_END(valves);
     double starter_angular_velocity_r_per_s = calc_starter_angular_velocity_r_per_s(&self->starter, &self->flywheel, &self->crankshaft);
     sample_starter(sampler, starter_angular_velocity_r_per_s);
-    double t2 = engine_time->get_ticks_ms();
+    PERF_END(kinematics);
+    uint64_t t2 = read_profile_ticks();
+    PROFILE_BEGIN(combust);
+    PERF_BEGIN(thermo);
     if(self->can_ignite)
     {
         combust_engine_piston_chambers(self);
     }
-    double t3 = engine_time->get_ticks_ms();
-    engine_time->fluids_time_ms += t1 - t0;
-    engine_time->kinematics_time_ms += t2 - t1;
-    engine_time->thermo_time_ms += t3 - t2;
+    PERF_END(thermo);
+    PROFILE_END(combust);
+    uint64_t t3 = read_profile_ticks();
+    engine_time->fluids_ticks += t1 - t0;
+    engine_time->kinematics_ticks += t2 - t1;
+    engine_time->thermo_ticks += t3 - t2;
+    PROFILE_END(step);
+}
+
+/* Chambers only flag themselves, once per block is soon enough to say why.
+ */
+
+static void
+check_engine_chambers(struct engine_s* self)
+{
+    for(size_t i = 0; self->panic_message == nullptr && i < self->size; i++)
+    {
+        if(self->node[i].as.chamber.should_panic)
+        {
+            self->panic_message = "negative chamber mass detected";
+        }
+    }
 }
 
 static void
@@ -403,13 +701,18 @@ run_engine_with_waves(
     {
         flip_engine_waves(self);
         launch_engine_waves(self);
-        for(size_t i = 0; i < g_synth_buffer_size; i++)
+        for(size_t i = 0; i < self->block_size; i++)
         {
             step_engine(self, engine_time, sampler);
         }
+        check_engine_chambers(self);
+        PROFILE_BEGIN(wave_wait);
         wait_for_engine_waves(self);
+        PROFILE_END(wave_wait);
         double t1 = engine_time->get_ticks_ms();
+        PROFILE_BEGIN(synth);
         push_engine_wave_buffer_to_synth(self, synth, sampler_synth);
+        PROFILE_END(synth);
         double t2 = engine_time->get_ticks_ms();
         engine_time->synth_time_ms = t2 - t1;
     }
@@ -424,8 +727,17 @@ run_engine(
     size_t audio_buffer_size,
     sampler_synth_t sampler_synth)
 {
+    PROFILE_BEGIN(block);
     double t0 = engine_time->get_ticks_ms();
     run_engine_with_waves(self, engine_time, sampler, synth, audio_buffer_size, sampler_synth);
     double t3 = engine_time->get_ticks_ms();
     engine_time->wave_time_ms += t3 - t0;
+    engine_time->fluids_time_ms += calc_profile_ms(engine_time->fluids_ticks);
+    engine_time->kinematics_time_ms += calc_profile_ms(engine_time->kinematics_ticks);
+    engine_time->thermo_time_ms += calc_profile_ms(engine_time->thermo_ticks);
+    engine_time->fluids_ticks = 0;
+    engine_time->kinematics_ticks = 0;
+    engine_time->thermo_ticks = 0;
+    PERF_FLUSH();
+    PROFILE_END(block);
 }
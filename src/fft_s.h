@@ -0,0 +1,253 @@
+/*
+ * Mixed radix complex fast fourier transform (decimation in time).
+ *
+ * Sizes are factored into radix 4, 2 and 3 butterflies, with any other
+ * prime factor falling back to a generic O(p^2) butterfly, so transform
+ * sizes tied to the synth block (eg. 2 * 800 = 4 * 4 * 4 * 5 * 5) work
+ * without padding to a power of two.
+ *
+ * Forward and inverse plans are separate; the inverse is unscaled.
+ */
+
+constexpr size_t g_fft_max_factors = 32;
+
+struct fft_complex_s
+{
+    double re;
+    double im;
+};
+
+struct fft_s
+{
+    size_t size;
+    bool is_inverse;
+    size_t factors[2 * g_fft_max_factors];
+    struct fft_complex_s* twiddle;
+    struct fft_complex_s* scratch;
+};
+
+static struct fft_complex_s
+mul_fft_complex(struct fft_complex_s a, struct fft_complex_s b)
+{
+    return (struct fft_complex_s) {
+        .re = a.re * b.re - a.im * b.im,
+        .im = a.re * b.im + a.im * b.re,
+    };
+}
+
+static struct fft_complex_s
+add_fft_complex(struct fft_complex_s a, struct fft_complex_s b)
+{
+    return (struct fft_complex_s) { .re = a.re + b.re, .im = a.im + b.im };
+}
+
+static struct fft_complex_s
+sub_fft_complex(struct fft_complex_s a, struct fft_complex_s b)
+{
+    return (struct fft_complex_s) { .re = a.re - b.re, .im = a.im - b.im };
+}
+
+static void
+clear_fft_complex(struct fft_complex_s* self, size_t size)
+{
+    memset(self, 0, size * sizeof(*self));
+}
+
+/* Writes (radix, remaining size) pairs, preferring radix 4, then 2, then odd primes.
+ */
+
+static bool
+factor_fft(struct fft_s* self)
+{
+    size_t n = self->size;
+    size_t p = 4;
+    size_t count = 0;
+    do
+    {
+        while(n % p)
+        {
+            p = p == 4 ? 2 : p == 2 ? 3 : p + 2;
+            if(p * p > n)
+            {
+                p = n;
+            }
+        }
+        if(count == g_fft_max_factors)
+        {
+            return false;
+        }
+        n /= p;
+        self->factors[2 * count + 0] = p;
+        self->factors[2 * count + 1] = n;
+        count++;
+    }
+    while(n > 1);
+    return true;
+}
+
+static void
+free_fft(struct fft_s* self)
+{
+    free(self->twiddle);
+    free(self->scratch);
+    *self = (struct fft_s) {};
+}
+
+static bool
+plan_fft(struct fft_s* self, size_t size, bool is_inverse)
+{
+    free_fft(self);
+    self->size = size;
+    self->is_inverse = is_inverse;
+    if(size == 0 || factor_fft(self) == false)
+    {
+        return false;
+    }
+    self->twiddle = calloc(size, sizeof(*self->twiddle));
+    self->scratch = calloc(size, sizeof(*self->scratch));
+    if(self->twiddle == nullptr || self->scratch == nullptr)
+    {
+        free_fft(self);
+        return false;
+    }
+    double sign = is_inverse ? 1.0 : -1.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        double phase_r = sign * 2.0 * g_std_pi_r * i / size;
+        self->twiddle[i] = (struct fft_complex_s) { .re = cos(phase_r), .im = sin(phase_r) };
+    }
+    return true;
+}
+
+static void
+butterfly_fft_2(struct fft_s* self, struct fft_complex_s* out, size_t stride, size_t m)
+{
+    struct fft_complex_s* a = out;
+    struct fft_complex_s* b = out + m;
+    for(size_t k = 0; k < m; k++)
+    {
+        struct fft_complex_s t = mul_fft_complex(b[k], self->twiddle[k * stride]);
+        b[k] = sub_fft_complex(a[k], t);
+        a[k] = add_fft_complex(a[k], t);
+    }
+}
+
+static void
+butterfly_fft_3(struct fft_s* self, struct fft_complex_s* out, size_t stride, size_t m)
+{
+    double epi3_im = self->twiddle[stride * m].im;
+    for(size_t k = 0; k < m; k++)
+    {
+        struct fft_complex_s* f = out + k;
+        struct fft_complex_s s1 = mul_fft_complex(f[m], self->twiddle[k * stride]);
+        struct fft_complex_s s2 = mul_fft_complex(f[2 * m], self->twiddle[2 * k * stride]);
+        struct fft_complex_s s3 = add_fft_complex(s1, s2);
+        struct fft_complex_s s0 = sub_fft_complex(s1, s2);
+        f[m].re = f[0].re - 0.5 * s3.re;
+        f[m].im = f[0].im - 0.5 * s3.im;
+        s0.re *= epi3_im;
+        s0.im *= epi3_im;
+        f[0] = add_fft_complex(f[0], s3);
+        f[2 * m].re = f[m].re + s0.im;
+        f[2 * m].im = f[m].im - s0.re;
+        f[m].re -= s0.im;
+        f[m].im += s0.re;
+    }
+}
+
+static void
+butterfly_fft_4(struct fft_s* self, struct fft_complex_s* out, size_t stride, size_t m)
+{
+    for(size_t k = 0; k < m; k++)
+    {
+        struct fft_complex_s* f = out + k;
+        struct fft_complex_s s0 = mul_fft_complex(f[1 * m], self->twiddle[1 * k * stride]);
+        struct fft_complex_s s1 = mul_fft_complex(f[2 * m], self->twiddle[2 * k * stride]);
+        struct fft_complex_s s2 = mul_fft_complex(f[3 * m], self->twiddle[3 * k * stride]);
+        struct fft_complex_s s5 = sub_fft_complex(f[0], s1);
+        f[0] = add_fft_complex(f[0], s1);
+        struct fft_complex_s s3 = add_fft_complex(s0, s2);
+        struct fft_complex_s s4 = sub_fft_complex(s0, s2);
+        f[2 * m] = sub_fft_complex(f[0], s3);
+        f[0] = add_fft_complex(f[0], s3);
+        if(self->is_inverse)
+        {
+            f[1 * m] = (struct fft_complex_s) { .re = s5.re - s4.im, .im = s5.im + s4.re };
+            f[3 * m] = (struct fft_complex_s) { .re = s5.re + s4.im, .im = s5.im - s4.re };
+        }
+        else
+        {
+            f[1 * m] = (struct fft_complex_s) { .re = s5.re + s4.im, .im = s5.im - s4.re };
+            f[3 * m] = (struct fft_complex_s) { .re = s5.re - s4.im, .im = s5.im + s4.re };
+        }
+    }
+}
+
+static void
+butterfly_fft_generic(struct fft_s* self, struct fft_complex_s* out, size_t stride, size_t m, size_t p)
+{
+    struct fft_complex_s* scratch = self->scratch;
+    for(size_t u = 0; u < m; u++)
+    {
+        for(size_t q = 0, k = u; q < p; q++, k += m)
+        {
+            scratch[q] = out[k];
+        }
+        for(size_t q = 0, k = u; q < p; q++, k += m)
+        {
+            size_t twiddle_index = 0;
+            out[k] = scratch[0];
+            for(size_t j = 1; j < p; j++)
+            {
+                twiddle_index += stride * k;
+                twiddle_index %= self->size;
+                out[k] = add_fft_complex(out[k], mul_fft_complex(scratch[j], self->twiddle[twiddle_index]));
+            }
+        }
+    }
+}
+
+static void
+work_fft(struct fft_s* self, struct fft_complex_s* out, const struct fft_complex_s* in, size_t stride, const size_t* factors)
+{
+    size_t p = factors[0];
+    size_t m = factors[1];
+    if(m == 1)
+    {
+        for(size_t i = 0; i < p; i++)
+        {
+            out[i] = in[i * stride];
+        }
+    }
+    else
+    {
+        for(size_t i = 0; i < p; i++)
+        {
+            work_fft(self, out + i * m, in + i * stride, stride * p, factors + 2);
+        }
+    }
+    switch(p)
+    {
+    case 2:
+        butterfly_fft_2(self, out, stride, m);
+        break;
+    case 3:
+        butterfly_fft_3(self, out, stride, m);
+        break;
+    case 4:
+        butterfly_fft_4(self, out, stride, m);
+        break;
+    default:
+        butterfly_fft_generic(self, out, stride, m, p);
+        break;
+    }
+}
+
+/* The input and output buffers must not overlap.
+ */
+
+static void
+run_fft(struct fft_s* self, const struct fft_complex_s* in, struct fft_complex_s* out)
+{
+    work_fft(self, out, in, 1, self->factors);
+}
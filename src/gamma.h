@@ -1,12 +1,4 @@
 constexpr double g_gamma_universal_gas_constant_j_per_mol_k = 8.3144598;
-constexpr size_t g_gamma_cp_precompute_buffer_size = 8192;
-
-static double g_cp_n2_j_per_mol_k[g_gamma_cp_precompute_buffer_size] = {};
-static double g_cp_o2_j_per_mol_k[g_gamma_cp_precompute_buffer_size] = {};
-static double g_cp_ar_j_per_mol_k[g_gamma_cp_precompute_buffer_size] = {};
-static double g_cp_c8h18_j_per_mol_k[g_gamma_cp_precompute_buffer_size] = {};
-static double g_cp_co2_j_per_mol_k[g_gamma_cp_precompute_buffer_size] = {};
-static double g_cp_h2o_j_per_mol_k[g_gamma_cp_precompute_buffer_size] = {};
 
 /* iso-octane 2,2,4-trimethylpentane (of gasoline), [1, p. 103] */
 constexpr double g_gamma_cp_weights_lower_c8h18[] = {
@@ -112,20 +104,6 @@ calc_cp_h2o_j_per_mol_k(double static_temperature_k)
     return calc_cp_j_per_mol_k(static_temperature_k, g_gamma_cp_weights_lower_h2o, g_gamma_cp_weights_upper_h2o);
 }
 
-static void
-precompute_cp()
-{
-    for(size_t i = 0; i < g_gamma_cp_precompute_buffer_size; i++)
-    {
-        g_cp_n2_j_per_mol_k[i] = calc_cp_n2_j_per_mol_k(i);
-        g_cp_o2_j_per_mol_k[i] = calc_cp_o2_j_per_mol_k(i);
-        g_cp_ar_j_per_mol_k[i] = calc_cp_ar_j_per_mol_k(i);
-        g_cp_c8h18_j_per_mol_k[i] = calc_cp_c8h18_j_per_mol_k(i);
-        g_cp_co2_j_per_mol_k[i] = calc_cp_co2_j_per_mol_k(i);
-        g_cp_h2o_j_per_mol_k[i] = calc_cp_h2o_j_per_mol_k(i);
-    }
-}
-
 /*
  *
  * cv = cp - R
@@ -138,40 +116,107 @@ calc_cv_j_per_mol_k(double cp_j_per_mol_k)
     return cp_j_per_mol_k - g_gamma_universal_gas_constant_j_per_mol_k;
 }
 
+/* The polynomials above are the reference. The simulation reads g_cp_table, generated
+ * from them by tools/gen_cp_table.py: one row per whole kelvin, so the row is the
+ * truncated temperature. It is clamped while still a double, as truncating one out of
+ * the integer's range is undefined; a NaN fails the first compare and takes row 0.
+ */
+
+static const struct cp_table_row_s*
+find_cp_table_row(double static_temperature_k)
+{
+    double T = static_temperature_k > 0.0 ? static_temperature_k : 0.0;
+    T = T < g_cp_table_size - 1.0 ? T : g_cp_table_size - 1.0;
+    size_t i = T;
+    return &g_cp_table[i];
+}
+
+static double
+lookup_cp_j_per_mol_k(double static_temperature_k, enum cp_species_e species)
+{
+    return find_cp_table_row(static_temperature_k)->cp_j_per_mol_k[species];
+}
+
+static double
+lookup_cp_n2_j_per_mol_k(double static_temperature_k)
+{
+    return lookup_cp_j_per_mol_k(static_temperature_k, g_cp_species_n2);
+}
+
+static double
+lookup_cp_o2_j_per_mol_k(double static_temperature_k)
+{
+    return lookup_cp_j_per_mol_k(static_temperature_k, g_cp_species_o2);
+}
+
 static double
-lookup_cp_n2_j_per_mol_k(size_t static_temperature_k)
+lookup_cp_ar_j_per_mol_k(double static_temperature_k)
 {
-    return g_cp_n2_j_per_mol_k[static_temperature_k];
+    return lookup_cp_j_per_mol_k(static_temperature_k, g_cp_species_ar);
 }
 
 static double
-lookup_cp_o2_j_per_mol_k(size_t static_temperature_k)
+lookup_cp_c8h18_j_per_mol_k(double static_temperature_k)
 {
-    return g_cp_o2_j_per_mol_k[static_temperature_k];
+    return lookup_cp_j_per_mol_k(static_temperature_k, g_cp_species_c8h18);
 }
 
 static double
-lookup_cp_ar_j_per_mol_k(size_t static_temperature_k)
+lookup_cp_co2_j_per_mol_k(double static_temperature_k)
 {
-    return g_cp_ar_j_per_mol_k[static_temperature_k];
+    return lookup_cp_j_per_mol_k(static_temperature_k, g_cp_species_co2);
 }
 
 static double
-lookup_cp_c8h18_j_per_mol_k(size_t static_temperature_k)
+lookup_cp_h2o_j_per_mol_k(double static_temperature_k)
 {
-    return g_cp_c8h18_j_per_mol_k[static_temperature_k];
+    return lookup_cp_j_per_mol_k(static_temperature_k, g_cp_species_h2o);
 }
 
+/* One row is one cache line, and the mol ratios are read in place from the caller,
+ * so the mix is a vector multiply of the row by the ratios and a horizontal add.
+ *
+ *        __
+ * cp =  \   x  cp
+ *       /__   i   i
+ */
+
 static double
-lookup_cp_co2_j_per_mol_k(size_t static_temperature_k)
+lookup_mixed_cp_j_per_mol_k(double static_temperature_k, const double mol_ratio[g_cp_species_e_size])
 {
-    return g_cp_co2_j_per_mol_k[static_temperature_k];
+    const double* cp = find_cp_table_row(static_temperature_k)->cp_j_per_mol_k;
+    double mixed_cp = 0.0;
+    for(size_t species = 0; species < g_cp_species_e_size; species++)
+    {
+        mixed_cp += mol_ratio[species] * cp[species];
+    }
+    return mixed_cp;
 }
 
+/* Largest relative error of the table against the polynomials, sampled inside the
+ * rows, to validate a regenerated cp_table.h.
+ */
+
 static double
-lookup_cp_h2o_j_per_mol_k(size_t static_temperature_k)
+calc_cp_table_max_error()
 {
-    return g_cp_h2o_j_per_mol_k[static_temperature_k];
+    double error = 0.0;
+    for(double T = 0.0; T < g_cp_table_size - 1; T += 0.37)
+    {
+        double exact[g_cp_species_e_size] = {
+            [g_cp_species_n2] = calc_cp_n2_j_per_mol_k(T),
+            [g_cp_species_o2] = calc_cp_o2_j_per_mol_k(T),
+            [g_cp_species_ar] = calc_cp_ar_j_per_mol_k(T),
+            [g_cp_species_c8h18] = calc_cp_c8h18_j_per_mol_k(T),
+            [g_cp_species_co2] = calc_cp_co2_j_per_mol_k(T),
+            [g_cp_species_h2o] = calc_cp_h2o_j_per_mol_k(T),
+        };
+        for(size_t species = 0; species < g_cp_species_e_size; species++)
+        {
+            error = max(error, fabs(lookup_cp_j_per_mol_k(T, species) / exact[species] - 1.0));
+        }
+    }
+    return error;
 }
 
 /*
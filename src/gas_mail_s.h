@@ -1,8 +1,14 @@
+/* Flow fills in the gas and the chambers; the reservoir flag and the damping
+ * ratios of x and y are constants of the edge, filled in by whoever steps it.
+ */
+
 struct gas_mail_s
 {
     struct gas_s gas;
     struct chamber_s* x;
     struct chamber_s* y;
+    double x_momentum_damping_ratio;
+    double y_momentum_damping_ratio;
     bool is_from_reservoir;
 };
 
@@ -11,10 +17,10 @@ mail_gas_mail(struct gas_mail_s* self)
 {
     if(self->is_from_reservoir == false)
     {
-        remove_gas(self->x, &self->gas);
+        remove_gas(self->x, &self->gas, self->x_momentum_damping_ratio);
         clamp_momentum(&self->x->gas);
     }
-    mix_in_gas(self->y, &self->gas);
+    mix_in_gas(self->y, &self->gas, self->y_momentum_damping_ratio);
     clamp_momentum(&self->y->gas);
     self->x->flow_cycles++;
 }
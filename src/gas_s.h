@@ -9,14 +9,24 @@ constexpr double g_gas_ambient_static_temperature_k = 300.0;
 constexpr double g_gas_ambient_static_pressure_pa = 101325.0;
 constexpr double g_gas_ambient_static_density_kg_per_m3 = 1.225;
 
+/* The mol ratios are laid out in cp_table lane order, so the cp mix reads them as one array.
+ */
+
 struct gas_s
 {
-    double mol_ratio_n2;
-    double mol_ratio_o2;
-    double mol_ratio_ar;
-    double mol_ratio_c8h18;
-    double mol_ratio_co2;
-    double mol_ratio_h2o;
+    union
+    {
+        struct
+        {
+            double mol_ratio_n2;
+            double mol_ratio_o2;
+            double mol_ratio_ar;
+            double mol_ratio_c8h18;
+            double mol_ratio_co2;
+            double mol_ratio_h2o;
+        };
+        double mol_ratio[g_cp_species_e_size];
+    };
     double static_temperature_k;
     double mass_kg;
     double momentum_kg_m_per_s;
@@ -70,13 +80,7 @@ calc_mixed_molar_mass_kg_per_mol(struct gas_s* self)
 static double
 calc_mixed_cp_j_per_mol_k(struct gas_s* self)
 {
-    return
-        self->mol_ratio_n2 * lookup_cp_n2_j_per_mol_k(self->static_temperature_k) +
-        self->mol_ratio_o2 * lookup_cp_o2_j_per_mol_k(self->static_temperature_k) +
-        self->mol_ratio_ar * lookup_cp_ar_j_per_mol_k(self->static_temperature_k) +
-        self->mol_ratio_c8h18 * lookup_cp_c8h18_j_per_mol_k(self->static_temperature_k) +
-        self->mol_ratio_co2 * lookup_cp_co2_j_per_mol_k(self->static_temperature_k) +
-        self->mol_ratio_h2o * lookup_cp_h2o_j_per_mol_k(self->static_temperature_k);
+    return lookup_mixed_cp_j_per_mol_k(self->static_temperature_k, self->mol_ratio);
 }
 
 static double
@@ -8,14 +8,20 @@
  *   aquí declaramos variables globales mutables que el loop principal puede
  *   actualizar en cualquier momento leyendo el JSON.
  *
- *   Los nodos del motor (g_hr_nodes[]) se reconstruyen desde cero con los nuevos
- *   valores cada vez que el JSON cambia, y luego se hace apuntar g_engine a ellos.
+ *   Los nodos del motor (hr->nodes[]) se reconstruyen desde cero con los nuevos
+ *   valores cada vez que el JSON cambia, y luego se hace apuntar el engine a ellos.
+ *
+ *   Todo el estado vive en un hr_state_t por motor (parámetros, nodos, impulso,
+ *   archivo vigilado), así un proceso puede cargar varios motores a la vez.
+ *   El hr_state_t tiene que vivir tanto como el engine que apunta a él.
  *
  * USO EN main.c:
  *   1. #include "hotreload_engine.h"   (en lugar o además de engine_3_cyl.h)
- *   2. Inicializar: hr_init("configs/engine_current.json");
- *   3. En el loop: hr_tick() -- detecta cambios y recarga si hace falta.
- *   4. hr_apply_to_engine(&g_engine) -- apunta g_engine a los nodos nuevos.
+ *   2. static hr_state_t g_hr_state = {};
+ *   3. Inicializar: hr_init(&g_hr_state, "configs/engine_current.json", &g_engine);
+ *   4. En el loop: hr_tick(&g_hr_state, &g_engine) -- detecta cambios y recarga.
+ *      Con el motor en otro hilo: hr_poll() en el de la UI y hr_reload() en el
+ *      del motor.
  *
  * PARÁMETROS HOT-RELOADABLES (sin recompilar):
  *   - sound_volume
@@ -29,6 +35,7 @@
  *     injector_volume_m3, erunner_volume_m3, eplenum_volume_m3,
  *     exhaust_volume_m3, max_flow_area_m2
  *   - topología de nodos completa (array "nodes" en el JSON)
+ *   - red waveguide del escape ("waveguide", global o por eplenum)
  */
 
 #pragma once
@@ -42,7 +49,7 @@
 // ─────────────────────────────────────────────────────────────
 // Límites
 // ─────────────────────────────────────────────────────────────
-#define HR_MAX_NODES      64
+#define HR_MAX_NODES      1024
 #define HR_MAX_CYLINDERS  16
 #define HR_MAX_CONNECTIONS 16
 
@@ -105,6 +112,9 @@ typedef struct {
     //   de entrar al CFD. Más bajo = más suave y grave. 1500-3000 para autos,
     //   4000-7000 para motos.
     double default_velocity_low_pass_hz;
+    // waveguide: red de tubos para el modo waveguide (ver waveguide_s.h).
+    //   Con pipes > 0 reemplaza al CFD en cada eplenum que no traiga la suya.
+    struct waveguide_desc_s default_waveguide;
 
     // ── Timing de válvulas e ignición ────────────────────────
     // Expresados en radianes relativos al TDC del pistón.
@@ -147,17 +157,21 @@ typedef struct {
     double pipe_length_m;          // -1 = usar default_pipe_length_m
     double mic_position_ratio;     // -1 = usar default_mic_position_ratio
     double velocity_low_pass_hz;   // -1 = usar default_velocity_low_pass_hz
+    struct waveguide_desc_s waveguide; // pipes = 0 = usar default_waveguide
 } hr_node_desc_t;
 
 // ─────────────────────────────────────────────────────────────
-// Estado interno del hot-reloader
+// Estado del hot-reloader (uno por motor)
 // ─────────────────────────────────────────────────────────────
-static hr_params_t     g_hr_params  = {};
-static hr_node_desc_t  g_hr_desc[HR_MAX_NODES] = {};
-static int             g_hr_num_nodes = 0;
-static struct node_s   g_hr_nodes[HR_MAX_NODES] = {};   // nodos reconstruidos
-static char            g_hr_filepath[512] = {};
-static long            g_hr_last_filesize = -1;
+typedef struct {
+    hr_params_t     params;
+    hr_node_desc_t  desc[HR_MAX_NODES];
+    int             num_nodes;
+    struct node_s   nodes[HR_MAX_NODES];   // nodos reconstruidos
+    char            filepath[512];
+    long            last_filesize;         // -1 = nunca visto
+    long            last_mtime;
+} hr_state_t;
 
 // ─────────────────────────────────────────────────────────────
 // Valores por defecto de los parámetros de válvulas / ignición
@@ -204,12 +218,12 @@ hr_make_chamber(double vol, double area, double tau)
 }
 
 // ─────────────────────────────────────────────────────────────
-// Construcción de nodos desde g_hr_desc[] y g_hr_params
+// Construcción de nodos desde hr->desc[] y hr->params
 // ─────────────────────────────────────────────────────────────
 static void
-hr_build_nodes(void)
+hr_build_nodes(hr_state_t* hr)
 {
-    hr_params_t* p = &g_hr_params;
+    hr_params_t* p = &hr->params;
     double max_a = p->max_flow_area_m2;
     double src_vol = p->source_sink_volume_m3;
     double tau = p->gas_damping_tau_s > 0.0 ? p->gas_damping_tau_s : HR_GAS_DAMPING_TAU_S;
@@ -229,16 +243,16 @@ hr_build_nodes(void)
 
     double head_clr  = p->piston_head_clearance_m > 0.0 ? p->piston_head_clearance_m  : HR_PISTON_HEAD_CLEARANCE_M;
 
-    memset(g_hr_nodes, 0, sizeof(g_hr_nodes));
+    memset(hr->nodes, 0, sizeof(hr->nodes));
 
     int wave_idx = 0;
 
-    for (int i = 0; i < g_hr_num_nodes; i++) {
-        hr_node_desc_t* d = &g_hr_desc[i];
-        struct node_s* n  = &g_hr_nodes[i];
+    for (int i = 0; i < hr->num_nodes; i++) {
+        hr_node_desc_t* d = &hr->desc[i];
+        struct node_s* n  = &hr->nodes[i];
 
         for (int j = 0; j < d->num_connections && j < HR_MAX_CONNECTIONS; j++) {
-            n->next[j] = (uint8_t)d->connections[j];
+            n->next[j] = (uint16_t)d->connections[j];
         }
 
         if (strcmp(d->type, "source") == 0) {
@@ -299,6 +313,8 @@ hr_build_nodes(void)
                 ? d->mic_position_ratio : def_mic;
             n->as.eplenum.velocity_low_pass_cutoff_frequency_hz = (d->velocity_low_pass_hz > 0.0)
                 ? d->velocity_low_pass_hz : def_vlpf;
+            n->as.eplenum.waveguide = (d->waveguide.pipes > 0) ? &d->waveguide
+                : (p->default_waveguide.pipes > 0) ? &p->default_waveguide : nullptr;
 
         } else if (strcmp(d->type, "exhaust") == 0) {
             n->type = g_is_exhaust;
@@ -316,10 +332,66 @@ hr_build_nodes(void)
 }
 
 // ─────────────────────────────────────────────────────────────
-// Parseo JSON → g_hr_params + g_hr_desc[]
+// Red waveguide del escape:
+//   "waveguide": {
+//     "inlet_reflection": -1.0,
+//     "pipes": [
+//       { "length_m": 0.45, "diameter_m": 0.042 },                   // primario
+//       { "length_m": 0.60, "diameter_m": 0.055 },                   // secundario
+//       { "length_m": 0.30, "diameter_m": 0.140, "loss": 0.05 },     // silenciador
+//       { "length_m": 0.50, "diameter_m": 0.055, "end": "open" },    // cola
+//       { "parent": 1, "length_m": 0.25, "diameter_m": 0.03, "end": "closed" }
+//     ]
+//   }
+// parent = índice del tubo del que sale (default: el anterior), end solo
+// importa en las hojas, temperature_k = 0 sigue al gas del eplenum.
+// Si la red no es válida se avisa y el eplenum sigue con el CFD.
+// ─────────────────────────────────────────────────────────────
+static void
+hr_parse_waveguide(cJSON* obj, struct waveguide_desc_s* w)
+{
+    memset(w, 0, sizeof(*w));
+    if (!obj) return;
+    cJSON* j;
+    w->inlet_reflection = g_waveguide_default_inlet_reflection;
+    j = cJSON_GetObjectItem(obj, "inlet_reflection"); if(j) w->inlet_reflection = j->valuedouble;
+
+    cJSON* pipes = cJSON_GetObjectItem(obj, "pipes");
+    int count = (pipes && cJSON_IsArray(pipes)) ? cJSON_GetArraySize(pipes) : 0;
+    if (count > (int)g_waveguide_max_pipes) {
+        fprintf(stderr, "[hr] waveguide: %d tubos, se usan los primeros %zu\n", count, g_waveguide_max_pipes);
+        count = (int)g_waveguide_max_pipes;
+    }
+    for (int i = 0; i < count; i++) {
+        cJSON* pj = cJSON_GetArrayItem(pipes, i);
+        struct waveguide_pipe_desc_s* pipe = &w->pipe[w->pipes++];
+        pipe->parent = i - 1;
+        pipe->end    = g_waveguide_end_open;
+        pipe->loss   = g_waveguide_default_loss;
+        j = cJSON_GetObjectItem(pj, "parent");        if(j) pipe->parent        = j->valueint;
+        j = cJSON_GetObjectItem(pj, "length_m");      if(j) pipe->length_m      = j->valuedouble;
+        j = cJSON_GetObjectItem(pj, "diameter_m");    if(j) pipe->diameter_m    = j->valuedouble;
+        j = cJSON_GetObjectItem(pj, "loss");          if(j) pipe->loss          = j->valuedouble;
+        j = cJSON_GetObjectItem(pj, "temperature_k"); if(j) pipe->temperature_k = j->valuedouble;
+        j = cJSON_GetObjectItem(pj, "end");
+        if (j && j->valuestring) {
+            for (size_t e = 0; e < g_waveguide_end_e_size; e++) {
+                if (strcmp(j->valuestring, g_waveguide_end_string[e]) == 0) pipe->end = e;
+            }
+        }
+    }
+    const char* error = check_waveguide_desc(w);
+    if (error) {
+        fprintf(stderr, "[hr] waveguide ignorado: %s\n", error);
+        memset(w, 0, sizeof(*w));
+    }
+}
+
+// ─────────────────────────────────────────────────────────────
+// Parseo JSON → hr->params + hr->desc[]
 // ─────────────────────────────────────────────────────────────
 static bool
-hr_parse_json(const char* filepath)
+hr_parse_json(hr_state_t* hr, const char* filepath)
 {
     FILE* f = fopen(filepath, "r");
     if (!f) {
@@ -342,7 +414,7 @@ hr_parse_json(const char* filepath)
         return false;
     }
 
-    hr_params_t* p = &g_hr_params;
+    hr_params_t* p = &hr->params;
 
     // ── Nombre ────────────────────────────────────────────────
     cJSON* j;
@@ -420,12 +492,15 @@ hr_parse_json(const char* filepath)
         }
     }
 
+    // ── Red waveguide por defecto (se borra si ya no está) ───
+    hr_parse_waveguide(cJSON_GetObjectItem(root, "waveguide"), &p->default_waveguide);
+
     // source/sink es "infinito" — no se expone al JSON
     p->source_sink_volume_m3 = 1.00e20;
 
     // ── Nodos ─────────────────────────────────────────────────
     cJSON* nodes_arr = cJSON_GetObjectItem(root, "nodes");
-    g_hr_num_nodes = 0;
+    hr->num_nodes = 0;
 
     if (nodes_arr && cJSON_IsArray(nodes_arr)) {
         int n_count = cJSON_GetArraySize(nodes_arr);
@@ -433,7 +508,7 @@ hr_parse_json(const char* filepath)
 
         for (int ni = 0; ni < n_count; ni++) {
             cJSON* nd = cJSON_GetArrayItem(nodes_arr, ni);
-            hr_node_desc_t* d = &g_hr_desc[g_hr_num_nodes++];
+            hr_node_desc_t* d = &hr->desc[hr->num_nodes++];
             memset(d, 0, sizeof(*d));
             d->parent = -1;
             d->pipe_length_m      = -1.0;
@@ -474,6 +549,8 @@ hr_parse_json(const char* filepath)
             j = cJSON_GetObjectItem(nd, "velocity_low_pass_hz");
             if(j) d->velocity_low_pass_hz = j->valuedouble;
 
+            hr_parse_waveguide(cJSON_GetObjectItem(nd, "waveguide"), &d->waveguide);
+
             cJSON* conns = cJSON_GetObjectItem(nd, "connections");
             if (conns && cJSON_IsArray(conns)) {
                 int nc = cJSON_GetArraySize(conns);
@@ -494,11 +571,8 @@ hr_parse_json(const char* filepath)
 // Detectar cambio de archivo (por tamaño + mtime simple)
 // ─────────────────────────────────────────────────────────────
 static bool
-hr_file_changed(const char* filepath)
+hr_file_changed(hr_state_t* hr, const char* filepath)
 {
-    static long last_mtime = 0;
-    static long last_size = -1;
-
     FILE* f = fopen(filepath, "r");
     if (!f) return false;
 
@@ -509,30 +583,30 @@ hr_file_changed(const char* filepath)
     struct stat st;
     if (stat(filepath, &st) != 0) {
         // si stat falla, volvemos al método viejo por seguridad
-        if (sz != last_size) {
-            last_size = sz;
+        if (sz != hr->last_filesize) {
+            hr->last_filesize = sz;
             return true;
         }
         return false;
     }
 
-    if (sz != last_size || (long)st.st_mtime != last_mtime) {
-        last_size = sz;
-        last_mtime = (long)st.st_mtime;
+    if (sz != hr->last_filesize || (long)st.st_mtime != hr->last_mtime) {
+        hr->last_filesize = sz;
+        hr->last_mtime = (long)st.st_mtime;
         return true;
     }
     return false;
 }
 
 // ─────────────────────────────────────────────────────────────
-// Aplicar los parámetros y nodos reconstruidos al g_engine
+// Aplicar los parámetros y nodos reconstruidos al engine
 // ─────────────────────────────────────────────────────────────
 static void
-hr_apply_to_engine(struct engine_s* e)
+hr_apply_to_engine(hr_state_t* hr, struct engine_s* e)
 {
-    hr_params_t* p = &g_hr_params;
+    hr_params_t* p = &hr->params;
 
-    // Nombre (la cadena vive en g_hr_params.name)
+    // Nombre (la cadena vive en hr->params.name)
     e->name = p->name;
 
     // Volumen de audio
@@ -556,22 +630,21 @@ hr_apply_to_engine(struct engine_s* e)
     e->starter.radius_m                        = p->starter_radius_m;
 
     // Nodos reconstruidos
-    if (g_hr_num_nodes > 0) {
-        e->node = g_hr_nodes;
-        e->size = (size_t)g_hr_num_nodes;
+    if (hr->num_nodes > 0) {
+        e->node = hr->nodes;
+        e->size = (size_t)hr->num_nodes;
     }
 
-    // Impulso acústico: si se cargó un preset, activarlo globalmente
-    // (g_active_impulse y g_active_impulse_size están en convo_filter_s.h)
+    // Impulso acústico: si se cargó un preset, activarlo en este motor
     if (p->impulse_size > 0) {
-        g_active_impulse      = p->impulse;
-        g_active_impulse_size = p->impulse_size;
+        e->impulse      = p->impulse;
+        e->impulse_size = p->impulse_size;
         printf("[hr] Impulso activo: %zu coeficientes (%.1f ms)\n",
                p->impulse_size, (double)p->impulse_size / 48000.0 * 1000.0);
     } else {
         // Restaurar default hardcodeado
-        g_active_impulse      = g_convo_filter_impulse;
-        g_active_impulse_size = g_convo_filter_impulse_size;
+        e->impulse      = g_convo_filter_impulse;
+        e->impulse_size = g_convo_filter_impulse_size;
     }
 
     // Throttle presets (valores razonables fijos; se pueden exponer si se quiere)
@@ -592,23 +665,39 @@ hr_apply_to_engine(struct engine_s* e)
  * Devuelve true si todo OK.
  */
 static bool
-hr_init(const char* filepath, struct engine_s* e)
+hr_init(hr_state_t* hr, const char* filepath, struct engine_s* e)
 {
-    strncpy(g_hr_filepath, filepath, sizeof(g_hr_filepath)-1);
+    strncpy(hr->filepath, filepath, sizeof(hr->filepath)-1);
+    hr->last_filesize = -1;
+    hr->last_mtime = 0;
 
-    if (!hr_parse_json(filepath)) return false;
-    hr_build_nodes();
-    hr_apply_to_engine(e);
+    if (!hr_parse_json(hr, filepath)) return false;
+    hr_build_nodes(hr);
+    hr_apply_to_engine(hr, e);
 
     printf("[hr] Motor cargado: '%s'  (nodos: %d)\n",
-           g_hr_params.name, g_hr_num_nodes);
+           hr->params.name, hr->num_nodes);
+    return true;
+}
+
+/*
+ * hr_poll() — detecta si el JSON cambió y espera a que el editor termine
+ * de escribirlo. Solo toca last_filesize/last_mtime, así que puede correr
+ * en otro hilo que el del motor.
+ */
+static bool
+hr_poll(hr_state_t* hr)
+{
+    if (!hr_file_changed(hr, hr->filepath)) return false;
+
+    SDL_Delay(50);
     return true;
 }
 
 /*
- * hr_tick() — llamar cada frame (o cada N ms).
- * Si el JSON cambió: recarga params, reconstruye nodos, aplica al engine,
+ * hr_reload() — recarga params, reconstruye nodos, aplica al engine,
  * y llama a reset_engine() para re-inicializar el estado termodinámico.
+ * Tiene que correr en el hilo dueño del engine.
  * Devuelve true si hubo recarga.
  *
  * IMPORTANTE: esta función llama reset_engine() internamente,
@@ -617,53 +706,54 @@ hr_init(const char* filepath, struct engine_s* e)
  * en hotreload_volume_only() abajo.
  */
 static bool
-hr_tick(struct engine_s* e)
+hr_reload(hr_state_t* hr, struct engine_s* e)
 {
-    if (!hr_file_changed(g_hr_filepath)) return false;
-
-    SDL_Delay(50);
+    // Las waves del engine todavía pueden estar leyendo la red waveguide vieja
+    wait_for_engine_waves(e);
 
-    if (!hr_parse_json(g_hr_filepath)) {
+    if (!hr_parse_json(hr, hr->filepath)) {
         printf("[hr] JSON inválido, ignorando cambio\n");
         return false;
     }
 
-    hr_build_nodes();
-    hr_apply_to_engine(e);
-
-    wait_for_engine_waves(e); 
-    flip_engine_waves(e);
-    reset_all_waves();
+    hr_build_nodes(hr);
+    hr_apply_to_engine(hr, e);
 
     bool was_starter = e->starter.is_on;
     bool was_ignite = e->can_ignite;
     double was_throttle = e->throttle_open_ratio;
 
-    reset_engine(e);
-
-    launch_engine_waves(e);       // lanza nuevos threads con los nuevos parámetros
+    reset_engine(e);              // redimensiona la tabla de waves a la nueva cantidad de eplenums y la resetea
 
     e->starter.is_on = was_starter;
     e->can_ignite = was_ignite;
     e->throttle_open_ratio = was_throttle;
 
     printf("[hr] Recargado + waves reiniciados: '%s' | vol=%.3f | nodos=%d\n",
-        g_hr_params.name, g_hr_params.sound_volume, g_hr_num_nodes);
+        hr->params.name, hr->params.sound_volume, hr->num_nodes);
 
     return true;
 }
 
+/*
+ * hr_tick() — llamar cada frame (o cada N ms) desde el hilo del engine.
+ * Es hr_poll() seguido de hr_reload().
+ */
+static bool
+hr_tick(hr_state_t* hr, struct engine_s* e)
+{
+    return hr_poll(hr) && hr_reload(hr, e);
+}
+
 /*
  * hr_volume_only() — actualiza SOLO el volumen sin reiniciar el motor.
  * Útil si cambiás solo sound_volume y no querés perder las RPM actuales.
  * (el hr_tick normal también reinicia el motor completo)
  */
 static void
-hr_volume_only(struct engine_s* e, double vol)
+hr_volume_only(hr_state_t* hr, struct engine_s* e, double vol)
 {
-    g_hr_params.sound_volume = vol;
+    hr->params.sound_volume = vol;
     e->volume = vol;
-    // g_current_volume se actualiza aquí también para synth_s.h
-    extern double g_current_volume;
-    g_current_volume = vol;
+    // el volumen de salida (synth->volume) lo sincroniza el host
 }
@@ -14,10 +14,6 @@ typedef struct {
 extern const double g_convo_filter_impulse[];
 extern const size_t g_convo_filter_impulse_size;
 
-// Variables globales (definidas UNA sola vez aquí)
-const double* g_active_impulse = NULL;
-size_t        g_active_impulse_size = 0;
-
 // Presets
 static const impulse_preset_t impulse_presets[] = {
     { "auto_4cil", g_convo_filter_impulse, g_convo_filter_impulse_size },
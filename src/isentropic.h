@@ -0,0 +1,390 @@
+/* Isentropic nozzle relations as functions of gamma and mach.
+ *
+ * Every power law flow() evaluates is a function of gamma and either the mach
+ * number or the total to static pressure ratio. Gamma stays within the range
+ * the cp tables produce and mach is clamped to a convergent nozzle, so a 2D
+ * grid of each relation, bilinearly interpolated, replaces the pow calls.
+ * precompute_isentropic refines the grids until they stay within an error bound
+ * of the exact formulas, and anything off the grid (fuel vapour gamma, bulk
+ * mach above one) falls back to the exact formulas.
+ *
+ * The grids are built once per process, by whichever thread gets there first,
+ * and only read after the table mode is published. Engines already running on
+ * other threads keep the exact formulas until then.
+ */
+
+#ifndef ENSIM4_ISENTROPIC_MAX_ERROR
+#define ENSIM4_ISENTROPIC_MAX_ERROR 1e-4
+#endif
+
+#define ISENTROPIC_MODES \
+    X(exact)             \
+    X(table)
+
+enum isentropic_mode_e
+{
+#define X(name) g_isentropic_mode_##name,
+    ISENTROPIC_MODES
+#undef X
+    g_isentropic_mode_e_size
+};
+
+constexpr char g_isentropic_mode_string[][16] = {
+#define X(name) #name,
+    ISENTROPIC_MODES
+#undef X
+};
+
+#undef ISENTROPIC_MODES
+
+/* Pure octane vapour sits near 1.04 and cold air at 1.40. Below 2.0 the total to
+ * static pressure ratio of every tabled gamma is past critical, so the mach past
+ * the end of the grid clamps to sonic like the exact formula does.
+ */
+
+constexpr double g_isentropic_min_gamma = 1.03;
+constexpr double g_isentropic_max_gamma = 1.42;
+constexpr double g_isentropic_max_pressure_ratio = 2.0;
+constexpr size_t g_isentropic_min_axis_size = 5;
+constexpr size_t g_isentropic_max_axis_size = 513;
+constexpr size_t g_isentropic_max_grid_size = g_isentropic_max_axis_size * g_isentropic_max_axis_size;
+
+static double g_isentropic_total_pressure_ratio[g_isentropic_max_grid_size] = {};
+static double g_isentropic_mass_flow_factor[g_isentropic_max_grid_size] = {};
+static double g_isentropic_mach[g_isentropic_max_grid_size] = {};
+
+struct isentropic_axis_s
+{
+    double lower;
+    double upper;
+    double scale;
+    size_t size;
+};
+
+/* Relative errors of the interpolated relations against the exact formulas.
+ */
+
+struct isentropic_error_s
+{
+    double total_pressure_ratio;
+    double mass_flow_factor;
+    double mach;
+};
+
+/* The mach grid is indexed by s = sqrt(Pt / Ps - 1) rather than the pressure
+ * ratio itself: mach grows as sqrt(Pt / Ps - 1) off zero flow, which is linear
+ * in s, so the relative error stays bounded down to the smallest flows.
+ *
+ * Mode is stored last with release order, so a reader that loads it as table
+ * with acquire order sees the axes and the grids they describe.
+ */
+
+struct isentropic_table_s
+{
+    _Atomic(enum isentropic_mode_e) mode;
+    struct isentropic_axis_s gamma;
+    struct isentropic_axis_s mach;
+    struct isentropic_axis_s pressure_root;
+    struct isentropic_error_s error;
+};
+
+static struct isentropic_table_s g_isentropic = {};
+static atomic_bool g_is_isentropic_building = false;
+static atomic_bool g_is_isentropic_built = false;
+
+/*
+ *       Pt           y - 1    2    y / (y - 1)
+ * r = ---- = (1 + ----- * M )
+ *       Ps             2
+ */
+
+static double
+calc_isentropic_total_pressure_ratio(double gamma, double mach)
+{
+    double y = gamma;
+    double M = mach;
+    return pow(1.0 + (y - 1.0) / 2.0 * M * M, y / (y - 1.0));
+}
+
+/*
+ *            y - 1    2    -(y + 1) / (2 * (y - 1))
+ * f = (1 + ----- * M )
+ *              2
+ */
+
+static double
+calc_isentropic_mass_flow_factor(double gamma, double mach)
+{
+    double y = gamma;
+    double M = mach;
+    return pow(1.0 + (y - 1.0) / 2.0 * M * M, -(y + 1.0) / (2.0 * (y - 1.0)));
+}
+
+/*             ______________________________
+ *            /    2          (y - 1) / y
+ * M = _     /  -----  * [ r             - 1 ]
+ *      \   /   y - 1
+ *       \/
+ */
+
+static double
+calc_isentropic_mach(double gamma, double total_pressure_ratio)
+{
+    double y = gamma;
+    double r = total_pressure_ratio;
+    return sqrt((2.0 / (y - 1.0)) * (pow(r, (y - 1.0) / y) - 1.0));
+}
+
+static double
+calc_isentropic_axis_value(const struct isentropic_axis_s* axis, double index)
+{
+    return axis->lower + index / axis->scale;
+}
+
+static bool
+is_isentropic_gamma_tabled(const struct isentropic_table_s* self, double gamma)
+{
+    return atomic_load_explicit(&self->mode, memory_order_acquire) == g_isentropic_mode_table
+        && gamma >= self->gamma.lower
+        && gamma <= self->gamma.upper;
+}
+
+/* Bilinear interpolation of a [gamma][x] grid. Gamma must be on the grid; x is
+ * clamped to its axis.
+ */
+
+static double
+lookup_isentropic_grid(const struct isentropic_table_s* self, const double* grid, const struct isentropic_axis_s* axis, double gamma, double x)
+{
+    const struct isentropic_axis_s* g_axis = &self->gamma;
+    double gi = (gamma - g_axis->lower) * g_axis->scale;
+    double xi = (clamp(x, axis->lower, axis->upper) - axis->lower) * axis->scale;
+    size_t g = gi;
+    size_t i = xi;
+    g = g < g_axis->size - 1 ? g : g_axis->size - 2;
+    i = i < axis->size - 1 ? i : axis->size - 2;
+    double fg = gi - g;
+    double fx = xi - i;
+    const double* row0 = &grid[g * axis->size + i];
+    const double* row1 = row0 + axis->size;
+    double v0 = row0[0] + fx * (row0[1] - row0[0]);
+    double v1 = row1[0] + fx * (row1[1] - row1[0]);
+    return v0 + fg * (v1 - v0);
+}
+
+static double
+read_isentropic_total_pressure_ratio(const struct isentropic_table_s* self, double gamma, double mach)
+{
+    double M = fabs(mach);
+    if(is_isentropic_gamma_tabled(self, gamma) == false || M > self->mach.upper)
+    {
+        return calc_isentropic_total_pressure_ratio(gamma, M);
+    }
+    return lookup_isentropic_grid(self, g_isentropic_total_pressure_ratio, &self->mach, gamma, M);
+}
+
+static double
+read_isentropic_mass_flow_factor(const struct isentropic_table_s* self, double gamma, double mach)
+{
+    double M = fabs(mach);
+    if(is_isentropic_gamma_tabled(self, gamma) == false || M > self->mach.upper)
+    {
+        return calc_isentropic_mass_flow_factor(gamma, M);
+    }
+    return lookup_isentropic_grid(self, g_isentropic_mass_flow_factor, &self->mach, gamma, M);
+}
+
+/* Ratios below one have no isentropic expansion and read as zero mach, where
+ * the exact formula gives nan; both mean no flow to the caller.
+ */
+
+static double
+read_isentropic_mach(const struct isentropic_table_s* self, double gamma, double total_pressure_ratio)
+{
+    if(is_isentropic_gamma_tabled(self, gamma) == false)
+    {
+        return calc_isentropic_mach(gamma, total_pressure_ratio);
+    }
+    double s = sqrt(max(total_pressure_ratio - 1.0, 0.0));
+    return lookup_isentropic_grid(self, g_isentropic_mach, &self->pressure_root, gamma, s);
+}
+
+static double
+lookup_isentropic_total_pressure_ratio(double gamma, double mach)
+{
+    return read_isentropic_total_pressure_ratio(&g_isentropic, gamma, mach);
+}
+
+static double
+lookup_isentropic_mass_flow_factor(double gamma, double mach)
+{
+    return read_isentropic_mass_flow_factor(&g_isentropic, gamma, mach);
+}
+
+static double
+lookup_isentropic_mach(double gamma, double total_pressure_ratio)
+{
+    return read_isentropic_mach(&g_isentropic, gamma, total_pressure_ratio);
+}
+
+static void
+plan_isentropic_axis(struct isentropic_axis_s* axis, double lower, double upper, size_t size)
+{
+    axis->lower = lower;
+    axis->upper = upper;
+    axis->size = size;
+    axis->scale = (size - 1) / (upper - lower);
+}
+
+static void
+fill_isentropic_table(const struct isentropic_table_s* self)
+{
+    for(size_t g = 0; g < self->gamma.size; g++)
+    {
+        double y = calc_isentropic_axis_value(&self->gamma, g);
+        for(size_t i = 0; i < self->mach.size; i++)
+        {
+            double M = calc_isentropic_axis_value(&self->mach, i);
+            g_isentropic_total_pressure_ratio[g * self->mach.size + i] = calc_isentropic_total_pressure_ratio(y, M);
+            g_isentropic_mass_flow_factor[g * self->mach.size + i] = calc_isentropic_mass_flow_factor(y, M);
+        }
+        for(size_t i = 0; i < self->pressure_root.size; i++)
+        {
+            double s = calc_isentropic_axis_value(&self->pressure_root, i);
+            g_isentropic_mach[g * self->pressure_root.size + i] = calc_isentropic_mach(y, 1.0 + s * s);
+        }
+    }
+}
+
+static double
+calc_isentropic_relative_error(double value, double exact)
+{
+    return exact == 0.0 ? fabs(value) : fabs(value / exact - 1.0);
+}
+
+/* Largest error over every grid cell, sampled at fractional offsets into the
+ * cells. Midway between nodes along one axis isolates that axis's error; the
+ * cell centers bound the whole interpolation.
+ */
+
+static struct isentropic_error_s
+measure_isentropic_error(const struct isentropic_table_s* self, double gamma_offset, double mach_offset, double pressure_root_offset)
+{
+    struct isentropic_error_s error = {};
+    for(size_t g = 0; g < self->gamma.size - 1; g++)
+    {
+        double y = calc_isentropic_axis_value(&self->gamma, g + gamma_offset);
+        for(size_t i = 0; i < self->mach.size - 1; i++)
+        {
+            double M = calc_isentropic_axis_value(&self->mach, i + mach_offset);
+            double total_pressure_ratio = calc_isentropic_relative_error(
+                read_isentropic_total_pressure_ratio(self, y, M), calc_isentropic_total_pressure_ratio(y, M));
+            double mass_flow_factor = calc_isentropic_relative_error(
+                read_isentropic_mass_flow_factor(self, y, M), calc_isentropic_mass_flow_factor(y, M));
+            error.total_pressure_ratio = max(error.total_pressure_ratio, total_pressure_ratio);
+            error.mass_flow_factor = max(error.mass_flow_factor, mass_flow_factor);
+        }
+        for(size_t i = 0; i < self->pressure_root.size - 1; i++)
+        {
+            double s = calc_isentropic_axis_value(&self->pressure_root, i + pressure_root_offset);
+            double r = 1.0 + s * s;
+            double mach = calc_isentropic_relative_error(read_isentropic_mach(self, y, r), calc_isentropic_mach(y, r));
+            error.mach = max(error.mach, mach);
+        }
+    }
+    return error;
+}
+
+static double
+calc_isentropic_max_error(struct isentropic_error_s* error)
+{
+    return max(error->total_pressure_ratio, max(error->mass_flow_factor, error->mach));
+}
+
+/* Validation harness: the tables against the exact formulas at every cell center.
+ */
+
+static struct isentropic_error_s
+validate_isentropic_table(const struct isentropic_table_s* self)
+{
+    return measure_isentropic_error(self, 0.5, 0.5, 0.5);
+}
+
+static bool
+refine_isentropic_axis(struct isentropic_axis_s* axis, double error, double max_error)
+{
+    if(error <= max_error || axis->size == g_isentropic_max_axis_size)
+    {
+        return false;
+    }
+    plan_isentropic_axis(axis, axis->lower, axis->upper, 2 * axis->size - 1);
+    return true;
+}
+
+/* Doubles the resolution of every axis whose own error exceeds half the bound,
+ * so the two axes together stay within it. The refinement measures a local
+ * table, always in table mode, so the published one only ever changes once.
+ * A bound of zero, or one the largest grid cannot meet, leaves the exact
+ * formulas in place.
+ */
+
+static bool
+build_isentropic_table(double max_error)
+{
+    struct isentropic_table_s table = {};
+    atomic_init(&table.mode, g_isentropic_mode_table);
+    plan_isentropic_axis(&table.gamma, g_isentropic_min_gamma, g_isentropic_max_gamma, g_isentropic_min_axis_size);
+    plan_isentropic_axis(&table.mach, 0.0, 1.0, g_isentropic_min_axis_size);
+    plan_isentropic_axis(&table.pressure_root, 0.0, sqrt(g_isentropic_max_pressure_ratio - 1.0), g_isentropic_min_axis_size);
+    for(bool is_refined = true; is_refined;)
+    {
+        fill_isentropic_table(&table);
+        struct isentropic_error_s gamma_error = measure_isentropic_error(&table, 0.5, 0.0, 0.0);
+        struct isentropic_error_s mach_error = measure_isentropic_error(&table, 0.0, 0.5, 0.0);
+        struct isentropic_error_s pressure_root_error = measure_isentropic_error(&table, 0.0, 0.0, 0.5);
+        is_refined = refine_isentropic_axis(&table.gamma, calc_isentropic_max_error(&gamma_error), max_error / 2.0);
+        is_refined = refine_isentropic_axis(&table.mach, max(mach_error.total_pressure_ratio, mach_error.mass_flow_factor), max_error / 2.0) || is_refined;
+        is_refined = refine_isentropic_axis(&table.pressure_root, pressure_root_error.mach, max_error / 2.0) || is_refined;
+    }
+    table.error = validate_isentropic_table(&table);
+    if(calc_isentropic_max_error(&table.error) > max_error)
+    {
+        return false;
+    }
+    struct isentropic_table_s* self = &g_isentropic;
+    self->gamma = table.gamma;
+    self->mach = table.mach;
+    self->pressure_root = table.pressure_root;
+    self->error = table.error;
+    atomic_store_explicit(&self->mode, g_isentropic_mode_table, memory_order_release);
+    return true;
+}
+
+/* Safe to race from several engine threads, the losers wait for the winner.
+ * Builds once: later calls report the first build whatever bound they pass.
+ */
+
+static bool
+precompute_isentropic(double max_error)
+{
+    if(atomic_load_explicit(&g_is_isentropic_built, memory_order_acquire) == false)
+    {
+        if(max_error <= 0.0)
+        {
+            return false;
+        }
+        if(atomic_exchange(&g_is_isentropic_building, true))
+        {
+            while(atomic_load_explicit(&g_is_isentropic_built, memory_order_acquire) == false)
+            {
+                thrd_yield();
+            }
+        }
+        else
+        {
+            build_isentropic_table(max_error);
+            atomic_store_explicit(&g_is_isentropic_built, true, memory_order_release);
+        }
+    }
+    return atomic_load_explicit(&g_isentropic.mode, memory_order_acquire) == g_isentropic_mode_table;
+}
@@ -4,15 +4,26 @@ struct lowpass_filter_s
 };
 
 static double
-filter_lowpass(struct lowpass_filter_s* self, double cutoff_frequency_hz, double sample)
+calc_lowpass_alpha(double cutoff_frequency_hz, double dt_s)
 {
     double rc_constant = 1.0 / (2.0 * g_std_pi_r * cutoff_frequency_hz);
-    double alpha = g_std_dt_s / (rc_constant + g_std_dt_s);
+    return dt_s / (rc_constant + dt_s);
+}
+
+static double
+filter_lowpass_alpha(struct lowpass_filter_s* self, double alpha, double sample)
+{
     double output = alpha * sample + (1.0 - alpha) * self->last;
     self->last = output;
     return output;
 }
 
+static double
+filter_lowpass(struct lowpass_filter_s* self, double cutoff_frequency_hz, double sample)
+{
+    return filter_lowpass_alpha(self, calc_lowpass_alpha(cutoff_frequency_hz, g_std_dt_s), sample);
+}
+
 struct lowpass_filter_3_s
 {
     struct lowpass_filter_s a;
@@ -21,10 +32,10 @@ struct lowpass_filter_3_s
 };
 
 static double
-filter_lowpass_3(struct lowpass_filter_3_s* self, double cutoff_frequency_hz, double sample)
+filter_lowpass_3_alpha(struct lowpass_filter_3_s* self, double alpha, double sample)
 {
-    sample = filter_lowpass(&self->a, cutoff_frequency_hz, sample);
-    sample = filter_lowpass(&self->b, cutoff_frequency_hz, sample);
-    sample = filter_lowpass(&self->c, cutoff_frequency_hz, sample);
+    sample = filter_lowpass_alpha(&self->a, alpha, sample);
+    sample = filter_lowpass_alpha(&self->b, alpha, sample);
+    sample = filter_lowpass_alpha(&self->c, alpha, sample);
     return sample;
 }
@@ -4,15 +4,21 @@
 #include <stdint.h>
 #include <float.h>
 #include <math.h>
+#include <stdatomic.h>
 
 #include "threads.h"
 #include "std.h"
-#include "panic.h"
+#include "simd.h"
+#include "profile_s.h"
+#include "perf_counter_s.h"
 #include "normalized_s.h"
+#include "fft_s.h"
 #include "convo_filter_s.h"
 #include "highpass_filter_s.h"
 #include "lowpass_filter_s.h"
+#include "cp_table.h"
 #include "gamma.h"
+#include "isentropic.h"
 #include "gas_s.h"
 #include "chamber_s.h"
 #include "gas_mail_s.h"
@@ -23,9 +29,13 @@
 #include "flywheel_s.h"
 #include "starter_s.h"
 #include "limiter_s.h"
+#include "dyno_s.h"
 #include "valve_s.h"
 #include "synth_s.h"
+#include "waveguide_tube_s.h"
+#include "waveguide_s.h"
 #include "wave_s.h"
+#include "wave_pool_s.h"
 #include "source_s.h"
 #include "afilter_s.h"
 #include "iplenum_s.h"
@@ -38,9 +48,12 @@
 #include "exhaust_s.h"
 #include "sink_s.h"
 #include "node_s.h"
+#include "batch_flow_s.h"
 #include "sampler_s.h"
 #include "engine_s.h"
 #include "engine_blueprints.h"
+#include "sim_command_s.h"
+#include "sim_telemetry_s.h"
 
 // ── Motor por defecto (fallback si el JSON falla al inicio) ──
 #ifdef ENGINE_2_CYL
@@ -62,10 +75,6 @@
 #include "sdl_audio.h"
 #include "cJSON.h"
 
-// ── g_current_volume: usado por synth_s.h ────────────────────
-// synth_s.h lo referencia como extern, así que lo definimos aquí.
-double g_current_volume = 0.5;
-
 // ── Motor global ─────────────────────────────────────────────
 // Se inicializa con el engine_*.h compilado como fallback,
 // pero hotreload_engine.h lo sobreescribe desde el JSON.
@@ -103,10 +112,21 @@ struct engine_s g_engine = {
 };
 
 // ── Incluir el sistema de hot-reload (DESPUÉS de g_engine) ───
-// hotreload_engine.h usa g_engine, g_current_volume y cJSON,
+// hotreload_engine.h usa engine_s y cJSON,
 // por eso va después de todas las definiciones anteriores.
 #include "hotreload_engine.h"
 
+// Estado del hot-reload de g_engine (los nodos viven acá)
+static hr_state_t g_hr_state = {};
+
+// ── Hilo de simulación ───────────────────────────────────────
+// g_engine, g_sampler, g_synth y g_hr_state (salvo el chequeo del
+// archivo) son solo del hilo de simulación una vez que arranca. La UI
+// le habla por g_sim_commands y lo ve por g_sim_telemetry.
+static struct sim_command_queue_s g_sim_commands = {};
+static struct sim_telemetry_s     g_sim_telemetry = {};
+static atomic_bool                g_is_sim_running = true;
+
 // ─────────────────────────────────────────────────────────────
 
 static double get_ticks_ms()
@@ -115,9 +135,56 @@ static double get_ticks_ms()
     return SDL_NS_TO_MS(ticks_ns);
 }
 
+// Simula un bloque cada vez que el dispositivo de audio pide y la cola
+// tiene lugar. La espera se corta sola a un cuarto de bloque por si el
+// dispositivo no avisa.
+static int run_sim(void* arg)
+{
+    (void) arg;
+    thrd_prioritize_current();
+    while (atomic_load(&g_is_sim_running)) {
+        struct sim_command_s command;
+        while (pop_sim_command(&g_sim_commands, &command)) {
+            if (command.type == g_sim_command_reload) {
+                if (hr_reload(&g_hr_state, &g_engine)) {
+                    // hr_reload recarga g_engine.volume desde el JSON
+                    g_synth.volume = g_engine.volume;
+                }
+            } else {
+                apply_sim_command(&g_engine, &g_sampler, command);
+            }
+        }
+
+        size_t audio_buffer_size = get_audio_buffer_size();
+        if (audio_buffer_size >= g_synth_buffer_max_size) {
+            wait_for_audio_demand(1 + (int32_t) (250.0 * g_engine.block_size * g_std_dt_s));
+            continue;
+        }
+
+        struct engine_time_s engine_time = { .get_ticks_ms = get_ticks_ms };
+        double t0 = get_ticks_ms();
+        clear_synth(&g_synth);
+        run_engine(&g_engine, &engine_time, &g_sampler, &g_synth,
+                   audio_buffer_size, g_sampler_synth);
+
+        // NOTA: NO aplicar g_engine.volume aquí manualmente.
+        // push_synth() ya multiplica por g_synth.volume (que es
+        // lo mismo que g_engine.volume). Hacerlo dos veces causa
+        // una doble atenuación silenciosa muy difícil de debuggear.
+
+        buffer_audio(&g_synth);
+        double t1 = get_ticks_ms();
+
+        publish_sim_telemetry(&g_sim_telemetry, &g_engine, &engine_time, t1 - t0,
+                              &g_sampler, g_sampler_synth, audio_buffer_size);
+    }
+    PERF_CLOSE();
+    return 0;
+}
+
 int main()
 {
-    precompute_cp();
+    precompute_isentropic(ENSIM4_ISENTROPIC_MAX_ERROR);
 
 #ifdef ENSIM4_VISUALIZE
     visualize_gamma();
@@ -129,89 +196,121 @@ int main()
     // Si falla, el motor arranca con los valores compilados (fallback seguro).
     reset_engine(&g_engine);
 
-    if (!hr_init("configs/engine_current.json", &g_engine)) {
+    if (!hr_init(&g_hr_state, "configs/engine_current.json", &g_engine)) {
         printf("[main] JSON no encontrado o inválido. Usando motor compilado por defecto.\n");
     }
     reset_engine(&g_engine);
 
-    // Sincronizar g_current_volume con el valor cargado del JSON
-    g_current_volume = g_engine.volume;
+    // Sincronizar el volumen de salida con el valor cargado del JSON
+    g_synth.volume = g_engine.volume;
 
     init_sdl();
     init_sdl_audio();
 
+#ifdef ENSIM4_PROFILE
+    // Traza Chrome/Perfetto de cada bloque y cada frame
+    const char* trace_path = getenv("ENSIM4_TRACE") ? getenv("ENSIM4_TRACE") : "ensim4_trace.json";
+    if (!open_profile_trace(trace_path, g_node_name_string, len(g_node_name_string))) {
+        fprintf(stderr, "warning: cannot write trace '%s'\n", trace_path);
+    }
+#endif
+
 #ifdef ENSIM4_PERF
     g_engine.starter.is_on     = true;
     g_engine.can_ignite        = true;
     g_engine.throttle_open_ratio = 1.0;
+#endif
+
+    reset_sim_telemetry(&g_sim_telemetry);
+    thrd_t sim_thread;
+    if (thrd_create(&sim_thread, run_sim, nullptr) != thrd_success) {
+        fprintf(stderr, "error: could not start the simulation thread\n");
+        exit(1);
+    }
+
+#ifdef ENSIM4_PERF
     size_t perf_max_cycles = 360;
     for (size_t cycle = 0; cycle < perf_max_cycles; cycle++)
 #else
     for (;;)
 #endif
     {
-        struct engine_time_s engine_time = { .get_ticks_ms = get_ticks_ms };
         struct widget_time_s widget_time = { .get_ticks_ms = get_ticks_ms };
 
         double t0 = widget_time.get_ticks_ms();
 
         // ── HOT-RELOAD: checar JSON cada 200 ms ──────────────
-        // hr_tick() detecta cambios por tamaño de archivo.
-        // Si cambia: recarga params, reconstruye nodos, aplica
-        // al engine, y reinicia el motor preservando el estado
-        // del usuario (starter on/off, throttle, etc).
+        // hr_poll() detecta cambios por tamaño de archivo; la
+        // recarga (params, nodos, reset del motor preservando
+        // starter y throttle) la hace el hilo de simulación.
         {
             static uint64_t last_check_ms = 0;
             uint64_t now_ms = SDL_GetTicks();
             if (now_ms - last_check_ms > 200) {
                 last_check_ms = now_ms;
-                if (hr_tick(&g_engine)) {
-                    // hr_tick ya sincroniza g_current_volume vía g_engine.volume
-                    g_current_volume = g_engine.volume;
+                if (hr_poll(&g_hr_state)) {
+                    push_sim_command(&g_sim_commands, (struct sim_command_s) { .type = g_sim_command_reload });
                 }
             }
         }
 
         double t1 = widget_time.get_ticks_ms();
 
-        // ── Simulación ────────────────────────────────────────
-        clear_synth(&g_synth);
-        size_t audio_buffer_size = get_audio_buffer_size();
-        run_engine(&g_engine, &engine_time, &g_sampler, &g_synth,
-                   audio_buffer_size, g_sampler_synth);
-
-        // NOTA: NO aplicar g_engine.volume aquí manualmente.
-        // push_synth() ya multiplica por g_current_volume (que es
-        // lo mismo que g_engine.volume). Hacerlo dos veces causa
-        // una doble atenuación silenciosa muy difícil de debuggear.
-
-        buffer_audio(&g_synth);
+        struct sim_snapshot_s* snapshot = acquire_sim_telemetry(&g_sim_telemetry);
 
         double t2 = widget_time.get_ticks_ms();
 
-        if (handle_input(&g_engine, &g_sampler)) break;
+        if (handle_input(snapshot ? &snapshot->engine : nullptr, &g_sim_commands)) break;
 
-        draw_to_renderer(
-            &g_engine, &g_sampler,
-            &g_loop_time_panel, &g_engine_time_panel,
-            &g_audio_buffer_time_panel, &g_r_per_s_progress_bar,
-            &g_frames_per_sec_progress_bar, &g_throttle_progress_bar,
-            &g_starter_panel_r_per_s, &g_convolution_panel_time_domain,
-            g_wave_panel, len(g_wave_panel), &g_synth_sample_panel);
+        // Contadores de hardware de todos los hilos desde el frame anterior
+        struct perf_frame_s perf_frame = take_perf_frame();
+#ifdef ENSIM4_PERF_EVENTS
+        struct sdl_time_panel_s* counter_time_panel = &g_counter_time_panel;
+        push_perf_widgets(&perf_frame);
+#else
+        struct sdl_time_panel_s* counter_time_panel = nullptr;
+#endif
+
+        PROFILE_BEGIN(draw);
+        PERF_BEGIN(draw);
+        if (snapshot) {
+            draw_to_renderer(
+                &snapshot->engine, &snapshot->sampler,
+                &g_loop_time_panel, &g_engine_time_panel,
+                &g_audio_buffer_time_panel, &g_r_per_s_progress_bar,
+                &g_frames_per_sec_progress_bar, &g_throttle_progress_bar,
+                &g_starter_panel_r_per_s, &g_convolution_panel_time_domain,
+                g_wave_panel, len(g_wave_panel), &g_synth_sample_panel,
+                counter_time_panel, &perf_frame);
+        }
+        PERF_END(draw);
+        PERF_FLUSH();
+        PROFILE_END(draw);
 
         double t3 = widget_time.get_ticks_ms();
         present_renderer();
         double t4 = widget_time.get_ticks_ms();
 
-        widget_time.n_a_time_ms     = t1 - t0;
-        widget_time.engine_time_ms  = t2 - t1;
-        widget_time.draw_time_ms    = t3 - t2;
-        widget_time.vsync_time_ms   = t4 - t0;
+        if (snapshot) {
+            widget_time.n_a_time_ms     = t1 - t0;
+            widget_time.engine_time_ms  = snapshot->run_time_ms;
+            widget_time.draw_time_ms    = t3 - t2;
+            widget_time.vsync_time_ms   = t4 - t0;
 
-        push_widgets(&g_engine, &engine_time, &g_sampler, g_sampler_synth,
-                     audio_buffer_size, &widget_time);
+            push_widgets(&snapshot->engine, &snapshot->engine_time, &snapshot->sampler,
+                         snapshot->sampler_synth, snapshot->audio_buffer_size, &widget_time);
+        }
     }
 
+    atomic_store(&g_is_sim_running, false);
+    wake_audio_demand();
+    thrd_join(sim_thread, nullptr);
+    stop_wave_pool();
+    stop_convo_worker();
+    PERF_CLOSE();
+#ifdef ENSIM4_PROFILE
+    close_profile_trace();
+#endif
     exit_sdl_audio();
     exit_sdl();
     return 0;
@@ -4,15 +4,19 @@
 #include <stdint.h>
 #include <float.h>
 #include <math.h>
+#include <stdatomic.h>
 
 #include "threads.h"
 #include "std.h"
-#include "panic.h"
+#include "simd.h"
 #include "normalized_s.h"
+#include "fft_s.h"
 #include "convo_filter_s.h"
 #include "highpass_filter_s.h"
 #include "lowpass_filter_s.h"
+#include "cp_table.h"
 #include "gamma.h"
+#include "isentropic.h"
 #include "gas_s.h"
 #include "chamber_s.h"
 #include "gas_mail_s.h"
@@ -23,9 +27,13 @@
 #include "flywheel_s.h"
 #include "starter_s.h"
 #include "limiter_s.h"
+#include "dyno_s.h"
 #include "valve_s.h"
 #include "synth_s.h"
+#include "waveguide_tube_s.h"
+#include "waveguide_s.h"
 #include "wave_s.h"
+#include "wave_pool_s.h"
 #include "source_s.h"
 #include "afilter_s.h"
 #include "iplenum_s.h"
@@ -38,6 +46,7 @@
 #include "exhaust_s.h"
 #include "sink_s.h"
 #include "node_s.h"
+#include "batch_flow_s.h"
 #include "sampler_s.h"
 #include "engine_s.h"
 #include "engine_blueprints.h"
@@ -67,7 +76,7 @@ bool load_engine_from_json(const char* filepath);
 
 static struct sampler_s g_sampler = {};
 static sampler_synth_t g_sampler_synth = {};
-static struct synth_s g_synth = {};
+static struct synth_s g_synth = { .volume = 0.5 };
 
 struct engine_s g_engine = {
     .name = g_engine_name,
@@ -92,8 +101,6 @@ struct engine_s g_engine = {
     .radial_spacing = g_engine_radial_spacing,
 };
 
-double g_current_volume = 0.5;
-
 static double get_ticks_ms()
 {
     double ticks_ns = SDL_GetTicksNS();
@@ -102,7 +109,7 @@ static double get_ticks_ms()
 
 int main()
 {
-    precompute_cp();
+    precompute_isentropic(ENSIM4_ISENTROPIC_MAX_ERROR);
 #ifdef ENSIM4_VISUALIZE
     visualize_gamma();
     visualize_chamber_s();
@@ -176,6 +183,8 @@ int main()
         push_widgets(&g_engine, &engine_time, &g_sampler, g_sampler_synth, audio_buffer_size, &widget_time);
     }
 
+    stop_wave_pool();
+    stop_convo_worker();
     exit_sdl_audio();
     exit_sdl();
     return 0;
@@ -221,11 +230,11 @@ bool load_engine_from_json(const char* filepath) {
 
     cJSON* item = cJSON_GetObjectItem(json, "sound_volume");
     if (item) {
-        g_current_volume = item->valuedouble;   // <--- ESTA ES LA LNEA CLAVE
+        g_synth.volume = item->valuedouble;   // <--- ESTA ES LA LNEA CLAVE
         g_engine.volume = item->valuedouble;
     }
 
-    printf("Volume actualizado a: %.2f\n", g_current_volume);
+    printf("Volume actualizado a: %.2f\n", g_synth.volume);
 
     cJSON_Delete(json);
     reset_engine(&g_engine);
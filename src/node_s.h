@@ -1,4 +1,5 @@
 constexpr size_t g_nodes_node_children = 16;
+constexpr size_t g_nodes_max_nodes = UINT16_MAX;
 
 #define TYPES   \
     X(chamber)  \
@@ -39,7 +40,7 @@ struct node_s
     as;
     bool is_selected;
     bool is_next_selected;
-    uint8_t next[g_nodes_node_children];
+    uint16_t next[g_nodes_node_children];
 };
 
 #undef TYPES
@@ -109,6 +110,20 @@ select_nodes(struct node_s* nodes, size_t size, enum node_type_e type)
     }
 }
 
+static size_t
+count_nodes(struct node_s* nodes, size_t size, enum node_type_e type)
+{
+    size_t count = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(nodes[i].type == type)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
 static size_t
 count_selected_nodes(struct node_s* nodes, size_t size)
 {
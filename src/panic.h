@@ -1 +0,0 @@
-const char* g_panic_message = nullptr;
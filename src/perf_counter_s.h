@@ -0,0 +1,321 @@
+/*
+ * Hardware counters per simulation phase, to tell a phase that waits on memory
+ * from one that waits on arithmetic. Built with ENSIM4_PERF_COUNTERS on Linux,
+ * where every thread that runs a phase opens its own perf events on first use
+ * and reads them from user space with rdpmc where the kernel allows it.
+ *
+ * Phases add up per thread and are flushed into process wide totals at the end
+ * of each block, wave job, or draw. Whoever shows them takes the totals, which
+ * makes them per frame for the window and per run for headless hosts. Counters
+ * the kernel refuses, in a virtual machine or under a strict
+ * perf_event_paranoid, read as zero. Each thread closes its own events with
+ * PERF_CLOSE before it exits; the counters reopen on the next phase.
+ */
+
+#if defined(ENSIM4_PERF_COUNTERS) && defined(__linux__)
+#define ENSIM4_PERF_EVENTS
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define PERF_COUNTERS   \
+    X(cycles)           \
+    X(instructions)     \
+    X(l1d_misses)       \
+    X(llc_misses)       \
+    X(branch_misses)
+
+enum perf_counter_e
+{
+#define X(name) g_perf_counter_##name,
+    PERF_COUNTERS
+#undef X
+    g_perf_counter_e_size
+};
+
+constexpr char g_perf_counter_string[][16] = {
+#define X(name) #name,
+    PERF_COUNTERS
+#undef X
+};
+
+#undef PERF_COUNTERS
+
+#define PERF_PHASES \
+    X(flow)         \
+    X(kinematics)   \
+    X(thermo)       \
+    X(wave_batch)   \
+    X(convolution)  \
+    X(draw)
+
+enum perf_phase_e
+{
+#define X(name) g_perf_phase_##name,
+    PERF_PHASES
+#undef X
+    g_perf_phase_e_size
+};
+
+constexpr char g_perf_phase_string[][16] = {
+#define X(name) #name,
+    PERF_PHASES
+#undef X
+};
+
+#undef PERF_PHASES
+
+struct perf_count_s
+{
+    uint64_t value[g_perf_counter_e_size];
+};
+
+struct perf_frame_s
+{
+    struct perf_count_s phase[g_perf_phase_e_size];
+};
+
+#ifdef ENSIM4_PERF_EVENTS
+
+struct perf_events_s
+{
+    int fd[g_perf_counter_e_size];
+    struct perf_event_mmap_page* page[g_perf_counter_e_size];
+    struct perf_count_s phase[g_perf_phase_e_size];
+    bool is_open;
+};
+
+static _Thread_local struct perf_events_s g_perf_events = {};
+static atomic_uint_fast64_t g_perf_totals[g_perf_phase_e_size][g_perf_counter_e_size];
+
+static struct perf_event_attr
+get_perf_event_attr(enum perf_counter_e counter)
+{
+    struct perf_event_attr attr = {
+        .size = sizeof(attr),
+        .type = PERF_TYPE_HARDWARE,
+        .exclude_kernel = 1,
+        .exclude_hv = 1,
+    };
+    switch(counter)
+    {
+    case g_perf_counter_cycles:
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case g_perf_counter_instructions:
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case g_perf_counter_l1d_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    case g_perf_counter_llc_misses:
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+    case g_perf_counter_branch_misses:
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    case g_perf_counter_e_size:
+        break;
+    }
+    return attr;
+}
+
+/* Counts this thread only, on whatever core it runs. The page is only kept
+ * when the kernel lets user space read the counter.
+ */
+
+static void
+open_perf_events()
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    for(size_t i = 0; i < g_perf_counter_e_size; i++)
+    {
+        struct perf_event_attr attr = get_perf_event_attr(i);
+        int fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        struct perf_event_mmap_page* page = nullptr;
+        if(fd >= 0)
+        {
+            void* map = mmap(nullptr, page_size, PROT_READ, MAP_SHARED, fd, 0);
+            page = map == MAP_FAILED ? nullptr : map;
+        }
+        if(page != nullptr && page->cap_user_rdpmc == 0)
+        {
+            munmap(page, page_size);
+            page = nullptr;
+        }
+        g_perf_events.fd[i] = fd;
+        g_perf_events.page[i] = page;
+    }
+    g_perf_events.is_open = true;
+}
+
+static void
+close_perf_events()
+{
+    if(g_perf_events.is_open == false)
+    {
+        return;
+    }
+    long page_size = sysconf(_SC_PAGESIZE);
+    for(size_t i = 0; i < g_perf_counter_e_size; i++)
+    {
+        if(g_perf_events.page[i] != nullptr)
+        {
+            munmap(g_perf_events.page[i], page_size);
+        }
+        if(g_perf_events.fd[i] >= 0)
+        {
+            close(g_perf_events.fd[i]);
+        }
+        g_perf_events.fd[i] = -1;
+        g_perf_events.page[i] = nullptr;
+    }
+    g_perf_events.is_open = false;
+}
+
+/* The seqlock retries if the kernel moved the counter mid read; an index of
+ * zero means the counter is not on the core right now and the offset is the
+ * whole count.
+ */
+
+static uint64_t
+read_perf_event(int fd, struct perf_event_mmap_page* page)
+{
+    uint64_t count = 0;
+#ifdef ENSIM4_SIMD_X86
+    if(page != nullptr)
+    {
+        uint32_t lock;
+        do
+        {
+            lock = page->lock;
+            atomic_signal_fence(memory_order_seq_cst);
+            uint32_t index = page->index;
+            count = page->offset;
+            if(index > 0)
+            {
+                uint32_t shift = 64 - page->pmc_width;
+                count += (uint64_t) ((int64_t) ((uint64_t) __builtin_ia32_rdpmc(index - 1) << shift) >> shift);
+            }
+            atomic_signal_fence(memory_order_seq_cst);
+        }
+        while(page->lock != lock);
+        return count;
+    }
+#endif
+    if(fd >= 0 && read(fd, &count, sizeof(count)) != sizeof(count))
+    {
+        count = 0;
+    }
+    return count;
+}
+
+static struct perf_count_s
+read_perf_counters()
+{
+    if(g_perf_events.is_open == false)
+    {
+        open_perf_events();
+    }
+    struct perf_count_s count;
+    for(size_t i = 0; i < g_perf_counter_e_size; i++)
+    {
+        count.value[i] = read_perf_event(g_perf_events.fd[i], g_perf_events.page[i]);
+    }
+    return count;
+}
+
+static void
+end_perf_phase(enum perf_phase_e phase, struct perf_count_s* begin)
+{
+    struct perf_count_s end = read_perf_counters();
+    for(size_t i = 0; i < g_perf_counter_e_size; i++)
+    {
+        g_perf_events.phase[phase].value[i] += end.value[i] - begin->value[i];
+    }
+}
+
+static void
+flush_perf_phases()
+{
+    for(size_t phase = 0; phase < g_perf_phase_e_size; phase++)
+    {
+        for(size_t i = 0; i < g_perf_counter_e_size; i++)
+        {
+            uint64_t value = g_perf_events.phase[phase].value[i];
+            if(value > 0)
+            {
+                atomic_fetch_add_explicit(&g_perf_totals[phase][i], value, memory_order_relaxed);
+            }
+        }
+    }
+    clear(g_perf_events.phase);
+}
+
+/* Everything flushed since the last take, from every thread.
+ */
+
+static struct perf_frame_s
+take_perf_frame()
+{
+    struct perf_frame_s frame;
+    for(size_t phase = 0; phase < g_perf_phase_e_size; phase++)
+    {
+        for(size_t i = 0; i < g_perf_counter_e_size; i++)
+        {
+            frame.phase[phase].value[i] = atomic_exchange_explicit(&g_perf_totals[phase][i], 0, memory_order_relaxed);
+        }
+    }
+    return frame;
+}
+
+#define PERF_BEGIN(phase) struct perf_count_s perf_##phase##_count = read_perf_counters()
+#define PERF_END(phase) end_perf_phase(g_perf_phase_##phase, &perf_##phase##_count)
+#define PERF_FLUSH() flush_perf_phases()
+#define PERF_CLOSE() close_perf_events()
+
+#else
+
+static struct perf_frame_s
+take_perf_frame()
+{
+    return (struct perf_frame_s) {};
+}
+
+#define PERF_BEGIN(phase)
+#define PERF_END(phase)
+#define PERF_FLUSH()
+#define PERF_CLOSE()
+
+#endif
+
+static double
+calc_perf_ipc(struct perf_count_s* self)
+{
+    uint64_t cycles = self->value[g_perf_counter_cycles];
+    return cycles > 0 ? (double) self->value[g_perf_counter_instructions] / cycles : 0.0;
+}
+
+static void
+print_perf_frame(FILE* file, struct perf_frame_s* self)
+{
+    fprintf(file, "%-12s", "phase");
+    for(size_t i = 0; i < g_perf_counter_e_size; i++)
+    {
+        fprintf(file, " %16s", g_perf_counter_string[i]);
+    }
+    fprintf(file, " %8s\n", "ipc");
+    for(size_t phase = 0; phase < g_perf_phase_e_size; phase++)
+    {
+        struct perf_count_s* count = &self->phase[phase];
+        fprintf(file, "%-12s", g_perf_phase_string[phase]);
+        for(size_t i = 0; i < g_perf_counter_e_size; i++)
+        {
+            fprintf(file, " %16llu", (unsigned long long) count->value[i]);
+        }
+        fprintf(file, " %8.2f\n", calc_perf_ipc(count));
+    }
+}
@@ -0,0 +1,326 @@
+/*
+ * Scoped timing zones for seeing where a block's budget goes on the machine
+ * that runs it. Zones nest as PROFILE_ZONES lists them and add up per thread.
+ * Closing the outermost root zone on a thread writes it, and everything that
+ * ran inside it, to a Chrome trace as one slice per zone, laid end to end
+ * under its parent with the call count attached. A root closed inside another,
+ * a wave job run by the posting thread, counts as a child of the outer one.
+ * Open the trace in chrome://tracing or ui.perfetto.dev.
+ *
+ * Zones compile to nothing unless ENSIM4_PROFILE is defined. ENSIM4_PROFILE_NODES
+ * adds a zone per node type under flow, which costs a clock read per edge.
+ * The clock is the time stamp counter where there is one. It is always built,
+ * the engine's own phase timers read it too.
+ */
+
+constexpr uint64_t g_profile_calibration_ns = 2000000;
+constexpr size_t g_profile_max_node_types = 16;
+
+static atomic_uint_fast64_t g_profile_ticks_per_s;
+
+static uint64_t
+read_profile_ticks()
+{
+#ifdef ENSIM4_SIMD_X86
+    return __rdtsc();
+#else
+    return SDL_GetPerformanceCounter();
+#endif
+}
+
+static uint64_t
+calibrate_profile_clock()
+{
+#ifdef ENSIM4_SIMD_X86
+    uint64_t ns_0 = SDL_GetTicksNS();
+    uint64_t ticks_0 = read_profile_ticks();
+    uint64_t ns_1 = ns_0;
+    while(ns_1 - ns_0 < g_profile_calibration_ns)
+    {
+        ns_1 = SDL_GetTicksNS();
+    }
+    uint64_t ticks_1 = read_profile_ticks();
+    return (ticks_1 - ticks_0) * (uint64_t) 1000000000 / (ns_1 - ns_0);
+#else
+    return SDL_GetPerformanceFrequency();
+#endif
+}
+
+/* Safe to race from several threads, every loser calibrates again and stores
+ * much the same rate.
+ */
+
+static uint64_t
+get_profile_ticks_per_s()
+{
+    uint64_t ticks_per_s = atomic_load_explicit(&g_profile_ticks_per_s, memory_order_relaxed);
+    if(ticks_per_s == 0)
+    {
+        ticks_per_s = calibrate_profile_clock();
+        atomic_store_explicit(&g_profile_ticks_per_s, ticks_per_s, memory_order_relaxed);
+    }
+    return ticks_per_s;
+}
+
+static double
+calc_profile_ms(uint64_t ticks)
+{
+    return 1e3 * ticks / get_profile_ticks_per_s();
+}
+
+#ifdef ENSIM4_PROFILE
+
+/* Name and parent; a zone that is its own parent is a root.
+ */
+
+#define PROFILE_ZONES            \
+    X(block, block)              \
+    X(step, block)               \
+    X(flow, step)                \
+    X(sampler, flow)             \
+    X(crank, step)               \
+    X(compress, step)            \
+    X(valves, step)              \
+    X(combust, step)             \
+    X(wave_wait, block)          \
+    X(synth, block)              \
+    X(convolution, synth)        \
+    X(wave_batch, wave_batch)    \
+    X(draw, draw)
+
+enum profile_zone_e
+{
+#define X(name, parent) g_profile_zone_##name,
+    PROFILE_ZONES
+#undef X
+    g_profile_zone_e_size
+};
+
+constexpr char g_profile_zone_string[][16] = {
+#define X(name, parent) #name,
+    PROFILE_ZONES
+#undef X
+};
+
+constexpr enum profile_zone_e g_profile_zone_parent[] = {
+#define X(name, parent) g_profile_zone_##parent,
+    PROFILE_ZONES
+#undef X
+};
+
+#undef PROFILE_ZONES
+
+struct profile_zone_s
+{
+    uint64_t ticks;
+    uint64_t calls;
+};
+
+struct profiler_s
+{
+    struct profile_zone_s zone[g_profile_zone_e_size];
+    struct profile_zone_s node[g_profile_max_node_types];
+    size_t roots;
+    unsigned thread;
+};
+
+struct profile_trace_s
+{
+    FILE* file;
+    mtx_t mutex;
+    uint64_t origin_ticks;
+    double ticks_per_us;
+    const char (*node_name)[16];
+    size_t node_types;
+    atomic_uint threads;
+    atomic_bool is_open;
+    bool has_events;
+};
+
+static _Thread_local struct profiler_s g_profiler = {};
+static struct profile_trace_s g_profile_trace = {};
+
+/* Zones closed before the trace opens, or after it closes, are counted and
+ * dropped. Node names label the per node type zones. The mutex outlives the
+ * trace, a thread may still be on its way to it when the trace closes.
+ */
+
+static bool
+open_profile_trace(const char* path, const char (*node_name)[16], size_t node_types)
+{
+    if(g_profile_trace.mutex == nullptr && mtx_init(&g_profile_trace.mutex) != thrd_success)
+    {
+        return false;
+    }
+    FILE* file = fopen(path, "w");
+    if(file == nullptr)
+    {
+        return false;
+    }
+    mtx_lock(&g_profile_trace.mutex);
+    g_profile_trace.origin_ticks = read_profile_ticks();
+    g_profile_trace.ticks_per_us = get_profile_ticks_per_s() / 1e6;
+    g_profile_trace.node_name = node_name;
+    g_profile_trace.node_types = node_types < g_profile_max_node_types ? node_types : g_profile_max_node_types;
+    g_profile_trace.has_events = false;
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    g_profile_trace.file = file;
+    mtx_unlock(&g_profile_trace.mutex);
+    atomic_store(&g_profile_trace.is_open, true);
+    return true;
+}
+
+static void
+close_profile_trace()
+{
+    if(atomic_exchange(&g_profile_trace.is_open, false) == false)
+    {
+        return;
+    }
+    mtx_lock(&g_profile_trace.mutex);
+    fprintf(g_profile_trace.file, "\n]}\n");
+    fclose(g_profile_trace.file);
+    g_profile_trace.file = nullptr;
+    mtx_unlock(&g_profile_trace.mutex);
+}
+
+/* Times go through whole nanoseconds so slices laid end to end meet exactly.
+ */
+
+static void
+write_profile_event(const char* name, uint64_t begin_ticks, uint64_t ticks, uint64_t calls)
+{
+    uint64_t begin_ns = 1e3 * (begin_ticks - g_profile_trace.origin_ticks) / g_profile_trace.ticks_per_us;
+    uint64_t end_ns = 1e3 * (begin_ticks + ticks - g_profile_trace.origin_ticks) / g_profile_trace.ticks_per_us;
+    fprintf(g_profile_trace.file,
+        "%s\n{\"name\":\"%s\",\"cat\":\"ensim4\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"calls\":%llu}}",
+        g_profile_trace.has_events ? "," : "", name, g_profiler.thread, begin_ns / 1e3, (end_ns - begin_ns) / 1e3, (unsigned long long) calls);
+    g_profile_trace.has_events = true;
+}
+
+/* Node zones hold the sampling of their edges, so they stand in for the
+ * children of flow when there are any.
+ */
+
+static bool
+write_profile_nodes(uint64_t begin_ticks)
+{
+    bool has_nodes = false;
+    for(size_t type = 0; type < g_profile_trace.node_types; type++)
+    {
+        struct profile_zone_s* node = &g_profiler.node[type];
+        if(node->calls > 0)
+        {
+            write_profile_event(g_profile_trace.node_name[type], begin_ticks, node->ticks, node->calls);
+            begin_ticks += node->ticks;
+            has_nodes = true;
+        }
+    }
+    return has_nodes;
+}
+
+static bool
+is_profile_root(size_t zone)
+{
+    return g_profile_zone_parent[zone] == zone;
+}
+
+/* Writes the children of parent from begin_ticks on, each followed by its own
+ * children.
+ */
+
+static void
+write_profile_children(enum profile_zone_e parent, uint64_t begin_ticks)
+{
+    for(size_t i = 0; i < g_profile_zone_e_size; i++)
+    {
+        struct profile_zone_s* zone = &g_profiler.zone[i];
+        bool is_child = g_profile_zone_parent[i] == parent || (is_profile_root(parent) && is_profile_root(i));
+        if(i != parent && is_child && zone->calls > 0)
+        {
+            write_profile_event(g_profile_zone_string[i], begin_ticks, zone->ticks, zone->calls);
+            if(i != g_profile_zone_flow || write_profile_nodes(begin_ticks) == false)
+            {
+                write_profile_children(i, begin_ticks);
+            }
+            begin_ticks += zone->ticks;
+        }
+    }
+}
+
+static void
+flush_profile_zone(enum profile_zone_e root, uint64_t begin_ticks, uint64_t end_ticks)
+{
+    if(atomic_load_explicit(&g_profile_trace.is_open, memory_order_relaxed))
+    {
+        mtx_lock(&g_profile_trace.mutex);
+        if(g_profile_trace.file != nullptr)
+        {
+            if(g_profiler.thread == 0)
+            {
+                g_profiler.thread = atomic_fetch_add(&g_profile_trace.threads, 1) + 1;
+            }
+            write_profile_event(g_profile_zone_string[root], begin_ticks, end_ticks - begin_ticks, 1);
+            write_profile_children(root, begin_ticks);
+        }
+        mtx_unlock(&g_profile_trace.mutex);
+    }
+    clear(g_profiler.zone);
+    clear(g_profiler.node);
+}
+
+static uint64_t
+begin_profile_zone(enum profile_zone_e zone)
+{
+    if(is_profile_root(zone))
+    {
+        g_profiler.roots++;
+    }
+    return read_profile_ticks();
+}
+
+static void
+end_profile_zone(enum profile_zone_e zone, uint64_t begin_ticks)
+{
+    uint64_t end_ticks = read_profile_ticks();
+    if(is_profile_root(zone) && --g_profiler.roots == 0)
+    {
+        flush_profile_zone(zone, begin_ticks, end_ticks);
+        return;
+    }
+    g_profiler.zone[zone].ticks += end_ticks - begin_ticks;
+    g_profiler.zone[zone].calls += 1;
+}
+
+static void
+end_profile_node_zone(size_t type, uint64_t begin_ticks)
+{
+    uint64_t end_ticks = read_profile_ticks();
+    if(type < g_profile_max_node_types)
+    {
+        g_profiler.node[type].ticks += end_ticks - begin_ticks;
+        g_profiler.node[type].calls += 1;
+    }
+}
+
+/* Opens a zone until the matching end in the same scope; a zone can only be
+ * opened once per scope.
+ */
+
+#define PROFILE_BEGIN(zone) uint64_t profile_##zone##_ticks = begin_profile_zone(g_profile_zone_##zone)
+#define PROFILE_END(zone) end_profile_zone(g_profile_zone_##zone, profile_##zone##_ticks)
+
+#else
+
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+
+#endif
+
+#if defined(ENSIM4_PROFILE) && defined(ENSIM4_PROFILE_NODES)
+#define PROFILE_NODE_BEGIN() uint64_t profile_node_ticks = read_profile_ticks()
+#define PROFILE_NODE_END(type) end_profile_node_zone(type, profile_node_ticks)
+#else
+#define PROFILE_NODE_BEGIN()
+#define PROFILE_NODE_END(type)
+#endif
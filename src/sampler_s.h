@@ -39,7 +39,7 @@ constexpr char g_sample_name_string[][64] = {
 
 #undef SAMPLES
 
-typedef double sampler_synth_t[g_synth_buffer_size];
+typedef double sampler_synth_t[g_synth_max_block_size];
 
 struct sampler_s
 {
@@ -84,7 +84,7 @@ sample_channel(struct sampler_s* self, struct node_s* node, struct nozzle_flow_s
         sample_value(self, g_sample_nozzle_static_pressure_pa, nozzle_flow->flow_field.static_pressure_pa);
         sample_value(self, g_sample_nozzle_mass_flow_rate_kg_per_s, nozzle_flow->flow_field.mass_flow_rate_kg_per_s);
         sample_value(self, g_sample_nozzle_speed_of_sound_m_per_s, nozzle_flow->flow_field.speed_of_sound_m_per_s);
-        sample_value(self, g_sample_gamma, calc_mixed_gamma(&node->as.chamber.gas));
+        sample_value(self, g_sample_gamma, calc_chamber_gamma(&node->as.chamber));
         sample_value(self, g_sample_momentum_kg_m_per_s, node->as.chamber.gas.momentum_kg_m_per_s);
         self->channel_index++;
     }
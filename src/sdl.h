@@ -580,6 +580,9 @@ draw_general_info(struct engine_s* engine, struct sdl_scroll_s* scroll)
         set_render_color(lines[i].color);
         SDL_RenderDebugTextFormat(g_sdl_renderer, scroll->x_p, newline(scroll), lines[i].name, lines[i].value);
     }
+    set_render_color(simple);
+    SDL_RenderDebugTextFormat(g_sdl_renderer, scroll->x_p, newline(scroll), "convo_mode: %s", g_convo_filter_mode_string[engine->convo_filter_mode]);
+    SDL_RenderDebugTextFormat(g_sdl_renderer, scroll->x_p, newline(scroll), "flow_mode: %s", g_flow_mode_string[engine->flow_mode]);
 }
 
 static void
@@ -596,7 +599,10 @@ draw_info_title(struct engine_s* engine, struct sdl_scroll_s* scroll)
         { g_sdl_title                   , simple                                    },
         { "the inline engine simulator" , simple                                    },
         { "    t: use_convolution"      , engine->use_convolution ? active : simple },
+        { "    o: cycle_convo_mode"     , engine->convo_filter_mode != g_convo_filter_mode_direct ? active : simple },
+        { "    f: cycle_flow_mode"      , engine->flow_mode != g_flow_mode_sequential ? active : simple },
         { "    y: use_cfd"              , engine->use_cfd         ? active : simple },
+        { "    w: use_waveguide"        , engine->use_waveguide   ? active : simple },
         { "    u: use_plot_filter"      , engine->use_plot_filter ? active : simple },
         { "    d: ignition_on"          , engine->can_ignite      ? active : simple },
         { "space: starter_on"           , engine->starter.is_on   ? active : simple },
@@ -615,13 +621,42 @@ draw_info_title(struct engine_s* engine, struct sdl_scroll_s* scroll)
     }
 }
 
+/* Cycles per phase over time, then the last frame's IPC and misses in
+ * thousands.
+ */
+
+static void
+draw_perf_counter_info(struct sdl_time_panel_s* counter_time_panel, struct perf_frame_s* perf_frame, struct sdl_scroll_s* scroll)
+{
+    draw_time_panel_info(counter_time_panel, scroll);
+    set_render_color(g_sdl_text_color);
+    SDL_RenderDebugTextFormat(g_sdl_renderer, scroll->x_p, newline(scroll), "%-6s%5s%5s%5s%5s", "", "ipc", "l1d", "llc", "br");
+    for(size_t i = 0; i < g_perf_phase_e_size; i++)
+    {
+        struct perf_count_s* count = &perf_frame->phase[i];
+        set_render_color(get_channel_color(i));
+        SDL_RenderDebugTextFormat(g_sdl_renderer, scroll->x_p, newline(scroll), "%-6.6s%5.2f%5.0f%5.0f%5.0f",
+            g_perf_phase_string[i],
+            calc_perf_ipc(count),
+            count->value[g_perf_counter_l1d_misses] / 1e3,
+            count->value[g_perf_counter_llc_misses] / 1e3,
+            count->value[g_perf_counter_branch_misses] / 1e3);
+    }
+    newline(scroll);
+}
+
+/* The counter panel is null in builds without hardware counters.
+ */
+
 static void
 draw_left_info(
     struct engine_s* engine,
     struct sdl_time_panel_s* loop_time_panel,
     struct sdl_time_panel_s* engine_time_panel,
     struct sdl_time_panel_s* audio_buffer_time_panel,
-    struct sdl_progress_bar_s* frames_per_sec_progress_bar)
+    struct sdl_progress_bar_s* frames_per_sec_progress_bar,
+    struct sdl_time_panel_s* counter_time_panel,
+    struct perf_frame_s* perf_frame)
 {
     struct sdl_scroll_s scroll = {
         .x_p = calc_plot_column_width_p(engine) + g_sdl_line_spacing_p,
@@ -633,6 +668,10 @@ draw_left_info(
     draw_time_panel_info(audio_buffer_time_panel, &scroll);
     draw_progress_bar_info(frames_per_sec_progress_bar, &scroll);
     draw_general_info(engine, &scroll);
+    if(counter_time_panel != nullptr)
+    {
+        draw_perf_counter_info(counter_time_panel, perf_frame, &scroll);
+    }
 }
 
 static void
@@ -697,13 +736,20 @@ draw_right_info_waves(
         if(node->type == g_is_eplenum)
         {
             struct eplenum_s* eplenum = &node->as.eplenum;
-            struct wave_s* wave = &g_wave_table[eplenum->wave_index];
+            struct wave_s* wave = &engine->waves.wave[eplenum->wave_index];
             if(wave_index == wave_panel_size)
             {
                 break;
             }
             struct sdl_panel_s* panel = &wave_panel[wave_index];
-            push_panel_prim(panel, wave->solver.prim, g_wave_cells);
+            if(wave->guide.is_active)
+            {
+                push_panel_prim(panel, wave->data.wave_sub_buffer_pa, min(wave->data.size, g_sampler_max_samples));
+            }
+            else
+            {
+                push_panel_prim(panel, wave->solver.prim_p, wave->solver.cells);
+            }
             draw_panel_info(panel, scroll);
             struct
             {
@@ -712,6 +758,9 @@ draw_right_info_waves(
             }
             lines[] = {
                 { "max_m_per_s %.1f", wave->solver.max_wave_speed_m_per_s },
+                { "waveguide_pipes %.0f", wave->guide.is_active ? (double) wave->guide.desc.pipes : 0.0 },
+                { "cells %.0f", (double) wave->solver.cells },
+                { "substeps %.0f", (double) wave->solver.substeps },
                 { "pipe_len_m %.2f", wave->solver.pipe_length_m },
                 { "mic_position_ratio %.2f", wave->solver.mic_position_ratio },
             };
@@ -748,27 +797,29 @@ draw_right_info(
     draw_progress_bar_info(throttle_progress_bar, &scroll);
 }
 
+/* The simulation thread does the toggling; a click off every node still
+ * clears the next selection there.
+ */
+
 static void
-toggle_node_at(struct engine_s* engine, struct sampler_s* sampler, double x_p, double y_p)
+toggle_node_at(struct engine_s* engine, struct sim_command_queue_s* commands, double x_p, double y_p)
 {
     size_t size = engine->size;
-    remove_next_selected(engine->node, size);
     SDL_FPoint points[size];
     calc_radials(engine, points, size);
+    size_t index = size;
     for(size_t i = 0; i < size; i++)
     {
-        struct node_s* node = &engine->node[i];
-        node->is_next_selected = false;
         SDL_FPoint point = points[i];
         SDL_FRect rect = { point.x, point.y, g_sdl_node_w_p, g_sdl_node_w_p };
         SDL_FPoint select = { x_p, y_p };
         if(SDL_PointInRectFloat(&select, &rect))
         {
-            clear_channel_sampler(sampler);
-            node->is_selected ^= true;
+            index = i;
             break;
         }
     }
+    push_sim_command(commands, (struct sim_command_s) { .type = g_sim_command_toggle_node, .node = index });
 }
 
 static void
@@ -819,17 +870,17 @@ draw_pistons(struct engine_s* engine)
 }
 
 static void
-draw_panic_message()
+draw_panic_message(struct engine_s* engine)
 {
-    if(g_panic_message != nullptr)
+    if(engine->panic_message != nullptr)
     {
         SDL_FPoint point = {
             .x = g_sdl_mid_x_p
         };
-        point = center_text(point, g_panic_message);
+        point = center_text(point, engine->panic_message);
         point.y += g_sdl_line_spacing_p;
         set_render_color(g_sdl_panic_color);
-        SDL_RenderDebugTextFormat(g_sdl_renderer, point.x, point.y, "%s", g_panic_message);
+        SDL_RenderDebugTextFormat(g_sdl_renderer, point.x, point.y, "%s", engine->panic_message);
     }
 }
 
@@ -847,19 +898,31 @@ draw_to_renderer(
     struct sdl_panel_s* convolution_panel_time_domain,
     struct sdl_panel_s wave_panel[],
     size_t wave_panel_size,
-    struct sdl_panel_s* synth_sample_panel)
+    struct sdl_panel_s* synth_sample_panel,
+    struct sdl_time_panel_s* counter_time_panel,
+    struct perf_frame_s* perf_frame)
 {
     clear_screen();
     draw_plots(engine, sampler);
     draw_radial_chambers(engine);
-    draw_left_info(engine, loop_time_panel, engine_time_panel, audio_buffer_time_panel, frames_per_sec_progress_bar);
+    draw_left_info(engine, loop_time_panel, engine_time_panel, audio_buffer_time_panel, frames_per_sec_progress_bar, counter_time_panel, perf_frame);
     draw_right_info(engine, starter_panel_r_per_s, convolution_panel_time_domain, r_per_s_progress_bar, wave_panel, wave_panel_size, synth_sample_panel, throttle_progress_bar);
     draw_pistons(engine);
-    draw_panic_message();
+    draw_panic_message(engine);
+}
+
+static void
+push_key_command(struct sim_command_queue_s* commands, enum sim_command_e type)
+{
+    push_sim_command(commands, (struct sim_command_s) { .type = type });
 }
 
+/* Engine is the latest snapshot, only read to place clicks, and may be null
+ * before the first one lands.
+ */
+
 static bool
-handle_input(struct engine_s* engine, struct sampler_s* sampler)
+handle_input(struct engine_s* engine, struct sim_command_queue_s* commands)
 {
     SDL_Event event;
     while(SDL_PollEvent(&event))
@@ -872,31 +935,43 @@ handle_input(struct engine_s* engine, struct sampler_s* sampler)
             switch(event.key.key)
             {
             case SDLK_SPACE:
-                engine->starter.is_on = true;
+                if(!event.key.repeat)
+                {
+                    push_key_command(commands, g_sim_command_starter_on);
+                }
                 break;
             case SDLK_D:
-                engine->can_ignite ^= true;
+                push_key_command(commands, g_sim_command_toggle_ignition);
                 break;
             case SDLK_H:
-                engine->throttle_open_ratio = engine->no_throttle;
+                push_key_command(commands, g_sim_command_no_throttle);
                 break;
             case SDLK_J:
-                engine->throttle_open_ratio = engine->low_throttle;
+                push_key_command(commands, g_sim_command_low_throttle);
                 break;
             case SDLK_K:
-                engine->throttle_open_ratio = engine->mid_throttle;
+                push_key_command(commands, g_sim_command_mid_throttle);
                 break;
             case SDLK_L:
-                engine->throttle_open_ratio = engine->high_throttle;
+                push_key_command(commands, g_sim_command_high_throttle);
                 break;
             case SDLK_Y:
-                enable_engine_cfd(engine, engine->use_cfd ^= true);
+                push_key_command(commands, g_sim_command_toggle_cfd);
+                break;
+            case SDLK_W:
+                push_key_command(commands, g_sim_command_toggle_waveguide);
                 break;
             case SDLK_U:
-                engine->use_plot_filter ^= true;
+                push_key_command(commands, g_sim_command_toggle_plot_filter);
                 break;
             case SDLK_T:
-                engine->use_convolution ^= true;
+                push_key_command(commands, g_sim_command_toggle_convolution);
+                break;
+            case SDLK_O:
+                push_key_command(commands, g_sim_command_cycle_convo_mode);
+                break;
+            case SDLK_F:
+                push_key_command(commands, g_sim_command_cycle_flow_mode);
                 break;
             }
             break;
@@ -904,30 +979,22 @@ handle_input(struct engine_s* engine, struct sampler_s* sampler)
             switch(event.key.key)
             {
             case SDLK_SPACE:
-                engine->starter.is_on = false;
+                push_key_command(commands, g_sim_command_starter_off);
                 break;
             case SDLK_P:
-                deselect_all_nodes(engine->node, engine->size);
-                select_nodes(engine->node, engine->size, g_is_piston);
+                push_key_command(commands, g_sim_command_select_pistons);
                 break;
             case SDLK_I:
-                deselect_all_nodes(engine->node, engine->size);
-                select_nodes(engine->node, engine->size, g_is_afilter);
-                select_nodes(engine->node, engine->size, g_is_throttle);
-                select_nodes(engine->node, engine->size, g_is_iplenum);
-                select_nodes(engine->node, engine->size, g_is_irunner);
+                push_key_command(commands, g_sim_command_select_intake);
                 break;
             case SDLK_E:
-                deselect_all_nodes(engine->node, engine->size);
-                select_nodes(engine->node, engine->size, g_is_eplenum);
-                select_nodes(engine->node, engine->size, g_is_erunner);
-                select_nodes(engine->node, engine->size, g_is_exhaust);
+                push_key_command(commands, g_sim_command_select_exhaust);
                 break;
             case SDLK_C:
-                deselect_all_nodes(engine->node, engine->size);
+                push_key_command(commands, g_sim_command_deselect_all);
                 break;
             case SDLK_N:
-                select_next(engine->node, engine->size);
+                push_key_command(commands, g_sim_command_select_next);
                 break;
             }
             break;
@@ -935,7 +1002,10 @@ handle_input(struct engine_s* engine, struct sampler_s* sampler)
             switch(event.button.button)
             {
             case SDL_BUTTON_LEFT:
-                toggle_node_at(engine, sampler, event.button.x, event.button.y);
+                if(engine != nullptr)
+                {
+                    toggle_node_at(engine, commands, event.button.x, event.button.y);
+                }
                 break;
             case SDL_BUTTON_RIGHT:
                 break;
@@ -1,5 +1,19 @@
 static SDL_AudioStream* g_sdl_audio_stream = nullptr;
 static SDL_AudioSpec g_sdl_audio_spec = {};
+static SDL_Semaphore* g_sdl_audio_demand = nullptr;
+
+/* Runs on the audio device thread each time it drains the stream.
+ */
+
+static void SDLCALL
+signal_audio_demand(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount)
+{
+    (void) userdata;
+    (void) stream;
+    (void) additional_amount;
+    (void) total_amount;
+    SDL_SignalSemaphore(g_sdl_audio_demand);
+}
 
 static void
 init_sdl_audio()
@@ -8,6 +22,8 @@ init_sdl_audio()
     g_sdl_audio_spec.format = SDL_AUDIO_F32;
     g_sdl_audio_spec.freq = g_std_audio_sample_rate_hz;
     g_sdl_audio_stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &g_sdl_audio_spec, nullptr, nullptr);
+    g_sdl_audio_demand = SDL_CreateSemaphore(0);
+    SDL_SetAudioStreamGetCallback(g_sdl_audio_stream, signal_audio_demand, nullptr);
     SDL_ResumeAudioStreamDevice(g_sdl_audio_stream);
 }
 
@@ -15,6 +31,23 @@ static void
 exit_sdl_audio()
 {
     SDL_DestroyAudioStream(g_sdl_audio_stream);
+    SDL_DestroySemaphore(g_sdl_audio_demand);
+}
+
+/* Blocks until the device pulls from the stream, wake_audio_demand is called,
+ * or the timeout passes.
+ */
+
+static void
+wait_for_audio_demand(int32_t timeout_ms)
+{
+    SDL_WaitSemaphoreTimeout(g_sdl_audio_demand, timeout_ms);
+}
+
+static void
+wake_audio_demand()
+{
+    SDL_SignalSemaphore(g_sdl_audio_demand);
 }
 
 static size_t
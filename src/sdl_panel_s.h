@@ -38,11 +38,11 @@ push_panel_double(struct sdl_panel_s* self, const double value[], size_t size)
 }
 
 static void
-push_panel_prim(struct sdl_panel_s* self, struct wave_prim_s prim[], size_t size)
+push_panel_prim(struct sdl_panel_s* self, const double static_pressure_pa[], size_t size)
 {
     for(size_t i = 0; i < size; i++)
     {
-        self->sample[i] = prim[i].p;
+        self->sample[i] = static_pressure_pa[i];
     }
     self->size = size;
     self->normalized = normalize_samples(self->sample, self->size);
@@ -27,6 +27,22 @@ static struct sdl_time_panel_s g_engine_time_panel = {
     .rect.h = 96,
 };
 
+static struct sdl_time_panel_s g_counter_time_panel = {
+    .title = "counter_mcycles",
+    .labels = {
+        "flow",
+        "kinematics",
+        "thermo",
+        "wave_batch",
+        "convolution",
+        "draw",
+    },
+    .min_value = 0.0,
+    .max_value = 50.0,
+    .rect.w = g_sdl_supported_widget_w_p,
+    .rect.h = 96,
+};
+
 static struct sdl_time_panel_s g_audio_buffer_time_panel = {
     .title = "audio_buffer_size",
     .labels = {
@@ -74,7 +90,7 @@ static struct sdl_panel_s g_convolution_panel_time_domain = {
     .rect.h = 64,
 };
 
-static struct sdl_panel_s g_wave_panel[g_wave_max_waves] = {
+static struct sdl_panel_s g_wave_panel[] = {
     { .title = "wave_0_pa", .rect.w = g_sdl_supported_widget_w_p, .rect.h = 48 },
     { .title = "wave_1_pa", .rect.w = g_sdl_supported_widget_w_p, .rect.h = 48 },
     { .title = "wave_2_pa", .rect.w = g_sdl_supported_widget_w_p, .rect.h = 48 },
@@ -151,5 +167,16 @@ push_widgets(
     push_panel(
         &g_synth_sample_panel,
         sampler_synth,
-        g_synth_buffer_size);
+        engine->block_size);
+}
+
+static void
+push_perf_widgets(struct perf_frame_s* perf_frame)
+{
+    double mcycles[g_sdl_time_panel_size] = {};
+    for(size_t i = 0; i < g_perf_phase_e_size; i++)
+    {
+        mcycles[i] = perf_frame->phase[i].value[g_perf_counter_cycles] / 1e6;
+    }
+    push_time_panel(&g_counter_time_panel, mcycles);
 }
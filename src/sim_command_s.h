@@ -0,0 +1,184 @@
+/*
+ * What the render thread asks of the simulation thread. Input never touches the
+ * engine directly: keys and clicks become commands in a single producer, single
+ * consumer ring, and the simulation thread applies them between blocks. Head and
+ * tail only ever grow and each is written by one side only.
+ */
+
+constexpr size_t g_sim_command_capacity = 256;
+
+#define SIM_COMMANDS      \
+    X(starter_on)         \
+    X(starter_off)        \
+    X(toggle_ignition)    \
+    X(no_throttle)        \
+    X(low_throttle)       \
+    X(mid_throttle)       \
+    X(high_throttle)      \
+    X(toggle_cfd)         \
+    X(toggle_waveguide)   \
+    X(toggle_plot_filter) \
+    X(toggle_convolution) \
+    X(cycle_convo_mode)   \
+    X(cycle_flow_mode)    \
+    X(select_pistons)     \
+    X(select_intake)      \
+    X(select_exhaust)     \
+    X(deselect_all)       \
+    X(select_next)        \
+    X(toggle_node)        \
+    X(reload)
+
+enum sim_command_e
+{
+#define X(name) g_sim_command_##name,
+    SIM_COMMANDS
+#undef X
+    g_sim_command_e_size
+};
+
+#undef SIM_COMMANDS
+
+/* Node is the index toggle_node flips.
+ */
+
+struct sim_command_s
+{
+    enum sim_command_e type;
+    size_t node;
+};
+
+struct sim_command_queue_s
+{
+    alignas(g_wave_cache_line_bytes) atomic_size_t head;
+    alignas(g_wave_cache_line_bytes) atomic_size_t tail;
+    struct sim_command_s command[g_sim_command_capacity];
+};
+
+/* A full ring drops the command; input outpacing a running simulation by a
+ * whole ring means the simulation is stuck anyway.
+ */
+
+static bool
+push_sim_command(struct sim_command_queue_s* self, struct sim_command_s command)
+{
+    size_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&self->head, memory_order_acquire);
+    if(tail - head == g_sim_command_capacity)
+    {
+        return false;
+    }
+    self->command[tail % g_sim_command_capacity] = command;
+    atomic_store_explicit(&self->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+static bool
+pop_sim_command(struct sim_command_queue_s* self, struct sim_command_s* command)
+{
+    size_t head = atomic_load_explicit(&self->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&self->tail, memory_order_acquire);
+    if(head == tail)
+    {
+        return false;
+    }
+    *command = self->command[head % g_sim_command_capacity];
+    atomic_store_explicit(&self->head, head + 1, memory_order_release);
+    return true;
+}
+
+static void
+toggle_engine_node(struct engine_s* engine, struct sampler_s* sampler, size_t index)
+{
+    remove_next_selected(engine->node, engine->size);
+    for(size_t i = 0; i < engine->size; i++)
+    {
+        struct node_s* node = &engine->node[i];
+        node->is_next_selected = false;
+        if(i == index)
+        {
+            clear_channel_sampler(sampler);
+            node->is_selected ^= true;
+            break;
+        }
+    }
+}
+
+/* Everything but reload, which needs the host's hot reload state.
+ */
+
+static void
+apply_sim_command(struct engine_s* engine, struct sampler_s* sampler, struct sim_command_s command)
+{
+    switch(command.type)
+    {
+    case g_sim_command_starter_on:
+        engine->starter.is_on = true;
+        break;
+    case g_sim_command_starter_off:
+        engine->starter.is_on = false;
+        break;
+    case g_sim_command_toggle_ignition:
+        engine->can_ignite ^= true;
+        break;
+    case g_sim_command_no_throttle:
+        engine->throttle_open_ratio = engine->no_throttle;
+        break;
+    case g_sim_command_low_throttle:
+        engine->throttle_open_ratio = engine->low_throttle;
+        break;
+    case g_sim_command_mid_throttle:
+        engine->throttle_open_ratio = engine->mid_throttle;
+        break;
+    case g_sim_command_high_throttle:
+        engine->throttle_open_ratio = engine->high_throttle;
+        break;
+    case g_sim_command_toggle_cfd:
+        enable_engine_cfd(engine, engine->use_cfd ^= true);
+        break;
+    case g_sim_command_toggle_waveguide:
+        enable_engine_waveguide(engine, engine->use_waveguide ^= true);
+        break;
+    case g_sim_command_toggle_plot_filter:
+        engine->use_plot_filter ^= true;
+        break;
+    case g_sim_command_toggle_convolution:
+        engine->use_convolution ^= true;
+        break;
+    case g_sim_command_cycle_convo_mode:
+        engine->convo_filter_mode = (engine->convo_filter_mode + 1) % g_convo_filter_mode_e_size;
+        break;
+    case g_sim_command_cycle_flow_mode:
+        engine->flow_mode = (engine->flow_mode + 1) % g_flow_mode_e_size;
+        break;
+    case g_sim_command_select_pistons:
+        deselect_all_nodes(engine->node, engine->size);
+        select_nodes(engine->node, engine->size, g_is_piston);
+        break;
+    case g_sim_command_select_intake:
+        deselect_all_nodes(engine->node, engine->size);
+        select_nodes(engine->node, engine->size, g_is_afilter);
+        select_nodes(engine->node, engine->size, g_is_throttle);
+        select_nodes(engine->node, engine->size, g_is_iplenum);
+        select_nodes(engine->node, engine->size, g_is_irunner);
+        break;
+    case g_sim_command_select_exhaust:
+        deselect_all_nodes(engine->node, engine->size);
+        select_nodes(engine->node, engine->size, g_is_eplenum);
+        select_nodes(engine->node, engine->size, g_is_erunner);
+        select_nodes(engine->node, engine->size, g_is_exhaust);
+        break;
+    case g_sim_command_deselect_all:
+        deselect_all_nodes(engine->node, engine->size);
+        break;
+    case g_sim_command_select_next:
+        select_next(engine->node, engine->size);
+        break;
+    case g_sim_command_toggle_node:
+        toggle_engine_node(engine, sampler, command.node);
+        break;
+    case g_sim_command_reload:
+    case g_sim_command_e_size:
+        break;
+    }
+}
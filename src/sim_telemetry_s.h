@@ -0,0 +1,159 @@
+/*
+ * What the simulation thread shows the render thread. Snapshots rotate through
+ * a triple buffer: the simulation fills the back one and swaps it into the
+ * middle, the renderer swaps the middle out for its front one when it holds a
+ * fresh snapshot. Neither side waits on the other, and the simulation only pays
+ * for a copy once the renderer has taken the last one.
+ *
+ * A snapshot is an engine whose nodes, sampler, and waves are the snapshot's
+ * own copies of what the renderer reads, its name included since a reload
+ * rewrites the live one. Only the exhaust waves the panels draw
+ * are copied, and of each only the pressure trace it plots; every other pointer
+ * in a snapshot wave or the snapshot engine is null.
+ */
+
+constexpr size_t g_sim_telemetry_max_nodes = 1024;
+constexpr size_t g_sim_telemetry_max_waves = 16;
+constexpr size_t g_sim_telemetry_name_size = 128;
+constexpr unsigned g_sim_telemetry_fresh = 1u << 2;
+
+struct sim_snapshot_s
+{
+    struct engine_s engine;
+    char name[g_sim_telemetry_name_size];
+    struct engine_time_s engine_time;
+    double run_time_ms;
+    size_t audio_buffer_size;
+    sampler_synth_t sampler_synth;
+    struct sampler_s sampler;
+    struct node_s node[g_sim_telemetry_max_nodes];
+    struct wave_s wave[g_sim_telemetry_max_waves];
+    double wave_pa[g_sim_telemetry_max_waves][g_sampler_max_samples];
+};
+
+struct sim_telemetry_s
+{
+    struct sim_snapshot_s snapshot[3];
+    alignas(g_wave_cache_line_bytes) atomic_uint middle;
+    alignas(g_wave_cache_line_bytes) unsigned back;
+    alignas(g_wave_cache_line_bytes) unsigned front;
+    bool has_front;
+};
+
+static void
+reset_sim_telemetry(struct sim_telemetry_s* self)
+{
+    self->back = 0;
+    atomic_store(&self->middle, 1);
+    self->front = 2;
+    self->has_front = false;
+}
+
+static void
+copy_sim_sampler(struct sampler_s* self, struct sampler_s* sampler)
+{
+    for(size_t channel = 0; channel < sampler->channel_index; channel++)
+    {
+        for(size_t name = 0; name < g_sample_name_e_size; name++)
+        {
+            memcpy(self->channel[channel][name], sampler->channel[channel][name], sampler->size * sizeof(double));
+        }
+    }
+    memcpy(self->starter, sampler->starter, sampler->size * sizeof(double));
+    self->index = sampler->index;
+    self->channel_index = sampler->channel_index;
+    self->size = sampler->size;
+}
+
+/* The k-th exhaust plenum of the copy owns wave k, so the renderer finds the
+ * same waves in the same order whatever the live table's indices are.
+ */
+
+static void
+copy_sim_waves(struct sim_snapshot_s* self, struct engine_s* engine)
+{
+    size_t waves = 0;
+    for(size_t i = 0; i < self->engine.size; i++)
+    {
+        struct node_s* node = &self->node[i];
+        if(node->type == g_is_eplenum && waves < g_sim_telemetry_max_waves)
+        {
+            struct wave_s* wave = &engine->waves.wave[node->as.eplenum.wave_index];
+            struct wave_s* copy = &self->wave[waves];
+            double* pa = self->wave_pa[waves];
+            size_t size = wave->guide.is_active ? min(wave->data.size, g_sampler_max_samples) : min(wave->solver.cells, g_sampler_max_samples);
+            memcpy(pa, wave->guide.is_active ? wave->data.wave_sub_buffer_pa : wave->solver.prim_p, size * sizeof(*pa));
+            *copy = (struct wave_s) {};
+            copy->data.wave_sub_buffer_pa = pa;
+            copy->data.size = wave->guide.is_active ? size : 0;
+            copy->solver.prim_p = pa;
+            copy->solver.cells = wave->guide.is_active ? 0 : size;
+            copy->solver.substeps = wave->solver.substeps;
+            copy->solver.max_wave_speed_m_per_s = wave->solver.max_wave_speed_m_per_s;
+            copy->solver.pipe_length_m = wave->solver.pipe_length_m;
+            copy->solver.mic_position_ratio = wave->solver.mic_position_ratio;
+            copy->guide.is_active = wave->guide.is_active;
+            copy->guide.desc.pipes = wave->guide.desc.pipes;
+            node->as.eplenum.wave_index = waves++;
+        }
+    }
+    self->engine.waves = (struct wave_table_s) {
+        .wave = self->wave,
+        .size = waves,
+    };
+}
+
+/* Called by the simulation thread between blocks, with every wave job done.
+ */
+
+static void
+publish_sim_telemetry(
+    struct sim_telemetry_s* self,
+    struct engine_s* engine,
+    struct engine_time_s* engine_time,
+    double run_time_ms,
+    struct sampler_s* sampler,
+    sampler_synth_t sampler_synth,
+    size_t audio_buffer_size)
+{
+    if(atomic_load_explicit(&self->middle, memory_order_acquire) & g_sim_telemetry_fresh)
+    {
+        return;
+    }
+    struct sim_snapshot_s* snapshot = &self->snapshot[self->back];
+    size_t size = min(engine->size, g_sim_telemetry_max_nodes);
+    memcpy(snapshot->node, engine->node, size * sizeof(*snapshot->node));
+    snapshot->engine = *engine;
+    snprintf(snapshot->name, sizeof(snapshot->name), "%s", engine->name ? engine->name : "");
+    snapshot->engine.name = snapshot->name;
+    snapshot->engine.node = snapshot->node;
+    snapshot->engine.size = size;
+    snapshot->engine.edge = nullptr;
+    snapshot->engine.edges = 0;
+    snapshot->engine.batch_flow = (struct batch_flow_s) {};
+    snapshot->engine.wave_job = nullptr;
+    copy_sim_waves(snapshot, engine);
+    copy_sim_sampler(&snapshot->sampler, sampler);
+    memcpy(snapshot->sampler_synth, sampler_synth, engine->block_size * sizeof(*sampler_synth));
+    snapshot->engine_time = *engine_time;
+    snapshot->run_time_ms = run_time_ms;
+    snapshot->audio_buffer_size = audio_buffer_size;
+    unsigned middle = atomic_exchange_explicit(&self->middle, self->back | g_sim_telemetry_fresh, memory_order_acq_rel);
+    self->back = middle & ~g_sim_telemetry_fresh;
+}
+
+/* The latest snapshot, or null until the first one lands. It stays the
+ * renderer's until the next call.
+ */
+
+static struct sim_snapshot_s*
+acquire_sim_telemetry(struct sim_telemetry_s* self)
+{
+    if(atomic_load_explicit(&self->middle, memory_order_relaxed) & g_sim_telemetry_fresh)
+    {
+        unsigned middle = atomic_exchange_explicit(&self->middle, self->front, memory_order_acq_rel);
+        self->front = middle & ~g_sim_telemetry_fresh;
+        self->has_front = true;
+    }
+    return self->has_front ? &self->snapshot[self->front] : nullptr;
+}
@@ -0,0 +1,52 @@
+/*
+ * Runtime instruction set selection for hand vectorized kernels.
+ *
+ * Vector kernels are compiled with per function target attributes, so a build
+ * without -march flags still carries them, and the widest one the host supports
+ * is picked at runtime. Other compilers and architectures get the scalar kernels.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ENSIM4_SIMD_X86
+#include <immintrin.h>
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#define SIMD_LEVELS \
+    X(scalar)       \
+    X(avx2)         \
+    X(avx512)
+
+enum simd_level_e
+{
+#define X(level) g_simd_level_##level,
+    SIMD_LEVELS
+#undef X
+    g_simd_level_e_size
+};
+
+constexpr char g_simd_level_string[][16] = {
+#define X(level) #level,
+    SIMD_LEVELS
+#undef X
+};
+
+#undef SIMD_LEVELS
+
+static enum simd_level_e
+detect_simd_level()
+{
+#ifdef ENSIM4_SIMD_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f"))
+    {
+        return g_simd_level_avx512;
+    }
+    if(__builtin_cpu_supports("avx2"))
+    {
+        return g_simd_level_avx2;
+    }
+#endif
+    return g_simd_level_scalar;
+}
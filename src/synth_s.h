@@ -1,35 +1,97 @@
-struct engine_s;
-extern struct engine_s g_engine;
-extern double g_current_volume;
-
 constexpr size_t g_synth_buffer_size = g_std_audio_sample_rate_hz / g_std_monitor_refresh_rate;
 constexpr size_t g_synth_buffer_min_size = 1 * g_synth_buffer_size;
 constexpr size_t g_synth_buffer_max_size = 4 * g_synth_buffer_size;
+constexpr size_t g_synth_min_block_size = 32;
+constexpr size_t g_synth_max_block_size = 8192;
 constexpr double g_synth_dc_filter_cutoff_frequency_hz = 10.0;
 constexpr double g_synth_deadzone_angular_velocity_r_per_s = 1.0;
 constexpr double g_synth_clamp = 1.0;
 constexpr double g_synth_expected_pressure_pa = 1e6;
 
 
+/* Volume is the output gain, applied after the clamp, and belongs to whoever
+ * plays the synth rather than to the engine. Blocks land in value unless the
+ * host redirects them straight into its own buffer. Value holds size frames,
+ * planned by the engine to its block size.
+ */
+
 struct synth_s
 {
     struct highpass_filter_s dc_filter;
     struct convo_filter_s convo_filter;
-    float value[g_synth_buffer_size];
+    float* value;
+    size_t size;
+    float* out;
     size_t index;
+    double volume;
 };
 
 static void
 sample_synth(struct synth_s* self, double value)
 {
-    self->value[self->index++] += value;
+    float* out = self->out ? self->out : self->value;
+    out[self->index++] = value;
 }
 
 static void
 clear_synth(struct synth_s* self)
 {
     self->index = 0;
-    clear(self->value);
+    self->out = nullptr;
+    if(self->value)
+    {
+        memset(self->value, 0, self->size * sizeof(*self->value));
+    }
+}
+
+static bool
+plan_synth(struct synth_s* self, size_t size)
+{
+    if(self->size == size)
+    {
+        return true;
+    }
+    float* value = calloc(size, sizeof(*value));
+    if(value == nullptr)
+    {
+        return false;
+    }
+    free(self->value);
+    self->value = value;
+    self->size = size;
+    return true;
+}
+
+static void
+free_synth(struct synth_s* self)
+{
+    free_convo_uniform(&self->convo_filter.uniform);
+    free_convo_non_uniform(&self->convo_filter.non_uniform);
+    free(self->value);
+    self->value = nullptr;
+    self->size = 0;
+}
+
+/* Starts the filters over. The convolution plans are freed and tail jobs
+ * finished before the state is cleared; only the volume survives.
+ */
+
+static void
+reset_synth(struct synth_s* self)
+{
+    double volume = self->volume;
+    free_synth(self);
+    *self = (struct synth_s) { .volume = volume };
+}
+
+/* The next block is written to out, which must hold a block of frames.
+ */
+
+static void
+redirect_synth(struct synth_s* self, float* out)
+{
+    self->index = 0;
+    self->out = out;
 }
 
 static double
@@ -49,18 +111,38 @@ set_synth_deadzone(double value, struct crankshaft_s* crankshaft)
     return value;
 }
 
-static double
-push_synth(struct synth_s* self, struct crankshaft_s* crankshaft, double value, bool use_convolution, double volume)
+/* The dc and convolution filters run over the whole block at once. The
+ * convolution keeps its own fixed partitions, so the block may be any size.
+ */
+
+static const char*
+filter_synth(
+    struct synth_s* self,
+    double values[],
+    size_t size,
+    bool use_convolution,
+    enum convo_filter_mode_e convo_filter_mode,
+    const double impulse[],
+    size_t impulse_size)
 {
-    value = filter_highpass(&self->dc_filter, g_synth_dc_filter_cutoff_frequency_hz, value);
+    for(size_t i = 0; i < size; i++)
+    {
+        values[i] = filter_highpass(&self->dc_filter, g_synth_dc_filter_cutoff_frequency_hz, values[i]);
+    }
     if(use_convolution)
     {
-        value = filter_convo(&self->convo_filter, value);
+        return filter_convo_block(&self->convo_filter, convo_filter_mode, impulse, impulse_size, values, size);
     }
+    return nullptr;
+}
+
+static double
+push_synth(struct synth_s* self, struct crankshaft_s* crankshaft, double value, double volume)
+{
     value = value * volume / g_synth_expected_pressure_pa;
     value = set_synth_deadzone(value, crankshaft);
     value = clamp_synth(value);
-    value *= g_current_volume;
+    value *= self->volume;
     sample_synth(self, value);
     return value;
 }
@@ -2,6 +2,13 @@
 
 #include <SDL3/SDL.h>
 
+#if defined(ENSIM4_PIN_THREADS) && defined(_WIN32)
+#include <windows.h>
+#elif defined(ENSIM4_PIN_THREADS) && defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 /* Minimal C11 threads.h compatibility layer using SDL3 threads.
    Enough for typical thrd_create/join and mutex usage. */
 
@@ -48,5 +55,68 @@ static inline void mtx_destroy(mtx_t* m) {
     *m = NULL;
 }
 
+/* Condition variable */
+typedef SDL_Condition* cnd_t;
+
+static inline int cnd_init(cnd_t* c) {
+    SDL_Condition* cv = SDL_CreateCondition();
+    if (!cv) return thrd_error;
+    *c = cv;
+    return thrd_success;
+}
+
+static inline int cnd_signal(cnd_t* c) {
+    SDL_SignalCondition(*c);
+    return thrd_success;
+}
+
+static inline int cnd_broadcast(cnd_t* c) {
+    SDL_BroadcastCondition(*c);
+    return thrd_success;
+}
+
+static inline int cnd_wait(cnd_t* c, mtx_t* m) {
+    SDL_WaitCondition(*c, *m);
+    return thrd_success;
+}
+
+static inline void cnd_destroy(cnd_t* c) {
+    if (*c) SDL_DestroyCondition(*c);
+    *c = NULL;
+}
+
+static inline void thrd_yield(void) { SDL_Delay(0); }
+
+/* Spin-wait hint, a no-op where the CPU has none. */
+static inline void thrd_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/* Pins the calling thread to one logical core. Only built with ENSIM4_PIN_THREADS
+   (Linux also needs -D_GNU_SOURCE); otherwise it reports thrd_error and does nothing. */
+static inline int thrd_pin_current(size_t core) {
+#if defined(ENSIM4_PIN_THREADS) && defined(_WIN32)
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << core) ? thrd_success : thrd_error;
+#elif defined(ENSIM4_PIN_THREADS) && defined(__linux__) && defined(CPU_SET)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? thrd_success : thrd_error;
+#else
+    (void)core;
+    return thrd_error;
+#endif
+}
+
+/* Raises the calling thread's scheduling priority, for threads that feed the
+   audio device. Reports thrd_error where the OS refuses. */
+static inline int thrd_prioritize_current(void) {
+    return SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL) ? thrd_success : thrd_error;
+}
+
 /* Sleep helper (optional) */
 static inline void thrd_sleep_ms(unsigned ms) { SDL_Delay(ms); }
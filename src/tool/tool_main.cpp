@@ -11,6 +11,22 @@ extern "C" {
 #include "backends/imgui_impl_sdl3.h"
 #include "backends/imgui_impl_sdlrenderer3.h"
 
+constexpr size_t g_tool_latency_frames = 2048;
+constexpr int g_tool_pull_frames = 1024;
+
+// Callback de audio de SDL: corre en el hilo de audio y sólo saca del ring del stream.
+static void SDLCALL pull_audio(void* userdata, SDL_AudioStream* stream, int additional_amount, int) {
+    ensim_context_t* ctx = (ensim_context_t*)userdata;
+    float frames[g_tool_pull_frames];
+    int frames_left = additional_amount / (int)sizeof(float);
+    while (frames_left > 0) {
+        int size = frames_left < g_tool_pull_frames ? frames_left : g_tool_pull_frames;
+        ensim_pull_f32(ctx, frames, (size_t)size);
+        SDL_PutAudioStreamData(stream, frames, size * (int)sizeof(float));
+        frames_left -= size;
+    }
+}
+
 static void default_params(ensim_engine_params_t* p) {
     *p = {};
     p->cylinders = 4;
@@ -64,7 +80,7 @@ static void default_params(ensim_engine_params_t* p) {
 }
 
 int main(int, char**) {
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) != 0) return 1;
+    if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) return 1;
 
     SDL_Window* win = SDL_CreateWindow("ensim tool", 1280, 720, 0);
     SDL_Renderer* ren = SDL_CreateRenderer(win, nullptr, 0);
@@ -85,6 +101,12 @@ int main(int, char**) {
     ensim_set_starter(ctx, 0);
     ensim_set_throttle(ctx, 0.0f);
 
+    // audio: el core simula por adelantado en su hilo y SDL tira del ring
+    ensim_stream_start(ctx, g_tool_latency_frames);
+    SDL_AudioSpec spec = { SDL_AUDIO_F32, 1, 48000 };
+    SDL_AudioStream* audio = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, pull_audio, ctx);
+    if (audio) SDL_ResumeAudioStreamDevice(audio);
+
     bool running = true;
     float throttle = 0.0f;
     bool starter = false;
@@ -117,6 +139,7 @@ int main(int, char**) {
         ImGui::Checkbox("Starter", &starter);
 
         ImGui::Text("RPM: %.0f", (double)ensim_get_rpm(ctx));
+        ImGui::Text("Underruns: %zu", ensim_stream_get_underruns(ctx));
         ImGui::End();
 
         if (rebuild) {
@@ -136,6 +159,7 @@ int main(int, char**) {
         SDL_RenderPresent(ren);
     }
 
+    if (audio) SDL_DestroyAudioStream(audio);
     ensim_destroy(ctx);
     ImGui_ImplSDLRenderer3_Shutdown();
     ImGui_ImplSDL3_Shutdown();
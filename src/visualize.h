@@ -101,6 +101,8 @@ visualize_chamber_s()
         struct nozzle_flow_s nozzle_flow = flow(&x, &y);
         if(nozzle_flow.is_success)
         {
+            nozzle_flow.gas_mail.x_momentum_damping_ratio = calc_momentum_damping_ratio(nozzle_flow.gas_mail.x);
+            nozzle_flow.gas_mail.y_momentum_damping_ratio = calc_momentum_damping_ratio(nozzle_flow.gas_mail.y);
             mail_gas_mail(&nozzle_flow.gas_mail);
         }
         fprintf(
@@ -0,0 +1,183 @@
+/*
+ * Headless wave solver benchmark.
+ *
+ * Drives one pipe with a synthetic exhaust pulse train through batch_wave, once
+ * per instruction set level the host supports, and reports the mean CFL substep
+ * count, cell updates per second (cells x substeps x samples / s), and the
+ * largest deviation of each level's output from the scalar kernels, failing if
+ * it exceeds g_wave_bench_max_error_pa, then times the same pipe as a single
+ * open ended waveguide.
+ *
+ *   make wave_bench && ./wave_bench [blocks]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+#include <stdatomic.h>
+
+#include "threads.h"
+#include "std.h"
+#include "simd.h"
+#include "profile_s.h"
+#include "perf_counter_s.h"
+#include "normalized_s.h"
+#include "fft_s.h"
+#include "convo_filter_s.h"
+#include "highpass_filter_s.h"
+#include "lowpass_filter_s.h"
+#include "cp_table.h"
+#include "gamma.h"
+#include "isentropic.h"
+#include "gas_s.h"
+#include "chamber_s.h"
+#include "gas_mail_s.h"
+#include "nozzle_flow_s.h"
+#include "visualize.h"
+#include "crankshaft_s.h"
+#include "sparkplug_s.h"
+#include "flywheel_s.h"
+#include "starter_s.h"
+#include "limiter_s.h"
+#include "valve_s.h"
+#include "synth_s.h"
+#include "waveguide_tube_s.h"
+#include "waveguide_s.h"
+#include "wave_s.h"
+
+constexpr double g_wave_bench_pipe_length_m = 1.2;
+constexpr double g_wave_bench_pipe_diameter_m = 0.05;
+constexpr double g_wave_bench_mic_position_ratio = 0.9;
+constexpr double g_wave_bench_cutoff_frequency_hz = 1000.0;
+constexpr double g_wave_bench_pulse_frequency_hz = 150.0;
+constexpr size_t g_wave_bench_default_blocks = 600;
+constexpr double g_wave_bench_max_error_pa = 1e-6;
+
+static double
+get_wave_bench_time_s()
+{
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+/* Firing pulses at a fixed rate, hot and pressurized over the first fifth of
+ * each period and ambient otherwise.
+ */
+
+static void
+stage_wave_bench_pulses(struct wave_s* wave, size_t block)
+{
+    for(size_t i = 0; i < g_synth_buffer_size; i++)
+    {
+        double t_s = (block * g_synth_buffer_size + i) * g_std_dt_s;
+        double phase = fmod(t_s * g_wave_bench_pulse_frequency_hz, 1.0);
+        double pulse = phase < 0.2 ? sin(g_std_pi_r * phase / 0.2) : 0.0;
+        stage_wave(wave, (struct wave_prim_s) {
+            .r = g_gas_ambient_static_density_kg_per_m3 * (1.0 - 0.4 * pulse),
+            .u = 60.0 * pulse,
+            .p = g_gas_ambient_static_pressure_pa * (1.0 + 0.6 * pulse),
+        });
+    }
+    flip_wave(wave);
+}
+
+static double
+run_wave_bench(struct wave_s* wave, const struct waveguide_desc_s* waveguide, enum simd_level_e simd_level, size_t blocks, double* output_pa, double* cell_updates)
+{
+    reset_wave(wave);
+    wave->solver.u_filter = (struct lowpass_filter_3_s) {};
+    wave->solver.simd_level = simd_level;
+    double elapsed_s = 0.0;
+    *cell_updates = 0.0;
+    for(size_t block = 0; block < blocks; block++)
+    {
+        stage_wave_bench_pulses(wave, block);
+        double start_s = get_wave_bench_time_s();
+        batch_wave(wave, true, waveguide, g_wave_bench_pipe_length_m, g_wave_bench_mic_position_ratio, g_wave_bench_cutoff_frequency_hz);
+        elapsed_s += get_wave_bench_time_s() - start_s;
+        *cell_updates += (double) g_synth_buffer_size * wave->solver.substeps * wave->solver.cells;
+        memcpy(&output_pa[block * g_synth_buffer_size], wave->data.wave_sub_buffer_pa, g_synth_buffer_size * sizeof(*output_pa));
+    }
+    return elapsed_s;
+}
+
+int
+main(int argc, char* argv[])
+{
+    size_t blocks = argc > 1 ? strtoul(argv[1], nullptr, 10) : g_wave_bench_default_blocks;
+    if(blocks == 0)
+    {
+        fprintf(stderr, "usage: %s [blocks]\n", argv[0]);
+        return 1;
+    }
+    size_t samples = blocks * g_synth_buffer_size;
+    double* reference_pa = calloc(samples, sizeof(*reference_pa));
+    double* output_pa = calloc(samples, sizeof(*output_pa));
+    struct wave_table_s waves = {};
+    if(reference_pa == nullptr || output_pa == nullptr || plan_wave_table(&waves, 1, g_synth_buffer_size) == false)
+    {
+        fprintf(stderr, "error: out of memory\n");
+        return 1;
+    }
+    enum simd_level_e host_level = detect_simd_level();
+    double scalar_elapsed_s = 0.0;
+    bool is_valid = true;
+    printf("wave_bench: %.2f m pipe, %zu cells, %zu samples, host %s\n", g_wave_bench_pipe_length_m, calc_wave_cell_count(g_wave_bench_pipe_length_m), samples, g_simd_level_string[host_level]);
+    for(enum simd_level_e level = g_simd_level_scalar; level <= host_level; level++)
+    {
+        double* out = level == g_simd_level_scalar ? reference_pa : output_pa;
+        double cell_updates = 0.0;
+        double elapsed_s = run_wave_bench(&waves.wave[0], nullptr, level, blocks, out, &cell_updates);
+        if(level == g_simd_level_scalar)
+        {
+            scalar_elapsed_s = elapsed_s;
+        }
+        double max_error_pa = 0.0;
+        for(size_t i = 0; i < samples; i++)
+        {
+            max_error_pa = fmax(max_error_pa, fabs(out[i] - reference_pa[i]));
+        }
+        printf("%-8s %10.3f ms %6.2f substeps %8.2f Mcell*substep/s %6.2fx realtime %5.2fx scalar  max_error_pa %g\n",
+            g_simd_level_string[level],
+            elapsed_s * 1e3,
+            cell_updates / samples / calc_wave_cell_count(g_wave_bench_pipe_length_m),
+            cell_updates / elapsed_s * 1e-6,
+            samples * g_std_dt_s / elapsed_s,
+            scalar_elapsed_s / elapsed_s,
+            max_error_pa);
+        if(max_error_pa > g_wave_bench_max_error_pa)
+        {
+            fprintf(stderr, "error: %s strays from scalar by %g pa, over %g pa\n", g_simd_level_string[level], max_error_pa, g_wave_bench_max_error_pa);
+            is_valid = false;
+        }
+    }
+    struct waveguide_desc_s waveguide = {
+        .pipe = {
+            {
+                .parent = -1,
+                .end = g_waveguide_end_open,
+                .length_m = g_wave_bench_pipe_length_m,
+                .diameter_m = g_wave_bench_pipe_diameter_m,
+                .loss = g_waveguide_default_loss,
+            },
+        },
+        .pipes = 1,
+        .inlet_reflection = g_waveguide_default_inlet_reflection,
+    };
+    double cell_updates = 0.0;
+    double elapsed_s = run_wave_bench(&waves.wave[0], &waveguide, g_simd_level_scalar, blocks, output_pa, &cell_updates);
+    printf("%-8s %10.3f ms %6.2fx realtime %5.2fx scalar\n",
+        "waveguide",
+        elapsed_s * 1e3,
+        samples * g_std_dt_s / elapsed_s,
+        scalar_elapsed_s / elapsed_s);
+    free_wave_table(&waves);
+    free(reference_pa);
+    free(output_pa);
+    return is_valid ? 0 : 1;
+}
@@ -0,0 +1,339 @@
+/*
+ * Persistent wave workers shared by every pipe of every engine in the process.
+ *
+ * Each engine posts one job per exhaust plenum each block and the workers claim
+ * them from a shared cursor, so a V12 with twelve pipes, or a dozen engines on
+ * their own threads, spread over as many cores as the machine has instead of one
+ * thread per pipe. Cursor and end only ever grow. A worker claims a job by
+ * advancing next, copies it out of its ring slot, and then hands the slot back
+ * by bumping its round, which the poster waits for before writing the slot
+ * again, so a slot is reused as soon as its job is copied, whoever is still
+ * running it.
+ *
+ * Every engine counts its own finished jobs in a wave fence and only ever waits
+ * on that, so engines never wait on each other's pipes. Posting is serialized by
+ * a short spin lock, the only point where engines meet.
+ *
+ * Workers spin for a short while before parking on a condition variable, so a
+ * block never pays for thread creation and an idle engine does not burn a core.
+ * One core is left to the audio and render thread; on a single core machine
+ * there are no workers and jobs run on the posting thread.
+ *
+ * Build with ENSIM4_PIN_THREADS to pin worker i to logical core i + 1. Processes
+ * that share the machine with others can cap their workers with limit_wave_pool.
+ */
+
+constexpr size_t g_wave_pool_spins = 1 << 14;
+constexpr size_t g_wave_pool_max_workers = 64;
+constexpr size_t g_wave_pool_capacity = 256;
+
+/* Jobs finished for one engine, against the jobs it posted.
+ */
+
+struct wave_fence_s
+{
+    alignas(g_wave_cache_line_bytes) atomic_size_t done;
+    size_t posted;
+};
+
+struct wave_job_s
+{
+    struct wave_s* wave;
+    struct wave_fence_s* fence;
+    bool use_cfd;
+    const struct waveguide_desc_s* waveguide;
+    double pipe_length_m;
+    double mic_position_ratio;
+    double velocity_low_pass_cutoff_frequency_hz;
+};
+
+/* A slot holds the job of position round * capacity + index, and is free for
+ * that position while its round matches.
+ */
+
+struct wave_pool_slot_s
+{
+    atomic_size_t round;
+    struct wave_job_s job;
+};
+
+struct wave_pool_s
+{
+    alignas(g_wave_cache_line_bytes) atomic_size_t next;
+    alignas(g_wave_cache_line_bytes) atomic_size_t end;
+    alignas(g_wave_cache_line_bytes) atomic_size_t done;
+    alignas(g_wave_cache_line_bytes) atomic_flag is_posting;
+    atomic_size_t parked;
+    atomic_bool is_running;
+    atomic_bool is_starting;
+    atomic_bool is_started;
+    struct wave_pool_slot_s slot[g_wave_pool_capacity];
+    thrd_t worker[g_wave_pool_max_workers];
+    size_t workers;
+    size_t worker_limit;
+    bool has_worker_limit;
+    mtx_t mutex;
+    cnd_t wake;
+}
+static g_wave_pool = {};
+
+static void
+run_wave_job(struct wave_job_s* job)
+{
+    PROFILE_BEGIN(wave_batch);
+    PERF_BEGIN(wave_batch);
+    batch_wave(job->wave, job->use_cfd, job->waveguide, job->pipe_length_m, job->mic_position_ratio, job->velocity_low_pass_cutoff_frequency_hz);
+    PERF_END(wave_batch);
+    PERF_FLUSH();
+    PROFILE_END(wave_batch);
+}
+
+static bool
+has_wave_jobs()
+{
+    return atomic_load(&g_wave_pool.next) < atomic_load(&g_wave_pool.end);
+}
+
+static void
+park_wave_worker()
+{
+    for(size_t i = 0; i < g_wave_pool_spins; i++)
+    {
+        if(has_wave_jobs() || atomic_load_explicit(&g_wave_pool.is_running, memory_order_relaxed) == false)
+        {
+            return;
+        }
+        thrd_relax();
+    }
+    mtx_lock(&g_wave_pool.mutex);
+    atomic_fetch_add(&g_wave_pool.parked, 1);
+    while(has_wave_jobs() == false && atomic_load(&g_wave_pool.is_running))
+    {
+        cnd_wait(&g_wave_pool.wake, &g_wave_pool.mutex);
+    }
+    atomic_fetch_sub(&g_wave_pool.parked, 1);
+    mtx_unlock(&g_wave_pool.mutex);
+}
+
+/* Only the claimant reads the slot, and the poster does not write it again
+ * until the claimant has copied the job and moved the slot to its next round.
+ */
+
+static bool
+claim_wave_job(struct wave_job_s* job)
+{
+    size_t next = atomic_load(&g_wave_pool.next);
+    while(next < atomic_load_explicit(&g_wave_pool.end, memory_order_acquire))
+    {
+        if(atomic_compare_exchange_weak(&g_wave_pool.next, &next, next + 1))
+        {
+            struct wave_pool_slot_s* slot = &g_wave_pool.slot[next % g_wave_pool_capacity];
+            *job = slot->job;
+            atomic_store_explicit(&slot->round, next / g_wave_pool_capacity + 1, memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+static int
+run_wave_worker(void* argument)
+{
+    size_t index = (size_t) argument;
+    thrd_pin_current(index + 1);
+    while(atomic_load(&g_wave_pool.is_running))
+    {
+        park_wave_worker();
+        struct wave_job_s job;
+        while(claim_wave_job(&job))
+        {
+            run_wave_job(&job);
+            atomic_fetch_add_explicit(&job.fence->done, 1, memory_order_release);
+            atomic_fetch_add_explicit(&g_wave_pool.done, 1, memory_order_release);
+        }
+    }
+    PERF_CLOSE();
+    return 0;
+}
+
+static void
+limit_wave_pool(size_t workers)
+{
+    g_wave_pool.worker_limit = workers;
+    g_wave_pool.has_worker_limit = true;
+}
+
+/* Safe to race from several engine threads, the losers wait for the winner.
+ */
+
+static void
+start_wave_pool()
+{
+    if(atomic_load_explicit(&g_wave_pool.is_started, memory_order_acquire))
+    {
+        return;
+    }
+    if(atomic_exchange(&g_wave_pool.is_starting, true))
+    {
+        while(atomic_load_explicit(&g_wave_pool.is_started, memory_order_acquire) == false)
+        {
+            thrd_yield();
+        }
+        return;
+    }
+    atomic_store(&g_wave_pool.is_running, true);
+    size_t cores = SDL_GetNumLogicalCPUCores();
+    size_t workers = cores > 1 ? min(cores - 1, g_wave_pool_max_workers) : 0;
+    if(g_wave_pool.has_worker_limit)
+    {
+        workers = min(workers, g_wave_pool.worker_limit);
+    }
+    if(mtx_init(&g_wave_pool.mutex) == thrd_success && cnd_init(&g_wave_pool.wake) == thrd_success)
+    {
+        for(size_t i = 0; i < workers; i++)
+        {
+            if(thrd_create(&g_wave_pool.worker[i], run_wave_worker, (void*) i) != thrd_success)
+            {
+                break;
+            }
+            g_wave_pool.workers++;
+        }
+    }
+    atomic_store_explicit(&g_wave_pool.is_started, true, memory_order_release);
+}
+
+static void
+wait_for_wave_count(atomic_size_t* done, size_t end)
+{
+    for(size_t i = 0; atomic_load_explicit(done, memory_order_acquire) != end; i++)
+    {
+        if(i < g_wave_pool_spins)
+        {
+            thrd_relax();
+        }
+        else
+        {
+            thrd_yield();
+        }
+    }
+}
+
+static void
+wait_for_wave_fence(struct wave_fence_s* fence)
+{
+    wait_for_wave_count(&fence->done, fence->posted);
+}
+
+static void
+lock_wave_pool_posting()
+{
+    while(atomic_flag_test_and_set_explicit(&g_wave_pool.is_posting, memory_order_acquire))
+    {
+        thrd_relax();
+    }
+}
+
+static void
+unlock_wave_pool_posting()
+{
+    atomic_flag_clear_explicit(&g_wave_pool.is_posting, memory_order_release);
+}
+
+static void
+wake_wave_workers()
+{
+    if(atomic_load(&g_wave_pool.parked) > 0)
+    {
+        mtx_lock(&g_wave_pool.mutex);
+        cnd_broadcast(&g_wave_pool.wake);
+        mtx_unlock(&g_wave_pool.mutex);
+    }
+}
+
+/* Waits for a free slot, which only takes a worker copying out the job before it.
+ */
+
+static void
+push_wave_pool_job(struct wave_job_s* job)
+{
+    size_t end = atomic_load_explicit(&g_wave_pool.end, memory_order_relaxed);
+    struct wave_pool_slot_s* slot = &g_wave_pool.slot[end % g_wave_pool_capacity];
+    while(atomic_load_explicit(&slot->round, memory_order_acquire) != end / g_wave_pool_capacity)
+    {
+        wake_wave_workers();
+        thrd_relax();
+    }
+    slot->job = *job;
+    atomic_store_explicit(&g_wave_pool.end, end + 1, memory_order_release);
+}
+
+/* Waves without cfd are a copy of the staged pressure and waveguides a handful of
+ * operations per sample, both cheaper than any handoff, so they run on the calling
+ * thread along with everything else when there are no workers. The fence's previous
+ * jobs are always finished first, so no wave is ever stepped by two jobs at once.
+ */
+
+static void
+post_wave_jobs(struct wave_job_s job[], size_t size, struct wave_fence_s* fence)
+{
+    start_wave_pool();
+    wait_for_wave_fence(fence);
+    bool can_post = g_wave_pool.workers > 0;
+    bool is_locked = false;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(job[i].use_cfd && job[i].waveguide == nullptr && can_post)
+        {
+            if(is_locked == false)
+            {
+                lock_wave_pool_posting();
+                is_locked = true;
+            }
+            job[i].fence = fence;
+            fence->posted++;
+            push_wave_pool_job(&job[i]);
+        }
+        else
+        {
+            run_wave_job(&job[i]);
+        }
+    }
+    if(is_locked)
+    {
+        unlock_wave_pool_posting();
+        wake_wave_workers();
+    }
+}
+
+/* Only once every engine has stopped posting.
+ */
+
+static void
+stop_wave_pool()
+{
+    if(atomic_load(&g_wave_pool.is_started) == false)
+    {
+        return;
+    }
+    wait_for_wave_count(&g_wave_pool.done, atomic_load(&g_wave_pool.end));
+    mtx_lock(&g_wave_pool.mutex);
+    atomic_store(&g_wave_pool.is_running, false);
+    cnd_broadcast(&g_wave_pool.wake);
+    mtx_unlock(&g_wave_pool.mutex);
+    for(size_t i = 0; i < g_wave_pool.workers; i++)
+    {
+        thrd_join(g_wave_pool.worker[i], nullptr);
+    }
+    mtx_destroy(&g_wave_pool.mutex);
+    cnd_destroy(&g_wave_pool.wake);
+    g_wave_pool.workers = 0;
+    for(size_t i = 0; i < g_wave_pool_capacity; i++)
+    {
+        atomic_store(&g_wave_pool.slot[i].round, 0);
+    }
+    atomic_store(&g_wave_pool.next, 0);
+    atomic_store(&g_wave_pool.end, 0);
+    atomic_store(&g_wave_pool.done, 0);
+    atomic_store(&g_wave_pool.is_started, false);
+    atomic_store(&g_wave_pool.is_starting, false);
+}
@@ -2,11 +2,8 @@
  * One dimensional (pipe) computational fluid dynamics.
  */
 
-constexpr size_t g_wave_cells = 128;
 constexpr size_t g_wave_signal_cell_index = 0;
 constexpr size_t g_wave_first_interior_cell_index = 1;
-constexpr size_t g_wave_last_interior_cell_index = g_wave_cells - 2;
-constexpr size_t g_wave_ambient_cell_index = g_wave_cells - 1;
 
 /* 0                   1                             cells - 2                  cells - 1
  * +-------------+     +---------------------+       +--------------------+     +--------------+
@@ -17,12 +14,32 @@ constexpr size_t g_wave_ambient_cell_index = g_wave_cells - 1;
  *
  */
 
-constexpr size_t g_wave_substeps = 8;
-constexpr size_t g_flux_cells = g_wave_cells + 1;
-constexpr size_t g_wave_max_waves = 4;
-constexpr size_t g_wave_sample_rate_hz = g_std_audio_sample_rate_hz * g_wave_substeps;
+/* Each pipe is split into cells of roughly g_wave_cell_length_m, and every block
+ * picks the fewest substeps per audio sample that keep the CFL number
+ *
+ *        dt
+ * C = ( ---- ) * max(|u| + c) <= g_wave_cfl_number
+ *        dx
+ *
+ * over the grid and the block's staged signal. The margin below one covers speeds
+ * that grow within the block.
+ */
+
+constexpr double g_wave_cell_length_m = 0.01;
+constexpr size_t g_wave_min_cells = 16;
+constexpr size_t g_wave_max_cells = 1024;
+constexpr double g_wave_cfl_number = 0.5;
+constexpr size_t g_wave_max_substeps = 64;
 constexpr double g_wave_gamma = 1.31;
-constexpr double g_wave_dt_s = 1.0 / g_wave_sample_rate_hz;
+constexpr size_t g_wave_cache_line_bytes = 64;
+constexpr size_t g_wave_row_alignment = g_wave_cache_line_bytes / sizeof(double);
+
+/* The signal velocity lowpass was tuned when every audio sample ran eight substeps
+ * of the filter at the audio rate; the per substep factor is rescaled so a sample
+ * still decays as much whatever the substep count.
+ */
+
+constexpr size_t g_wave_reference_substeps = 8;
 
 struct wave_prim_s
 {
@@ -38,19 +55,50 @@ struct wave_cons_s
     double e; // total_energy_density_j_per_m_3
 };
 
-struct wave_flux_s
-{
-    double r; // mass_flux_kg_per_m2_s
-    double m; // momentum_flux_n_per_m2
-    double e; // energy_flux_w_per_m2
-};
+/* The solver keeps one array per component so the flux and update kernels stream
+ * through contiguous doubles:
+ *
+ *   prim_*      primitive state (r, u, p) per cell
+ *   cons_*      conserved state (r, m, e) per cell, the integrated quantity
+ *   cell_*      per cell conserved state, physical flux, and |u| + c, all derived
+ *               from prim and shared by the two faces either side of the cell
+ *   flux_*      Rusanov flux per face, face i sits between cells i - 1 and i
+ */
+
+#define WAVE_SOLVER_CELL_FIELDS \
+    X(prim_r)                   \
+    X(prim_u)                   \
+    X(prim_p)                   \
+    X(cons_r)                   \
+    X(cons_m)                   \
+    X(cons_e)                   \
+    X(cell_m)                   \
+    X(cell_e)                   \
+    X(cell_flux_m)              \
+    X(cell_flux_e)              \
+    X(cell_speed_m_per_s)
+
+#define WAVE_SOLVER_FACE_FIELDS \
+    X(flux_r)                   \
+    X(flux_m)                   \
+    X(flux_e)
+
+/* Cell fields hold cells entries and face fields cells + 1, carved out of one
+ * block with rows padded to whole cache lines.
+ */
 
 struct wave_solver_s
 {
-    struct wave_prim_s prim[g_wave_cells];
-    struct wave_cons_s cons[g_wave_cells];
-    struct wave_flux_s flux[g_flux_cells];
+    size_t cells;
+    size_t substeps;
+    double* block;
+#define X(field) double* field;
+    WAVE_SOLVER_CELL_FIELDS
+    WAVE_SOLVER_FACE_FIELDS
+#undef X
     struct lowpass_filter_3_s u_filter;
+    enum simd_level_e simd_level;
+    double u_filter_alpha;
     double velocity_low_pass_cutoff_frequency_hz;
     double gradient_s_per_m;
     double mic_position_ratio;
@@ -58,22 +106,45 @@ struct wave_solver_s
     double pipe_length_m;
 };
 
+/* Each buffer holds one block of the table's block size.
+ */
+
 struct wave_data_s
 {
-    struct wave_prim_s buffer0[g_synth_buffer_size];
-    struct wave_prim_s buffer1[g_synth_buffer_size];
-    double wave_sub_buffer_pa[g_synth_buffer_size];
-    size_t index;
+    struct wave_prim_s* buffer0;
+    struct wave_prim_s* buffer1;
+    double* wave_sub_buffer_pa;
+    size_t size;
+    alignas(g_wave_cache_line_bytes) size_t index;
 };
 
+/* The audio thread bumps data.index every step while a worker fills the sub buffer
+ * and steps the solver, so index, data, and solver each start their own cache line
+ * and neighbouring table entries never share one.
+ */
+
 struct wave_s
 {
-    struct wave_data_s data;
-    struct wave_solver_s solver;
-}
-static g_wave_table[g_wave_max_waves] = {};
+    alignas(g_wave_cache_line_bytes) struct wave_data_s data;
+    alignas(g_wave_cache_line_bytes) struct wave_solver_s solver;
+    alignas(g_wave_cache_line_bytes) struct waveguide_s guide;
+};
 
-static double g_wave_buffer_pa[g_synth_buffer_size] = {};
+/* One wave per exhaust plenum, owned by the engine. The block is over allocated
+ * so the table can start on a cache line whatever calloc returns. The buffer is
+ * every pipe of the engine summed for its synth. Every per sample buffer, the
+ * sum included, comes from one data block sized by the block size.
+ */
+
+struct wave_table_s
+{
+    void* block;
+    struct wave_s* wave;
+    size_t size;
+    void* data_block;
+    double* buffer_pa;
+    size_t block_size;
+};
 
 constexpr struct wave_prim_s g_wave_ambient_cell = {
     .r = g_gas_ambient_static_density_kg_per_m3,
@@ -95,79 +166,355 @@ prim_to_cons(struct wave_prim_s self)
     };
 }
 
-static struct wave_prim_s
-cons_to_prim(struct wave_cons_s self)
+/* Per cell conserved state, physical flux, and fastest signal speed:
+ *
+ *   F = (m, m * u + p, (e + p) * u)
+ *
+ *   s = |u| + c,  c = sqrt(y * p / r)
+ *
+ * The vector kernels below evaluate the same expressions in the same order, but
+ * -ffast-math lets the compiler fuse and reorder each level differently, so the
+ * levels agree to rounding rather than bit for bit. wave_bench fails any level
+ * whose output strays more than g_wave_bench_max_error_pa from this one.
+ */
+
+static void
+calc_wave_cells_scalar(struct wave_solver_s* self, size_t begin, size_t end)
 {
-    /*                  2
-     *           1     m
-     * P = (e - --- * ---) * (y - 1)
-     *           2     r
-     */
-    double u = self.m / self.r;
-    return (struct wave_prim_s) {
-        .r = self.r,
-        .u = self.m / self.r,
-        .p = (self.e - 0.5 * self.m * u) * (g_wave_gamma - 1.0),
-    };
+    for(size_t i = begin; i < end; i++)
+    {
+        double r = self->prim_r[i];
+        double u = self->prim_u[i];
+        double p = self->prim_p[i];
+        double m = r * u;
+        double e = p / (g_wave_gamma - 1.0) + 0.5 * r * u * u;
+        self->cell_m[i] = m;
+        self->cell_e[i] = e;
+        self->cell_flux_m[i] = m * u + p;
+        self->cell_flux_e[i] = (e + p) * u;
+        self->cell_speed_m_per_s[i] = fabs(u) + sqrt(g_wave_gamma * p / r);
+    }
 }
 
-static struct wave_flux_s
-calc_solver_flux(struct wave_prim_s ql, struct wave_prim_s qr)
-{
-    struct wave_cons_s ul = prim_to_cons(ql);
-    struct wave_cons_s ur = prim_to_cons(qr);
-    double cl = sqrt(g_wave_gamma * ql.p / ql.r);
-    double cr = sqrt(g_wave_gamma * qr.p / qr.r);
-    struct wave_flux_s fl = { .r = ul.m, .m = ul.m * ql.u + ql.p, .e = (ul.e + ql.p) * ql.u };
-    struct wave_flux_s fr = { .r = ur.m, .m = ur.m * qr.u + qr.p, .e = (ur.e + qr.p) * qr.u };
-    double a = fmax(fabs(ql.u) + cl, fabs(qr.u) + cr);
-    /*
-     *       1               1
-     * FC = --- (FL + FR) - --- a * (UR - UL)
-     *       2               2
-     */
-    return (struct wave_flux_s) {
-        .r = 0.5 * (fl.r + fr.r) - 0.5 * a * (ur.r - ul.r),
-        .m = 0.5 * (fl.m + fr.m) - 0.5 * a * (ur.m - ul.m),
-        .e = 0.5 * (fl.e + fr.e) - 0.5 * a * (ur.e - ul.e),
-    };
+/*
+ *       1               1
+ * FC = --- (FL + FR) - --- a * (UR - UL),  a = max(sL, sR)
+ *       2               2
+ */
+
+static void
+calc_wave_face(struct wave_solver_s* self, size_t face, size_t x, size_t y)
+{
+    double a = fmax(self->cell_speed_m_per_s[x], self->cell_speed_m_per_s[y]);
+    self->flux_r[face] = 0.5 * (self->cell_m[x] + self->cell_m[y]) - 0.5 * a * (self->prim_r[y] - self->prim_r[x]);
+    self->flux_m[face] = 0.5 * (self->cell_flux_m[x] + self->cell_flux_m[y]) - 0.5 * a * (self->cell_m[y] - self->cell_m[x]);
+    self->flux_e[face] = 0.5 * (self->cell_flux_e[x] + self->cell_flux_e[y]) - 0.5 * a * (self->cell_e[y] - self->cell_e[x]);
 }
 
 static void
-compute_wave_flux(struct wave_solver_s* self)
+calc_wave_faces_scalar(struct wave_solver_s* self, size_t begin, size_t end)
 {
-    size_t l = g_wave_signal_cell_index;
-    size_t r = g_wave_cells;
-    size_t z = g_wave_ambient_cell_index;
-    self->flux[l] = calc_solver_flux(self->prim[l], self->prim[l]);
-    self->flux[r] = calc_solver_flux(self->prim[z], self->prim[z]);
-    for(size_t i = 1; i < g_wave_cells; i++)
+    for(size_t i = begin; i < end; i++)
+    {
+        calc_wave_face(self, i, i - 1, i);
+    }
+}
+
+/*                                                           2
+ *                                                    1     m
+ * U -= dt / dx * (F(i + 1) - F(i)),  u = m / r,  p = (e - --- * ---) * (y - 1)
+ *                                                    2     r
+ */
+
+static void
+update_wave_cells_scalar(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    double g = self->gradient_s_per_m;
+    for(size_t i = begin; i < end; i++)
+    {
+        double r = self->cons_r[i] - g * (self->flux_r[i + 1] - self->flux_r[i]);
+        double m = self->cons_m[i] - g * (self->flux_m[i + 1] - self->flux_m[i]);
+        double e = self->cons_e[i] - g * (self->flux_e[i + 1] - self->flux_e[i]);
+        double u = m / r;
+        self->cons_r[i] = r;
+        self->cons_m[i] = m;
+        self->cons_e[i] = e;
+        self->prim_r[i] = r;
+        self->prim_u[i] = u;
+        self->prim_p[i] = (e - 0.5 * m * u) * (g_wave_gamma - 1.0);
+    }
+}
+
+#ifdef ENSIM4_SIMD_X86
+
+SIMD_TARGET_AVX2 static void
+calc_wave_cells_avx2(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    __m256d gamma = _mm256_set1_pd(g_wave_gamma);
+    __m256d gamma_minus_one = _mm256_set1_pd(g_wave_gamma - 1.0);
+    __m256d half = _mm256_set1_pd(0.5);
+    __m256d sign = _mm256_set1_pd(-0.0);
+    size_t i = begin;
+    for(; i + 4 <= end; i += 4)
+    {
+        __m256d r = _mm256_loadu_pd(&self->prim_r[i]);
+        __m256d u = _mm256_loadu_pd(&self->prim_u[i]);
+        __m256d p = _mm256_loadu_pd(&self->prim_p[i]);
+        __m256d m = _mm256_mul_pd(r, u);
+        __m256d e = _mm256_add_pd(_mm256_div_pd(p, gamma_minus_one), _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(half, r), u), u));
+        __m256d c = _mm256_sqrt_pd(_mm256_div_pd(_mm256_mul_pd(gamma, p), r));
+        _mm256_storeu_pd(&self->cell_m[i], m);
+        _mm256_storeu_pd(&self->cell_e[i], e);
+        _mm256_storeu_pd(&self->cell_flux_m[i], _mm256_add_pd(_mm256_mul_pd(m, u), p));
+        _mm256_storeu_pd(&self->cell_flux_e[i], _mm256_mul_pd(_mm256_add_pd(e, p), u));
+        _mm256_storeu_pd(&self->cell_speed_m_per_s[i], _mm256_add_pd(_mm256_andnot_pd(sign, u), c));
+    }
+    calc_wave_cells_scalar(self, i, end);
+}
+
+SIMD_TARGET_AVX2 static void
+calc_wave_faces_avx2(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    __m256d half = _mm256_set1_pd(0.5);
+    size_t i = begin;
+    for(; i + 4 <= end; i += 4)
+    {
+        size_t x = i - 1;
+        size_t y = i;
+        __m256d a = _mm256_max_pd(_mm256_loadu_pd(&self->cell_speed_m_per_s[x]), _mm256_loadu_pd(&self->cell_speed_m_per_s[y]));
+        __m256d half_a = _mm256_mul_pd(half, a);
+        __m256d rx = _mm256_loadu_pd(&self->prim_r[x]);
+        __m256d ry = _mm256_loadu_pd(&self->prim_r[y]);
+        __m256d mx = _mm256_loadu_pd(&self->cell_m[x]);
+        __m256d my = _mm256_loadu_pd(&self->cell_m[y]);
+        __m256d ex = _mm256_loadu_pd(&self->cell_e[x]);
+        __m256d ey = _mm256_loadu_pd(&self->cell_e[y]);
+        __m256d fmx = _mm256_loadu_pd(&self->cell_flux_m[x]);
+        __m256d fmy = _mm256_loadu_pd(&self->cell_flux_m[y]);
+        __m256d fex = _mm256_loadu_pd(&self->cell_flux_e[x]);
+        __m256d fey = _mm256_loadu_pd(&self->cell_flux_e[y]);
+        _mm256_storeu_pd(&self->flux_r[i], _mm256_sub_pd(_mm256_mul_pd(half, _mm256_add_pd(mx, my)), _mm256_mul_pd(half_a, _mm256_sub_pd(ry, rx))));
+        _mm256_storeu_pd(&self->flux_m[i], _mm256_sub_pd(_mm256_mul_pd(half, _mm256_add_pd(fmx, fmy)), _mm256_mul_pd(half_a, _mm256_sub_pd(my, mx))));
+        _mm256_storeu_pd(&self->flux_e[i], _mm256_sub_pd(_mm256_mul_pd(half, _mm256_add_pd(fex, fey)), _mm256_mul_pd(half_a, _mm256_sub_pd(ey, ex))));
+    }
+    calc_wave_faces_scalar(self, i, end);
+}
+
+SIMD_TARGET_AVX2 static void
+update_wave_cells_avx2(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    __m256d g = _mm256_set1_pd(self->gradient_s_per_m);
+    __m256d gamma_minus_one = _mm256_set1_pd(g_wave_gamma - 1.0);
+    __m256d half = _mm256_set1_pd(0.5);
+    size_t i = begin;
+    for(; i + 4 <= end; i += 4)
+    {
+        __m256d dr = _mm256_sub_pd(_mm256_loadu_pd(&self->flux_r[i + 1]), _mm256_loadu_pd(&self->flux_r[i]));
+        __m256d dm = _mm256_sub_pd(_mm256_loadu_pd(&self->flux_m[i + 1]), _mm256_loadu_pd(&self->flux_m[i]));
+        __m256d de = _mm256_sub_pd(_mm256_loadu_pd(&self->flux_e[i + 1]), _mm256_loadu_pd(&self->flux_e[i]));
+        __m256d r = _mm256_sub_pd(_mm256_loadu_pd(&self->cons_r[i]), _mm256_mul_pd(g, dr));
+        __m256d m = _mm256_sub_pd(_mm256_loadu_pd(&self->cons_m[i]), _mm256_mul_pd(g, dm));
+        __m256d e = _mm256_sub_pd(_mm256_loadu_pd(&self->cons_e[i]), _mm256_mul_pd(g, de));
+        __m256d u = _mm256_div_pd(m, r);
+        _mm256_storeu_pd(&self->cons_r[i], r);
+        _mm256_storeu_pd(&self->cons_m[i], m);
+        _mm256_storeu_pd(&self->cons_e[i], e);
+        _mm256_storeu_pd(&self->prim_r[i], r);
+        _mm256_storeu_pd(&self->prim_u[i], u);
+        _mm256_storeu_pd(&self->prim_p[i], _mm256_mul_pd(_mm256_sub_pd(e, _mm256_mul_pd(_mm256_mul_pd(half, m), u)), gamma_minus_one));
+    }
+    update_wave_cells_scalar(self, i, end);
+}
+
+SIMD_TARGET_AVX512 static void
+calc_wave_cells_avx512(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    __m512d gamma = _mm512_set1_pd(g_wave_gamma);
+    __m512d gamma_minus_one = _mm512_set1_pd(g_wave_gamma - 1.0);
+    __m512d half = _mm512_set1_pd(0.5);
+    size_t i = begin;
+    for(; i + 8 <= end; i += 8)
+    {
+        __m512d r = _mm512_loadu_pd(&self->prim_r[i]);
+        __m512d u = _mm512_loadu_pd(&self->prim_u[i]);
+        __m512d p = _mm512_loadu_pd(&self->prim_p[i]);
+        __m512d m = _mm512_mul_pd(r, u);
+        __m512d e = _mm512_add_pd(_mm512_div_pd(p, gamma_minus_one), _mm512_mul_pd(_mm512_mul_pd(_mm512_mul_pd(half, r), u), u));
+        __m512d c = _mm512_sqrt_pd(_mm512_div_pd(_mm512_mul_pd(gamma, p), r));
+        _mm512_storeu_pd(&self->cell_m[i], m);
+        _mm512_storeu_pd(&self->cell_e[i], e);
+        _mm512_storeu_pd(&self->cell_flux_m[i], _mm512_add_pd(_mm512_mul_pd(m, u), p));
+        _mm512_storeu_pd(&self->cell_flux_e[i], _mm512_mul_pd(_mm512_add_pd(e, p), u));
+        _mm512_storeu_pd(&self->cell_speed_m_per_s[i], _mm512_add_pd(_mm512_abs_pd(u), c));
+    }
+    calc_wave_cells_scalar(self, i, end);
+}
+
+SIMD_TARGET_AVX512 static void
+calc_wave_faces_avx512(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    __m512d half = _mm512_set1_pd(0.5);
+    size_t i = begin;
+    for(; i + 8 <= end; i += 8)
     {
         size_t x = i - 1;
         size_t y = i;
-        self->flux[y] = calc_solver_flux(self->prim[x], self->prim[y]);
+        __m512d a = _mm512_max_pd(_mm512_loadu_pd(&self->cell_speed_m_per_s[x]), _mm512_loadu_pd(&self->cell_speed_m_per_s[y]));
+        __m512d half_a = _mm512_mul_pd(half, a);
+        __m512d rx = _mm512_loadu_pd(&self->prim_r[x]);
+        __m512d ry = _mm512_loadu_pd(&self->prim_r[y]);
+        __m512d mx = _mm512_loadu_pd(&self->cell_m[x]);
+        __m512d my = _mm512_loadu_pd(&self->cell_m[y]);
+        __m512d ex = _mm512_loadu_pd(&self->cell_e[x]);
+        __m512d ey = _mm512_loadu_pd(&self->cell_e[y]);
+        __m512d fmx = _mm512_loadu_pd(&self->cell_flux_m[x]);
+        __m512d fmy = _mm512_loadu_pd(&self->cell_flux_m[y]);
+        __m512d fex = _mm512_loadu_pd(&self->cell_flux_e[x]);
+        __m512d fey = _mm512_loadu_pd(&self->cell_flux_e[y]);
+        _mm512_storeu_pd(&self->flux_r[i], _mm512_sub_pd(_mm512_mul_pd(half, _mm512_add_pd(mx, my)), _mm512_mul_pd(half_a, _mm512_sub_pd(ry, rx))));
+        _mm512_storeu_pd(&self->flux_m[i], _mm512_sub_pd(_mm512_mul_pd(half, _mm512_add_pd(fmx, fmy)), _mm512_mul_pd(half_a, _mm512_sub_pd(my, mx))));
+        _mm512_storeu_pd(&self->flux_e[i], _mm512_sub_pd(_mm512_mul_pd(half, _mm512_add_pd(fex, fey)), _mm512_mul_pd(half_a, _mm512_sub_pd(ey, ex))));
     }
+    calc_wave_faces_scalar(self, i, end);
 }
 
+SIMD_TARGET_AVX512 static void
+update_wave_cells_avx512(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    __m512d g = _mm512_set1_pd(self->gradient_s_per_m);
+    __m512d gamma_minus_one = _mm512_set1_pd(g_wave_gamma - 1.0);
+    __m512d half = _mm512_set1_pd(0.5);
+    size_t i = begin;
+    for(; i + 8 <= end; i += 8)
+    {
+        __m512d dr = _mm512_sub_pd(_mm512_loadu_pd(&self->flux_r[i + 1]), _mm512_loadu_pd(&self->flux_r[i]));
+        __m512d dm = _mm512_sub_pd(_mm512_loadu_pd(&self->flux_m[i + 1]), _mm512_loadu_pd(&self->flux_m[i]));
+        __m512d de = _mm512_sub_pd(_mm512_loadu_pd(&self->flux_e[i + 1]), _mm512_loadu_pd(&self->flux_e[i]));
+        __m512d r = _mm512_sub_pd(_mm512_loadu_pd(&self->cons_r[i]), _mm512_mul_pd(g, dr));
+        __m512d m = _mm512_sub_pd(_mm512_loadu_pd(&self->cons_m[i]), _mm512_mul_pd(g, dm));
+        __m512d e = _mm512_sub_pd(_mm512_loadu_pd(&self->cons_e[i]), _mm512_mul_pd(g, de));
+        __m512d u = _mm512_div_pd(m, r);
+        _mm512_storeu_pd(&self->cons_r[i], r);
+        _mm512_storeu_pd(&self->cons_m[i], m);
+        _mm512_storeu_pd(&self->cons_e[i], e);
+        _mm512_storeu_pd(&self->prim_r[i], r);
+        _mm512_storeu_pd(&self->prim_u[i], u);
+        _mm512_storeu_pd(&self->prim_p[i], _mm512_mul_pd(_mm512_sub_pd(e, _mm512_mul_pd(_mm512_mul_pd(half, m), u)), gamma_minus_one));
+    }
+    update_wave_cells_scalar(self, i, end);
+}
+
+#endif
+
 static void
-update_wave_state(struct wave_solver_s* self)
+calc_wave_cells(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    switch(self->simd_level)
+    {
+#ifdef ENSIM4_SIMD_X86
+    case g_simd_level_avx512:
+        calc_wave_cells_avx512(self, begin, end);
+        break;
+    case g_simd_level_avx2:
+        calc_wave_cells_avx2(self, begin, end);
+        break;
+#endif
+    default:
+        calc_wave_cells_scalar(self, begin, end);
+        break;
+    }
+}
+
+static void
+calc_wave_faces(struct wave_solver_s* self, size_t begin, size_t end)
 {
-    for(size_t i = 1; i < g_wave_ambient_cell_index; i++)
+    switch(self->simd_level)
     {
-        size_t x = i;
-        size_t y = i + 1;
-        self->cons[x].r -= self->gradient_s_per_m * (self->flux[y].r - self->flux[x].r);
-        self->cons[x].m -= self->gradient_s_per_m * (self->flux[y].m - self->flux[x].m);
-        self->cons[x].e -= self->gradient_s_per_m * (self->flux[y].e - self->flux[x].e);
-        self->prim[x] = cons_to_prim(self->cons[x]);
+#ifdef ENSIM4_SIMD_X86
+    case g_simd_level_avx512:
+        calc_wave_faces_avx512(self, begin, end);
+        break;
+    case g_simd_level_avx2:
+        calc_wave_faces_avx2(self, begin, end);
+        break;
+#endif
+    default:
+        calc_wave_faces_scalar(self, begin, end);
+        break;
     }
 }
 
+static void
+update_wave_cells(struct wave_solver_s* self, size_t begin, size_t end)
+{
+    switch(self->simd_level)
+    {
+#ifdef ENSIM4_SIMD_X86
+    case g_simd_level_avx512:
+        update_wave_cells_avx512(self, begin, end);
+        break;
+    case g_simd_level_avx2:
+        update_wave_cells_avx2(self, begin, end);
+        break;
+#endif
+    default:
+        update_wave_cells_scalar(self, begin, end);
+        break;
+    }
+}
+
+/* The boundary faces see their cell mirrored onto itself, which reduces to that
+ * cell's physical flux.
+ */
+
+static size_t
+get_wave_ambient_cell_index(struct wave_solver_s* self)
+{
+    return self->cells - 1;
+}
+
+static size_t
+get_wave_last_interior_cell_index(struct wave_solver_s* self)
+{
+    return self->cells - 2;
+}
+
+static void
+compute_wave_flux(struct wave_solver_s* self)
+{
+    size_t z = get_wave_ambient_cell_index(self);
+    calc_wave_cells(self, 0, self->cells);
+    calc_wave_faces(self, 1, self->cells);
+    calc_wave_face(self, 0, g_wave_signal_cell_index, g_wave_signal_cell_index);
+    calc_wave_face(self, self->cells, z, z);
+}
+
+static void
+update_wave_state(struct wave_solver_s* self)
+{
+    update_wave_cells(self, g_wave_first_interior_cell_index, get_wave_ambient_cell_index(self));
+}
+
+static struct wave_prim_s
+get_solver_wave_cell(struct wave_solver_s* self, size_t index)
+{
+    return (struct wave_prim_s) {
+        .r = self->prim_r[index],
+        .u = self->prim_u[index],
+        .p = self->prim_p[index],
+    };
+}
+
 static void
 set_solver_wave_cell(struct wave_solver_s* self, size_t index, struct wave_prim_s prim)
 {
-    self->prim[index] = prim;
-    self->cons[index] = prim_to_cons(prim);
+    struct wave_cons_s cons = prim_to_cons(prim);
+    self->prim_r[index] = prim.r;
+    self->prim_u[index] = prim.u;
+    self->prim_p[index] = prim.p;
+    self->cons_r[index] = cons.r;
+    self->cons_m[index] = cons.m;
+    self->cons_e[index] = cons.e;
 }
 
 static struct wave_prim_s
@@ -175,7 +522,7 @@ calc_signal_cell(struct wave_solver_s* self, struct wave_prim_s signal)
 {
     return (struct wave_prim_s) {
         .r = signal.r,
-        .u = filter_lowpass_3(&self->u_filter, self->velocity_low_pass_cutoff_frequency_hz, signal.u),
+        .u = filter_lowpass_3_alpha(&self->u_filter, self->u_filter_alpha, signal.u),
         .p = signal.p
     };
 }
@@ -184,7 +531,7 @@ static struct wave_prim_s
 calc_ambient_cell(struct wave_solver_s* self)
 {
     struct wave_prim_s signal = g_wave_ambient_cell;
-    struct wave_prim_s last_interior_cell = self->prim[g_wave_last_interior_cell_index];
+    struct wave_prim_s last_interior_cell = get_solver_wave_cell(self, get_wave_last_interior_cell_index(self));
     return (struct wave_prim_s) {
         .r = last_interior_cell.r * pow(signal.p / last_interior_cell.p, 1.0 / g_wave_gamma),
         .u = last_interior_cell.u,
@@ -195,12 +542,12 @@ calc_ambient_cell(struct wave_solver_s* self)
 static void
 step_solver_wave(struct wave_solver_s* self, struct wave_prim_s signal)
 {
-    for(size_t i = 0; i < g_wave_substeps; i++)
+    for(size_t i = 0; i < self->substeps; i++)
     {
         struct wave_prim_s signal_cell = calc_signal_cell(self, signal);
         struct wave_prim_s ambient_cell = calc_ambient_cell(self);
         set_solver_wave_cell(self, g_wave_signal_cell_index, signal_cell);
-        set_solver_wave_cell(self, g_wave_ambient_cell_index, ambient_cell);
+        set_solver_wave_cell(self, get_wave_ambient_cell_index(self), ambient_cell);
         compute_wave_flux(self);
         update_wave_state(self);
     }
@@ -209,75 +556,292 @@ step_solver_wave(struct wave_solver_s* self, struct wave_prim_s signal)
 static double
 sample_solver_wave(struct wave_solver_s* self)
 {
-    size_t index = g_wave_ambient_cell_index * self->mic_position_ratio;
-    return self->prim[index].p;
+    size_t index = get_wave_ambient_cell_index(self) * self->mic_position_ratio;
+    return self->prim_p[index];
 }
 
 static void
-clear_wave_buffer()
+clear_wave_buffer(struct wave_table_s* table)
 {
-    clear(g_wave_buffer_pa);
+    memset(table->buffer_pa, 0, table->block_size * sizeof(*table->buffer_pa));
 }
 
 static void
-add_to_wave_buffer(size_t wave_index)
+add_to_wave_buffer(struct wave_table_s* table, struct wave_s* self)
 {
-    for(size_t i = 0; i < g_synth_buffer_size; i++)
+    for(size_t i = 0; i < table->block_size; i++)
     {
-        g_wave_buffer_pa[i] += g_wave_table[wave_index].data.wave_sub_buffer_pa[i];
+        table->buffer_pa[i] += self->data.wave_sub_buffer_pa[i];
     }
 }
 
 static void
 reset_solver_wave_cells(struct wave_solver_s* self)
 {
-    for(size_t i = 0; i < g_wave_cells; i++)
+    for(size_t i = 0; i < self->cells; i++)
     {
         set_solver_wave_cell(self, i, g_wave_ambient_cell);
     }
 }
 
 static void
-reset_all_waves()
+free_solver_wave(struct wave_solver_s* self)
+{
+    free(self->block);
+    self->block = nullptr;
+#define X(field) self->field = nullptr;
+    WAVE_SOLVER_CELL_FIELDS
+    WAVE_SOLVER_FACE_FIELDS
+#undef X
+    self->cells = 0;
+}
+
+/* Regridding starts the pipe over from ambient; it only happens when the pipe
+ * length changes, which already restarts the engine.
+ */
+
+static bool
+plan_solver_wave(struct wave_solver_s* self, size_t cells)
+{
+    if(self->cells == cells)
+    {
+        return true;
+    }
+    free_solver_wave(self);
+    size_t stride = (cells + 1 + g_wave_row_alignment - 1) / g_wave_row_alignment * g_wave_row_alignment;
+    size_t rows = 0;
+#define X(field) rows++;
+    WAVE_SOLVER_CELL_FIELDS
+    WAVE_SOLVER_FACE_FIELDS
+#undef X
+    self->block = calloc(stride * rows, sizeof(*self->block));
+    if(self->block == nullptr)
+    {
+        return false;
+    }
+    double* row = self->block;
+#define X(field) self->field = row; row += stride;
+    WAVE_SOLVER_CELL_FIELDS
+    WAVE_SOLVER_FACE_FIELDS
+#undef X
+    self->cells = cells;
+    reset_solver_wave_cells(self);
+    return true;
+}
+
+static size_t
+calc_wave_cell_count(double pipe_length_m)
+{
+    return clamp(round(pipe_length_m / g_wave_cell_length_m), g_wave_min_cells, g_wave_max_cells);
+}
+
+static double
+calc_wave_speed_m_per_s(struct wave_prim_s prim)
+{
+    return fabs(prim.u) + sqrt(g_wave_gamma * prim.p / prim.r);
+}
+
+/* A non finite speed means the grid has already blown up; the substep cap keeps
+ * the block bounded and the sampler reports the bad pressure.
+ */
+
+static size_t
+calc_solver_wave_substeps(struct wave_solver_s* self, const struct wave_prim_s signal[], size_t size)
+{
+    calc_wave_cells(self, 0, self->cells);
+    double max_speed_m_per_s = 0.0;
+    for(size_t i = 0; i < self->cells; i++)
+    {
+        max_speed_m_per_s = max(max_speed_m_per_s, self->cell_speed_m_per_s[i]);
+    }
+    for(size_t i = 0; i < size; i++)
+    {
+        max_speed_m_per_s = max(max_speed_m_per_s, calc_wave_speed_m_per_s(signal[i]));
+    }
+    self->max_wave_speed_m_per_s = max_speed_m_per_s;
+    double wave_dx_m = self->pipe_length_m / self->cells;
+    double substeps = ceil(max_speed_m_per_s * g_std_dt_s / (g_wave_cfl_number * wave_dx_m));
+    if(isfinite(substeps) == false)
+    {
+        return g_wave_max_substeps;
+    }
+    return clamp(substeps, 1.0, g_wave_max_substeps);
+}
+
+static void
+reset_wave(struct wave_s* self)
+{
+    for(size_t i = 0; i < self->data.size; i++)
+    {
+        self->data.buffer0[i] = g_wave_ambient_cell;
+        self->data.buffer1[i] = g_wave_ambient_cell;
+        self->data.wave_sub_buffer_pa[i] = 0.0;
+    }
+    self->data.index = 0;
+    self->solver.simd_level = detect_simd_level();
+    self->solver.u_filter = (struct lowpass_filter_3_s) {};
+    reset_solver_wave_cells(&self->solver);
+    reset_waveguide(&self->guide);
+}
+
+static void
+reset_wave_table(struct wave_table_s* self)
+{
+    for(size_t i = 0; i < self->size; i++)
+    {
+        reset_wave(&self->wave[i]);
+    }
+}
+
+static void
+free_wave_table(struct wave_table_s* self)
+{
+    for(size_t i = 0; i < self->size; i++)
+    {
+        free_solver_wave(&self->wave[i].solver);
+        free_waveguide(&self->wave[i].guide);
+    }
+    free(self->block);
+    free(self->data_block);
+    *self = (struct wave_table_s) {};
+}
+
+/* Resizing keeps what each wave has staged for its next block, cut short or
+ * held at its last sample, so the pipes ride through a block size change the
+ * way they ride through a slow frame. No wave job may be running.
+ */
+
+static bool
+plan_wave_table_block(struct wave_table_s* self, size_t block_size)
+{
+    if(self->block_size == block_size)
+    {
+        return true;
+    }
+    size_t wave_bytes = 2 * block_size * sizeof(struct wave_prim_s) + block_size * sizeof(double);
+    void* data_block = calloc(self->size * wave_bytes + block_size * sizeof(double), 1);
+    if(data_block == nullptr)
+    {
+        return false;
+    }
+    struct wave_prim_s* prim = data_block;
+    double* pa = (double*) (prim + 2 * self->size * block_size);
+    for(size_t i = 0; i < self->size; i++)
+    {
+        struct wave_data_s* data = &self->wave[i].data;
+        for(size_t j = 0; j < block_size; j++)
+        {
+            prim[j] = data->size == 0 ? g_wave_ambient_cell : data->buffer0[j < data->size ? j : data->size - 1];
+        }
+        data->buffer0 = prim;
+        data->buffer1 = prim + block_size;
+        data->wave_sub_buffer_pa = pa;
+        data->size = block_size;
+        data->index = data->index < block_size ? data->index : block_size;
+        prim += 2 * block_size;
+        pa += block_size;
+    }
+    free(self->data_block);
+    self->data_block = data_block;
+    self->buffer_pa = pa;
+    self->block_size = block_size;
+    return true;
+}
+
+static bool
+plan_wave_table(struct wave_table_s* self, size_t size, size_t block_size)
 {
-    for(size_t i = 0; i < g_wave_max_waves; i++)
+    if(self->size != size)
     {
-        struct wave_s* wave = &g_wave_table[i];
-        for(size_t j = 0; j < g_synth_buffer_size; j++)
+        free_wave_table(self);
+        if(size > 0)
         {
-            wave->data.buffer0[j] = g_wave_ambient_cell;
+            self->block = calloc(size * sizeof(*self->wave) + g_wave_cache_line_bytes, 1);
+            if(self->block == nullptr)
+            {
+                return false;
+            }
+            uintptr_t address = (uintptr_t) self->block;
+            self->wave = (struct wave_s*) ((address + g_wave_cache_line_bytes - 1) / g_wave_cache_line_bytes * g_wave_cache_line_bytes);
+            self->size = size;
         }
-        reset_solver_wave_cells(&wave->solver);
     }
+    return plan_wave_table_block(self, block_size);
 }
 
 static void
-flip_wave(size_t wave_index)
+flip_wave(struct wave_s* self)
 {
-    struct wave_s* self = &g_wave_table[wave_index];
-    for(size_t i = 0; i < g_synth_buffer_size; i++)
+    for(size_t i = 0; i < self->data.size; i++)
     {
         self->data.buffer1[i] = self->data.buffer0[i];
     }
     self->data.index = 0;
 }
 
+/* The mean speed of sound of the block's staged signal, which sets the waveguide
+ * delays the way the gas temperature sets the solver's wave speeds.
+ */
+
+static double
+calc_wave_signal_sound_speed_m_per_s(struct wave_prim_s signal[], size_t size)
+{
+    double sum_m_per_s = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum_m_per_s += sqrt(g_wave_gamma * signal[i].p / signal[i].r);
+    }
+    return sum_m_per_s / size;
+}
+
+static void
+batch_waveguide(struct wave_s* self, double mic_position_ratio)
+{
+    tune_waveguide(&self->guide, calc_wave_signal_sound_speed_m_per_s(self->data.buffer1, self->data.size), mic_position_ratio, self->data.size);
+    for(size_t i = 0; i < self->data.size; i++)
+    {
+        double source_pa = self->data.buffer1[i].p - g_gas_ambient_static_pressure_pa;
+        self->data.wave_sub_buffer_pa[i] = g_gas_ambient_static_pressure_pa + step_waveguide(&self->guide, source_pa);
+    }
+}
+
+/* A plenum with a waveguide network runs it in place of the solver whenever cfd
+ * is on; either falls back to the staged pressure if it cannot be allocated.
+ */
+
 static void
 batch_wave(
-    size_t wave_index,
+    struct wave_s* self,
     bool use_cfd,
+    const struct waveguide_desc_s* waveguide,
     double pipe_length_m,
     double mic_position_ratio,
     double velocity_low_pass_cutoff_frequency_hz)
 {
-    struct wave_s* self = &g_wave_table[wave_index];
-    double wave_dx_m = pipe_length_m / g_wave_cells;
-    self->solver.max_wave_speed_m_per_s = wave_dx_m / g_wave_dt_s;
-    self->solver.gradient_s_per_m = g_wave_dt_s / wave_dx_m;
     self->solver.pipe_length_m = pipe_length_m;
     self->solver.mic_position_ratio = mic_position_ratio;
     self->solver.velocity_low_pass_cutoff_frequency_hz = velocity_low_pass_cutoff_frequency_hz;
-    for(size_t i = 0; i < g_synth_buffer_size; i++)
+    self->guide.is_active = use_cfd && waveguide && plan_waveguide(&self->guide, waveguide);
+    if(self->guide.is_active)
+    {
+        batch_waveguide(self, mic_position_ratio);
+        return;
+    }
+    if(use_cfd && (waveguide || plan_solver_wave(&self->solver, calc_wave_cell_count(pipe_length_m)) == false))
+    {
+        use_cfd = false;
+    }
+    if(use_cfd)
+    {
+        size_t substeps = calc_solver_wave_substeps(&self->solver, self->data.buffer1, self->data.size);
+        double wave_dt_s = g_std_dt_s / substeps;
+        double wave_dx_m = pipe_length_m / self->solver.cells;
+        double u_filter_alpha = calc_lowpass_alpha(velocity_low_pass_cutoff_frequency_hz, g_std_dt_s);
+        self->solver.substeps = substeps;
+        self->solver.gradient_s_per_m = wave_dt_s / wave_dx_m;
+        self->solver.u_filter_alpha = 1.0 - pow(1.0 - u_filter_alpha, (double) g_wave_reference_substeps / substeps);
+    }
+    for(size_t i = 0; i < self->data.size; i++)
     {
         if(use_cfd)
         {
@@ -292,8 +856,7 @@ batch_wave(
 }
 
 static void
-stage_wave(size_t wave_index, struct wave_prim_s prim)
+stage_wave(struct wave_s* self, struct wave_prim_s prim)
 {
-    struct wave_s* self = &g_wave_table[wave_index];
     self->data.buffer0[self->data.index++] = prim;
 }
@@ -0,0 +1,337 @@
+/*
+ * Digital waveguide exhaust, a few operations per sample per pipe where the wave
+ * solver spends every cell of every substep.
+ *
+ * An exhaust plenum's pipe network is a tree of waveguide tubes rooted at the
+ * plenum. Where a pipe ends in branches the waves scatter through a lossless
+ * junction weighted by each port's admittance Y = A / (rho * c), which for ideal
+ * gas at one pressure goes as A * c:
+ *
+ *              sum(Y_i * p_i+)
+ * p_node = 2 * ---------------        p_i- = p_node - p_i+
+ *                  sum(Y_i)
+ *
+ * so an area step (collector, muffler can) is a junction with one branch and a
+ * side branch resonator is a junction with two. Leaves are either closed, p- = p+,
+ * or open, where radiation reflects -p+ through a lowpass passing ka < 1 and the
+ * pipe is made longer by the 0.6133 a end correction.
+ *
+ * The plenum drives the root as a pressure source seen through inlet_reflection,
+ * -1 holding the inlet at the plenum pressure like the solver's signal cell. Every
+ * pipe loses a fraction of each wave per traversal. Pipes without a temperature
+ * follow the speed of sound of the staged plenum gas.
+ */
+
+#define WAVEGUIDE_ENDS \
+    X(open)            \
+    X(closed)
+
+enum waveguide_end_e
+{
+#define X(end) g_waveguide_end_##end,
+    WAVEGUIDE_ENDS
+#undef X
+    g_waveguide_end_e_size
+};
+
+constexpr char g_waveguide_end_string[][16] = {
+#define X(end) #end,
+    WAVEGUIDE_ENDS
+#undef X
+};
+
+#undef WAVEGUIDE_ENDS
+
+constexpr size_t g_waveguide_max_pipes = 12;
+constexpr double g_waveguide_min_speed_m_per_s = 250.0;
+constexpr double g_waveguide_max_temperature_k = 1500.0;
+constexpr double g_waveguide_ambient_speed_m_per_s = 347.0;
+constexpr double g_waveguide_end_correction_ratio = 0.6133;
+constexpr double g_waveguide_default_loss = 0.01;
+constexpr double g_waveguide_default_inlet_reflection = -1.0;
+constexpr double g_waveguide_speed_smoothing_ratio = 0.25;
+
+struct waveguide_pipe_desc_s
+{
+    int parent; // -1 for the pipe leaving the plenum
+    enum waveguide_end_e end;
+    double length_m;
+    double diameter_m;
+    double loss;
+    double temperature_k; // 0 follows the plenum gas
+};
+
+struct waveguide_desc_s
+{
+    struct waveguide_pipe_desc_s pipe[g_waveguide_max_pipes];
+    size_t pipes;
+    double inlet_reflection;
+};
+
+/* Branches of a pipe form a list through first_branch and next_branch, both -1
+ * terminated, and the mic sits at mic_ratio along mic_pipe on the path that always
+ * takes the first branch.
+ */
+
+struct waveguide_s
+{
+    struct waveguide_desc_s desc;
+    struct waveguide_tube_s tube[g_waveguide_max_pipes];
+    struct lowpass_filter_s radiation_filter[g_waveguide_max_pipes];
+    double radiation_alpha[g_waveguide_max_pipes];
+    double admittance[g_waveguide_max_pipes];
+    double junction_ratio[g_waveguide_max_pipes];
+    int first_branch[g_waveguide_max_pipes];
+    int next_branch[g_waveguide_max_pipes];
+    double* block;
+    double speed_m_per_s;
+    size_t mic_pipe;
+    double mic_ratio;
+    bool is_active;
+};
+
+/* Null when the description can be built, else why not.
+ */
+
+static const char*
+check_waveguide_desc(const struct waveguide_desc_s* self)
+{
+    if(self->pipes == 0 || self->pipes > g_waveguide_max_pipes)
+    {
+        return "pipe count out of range";
+    }
+    if(self->inlet_reflection < -1.0 || self->inlet_reflection >= 1.0)
+    {
+        return "inlet_reflection outside [-1, 1)";
+    }
+    for(size_t i = 0; i < self->pipes; i++)
+    {
+        const struct waveguide_pipe_desc_s* pipe = &self->pipe[i];
+        if(i == 0 ? pipe->parent != -1 : pipe->parent < 0 || pipe->parent >= (int) i)
+        {
+            return "the first pipe must leave the plenum and every other pipe must branch off an earlier one";
+        }
+        if(pipe->length_m <= 0.0 || pipe->diameter_m <= 0.0)
+        {
+            return "pipe length and diameter must be positive";
+        }
+        if(pipe->loss < 0.0 || pipe->loss >= 1.0)
+        {
+            return "pipe loss outside [0, 1)";
+        }
+        if(pipe->temperature_k < 0.0 || pipe->temperature_k > g_waveguide_max_temperature_k)
+        {
+            return "pipe temperature out of range";
+        }
+    }
+    return nullptr;
+}
+
+static double
+calc_waveguide_pipe_area_m2(const struct waveguide_pipe_desc_s* pipe)
+{
+    return 0.25 * g_std_pi_r * pipe->diameter_m * pipe->diameter_m;
+}
+
+static bool
+is_waveguide_leaf(struct waveguide_s* self, size_t pipe)
+{
+    return self->first_branch[pipe] == -1;
+}
+
+static double
+calc_waveguide_acoustic_length_m(struct waveguide_s* self, size_t pipe)
+{
+    const struct waveguide_pipe_desc_s* desc = &self->desc.pipe[pipe];
+    bool is_open = is_waveguide_leaf(self, pipe) && desc->end == g_waveguide_end_open;
+    return desc->length_m + (is_open ? g_waveguide_end_correction_ratio * 0.5 * desc->diameter_m : 0.0);
+}
+
+static double
+calc_waveguide_pipe_speed_m_per_s(struct waveguide_s* self, size_t pipe)
+{
+    double temperature_k = self->desc.pipe[pipe].temperature_k;
+    if(temperature_k > 0.0)
+    {
+        return g_waveguide_ambient_speed_m_per_s * sqrt(temperature_k / g_gas_ambient_static_temperature_k);
+    }
+    return self->speed_m_per_s;
+}
+
+static void
+reset_waveguide(struct waveguide_s* self)
+{
+    if(self->block == nullptr)
+    {
+        return;
+    }
+    for(size_t i = 0; i < self->desc.pipes; i++)
+    {
+        clear_waveguide_tube(&self->tube[i]);
+        self->tube[i].delay = 1.0;
+        self->tube[i].delay_step = 0.0;
+        self->radiation_filter[i] = (struct lowpass_filter_s) {};
+    }
+    self->speed_m_per_s = 0.0;
+}
+
+static void
+free_waveguide(struct waveguide_s* self)
+{
+    free(self->block);
+    *self = (struct waveguide_s) {};
+}
+
+static void
+link_waveguide_branches(struct waveguide_s* self)
+{
+    for(size_t i = 0; i < self->desc.pipes; i++)
+    {
+        self->first_branch[i] = -1;
+        self->next_branch[i] = -1;
+    }
+    for(size_t i = self->desc.pipes - 1; i > 0; i--)
+    {
+        int parent = self->desc.pipe[i].parent;
+        self->next_branch[i] = self->first_branch[parent];
+        self->first_branch[parent] = i;
+    }
+}
+
+/* Lines are sized for the coldest gas expected, so a hot reload of the same
+ * network keeps its state and only a changed description starts over.
+ */
+
+static bool
+plan_waveguide(struct waveguide_s* self, const struct waveguide_desc_s* desc)
+{
+    if(self->block && memcmp(&self->desc, desc, sizeof(*desc)) == 0)
+    {
+        return true;
+    }
+    free_waveguide(self);
+    self->desc = *desc;
+    link_waveguide_branches(self);
+    size_t capacity[g_waveguide_max_pipes] = {};
+    size_t total = 0;
+    for(size_t i = 0; i < desc->pipes; i++)
+    {
+        double min_speed_m_per_s = desc->pipe[i].temperature_k > 0.0 ? calc_waveguide_pipe_speed_m_per_s(self, i) : g_waveguide_min_speed_m_per_s;
+        capacity[i] = calc_waveguide_tube_capacity(calc_waveguide_acoustic_length_m(self, i) * g_std_audio_sample_rate_hz / min_speed_m_per_s);
+        total += 2 * capacity[i];
+    }
+    self->block = calloc(total, sizeof(*self->block));
+    if(self->block == nullptr)
+    {
+        free_waveguide(self);
+        return false;
+    }
+    for(size_t i = 0, offset = 0; i < desc->pipes; i++)
+    {
+        place_waveguide_tube(&self->tube[i], &self->block[offset], capacity[i]);
+        offset += 2 * capacity[i];
+    }
+    reset_waveguide(self);
+    return true;
+}
+
+static void
+place_waveguide_mic(struct waveguide_s* self, double mic_position_ratio)
+{
+    double path_length_m = 0.0;
+    for(int i = 0; i != -1; i = self->first_branch[i])
+    {
+        path_length_m += self->desc.pipe[i].length_m;
+    }
+    double mic_m = mic_position_ratio * path_length_m;
+    int pipe = 0;
+    while(self->first_branch[pipe] != -1 && mic_m > self->desc.pipe[pipe].length_m)
+    {
+        mic_m -= self->desc.pipe[pipe].length_m;
+        pipe = self->first_branch[pipe];
+    }
+    self->mic_pipe = pipe;
+    self->mic_ratio = clamp(mic_m / self->desc.pipe[pipe].length_m, 0.0, 1.0);
+}
+
+/* Called once a block with the plenum gas's speed of sound; delays glide to their
+ * new lengths over the block and junction weights follow the per pipe speeds.
+ */
+
+static void
+tune_waveguide(struct waveguide_s* self, double speed_m_per_s, double mic_position_ratio, size_t steps)
+{
+    if(isfinite(speed_m_per_s) == false)
+    {
+        speed_m_per_s = self->speed_m_per_s;
+    }
+    self->speed_m_per_s = self->speed_m_per_s == 0.0
+        ? speed_m_per_s
+        : self->speed_m_per_s + g_waveguide_speed_smoothing_ratio * (speed_m_per_s - self->speed_m_per_s);
+    for(size_t i = 0; i < self->desc.pipes; i++)
+    {
+        double pipe_speed_m_per_s = calc_waveguide_pipe_speed_m_per_s(self, i);
+        double radius_m = 0.5 * self->desc.pipe[i].diameter_m;
+        glide_waveguide_tube(&self->tube[i], calc_waveguide_acoustic_length_m(self, i) * g_std_audio_sample_rate_hz / pipe_speed_m_per_s, steps);
+        self->admittance[i] = calc_waveguide_pipe_area_m2(&self->desc.pipe[i]) * pipe_speed_m_per_s;
+        self->radiation_alpha[i] = calc_lowpass_alpha(pipe_speed_m_per_s / (2.0 * g_std_pi_r * radius_m), g_std_dt_s);
+    }
+    for(size_t i = 0; i < self->desc.pipes; i++)
+    {
+        double total_admittance = self->admittance[i];
+        for(int branch = self->first_branch[i]; branch != -1; branch = self->next_branch[branch])
+        {
+            total_admittance += self->admittance[branch];
+        }
+        self->junction_ratio[i] = 2.0 / total_admittance;
+    }
+    place_waveguide_mic(self, mic_position_ratio);
+}
+
+/* Takes the plenum's pressure above ambient and returns the mic's.
+ */
+
+static double
+step_waveguide(struct waveguide_s* self, double source_pa)
+{
+    size_t pipes = self->desc.pipes;
+    double down[g_waveguide_max_pipes];
+    double up[g_waveguide_max_pipes];
+    double fwd[g_waveguide_max_pipes];
+    double rev[g_waveguide_max_pipes];
+    for(size_t i = 0; i < pipes; i++)
+    {
+        double gain = 1.0 - self->desc.pipe[i].loss;
+        down[i] = gain * read_waveguide_tube_fwd(&self->tube[i]);
+        up[i] = gain * read_waveguide_tube_rev(&self->tube[i]);
+    }
+    double mic_pa = tap_waveguide_tube(&self->tube[self->mic_pipe], self->mic_ratio);
+    double inlet_reflection = self->desc.inlet_reflection;
+    fwd[0] = 0.5 * (1.0 - inlet_reflection) * source_pa + inlet_reflection * up[0];
+    for(size_t i = 0; i < pipes; i++)
+    {
+        if(is_waveguide_leaf(self, i))
+        {
+            rev[i] = self->desc.pipe[i].end == g_waveguide_end_closed
+                ? down[i]
+                : -filter_lowpass_alpha(&self->radiation_filter[i], self->radiation_alpha[i], down[i]);
+            continue;
+        }
+        double sum = self->admittance[i] * down[i];
+        for(int branch = self->first_branch[i]; branch != -1; branch = self->next_branch[branch])
+        {
+            sum += self->admittance[branch] * up[branch];
+        }
+        double node_pa = self->junction_ratio[i] * sum;
+        rev[i] = node_pa - down[i];
+        for(int branch = self->first_branch[i]; branch != -1; branch = self->next_branch[branch])
+        {
+            fwd[branch] = node_pa - up[branch];
+        }
+    }
+    for(size_t i = 0; i < pipes; i++)
+    {
+        write_waveguide_tube(&self->tube[i], fwd[i], rev[i]);
+    }
+    return mic_pa;
+}
@@ -1,46 +1,111 @@
-#ifndef WAVEGUIDE_TUBE_S_H
-#define WAVEGUIDE_TUBE_S_H
+/*
+ * Digital waveguide tube.
+ *
+ * A lossless pipe carries a right going wave p+ towards its open end and a left
+ * going wave p- back towards the engine, each arriving at the far end
+ *
+ *       L
+ * N = ----- * fs
+ *       c
+ *
+ * samples after it entered, and the pressure anywhere along it is p+ + p-. Both
+ * directions share one write index. Delays are fractional and read with linear
+ * interpolation, which lets N follow the gas temperature sample by sample.
+ */
 
-#include <stdlib.h>
-#include <string.h>
+struct waveguide_tube_s
+{
+    double* fwd; // p+, towards the open end
+    double* rev; // p-, back towards the engine
+    size_t capacity;
+    size_t index;
+    double delay;
+    double delay_step;
+};
 
-typedef struct {
-    float* buf_fwd;     // p+: onda que avanza hacia la salida
-    float* buf_rev;     // p-: onda que vuelve hacia el motor
-    int    length;      // Retardo en muestras (N = L * fs / c)
-    int    write_pos;   // Cabeza de escritura del buffer circular
-} waveguide_tube_t;
+/* Room for the longest delay plus the two interpolation taps.
+ */
 
-// Inicializa el tubo con una longitud fija de muestras
-void waveguide_tube_init(waveguide_tube_t* wg, int delay_samples) {
-    wg->length = delay_samples;
-    wg->write_pos = 0;
+static size_t
+calc_waveguide_tube_capacity(double max_delay)
+{
+    return ceil(max_delay) + 2;
+}
+
+static void
+place_waveguide_tube(struct waveguide_tube_s* self, double* block, size_t capacity)
+{
+    *self = (struct waveguide_tube_s) {
+        .fwd = &block[0],
+        .rev = &block[capacity],
+        .capacity = capacity,
+        .delay = 1.0,
+    };
+}
+
+static void
+clear_waveguide_tube(struct waveguide_tube_s* self)
+{
+    for(size_t i = 0; i < self->capacity; i++)
+    {
+        self->fwd[i] = 0.0;
+        self->rev[i] = 0.0;
+    }
+    self->index = 0;
+}
 
-    // Asignacin de memoria limpia
-    wg->buf_fwd = (float*)calloc(delay_samples, sizeof(float));
-    wg->buf_rev = (float*)calloc(delay_samples, sizeof(float));
+/* Glides the delay to a new length over the next samples steps.
+ */
+
+static void
+glide_waveguide_tube(struct waveguide_tube_s* self, double delay, size_t steps)
+{
+    delay = clamp(delay, 1.0, self->capacity - 2.0);
+    self->delay_step = (delay - self->delay) / steps;
 }
 
-// Libera la memoria
-void waveguide_tube_free(waveguide_tube_t* wg) {
-    if (wg->buf_fwd) { free(wg->buf_fwd); wg->buf_fwd = NULL; }
-    if (wg->buf_rev) { free(wg->buf_rev); wg->buf_rev = NULL; }
+/* A delay of one reads the most recent write.
+ */
+
+static double
+read_waveguide_tube_line(struct waveguide_tube_s* self, const double line[], double delay)
+{
+    double position = self->index + self->capacity - delay;
+    size_t a = position;
+    double fraction = position - a;
+    a = a >= self->capacity ? a - self->capacity : a;
+    size_t b = a + 1 == self->capacity ? 0 : a + 1;
+    return line[a] + fraction * (line[b] - line[a]);
 }
 
-// Procesa una muestra a travs del tubo
-void waveguide_tube_step(waveguide_tube_t* wg, float in_fwd, float in_rev, float* out_fwd, float* out_rev) {
-    // Leer el extremo opuesto (lo que entr hace 'length' muestras)
-    int read_pos = (wg->write_pos + 1) % wg->length;
+static double
+read_waveguide_tube_fwd(struct waveguide_tube_s* self)
+{
+    return read_waveguide_tube_line(self, self->fwd, self->delay);
+}
 
-    *out_fwd = wg->buf_fwd[read_pos];
-    *out_rev = wg->buf_rev[wg->write_pos];
+static double
+read_waveguide_tube_rev(struct waveguide_tube_s* self)
+{
+    return read_waveguide_tube_line(self, self->rev, self->delay);
+}
 
-    // Escribir la nueva entrada en la cabeza actual
-    wg->buf_fwd[wg->write_pos] = in_fwd;
-    wg->buf_rev[read_pos] = in_rev;
+/* Pressure at ratio along the tube, 0 being the end p+ enters.
+ */
 
-    // Avanzar la cabeza de escritura
-    wg->write_pos = read_pos;
+static double
+tap_waveguide_tube(struct waveguide_tube_s* self, double ratio)
+{
+    double fwd_delay = max(ratio * self->delay, 1.0);
+    double rev_delay = max((1.0 - ratio) * self->delay, 1.0);
+    return read_waveguide_tube_line(self, self->fwd, fwd_delay) + read_waveguide_tube_line(self, self->rev, rev_delay);
 }
 
-#endif // WAVEGUIDE_TUBE_S_H
\ No newline at end of file
+static void
+write_waveguide_tube(struct waveguide_tube_s* self, double fwd, double rev)
+{
+    self->fwd[self->index] = fwd;
+    self->rev[self->index] = rev;
+    self->index = self->index + 1 == self->capacity ? 0 : self->index + 1;
+    self->delay += self->delay_step;
+}
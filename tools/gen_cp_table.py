@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+gen_cp_table.py
+===============
+Genera src/cp_table.h: la tabla de cp (J/mol/K) de las seis especies de
+ensim4, evaluada con los coeficientes NASA Glenn de src/gamma.h.
+
+La tabla queda armada en tiempo de compilación (el motor ya no la calcula
+al arrancar). Hay una fila por kelvin entero, de 0 K a 6000 K, con las seis
+especies juntas en el orden de las fracciones molares de gas_s y rellenada
+a ocho lanes: una fila ocupa exactamente una línea de caché de 64 bytes y
+la mezcla es un solo producto punto con las fracciones molares.
+
+El motor trunca la temperatura para elegir la fila, así que cada fila guarda
+el cp del centro de su kelvin (T + 0.5 K): el error queda en la mitad del de
+la tabla vieja, que guardaba el cp del borde.
+
+USO:
+    python3 tools/gen_cp_table.py            # regenera src/cp_table.h
+    python3 tools/gen_cp_table.py --check    # falla si src/cp_table.h no
+                                             # coincide con gamma.h
+
+Regenerar cada vez que cambien los coeficientes de gamma.h; `make check`
+corre --check.
+
+OPCIONES:
+    --gamma FILE.h     Fuente de los coeficientes (default: src/gamma.h)
+    --output FILE.h    Header de salida (default: src/cp_table.h)
+    --check            No escribir nada: comparar el header con lo que se
+                       generaría y salir con error si difieren
+"""
+
+import os
+import re
+import sys
+import argparse
+
+# Orden de las fracciones molares en gas_s: el orden de los lanes de cada fila
+SPECIES = ["n2", "o2", "ar", "c8h18", "co2", "h2o"]
+LANES = 8
+MIN_TEMPERATURE_K = 200.0
+MAX_TEMPERATURE_K = 6000.0
+SWITCH_TEMPERATURE_K = 1000.0
+# Una fila por kelvin entero, de 0 K hasta el último kelvin del rango
+ROWS = int(MAX_TEMPERATURE_K) + 1
+
+REPO = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def load_weights(gamma_path):
+    """Lee los coeficientes g_gamma_cp_weights_{lower,upper}_<especie> de gamma.h."""
+    with open(gamma_path, "r", encoding="utf-8") as f:
+        text = f.read()
+    constant_re = re.compile(r"constexpr double g_gamma_universal_gas_constant_j_per_mol_k\s*=\s*([-+0-9.eE]+);")
+    weights_re = re.compile(r"g_gamma_cp_weights_(lower|upper)_(\w+)\[\]\s*=\s*\{([^}]*)\}")
+    match = constant_re.search(text)
+    if not match:
+        sys.exit(f"[gen_cp_table] no encontré la constante universal de los gases en '{gamma_path}'")
+    weights = {}
+    for side, species, values in weights_re.findall(text):
+        weights[(side, species)] = [float(v) for v in values.replace("\n", " ").split(",") if v.strip()]
+    for species in SPECIES:
+        for side in ("lower", "upper"):
+            if len(weights.get((side, species), [])) != 7:
+                sys.exit(f"[gen_cp_table] faltan los 7 coeficientes {side} de {species} en '{gamma_path}'")
+    return float(match.group(1)), weights
+
+
+def calc_cp(T, R, lower, upper):
+    """Ecuación 1 de McBride et al., con las mismas operaciones que calc_cp_j_per_mol_k."""
+    T1 = min(max(T, MIN_TEMPERATURE_K), MAX_TEMPERATURE_K)
+    a = lower if T1 < SWITCH_TEMPERATURE_K else upper
+    T2 = T1 * T1
+    T3 = T2 * T1
+    T4 = T3 * T1
+    inv_T1 = 1.0 / T1
+    inv_T2 = inv_T1 * inv_T1
+    return (a[0] * inv_T2 + a[1] * inv_T1 + a[2] + a[3] * T1 + a[4] * T2 + a[5] * T3 + a[6] * T4) * R
+
+
+def build_rows(R, weights):
+    """Fila t: cp en el centro del kelvin [t, t + 1), fuera del rango queda plano."""
+    rows = []
+    for t in range(ROWS):
+        rows.append([calc_cp(t + 0.5, R, weights[("lower", s)], weights[("upper", s)]) for s in SPECIES])
+    return rows
+
+
+def measure_error(R, weights, rows, samples_per_row=8):
+    """Máximo error relativo de truncar la temperatura a la fila, por especie."""
+    worst = {s: 0.0 for s in SPECIES}
+    for t in range(len(rows) - 1):
+        for k in range(samples_per_row):
+            T = t + (k + 0.5) / samples_per_row
+            for lane, s in enumerate(SPECIES):
+                exact = calc_cp(T, R, weights[("lower", s)], weights[("upper", s)])
+                worst[s] = max(worst[s], abs(rows[t][lane] / exact - 1.0))
+    return worst
+
+
+def rows_to_header(rows, error):
+    worst = max(error.values())
+    lines = []
+    lines.append("/* Generated by tools/gen_cp_table.py from the NASA Glenn coefficients in gamma.h; do not edit.")
+    lines.append(" *")
+    lines.append(f" * cp in J/(mol K) for every whole kelvin from 0 K to {MAX_TEMPERATURE_K:.0f} K, taken at the middle of")
+    lines.append(" * the kelvin, with the species interleaved in gas_s mol ratio order and padded to a")
+    lines.append(f" * 64 byte cache line. Truncating the temperature to a row stays within {worst:.1e} of the")
+    lines.append(f" * polynomials, which are flat outside {MIN_TEMPERATURE_K:.0f} K to {MAX_TEMPERATURE_K:.0f} K.")
+    lines.append(" */")
+    lines.append("")
+    width = max(len("#define CP_SPECIES"), max(len(f"    X({s})") for s in SPECIES)) + 1
+    lines.append("#define CP_SPECIES".ljust(width) + "\\")
+    for i, s in enumerate(SPECIES):
+        lines.append(f"    X({s})".ljust(width) + "\\" if i + 1 < len(SPECIES) else f"    X({s})")
+    lines.append("")
+    lines.append("enum cp_species_e")
+    lines.append("{")
+    lines.append("#define X(name) g_cp_species_##name,")
+    lines.append("    CP_SPECIES")
+    lines.append("#undef X")
+    lines.append("    g_cp_species_e_size")
+    lines.append("};")
+    lines.append("")
+    lines.append("#undef CP_SPECIES")
+    lines.append("")
+    lines.append(f"constexpr size_t g_cp_table_size = {len(rows)};")
+    lines.append(f"constexpr size_t g_cp_table_lanes = {LANES};")
+    lines.append("")
+    lines.append("struct cp_table_row_s")
+    lines.append("{")
+    lines.append("    alignas(64) double cp_j_per_mol_k[g_cp_table_lanes];")
+    lines.append("};")
+    lines.append("")
+    lines.append("constexpr struct cp_table_row_s g_cp_table[g_cp_table_size] = {")
+    for t, row in enumerate(rows):
+        values = ", ".join(f"{v:.12g}" for v in row)
+        lines.append(f"    {{{{ {values} }}}}, /* {t} K */")
+    lines.append("};")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Genera la tabla de cp de ensim4 a partir de gamma.h",
+        epilog=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("--gamma", default=os.path.join(REPO, "src", "gamma.h"), help="Coeficientes NASA (default: src/gamma.h)")
+    parser.add_argument("--output", default=os.path.join(REPO, "src", "cp_table.h"), help="Header de salida (default: src/cp_table.h)")
+    parser.add_argument("--check", action="store_true", help="Solo comparar el header con lo que se generaría")
+    args = parser.parse_args()
+
+    R, weights = load_weights(args.gamma)
+    rows = build_rows(R, weights)
+    error = measure_error(R, weights, rows)
+    for s in SPECIES:
+        print(f"[gen_cp_table] {s:>6}: error relativo máximo {error[s]:.2e}")
+    print(f"[gen_cp_table] {len(rows)} filas de {LANES * 8} bytes ({len(rows) * LANES * 8 / 1024:.1f} KiB)")
+    header = rows_to_header(rows, error)
+    if args.check:
+        current = None
+        if os.path.exists(args.output):
+            with open(args.output, "r", encoding="utf-8") as f:
+                current = f.read()
+        if current != header:
+            sys.exit(f"[gen_cp_table] '{args.output}' no coincide con '{args.gamma}': correr tools/gen_cp_table.py")
+        print(f"[gen_cp_table] '{args.output}' al día")
+        return
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(header)
+    print(f"[gen_cp_table] escrito '{args.output}'")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+plot_bench_sweep.py
+===================
+Dibuja las curvas de escalado de un barrido de ensim4-bench: factor de
+tiempo real contra núcleos, una curva por cantidad de cilindros y un
+gráfico por cantidad de caños y CFD apagado/prendido.
+
+USO:
+    ./ensim4-bench --sweep --cylinders 1:16 --pipes 1:4 -o sweep.json
+    python3 plot_bench_sweep.py sweep.json --output sweep.png
+
+Sin matplotlib (o con --table) solo imprime la tabla: el máximo de
+cilindros que corre en tiempo real para cada combinación de núcleos,
+caños y CFD.
+
+OPCIONES:
+    --output FILE.png  Imagen de salida (default: mostrar en pantalla)
+    --table            Solo la tabla, sin gráficos
+"""
+
+import sys
+import json
+import argparse
+
+# ── Dependencias opcionales ────────────────────────────────────
+try:
+    import matplotlib
+    HAS_MATPLOTLIB = True
+except ImportError:
+    HAS_MATPLOTLIB = False
+    print("[plot_bench_sweep] matplotlib no encontrado — solo se imprime la tabla")
+
+
+def load_sweep(filepath):
+    """Lee el reporte y devuelve los puntos del barrido."""
+    with open(filepath, "r", encoding="utf-8") as f:
+        report = json.load(f)
+    points = report.get("sweep", [])
+    if not points:
+        sys.exit(f"[plot_bench_sweep] '{filepath}' no tiene barrido (¿corriste ensim4-bench --sweep?)")
+    return report.get("build", {}), points
+
+
+def group_points(points):
+    """Agrupa por (caños, cfd) y después por cilindros: {(caños, cfd): {cil: [(núcleos, rtf)]}}."""
+    groups = {}
+    for p in points:
+        curves = groups.setdefault((p["pipes"], p["cfd"]), {})
+        curves.setdefault(p["cylinders"], []).append((p["cores"], p["realtime_factor"]))
+    for curves in groups.values():
+        for curve in curves.values():
+            curve.sort()
+    return groups
+
+
+def print_realtime_table(points):
+    """Máximo de cilindros en tiempo real (factor >= 1) por núcleos, caños y CFD."""
+    best = {}
+    for p in points:
+        key = (p["cores"], p["pipes"], p["cfd"])
+        best.setdefault(key, 0)
+        if p["realtime_factor"] >= 1.0 and not p.get("panic"):
+            best[key] = max(best[key], p["cylinders"])
+    print(f"{'núcleos':>8} {'caños':>6} {'cfd':>4} {'cilindros en tiempo real':>26}")
+    for (cores, pipes, cfd), cylinders in sorted(best.items()):
+        print(f"{cores:>8} {pipes:>6} {'on' if cfd else 'off':>4} {cylinders:>26}")
+
+
+def plot_sweep(build, points, output):
+    if output:
+        matplotlib.use("Agg")
+    import matplotlib.pyplot as plt
+
+    groups = group_points(points)
+    pipes = sorted({k[0] for k in groups})
+    cfds = sorted({k[1] for k in groups})
+    fig, axes = plt.subplots(len(cfds), len(pipes), squeeze=False, sharex=True, sharey=True,
+                             figsize=(4 * len(pipes), 3.5 * len(cfds)))
+    for row, cfd in enumerate(cfds):
+        for col, pipe in enumerate(pipes):
+            ax = axes[row][col]
+            for cylinders, curve in sorted(groups.get((pipe, cfd), {}).items()):
+                cores = [c for c, _ in curve]
+                rtf = [r for _, r in curve]
+                ax.plot(cores, rtf, marker="o", label=f"{cylinders} cil")
+            ax.axhline(1.0, color="k", linestyle="--", linewidth=1)
+            ax.set_title(f"{pipe} caño{'s' if pipe > 1 else ''}, cfd {'on' if cfd else 'off'}")
+            ax.set_yscale("log")
+            ax.grid(True, which="both", alpha=0.3)
+            if row == len(cfds) - 1:
+                ax.set_xlabel("núcleos")
+            if col == 0:
+                ax.set_ylabel("factor de tiempo real")
+    handles, labels = axes[0][0].get_legend_handles_labels()
+    if handles:
+        fig.legend(handles, labels, loc="center right")
+    fig.suptitle(f"{build.get('compiled_engine', 'ensim4')} — {build.get('simd', '')}, "
+                 f"{build.get('logical_cores', '?')} núcleos lógicos")
+    fig.tight_layout(rect=(0, 0, 0.9, 1))
+    if output:
+        fig.savefig(output, dpi=120)
+        print(f"[plot_bench_sweep] guardado en '{output}'")
+    else:
+        plt.show()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Curvas de escalado de ensim4-bench --sweep",
+        epilog=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("report", help="Reporte JSON de ensim4-bench --sweep")
+    parser.add_argument("--output", help="Imagen de salida (default: mostrar)")
+    parser.add_argument("--table", action="store_true", help="Solo imprimir la tabla")
+    args = parser.parse_args()
+
+    build, points = load_sweep(args.report)
+    print_realtime_table(points)
+    if HAS_MATPLOTLIB and not args.table:
+        plot_sweep(build, points, args.output)
+
+
+if __name__ == "__main__":
+    main()